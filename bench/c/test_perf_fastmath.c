@@ -0,0 +1,289 @@
+/* Copyright (C) 2015, WSID   */
+
+/* Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <glib.h>
+
+#include "crankbase.h"
+
+//////// Declaration ///////////////////////////////////////////////////////////
+
+typedef void (*BenchCplxFunc) (const guint           n,
+                               const CrankCplxFloat *a,
+                               CrankCplxFloat       *r);
+
+typedef void (*BenchQuatFunc) (const guint           n,
+                               const CrankQuatFloat *a,
+                               CrankQuatFloat       *r);
+
+// Pair of precise function and fast function.
+typedef struct _BenchCplxPair {
+  BenchCplxFunc precise;
+  BenchCplxFunc fast;
+} BenchCplxPair;
+
+typedef struct _BenchQuatPair {
+  BenchQuatFunc precise;
+  BenchQuatFunc fast;
+} BenchQuatPair;
+
+static CrankCplxFloat *test_gen_cplx (CrankBenchRun *run,
+                                      const guint    n);
+
+static CrankQuatFloat *test_gen_quat (CrankBenchRun *run,
+                                      const guint    n);
+
+static void bench_cplx_precise (CrankBenchRun *run,
+                                BenchCplxPair *pair);
+static void bench_cplx_fast (CrankBenchRun *run,
+                             BenchCplxPair *pair);
+static void bench_quat_precise (CrankBenchRun *run,
+                                BenchQuatPair *pair);
+static void bench_quat_fast (CrankBenchRun *run,
+                             BenchQuatPair *pair);
+
+//////// Functions to compare //////////////////////////////////////////////////
+
+static BenchCplxPair bench_cplx_ln = {
+  crank_cplx_float_batch_ln,
+  crank_cplx_float_batch_ln_fast
+};
+
+static BenchCplxPair bench_cplx_exp = {
+  crank_cplx_float_batch_exp,
+  crank_cplx_float_batch_exp_fast
+};
+
+static BenchCplxPair bench_cplx_cosh = {
+  crank_cplx_float_batch_cosh,
+  crank_cplx_float_batch_cosh_fast
+};
+
+static BenchCplxPair bench_cplx_cos = {
+  crank_cplx_float_batch_cos,
+  crank_cplx_float_batch_cos_fast
+};
+
+static BenchQuatPair bench_quat_ln = {
+  crank_quat_float_batch_ln,
+  crank_quat_float_batch_ln_fast
+};
+
+static BenchQuatPair bench_quat_exp = {
+  crank_quat_float_batch_exp,
+  crank_quat_float_batch_exp_fast
+};
+
+//////// Main //////////////////////////////////////////////////////////////////
+
+gint
+main (gint   argc,
+      gchar *argv[])
+{
+  CrankBenchParamNode  *params;
+  CrankBenchParamNode **vparams;
+
+  crank_bench_init (&argc, &argv);
+
+  // Fast kernels can be compared by running with CRANK_SIMD=none, avx2, ...
+  params = crank_bench_param_node_new ();
+
+  crank_bench_param_node_set_uint (params, "repeat", 16);
+  crank_bench_param_node_set_uint (params, "N", 1000);
+
+  vparams = crank_bench_param_node_add_placeholders (params, 2);
+  crank_bench_param_node_set_uint (vparams[0], "N", 10000);
+  crank_bench_param_node_set_uint (vparams[1], "N", 100000);
+
+  crank_bench_add ("/crank/base/cplx/float/bench/ln/precise",
+                   (CrankBenchFunc)bench_cplx_precise, &bench_cplx_ln, NULL);
+  crank_bench_add ("/crank/base/cplx/float/bench/ln/fast",
+                   (CrankBenchFunc)bench_cplx_fast, &bench_cplx_ln, NULL);
+  crank_bench_add ("/crank/base/cplx/float/bench/exp/precise",
+                   (CrankBenchFunc)bench_cplx_precise, &bench_cplx_exp, NULL);
+  crank_bench_add ("/crank/base/cplx/float/bench/exp/fast",
+                   (CrankBenchFunc)bench_cplx_fast, &bench_cplx_exp, NULL);
+  crank_bench_add ("/crank/base/cplx/float/bench/cosh/precise",
+                   (CrankBenchFunc)bench_cplx_precise, &bench_cplx_cosh, NULL);
+  crank_bench_add ("/crank/base/cplx/float/bench/cosh/fast",
+                   (CrankBenchFunc)bench_cplx_fast, &bench_cplx_cosh, NULL);
+  crank_bench_add ("/crank/base/cplx/float/bench/cos/precise",
+                   (CrankBenchFunc)bench_cplx_precise, &bench_cplx_cos, NULL);
+  crank_bench_add ("/crank/base/cplx/float/bench/cos/fast",
+                   (CrankBenchFunc)bench_cplx_fast, &bench_cplx_cos, NULL);
+
+  crank_bench_add ("/crank/base/quat/float/bench/ln/precise",
+                   (CrankBenchFunc)bench_quat_precise, &bench_quat_ln, NULL);
+  crank_bench_add ("/crank/base/quat/float/bench/ln/fast",
+                   (CrankBenchFunc)bench_quat_fast, &bench_quat_ln, NULL);
+  crank_bench_add ("/crank/base/quat/float/bench/exp/precise",
+                   (CrankBenchFunc)bench_quat_precise, &bench_quat_exp, NULL);
+  crank_bench_add ("/crank/base/quat/float/bench/exp/fast",
+                   (CrankBenchFunc)bench_quat_fast, &bench_quat_exp, NULL);
+
+  crank_bench_set_param ("/", params);
+
+  return crank_bench_run ();
+}
+
+
+//////// Definition ////////////////////////////////////////////////////////////
+
+static CrankCplxFloat*
+test_gen_cplx (CrankBenchRun *run,
+               const guint    n)
+{
+  CrankCplxFloat *cplx = g_new (CrankCplxFloat, n);
+  guint i;
+
+  for (i = 0; i < n; i++)
+    crank_cplx_float_init (cplx + i,
+                           crank_bench_run_rand_float_range (run, -4, 4),
+                           crank_bench_run_rand_float_range (run, -8, 8));
+
+  return cplx;
+}
+
+static CrankQuatFloat*
+test_gen_quat (CrankBenchRun *run,
+               const guint    n)
+{
+  CrankQuatFloat *quat = g_new (CrankQuatFloat, n);
+  guint i;
+
+  for (i = 0; i < n; i++)
+    crank_quat_float_init (quat + i,
+                           crank_bench_run_rand_float_range (run, -4, 4),
+                           crank_bench_run_rand_float_range (run, -2, 2),
+                           crank_bench_run_rand_float_range (run, -2, 2),
+                           crank_bench_run_rand_float_range (run, -2, 2));
+
+  return quat;
+}
+
+static void
+bench_cplx_precise (CrankBenchRun *run,
+                    BenchCplxPair *pair)
+{
+  guint n = crank_bench_run_get_param_uint (run, "N", 1000);
+  CrankCplxFloat *a = test_gen_cplx (run, n);
+  CrankCplxFloat *r = g_new (CrankCplxFloat, n);
+
+  crank_bench_run_timer_start (run);
+
+  pair->precise (n, a, r);
+
+  crank_bench_run_timer_add_result_elapsed (run, "time");
+
+  g_free (a);
+  g_free (r);
+}
+
+static void
+bench_cplx_fast (CrankBenchRun *run,
+                 BenchCplxPair *pair)
+{
+  guint n = crank_bench_run_get_param_uint (run, "N", 1000);
+  CrankCplxFloat *a = test_gen_cplx (run, n);
+  CrankCplxFloat *r = g_new (CrankCplxFloat, n);
+  CrankCplxFloat *e = g_new (CrankCplxFloat, n);
+  gfloat err = 0;
+  guint i;
+
+  crank_bench_run_timer_start (run);
+
+  pair->fast (n, a, r);
+
+  crank_bench_run_timer_add_result_elapsed (run, "time");
+
+  // Relative error against precise functions.
+  pair->precise (n, a, e);
+
+  for (i = 0; i < n; i++)
+    {
+      CrankCplxFloat d;
+
+      crank_cplx_float_sub (r + i, e + i, &d);
+      err = MAX (err,
+                 crank_cplx_float_get_norm (&d) /
+                 MAX (crank_cplx_float_get_norm (e + i), 1.0f));
+    }
+
+  crank_bench_run_add_result_float (run, "error", err);
+
+  g_free (a);
+  g_free (r);
+  g_free (e);
+}
+
+static void
+bench_quat_precise (CrankBenchRun *run,
+                    BenchQuatPair *pair)
+{
+  guint n = crank_bench_run_get_param_uint (run, "N", 1000);
+  CrankQuatFloat *a = test_gen_quat (run, n);
+  CrankQuatFloat *r = g_new (CrankQuatFloat, n);
+
+  crank_bench_run_timer_start (run);
+
+  pair->precise (n, a, r);
+
+  crank_bench_run_timer_add_result_elapsed (run, "time");
+
+  g_free (a);
+  g_free (r);
+}
+
+static void
+bench_quat_fast (CrankBenchRun *run,
+                 BenchQuatPair *pair)
+{
+  guint n = crank_bench_run_get_param_uint (run, "N", 1000);
+  CrankQuatFloat *a = test_gen_quat (run, n);
+  CrankQuatFloat *r = g_new (CrankQuatFloat, n);
+  CrankQuatFloat *e = g_new (CrankQuatFloat, n);
+  gfloat err = 0;
+  guint i;
+
+  crank_bench_run_timer_start (run);
+
+  pair->fast (n, a, r);
+
+  crank_bench_run_timer_add_result_elapsed (run, "time");
+
+  // Relative error against precise functions.
+  pair->precise (n, a, e);
+
+  for (i = 0; i < n; i++)
+    {
+      CrankQuatFloat d;
+
+      crank_quat_float_sub (r + i, e + i, &d);
+      err = MAX (err,
+                 crank_quat_float_get_norm (&d) /
+                 MAX (crank_quat_float_get_norm (e + i), 1.0f));
+    }
+
+  crank_bench_run_add_result_float (run, "error", err);
+
+  g_free (a);
+  g_free (r);
+  g_free (e);
+}
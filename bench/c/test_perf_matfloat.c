@@ -34,6 +34,8 @@ static void bench_mat_transpose (CrankBenchRun *run);
 static void bench_mat_mul (CrankBenchRun *run);
 static void bench_mat_inv (CrankBenchRun *run);
 static void bench_mat4_mul (CrankBenchRun *run);
+static void bench_mat4_batch_mul (CrankBenchRun *run);
+static void bench_mat4_batch_transform (CrankBenchRun *run);
 
 static void bench_mat_lu (CrankBenchRun *run);
 static void bench_mat_ch (CrankBenchRun *run);
@@ -42,6 +44,12 @@ static void bench_mat_gram_schmidt (CrankBenchRun *run);
 static void bench_mat_householder (CrankBenchRun *run);
 static void bench_mat_givens (CrankBenchRun *run);
 
+static void bench_mat_parallel_transpose (CrankBenchRun *run);
+static void bench_mat_parallel_mul (CrankBenchRun *run);
+static void bench_mat_parallel_mulv (CrankBenchRun *run);
+static void bench_mat_parallel_add (CrankBenchRun *run);
+static void bench_mat_parallel_inv (CrankBenchRun *run);
+
 //////// Main //////////////////////////////////////////////////////////////////
 
 gint
@@ -49,6 +57,7 @@ main (gint   argc,
       gchar *argv[])
 {
   CrankBenchParamNode  *params;
+  CrankBenchParamNode  *pparams;
   CrankBenchParamNode **vparams;
 
   crank_bench_init (&argc, &argv);
@@ -70,6 +79,20 @@ main (gint   argc,
   crank_bench_param_node_set_uint (vparams[0], "N", 2048);
   crank_bench_param_node_set_uint (vparams[1], "N", 4096);
 
+  // Parameters for parallel operations: vary number of threads.
+  pparams = crank_bench_param_node_new ();
+
+  crank_bench_param_node_set_uint (pparams, "repeat", 2);
+  crank_bench_param_node_set_uint (pparams, "N", 1024);
+  crank_bench_param_node_set_uint (pparams, "threads", 1);
+
+  vparams = crank_bench_param_node_add_placeholders (pparams, 5);
+  crank_bench_param_node_set_uint (vparams[0], "threads", 2);
+  crank_bench_param_node_set_uint (vparams[1], "threads", 4);
+  crank_bench_param_node_set_uint (vparams[2], "threads", 8);
+  crank_bench_param_node_set_uint (vparams[3], "threads", 16);
+  crank_bench_param_node_set_uint (vparams[4], "threads", 32);
+
 
   crank_bench_add ("/crank/base/mat/float/n/bench/slice4",
                    (CrankBenchFunc)bench_mat_slice4, NULL, NULL);
@@ -81,6 +104,10 @@ main (gint   argc,
                    (CrankBenchFunc)bench_mat_inv, NULL, NULL);
   crank_bench_add ("/crank/base/mat/float/4/bench/mul",
                    (CrankBenchFunc)bench_mat4_mul, NULL, NULL);
+  crank_bench_add ("/crank/base/mat/float/4/bench/batch/mul",
+                   (CrankBenchFunc)bench_mat4_batch_mul, NULL, NULL);
+  crank_bench_add ("/crank/base/mat/float/4/bench/batch/transform",
+                   (CrankBenchFunc)bench_mat4_batch_transform, NULL, NULL);
 
   crank_bench_add ("/crank/base/mat/float/n/bench/lu",
                    (CrankBenchFunc)bench_mat_lu, NULL, NULL);
@@ -97,6 +124,17 @@ main (gint   argc,
   crank_bench_add ("/crank/base/mat/float/n/bench/qr/givens",
                   (CrankBenchFunc)bench_mat_givens, NULL, NULL);
 
+  crank_bench_add ("/crank/base/mat/float/n/bench/parallel/transpose",
+                   (CrankBenchFunc)bench_mat_parallel_transpose, NULL, NULL);
+  crank_bench_add ("/crank/base/mat/float/n/bench/parallel/mul",
+                   (CrankBenchFunc)bench_mat_parallel_mul, NULL, NULL);
+  crank_bench_add ("/crank/base/mat/float/n/bench/parallel/mulv",
+                   (CrankBenchFunc)bench_mat_parallel_mulv, NULL, NULL);
+  crank_bench_add ("/crank/base/mat/float/n/bench/parallel/add",
+                   (CrankBenchFunc)bench_mat_parallel_add, NULL, NULL);
+  crank_bench_add ("/crank/base/mat/float/n/bench/parallel/inv",
+                   (CrankBenchFunc)bench_mat_parallel_inv, NULL, NULL);
+
   // We don't do bench for eval algorithms for now.
   // The algorithms might be failing/ or may have different time to finish by
   // matrix, which is randomly generated.
@@ -105,6 +143,7 @@ main (gint   argc,
   // eigenvalue shifting, etc..
 
   crank_bench_set_param ("/", params);
+  crank_bench_set_param ("/crank/base/mat/float/n/bench/parallel", pparams);
 
   return crank_bench_run ();
 }
@@ -304,6 +343,55 @@ bench_mat4_mul (CrankBenchRun *run)
   g_free (mats);
 }
 
+static void
+bench_mat4_batch_mul (CrankBenchRun *run)
+{
+  guint j;
+  guint n;
+
+  n = crank_bench_run_get_param_uint (run, "N", 0);
+
+  CrankMatFloat4 *a = g_new (CrankMatFloat4, n);
+  CrankMatFloat4 *b = g_new (CrankMatFloat4, n);
+
+  for (j = 0; j < n; j++)
+    {
+      test_gen_mat_float_4 (run, a + j);
+      test_gen_mat_float_4 (run, b + j);
+    }
+
+  crank_bench_run_timer_start (run);
+
+  crank_mat_float4_batch_mul (n, a, b, a);
+
+  crank_bench_run_timer_add_result_elapsed (run, "time");
+
+  g_free (a);
+  g_free (b);
+}
+
+static void
+bench_mat4_batch_transform (CrankBenchRun *run)
+{
+  guint n;
+
+  n = crank_bench_run_get_param_uint (run, "N", 0);
+
+  CrankMatFloat4 a;
+  CrankVecFloat3 *b = (CrankVecFloat3*)
+                      crank_bench_run_rand_float_array (run, 3 * n);
+
+  test_gen_mat_float_4 (run, &a);
+
+  crank_bench_run_timer_start (run);
+
+  crank_mat_float4_batch_transform (n, &a, b, b);
+
+  crank_bench_run_timer_add_result_elapsed (run, "time");
+
+  g_free (b);
+}
+
 static void
 bench_mat_lu (CrankBenchRun *run)
 {
@@ -447,3 +535,116 @@ bench_mat_givens (CrankBenchRun *run)
   crank_mat_float_n_fini (&a);
   //crank_mat_float_n_fini (&b);
 }
+
+
+
+static void
+bench_mat_parallel_transpose (CrankBenchRun *run)
+{
+  guint threads = crank_bench_run_get_param_uint (run, "threads", 1);
+
+  CrankMatFloatN a;
+  CrankMatFloatN b;
+
+  test_gen_mat_float_n (run, &a);
+
+  crank_bench_run_timer_start (run);
+
+  crank_mat_float_n_transpose_parallel (&a, &b, threads);
+
+  crank_bench_run_timer_add_result_elapsed (run, "time");
+
+  crank_mat_float_n_fini (&a);
+  crank_mat_float_n_fini (&b);
+}
+
+static void
+bench_mat_parallel_mul (CrankBenchRun *run)
+{
+  guint threads = crank_bench_run_get_param_uint (run, "threads", 1);
+
+  CrankMatFloatN a;
+  CrankMatFloatN b;
+  CrankMatFloatN c;
+
+  test_gen_mat_float_n (run, &a);
+  test_gen_mat_float_n (run, &b);
+
+  crank_bench_run_timer_start (run);
+
+  crank_mat_float_n_mul_parallel (&a, &b, &c, threads);
+
+  crank_bench_run_timer_add_result_elapsed (run, "time");
+
+  crank_mat_float_n_fini (&a);
+  crank_mat_float_n_fini (&b);
+  crank_mat_float_n_fini (&c);
+}
+
+static void
+bench_mat_parallel_mulv (CrankBenchRun *run)
+{
+  guint N = crank_bench_run_get_param_uint (run, "N", 4);
+  guint threads = crank_bench_run_get_param_uint (run, "threads", 1);
+
+  CrankMatFloatN a;
+  CrankVecFloatN b;
+  CrankVecFloatN c;
+
+  test_gen_mat_float_n (run, &a);
+  crank_vec_float_n_init_arr_take (&b, N,
+                                   crank_bench_run_rand_float_array (run, N));
+
+  crank_bench_run_timer_start (run);
+
+  crank_mat_float_n_mulv_parallel (&a, &b, &c, threads);
+
+  crank_bench_run_timer_add_result_elapsed (run, "time");
+
+  crank_mat_float_n_fini (&a);
+  crank_vec_float_n_fini (&b);
+  crank_vec_float_n_fini (&c);
+}
+
+static void
+bench_mat_parallel_add (CrankBenchRun *run)
+{
+  guint threads = crank_bench_run_get_param_uint (run, "threads", 1);
+
+  CrankMatFloatN a;
+  CrankMatFloatN b;
+  CrankMatFloatN c;
+
+  test_gen_mat_float_n (run, &a);
+  test_gen_mat_float_n (run, &b);
+
+  crank_bench_run_timer_start (run);
+
+  crank_mat_float_n_add_parallel (&a, &b, &c, threads);
+
+  crank_bench_run_timer_add_result_elapsed (run, "time");
+
+  crank_mat_float_n_fini (&a);
+  crank_mat_float_n_fini (&b);
+  crank_mat_float_n_fini (&c);
+}
+
+static void
+bench_mat_parallel_inv (CrankBenchRun *run)
+{
+  guint threads = crank_bench_run_get_param_uint (run, "threads", 1);
+
+  CrankMatFloatN a;
+  CrankMatFloatN b;
+
+  test_gen_mat_float_n (run, &a);
+
+  crank_bench_run_timer_start (run);
+
+  crank_mat_float_n_inverse_parallel (&a, &b, threads);
+
+  crank_bench_run_timer_add_result_elapsed (run, "time");
+
+  crank_mat_float_n_fini (&a);
+  crank_mat_float_n_fini (&b);
+}
@@ -0,0 +1,351 @@
+/* Copyright (C) 2015, WSID   */
+
+/* Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <glib.h>
+
+#include "crankbase.h"
+
+//////// Declaration ///////////////////////////////////////////////////////////
+
+static void test_gen_mat_sparse_float (CrankBenchRun       *run,
+                                       CrankMatSparseFloat *mat,
+                                       const gfloat         skew);
+
+static void test_gen_vec_float_n (CrankBenchRun  *run,
+                                  CrankVecFloatN *vec,
+                                  const guint     n);
+
+static void bench_solve (CrankBenchRun           *run,
+                         const gboolean           bicgstab,
+                         const CrankSparsePrecond precond);
+
+static void bench_mulv (CrankBenchRun *run);
+static void bench_mulv_dense (CrankBenchRun *run);
+static void bench_parallel_mulv (CrankBenchRun *run);
+
+static void bench_cg (CrankBenchRun *run);
+static void bench_cg_jacobi (CrankBenchRun *run);
+static void bench_cg_ilu0 (CrankBenchRun *run);
+static void bench_bicgstab (CrankBenchRun *run);
+static void bench_bicgstab_jacobi (CrankBenchRun *run);
+static void bench_bicgstab_ilu0 (CrankBenchRun *run);
+
+//////// Main //////////////////////////////////////////////////////////////////
+
+gint
+main (gint   argc,
+      gchar *argv[])
+{
+  CrankBenchParamNode  *params;
+  CrankBenchParamNode  *dparams;
+  CrankBenchParamNode  *pparams;
+  CrankBenchParamNode **vparams;
+
+  crank_bench_init (&argc, &argv);
+
+
+  // Fill parameters: N is side length of grid, so matrix has N * N rows.
+  params = crank_bench_param_node_new ();
+
+  crank_bench_param_node_set_uint (params, "repeat", 8);
+  crank_bench_param_node_set_uint (params, "N", 32);
+
+  vparams = crank_bench_param_node_add_placeholders (params, 3);
+  crank_bench_param_node_set_uint (vparams[0], "N", 64);
+  crank_bench_param_node_set_uint (vparams[1], "N", 128);
+
+  crank_bench_param_node_set_uint (vparams[2], "repeat", 2);
+  crank_bench_param_node_set_uint (vparams[2], "N", 256);
+
+  // Dense matrix takes N^4 elements, so keeps it small.
+  dparams = crank_bench_param_node_new ();
+
+  crank_bench_param_node_set_uint (dparams, "repeat", 8);
+  crank_bench_param_node_set_uint (dparams, "N", 16);
+
+  vparams = crank_bench_param_node_add_placeholders (dparams, 2);
+  crank_bench_param_node_set_uint (vparams[0], "N", 32);
+  crank_bench_param_node_set_uint (vparams[1], "N", 48);
+
+  // Parameters for parallel operations: vary number of threads.
+  pparams = crank_bench_param_node_new ();
+
+  crank_bench_param_node_set_uint (pparams, "repeat", 4);
+  crank_bench_param_node_set_uint (pparams, "N", 512);
+  crank_bench_param_node_set_uint (pparams, "threads", 1);
+
+  vparams = crank_bench_param_node_add_placeholders (pparams, 5);
+  crank_bench_param_node_set_uint (vparams[0], "threads", 2);
+  crank_bench_param_node_set_uint (vparams[1], "threads", 4);
+  crank_bench_param_node_set_uint (vparams[2], "threads", 8);
+  crank_bench_param_node_set_uint (vparams[3], "threads", 16);
+  crank_bench_param_node_set_uint (vparams[4], "threads", 32);
+
+
+  crank_bench_add ("/crank/base/mat/sparse/float/bench/mulv",
+                   (CrankBenchFunc)bench_mulv, NULL, NULL);
+  crank_bench_add ("/crank/base/mat/sparse/float/bench/dense/mulv",
+                   (CrankBenchFunc)bench_mulv_dense, NULL, NULL);
+  crank_bench_add ("/crank/base/mat/sparse/float/bench/parallel/mulv",
+                   (CrankBenchFunc)bench_parallel_mulv, NULL, NULL);
+
+  crank_bench_add ("/crank/base/mat/sparse/float/bench/cg/none",
+                   (CrankBenchFunc)bench_cg, NULL, NULL);
+  crank_bench_add ("/crank/base/mat/sparse/float/bench/cg/jacobi",
+                   (CrankBenchFunc)bench_cg_jacobi, NULL, NULL);
+  crank_bench_add ("/crank/base/mat/sparse/float/bench/cg/ilu0",
+                   (CrankBenchFunc)bench_cg_ilu0, NULL, NULL);
+  crank_bench_add ("/crank/base/mat/sparse/float/bench/bicgstab/none",
+                   (CrankBenchFunc)bench_bicgstab, NULL, NULL);
+  crank_bench_add ("/crank/base/mat/sparse/float/bench/bicgstab/jacobi",
+                   (CrankBenchFunc)bench_bicgstab_jacobi, NULL, NULL);
+  crank_bench_add ("/crank/base/mat/sparse/float/bench/bicgstab/ilu0",
+                   (CrankBenchFunc)bench_bicgstab_ilu0, NULL, NULL);
+
+  crank_bench_set_param ("/", params);
+  crank_bench_set_param ("/crank/base/mat/sparse/float/bench/dense", dparams);
+  crank_bench_set_param ("/crank/base/mat/sparse/float/bench/parallel",
+                         pparams);
+
+  return crank_bench_run ();
+}
+
+
+//////// Definition ////////////////////////////////////////////////////////////
+
+/*
+ * Generates 5-point laplacian on N x N grid, with random perturbation on
+ * diagonal. Skew adds convection term, which makes it non-symmetric.
+ */
+static void
+test_gen_mat_sparse_float (CrankBenchRun       *run,
+                           CrankMatSparseFloat *mat,
+                           const gfloat         skew)
+{
+  guint g = crank_bench_run_get_param_uint (run, "N", 4);
+  guint n = g * g;
+  guint *rows = g_new (guint, 5 * n);
+  guint *cols = g_new (guint, 5 * n);
+  gfloat *values = g_new (gfloat, 5 * n);
+  guint c = 0;
+  guint x;
+  guint y;
+
+  for (y = 0; y < g; y++)
+    {
+      for (x = 0; x < g; x++)
+        {
+          guint i = y * g + x;
+
+          rows[c] = i;
+          cols[c] = i;
+          values[c] = 4.0f + crank_bench_run_rand_float (run);
+          c++;
+
+          if (0 < y)
+            {
+              rows[c] = i;
+              cols[c] = i - g;
+              values[c] = -1.0f;
+              c++;
+            }
+
+          if (0 < x)
+            {
+              rows[c] = i;
+              cols[c] = i - 1;
+              values[c] = -1.0f - skew;
+              c++;
+            }
+
+          if (x + 1 < g)
+            {
+              rows[c] = i;
+              cols[c] = i + 1;
+              values[c] = -1.0f + skew;
+              c++;
+            }
+
+          if (y + 1 < g)
+            {
+              rows[c] = i;
+              cols[c] = i + g;
+              values[c] = -1.0f;
+              c++;
+            }
+        }
+    }
+
+  crank_mat_sparse_float_init_triplets (mat, n, n, c, rows, cols, values);
+
+  g_free (rows);
+  g_free (cols);
+  g_free (values);
+}
+
+static void
+test_gen_vec_float_n (CrankBenchRun  *run,
+                      CrankVecFloatN *vec,
+                      const guint     n)
+{
+  crank_vec_float_n_init_arr_take (vec, n,
+                                   crank_bench_run_rand_float_array (run, n));
+}
+
+static void
+bench_solve (CrankBenchRun           *run,
+             const gboolean           bicgstab,
+             const CrankSparsePrecond precond)
+{
+  CrankMatSparseFloat a;
+  CrankVecFloatN b;
+  CrankVecFloatN x;
+  guint iterations;
+  gboolean converged;
+
+  test_gen_mat_sparse_float (run, &a, bicgstab ? 0.5f : 0.0f);
+  test_gen_vec_float_n (run, &b, a.rn);
+
+  crank_bench_run_timer_start (run);
+
+  if (bicgstab)
+    converged = crank_mat_sparse_float_solve_bicgstab (&a, &b, &x, precond,
+                                                       1e-5f, 10000,
+                                                       &iterations);
+  else
+    converged = crank_mat_sparse_float_solve_cg (&a, &b, &x, precond,
+                                                 1e-5f, 10000, &iterations);
+
+  crank_bench_run_timer_add_result_elapsed (run, "time");
+  crank_bench_run_add_result_uint (run, "iterations", iterations);
+
+  if (! converged)
+    crank_bench_run_fail (run, "Solver did not converge.");
+
+  crank_mat_sparse_float_fini (&a);
+  crank_vec_float_n_fini (&b);
+  crank_vec_float_n_fini (&x);
+}
+
+
+static void
+bench_mulv (CrankBenchRun *run)
+{
+  CrankMatSparseFloat a;
+  CrankVecFloatN b;
+  CrankVecFloatN c;
+
+  test_gen_mat_sparse_float (run, &a, 0.0f);
+  test_gen_vec_float_n (run, &b, a.cn);
+
+  crank_bench_run_timer_start (run);
+
+  crank_mat_sparse_float_mulv (&a, &b, &c);
+
+  crank_bench_run_timer_add_result_elapsed (run, "time");
+
+  crank_mat_sparse_float_fini (&a);
+  crank_vec_float_n_fini (&b);
+  crank_vec_float_n_fini (&c);
+}
+
+static void
+bench_mulv_dense (CrankBenchRun *run)
+{
+  CrankMatSparseFloat a;
+  CrankMatFloatN d;
+  CrankVecFloatN b;
+  CrankVecFloatN c;
+
+  test_gen_mat_sparse_float (run, &a, 0.0f);
+  test_gen_vec_float_n (run, &b, a.cn);
+  crank_mat_sparse_float_to_dense (&a, &d);
+
+  crank_bench_run_timer_start (run);
+
+  crank_mat_float_n_mulv (&d, &b, &c);
+
+  crank_bench_run_timer_add_result_elapsed (run, "time");
+
+  crank_mat_sparse_float_fini (&a);
+  crank_mat_float_n_fini (&d);
+  crank_vec_float_n_fini (&b);
+  crank_vec_float_n_fini (&c);
+}
+
+static void
+bench_parallel_mulv (CrankBenchRun *run)
+{
+  guint threads = crank_bench_run_get_param_uint (run, "threads", 1);
+
+  CrankMatSparseFloat a;
+  CrankVecFloatN b;
+  CrankVecFloatN c;
+
+  test_gen_mat_sparse_float (run, &a, 0.0f);
+  test_gen_vec_float_n (run, &b, a.cn);
+
+  crank_bench_run_timer_start (run);
+
+  crank_mat_sparse_float_mulv_parallel (&a, &b, &c, threads);
+
+  crank_bench_run_timer_add_result_elapsed (run, "time");
+
+  crank_mat_sparse_float_fini (&a);
+  crank_vec_float_n_fini (&b);
+  crank_vec_float_n_fini (&c);
+}
+
+static void
+bench_cg (CrankBenchRun *run)
+{
+  bench_solve (run, FALSE, CRANK_SPARSE_PRECOND_NONE);
+}
+
+static void
+bench_cg_jacobi (CrankBenchRun *run)
+{
+  bench_solve (run, FALSE, CRANK_SPARSE_PRECOND_JACOBI);
+}
+
+static void
+bench_cg_ilu0 (CrankBenchRun *run)
+{
+  bench_solve (run, FALSE, CRANK_SPARSE_PRECOND_ILU0);
+}
+
+static void
+bench_bicgstab (CrankBenchRun *run)
+{
+  bench_solve (run, TRUE, CRANK_SPARSE_PRECOND_NONE);
+}
+
+static void
+bench_bicgstab_jacobi (CrankBenchRun *run)
+{
+  bench_solve (run, TRUE, CRANK_SPARSE_PRECOND_JACOBI);
+}
+
+static void
+bench_bicgstab_ilu0 (CrankBenchRun *run)
+{
+  bench_solve (run, TRUE, CRANK_SPARSE_PRECOND_ILU0);
+}
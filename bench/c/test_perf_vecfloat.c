@@ -0,0 +1,162 @@
+/* Copyright (C) 2015, WSID   */
+
+/* Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <glib.h>
+
+#include "crankbase.h"
+
+//////// Declaration ///////////////////////////////////////////////////////////
+
+static void test_gen_vec_float_n (CrankBenchRun  *run,
+                                  CrankVecFloatN *vec);
+
+static void bench_add (CrankBenchRun *run);
+static void bench_muls (CrankBenchRun *run);
+static void bench_mixs (CrankBenchRun *run);
+static void bench_dot (CrankBenchRun *run);
+
+//////// Main //////////////////////////////////////////////////////////////////
+
+gint
+main (gint   argc,
+      gchar *argv[])
+{
+  CrankBenchParamNode  *params;
+  CrankBenchParamNode **vparams;
+
+  crank_bench_init (&argc, &argv);
+
+  // Kernels can be compared by running with CRANK_SIMD=none, sse2, avx2, ...
+  params = crank_bench_param_node_new ();
+
+  crank_bench_param_node_set_uint (params, "repeat", 16);
+  crank_bench_param_node_set_uint (params, "N", 1000);
+
+  vparams = crank_bench_param_node_add_placeholders (params, 3);
+  crank_bench_param_node_set_uint (vparams[0], "N", 10000);
+  crank_bench_param_node_set_uint (vparams[1], "N", 100000);
+  crank_bench_param_node_set_uint (vparams[2], "N", 1000000);
+
+  crank_bench_add ("/crank/base/vec/float/n/bench/add",
+                   (CrankBenchFunc)bench_add, NULL, NULL);
+  crank_bench_add ("/crank/base/vec/float/n/bench/muls",
+                   (CrankBenchFunc)bench_muls, NULL, NULL);
+  crank_bench_add ("/crank/base/vec/float/n/bench/mixs",
+                   (CrankBenchFunc)bench_mixs, NULL, NULL);
+  crank_bench_add ("/crank/base/vec/float/n/bench/dot",
+                   (CrankBenchFunc)bench_dot, NULL, NULL);
+
+  crank_bench_set_param ("/", params);
+
+  return crank_bench_run ();
+}
+
+
+//////// Definition ////////////////////////////////////////////////////////////
+
+static void
+test_gen_vec_float_n (CrankBenchRun  *run,
+                      CrankVecFloatN *vec)
+{
+  guint n = crank_bench_run_get_param_uint (run, "N", 1000);
+  gfloat *data = crank_bench_run_rand_float_array (run, n);
+
+  // Copies data, so that vector data is aligned.
+  crank_vec_float_n_init_arr (vec, n, data);
+  g_free (data);
+}
+
+static void
+bench_add (CrankBenchRun *run)
+{
+  CrankVecFloatN a;
+  CrankVecFloatN b;
+  CrankVecFloatN r;
+
+  test_gen_vec_float_n (run, &a);
+  test_gen_vec_float_n (run, &b);
+
+  crank_bench_run_timer_start (run);
+
+  crank_vec_float_n_add (&a, &b, &r);
+
+  crank_bench_run_timer_add_result_elapsed (run, "time");
+
+  crank_vec_float_n_fini (&a);
+  crank_vec_float_n_fini (&b);
+  crank_vec_float_n_fini (&r);
+}
+
+static void
+bench_muls (CrankBenchRun *run)
+{
+  CrankVecFloatN a;
+
+  test_gen_vec_float_n (run, &a);
+
+  crank_bench_run_timer_start (run);
+
+  crank_vec_float_n_muls_self (&a, 1.5f);
+
+  crank_bench_run_timer_add_result_elapsed (run, "time");
+
+  crank_vec_float_n_fini (&a);
+}
+
+static void
+bench_mixs (CrankBenchRun *run)
+{
+  CrankVecFloatN a;
+  CrankVecFloatN b;
+  CrankVecFloatN r;
+
+  test_gen_vec_float_n (run, &a);
+  test_gen_vec_float_n (run, &b);
+
+  crank_bench_run_timer_start (run);
+
+  crank_vec_float_n_mixs (&a, &b, 0.3f, &r);
+
+  crank_bench_run_timer_add_result_elapsed (run, "time");
+
+  crank_vec_float_n_fini (&a);
+  crank_vec_float_n_fini (&b);
+  crank_vec_float_n_fini (&r);
+}
+
+static void
+bench_dot (CrankBenchRun *run)
+{
+  CrankVecFloatN a;
+  CrankVecFloatN b;
+
+  test_gen_vec_float_n (run, &a);
+  test_gen_vec_float_n (run, &b);
+
+  crank_bench_run_timer_start (run);
+
+  crank_vec_float_n_dot (&a, &b);
+
+  crank_bench_run_timer_add_result_elapsed (run, "time");
+
+  crank_vec_float_n_fini (&a);
+  crank_vec_float_n_fini (&b);
+}
@@ -26,7 +26,9 @@
 #define _CRANKBASE_INSIDE
 
 #include "crankbasemacro.h"
+#include "crankindexheap.h"
 #include "crankdigraph.h"
+#include "crankdigraph-private.h"
 #include "crankadvgraph.h"
 
 /**
@@ -45,118 +47,135 @@
  * # Operations result in tree of Nodes
  * * Minimum distance path
  *   * Dijkstra full
+ *
+ * # Implementation
+ *
+ * Searches keep costs and predecessors in arrays indexed by index of nodes in
+ * graph. Open nodes are kept in
+ * #CrankIndexHeap, so picking next node takes O(log n) and lowering cost of an
+ * open node does not push duplicated entry.
  */
 
+//////// Private Search State ////////////////////////////////////////////////
+
+#define CRANK_ADVGRAPH_NONE G_MAXUINT
+
+typedef struct _CrankAdvgraphSearch {
+  guint              capacity;
+  CrankDigraphNode **nodes;   // By node index, NULL for undiscovered.
+  gfloat            *dist;    // By node index.
+  guint             *prev;    // By node index.
+  gboolean          *closed;  // By node index.
+  GArray            *order;   // Array<guint>, in order of closing.
+
+  CrankIndexHeap     open;
+} CrankAdvgraphSearch;
+
 static void
-crank_advgraph_free_float (gpointer f)
+crank_advgraph_search_init (CrankAdvgraphSearch *search)
 {
-  g_slice_free (gfloat, f);
+  search->capacity = 0;
+  search->nodes = NULL;
+  search->dist = NULL;
+  search->prev = NULL;
+  search->closed = NULL;
+  search->order = g_array_new (FALSE, FALSE, sizeof (guint));
+
+  crank_index_heap_init (&search->open, 64);
 }
 
 static void
-crank_advgraph_set_float (GHashTable *table,
-                          gpointer    key,
-                          gfloat      value)
+crank_advgraph_search_fini (CrankAdvgraphSearch *search)
 {
-  gfloat *ptr = g_slice_new (gfloat);
-
-  *ptr = value;
+  g_free (search->nodes);
+  g_free (search->dist);
+  g_free (search->prev);
+  g_free (search->closed);
+  g_array_unref (search->order);
 
-  g_hash_table_insert (table, key, ptr);
+  crank_index_heap_fini (&search->open);
 }
 
-static gfloat
-crank_advgraph_get_float (GHashTable  *table,
-                          gpointer     key,
-                          const gfloat def)
-{
-  gfloat *ptr = (gfloat*) g_hash_table_lookup (table, key);
-  return (ptr == NULL) ? def : *ptr;
-}
-
-static gpointer
-crank_advgraph_table_min (GHashTable *set,
-                          GHashTable *table,
-                          gfloat     *value)
+/*
+ * Gets index of node, and makes arrays cover it. Arrays are grown
+ * geometrically, so that this mostly costs a comparison.
+ */
+static inline guint
+crank_advgraph_search_index (CrankAdvgraphSearch *search,
+                             CrankDigraphNode    *node)
 {
-  GHashTableIter iter;
-  gpointer result;
-  gpointer result_candidate = NULL;
-  gfloat mvalue = INFINITY;
+  guint index = _crank_digraph_node_get_index (node);
 
-  g_hash_table_iter_init (&iter, set);
-
-  while (g_hash_table_iter_next (&iter, &result_candidate, NULL))
+  if (search->capacity <= index)
     {
-      gfloat mvalue_candidate =
-          crank_advgraph_get_float (table, result_candidate, INFINITY);
+      guint ncapacity = MAX (index + 1, search->capacity * 2);
+      guint i;
 
-      if (mvalue_candidate < mvalue)
+      search->nodes = g_renew (CrankDigraphNode*, search->nodes, ncapacity);
+      search->dist = g_renew (gfloat, search->dist, ncapacity);
+      search->prev = g_renew (guint, search->prev, ncapacity);
+      search->closed = g_renew (gboolean, search->closed, ncapacity);
+
+      for (i = search->capacity; i < ncapacity; i++)
         {
-          mvalue = mvalue_candidate;
-          result = result_candidate;
+          search->nodes[i] = NULL;
+          search->dist[i] = INFINITY;
+          search->prev[i] = CRANK_ADVGRAPH_NONE;
+          search->closed[i] = FALSE;
         }
+
+      search->capacity = ncapacity;
+      crank_index_heap_reserve (&search->open, ncapacity);
     }
 
-  if (value != NULL) *value = mvalue;
-  return result;
+  search->nodes[index] = node;
+
+  return index;
 }
 
-/**
- * crank_dijkstra_digraph:
- * @from: starting node
- * @to: destination node
- * @edge_func: (scope call): cost function for each edge.
- * @userdata: (closure): user data
- *
- * Gets minimum path from @from node to @to node.
+/*
+ * Runs Dijkstra's algorithm, or A* if heuristic_func is not NULL. Search stops
+ * when to is closed, or runs over all reachable nodes if to is NULL.
  *
- * Negative value returned from @edge_func will leads to incorrect behavior.
- *
- * If @from is not connected to @to, then result will be %NULL
- *
- * Returns: (nullable) (transfer container) (element-type CrankDigraphNode*):
- *    The path as list of #CrankDigraphNode
+ * Returns index of to, or CRANK_ADVGRAPH_NONE if it is not reached.
  */
-GList*
-crank_dijkstra_digraph (CrankDigraphNode         *from,
-                        CrankDigraphNode         *to,
-                        CrankDigraphEdgeFloatFunc edge_func,
-                        gpointer                  userdata)
+static guint
+crank_advgraph_search_run (CrankAdvgraphSearch       *search,
+                           CrankDigraphNode          *from,
+                           CrankDigraphNode          *to,
+                           CrankDigraphEdgeFloatFunc  edge_func,
+                           gpointer                   edge_userdata,
+                           CrankDigraphHeuristicFunc  heuristic_func,
+                           gpointer                   heuristic_userdata)
 {
-  GList *result = NULL; // List<CrankDigraphNode>
-  CrankDigraphNode *result_node;
-
-  GHashTable *dist;     // HashTable<CrankDigraphNode,gfloat>
-  GHashTable *visited;  // Set<CrankDigraphNode>
-  GHashTable *visiting; // Set<CrankDigarphNode>
-  GHashTable *prev;     // HashTable<CrankDigraphNode, CrankDigraphNode>                        //
-
+  guint from_index;
   guint i;
 
-  // Initializing
-  dist        = g_hash_table_new_full (g_direct_hash,
-                                       g_direct_equal,
-                                       NULL,
-                                       crank_advgraph_free_float);
-  visited     = g_hash_table_new (g_direct_hash, g_direct_equal);
-  visiting    = g_hash_table_new (g_direct_hash, g_direct_equal);
-  prev        = g_hash_table_new (g_direct_hash, g_direct_equal);
+  from_index = crank_advgraph_search_index (search, from);
+  search->dist[from_index] = 0.0f;
 
-  g_hash_table_add (visiting, from);
-  crank_advgraph_set_float (dist, from, 0.0f);
+  crank_index_heap_push (&search->open, from_index,
+                         (heuristic_func != NULL) ?
+                         heuristic_func (from, to, heuristic_userdata) : 0.0f);
 
-  // Looping.
-  while (g_hash_table_size (visiting) != 0)
+  while (! crank_index_heap_is_empty (&search->open))
     {
+      guint index;
       CrankDigraphNode *node;
       gfloat cost;
-      GPtrArray* out_edges;
+      GPtrArray *out_edges;
 
       // Pick one of node.
-      node = (CrankDigraphNode*) crank_advgraph_table_min (visiting, dist, &cost);
-      g_hash_table_remove (visiting, node);
-      g_hash_table_add (visited, node);
+      index = crank_index_heap_pop (&search->open, NULL);
+      node = search->nodes[index];
+      cost = search->dist[index];
+
+      search->closed[index] = TRUE;
+      g_array_append_val (search->order, index);
+
+      // If we found the way to @to, then stop loop.
+      if (node == to)
+        return index;
 
       // Process picked node
       out_edges = crank_digraph_node_get_out_edges (node);
@@ -164,46 +183,85 @@ crank_dijkstra_digraph (CrankDigraphNode         *from,
         {
           CrankDigraphEdge *edge = (CrankDigraphEdge*) out_edges->pdata[i];
           CrankDigraphNode *next_node = crank_digraph_edge_get_head (edge);
+          guint next_index = crank_advgraph_search_index (search, next_node);
+          gfloat next_cost_new;
+
+          if (search->closed[next_index])
+            continue;
 
-          gfloat edge_cost = edge_func (edge, userdata);
-          gfloat next_cost = crank_advgraph_get_float (dist,
-                                                       next_node,
-                                                       INFINITY);
-          gfloat next_cost_new = cost + edge_cost;
+          next_cost_new = cost + edge_func (edge, edge_userdata);
 
-          if (next_cost_new < next_cost)
+          if (next_cost_new < search->dist[next_index])
             {
-              g_hash_table_insert (prev, next_node, node);
-              crank_advgraph_set_float (dist, next_node, next_cost_new);
+              gfloat priority = next_cost_new;
 
-              if (!g_hash_table_contains (visited, next_node))
-                g_hash_table_add (visiting, next_node);
+              if (heuristic_func != NULL)
+                priority += heuristic_func (next_node, to, heuristic_userdata);
+
+              search->dist[next_index] = next_cost_new;
+              search->prev[next_index] = index;
+
+              crank_index_heap_update (&search->open, next_index, priority);
             }
         }
-
-      // If we found the way to @to, then stop loop.
-      if (node == to)
-        break;
     }
 
-  // Build up path.
-  result_node = to;
-  while (result_node != NULL)
-    {
-      result = g_list_prepend (result, result_node);
-      result_node = g_hash_table_lookup (prev, result_node);
-    }
+  return CRANK_ADVGRAPH_NONE;
+}
 
-  if (result->data != from)
+static GList*
+crank_advgraph_search_path (CrankAdvgraphSearch *search,
+                            guint                index)
+{
+  GList *result = NULL; // List<CrankDigraphNode>
+
+  while (index != CRANK_ADVGRAPH_NONE)
     {
-      g_list_free (result);
-      result = NULL;
+      result = g_list_prepend (result, search->nodes[index]);
+      index = search->prev[index];
     }
 
-  g_hash_table_unref (dist);
-  g_hash_table_unref (visited);
-  g_hash_table_unref (visiting);
-  g_hash_table_unref (prev);
+  return result;
+}
+
+
+//////// Public functions //////////////////////////////////////////////////////
+
+/**
+ * crank_dijkstra_digraph:
+ * @from: starting node
+ * @to: destination node
+ * @edge_func: (scope call): cost function for each edge.
+ * @userdata: (closure): user data
+ *
+ * Gets minimum path from @from node to @to node.
+ *
+ * Negative value returned from @edge_func will leads to incorrect behavior.
+ *
+ * If @from is not connected to @to, then result will be %NULL
+ *
+ * Returns: (nullable) (transfer container) (element-type CrankDigraphNode*):
+ *    The path as list of #CrankDigraphNode
+ */
+GList*
+crank_dijkstra_digraph (CrankDigraphNode         *from,
+                        CrankDigraphNode         *to,
+                        CrankDigraphEdgeFloatFunc edge_func,
+                        gpointer                  userdata)
+{
+  CrankAdvgraphSearch search;
+  GList *result;
+  guint to_index;
+
+  crank_advgraph_search_init (&search);
+
+  to_index = crank_advgraph_search_run (&search, from, to,
+                                        edge_func, userdata,
+                                        NULL, NULL);
+
+  result = crank_advgraph_search_path (&search, to_index);
+
+  crank_advgraph_search_fini (&search);
 
   return result;
 }
@@ -236,99 +294,19 @@ crank_astar_digraph (CrankDigraphNode         *from,
                      CrankDigraphHeuristicFunc heuristic_func,
                      gpointer                  heuristic_userdata)
 {
-  GList *result = NULL;
-  CrankDigraphNode *result_node;
-
-  GHashTable *dist_from; // HashTable <CrankDigraphNode,gfloat>
-  GHashTable *dist_to;   // HashTable <CrankDigraphNode,gfloat>
-  GHashTable *visited;   // Set <CrankDigarphNode>
-  GHashTable *visiting;  // Set <CrankDigraphNode>
-  GHashTable *prev;      // HashTable <CrankDigraphNode,CrankDigraphNode>
-
-  // Initializing
-  dist_from   = g_hash_table_new_full (g_direct_hash,
-                                       g_direct_equal,
-                                       NULL,
-                                       crank_advgraph_free_float);
-  dist_to     = g_hash_table_new_full (g_direct_hash,
-                                       g_direct_equal,
-                                       NULL,
-                                       crank_advgraph_free_float);
-  visited     = g_hash_table_new (g_direct_hash, g_direct_equal);
-  visiting    = g_hash_table_new (g_direct_hash, g_direct_equal);
-  prev        = g_hash_table_new (g_direct_hash, g_direct_equal);
-
-  g_hash_table_add (visiting, from);
-  crank_advgraph_set_float (dist_from, from, 0.0f);
-  crank_advgraph_set_float (dist_to, from,
-                            heuristic_func (from, to, heuristic_userdata));
-
-  // Looping.
-  while (g_hash_table_size (visiting) != 0)
-    {
-      gfloat cost;
-      CrankDigraphNode *node = NULL;
-
-      GPtrArray *out_edges;
-      guint i;
+  CrankAdvgraphSearch search;
+  GList *result;
+  guint to_index;
 
+  crank_advgraph_search_init (&search);
 
-      // Pick next node to check.
-      node = (CrankDigraphNode*) crank_advgraph_table_min (visiting, dist_to, &cost);
-      g_hash_table_remove (visiting, node);
-      g_hash_table_add (visited, node);
+  to_index = crank_advgraph_search_run (&search, from, to,
+                                        edge_func, edge_userdata,
+                                        heuristic_func, heuristic_userdata);
 
-      // Process node
+  result = crank_advgraph_search_path (&search, to_index);
 
-      out_edges = crank_digraph_node_get_out_edges (node);
-      for (i = 0; i < out_edges->len; i++)
-        {
-          CrankDigraphEdge *edge = (CrankDigraphEdge*) out_edges->pdata[i];
-          CrankDigraphNode *next_node = crank_digraph_edge_get_head (edge);
-          gfloat edge_cost = edge_func (edge, edge_userdata);
-          gfloat next_cost = crank_advgraph_get_float (dist_from,
-                                                       next_node,
-                                                       INFINITY);
-          gfloat next_cost_new = cost + edge_cost;
-
-          if (next_cost_new < next_cost)
-            {
-              g_hash_table_insert (prev, next_node, node);
-              crank_advgraph_set_float (dist_from, next_node, next_cost_new);
-              crank_advgraph_set_float (dist_to, next_node,
-                                        next_cost_new +
-                                        heuristic_func (next_node, to,
-                                                        heuristic_userdata) );
-
-              if (!g_hash_table_contains (visited, next_node))
-                g_hash_table_add (visiting, next_node);
-            }
-        }
-
-      // If we found the way to @to, then stop loop.
-      if (node == to)
-        break;
-    }
-
-  // Build up path.
-  result_node = to;
-  while (result_node != NULL)
-    {
-      result = g_list_prepend (result, result_node);
-      result_node = g_hash_table_lookup (prev, result_node);
-    }
-
-  if (result->data != from)
-    {
-      g_list_free (result);
-      result = NULL;
-    }
-
-  g_hash_table_unref (dist_from);
-  g_hash_table_unref (dist_to);
-  g_hash_table_unref (visited);
-  g_hash_table_unref (visiting);
-  g_hash_table_unref (prev);
+  crank_advgraph_search_fini (&search);
 
   return result;
 }
@@ -354,75 +332,36 @@ crank_dijkstra_full_digraph (CrankDigraphNode         *from,
                              CrankDigraphEdgeFloatFunc edge_func,
                              gpointer                  userdata)
 {
-  GNode *result = NULL;
-
-  GHashTable *dist;     // HashTable <CrankDigraphNode,gfloat>
-  GHashTable *visited;  // Set <CrankDigraphNode>
-  GHashTable *visiting; // Set <CrankDigraphNode>
-  GHashTable *treenode; // HashTable <CrankDigraphNode,GNode<CrankDigraphNode>>
-
-  // Initializing
-  dist        = g_hash_table_new_full (g_direct_hash,
-                                       g_direct_equal,
-                                       NULL,
-                                       crank_advgraph_free_float);
-  visited     = g_hash_table_new (g_direct_hash, g_direct_equal);
-  visiting    = g_hash_table_new (g_direct_hash, g_direct_equal);
-  treenode    = g_hash_table_new (g_direct_hash, g_direct_equal);
-
-  g_hash_table_add (visiting, from);
-  g_hash_table_insert (visiting, from, g_node_new (from));
-  crank_advgraph_set_float (dist, from, 0.0f);
-
-  // Looping.
-  while (g_hash_table_size (visiting) != 0)
-    {
-      GHashTableIter visiting_iter;
-
-      gfloat cost = INFINITY;
-      CrankDigraphNode *node;
-
-      GPtrArray *out_edges;
-      guint i;
-
-
-      // Pick next node to check.
-      node = (CrankDigraphNode*) crank_advgraph_table_min (visiting, dist, &cost);
-      g_hash_table_remove (visiting, node);
-      g_hash_table_add (visited, node);
+  CrankAdvgraphSearch search;
+  GNode *result;
+  GNode **gnodes;
+  guint i;
 
-      // Process node
-      out_edges = crank_digraph_node_get_out_edges (node);
+  crank_advgraph_search_init (&search);
 
-      for (i = 0; i < out_edges->len; i++)
-        {
-          CrankDigraphEdge *edge = out_edges->pdata[i];
-          CrankDigraphNode *next_node = crank_digraph_edge_get_head (edge);
-          gfloat edge_cost = edge_func (edge, userdata);
-          gfloat next_cost = crank_advgraph_get_float (dist, next_node, INFINITY);
-          gfloat next_cost_new = cost + edge_cost;
+  crank_advgraph_search_run (&search, from, NULL,
+                             edge_func, userdata,
+                             NULL, NULL);
 
-          if (next_cost_new < next_cost)
-            {
-              GNode *gnode = g_hash_table_lookup (treenode, node);
-              GNode *next_gnode = g_hash_table_lookup (treenode, next_node);
+  // Nodes are closed after their predecessors, so parents are always built
+  // before their children.
+  gnodes = g_new (GNode*, search.capacity);
 
-              g_node_unlink (next_gnode);
-              g_node_append (gnode, next_gnode);
+  for (i = 0; i < search.order->len; i++)
+    {
+      guint index = g_array_index (search.order, guint, i);
+      guint prev = search.prev[index];
 
-              g_hash_table_insert (treenode, next_node, next_gnode);
-              crank_advgraph_set_float (dist, next_node, next_cost_new);
+      gnodes[index] = g_node_new (search.nodes[index]);
 
-              if (!g_hash_table_contains (visited, next_node))
-                g_hash_table_add (visiting, next_node);
-            }
-        }
+      if (prev != CRANK_ADVGRAPH_NONE)
+        g_node_append (gnodes[prev], gnodes[index]);
     }
 
-  g_hash_table_unref (dist);
-  g_hash_table_unref (visited);
-  g_hash_table_unref (visiting);
-  g_hash_table_unref (treenode);
+  result = gnodes[g_array_index (search.order, guint, 0)];
+
+  g_free (gnodes);
+  crank_advgraph_search_fini (&search);
 
   return result;
 }
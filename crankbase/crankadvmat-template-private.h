@@ -0,0 +1,2654 @@
+/* Copyright (C) 2015, WSID   */
+
+/* Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/* This is template for advanced operations on variable sized matrices, and is
+ * included by crankadvmat.c for each precision. */
+
+#ifndef _CRANKBASE_INSIDE
+#error crankadvmat-template-private.h cannot be included directly.
+#endif
+
+#ifndef CRANK_ADVMAT_T
+#error CRANK_ADVMAT_T should be defined before including template.
+#endif
+
+#ifndef __GTK_DOC_IGNORE__
+
+/*
+ * Parameters of template.
+ *
+ * CRANK_ADVMAT_T: Element type. (gfloat, gdouble)
+ * CRANK_ADVMAT_MAT_TYPE, CRANK_ADVMAT_MAT_FUNC(name): Variable sized matrix,
+ *     and its functions.
+ * CRANK_ADVMAT_VEC_TYPE, CRANK_ADVMAT_VEC_FUNC(name): Variable sized vector,
+ *     and its functions.
+ * CRANK_ADVMAT_VEC2_TYPE, CRANK_ADVMAT_VEC2_FUNC(name): 2 sized vector, and
+ *     its functions.
+ * CRANK_ADVMAT_LU_TYPE, CRANK_ADVMAT_LU_FUNC(name): LU factorization, and its
+ *     functions.
+ * CRANK_ADVMAT_QR_TYPE, CRANK_ADVMAT_QR_FUNC(name): QR factorization, and its
+ *     functions.
+ * CRANK_ADVMAT_OP(op): Makes name of operation. (crank_lu_mat_float_n)
+ * CRANK_ADVMAT_OP_SELF(op): Makes name of in place operation on matrix.
+ * CRANK_ADVMAT_PRIV(name): Makes name of private function.
+ * CRANK_ADVMAT_NAME, CRANK_ADVMAT_LU_NAME: Names of types, in warnings.
+ * CRANK_ADVMAT_MAT_NAME: Name of matrix type, to be appended in warnings.
+ * CRANK_ADVMAT_MATH(func): Appends type suffix to math function. (sqrtf, sqrt)
+ * CRANK_ADVMAT_LIT(x): Makes literal of element type.
+ * CRANK_ADVMAT_EPSILON: Machine epsilon of element type.
+ * CRANK_ADVMAT_GEMM: Blocked multiplication.
+ *
+ * Optional parameters.
+ *
+ * CRANK_ADVMAT_FIXED_HAS_SIZE(n), CRANK_ADVMAT_FIXED_FUNC(name): Fixed size
+ *     kernels, which small square matrices use.
+ */
+
+#define T             CRANK_ADVMAT_T
+#define M             CRANK_ADVMAT_MAT_TYPE
+#define V             CRANK_ADVMAT_VEC_TYPE
+#define V2            CRANK_ADVMAT_VEC2_TYPE
+#define LU            CRANK_ADVMAT_LU_TYPE
+#define QR            CRANK_ADVMAT_QR_TYPE
+#define FM(name)      CRANK_ADVMAT_MAT_FUNC(name)
+#define FV(name)      CRANK_ADVMAT_VEC_FUNC(name)
+#define FV2(name)     CRANK_ADVMAT_VEC2_FUNC(name)
+#define FLU(name)     CRANK_ADVMAT_LU_FUNC(name)
+#define FQR(name)     CRANK_ADVMAT_QR_FUNC(name)
+#define FA(name)      CRANK_ADVMAT_PRIV(name)
+#define OP(op)        CRANK_ADVMAT_OP(op)
+#define OP_SELF(op)   CRANK_ADVMAT_OP_SELF(op)
+#define MATH(func)    CRANK_ADVMAT_MATH(func)
+
+//////// Private Functions /////////////////////////////////////////////////////
+
+static gboolean FA(lu) (M                *a,
+                        CrankPermutation *p);
+
+static void FA(syrk_lower) (M           *a,
+                            const guint  k0,
+                            const guint  k1,
+                            const T     *d,
+                            T           *bufa,
+                            T           *bufb);
+
+static void FA(tred) (const guint  n,
+                      T           *vt,
+                      T           *d,
+                      T           *e);
+
+static gboolean FA(tql) (const guint     n,
+                         T              *vt,
+                         T              *d,
+                         T              *e,
+                         const gboolean  vectors,
+                         const guint     max_iter,
+                         const T         tol);
+
+static void FA(sort_eigen) (const guint  n,
+                            T           *vt,
+                            T           *d);
+
+static void FA(sort_svd) (const guint  n,
+                          const guint  m,
+                          T           *wt,
+                          T           *vt,
+                          T           *s);
+
+static void FA(qr_panel) (QR          *qr,
+                          const guint  j,
+                          const guint  jb);
+
+static void FA(qr_apply_block) (QR             *qr,
+                                const guint     j,
+                                const guint     jb,
+                                T              *c,
+                                const guint     cstride,
+                                const guint     nc,
+                                const gboolean  trans);
+
+static void FA(qr_apply) (QR             *qr,
+                          T              *b,
+                          const guint     bcn,
+                          const gboolean  trans);
+
+
+//////// Decompositions ////////////////////////////////////////////////////////
+
+gboolean
+OP(lu) (M *a,
+        M *l,
+        M *u)
+{
+  guint i;
+  guint j;
+
+  guint n;
+  CrankMatArena *scratch;
+  gsize mark;
+  M lu;
+
+  g_return_val_if_fail (a != l, FALSE);
+  g_return_val_if_fail (a != u, FALSE);
+
+  CRANK_MAT_WARN_IF_NON_SQUARE_RET (CRANK_ADVMAT_NAME, "lu", a, FALSE);
+
+  n = a->rn;
+
+  if (n == 0)
+    return TRUE;
+
+  scratch = crank_mat_arena_get_scratch ();
+  mark = crank_mat_arena_get_mark (scratch);
+
+  FM(init_arr_arena) (&lu, scratch, n, n, a->data);
+
+  if (! OP_SELF(lu) (&lu))
+    {
+      crank_mat_arena_rewind (scratch, mark);
+      return FALSE;
+    }
+
+  // Split packed factors.
+  FM(init_fill) (l, n, n, 0);
+  FM(init_fill) (u, n, n, 0);
+
+  for (i = 0; i < n; i++)
+    {
+      T *lurowi = FM(get_rowp) (&lu, i);
+      T *lrowi = FM(get_rowp) (l, i);
+      T *urowi = FM(get_rowp) (u, i);
+
+      for (j = 0; j <= i; j++)
+        lrowi[j] = lurowi[j];
+
+      urowi[i] = 1;
+
+      for (j = i + 1; j < n; j++)
+        urowi[j] = lurowi[j];
+    }
+
+  crank_mat_arena_rewind (scratch, mark);
+  return TRUE;
+}
+
+gboolean
+OP_SELF(lu) (M *a)
+{
+  CRANK_MAT_WARN_IF_NON_SQUARE_RET (CRANK_ADVMAT_NAME, "lu-self", a, FALSE);
+
+  return FA(lu) (a, NULL);
+}
+
+gboolean
+OP_SELF(lu_p) (M                *a,
+               CrankPermutation *p)
+{
+  CRANK_MAT_WARN_IF_NON_SQUARE_RET (CRANK_ADVMAT_NAME, "lu-p-self", a, FALSE);
+
+  crank_permutation_init_identity (p, a->rn);
+
+  if (! FA(lu) (a, p))
+    {
+      crank_permutation_fini (p);
+      return FALSE;
+    }
+
+  return TRUE;
+}
+
+gboolean
+OP(lu_p) (M                *a,
+          CrankPermutation *p,
+          M                *l,
+          M                *u)
+{
+  guint i;
+  guint j;
+  M na;
+
+  g_return_val_if_fail (a != l, FALSE);
+  g_return_val_if_fail (a != u, FALSE);
+
+  CRANK_MAT_WARN_IF_NON_SQUARE_RET (CRANK_ADVMAT_NAME, "lu-pivot", a, FALSE);
+
+  // Do pivoting.
+  // Maximaze diagnoal component.
+  crank_permutation_init_identity (p, a->rn);
+
+  for (i = 0; i < a->rn; i++)
+    {
+      guint max_index = i;
+      T max =
+        ABS (FM(get) (a,  crank_permutation_get (p, i), i));
+
+      for (j = i + 1; j < a->rn; j++)
+        {
+          T cur =
+            ABS (FM(get) (a,  crank_permutation_get (p, j), i));
+
+          if (max < cur)
+            {
+              max_index = j;
+              max = cur;
+            }
+        }
+
+      crank_permutation_swap (p, i, max_index);
+    }
+
+  // Do LU Decomposition.
+  FM(shuffle_row) (a, p, &na);
+  return OP(lu) (&na, l, u);
+}
+
+
+gboolean
+FLU(init) (LU *lu,
+           M  *a)
+{
+  CRANK_MAT_WARN_IF_NON_SQUARE_RET (CRANK_ADVMAT_LU_NAME, "init", a, FALSE);
+
+  FM(copy) (a, &lu->lu);
+
+  if (! OP_SELF(lu_p) (&lu->lu, &lu->p))
+    {
+      FM(fini) (&lu->lu);
+      return FALSE;
+    }
+
+  return TRUE;
+}
+
+void
+FLU(copy) (LU *lu,
+           LU *other)
+{
+  FM(copy) (&lu->lu, &other->lu);
+  crank_permutation_copy (&lu->p, &other->p);
+}
+
+LU*
+FLU(dup) (LU *lu)
+{
+  LU *result = g_new (LU, 1);
+
+  FLU(copy) (lu, result);
+
+  return result;
+}
+
+void
+FLU(fini) (LU *lu)
+{
+  FM(fini) (&lu->lu);
+  crank_permutation_fini (&lu->p);
+}
+
+void
+FLU(free) (LU *lu)
+{
+  FLU(fini) (lu);
+  g_free (lu);
+}
+
+guint
+FLU(get_size) (LU *lu)
+{
+  return lu->lu.rn;
+}
+
+T
+FLU(get_det) (LU *lu)
+{
+  guint i;
+  guint n1 = lu->lu.rn + 1;
+  T det = crank_permutation_get_sign (&lu->p);
+
+  for (i = 0; i < lu->lu.rn; i++)
+    det *= lu->lu.data[i * n1];
+
+  return det;
+}
+
+void
+FLU(solve) (LU *lu,
+            V  *b,
+            V  *x)
+{
+  guint i;
+  guint k;
+  guint n = lu->lu.rn;
+
+  g_return_if_fail (b != x);
+  g_return_if_fail (b->n == n);
+
+  CRANK_VEC_ALLOC_ALIGNED (x, T, n);
+
+  // L y = P b
+  for (i = 0; i < n; i++)
+    {
+      T *lurowi = FM(get_rowp) (&lu->lu, i);
+      T sum = b->data[lu->p.data[i]];
+
+      for (k = 0; k < i; k++)
+        sum -= lurowi[k] * x->data[k];
+
+      x->data[i] = sum / lurowi[i];
+    }
+
+  // U x = y
+  i = n;
+  while (0 < i)
+    {
+      T *lurowi;
+      T sum;
+
+      i--;
+      lurowi = FM(get_rowp) (&lu->lu, i);
+      sum = x->data[i];
+
+      for (k = i + 1; k < n; k++)
+        sum -= lurowi[k] * x->data[k];
+
+      x->data[i] = sum;
+    }
+}
+
+void
+FLU(solve_multi) (LU *lu,
+                  M  *b,
+                  M  *x)
+{
+  guint i;
+  guint j;
+  guint k;
+  guint n = lu->lu.rn;
+  guint m;
+
+  g_return_if_fail (b != x);
+  g_return_if_fail (b->rn == n);
+
+  m = b->cn;
+  CRANK_MAT_ALLOC (x, T, n, m);
+
+  // L Y = P B, row by row.
+  for (i = 0; i < n; i++)
+    {
+      T *lurowi = FM(get_rowp) (&lu->lu, i);
+      T *xrowi = FM(get_rowp) (x, i);
+      T lii = lurowi[i];
+
+      memcpy (xrowi,
+              FM(get_rowp) (b, lu->p.data[i]),
+              sizeof (T) * m);
+
+      for (k = 0; k < i; k++)
+        {
+          T *xrowk = FM(get_rowp) (x, k);
+          T lik = lurowi[k];
+
+          for (j = 0; j < m; j++)
+            xrowi[j] -= lik * xrowk[j];
+        }
+
+      for (j = 0; j < m; j++)
+        xrowi[j] /= lii;
+    }
+
+  // U X = Y
+  i = n;
+  while (0 < i)
+    {
+      T *lurowi;
+      T *xrowi;
+
+      i--;
+      lurowi = FM(get_rowp) (&lu->lu, i);
+      xrowi = FM(get_rowp) (x, i);
+
+      for (k = i + 1; k < n; k++)
+        {
+          T *xrowk = FM(get_rowp) (x, k);
+          T uik = lurowi[k];
+
+          for (j = 0; j < m; j++)
+            xrowi[j] -= uik * xrowk[j];
+        }
+    }
+}
+
+gboolean
+FQR(init) (QR *qr,
+           M  *a)
+{
+  guint i;
+  guint j;
+  guint m = a->rn;
+  guint n = a->cn;
+  guint nb;
+
+  g_return_val_if_fail (n <= m, FALSE);
+
+  nb = MIN (CRANK_ADVMAT_BLOCK, n);
+
+  FM(copy) (a, &qr->qr);
+  FV(init_fill) (&qr->tau, n, 0);
+  FM(init_fill) (&qr->t, n, nb, 0);
+
+  for (j = 0; j < n; j += nb)
+    {
+      guint jb = MIN (nb, n - j);
+
+      FA(qr_panel) (qr, j, jb);
+
+      if (j + jb < n)
+        FA(qr_apply_block) (qr, j, jb,
+                            qr->qr.data + ((gsize) j * n) +
+                            j + jb,
+                            n, n - j - jb, TRUE);
+    }
+
+  for (i = 0; i < n; i++)
+    {
+      if (qr->qr.data[(i * n) + i] == 0)
+        {
+          FQR(fini) (qr);
+          return FALSE;
+        }
+    }
+
+  return TRUE;
+}
+
+void
+FQR(copy) (QR *qr,
+           QR *other)
+{
+  FM(copy) (&qr->qr, &other->qr);
+  FV(copy) (&qr->tau, &other->tau);
+  FM(copy) (&qr->t, &other->t);
+}
+
+QR*
+FQR(dup) (QR *qr)
+{
+  QR *result = g_new (QR, 1);
+
+  FQR(copy) (qr, result);
+
+  return result;
+}
+
+void
+FQR(fini) (QR *qr)
+{
+  FM(fini) (&qr->qr);
+  FV(fini) (&qr->tau);
+  FM(fini) (&qr->t);
+}
+
+void
+FQR(free) (QR *qr)
+{
+  FQR(fini) (qr);
+  g_free (qr);
+}
+
+guint
+FQR(get_row_size) (QR *qr)
+{
+  return qr->qr.rn;
+}
+
+guint
+FQR(get_col_size) (QR *qr)
+{
+  return qr->qr.cn;
+}
+
+void
+FQR(get_r) (QR *qr,
+            M  *r)
+{
+  guint i;
+  guint n = qr->qr.cn;
+
+  FM(init_fill) (r, n, n, 0);
+
+  for (i = 0; i < n; i++)
+    memcpy (r->data + (i * n) + i,
+            qr->qr.data + (i * n) + i,
+            sizeof (T) * (n - i));
+}
+
+void
+FQR(get_q) (QR *qr,
+            M  *q)
+{
+  guint i;
+  guint m = qr->qr.rn;
+  guint n = qr->qr.cn;
+
+  FM(init_fill) (q, m, n, 0);
+
+  for (i = 0; i < n; i++)
+    q->data[(i * n) + i] = 1;
+
+  FA(qr_apply) (qr, q->data, n, FALSE);
+}
+
+void
+FQR(mul_qt) (QR *qr,
+             V  *b,
+             V  *r)
+{
+  g_return_if_fail (b != r);
+  g_return_if_fail (b->n == qr->qr.rn);
+
+  FV(copy) (b, r);
+  FA(qr_apply) (qr, r->data, 1, TRUE);
+}
+
+void
+FQR(mul_qt_multi) (QR *qr,
+                   M  *b,
+                   M  *r)
+{
+  g_return_if_fail (b != r);
+  g_return_if_fail (b->rn == qr->qr.rn);
+
+  FM(copy) (b, r);
+  FA(qr_apply) (qr, r->data, r->cn, TRUE);
+}
+
+void
+FQR(mul_q) (QR *qr,
+            V  *b,
+            V  *r)
+{
+  g_return_if_fail (b != r);
+  g_return_if_fail (b->n == qr->qr.rn);
+
+  FV(copy) (b, r);
+  FA(qr_apply) (qr, r->data, 1, FALSE);
+}
+
+void
+FQR(mul_q_multi) (QR *qr,
+                  M  *b,
+                  M  *r)
+{
+  g_return_if_fail (b != r);
+  g_return_if_fail (b->rn == qr->qr.rn);
+
+  FM(copy) (b, r);
+  FA(qr_apply) (qr, r->data, r->cn, FALSE);
+}
+
+void
+FQR(solve) (QR *qr,
+            V  *b,
+            V  *x)
+{
+  guint i;
+  guint k;
+  guint m = qr->qr.rn;
+  guint n = qr->qr.cn;
+
+  CrankMatArena *scratch;
+  gsize mark;
+  T *y;
+
+  g_return_if_fail (b != x);
+  g_return_if_fail (b->n == m);
+
+  scratch = crank_mat_arena_get_scratch ();
+  mark = crank_mat_arena_get_mark (scratch);
+
+  y = crank_mat_arena_alloc (scratch, sizeof (T) * m);
+  memcpy (y, b->data, sizeof (T) * m);
+
+  FA(qr_apply) (qr, y, 1, TRUE);
+
+  CRANK_VEC_ALLOC_ALIGNED (x, T, n);
+
+  // R x = y
+  i = n;
+  while (0 < i)
+    {
+      T *rrowi;
+      T sum;
+
+      i--;
+      rrowi = FM(get_rowp) (&qr->qr, i);
+      sum = y[i];
+
+      for (k = i + 1; k < n; k++)
+        sum -= rrowi[k] * x->data[k];
+
+      x->data[i] = sum / rrowi[i];
+    }
+
+  crank_mat_arena_rewind (scratch, mark);
+}
+
+void
+FQR(solve_multi) (QR *qr,
+                  M  *b,
+                  M  *x)
+{
+  guint i;
+  guint j;
+  guint k;
+  guint m = qr->qr.rn;
+  guint n = qr->qr.cn;
+  guint bcn;
+
+  CrankMatArena *scratch;
+  gsize mark;
+  T *y;
+
+  g_return_if_fail (b != x);
+  g_return_if_fail (b->rn == m);
+
+  bcn = b->cn;
+
+  scratch = crank_mat_arena_get_scratch ();
+  mark = crank_mat_arena_get_mark (scratch);
+
+  y = crank_mat_arena_alloc (scratch, sizeof (T) * m * bcn);
+  memcpy (y, b->data, sizeof (T) * m * bcn);
+
+  FA(qr_apply) (qr, y, bcn, TRUE);
+
+  CRANK_MAT_ALLOC (x, T, n, bcn);
+  memcpy (x->data, y, sizeof (T) * n * bcn);
+
+  // R X = Y
+  i = n;
+  while (0 < i)
+    {
+      T *rrowi;
+      T *xrowi;
+      T rii;
+
+      i--;
+      rrowi = FM(get_rowp) (&qr->qr, i);
+      xrowi = FM(get_rowp) (x, i);
+      rii = rrowi[i];
+
+      for (k = i + 1; k < n; k++)
+        {
+          T *xrowk = FM(get_rowp) (x, k);
+          T rik = rrowi[k];
+
+          for (j = 0; j < bcn; j++)
+            xrowi[j] -= rik * xrowk[j];
+        }
+
+      for (j = 0; j < bcn; j++)
+        xrowi[j] /= rii;
+    }
+
+  crank_mat_arena_rewind (scratch, mark);
+}
+
+gboolean
+OP(ch) (M *a,
+        M *l)
+{
+  CRANK_MAT_WARN_IF_NON_SQUARE_RET ("advmat", "ch-" CRANK_ADVMAT_MAT_NAME,
+                                    a, FALSE);
+
+  FM(copy) (a, l);
+
+  if (! OP_SELF(ch) (l))
+    {
+      FM(fini) (l);
+      return FALSE;
+    }
+
+  return TRUE;
+}
+
+gboolean
+OP_SELF(ch) (M *a)
+{
+  guint i;
+  guint j;
+  guint k;
+  guint k0;
+  guint k1;
+
+  guint n;
+  CrankMatArena *scratch;
+  gsize mark;
+  T *bufa;
+  T *bufb;
+
+  CRANK_MAT_WARN_IF_NON_SQUARE_RET ("advmat", "ch-self-" CRANK_ADVMAT_MAT_NAME,
+                                    a, FALSE);
+
+  n = a->rn;
+
+#ifdef CRANK_ADVMAT_FIXED_HAS_SIZE
+  if (CRANK_ADVMAT_FIXED_HAS_SIZE (n))
+    return CRANK_ADVMAT_FIXED_FUNC(ch) (n, a->data, a->data);
+#endif
+
+  scratch = crank_mat_arena_get_scratch ();
+  mark = crank_mat_arena_get_mark (scratch);
+
+  bufa = crank_mat_arena_alloc (scratch,
+                                sizeof (T) * n * CRANK_ADVMAT_BLOCK);
+  bufb = crank_mat_arena_alloc (scratch,
+                                sizeof (T) * n * CRANK_ADVMAT_BLOCK);
+
+  for (k0 = 0; k0 < n; k0 = k1)
+    {
+      k1 = MIN (k0 + CRANK_ADVMAT_BLOCK, n);
+
+      // Proceed row by row, for columns in panel.
+      for (i = k0; i < n; i++)
+        {
+          T *l_rowi  = FM(get_rowp) (a, i);
+          T l_ij;
+          guint  je = MIN (i, k1);
+
+          // Gets l[i, j] = (a[i, j] - l[i,0]*l[j,0] - l[i,1]*l[j,1] ...) / l[j,j]
+
+          for (j = k0; j < je; j++)
+            {
+              T *l_rowj  = FM(get_rowp) (a, j);
+
+              l_ij = l_rowi[j];
+
+              for (k = k0; k < j; k++)
+                l_ij -= l_rowi[k] * l_rowj[k];
+
+              l_rowi[j] = l_ij / l_rowj[j];
+            }
+
+          if (k1 <= i)
+            continue;
+
+          // Gets l[i, i] == a[i, i] - l[i, 0]**2 - ....
+
+          l_ij = l_rowi[i];
+
+          for (k = k0; k < i; k++)
+            l_ij -= l_rowi[k] * l_rowi[k];
+
+          if (l_ij < 0)
+            {
+              crank_mat_arena_rewind (scratch, mark);
+              return FALSE;
+            }
+          l_rowi[i] = MATH(sqrt) (l_ij);
+        }
+
+      if (k1 < n)
+        FA(syrk_lower) (a, k0, k1, NULL, bufa, bufb);
+    }
+
+  // Clear upper triangle.
+  for (i = 0; i < n; i++)
+    {
+      T *l_rowi  = FM(get_rowp) (a, i);
+
+      for (j = i + 1; j < n; j++)
+        l_rowi[j] = 0;
+    }
+
+  crank_mat_arena_rewind (scratch, mark);
+  return TRUE;
+}
+
+gboolean
+OP(ldl) (M *a,
+         M *l,
+         V *d)
+{
+  CRANK_MAT_WARN_IF_NON_SQUARE_RET ("advmat", "ch-" CRANK_ADVMAT_MAT_NAME,
+                                    a, FALSE);
+
+  FM(copy) (a, l);
+
+  if (! OP_SELF(ldl) (l, d))
+    {
+      FM(fini) (l);
+      return FALSE;
+    }
+
+  return TRUE;
+}
+
+gboolean
+OP_SELF(ldl) (M *a,
+              V *d)
+{
+  guint i;
+  guint j;
+  guint k;
+  guint k0;
+  guint k1;
+
+  guint n;
+  CrankMatArena *scratch;
+  gsize mark;
+  T *bufa;
+  T *bufb;
+
+  CRANK_MAT_WARN_IF_NON_SQUARE_RET ("advmat", "ldl-self-" CRANK_ADVMAT_MAT_NAME,
+                                    a, FALSE);
+
+  n = a->rn;
+
+  FV(init_fill) (d, n, 0);
+
+  scratch = crank_mat_arena_get_scratch ();
+  mark = crank_mat_arena_get_mark (scratch);
+
+  bufa = crank_mat_arena_alloc (scratch,
+                                sizeof (T) * n * CRANK_ADVMAT_BLOCK);
+  bufb = crank_mat_arena_alloc (scratch,
+                                sizeof (T) * n * CRANK_ADVMAT_BLOCK);
+
+  for (k0 = 0; k0 < n; k0 = k1)
+    {
+      k1 = MIN (k0 + CRANK_ADVMAT_BLOCK, n);
+
+      // Proceed row by row, for columns in panel.
+      for (i = k0; i < n; i++)
+        {
+          T *l_rowi  = FM(get_rowp) (a, i);
+          T l_ij;
+          guint  je = MIN (i, k1);
+
+          // Gets l[i, j] = ( a[i, j]
+          //                  - l[i,0] * l[j,0] * d[0]
+          //                  - l[i,1] * l[j,1] * d[1] ...) / d[j]
+
+          for (j = k0; j < je; j++)
+            {
+              T *l_rowj  = FM(get_rowp) (a, j);
+
+              l_ij = l_rowi[j];
+
+              for (k = k0; k < j; k++)
+                l_ij -= l_rowi[k] * l_rowj[k] * d->data[k];
+
+              l_rowi[j] = l_ij / d->data[j];
+            }
+
+          if (k1 <= i)
+            continue;
+
+          // Gets d[i] == a[i, i] - l[i, 0]**2 * d[0] - ....
+
+          l_ij = l_rowi[i];
+
+          for (k = k0; k < i; k++)
+            l_ij -= l_rowi[k] * l_rowi[k] * d->data[k];
+
+          if (l_ij < 0)
+            {
+              FV(fini) (d);
+              crank_mat_arena_rewind (scratch, mark);
+              return FALSE;
+            }
+          d->data[i] = l_ij;
+          l_rowi[i] = 1;
+        }
+
+      if (k1 < n)
+        FA(syrk_lower) (a, k0, k1, d->data, bufa, bufb);
+    }
+
+  // Clear upper triangle.
+  for (i = 0; i < n; i++)
+    {
+      T *l_rowi  = FM(get_rowp) (a, i);
+
+      for (j = i + 1; j < n; j++)
+        l_rowi[j] = 0;
+    }
+
+  crank_mat_arena_rewind (scratch, mark);
+  return TRUE;
+}
+
+gboolean
+OP(gram_schmidt) (M *a,
+                  M *q,
+                  M *r)
+{
+  V *e;
+
+  guint i;
+  guint j;
+  guint k;
+
+  g_return_val_if_fail (a != q, FALSE);
+  g_return_val_if_fail (a != r, FALSE);
+  CRANK_MAT_WARN_IF_NON_SQUARE_RET (CRANK_ADVMAT_NAME, "gram-schmidt", a,
+                                    FALSE);
+
+  e = g_new (V, a->rn);
+  FM(init_fill) (r, a->rn, a->rn, 0);
+
+  for (i = 0; i < a->rn; i++)
+    {
+      V ac;
+      V u;
+      T umagn;
+
+      // u = a.col[i]
+      FM(get_col) (a, i, &ac);
+      FV(copy) (&ac, &u);
+
+      // u -= proj(a.col[i], e[0..(i-1)])
+      // r = a.col[i] dot e
+      for (j = 0; j < i; j++)
+        {
+          V proj;
+          T dot;
+          dot = FV(dot) (e + j, &ac);
+
+          FV(muls) (e + j, dot, &proj);
+
+          FV(sub_self) (&u, &proj);
+          FM(set) (r, j, i, dot);
+
+          FV(fini) (&proj);
+        }
+
+      // e[i] = u.unit
+      umagn = FV(get_magn) (&u);
+      FM(set) (r, i, i, umagn);
+      FV(divs) (&u, umagn, e + i);
+      FV(fini) (&u);
+      FV(fini) (&ac);
+    }
+
+  FM(init_col_arr) (q, a->rn, e);
+
+  for (k = 0; k < a->rn; k++)
+    FV(fini) (e + k);
+  g_free (e);
+
+  return TRUE;
+}
+
+gboolean
+OP(qr_householder) (M *a,
+                    M *r)
+{
+  guint i;
+  guint j;
+  guint k;
+
+  M pa = {0};
+  M qi = {0};
+  M qpai = {0};
+  V an = {0};
+
+  g_return_val_if_fail (a != r, FALSE);
+  CRANK_MAT_WARN_IF_NON_SQUARE_RET (CRANK_ADVMAT_NAME, "gram-schmidt", a,
+                                    FALSE);
+
+  if (a->rn == 1)
+    {
+      FM(init) (r, 0, 0,
+                FM(get) (a, 0, 0));
+      return TRUE;
+    }
+
+
+  // Setup initial state.
+  FM(copy) (a, &pa);
+  FM(init_fill) (r, a->rn, a->rn, 0);
+
+  for (i = 0; i < a->rn - 1; i++)
+    {
+      // Initialize an
+      FM(get_col) (&pa, 0, &an);
+
+      FV(set) (&an, 0,
+               FV(get) (&an, 0) -
+               FV(get_magn) (&an));
+
+      FV(unit_self) (&an);
+
+      // Initialize qi
+      FM(init_fill) (&qi, a->rn - i, a->rn - i, 0);
+
+      for (j = 0; j < a->rn - i; j++)
+        {
+          for (k = 0; k < a->rn - i; k++)
+            {
+              FM(set) (&qi, j, k,
+                       -2 *
+                       FV(get) (&an, j) *
+                       FV(get) (&an, k));
+            }
+
+          FM(set) (&qi, j, j,
+                   1 + FM(get) (&qi, j, j));
+        }
+
+      FM(mul) (&qi, &pa, &qpai);
+
+      // Resulting row 0 of qpai is part of r
+      // and rest part is next pa
+      for (j = 0; j < a->rn - i; j++)
+        {
+          FM(set) (r, i, i + j,
+                   FM(get) (&qpai, 0, j));
+        }
+      // FIXME: Replace slicing by other actions.
+      // Slicing requires allocation and copying.
+      FM(slice) (&qpai, 1, 1, qpai.rn, qpai.cn, &pa);
+    }
+  // Fill last part of r
+  FM(set)(r, (a->rn - 1), (a->rn - 1),
+          FM(get) (&qpai, 1, 1));
+
+  FM(fini) (&pa);
+  FM(fini) (&qi);
+  FM(fini) (&qpai);
+  FV(fini) (&an);
+  return TRUE;
+}
+
+gboolean
+OP(qr_givens) (M *a,
+               M *r)
+{
+  guint i;
+  guint j;
+  guint k;
+
+  M pa = {0};
+
+
+  g_return_val_if_fail (a != r, FALSE);
+  CRANK_MAT_WARN_IF_NON_SQUARE_RET (CRANK_ADVMAT_NAME, "qr-givens", a, FALSE);
+
+  if (a->rn == 1)
+    {
+      FM(init) (r, 1, 1,
+                FM(get) (a, 0, 0));
+      return TRUE;
+    }
+
+  FM(init_fill) (r, a->rn, a->rn, 0);
+  FM(copy) (a, &pa);
+
+  for (i = 0; i < a->rn - 1; i++)
+    {
+      for (j = a->rn - 1; i < j; j--)
+        {
+          V2 x = {
+            FM(get) (&pa, j - 1, i),
+            FM(get) (&pa, j, i)
+          };
+
+          if ((x.x == 0) && (x.y == 0))
+            {
+              FM(fini) (&pa);
+              FM(fini) (r);
+
+              return FALSE;
+            }
+
+          FV2(unit_self) (&x);
+
+          // Multiplies Givens rotation matrix.
+          //
+          // We don't build up Full givens rotation matrix,
+          // instead we apply this with sin, cos value.
+          for (k = i; k < a->rn; k++)
+            {
+              T *paa = pa.data + (a->cn * (j - 1)) + k;
+              T *pab = paa + (a->cn);
+
+              T e = *paa;
+              T f = *pab;
+
+              *paa =  e * x.x + f * x.y;
+              *pab = -e * x.y + f * x.x;
+            }
+        }
+
+      for (j = i; j < a->rn; j++)
+        {
+          FM(set) (r, i, j,
+                   FM(get) (&pa, i, j));
+        }
+    }
+
+  FM(set) (r, a->rn - 1, a->rn - 1, pa.data[(a->rn * a->rn) - 1]);
+
+  FM(fini) (&pa);
+
+  return TRUE;
+}
+
+T
+OP(eval_power) (M *a,
+                V *b,
+                V *evec)
+{
+  V bs;
+  V bsmv;
+
+  T dsp = INFINITY;
+  T ds = INFINITY;
+
+  T eval = 0;
+
+  V diff;
+
+  CRANK_MAT_WARN_IF_NON_SQUARE_RET (CRANK_ADVMAT_NAME, "power-method", a,
+                                    0);
+
+  if (b != NULL)
+    FV(copy) (b, &bs);
+  else
+    FM(get_col) (a, 0, &bs);
+
+
+  do
+    {
+      dsp = ds;
+      FV(copy) (&bs, &diff);
+
+      // Iterate: b = (a * b) / (a * b).magn
+      // bsmv = a * bs
+      // bs = bsmv unit.
+
+      FM(mulv) (a, &bs, &bsmv);
+      FV(unit) (&bsmv, &bs);
+      FV(fini) (&bsmv);
+
+      //Gets a eigen value.
+      // lambda = b * a * b / (b.magn)
+      //
+      // As b is normalized, b.magn == 1
+      //
+      // bsmv = a * bs
+      // eval = bs dot bsmv
+
+      FM(mulv) (a, &bs, &bsmv);
+      eval = FV(dot) (&bs, &bsmv);
+
+      FV(fini) (&bsmv);
+
+      FV(sub_self) (&diff, &bs);
+
+      ds = FV(get_magn_sq) (&diff);
+
+      if (dsp < ds)
+        {
+          FV(fini) (&bs);
+          return NAN;
+        }
+    }
+  while (CRANK_ADVMAT_LIT(0.0000001) < (dsp - ds));
+
+  if (ds > CRANK_ADVMAT_LIT(0.0000001))
+    {
+      if (evec != NULL)
+        FV(init_arr_take) (evec, 0, NULL);
+      FV(fini) (&bs);
+      return NAN;
+    }
+  else
+    {
+      if (evec != NULL)
+        FV(copy) (&bs, evec);
+
+      FV(fini) (&bs);
+      FV(fini) (&bsmv);
+
+      return eval;
+    }
+}
+
+void
+OP(eval_qr) (M *a,
+             V *evals)
+{
+  M ai;
+  M qi;
+  M ri;
+
+  V offdiag;
+  CrankVecBoolN nonconv;
+  gboolean cont;
+
+  guint i;
+  guint j;
+
+  CRANK_MAT_WARN_IF_NON_SQUARE (CRANK_ADVMAT_NAME, "qr-iteration", a);
+
+  FV(init_fill) (&offdiag, a->rn - 1, INFINITY);
+  crank_vec_bool_n_init_fill (&nonconv, a->rn - 1, FALSE);
+
+  cont = TRUE;
+
+  FM(copy) (a, &ai);
+
+  while (cont)
+    {
+      if (!OP(gram_schmidt) (&ai, &qi, &ri))
+        {
+          FM(fini) (&ai);
+          FV(fini) (evals);
+          return;
+        }
+
+      FM(fini) (&ai);
+      FM(mul) (&ri, &qi, &ai);
+
+      cont = FALSE;
+      for (i = 0; i < a->rn; i++)
+        {
+          for (j = 0; j + 1 < i; j++)
+            {
+              T e = FM(get) (&ai, i, j);
+              // Checks for elements are smaller than reasonably small value.
+              //TODO: Make a way to adjust this value.
+
+              if (e < -CRANK_ADVMAT_LIT(0.0001) || CRANK_ADVMAT_LIT(0.0001) < e)
+                {
+                  cont = TRUE;
+                  break;
+                }
+            }
+          if (cont)
+            break;
+        }
+
+      if (!cont)
+        {
+          for (i = 0; i < a->rn - 1; i++)
+            {
+              if (!crank_vec_bool_n_get (&nonconv, i))
+                {
+
+                  T e = ABS (FM(get) (&ai, i + 1, i));
+
+                  if (FV(get) (&offdiag, i) < e)
+                    crank_vec_bool_n_set (&nonconv, i, TRUE);
+
+                  else
+                    {
+                      FV(set) (&offdiag, i, e);
+                      if (CRANK_ADVMAT_LIT(0.0001) < e)
+                        {
+                          cont = TRUE;
+                          break;
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+  FM(get_diag) (&ai, evals);
+
+  for (i = 0; i < a->rn - 1; i++)
+    {
+      if (crank_vec_bool_n_get (&nonconv, i))
+        {
+          FV(set) (evals, i, NAN);
+          FV(set) (evals, i + 1, NAN);
+          i++;
+        }
+    }
+
+  crank_vec_bool_n_fini (&nonconv);
+  FM(fini) (&ai);
+  FM(fini) (&qi);
+  FM(fini) (&ri);
+}
+
+gboolean
+OP(eval_sym) (M *a,
+              V *evals,
+              M *evecs)
+{
+  if (a->rn <= CRANK_ADVMAT_JACOBI_SIZE)
+    return OP(eval_sym_jacobi) (a, evals, evecs, 0, 0);
+  else
+    return OP(eval_sym_ql) (a, evals, evecs, 0, 0);
+}
+
+gboolean
+OP(eval_sym_ql) (M           *a,
+                 V           *evals,
+                 M           *evecs,
+                 const guint  max_iter,
+                 const T      tol)
+{
+  guint i;
+  guint j;
+
+  guint n;
+  CrankMatArena *scratch;
+  gsize mark;
+  T *vt;
+  T *e;
+  gboolean conv;
+
+  CRANK_MAT_WARN_IF_NON_SQUARE_RET (CRANK_ADVMAT_NAME, "eval-sym-ql", a,
+                                    FALSE);
+
+  n = a->rn;
+
+  scratch = crank_mat_arena_get_scratch ();
+  mark = crank_mat_arena_get_mark (scratch);
+
+  // Transformations are stored transposed, so that rotations touch rows.
+  vt = crank_mat_arena_alloc (scratch, sizeof (T) * n * n);
+  e = crank_mat_arena_alloc (scratch, sizeof (T) * n);
+
+  FV(init_fill) (evals, n, 0);
+
+  for (i = 0; i < n; i++)
+    for (j = 0; j <= i; j++)
+      {
+        T aij = FM(get) (a, i, j);
+
+        vt[(i * n) + j] = aij;
+        vt[(j * n) + i] = aij;
+      }
+
+  if (n != 0)
+    {
+      FA(tred) (n, vt, evals->data, e);
+
+      conv = FA(tql) (n, vt, evals->data, e,
+                      (evecs != NULL),
+                      (max_iter != 0) ?
+                      max_iter : CRANK_ADVMAT_EVAL_MAX_ITER,
+                      (tol != 0) ? tol : CRANK_ADVMAT_EPSILON);
+    }
+  else
+    {
+      conv = TRUE;
+    }
+
+  FA(sort_eigen) (n, vt, evals->data);
+
+  if (evecs != NULL)
+    {
+      FM(init_fill) (evecs, n, n, 0);
+
+      for (i = 0; i < n; i++)
+        for (j = 0; j < n; j++)
+          evecs->data[(j * n) + i] = vt[(i * n) + j];
+    }
+
+  crank_mat_arena_rewind (scratch, mark);
+  return conv;
+}
+
+gboolean
+OP(eval_sym_jacobi) (M           *a,
+                     V           *evals,
+                     M           *evecs,
+                     const guint  max_sweep,
+                     const T      tol)
+{
+  guint i;
+  guint j;
+  guint k;
+  guint sweep;
+
+  guint n;
+  guint nsweep;
+  T thres;
+  CrankMatArena *scratch;
+  gsize mark;
+  M w;
+  T *vt;
+  gboolean conv = FALSE;
+
+  CRANK_MAT_WARN_IF_NON_SQUARE_RET (CRANK_ADVMAT_NAME, "eval-sym-jacobi", a,
+                                    FALSE);
+
+  n = a->rn;
+  nsweep = (max_sweep != 0) ? max_sweep : CRANK_ADVMAT_JACOBI_MAX_SWEEP;
+
+  scratch = crank_mat_arena_get_scratch ();
+  mark = crank_mat_arena_get_mark (scratch);
+
+  FM(init_arena) (&w, scratch, n, n);
+  vt = crank_mat_arena_alloc0 (scratch, sizeof (T) * n * n);
+
+  thres = 0;
+  for (i = 0; i < n; i++)
+    {
+      for (j = 0; j <= i; j++)
+        {
+          T aij = FM(get) (a, i, j);
+
+          w.data[(i * n) + j] = aij;
+          w.data[(j * n) + i] = aij;
+          thres += ((i == j) ? 1 : 2) * aij * aij;
+        }
+      vt[(i * n) + i] = 1;
+    }
+  thres = MATH(sqrt) (thres) * ((tol != 0) ? tol : CRANK_ADVMAT_EPSILON);
+
+  for (sweep = 0; sweep < nsweep; sweep++)
+    {
+      gboolean rotated = FALSE;
+
+      for (i = 0; i < n; i++)
+        {
+          for (j = i + 1; j < n; j++)
+            {
+              T *wrowi = FM(get_rowp) (&w, i);
+              T *wrowj = FM(get_rowp) (&w, j);
+              T aij = wrowi[j];
+              T theta;
+              T t;
+              T c;
+              T s;
+
+              if (ABS (aij) <= thres)
+                continue;
+
+              rotated = TRUE;
+
+              // Rotation J, that makes (J^T W J)[i, j] = 0.
+              theta = (wrowj[j] - wrowi[i]) / (2 * aij);
+              t = 1 / (ABS (theta) + MATH(sqrt) (theta * theta + 1));
+              if (theta < 0)
+                t = -t;
+              c = 1 / MATH(sqrt) (t * t + 1);
+              s = t * c;
+
+              for (k = 0; k < n; k++)
+                {
+                  T *wrowk = FM(get_rowp) (&w, k);
+                  T wki = wrowk[i];
+                  T wkj = wrowk[j];
+
+                  wrowk[i] = c * wki - s * wkj;
+                  wrowk[j] = s * wki + c * wkj;
+                }
+
+              for (k = 0; k < n; k++)
+                {
+                  T wik = wrowi[k];
+                  T wjk = wrowj[k];
+
+                  wrowi[k] = c * wik - s * wjk;
+                  wrowj[k] = s * wik + c * wjk;
+                }
+
+              wrowi[j] = 0;
+              wrowj[i] = 0;
+
+              if (evecs != NULL)
+                {
+                  T *vrowi = vt + (i * n);
+                  T *vrowj = vt + (j * n);
+
+                  for (k = 0; k < n; k++)
+                    {
+                      T vik = vrowi[k];
+                      T vjk = vrowj[k];
+
+                      vrowi[k] = c * vik - s * vjk;
+                      vrowj[k] = s * vik + c * vjk;
+                    }
+                }
+            }
+        }
+
+      if (! rotated)
+        {
+          conv = TRUE;
+          break;
+        }
+    }
+
+  FV(init_fill) (evals, n, 0);
+  for (i = 0; i < n; i++)
+    evals->data[i] = w.data[(i * n) + i];
+
+  FA(sort_eigen) (n, vt, evals->data);
+
+  if (evecs != NULL)
+    {
+      FM(init_fill) (evecs, n, n, 0);
+
+      for (i = 0; i < n; i++)
+        for (j = 0; j < n; j++)
+          evecs->data[(j * n) + i] = vt[(i * n) + j];
+    }
+
+  crank_mat_arena_rewind (scratch, mark);
+  return conv;
+}
+
+gboolean
+OP(svd) (M *a,
+         M *u,
+         V *s,
+         M *v)
+{
+  return OP(svd_jacobi) (a, u, s, v, 0, 0);
+}
+
+gboolean
+OP(svd_jacobi) (M           *a,
+                M           *u,
+                V           *s,
+                M           *v,
+                const guint  max_sweep,
+                const T      tol)
+{
+  guint i;
+  guint j;
+  guint k;
+  guint sweep;
+
+  guint m;
+  guint n;
+  guint nsweep;
+  gboolean trans;
+  T thres;
+  T small;
+  CrankMatArena *scratch;
+  gsize mark;
+  T *wt;
+  T *vt;
+  gboolean conv = FALSE;
+
+  trans = (a->rn < a->cn);
+  m = trans ? a->cn : a->rn;
+  n = trans ? a->rn : a->cn;
+
+  nsweep = (max_sweep != 0) ? max_sweep : CRANK_ADVMAT_JACOBI_MAX_SWEEP;
+  thres = (tol != 0) ? tol : CRANK_ADVMAT_EPSILON;
+
+  scratch = crank_mat_arena_get_scratch ();
+  mark = crank_mat_arena_get_mark (scratch);
+
+  // Columns of a (or rows if transposed) are rows of wt.
+  wt = crank_mat_arena_alloc (scratch, sizeof (T) * n * m);
+  vt = crank_mat_arena_alloc0 (scratch, sizeof (T) * n * n);
+
+  for (i = 0; i < a->rn; i++)
+    {
+      T *arowi = FM(get_rowp) (a, i);
+
+      for (j = 0; j < a->cn; j++)
+        {
+          if (trans)
+            wt[(i * m) + j] = arowi[j];
+          else
+            wt[(j * m) + i] = arowi[j];
+        }
+    }
+
+  for (i = 0; i < n; i++)
+    vt[(i * n) + i] = 1;
+
+  // Columns below rounding level of a are not rotated, as they are
+  // numerically zero and would not settle.
+  small = 0;
+  for (i = 0; i < n * m; i++)
+    small += wt[i] * wt[i];
+  small *= thres * thres * m;
+
+  for (sweep = 0; sweep < nsweep; sweep++)
+    {
+      gboolean rotated = FALSE;
+
+      for (i = 0; i < n; i++)
+        {
+          for (j = i + 1; j < n; j++)
+            {
+              T *wrowi = wt + (i * m);
+              T *wrowj = wt + (j * m);
+              T alpha = 0;
+              T beta = 0;
+              T gamma = 0;
+              T zeta;
+              T t;
+              T c;
+              T sn;
+
+              for (k = 0; k < m; k++)
+                {
+                  alpha += wrowi[k] * wrowi[k];
+                  beta += wrowj[k] * wrowj[k];
+                  gamma += wrowi[k] * wrowj[k];
+                }
+
+              if ((alpha <= small) || (beta <= small) ||
+                  (ABS (gamma) <= thres * MATH(sqrt) (alpha * beta)))
+                continue;
+
+              rotated = TRUE;
+
+              zeta = (beta - alpha) / (2 * gamma);
+              t = 1 / (ABS (zeta) + MATH(sqrt) (1 + zeta * zeta));
+              if (zeta < 0)
+                t = -t;
+              c = 1 / MATH(sqrt) (1 + t * t);
+              sn = c * t;
+
+              for (k = 0; k < m; k++)
+                {
+                  T wik = wrowi[k];
+                  T wjk = wrowj[k];
+
+                  wrowi[k] = c * wik - sn * wjk;
+                  wrowj[k] = sn * wik + c * wjk;
+                }
+
+              if ((trans ? u : v) != NULL)
+                {
+                  T *vrowi = vt + (i * n);
+                  T *vrowj = vt + (j * n);
+
+                  for (k = 0; k < n; k++)
+                    {
+                      T vik = vrowi[k];
+                      T vjk = vrowj[k];
+
+                      vrowi[k] = c * vik - sn * vjk;
+                      vrowj[k] = sn * vik + c * vjk;
+                    }
+                }
+            }
+        }
+
+      if (! rotated)
+        {
+          conv = TRUE;
+          break;
+        }
+    }
+
+  // Singular values are lengths of columns, and columns are normalized.
+  FV(init_fill) (s, n, 0);
+
+  for (i = 0; i < n; i++)
+    {
+      T *wrowi = wt + (i * m);
+      T norm = 0;
+
+      for (k = 0; k < m; k++)
+        norm += wrowi[k] * wrowi[k];
+
+      norm = MATH(sqrt) (norm);
+      s->data[i] = norm;
+
+      if (norm != 0)
+        for (k = 0; k < m; k++)
+          wrowi[k] /= norm;
+    }
+
+  FA(sort_svd) (n, m, wt, vt, s->data);
+
+  if (u != NULL)
+    {
+      T *src = trans ? vt : wt;
+      guint rn = trans ? n : m;
+
+      FM(init_fill) (u, rn, n, 0);
+
+      for (i = 0; i < n; i++)
+        for (k = 0; k < rn; k++)
+          u->data[(k * n) + i] = src[(i * rn) + k];
+    }
+
+  if (v != NULL)
+    {
+      T *src = trans ? wt : vt;
+      guint rn = trans ? m : n;
+
+      FM(init_fill) (v, rn, n, 0);
+
+      for (i = 0; i < n; i++)
+        for (k = 0; k < rn; k++)
+          v->data[(k * n) + i] = src[(i * rn) + k];
+    }
+
+  crank_mat_arena_rewind (scratch, mark);
+  return conv;
+}
+
+
+//////// Private Functions /////////////////////////////////////////////////////
+
+/*
+ * Blocked LU decomposition on @a, in place.
+ *
+ * If @p is not %NULL, rows are exchanged for partial pivoting, and exchanges
+ * are recorded on @p.
+ */
+static gboolean
+FA(lu) (M                *a,
+        CrankPermutation *p)
+{
+  guint i;
+  guint j;
+  guint c;
+  guint k;
+  guint k0;
+  guint k1;
+
+  guint n;
+  CrankMatArena *scratch;
+  gsize mark;
+  T *buf;
+
+  n = a->rn;
+
+  if (n == 0)
+    return TRUE;
+
+  scratch = crank_mat_arena_get_scratch ();
+  mark = crank_mat_arena_get_mark (scratch);
+
+  buf = crank_mat_arena_alloc (scratch,
+                               sizeof (T) * n * CRANK_ADVMAT_BLOCK);
+
+  for (k0 = 0; k0 < n; k0 = k1)
+    {
+      guint nb;
+      guint m;
+
+      k1 = MIN (k0 + CRANK_ADVMAT_BLOCK, n);
+      nb = k1 - k0;
+      m = n - k1;
+
+      // Factorize panel: column k0 .. k1
+      for (j = k0; j < k1; j++)
+        {
+          T *arowj = FM(get_rowp) (a, j);
+          T ljj;
+
+          // Exchanges row with largest pivot.
+          if (p != NULL)
+            {
+              guint  pi = j;
+              T pmax = ABS (arowj[j]);
+
+              for (i = j + 1; i < n; i++)
+                {
+                  T cur = ABS (FM(get) (a, i, j));
+
+                  if (pmax < cur)
+                    {
+                      pi = i;
+                      pmax = cur;
+                    }
+                }
+
+              if (pi != j)
+                {
+                  T *arowpi = FM(get_rowp) (a, pi);
+
+                  for (c = 0; c < n; c++)
+                    {
+                      T temp = arowj[c];
+                      arowj[c] = arowpi[c];
+                      arowpi[c] = temp;
+                    }
+
+                  crank_permutation_swap (p, j, pi);
+                }
+            }
+
+          ljj = arowj[j];
+
+          // Without pivoting, last pivot may be 0 as nothing is divided by it.
+          if ((ljj == 0) && ((p != NULL) || (j + 1 < n)))
+            {
+              crank_mat_arena_rewind (scratch, mark);
+              return FALSE;
+            }
+
+          for (c = j + 1; c < k1; c++)
+            arowj[c] /= ljj;
+
+          for (i = j + 1; i < n; i++)
+            {
+              T *arowi = FM(get_rowp) (a, i);
+              T lij = arowi[j];
+
+              for (c = j + 1; c < k1; c++)
+                arowi[c] -= lij * arowj[c];
+            }
+        }
+
+      if (m == 0)
+        break;
+
+      // u: row k0 .. k1, right of panel.
+      for (j = k0; j < k1; j++)
+        {
+          T *arowj = FM(get_rowp) (a, j);
+          T ljj = arowj[j];
+
+          for (k = k0; k < j; k++)
+            {
+              T *arowk = FM(get_rowp) (a, k);
+              T ljk = arowj[k];
+
+              for (c = k1; c < n; c++)
+                arowj[c] -= ljk * arowk[c];
+            }
+
+          for (c = k1; c < n; c++)
+            arowj[c] /= ljj;
+        }
+
+      // Update rest: A22 -= L21 U12
+      for (i = 0; i < m; i++)
+        {
+          T *arowi = FM(get_rowp) (a, k1 + i) + k0;
+
+          for (k = 0; k < nb; k++)
+            buf[i * nb + k] = - arowi[k];
+        }
+
+      CRANK_ADVMAT_GEMM (m, m, nb,
+                         buf, nb,
+                         FM(get_rowp) (a, k0) + k1, n,
+                         FM(get_rowp) (a, k1) + k1, n);
+    }
+
+  crank_mat_arena_rewind (scratch, mark);
+  return TRUE;
+}
+
+/*
+ * Updates lower part of trailing matrix, after panel k0 .. k1 is factorized.
+ *
+ * A22 -= L21 D L21^T, where D is diagonal of @d, or identity if @d is NULL.
+ *
+ * Diagonal blocks are fully computed, so the upper triangle of A22 near the
+ * diagonal is overwritten by meaningless values.
+ *
+ * @bufa and @bufb should hold (n - k1) * (k1 - k0) elements.
+ */
+static void
+FA(syrk_lower) (M           *a,
+                const guint  k0,
+                const guint  k1,
+                const T     *d,
+                T           *bufa,
+                T           *bufb)
+{
+  guint n = a->rn;
+  guint nb = k1 - k0;
+  guint m = n - k1;
+
+  guint i;
+  guint p;
+  guint r0;
+  guint r1;
+
+  // bufa: -(L21 D), bufb: L21^T
+  for (i = 0; i < m; i++)
+    {
+      T *arowi = FM(get_rowp) (a, k1 + i) + k0;
+
+      for (p = 0; p < nb; p++)
+        {
+          bufa[i * nb + p] = (d != NULL) ? - arowi[p] * d[k0 + p] : - arowi[p];
+          bufb[p * m + i] = arowi[p];
+        }
+    }
+
+  for (r0 = k1; r0 < n; r0 = r1)
+    {
+      r1 = MIN (r0 + CRANK_ADVMAT_SYRK_BLOCK, n);
+
+      CRANK_ADVMAT_GEMM (r1 - r0, r1 - k1, nb,
+                         bufa + (r0 - k1) * nb, nb,
+                         bufb, m,
+                         FM(get_rowp) (a, r0) + k1, n);
+    }
+}
+
+/*
+ * Reduces symmetric matrix to tridiagonal form, by Householder
+ * transformations. On entry, vt holds the matrix. On exit, vt holds transpose
+ * of accumulated orthogonal transformation, d holds diagonal and e holds
+ * subdiagonal in e[1] .. e[n - 1].
+ *
+ * This follows tred2 of EISPACK. vt is accessed as transpose, so that loops
+ * over rows of the transformation runs on contiguous memory.
+ */
+static void
+FA(tred) (const guint  n,
+          T           *vt,
+          T           *d,
+          T           *e)
+{
+  guint i;
+  guint j;
+  guint k;
+
+#define VT(r, c) vt[((gsize)(c) * n) + (r)]
+
+  for (j = 0; j < n; j++)
+    d[j] = VT (n - 1, j);
+
+  for (i = n - 1; i > 0; i--)
+    {
+      T scale = 0;
+      T h = 0;
+
+      for (k = 0; k < i; k++)
+        scale += ABS (d[k]);
+
+      if (scale == 0)
+        {
+          e[i] = d[i - 1];
+
+          for (j = 0; j < i; j++)
+            {
+              d[j] = VT (i - 1, j);
+              VT (i, j) = 0;
+              VT (j, i) = 0;
+            }
+        }
+      else
+        {
+          T f;
+          T g;
+          T hh;
+
+          for (k = 0; k < i; k++)
+            {
+              d[k] /= scale;
+              h += d[k] * d[k];
+            }
+
+          f = d[i - 1];
+          g = MATH(sqrt) (h);
+          if (f > 0)
+            g = -g;
+
+          e[i] = scale * g;
+          h = h - f * g;
+          d[i - 1] = f - g;
+
+          for (j = 0; j < i; j++)
+            e[j] = 0;
+
+          for (j = 0; j < i; j++)
+            {
+              T *vcolj = vt + ((gsize) j * n);
+
+              f = d[j];
+              VT (j, i) = f;
+              g = e[j] + vcolj[j] * f;
+
+              for (k = j + 1; k < i; k++)
+                {
+                  g += vcolj[k] * d[k];
+                  e[k] += vcolj[k] * f;
+                }
+
+              e[j] = g;
+            }
+
+          f = 0;
+          for (j = 0; j < i; j++)
+            {
+              e[j] /= h;
+              f += e[j] * d[j];
+            }
+
+          hh = f / (h + h);
+          for (j = 0; j < i; j++)
+            e[j] -= hh * d[j];
+
+          for (j = 0; j < i; j++)
+            {
+              T *vcolj = vt + ((gsize) j * n);
+
+              f = d[j];
+              g = e[j];
+
+              for (k = j; k < i; k++)
+                vcolj[k] -= (f * e[k] + g * d[k]);
+
+              d[j] = vcolj[i - 1];
+              vcolj[i] = 0;
+            }
+        }
+
+      d[i] = h;
+    }
+
+  // Accumulates transformations.
+  for (i = 0; i + 1 < n; i++)
+    {
+      T *vcoli1 = vt + ((gsize)(i + 1) * n);
+      T h;
+
+      VT (n - 1, i) = VT (i, i);
+      VT (i, i) = 1;
+      h = d[i + 1];
+
+      if (h != 0)
+        {
+          for (k = 0; k <= i; k++)
+            d[k] = vcoli1[k] / h;
+
+          for (j = 0; j <= i; j++)
+            {
+              T *vcolj = vt + ((gsize) j * n);
+              T g = 0;
+
+              for (k = 0; k <= i; k++)
+                g += vcoli1[k] * vcolj[k];
+
+              for (k = 0; k <= i; k++)
+                vcolj[k] -= g * d[k];
+            }
+        }
+
+      for (k = 0; k <= i; k++)
+        vcoli1[k] = 0;
+    }
+
+  for (j = 0; j < n; j++)
+    {
+      d[j] = VT (n - 1, j);
+      VT (n - 1, j) = 0;
+    }
+
+  VT (n - 1, n - 1) = 1;
+  e[0] = 0;
+
+#undef VT
+}
+
+/*
+ * Diagonalizes symmetric tridiagonal matrix, by QL iteration with implicit
+ * shifts. Rotations are applied to rows of vt, if vectors is TRUE.
+ *
+ * This follows tql2 of EISPACK. Returns FALSE if an eigenvalue does not
+ * converge in max_iter iterations.
+ */
+static gboolean
+FA(tql) (const guint     n,
+         T              *vt,
+         T              *d,
+         T              *e,
+         const gboolean  vectors,
+         const guint     max_iter,
+         const T         tol)
+{
+  guint i;
+  guint k;
+  guint l;
+  guint m;
+
+  T f = 0;
+  T tst1 = 0;
+
+  for (i = 1; i < n; i++)
+    e[i - 1] = e[i];
+  e[n - 1] = 0;
+
+  for (l = 0; l < n; l++)
+    {
+      guint iter = 0;
+
+      tst1 = MAX (tst1, ABS (d[l]) + ABS (e[l]));
+
+      for (m = l; m + 1 < n; m++)
+        if (ABS (e[m]) <= tol * tst1)
+          break;
+
+      if (m > l)
+        {
+          do
+            {
+              T g;
+              T p;
+              T r;
+              T h;
+              T c;
+              T c2;
+              T c3;
+              T s;
+              T s2;
+              T dl1;
+              T el1;
+
+              if (iter == max_iter)
+                return FALSE;
+              iter++;
+
+              // Computes implicit shift.
+              g = d[l];
+              p = (d[l + 1] - g) / (2 * e[l]);
+              r = MATH(hypot) (p, 1);
+              if (p < 0)
+                r = -r;
+
+              d[l] = e[l] / (p + r);
+              d[l + 1] = e[l] * (p + r);
+              dl1 = d[l + 1];
+              h = g - d[l];
+
+              for (i = l + 2; i < n; i++)
+                d[i] -= h;
+
+              f += h;
+
+              // Implicit QL transformation.
+              p = d[m];
+              c = 1;
+              c2 = c;
+              c3 = c;
+              el1 = e[l + 1];
+              s = 0;
+              s2 = 0;
+
+              for (i = m; i-- > l;)
+                {
+                  c3 = c2;
+                  c2 = c;
+                  s2 = s;
+                  g = c * e[i];
+                  h = c * p;
+                  r = MATH(hypot) (p, e[i]);
+                  e[i + 1] = s * r;
+                  s = e[i] / r;
+                  c = p / r;
+                  p = c * d[i] - s * g;
+                  d[i + 1] = h + s * (c * g + s * d[i]);
+
+                  if (vectors)
+                    {
+                      T *vrowi = vt + ((gsize) i * n);
+                      T *vrowi1 = vrowi + n;
+
+                      for (k = 0; k < n; k++)
+                        {
+                          h = vrowi1[k];
+                          vrowi1[k] = s * vrowi[k] + c * h;
+                          vrowi[k] = c * vrowi[k] - s * h;
+                        }
+                    }
+                }
+
+              p = -s * s2 * c3 * el1 * e[l] / dl1;
+              e[l] = s * p;
+              d[l] = c * p;
+            }
+          while (ABS (e[l]) > tol * tst1);
+        }
+
+      d[l] = d[l] + f;
+      e[l] = 0;
+    }
+
+  return TRUE;
+}
+
+/*
+ * Sorts eigenvalues in ascending order, with associated rows of vt.
+ */
+static void
+FA(sort_eigen) (const guint  n,
+                T           *vt,
+                T           *d)
+{
+  guint i;
+  guint j;
+  guint k;
+
+  for (i = 0; i + 1 < n; i++)
+    {
+      guint sel = i;
+
+      for (j = i + 1; j < n; j++)
+        if (d[j] < d[sel])
+          sel = j;
+
+      if (sel != i)
+        {
+          T *vrowi = vt + ((gsize) i * n);
+          T *vrows = vt + ((gsize) sel * n);
+          T temp = d[i];
+
+          d[i] = d[sel];
+          d[sel] = temp;
+
+          for (k = 0; k < n; k++)
+            {
+              temp = vrowi[k];
+              vrowi[k] = vrows[k];
+              vrows[k] = temp;
+            }
+        }
+    }
+}
+
+/*
+ * Sorts singular values in descending order, with associated rows of wt and
+ * vt.
+ */
+static void
+FA(sort_svd) (const guint  n,
+              const guint  m,
+              T           *wt,
+              T           *vt,
+              T           *s)
+{
+  guint i;
+  guint j;
+  guint k;
+
+  for (i = 0; i + 1 < n; i++)
+    {
+      guint sel = i;
+
+      for (j = i + 1; j < n; j++)
+        if (s[sel] < s[j])
+          sel = j;
+
+      if (sel != i)
+        {
+          T temp = s[i];
+
+          s[i] = s[sel];
+          s[sel] = temp;
+
+          for (k = 0; k < m; k++)
+            {
+              temp = wt[(i * m) + k];
+              wt[(i * m) + k] = wt[(sel * m) + k];
+              wt[(sel * m) + k] = temp;
+            }
+
+          for (k = 0; k < n; k++)
+            {
+              temp = vt[(i * n) + k];
+              vt[(i * n) + k] = vt[(sel * n) + k];
+              vt[(sel * n) + k] = temp;
+            }
+        }
+    }
+}
+
+/*
+ * Factorizes panel of jb columns from column j, by unblocked householder
+ * method, and builds triangular factor T of the panel, so that
+ * H_j ... H_(j + jb - 1) = I - V T V^T.
+ *
+ * Reflector vectors are stored below diagonal, with implicit 1 on diagonal.
+ */
+static void
+FA(qr_panel) (QR          *qr,
+              const guint  j,
+              const guint  jb)
+{
+  guint i;
+  guint k;
+  guint l;
+  guint r;
+
+  guint m = qr->qr.rn;
+  guint n = qr->qr.cn;
+  guint nb = qr->t.cn;
+  T *a = qr->qr.data;
+  T *t = qr->t.data + ((gsize) j * nb);
+  T *tau = qr->tau.data + j;
+
+  CrankMatArena *scratch;
+  gsize mark;
+  T *w;
+
+  scratch = crank_mat_arena_get_scratch ();
+  mark = crank_mat_arena_get_mark (scratch);
+  w = crank_mat_arena_alloc (scratch, sizeof (T) * jb);
+
+  for (i = 0; i < jb; i++)
+    {
+      guint c = j + i;
+      guint nc = jb - i - 1;
+      T *arowc = a + ((gsize) c * n) + c;
+      T alpha = arowc[0];
+      T xnorm = 0;
+      T beta;
+      T scale;
+
+      for (r = c + 1; r < m; r++)
+        xnorm += a[((gsize) r * n) + c] * a[((gsize) r * n) + c];
+
+      // Reflector is identity, if column is already zero below diagonal.
+      if (xnorm == 0)
+        {
+          tau[i] = 0;
+          continue;
+        }
+
+      beta = MATH(hypot) (alpha, MATH(sqrt) (xnorm));
+      if (0 < alpha)
+        beta = -beta;
+
+      tau[i] = (beta - alpha) / beta;
+      scale = 1 / (alpha - beta);
+
+      for (r = c + 1; r < m; r++)
+        a[((gsize) r * n) + c] *= scale;
+
+      arowc[0] = beta;
+
+      // Applies reflector to rest of panel.
+      if (nc == 0)
+        continue;
+
+      memcpy (w, arowc + 1, sizeof (T) * nc);
+
+      for (r = c + 1; r < m; r++)
+        {
+          T *arowr = a + ((gsize) r * n) + c;
+          T v = arowr[0];
+
+          for (k = 0; k < nc; k++)
+            w[k] += v * arowr[k + 1];
+        }
+
+      for (k = 0; k < nc; k++)
+        {
+          w[k] *= tau[i];
+          arowc[k + 1] -= w[k];
+        }
+
+      for (r = c + 1; r < m; r++)
+        {
+          T *arowr = a + ((gsize) r * n) + c;
+          T v = arowr[0];
+
+          for (k = 0; k < nc; k++)
+            arowr[k + 1] -= v * w[k];
+        }
+    }
+
+  // Strict upper part of T gets V^T V, by a pass over rows.
+  for (l = 0; l < jb; l++)
+    memset (t + (l * nb), 0, sizeof (T) * jb);
+
+  for (r = j + 1; r < m; r++)
+    {
+      guint rr = r - j;
+      T *arowr = a + ((gsize) r * n) + j;
+      T *vrow = arowr;
+
+      if (rr < jb)
+        {
+          for (l = 0; l < jb; l++)
+            w[l] = (l < rr) ? arowr[l] : ((l == rr) ? 1 : 0);
+          vrow = w;
+        }
+
+      for (l = 0; l < MIN (rr, jb); l++)
+        {
+          T *trowl = t + (l * nb);
+          T vl = vrow[l];
+
+          for (i = l + 1; i < MIN (rr + 1, jb); i++)
+            trowl[i] += vl * vrow[i];
+        }
+    }
+
+  // T(0:i, i) = - tau_i T(0:i, 0:i) V(:, 0:i)^T v_i
+  for (i = 0; i < jb; i++)
+    {
+      for (l = 0; l < i; l++)
+        t[(l * nb) + i] *= -tau[i];
+
+      for (l = 0; l < i; l++)
+        {
+          T *trowl = t + (l * nb);
+          T sum = 0;
+
+          for (k = l; k < i; k++)
+            sum += trowl[k] * t[(k * nb) + i];
+
+          trowl[i] = sum;
+        }
+
+      t[(i * nb) + i] = tau[i];
+    }
+
+  crank_mat_arena_rewind (scratch, mark);
+}
+
+/*
+ * Applies block reflector of panel from column j, I - V T V^T, or its
+ * transpose, to rows j .. m - 1 of c. c points row j, and has nc columns.
+ *
+ * This takes two passes over rows, W = V^T C and C -= V (T W).
+ */
+static void
+FA(qr_apply_block) (QR             *qr,
+                    const guint     j,
+                    const guint     jb,
+                    T              *c,
+                    const guint     cstride,
+                    const guint     nc,
+                    const gboolean  trans)
+{
+  guint k;
+  guint l;
+  guint r;
+
+  guint m = qr->qr.rn;
+  guint n = qr->qr.cn;
+  guint nb = qr->t.cn;
+  T *a = qr->qr.data;
+  T *t = qr->t.data + ((gsize) j * nb);
+
+  CrankMatArena *scratch;
+  gsize mark;
+  T *w;
+  T *vbuf;
+
+  scratch = crank_mat_arena_get_scratch ();
+  mark = crank_mat_arena_get_mark (scratch);
+  w = crank_mat_arena_alloc0 (scratch, sizeof (T) * jb * nc);
+  vbuf = crank_mat_arena_alloc (scratch, sizeof (T) * jb);
+
+  // W = V^T C
+  for (r = j; r < m; r++)
+    {
+      guint rr = r - j;
+      T *arowr = a + ((gsize) r * n) + j;
+      T *crowr = c + ((gsize) rr * cstride);
+      T *vrow = arowr;
+      guint lend = MIN (rr + 1, jb);
+
+      if (rr < jb)
+        {
+          for (l = 0; l < rr; l++)
+            vbuf[l] = arowr[l];
+          vbuf[rr] = 1;
+          vrow = vbuf;
+        }
+
+      for (l = 0; l < lend; l++)
+        {
+          T *wrowl = w + ((gsize) l * nc);
+          T vl = vrow[l];
+
+          for (k = 0; k < nc; k++)
+            wrowl[k] += vl * crowr[k];
+        }
+    }
+
+  // W = T^T W, or T W.
+  if (trans)
+    {
+      l = jb;
+      while (0 < l)
+        {
+          T *wrowl;
+          guint i;
+
+          l--;
+          wrowl = w + ((gsize) l * nc);
+
+          for (k = 0; k < nc; k++)
+            wrowl[k] *= t[(l * nb) + l];
+
+          for (i = 0; i < l; i++)
+            {
+              T *wrowi = w + ((gsize) i * nc);
+              T til = t[(i * nb) + l];
+
+              for (k = 0; k < nc; k++)
+                wrowl[k] += til * wrowi[k];
+            }
+        }
+    }
+  else
+    {
+      for (l = 0; l < jb; l++)
+        {
+          T *wrowl = w + ((gsize) l * nc);
+          guint i;
+
+          for (k = 0; k < nc; k++)
+            wrowl[k] *= t[(l * nb) + l];
+
+          for (i = l + 1; i < jb; i++)
+            {
+              T *wrowi = w + ((gsize) i * nc);
+              T tli = t[(l * nb) + i];
+
+              for (k = 0; k < nc; k++)
+                wrowl[k] += tli * wrowi[k];
+            }
+        }
+    }
+
+  // C -= V W
+  for (r = j; r < m; r++)
+    {
+      guint rr = r - j;
+      T *arowr = a + ((gsize) r * n) + j;
+      T *crowr = c + ((gsize) rr * cstride);
+      T *vrow = arowr;
+      guint lend = MIN (rr + 1, jb);
+
+      if (rr < jb)
+        {
+          for (l = 0; l < rr; l++)
+            vbuf[l] = arowr[l];
+          vbuf[rr] = 1;
+          vrow = vbuf;
+        }
+
+      for (l = 0; l < lend; l++)
+        {
+          T *wrowl = w + ((gsize) l * nc);
+          T vl = vrow[l];
+
+          for (k = 0; k < nc; k++)
+            crowr[k] -= vl * wrowl[k];
+        }
+    }
+
+  crank_mat_arena_rewind (scratch, mark);
+}
+
+/*
+ * Applies Q^T (if trans) or Q to m x bcn matrix b, panel by panel.
+ */
+static void
+FA(qr_apply) (QR             *qr,
+              T              *b,
+              const guint     bcn,
+              const gboolean  trans)
+{
+  guint j;
+  guint n = qr->qr.cn;
+  guint nb = qr->t.cn;
+
+  if (n == 0)
+    return;
+
+  if (trans)
+    {
+      for (j = 0; j < n; j += nb)
+        FA(qr_apply_block) (qr, j, MIN (nb, n - j),
+                            b + ((gsize) j * bcn),
+                            bcn, bcn, TRUE);
+    }
+  else
+    {
+      j = ((n - 1) / nb) * nb;
+
+      while (TRUE)
+        {
+          FA(qr_apply_block) (qr, j, MIN (nb, n - j),
+                              b + ((gsize) j * bcn),
+                              bcn, bcn, FALSE);
+          if (j == 0)
+            break;
+          j -= nb;
+        }
+    }
+}
+
+#undef T
+#undef M
+#undef V
+#undef V2
+#undef LU
+#undef QR
+#undef FM
+#undef FV
+#undef FV2
+#undef FLU
+#undef FQR
+#undef FA
+#undef OP
+#undef OP_SELF
+#undef MATH
+
+#endif
@@ -21,20 +21,30 @@
 
 #define _CRANKBASE_INSIDE
 
+#include <float.h>
 #include <math.h>
+#include <string.h>
 
 #include <glib.h>
 #include <glib-object.h>
 
 #include "crankpermutation.h"
 #include "crankveccommon.h"
+#include "crankmatcommon.h"
 #include "crankvecbool.h"
 #include "crankvecfloat.h"
+#include "crankvecdouble.h"
 #include "crankveccplxfloat.h"
 #include "crankmatfloat.h"
+#include "crankmatdouble.h"
 #include "crankmatcplxfloat.h"
+#include "crankmatfixed.h"
+#include "crankmatarena.h"
 #include "crankadvmat.h"
 
+#include "crankcpu-private.h"
+#include "crankgemm-private.h"
+
 /**
  * SECTION: crankadvmat
  * @title: Advanced Matrix Operations.
@@ -128,18 +138,217 @@
  *         <entry>R
  *           <para>Upper triangular matrix</para></entry>
  *       </row>
+ *
+ *       <row>
+ *         <entry morerows="2">
+ *           Singular Value Decomposition
+ *           <para>A = U S V<superscript>T</superscript> </para>
+ *           <para>Crank System uses one-sided Jacobi method</para>
+ *           <para>Rectangular matrices are supported</para></entry>
+ *         <entry>U
+ *           <para>Orthonormal columns</para></entry>
+ *       </row>
+ *       <row>
+ *         <entry>S
+ *           <para>Diagonal Matrix</para>
+ *           <para>Crank System returns singular values as vector.</para></entry>
+ *       </row>
+ *       <row>
+ *         <entry>V
+ *           <para>Orthogonal matrix</para></entry>
+ *       </row>
  *     </tbody>
  *   </tgroup>
  * </table>
+ *
+ * # Blocked Decompositions
+ *
+ * LU, Cholesky and LDLT decompositions of #CrankMatFloatN proceed by panels of
+ * columns. After a panel is factorized, rest of matrix is updated by matrix
+ * multiplication, where most of operations are done. In-place forms, like
+ * crank_lu_mat_float_n_self(), store factors into the given matrix and avoid
+ * allocating separate factors.
+ *
+ * # Double precision
+ *
+ * Decompositions of #CrankMatFloatN are also provided for #CrankMatDoubleN,
+ * like crank_lu_mat_double_n(). They are blocked in same way, and are useful
+ * for ill-conditioned matrices, where float loses too many digits.
+ *
+ * # Factorization objects
+ *
+ * #CrankLUFloatN and #CrankLUDoubleN hold pivoted LU factorization of a
+ * matrix. It is computed once, and solves systems for many right hand sides,
+ * without getting inverse matrix.
+ *
+ * #CrankQRFloatN and #CrankQRDoubleN hold householder QR factorization of a
+ * matrix with at least as many rows as columns. Reflectors are stored in
+ * place of the matrix, and applied by panels in compact WY form, so Q is never
+ * formed. This solves least squares problems of tall matrices, like
+ * 100000 x 20, where Q itself would not fit in memory.
+ *
+ * # Symmetric eigenvalues
+ *
+ * Eigenvalues and eigenvectors of symmetric matrices are obtained by
+ * crank_eval_sym_mat_float_n(). Large matrices are reduced to tridiagonal form
+ * and then diagonalized by QL iteration, while small matrices are diagonalized
+ * by Jacobi method. Each method has a form that takes iteration limit and
+ * tolerance, and reports whether it converged.
  */
 
-
+//////// Type Definition ///////////////////////////////////////////////////////
+
+G_DEFINE_BOXED_TYPE (CrankLUFloatN,
+                     crank_lu_float_n,
+                     crank_lu_float_n_dup,
+                     crank_lu_float_n_free)
+
+G_DEFINE_BOXED_TYPE (CrankLUDoubleN,
+                     crank_lu_double_n,
+                     crank_lu_double_n_dup,
+                     crank_lu_double_n_free)
+
+G_DEFINE_BOXED_TYPE (CrankQRFloatN,
+                     crank_qr_float_n,
+                     crank_qr_float_n_dup,
+                     crank_qr_float_n_free)
+
+G_DEFINE_BOXED_TYPE (CrankQRDoubleN,
+                     crank_qr_double_n,
+                     crank_qr_double_n_dup,
+                     crank_qr_double_n_free)
+
+//////// Private Macros ////////////////////////////////////////////////////////
+
+// Count of columns in a panel, for blocked decompositions.
+#define CRANK_ADVMAT_BLOCK  64
+
+// Count of rows updated at once, in symmetric update.
+#define CRANK_ADVMAT_SYRK_BLOCK 128
+
+// Largest size of matrix, that Jacobi method is preferred for eigenvalues.
+#define CRANK_ADVMAT_JACOBI_SIZE 10
+
+// Default limit of iterations for each eigenvalue in QL iteration.
+#define CRANK_ADVMAT_EVAL_MAX_ITER 30
+
+// Default limit of sweeps in Jacobi methods.
+#define CRANK_ADVMAT_JACOBI_MAX_SWEEP 50
+
+
+//////// Float /////////////////////////////////////////////////////////////////
+
+/* Operations of real matrices are written once in
+ * crankadvmat-template-private.h, and instantiated for each precision here.
+ * Documentations of them follow complex operations. */
+
+#define CRANK_ADVMAT_T                  gfloat
+#define CRANK_ADVMAT_MAT_TYPE           CrankMatFloatN
+#define CRANK_ADVMAT_MAT_FUNC(name)     crank_mat_float_n_##name
+#define CRANK_ADVMAT_VEC_TYPE           CrankVecFloatN
+#define CRANK_ADVMAT_VEC_FUNC(name)     crank_vec_float_n_##name
+#define CRANK_ADVMAT_VEC2_TYPE          CrankVecFloat2
+#define CRANK_ADVMAT_VEC2_FUNC(name)    crank_vec_float2_##name
+#define CRANK_ADVMAT_LU_TYPE            CrankLUFloatN
+#define CRANK_ADVMAT_LU_FUNC(name)      crank_lu_float_n_##name
+#define CRANK_ADVMAT_QR_TYPE            CrankQRFloatN
+#define CRANK_ADVMAT_QR_FUNC(name)      crank_qr_float_n_##name
+#define CRANK_ADVMAT_OP(op)             crank_##op##_mat_float_n
+#define CRANK_ADVMAT_OP_SELF(op)        crank_##op##_mat_float_n_self
+#define CRANK_ADVMAT_PRIV(name)         crank_advmat_float_n_##name
+#define CRANK_ADVMAT_NAME               "Advmat-MatFloatN"
+#define CRANK_ADVMAT_LU_NAME            "Advmat-LUFloatN"
+#define CRANK_ADVMAT_MAT_NAME           "MatFloatN"
+#define CRANK_ADVMAT_MATH(func)         func##f
+#define CRANK_ADVMAT_LIT(x)             x##f
+#define CRANK_ADVMAT_EPSILON            FLT_EPSILON
+#define CRANK_ADVMAT_GEMM               _crank_gemm_float
+#define CRANK_ADVMAT_FIXED_HAS_SIZE(n)  CRANK_MAT_FLOAT_FIXED_HAS_SIZE (n)
+#define CRANK_ADVMAT_FIXED_FUNC(name)   crank_mat_float_fixed_##name
+
+#include "crankadvmat-template-private.h"
+
+#undef CRANK_ADVMAT_T
+#undef CRANK_ADVMAT_MAT_TYPE
+#undef CRANK_ADVMAT_MAT_FUNC
+#undef CRANK_ADVMAT_VEC_TYPE
+#undef CRANK_ADVMAT_VEC_FUNC
+#undef CRANK_ADVMAT_VEC2_TYPE
+#undef CRANK_ADVMAT_VEC2_FUNC
+#undef CRANK_ADVMAT_LU_TYPE
+#undef CRANK_ADVMAT_LU_FUNC
+#undef CRANK_ADVMAT_QR_TYPE
+#undef CRANK_ADVMAT_QR_FUNC
+#undef CRANK_ADVMAT_OP
+#undef CRANK_ADVMAT_OP_SELF
+#undef CRANK_ADVMAT_PRIV
+#undef CRANK_ADVMAT_NAME
+#undef CRANK_ADVMAT_LU_NAME
+#undef CRANK_ADVMAT_MAT_NAME
+#undef CRANK_ADVMAT_MATH
+#undef CRANK_ADVMAT_LIT
+#undef CRANK_ADVMAT_EPSILON
+#undef CRANK_ADVMAT_GEMM
+#undef CRANK_ADVMAT_FIXED_HAS_SIZE
+#undef CRANK_ADVMAT_FIXED_FUNC
+
+
+//////// Double ////////////////////////////////////////////////////////////////
+
+#define CRANK_ADVMAT_T                  gdouble
+#define CRANK_ADVMAT_MAT_TYPE           CrankMatDoubleN
+#define CRANK_ADVMAT_MAT_FUNC(name)     crank_mat_double_n_##name
+#define CRANK_ADVMAT_VEC_TYPE           CrankVecDoubleN
+#define CRANK_ADVMAT_VEC_FUNC(name)     crank_vec_double_n_##name
+#define CRANK_ADVMAT_VEC2_TYPE          CrankVecDouble2
+#define CRANK_ADVMAT_VEC2_FUNC(name)    crank_vec_double2_##name
+#define CRANK_ADVMAT_LU_TYPE            CrankLUDoubleN
+#define CRANK_ADVMAT_LU_FUNC(name)      crank_lu_double_n_##name
+#define CRANK_ADVMAT_QR_TYPE            CrankQRDoubleN
+#define CRANK_ADVMAT_QR_FUNC(name)      crank_qr_double_n_##name
+#define CRANK_ADVMAT_OP(op)             crank_##op##_mat_double_n
+#define CRANK_ADVMAT_OP_SELF(op)        crank_##op##_mat_double_n_self
+#define CRANK_ADVMAT_PRIV(name)         crank_advmat_double_n_##name
+#define CRANK_ADVMAT_NAME               "Advmat-MatDoubleN"
+#define CRANK_ADVMAT_LU_NAME            "Advmat-LUDoubleN"
+#define CRANK_ADVMAT_MAT_NAME           "MatDoubleN"
+#define CRANK_ADVMAT_MATH(func)         func
+#define CRANK_ADVMAT_LIT(x)             x
+#define CRANK_ADVMAT_EPSILON            DBL_EPSILON
+#define CRANK_ADVMAT_GEMM               _crank_gemm_double
+
+#include "crankadvmat-template-private.h"
+
+#undef CRANK_ADVMAT_T
+#undef CRANK_ADVMAT_MAT_TYPE
+#undef CRANK_ADVMAT_MAT_FUNC
+#undef CRANK_ADVMAT_VEC_TYPE
+#undef CRANK_ADVMAT_VEC_FUNC
+#undef CRANK_ADVMAT_VEC2_TYPE
+#undef CRANK_ADVMAT_VEC2_FUNC
+#undef CRANK_ADVMAT_LU_TYPE
+#undef CRANK_ADVMAT_LU_FUNC
+#undef CRANK_ADVMAT_QR_TYPE
+#undef CRANK_ADVMAT_QR_FUNC
+#undef CRANK_ADVMAT_OP
+#undef CRANK_ADVMAT_OP_SELF
+#undef CRANK_ADVMAT_PRIV
+#undef CRANK_ADVMAT_NAME
+#undef CRANK_ADVMAT_LU_NAME
+#undef CRANK_ADVMAT_MAT_NAME
+#undef CRANK_ADVMAT_MATH
+#undef CRANK_ADVMAT_LIT
+#undef CRANK_ADVMAT_EPSILON
+#undef CRANK_ADVMAT_GEMM
+
+
+//////// Complex Float /////////////////////////////////////////////////////////
 
 /**
- * crank_lu_mat_float_n:
- * @a: A Square matrix.
+ * crank_lu_mat_cplx_float_n:
+ * @a: A Matrix.
  * @l: (out): Lower triangular factor.
- * @u: (out): Upper triangular factor, whose all diagonal components are 1.
+ * @u: (out): Upper triangular factor.
  *
  * Try to get LU decomposition of @a.
  *
@@ -147,88 +356,122 @@
  * be 1.
  *
  * Note that this does not perform pivoting. If pivoting is required, then use
- * crank_lu_p_mat_float_n().
- *
- * Time: O((@a->rn)<superscript>3</superscript>)
+ * crank_lu_p_mat_cplx_float_n().
  *
  * Returns: Whether @a has LU Decomposition.
  */
 gboolean
-crank_lu_mat_float_n (CrankMatFloatN *a,
-                      CrankMatFloatN *l,
-                      CrankMatFloatN *u)
+crank_lu_mat_cplx_float_n (CrankMatCplxFloatN *a,
+                           CrankMatCplxFloatN *l,
+                           CrankMatCplxFloatN *u)
 {
   guint i;
   guint j;
   guint k;
 
   guint n;
-  CrankMatFloatN ut;
+
+  static CrankCplxFloat ZERO = {0, 0};
+  static CrankCplxFloat ONE = {1, 0};
 
   g_return_val_if_fail (a != l, FALSE);
   g_return_val_if_fail (a != u, FALSE);
 
-  CRANK_MAT_WARN_IF_NON_SQUARE_RET ("Advmat-MatFloatN", "lu", a, FALSE);
+  CRANK_MAT_WARN_IF_NON_SQUARE_RET ("Advmat-MatCplxFloatN", "lu", a, FALSE);
 
   n = a->rn;
 
   if (n == 0)
     return TRUE;
 
-  crank_mat_float_n_init_fill (l, n, n, 0);
-  crank_mat_float_n_init_fill (&ut, n, n, 0);
+  if (n == 1)
+    {
+      if (!crank_cplx_float_is_zero (a->data))
+        {
+          crank_mat_cplx_float_n_init (l, 1, 1, a->data + 0);
+          crank_mat_cplx_float_n_init_uc (u, 1, 1, 1.0f, 0.0f);
+          return TRUE;
+        }
+      // If a == [[0]] then a is singular and cannot be defactorized.
+      else
+        return FALSE;
+    }
+
+  crank_mat_cplx_float_n_init_fill (l, n, n, &ZERO);
+  crank_mat_cplx_float_n_init_fill (u, n, n, &ZERO);
 
   for (i = 0; i < n; i++)
     {
-      gfloat *ucoli = crank_mat_float_n_get_rowp (&ut, i);
-
       // l: column i
       for (j = i; j < n; j++)
         {
-          gfloat *lrowj = crank_mat_float_n_get_rowp (l, j);
-          gfloat sum = 0;
+          CrankCplxFloat sum = {0.0f, 0.0f};
+          CrankCplxFloat lpart;
+          CrankCplxFloat upart;
+          CrankCplxFloat lupart;
+          CrankCplxFloat apart;
 
           for (k = 0; k < i; k++)
-            sum +=  lrowj[k] * ucoli[k];
+            {
+              crank_mat_cplx_float_n_get (l, j, k, &lpart);
+              crank_mat_cplx_float_n_get (u, k, i, &upart);
+
+              crank_cplx_float_mul (&lpart, &upart, &lupart);
+              crank_cplx_float_add_self (&sum, &lupart);
+            }
 
-          lrowj[i] = crank_mat_float_n_get (a, j, i) - sum;
+          crank_mat_cplx_float_n_get (a, j, i, &apart);
+          crank_cplx_float_sub_self (&apart, &sum);
+          crank_mat_cplx_float_n_set (l, j, i, &apart);
         }
 
 
       // u: row i
-      ucoli[i] = 1.0f;
-      //crank_mat_float_n_set (u, i, i, 1);
+      crank_mat_cplx_float_n_set (u, i, i, &ONE);
       for (j = i + 1; j < n; j++)
         {
-          gfloat *lrowi = crank_mat_float_n_get_rowp(l, i);
-          gfloat *ucolj = crank_mat_float_n_get_rowp(&ut, j);
-          gfloat sum = 0;
-          gfloat ln = lrowi[i];
+          CrankCplxFloat sum = {0.0f, 0.0f};
+          CrankCplxFloat lpart;
+          CrankCplxFloat upart;
+          CrankCplxFloat lupart;
+          CrankCplxFloat apart;
+
+          CrankCplxFloat ldpart;
 
-          if (ln == 0)
+          crank_mat_cplx_float_n_get (l, i, i, &ldpart);
+
+          if (crank_cplx_float_is_zero (&ldpart))
             {
-              crank_mat_float_n_fini (l);
-              crank_mat_float_n_fini (&ut);
+              crank_mat_cplx_float_n_fini (l);
+              crank_mat_cplx_float_n_fini (u);
               return FALSE;
             }
 
           for (k = 0; k < i; k++)
-            sum += lrowi[k] * ucolj[k];
+            {
+              crank_mat_cplx_float_n_get (l, i, k, &lpart);
+              crank_mat_cplx_float_n_get (u, k, j, &upart);
+              crank_cplx_float_mul (&lpart, &upart, &lupart);
+              crank_cplx_float_add_self (&sum, &lupart);
+            }
 
-          ucolj[i] = (crank_mat_float_n_get (a, i, j) - sum) / ln;
+          crank_mat_cplx_float_n_get (a, i, j, &apart);
+          crank_cplx_float_sub_self (&apart, &sum);
+          crank_cplx_float_div_self (&apart, &ldpart);
+          crank_mat_cplx_float_n_set (u, i, j, &apart);
         }
     }
-  crank_mat_float_n_transpose (&ut, u);
-  crank_mat_float_n_fini (&ut);
+
   return TRUE;
 }
 
+
 /**
- * crank_lu_p_mat_float_n:
- * @a: A Square matrix.
+ * crank_lu_p_mat_cplx_float_n:
+ * @a: A Matrix.
  * @p: (out): Pivoting result.
  * @l: (out): Lower triangular factor.
- * @u: (out): Upper triangular factor, whose all diagonal components are 1.
+ * @u: (out): Upper triangular factor.
  *
  * Try to get LU decomposition of @a, with pivoting.
  *
@@ -241,24 +484,23 @@ crank_lu_mat_float_n (CrankMatFloatN *a,
  *
  * For implementation detail, please see crank_lu_mat_float_n().
  *
- * Time: O((@a->rn)<superscript>3</superscript>)
- *
  * Returns: Whether @a has LU Decomposition.
  */
 gboolean
-crank_lu_p_mat_float_n (CrankMatFloatN   *a,
-                        CrankPermutation *p,
-                        CrankMatFloatN   *l,
-                        CrankMatFloatN   *u)
+crank_lu_p_mat_cplx_float_n (CrankMatCplxFloatN *a,
+                             CrankPermutation   *p,
+                             CrankMatCplxFloatN *l,
+                             CrankMatCplxFloatN *u)
 {
   guint i;
   guint j;
-  CrankMatFloatN na;
+  CrankMatCplxFloatN na;
 
   g_return_val_if_fail (a != l, FALSE);
   g_return_val_if_fail (a != u, FALSE);
 
-  CRANK_MAT_WARN_IF_NON_SQUARE_RET ("Advmat-MatFloatN", "lu-pivot", a, FALSE);
+  CRANK_MAT_WARN_IF_NON_SQUARE_RET ("Advmat-MatCplxFloatN", "lu-pivot", a,
+                                    FALSE);
 
   // Do pivoting.
   // Maximaze diagnoal component.
@@ -266,19 +508,25 @@ crank_lu_p_mat_float_n (CrankMatFloatN   *a,
 
   for (i = 0; i < a->rn; i++)
     {
+      CrankCplxFloat max;
+      gfloat max_normsq;
       guint max_index = i;
-      gfloat max =
-        ABS (crank_mat_float_n_get (a,  crank_permutation_get (p, i), i));
+
+      crank_mat_cplx_float_n_get (a,  crank_permutation_get (p, i), i, &max);
+      max_normsq = crank_cplx_float_get_norm_sq (&max);
 
       for (j = i + 1; j < a->rn; j++)
         {
-          gfloat cur =
-            ABS (crank_mat_float_n_get (a,  crank_permutation_get (p, j), i));
+          CrankCplxFloat cur;
+          gfloat cur_normsq;
 
-          if (max < cur)
+          crank_mat_cplx_float_n_get (a,
+                                      crank_permutation_get (p, j), i, &cur);
+          cur_normsq = crank_cplx_float_get_norm_sq (&cur);
+          if (max_normsq < cur_normsq)
             {
               max_index = j;
-              max = cur;
+              max_normsq = cur_normsq;
             }
         }
 
@@ -286,748 +534,1051 @@ crank_lu_p_mat_float_n (CrankMatFloatN   *a,
     }
 
   // Do LU Decomposition.
-  crank_mat_float_n_shuffle_row (a, p, &na);
-  return crank_lu_mat_float_n (&na, l, u);
+  crank_mat_cplx_float_n_shuffle_row (a, p, &na);
+  return crank_lu_mat_cplx_float_n (&na, l, u);
 }
 
 /**
- * crank_ch_mat_float_n:
- * @a: A Symmetric matrix.
+ * crank_ch_mat_cplx_float_n:
+ * @a: A Matrix.
  * @l: (out): A Lower triangular matrix.
  *
- * Performs cholesky decomposition on @a, which results in @l, which meets a
- * statement below.
- *
- * * @l.mul (@l.transpose()) == @a.
+ * Performs cholesky decomposition on @a, which results in @l, which
  *
- * Time: O((@a->rn)<superscript>3</superscript>)
+ * * @l.mul (@l.star()) == @a.
  *
  * Returns: Whether cholesky decomposition performed on @a.
  */
 gboolean
-crank_ch_mat_float_n (CrankMatFloatN *a,
-                      CrankMatFloatN *l)
+crank_ch_mat_cplx_float_n (CrankMatCplxFloatN *a,
+                           CrankMatCplxFloatN *l)
 {
   guint i;
   guint j;
   guint k;
 
-  CRANK_MAT_WARN_IF_NON_SQUARE_RET ("advmat", "ch-MatFloatN", a, FALSE);
+  CRANK_MAT_WARN_IF_NON_SQUARE_RET ("advmat", "ch-MatCplxFloatN", a, FALSE);
 
-  crank_mat_float_n_init_fill (l, a->rn, a->rn, 0.0f);
+  crank_mat_cplx_float_n_init_fill_uc (l, a->rn, a->rn, 0.0f, 0.0f);
 
   // Proceed row by row.
   for (i = 0; i < a->rn; i++)
     {
-      gfloat *l_rowi  = crank_mat_float_n_get_rowp (l, i);
-      gfloat l_ij;
+      CrankCplxFloat l_ij;
 
       // Gets l[i, j] = (a[i, j] - l[i,0]*l[j,0] - l[i,1]*l[j,1] ...) / l[j,j]
 
       for (j = 0; j < i; j++)
         {
-          gfloat *l_rowj  = crank_mat_float_n_get_rowp (l, j);
-          gfloat d;
-
-          l_ij = crank_mat_float_n_get (a, i, j);
-
+          crank_mat_cplx_float_n_get (a, i, j, &l_ij);
           for (k = 0; k < j; k++)
-            l_ij -= l_rowi[k] * l_rowj[k];
+            {
+              CrankCplxFloat ik_jk;
 
-          l_ij /= l_rowj[j];
-          l_rowi[j] = l_ij;
+              crank_cplx_float_mul_conj (
+                crank_mat_cplx_float_n_peek (l, i, k),
+                crank_mat_cplx_float_n_peek (l, j, k),
+                &ik_jk);
 
+              crank_cplx_float_sub_self (&l_ij, &ik_jk);
+            }
+          crank_cplx_float_div_self (&l_ij, crank_mat_cplx_float_n_peek (l,
+                                                                         j,
+                                                                         j));
+          crank_mat_cplx_float_n_set (l, i, j, &l_ij);
         }
 
 
       // Gets l[i, i] == a[i, i] - l[i, 0]**2 - ....
 
-      l_ij = crank_mat_float_n_get (a, i, i);
-
+      crank_mat_cplx_float_n_get (a, i, i, &l_ij);
       for (k = 0; k < i; k++)
-        l_ij -= l_rowi[k] * l_rowi[k];
+        {
+          CrankCplxFloat *ep = crank_mat_cplx_float_n_peek (l, i, k);
+          gfloat esq = crank_cplx_float_get_norm_sq (ep);
+
+          crank_cplx_float_subr_self (&l_ij, esq);
+        }
 
-      if (l_ij < 0.0f)
+      // Diagonal component should be real positive.
+      // as complex multiplication of its conjugate is always positive real.
+      //
+      // In other word, @l_ij is negative or imaginary, there is no cholesky
+      // decomposition.
+      if (l_ij.real < 0)
         {
-          crank_mat_float_n_fini (l);
+          crank_mat_cplx_float_n_fini (l);
           return FALSE;
         }
-      l_rowi[i] = sqrtf (l_ij);
+
+      crank_cplx_float_sqrt_self (&l_ij);
+      crank_mat_cplx_float_n_set (l, i, i, &l_ij);
     }
 
   return TRUE;
 }
 
+
 /**
- * crank_ldl_mat_float_n:
- * @a: A Symmetric atrix.
- * @l: (out): A Lower triangular matrix.
- * @d: (out): A Diagonal components.
- *
- * Performs LDLT decomposition on @a, which results in @l, @d, which is
- *
- * * @l.mul (D.mul (@l.transpose())) == @a.
- *
- * where D is diagonal matrix whose diagonal is @d.
- *
- * This implementation is differ classical LDLT, by returning diagonal
- * vector rather than diagonal matrix.
- *
- * LDLT avoids performing sqrt on diagonal elements, while multiplication happens
- * more than Cholskey Decomposition.
+ * crank_gram_schmidt_mat_cplx_float_n:
+ * @a: A Matrix.
+ * @q: (out): A Resulting Orthogonal Matrix.
+ * @r: (out): The upper triangular.
  *
- * Time: O((@a->rn)<superscript>3</superscript>)
+ * Gets QR Decomposition by Gram Schmidt process.
  *
- * Returns: Whether cholesky decomposition performed on @a.
+ * Returns: %TRUE if @a has QR Decomposition.
  */
 gboolean
-crank_ldl_mat_float_n (CrankMatFloatN *a,
-                       CrankMatFloatN *l,
-                       CrankVecFloatN *d)
+crank_gram_schmidt_mat_cplx_float_n (CrankMatCplxFloatN *a,
+                                     CrankMatCplxFloatN *q,
+                                     CrankMatCplxFloatN *r)
 {
+  CrankVecCplxFloatN *e;
+
+  static CrankCplxFloat ZERO = {0.0f, 0.0f};
+
   guint i;
   guint j;
-  guint k;
 
-  CRANK_MAT_WARN_IF_NON_SQUARE_RET ("advmat", "ch-MatFloatN", a, FALSE);
+  g_return_val_if_fail (a != q, FALSE);
+  g_return_val_if_fail (a != r, FALSE);
+  CRANK_MAT_WARN_IF_NON_SQUARE_RET ("Advmat-MatCplxFloatN",
+                                    "gram-schmidt",
+                                    a,
+                                    FALSE);
 
-  crank_mat_float_n_init_fill (l, a->rn, a->rn, 0.0f);
-  crank_vec_float_n_init_fill (d, a->rn, 0.0f);
+  e = g_new (CrankVecCplxFloatN, a->rn);
+  crank_mat_cplx_float_n_init_fill (r, a->rn, a->rn, &ZERO);
 
-  // Proceed row by row.
   for (i = 0; i < a->rn; i++)
     {
-      gfloat *l_rowi  = crank_mat_float_n_get_rowp (l, i);
-      gfloat l_ij;
+      CrankVecCplxFloatN ac;
+      CrankVecCplxFloatN u;
+      CrankCplxFloat ii;
 
-      // Gets l[i, j] = ( a[i, j]
-      //                  - l[i,0] * l[j,0] * d[0]
-      //                  - l[i,1] * l[j,1] * d[1] ...) / d[j]
+      // u = a.col[i]
+      crank_mat_cplx_float_n_get_col (a, i, &ac);
+      crank_vec_cplx_float_n_copy (&ac, &u);
 
+      // u -= proj(a.col[i], e[0..(i-1)])
+      // r = a.col[i] dot e
       for (j = 0; j < i; j++)
         {
-          gfloat *l_rowj  = crank_mat_float_n_get_rowp (l, j);
-          l_ij = crank_mat_float_n_get (a, i, j);
+          CrankVecCplxFloatN proj;
+          CrankCplxFloat dot;
+          crank_vec_cplx_float_n_dot (&ac, e + j, &dot);
 
-          for (k = 0; k < j; k++)
-            l_ij -= l_rowi[k] * l_rowj[k] * d->data[k];
+          crank_vec_cplx_float_n_muls (e + j, &dot, &proj);
 
-          l_ij /= d->data[j];
-          l_rowi[j] = l_ij;
+          crank_vec_cplx_float_n_sub_self (&u, &proj);
+          crank_mat_cplx_float_n_set (r, j, i, &dot);
         }
 
+      // e[i] = u.unit
 
-      // Gets d[i] == a[i, i] - l[i, 0]**2 * d[0] - ....
+      crank_cplx_float_init (&ii, crank_vec_cplx_float_n_get_magn (&u), 0);
+      crank_mat_cplx_float_n_set (r, i, i, &ii);
+      crank_vec_cplx_float_n_unit (&u, e + i);
+      crank_vec_cplx_float_n_fini (&u);
+    }
 
-      l_ij = crank_mat_float_n_get (a, i, i);
-      for (k = 0; k < i; k++)
-        l_ij -= l_rowi[k] * l_rowi[k] * d->data[k];
+  crank_mat_cplx_float_n_init_col_arr (q, a->rn, e);
 
-      if (l_ij < 0.0f)
-        {
-          crank_mat_float_n_fini (l);
-          crank_vec_float_n_fini (d);
-          return FALSE;
-        }
-      d->data[i] = l_ij;
-      l_rowi[i] = 1.0f;
+  for (i = 0; i < a->rn; i++)
+    {
+      crank_vec_cplx_float_n_fini (e + i);
     }
+  g_free (e);
 
   return TRUE;
 }
 
 /**
- * crank_gram_schmidt_mat_float_n:
+ * crank_qr_householder_mat_cplx_float_n:
  * @a: A Matrix.
- * @q: (out): A Resulting Orthogonal Matrix.
- * @r: (out): The upper triangular.
- *
- * Gets QR Decomposition by Gram Schmidt process.
+ * @r: (out): A Lower triangular matrix.
  *
- * Time: O((@a->rn)<superscript>3</superscript>)
+ * Performs QR Decomposition by householder method.
  *
  * Returns: %TRUE if @a has QR Decomposition.
  */
 gboolean
-crank_gram_schmidt_mat_float_n (CrankMatFloatN *a,
-                                CrankMatFloatN *q,
-                                CrankMatFloatN *r)
+crank_qr_householder_mat_cplx_float_n (CrankMatCplxFloatN *a,
+                                       CrankMatCplxFloatN *r)
 {
-  CrankVecFloatN *e;
-
   guint i;
   guint j;
   guint k;
 
-  g_return_val_if_fail (a != q, FALSE);
-  g_return_val_if_fail (a != r, FALSE);
-  CRANK_MAT_WARN_IF_NON_SQUARE_RET ("Advmat-MatFloatN", "gram-schmidt", a,
-                                    FALSE);
-
-  e = g_new (CrankVecFloatN, a->rn);
-  crank_mat_float_n_init_fill (r, a->rn, a->rn, 0);
-
-  for (i = 0; i < a->rn; i++)
-    {
-      CrankVecFloatN ac;
-      CrankVecFloatN u;
-      gfloat umagn;
-
-      // u = a.col[i]
-      crank_mat_float_n_get_col (a, i, &ac);
-      crank_vec_float_n_copy (&ac, &u);
-
-      // u -= proj(a.col[i], e[0..(i-1)])
-      // r = a.col[i] dot e
-      for (j = 0; j < i; j++)
-        {
-          CrankVecFloatN proj;
-          gfloat dot;
-          dot = crank_vec_float_n_dot (e + j, &ac);
-
-          crank_vec_float_n_muls (e + j, dot, &proj);
-
-          crank_vec_float_n_sub_self (&u, &proj);
-          crank_mat_float_n_set (r, j, i, dot);
-
-          crank_vec_float_n_fini (&proj);
-        }
-
-      // e[i] = u.unit
-      umagn = crank_vec_float_n_get_magn (&u);
-      crank_mat_float_n_set (r, i, i, umagn);
-      crank_vec_float_n_divs (&u, umagn, e + i);
-      crank_vec_float_n_fini (&u);
-      crank_vec_float_n_fini (&ac);
-    }
-
-  crank_mat_float_n_init_col_arr (q, a->rn, e);
-
-  for (k = 0; k < a->rn; k++)
-    crank_vec_float_n_fini (e + k);
-  g_free (e);
-
-  return TRUE;
-}
-
-/**
- * crank_qr_householder_mat_float_n:
- * @a: A Matrix.
- * @r: (out): A Lower triangular matrix.
- *
- * Performs QR Decomposition by householder method.
+  CrankMatCplxFloatN pa = {0};
+  CrankMatCplxFloatN qi = {0};
+  CrankMatCplxFloatN qpai = {0};
+  CrankCplxFloat ancomp;
 
- * Time: O((@a->rn)<superscript>3</superscript>)
- *
- * Returns: %TRUE if @a has QR Decomposition.
- */
-gboolean
-crank_qr_householder_mat_float_n (CrankMatFloatN *a,
-                                  CrankMatFloatN *r)
-{
-  guint i;
-  guint j;
-  guint k;
+  static CrankCplxFloat ZERO = {0.0f, 0.0f};
 
-  CrankMatFloatN pa = {0};
-  CrankMatFloatN qi = {0};
-  CrankMatFloatN qpai = {0};
-  CrankVecFloatN an = {0};
 
   g_return_val_if_fail (a != r, FALSE);
-  CRANK_MAT_WARN_IF_NON_SQUARE_RET ("Advmat-MatFloatN", "gram-schmidt", a,
+  CRANK_MAT_WARN_IF_NON_SQUARE_RET ("Advmat-MatCplxFloatN",
+                                    "qr-householder",
+                                    a,
                                     FALSE);
 
   if (a->rn == 1)
     {
-      crank_mat_float_n_init (r, 0, 0,
-                              crank_mat_float_n_get (a, 0, 0));
+      crank_mat_cplx_float_n_init (r, 1, 1, &ZERO);
       return TRUE;
     }
 
 
   // Setup initial state.
-  crank_mat_float_n_copy (a, &pa);
-  crank_mat_float_n_init_fill (r, a->rn, a->rn, 0.0f);
+  crank_mat_cplx_float_n_copy (a, &pa);
+  crank_mat_cplx_float_n_init_fill (r, a->rn, a->rn, &ZERO);
 
   for (i = 0; i < a->rn - 1; i++)
     {
+      CrankVecCplxFloatN an;
+      CrankVecCplxFloatN u;
+      CrankCplxFloat factor;
+      CrankCplxFloat factor_a;
+      CrankCplxFloat factor_b;
+
       // Initialize an
-      crank_mat_float_n_get_col (&pa, 0, &an);
+      crank_mat_cplx_float_n_get_col (&pa, 0, &an);
+      crank_vec_cplx_float_n_copy (&an, &u);
 
-      crank_vec_float_n_set (&an, 0,
-                             crank_vec_float_n_get (&an, 0) -
-                             crank_vec_float_n_get_magn (&an));
+      crank_vec_cplx_float_n_get (&an, 0, &ancomp);
+      crank_cplx_float_subr_self (&ancomp,
+                                  crank_vec_cplx_float_n_get_magn (&an));
+      crank_vec_cplx_float_n_set (&u, 0, &ancomp);
 
-      crank_vec_float_n_unit_self (&an);
+      crank_vec_cplx_float_n_unit_self (&u);
 
       // Initialize qi
-      crank_mat_float_n_init_fill (&qi, a->rn - i, a->rn - i, 0.0f);
+      crank_mat_cplx_float_n_init_fill (&qi, a->rn - i, a->rn - i, &ZERO);
+
+      crank_vec_cplx_float_n_dot (&u, &an, &factor_a);
+      crank_vec_cplx_float_n_dot (&an, &u, &factor_b);
+
+      crank_cplx_float_div (&factor_a, &factor_b, &factor);
+      crank_cplx_float_addr_self (&factor, 1.0f);
+      crank_cplx_float_neg_self (&factor);
+
 
       for (j = 0; j < a->rn - i; j++)
         {
           for (k = 0; k < a->rn - i; k++)
             {
-              crank_mat_float_n_set (&qi, j, k,
-                                     -2 *
-                                     crank_vec_float_n_get (&an, j) *
-                                     crank_vec_float_n_get (&an, k));
+              CrankCplxFloat ujcomp;
+              CrankCplxFloat ukcomp;
+              CrankCplxFloat qicomp;
+              crank_vec_cplx_float_n_get (&u, j, &ujcomp);
+              crank_vec_cplx_float_n_get (&u, k, &ukcomp);
+              crank_cplx_float_mul_conj (&ujcomp, &ukcomp, &qicomp);
+              crank_cplx_float_mul_self (&qicomp, &factor);
+
+              crank_mat_cplx_float_n_set (&qi, j, k, &qicomp);
             }
 
-          crank_mat_float_n_set (&qi, j, j,
-                                 1 + crank_mat_float_n_get (&qi, j, j));
+          CrankCplxFloat qjcomp;
+
+          crank_mat_cplx_float_n_get (&qi, j, j, &qjcomp);
+          crank_cplx_float_addr_self (&qjcomp, 1.0f);
+          crank_mat_cplx_float_n_set (&qi, j, j, &qjcomp);
         }
 
-      crank_mat_float_n_mul (&qi, &pa, &qpai);
+      crank_mat_cplx_float_n_mul (&qi, &pa, &qpai);
 
       // Resulting row 0 of qpai is part of r
       // and rest part is next pa
       for (j = 0; j < a->rn - i; j++)
         {
-          crank_mat_float_n_set (r, i, i + j,
-                                 crank_mat_float_n_get (&qpai, 0, j));
+          crank_mat_cplx_float_n_set (r, i, i + j,
+                                      crank_mat_cplx_float_n_peek (&qpai, 0,
+                                                                   j));
         }
-      // FIXME: Replace slicing by other actions.
-      // Slicing requires allocation and copying.
-      crank_mat_float_n_slice (&qpai, 1, 1, qpai.rn, qpai.cn, &pa);
+      crank_mat_cplx_float_n_slice (&qpai, 1, 1, qpai.rn, qpai.cn, &pa);
+      crank_vec_cplx_float_n_fini (&an);
+      crank_vec_cplx_float_n_fini (&u);
     }
   // Fill last part of r
-  crank_mat_float_n_set(r, (a->rn - 1), (a->rn - 1),
-                        crank_mat_float_n_get (&qpai, 1, 1));
+  crank_mat_cplx_float_n_get (&qpai, 1, 1, &ancomp);
+  crank_cplx_float_init (&ancomp, crank_cplx_float_get_norm (&ancomp), 0.0f);
+
+  crank_mat_cplx_float_n_set(r, (a->rn - 1), (a->rn - 1), &ancomp);
 
-  crank_mat_float_n_fini (&pa);
-  crank_mat_float_n_fini (&qi);
-  crank_mat_float_n_fini (&qpai);
-  crank_vec_float_n_fini (&an);
+  crank_mat_cplx_float_n_fini (&pa);
+  crank_mat_cplx_float_n_fini (&qi);
+  crank_mat_cplx_float_n_fini (&qpai);
   return TRUE;
 }
 
+
+
 /**
- * crank_qr_givens_mat_float_n:
+ * crank_qr_givens_mat_cplx_float_n:
  * @a: A Matrix.
  * @r: (out): A Lower triangular matrix.
  *
  * Performs QR Decomposition by Givens rotation.
-
- * Time: O((@a->rn)<superscript>3</superscript>)
  *
  * Returns: %TRUE if @a has QR Decomposition.
  */
 gboolean
-crank_qr_givens_mat_float_n (CrankMatFloatN *a,
-                             CrankMatFloatN *r)
+crank_qr_givens_mat_cplx_float_n (CrankMatCplxFloatN *a,
+                                  CrankMatCplxFloatN *r)
 {
   guint i;
   guint j;
   guint k;
 
-  CrankMatFloatN pa = {0};
+  CrankMatCplxFloatN pa;
+  CrankCplxFloat last;
+
+
+  static CrankCplxFloat ZERO = {0.0f, 0.0f};
 
 
   g_return_val_if_fail (a != r, FALSE);
-  CRANK_MAT_WARN_IF_NON_SQUARE_RET ("Advmat-MatFloatN", "qr-givens", a, FALSE);
+  CRANK_MAT_WARN_IF_NON_SQUARE_RET ("Advmat-MatCplxFloatN",
+                                    "qr-givens",
+                                    a,
+                                    FALSE);
 
   if (a->rn == 1)
     {
-      crank_mat_float_n_init (r, 1, 1,
-                              crank_mat_float_n_get (a, 0, 0));
+      crank_mat_cplx_float_n_init (r, 1, 1,
+                                   crank_mat_cplx_float_n_peek (a, 0, 0));
       return TRUE;
     }
 
-  crank_mat_float_n_init_fill (r, a->rn, a->rn, 0.0f);
-  crank_mat_float_n_copy (a, &pa);
+  crank_mat_cplx_float_n_init_fill (r, a->rn, a->rn, &ZERO);
+  crank_mat_cplx_float_n_copy (a, &pa);
 
   for (i = 0; i < a->rn - 1; i++)
     {
-      for (j = a->rn - 1; i < j; j--)
+      guint n = a->rn - i;
+
+      for (j = n - 1; 0 < j; j--)
         {
-          CrankVecFloat2 x = {
-            crank_mat_float_n_get (&pa, j - 1, i),
-            crank_mat_float_n_get (&pa, j, i)
-          };
+          CrankCplxFloat x;
+          CrankCplxFloat y;
+
+          gfloat magn;
+
+          crank_mat_cplx_float_n_get (&pa, j - 1, 0, &x);
+          crank_mat_cplx_float_n_get (&pa, j, 0, &y);
 
-          if ((x.x == 0) && (x.y == 0))
+          if (crank_cplx_float_is_zero (&x) || crank_cplx_float_is_zero (&y))
             {
-              crank_mat_float_n_fini (&pa);
-              crank_mat_float_n_fini (r);
+              crank_mat_cplx_float_n_fini (&pa);
+              crank_mat_cplx_float_n_fini (r);
 
               return FALSE;
             }
 
-          crank_vec_float2_unit_self (&x);
+          magn = sqrtf (crank_cplx_float_get_norm_sq (&x) +
+                        crank_cplx_float_get_norm_sq (&y) );
+
+          crank_cplx_float_divr_self (&x, magn);
+          crank_cplx_float_divr_self (&y, magn);
 
           // Multiplies Givens rotation matrix.
           //
           // We don't build up Full givens rotation matrix,
           // instead we apply this with sin, cos value.
-          for (k = i; k < a->rn; k++)
+          for (k = 0; k < n; k++)
             {
-              gfloat *paa = pa.data + (a->cn * (j - 1)) + k;
-              gfloat *pab = paa + (a->cn);
+              CrankCplxFloat e;
+              CrankCplxFloat f;
+
+              CrankCplxFloat ea;
+              CrankCplxFloat fa;
+              CrankCplxFloat addment;
+
+              crank_mat_cplx_float_n_get (&pa, j - 1, k, &e);
+              crank_mat_cplx_float_n_get (&pa, j, k, &f);
 
-              gfloat e = *paa;
-              gfloat f = *pab;
+              crank_cplx_float_mul_conj (&e, &x, &ea);
+              crank_cplx_float_mul_conj (&f, &y, &fa);
+              crank_cplx_float_add (&ea, &fa, &addment);
+
+              crank_mat_cplx_float_n_set (&pa, j - 1, k, &addment);
+
+              crank_cplx_float_mul (&e, &y, &ea);
+              crank_cplx_float_mul (&f, &x, &fa);
+              crank_cplx_float_sub (&fa, &ea, &addment);
 
-              *paa =  e * x.x + f * x.y;
-              *pab = -e * x.y + f * x.x;
+              crank_mat_cplx_float_n_set (&pa, j, k, &addment);
             }
         }
 
-      for (j = i; j < a->rn; j++)
+      for (j = 0; j < n; j++)
         {
-          crank_mat_float_n_set (r, i, j,
-                                 crank_mat_float_n_get (&pa, i, j));
+          crank_mat_cplx_float_n_set (r, i, i + j,
+                                      crank_mat_cplx_float_n_peek (&pa, 0, j));
         }
+
+      crank_mat_cplx_float_n_slice (&pa, 1, 1, pa.rn, pa.cn, &pa);
     }
 
-  crank_mat_float_n_set (r, a->rn - 1, a->rn - 1, pa.data[(a->rn * a->rn) - 1]);
+  crank_cplx_float_init (&last, crank_cplx_float_get_norm (pa.data + 0), 0.0f);
+
+  crank_mat_cplx_float_n_set (r, a->rn - 1, a->rn - 1, &last);
 
-  crank_mat_float_n_fini (&pa);
+  crank_mat_cplx_float_n_fini (&pa);
 
   return TRUE;
 }
 
+
+//////// Documentations ////////////////////////////////////////////////////////
+
 /**
- * crank_eval_power_mat_float_n:
- * @a: A Matrix.
- * @b: (nullable): A Seed vector.
- * @evec: (optional) (out): Associated eigenvector.
+ * crank_lu_mat_float_n:
+ * @a: A Square matrix.
+ * @l: (out): Lower triangular factor.
+ * @u: (out): Upper triangular factor, whose all diagonal components are 1.
  *
- * Gets a eigenvalue of given matrix, by power method.
+ * Try to get LU decomposition of @a.
  *
- * The returned value is most dominent eigenvalue whose associated eigenvector
- * is not orthogonal to seed vector.
+ * This implementation uses Crout's Method. So all diagonal elements of @u will
+ * be 1.
  *
- * If it failed to convergent, it returns NaN.
+ * Note that this does not perform pivoting. If pivoting is required, then use
+ * crank_lu_p_mat_float_n().
  *
- * If @b is %NULL, this uses first column as seed.
+ * This is performed by crank_lu_mat_float_n_self() on copy of @a.
  *
- * Returns: Most dominent eigenvalue whose eigenvector is not orthogonal to @b.
+ * Time: O((@a->rn)<superscript>3</superscript>)
+ *
+ * Returns: Whether @a has LU Decomposition.
  */
-gfloat
-crank_eval_power_mat_float_n (CrankMatFloatN *a,
-                              CrankVecFloatN *b,
-                              CrankVecFloatN *evec)
-{
-  CrankVecFloatN bs;
-  CrankVecFloatN bsmv;
-  gfloat magn = INFINITY;
 
-  gfloat dsp = INFINITY;
-  gfloat ds = INFINITY;
+/**
+ * crank_lu_mat_float_n_self:
+ * @a: (inout): A Square matrix.
+ *
+ * Try to get LU decomposition of @a, in place.
+ *
+ * Factors are packed into @a. Lower triangle of @a, including diagonal, holds
+ * L and strict upper triangle holds U, whose diagonal components are 1 and not
+ * stored.
+ *
+ * Columns are processed by panel, and rest of matrix is updated by matrix
+ * multiplication.
+ *
+ * If this fails, @a is left partially processed.
+ *
+ * Time: O((@a->rn)<superscript>3</superscript>)
+ *
+ * Returns: Whether @a has LU Decomposition.
+ */
 
-  gfloat eval = 0.0f;
+/**
+ * crank_lu_p_mat_float_n_self:
+ * @a: (inout): A Square matrix.
+ * @p: (out): Pivoting result.
+ *
+ * Try to get LU decomposition of @a with partial pivoting, in place.
+ *
+ * Factors are packed into @a like crank_lu_mat_float_n_self(). At each
+ * column, the row with largest absolute value is chosen as pivot, and rows are
+ * exchanged. As result, row i of factorized matrix is row @p[i] of @a.
+ *
+ * Unlike crank_lu_mat_float_n_self(), this fails only when @a is singular.
+ *
+ * If this fails, @a is left partially processed, and @p is not set.
+ *
+ * Time: O((@a->rn)<superscript>3</superscript>)
+ *
+ * Returns: Whether @a is non-singular.
+ */
 
-  CrankVecFloatN diff;
+/**
+ * crank_lu_p_mat_float_n:
+ * @a: A Square matrix.
+ * @p: (out): Pivoting result.
+ * @l: (out): Lower triangular factor.
+ * @u: (out): Upper triangular factor, whose all diagonal components are 1.
+ *
+ * Try to get LU decomposition of @a, with pivoting.
+ *
+ * Sometimes, some matrices are not able to be factorized, even not being
+ * singular matrices. In this case, pivoting enables these matrices to be
+ * decomposited.
+ *
+ * Generally, the decompositions are expressed with permutation matrices, but
+ * in this function, the pivot result is returned as #CrankPermutation.
+ *
+ * For implementation detail, please see crank_lu_mat_float_n().
+ *
+ * Time: O((@a->rn)<superscript>3</superscript>)
+ *
+ * Returns: Whether @a has LU Decomposition.
+ */
 
-  CRANK_MAT_WARN_IF_NON_SQUARE_RET ("Advmat-MatFloatN", "power-method", a,
-                                    0.0f);
+/**
+ * crank_lu_float_n_init:
+ * @lu: (out): A Factorization.
+ * @a: A Square matrix.
+ *
+ * Factorizes @a with crank_lu_p_mat_float_n_self() on copy of @a.
+ *
+ * If @a is singular, @lu is not initialized.
+ *
+ * Time: O((@a->rn)<superscript>3</superscript>)
+ *
+ * Returns: Whether @a is non-singular.
+ */
 
-  if (b != NULL)
-    crank_vec_float_n_copy (b, &bs);
-  else
-    crank_mat_float_n_get_col (a, 0, &bs);
+/**
+ * crank_lu_float_n_copy:
+ * @lu: A Factorization.
+ * @other: (out): A Factorization to copy to.
+ *
+ * Copies a factorization.
+ */
 
+/**
+ * crank_lu_float_n_dup:
+ * @lu: A Factorization.
+ *
+ * Allocates and copies a factorization.
+ *
+ * Returns: (transfer full): Newly allocated factorization. Free with
+ *     crank_lu_float_n_free().
+ */
 
+/**
+ * crank_lu_float_n_fini:
+ * @lu: A Factorization.
+ *
+ * Releases resources of a factorization.
+ */
 
-  do
-    {
-      dsp = ds;
-      crank_vec_float_n_copy (&bs, &diff);
+/**
+ * crank_lu_float_n_free:
+ * @lu: A Factorization.
+ *
+ * Frees an allocated factorization.
+ */
 
-      // Iterate: b = (a * b) / (a * b).magn
-      // bsmv = a * bs
-      // bs = bsmv unit.
+/**
+ * crank_lu_float_n_get_size:
+ * @lu: A Factorization.
+ *
+ * Gets size of factorized matrix.
+ *
+ * Returns: Number of rows of factorized matrix.
+ */
 
-      crank_mat_float_n_mulv (a, &bs, &bsmv);
-      crank_vec_float_n_unit (&bsmv, &bs);
-      crank_vec_float_n_fini (&bsmv);
+/**
+ * crank_lu_float_n_get_det:
+ * @lu: A Factorization.
+ *
+ * Gets determinant of factorized matrix, from diagonal components of L.
+ *
+ * Time: O(n)
+ *
+ * Returns: Determinant of factorized matrix.
+ */
 
-      //Gets a eigen value.
-      // lambda = b * a * b / (b.magn)
-      //
-      // As b is normalized, b.magn == 1
-      //
-      // bsmv = a * bs
-      // eval = bs dot bsmv
+/**
+ * crank_lu_float_n_solve:
+ * @lu: A Factorization.
+ * @b: A Vector.
+ * @x: (out): A Vector to store solution.
+ *
+ * Solves A @x = @b, by forward and backward substitution.
+ *
+ * Time: O(n<superscript>2</superscript>)
+ */
 
-      crank_mat_float_n_mulv (a, &bs, &bsmv);
-      eval = crank_vec_float_n_dot (&bs, &bsmv);
+/**
+ * crank_lu_float_n_solve_multi:
+ * @lu: A Factorization.
+ * @b: A Matrix, whose columns are right hand sides.
+ * @x: (out): A Matrix to store solutions.
+ *
+ * Solves A @x = @b, for all columns of @b at once.
+ *
+ * Time: O(n<superscript>2</superscript> m), where m is number of columns.
+ */
 
-      crank_vec_float_n_fini (&bsmv);
+/**
+ * crank_qr_float_n_init:
+ * @qr: (out): A Factorization.
+ * @a: A Matrix, which has at least as many rows as columns.
+ *
+ * Factorizes @a = Q R by blocked householder method, on copy of @a.
+ *
+ * Reflectors are stored in place of @a, and Q is not formed. Each panel of
+ * reflectors is kept in compact WY form, so Q<superscript>T</superscript> is
+ * applied by few passes over rows.
+ *
+ * If @a does not have full column rank, @qr is not initialized.
+ *
+ * Time: O(m n<superscript>2</superscript>), where @a is m x n.
+ *
+ * Returns: Whether @a has full column rank.
+ */
 
-      crank_vec_float_n_sub_self (&diff, &bs);
+/**
+ * crank_qr_float_n_copy:
+ * @qr: A Factorization.
+ * @other: (out): A Factorization to copy to.
+ *
+ * Copies a factorization.
+ */
 
-      ds = crank_vec_float_n_get_magn_sq (&diff);
+/**
+ * crank_qr_float_n_dup:
+ * @qr: A Factorization.
+ *
+ * Allocates and copies a factorization.
+ *
+ * Returns: (transfer full): Newly allocated factorization. Free with
+ *     crank_qr_float_n_free().
+ */
 
-      if (dsp < ds)
-        {
-          crank_vec_float_n_fini (&bs);
-          return NAN;
-        }
-    }
-  while (0.0000001f < (dsp - ds));
+/**
+ * crank_qr_float_n_fini:
+ * @qr: A Factorization.
+ *
+ * Releases resources of a factorization.
+ */
 
-  if (ds > 0.0000001f)
-    {
-      if (evec != NULL)
-        crank_vec_float_n_init_arr_take (evec, 0, NULL);
-      crank_vec_float_n_fini (&bs);
-      return NAN;
-    }
-  else
-    {
-      guint i;
+/**
+ * crank_qr_float_n_free:
+ * @qr: A Factorization.
+ *
+ * Frees an allocated factorization.
+ */
 
-      if (evec != NULL)
-        crank_vec_float_n_copy (&bs, evec);
+/**
+ * crank_qr_float_n_get_row_size:
+ * @qr: A Factorization.
+ *
+ * Gets number of rows of factorized matrix.
+ *
+ * Returns: Number of rows of factorized matrix.
+ */
 
-      crank_vec_float_n_fini (&bs);
-      crank_vec_float_n_fini (&bsmv);
+/**
+ * crank_qr_float_n_get_col_size:
+ * @qr: A Factorization.
+ *
+ * Gets number of columns of factorized matrix.
+ *
+ * Returns: Number of columns of factorized matrix.
+ */
 
-      return eval;
-    }
-}
+/**
+ * crank_qr_float_n_get_r:
+ * @qr: A Factorization.
+ * @r: (out): A Upper triangular matrix.
+ *
+ * Gets R factor, which is n x n for m x n matrix.
+ */
 
 /**
- * crank_eval_qr_mat_float_n:
- * @a: A Matrix.
- * @evals: (out): A Vector contains eigenvalues.
+ * crank_qr_float_n_get_q:
+ * @qr: A Factorization.
+ * @q: (out): A Matrix with orthonormal columns.
  *
- * Eigenvalues are calculated by QR Algorithm; If QR Decompisition is not
- * possible, an 0-sized vector is returned.
+ * Gets first n columns of Q, which is m x n for m x n matrix. This is only
+ * needed when Q itself is wanted, as crank_qr_float_n_mul_qt() and
+ * crank_qr_float_n_solve() do not form Q.
  *
- * If the matrix has complex eigenvalues, this function will fill NAN in that
- * place.
+ * Time: O(m n<superscript>2</superscript>)
  */
-void
-crank_eval_qr_mat_float_n (CrankMatFloatN *a,
-                           CrankVecFloatN *evals)
-{
-  CrankMatFloatN ai;
-  CrankMatFloatN qi;
-  CrankMatFloatN ri;
 
-  CrankVecFloatN offdiag;
-  CrankVecBoolN nonconv;
-  gboolean cont;
+/**
+ * crank_qr_float_n_mul_qt:
+ * @qr: A Factorization.
+ * @b: A Vector with m elements.
+ * @r: (out): A Vector to store Q<superscript>T</superscript> @b.
+ *
+ * Applies Q<superscript>T</superscript> to @b, without forming Q.
+ *
+ * Time: O(m n)
+ */
 
-  guint i;
-  guint j;
+/**
+ * crank_qr_float_n_mul_qt_multi:
+ * @qr: A Factorization.
+ * @b: A Matrix with m rows.
+ * @r: (out): A Matrix to store Q<superscript>T</superscript> @b.
+ *
+ * Applies Q<superscript>T</superscript> to all columns of @b, without forming
+ * Q.
+ *
+ * Time: O(m n k), where k is number of columns of @b.
+ */
 
-  CRANK_MAT_WARN_IF_NON_SQUARE ("Advmat-MatFloatN", "qr-iteration", a);
+/**
+ * crank_qr_float_n_mul_q:
+ * @qr: A Factorization.
+ * @b: A Vector with m elements.
+ * @r: (out): A Vector to store Q @b.
+ *
+ * Applies Q to @b, without forming Q.
+ *
+ * Time: O(m n)
+ */
 
-  crank_vec_float_n_init_fill (&offdiag, a->rn - 1, INFINITY);
-  crank_vec_bool_n_init_fill (&nonconv, a->rn - 1, FALSE);
+/**
+ * crank_qr_float_n_mul_q_multi:
+ * @qr: A Factorization.
+ * @b: A Matrix with m rows.
+ * @r: (out): A Matrix to store Q @b.
+ *
+ * Applies Q to all columns of @b, without forming Q.
+ *
+ * Time: O(m n k), where k is number of columns of @b.
+ */
 
-  cont = TRUE;
+/**
+ * crank_qr_float_n_solve:
+ * @qr: A Factorization.
+ * @b: A Vector with m elements.
+ * @x: (out): A Vector to store solution, with n elements.
+ *
+ * Solves least squares problem, which minimizes |A @x - @b|. This applies
+ * Q<superscript>T</superscript> to @b, and solves R @x = (Q<superscript>T</superscript> @b)
+ * by backward substitution.
+ *
+ * If A is square, this solves A @x = @b.
+ *
+ * Time: O(m n)
+ */
 
-  crank_mat_float_n_copy (a, &ai);
+/**
+ * crank_qr_float_n_solve_multi:
+ * @qr: A Factorization.
+ * @b: A Matrix with m rows, whose columns are right hand sides.
+ * @x: (out): A Matrix to store solutions, with n rows.
+ *
+ * Solves least squares problems for all columns of @b at once.
+ *
+ * Time: O(m n k), where k is number of columns of @b.
+ */
 
-  while (cont)
-    {
-      if (!crank_gram_schmidt_mat_float_n (&ai, &qi, &ri))
-        {
-          crank_mat_float_n_fini (&ai);
-          crank_vec_float_n_fini (evals);
-          return;
-        }
+/**
+ * crank_ch_mat_float_n:
+ * @a: A Symmetric matrix.
+ * @l: (out): A Lower triangular matrix.
+ *
+ * Performs cholesky decomposition on @a, which results in @l, which meets a
+ * statement below.
+ *
+ * * @l.mul (@l.transpose()) == @a.
+ *
+ * This is performed by crank_ch_mat_float_n_self() on copy of @a.
+ *
+ * Time: O((@a->rn)<superscript>3</superscript>)
+ *
+ * Returns: Whether cholesky decomposition performed on @a.
+ */
 
-      crank_mat_float_n_fini (&ai);
-      crank_mat_float_n_mul (&ri, &qi, &ai);
+/**
+ * crank_ch_mat_float_n_self:
+ * @a: (inout): A Symmetric matrix.
+ *
+ * Performs cholesky decomposition on @a in place. @a becomes lower triangular
+ * factor.
+ *
+ * Only lower triangle of @a is read. Columns are processed by panel, and rest
+ * of matrix is updated by matrix multiplication. Small matrices are processed
+ * by crank_mat_float_fixed_ch().
+ *
+ * If this fails, @a is left partially processed.
+ *
+ * Time: O((@a->rn)<superscript>3</superscript>)
+ *
+ * Returns: Whether cholesky decomposition performed on @a.
+ */
 
-      cont = FALSE;
-      for (i = 0; i < a->rn; i++)
-        {
-          for (j = 0; j + 1 < i; j++)
-            {
-              gfloat e = crank_mat_float_n_get (&ai, i, j);
-              // Checks for elements are smaller than reasonably small value.
-              //TODO: Make a way to adjust this value.
-
-              if (e < -0.0001f || 0.0001f < e)
-                {
-                  cont = TRUE;
-                  break;
-                }
-            }
-          if (cont)
-            break;
-        }
+/**
+ * crank_ldl_mat_float_n:
+ * @a: A Symmetric atrix.
+ * @l: (out): A Lower triangular matrix.
+ * @d: (out): A Diagonal components.
+ *
+ * Performs LDLT decomposition on @a, which results in @l, @d, which is
+ *
+ * * @l.mul (D.mul (@l.transpose())) == @a.
+ *
+ * where D is diagonal matrix whose diagonal is @d.
+ *
+ * This implementation is differ classical LDLT, by returning diagonal
+ * vector rather than diagonal matrix.
+ *
+ * LDLT avoids performing sqrt on diagonal elements, while multiplication happens
+ * more than Cholskey Decomposition.
+ *
+ * This is performed by crank_ldl_mat_float_n_self() on copy of @a.
+ *
+ * Time: O((@a->rn)<superscript>3</superscript>)
+ *
+ * Returns: Whether cholesky decomposition performed on @a.
+ */
 
-      if (!cont)
-        {
-          for (i = 0; i < a->rn - 1; i++)
-            {
-              if (!crank_vec_bool_n_get (&nonconv, i))
-                {
-
-                  gfloat e = ABS (crank_mat_float_n_get (&ai, i + 1, i));
-
-                  if (crank_vec_float_n_get (&offdiag, i) < e)
-                    crank_vec_bool_n_set (&nonconv, i, TRUE);
-
-                  else
-                    {
-                      crank_vec_float_n_set (&offdiag, i, e);
-                      if (0.0001f < e)
-                        {
-                          cont = TRUE;
-                          break;
-                        }
-                    }
-                }
-            }
-        }
-    }
+/**
+ * crank_ldl_mat_float_n_self:
+ * @a: (inout): A Symmetric matrix.
+ * @d: (out): A Diagonal components.
+ *
+ * Performs LDLT decomposition on @a in place. @a becomes lower triangular
+ * factor, whose diagonal components are 1.
+ *
+ * Only lower triangle of @a is read. Columns are processed by panel, and rest
+ * of matrix is updated by matrix multiplication.
+ *
+ * If this fails, @a is left partially processed.
+ *
+ * Time: O((@a->rn)<superscript>3</superscript>)
+ *
+ * Returns: Whether cholesky decomposition performed on @a.
+ */
 
-  crank_mat_float_n_get_diag (&ai, evals);
+/**
+ * crank_gram_schmidt_mat_float_n:
+ * @a: A Matrix.
+ * @q: (out): A Resulting Orthogonal Matrix.
+ * @r: (out): The upper triangular.
+ *
+ * Gets QR Decomposition by Gram Schmidt process.
+ *
+ * Time: O((@a->rn)<superscript>3</superscript>)
+ *
+ * Returns: %TRUE if @a has QR Decomposition.
+ */
 
-  for (i = 0; i < a->rn - 1; i++)
-    {
-      if (crank_vec_bool_n_get (&nonconv, i))
-        {
-          crank_vec_float_n_set (evals, i, NAN);
-          crank_vec_float_n_set (evals, i + 1, NAN);
-          i++;
-        }
-    }
+/**
+ * crank_qr_householder_mat_float_n:
+ * @a: A Matrix.
+ * @r: (out): A Lower triangular matrix.
+ *
+ * Performs QR Decomposition by householder method.
 
-  crank_vec_bool_n_fini (&nonconv);
-  crank_mat_float_n_fini (&ai);
-  crank_mat_float_n_fini (&qi);
-  crank_mat_float_n_fini (&ri);
-}
+ * Time: O((@a->rn)<superscript>3</superscript>)
+ *
+ * Returns: %TRUE if @a has QR Decomposition.
+ */
+
+/**
+ * crank_qr_givens_mat_float_n:
+ * @a: A Matrix.
+ * @r: (out): A Lower triangular matrix.
+ *
+ * Performs QR Decomposition by Givens rotation.
 
+ * Time: O((@a->rn)<superscript>3</superscript>)
+ *
+ * Returns: %TRUE if @a has QR Decomposition.
+ */
 
 /**
- * crank_lu_mat_cplx_float_n:
+ * crank_eval_power_mat_float_n:
  * @a: A Matrix.
- * @l: (out): Lower triangular factor.
- * @u: (out): Upper triangular factor.
+ * @b: (nullable): A Seed vector.
+ * @evec: (optional) (out): Associated eigenvector.
  *
- * Try to get LU decomposition of @a.
+ * Gets a eigenvalue of given matrix, by power method.
  *
- * This implementation uses Crout's Method. So all diagonal elements of @u will
- * be 1.
+ * The returned value is most dominent eigenvalue whose associated eigenvector
+ * is not orthogonal to seed vector.
  *
- * Note that this does not perform pivoting. If pivoting is required, then use
- * crank_lu_p_mat_cplx_float_n().
+ * If it failed to convergent, it returns NaN.
  *
- * Returns: Whether @a has LU Decomposition.
+ * If @b is %NULL, this uses first column as seed.
+ *
+ * Returns: Most dominent eigenvalue whose eigenvector is not orthogonal to @b.
  */
-gboolean
-crank_lu_mat_cplx_float_n (CrankMatCplxFloatN *a,
-                           CrankMatCplxFloatN *l,
-                           CrankMatCplxFloatN *u)
-{
-  guint i;
-  guint j;
-  guint k;
 
-  guint n;
-
-  static CrankCplxFloat ZERO = {0, 0};
-  static CrankCplxFloat ONE = {1, 0};
+/**
+ * crank_eval_qr_mat_float_n:
+ * @a: A Matrix.
+ * @evals: (out): A Vector contains eigenvalues.
+ *
+ * Eigenvalues are calculated by QR Algorithm; If QR Decompisition is not
+ * possible, an 0-sized vector is returned.
+ *
+ * If the matrix has complex eigenvalues, this function will fill NAN in that
+ * place.
+ */
 
-  g_return_val_if_fail (a != l, FALSE);
-  g_return_val_if_fail (a != u, FALSE);
+/**
+ * crank_eval_sym_mat_float_n:
+ * @a: A Symmetric matrix.
+ * @evals: (out): A Vector to store eigenvalues, in ascending order.
+ * @evecs: (out) (optional): A Matrix to store eigenvectors as columns.
+ *
+ * Gets eigenvalues and eigenvectors of symmetric matrix.
+ *
+ * This uses crank_eval_sym_jacobi_mat_float_n() for small matrices, and
+ * crank_eval_sym_ql_mat_float_n() for others, with default limits.
+ *
+ * Returns: Whether the iteration converged.
+ */
 
-  CRANK_MAT_WARN_IF_NON_SQUARE_RET ("Advmat-MatCplxFloatN", "lu", a, FALSE);
-
-  n = a->rn;
-
-  if (n == 0)
-    return TRUE;
-
-  if (n == 1)
-    {
-      if (!crank_cplx_float_is_zero (a->data))
-        {
-          crank_mat_cplx_float_n_init (l, 1, 1, a->data + 0);
-          crank_mat_cplx_float_n_init_uc (u, 1, 1, 1.0f, 0.0f);
-          return TRUE;
-        }
-      // If a == [[0]] then a is singular and cannot be defactorized.
-      else
-        return FALSE;
-    }
-
-  crank_mat_cplx_float_n_init_fill (l, n, n, &ZERO);
-  crank_mat_cplx_float_n_init_fill (u, n, n, &ZERO);
-
-  for (i = 0; i < n; i++)
-    {
-      // l: column i
-      for (j = i; j < n; j++)
-        {
-          CrankCplxFloat sum = {0.0f, 0.0f};
-          CrankCplxFloat lpart;
-          CrankCplxFloat upart;
-          CrankCplxFloat lupart;
-          CrankCplxFloat apart;
-
-          for (k = 0; k < i; k++)
-            {
-              crank_mat_cplx_float_n_get (l, j, k, &lpart);
-              crank_mat_cplx_float_n_get (u, k, i, &upart);
-
-              crank_cplx_float_mul (&lpart, &upart, &lupart);
-              crank_cplx_float_add_self (&sum, &lupart);
-            }
-
-          crank_mat_cplx_float_n_get (a, j, i, &apart);
-          crank_cplx_float_sub_self (&apart, &sum);
-          crank_mat_cplx_float_n_set (l, j, i, &apart);
-        }
-
-
-      // u: row i
-      crank_mat_cplx_float_n_set (u, i, i, &ONE);
-      for (j = i + 1; j < n; j++)
-        {
-          CrankCplxFloat sum = {0.0f, 0.0f};
-          CrankCplxFloat lpart;
-          CrankCplxFloat upart;
-          CrankCplxFloat lupart;
-          CrankCplxFloat apart;
-
-          CrankCplxFloat ldpart;
+/**
+ * crank_eval_sym_ql_mat_float_n:
+ * @a: A Symmetric matrix.
+ * @evals: (out): A Vector to store eigenvalues, in ascending order.
+ * @evecs: (out) (optional): A Matrix to store eigenvectors as columns.
+ * @max_iter: Maximum count of iterations for each eigenvalue, or 0 for
+ *     default of 30.
+ * @tol: Relative tolerance of off-diagonal components, or 0 for machine
+ *     epsilon.
+ *
+ * Gets eigenvalues and eigenvectors of symmetric matrix.
+ *
+ * @a is reduced to tridiagonal form by Householder transformations, and the
+ * tridiagonal matrix is diagonalized by QL iteration with implicit shifts.
+ * Eigenvectors are accumulated from both steps. Only lower triangle of @a is
+ * referenced.
+ *
+ * If an eigenvalue does not converge in @max_iter iterations, this stops and
+ * returns %FALSE. @evals and @evecs are still set, with values at that point.
+ *
+ * Time: O((@a->rn)<superscript>3</superscript>)
+ *
+ * Returns: Whether the iteration converged.
+ */
 
-          crank_mat_cplx_float_n_get (l, i, i, &ldpart);
+/**
+ * crank_eval_sym_jacobi_mat_float_n:
+ * @a: A Symmetric matrix.
+ * @evals: (out): A Vector to store eigenvalues, in ascending order.
+ * @evecs: (out) (optional): A Matrix to store eigenvectors as columns.
+ * @max_sweep: Maximum count of sweeps, or 0 for default of 50.
+ * @tol: Relative tolerance of off-diagonal components, or 0 for machine
+ *     epsilon.
+ *
+ * Gets eigenvalues and eigenvectors of symmetric matrix, by cyclic Jacobi
+ * method.
+ *
+ * Each sweep annihilates all off-diagonal components by plane rotations. A
+ * component is skipped if it is smaller than @tol times Frobenius norm of @a,
+ * and iteration stops when a sweep skips all components. Only lower triangle
+ * of @a is referenced.
+ *
+ * This converges quadratically, and gives eigenvalues with good relative
+ * accuracy. But each sweep takes O((@a->rn)<superscript>3</superscript>), so
+ * this is preferred for small matrices.
+ *
+ * Returns: Whether the iteration converged.
+ */
 
-          if (crank_cplx_float_is_zero (&ldpart))
-            {
-              crank_mat_cplx_float_n_fini (l);
-              crank_mat_cplx_float_n_fini (u);
-              return FALSE;
-            }
+/**
+ * crank_svd_mat_float_n:
+ * @a: A Matrix.
+ * @u: (out) (optional): Left singular vectors, as columns.
+ * @s: (out): Singular values in descending order.
+ * @v: (out) (optional): Right singular vectors, as columns.
+ *
+ * Gets thin singular value decomposition @a = @u diag(@s) @v<superscript>T</superscript>,
+ * with default limits. See crank_svd_jacobi_mat_float_n().
+ *
+ * Returns: Whether the iteration converged.
+ */
 
-          for (k = 0; k < i; k++)
-            {
-              crank_mat_cplx_float_n_get (l, i, k, &lpart);
-              crank_mat_cplx_float_n_get (u, k, j, &upart);
-              crank_cplx_float_mul (&lpart, &upart, &lupart);
-              crank_cplx_float_add_self (&sum, &lupart);
-            }
+/**
+ * crank_svd_jacobi_mat_float_n:
+ * @a: A Matrix.
+ * @u: (out) (optional): Left singular vectors, as columns.
+ * @s: (out): Singular values in descending order.
+ * @v: (out) (optional): Right singular vectors, as columns.
+ * @max_sweep: Maximum count of sweeps, or 0 for default of 50.
+ * @tol: Tolerance of cosine between columns, or 0 for machine epsilon.
+ *
+ * Gets thin singular value decomposition @a = @u diag(@s) @v<superscript>T</superscript>,
+ * by one-sided Jacobi method.
+ *
+ * For @a of m x n with m >= n, @u is m x n, @s has n elements, and @v is
+ * n x n. If m < n, transpose of @a is decomposed and factors are swapped, so
+ * @u is m x m, @s has m elements and @v is n x m.
+ *
+ * Pairs of columns are rotated until all columns are orthogonal, that is,
+ * cosine between every pair is below @tol. Columns are held as rows of
+ * workspace, so rotations run over contiguous memory.
+ *
+ * If a singular value is 0, corresponding column of @u is 0.
+ *
+ * Returns: Whether the iteration converged.
+ */
 
-          crank_mat_cplx_float_n_get (a, i, j, &apart);
-          crank_cplx_float_sub_self (&apart, &sum);
-          crank_cplx_float_div_self (&apart, &ldpart);
-          crank_mat_cplx_float_n_set (u, i, j, &apart);
-        }
-    }
+/**
+ * crank_lu_mat_double_n:
+ * @a: A Square matrix.
+ * @l: (out): Lower triangular factor.
+ * @u: (out): Upper triangular factor, whose all diagonal components are 1.
+ *
+ * Try to get LU decomposition of @a.
+ *
+ * This implementation uses Crout's Method. So all diagonal elements of @u will
+ * be 1.
+ *
+ * Note that this does not perform pivoting. If pivoting is required, then use
+ * crank_lu_p_mat_double_n().
+ *
+ * This is performed by crank_lu_mat_double_n_self() on copy of @a.
+ *
+ * Time: O((@a->rn)<superscript>3</superscript>)
+ *
+ * Returns: Whether @a has LU Decomposition.
+ */
 
-  return TRUE;
-}
+/**
+ * crank_lu_mat_double_n_self:
+ * @a: (inout): A Square matrix.
+ *
+ * Try to get LU decomposition of @a, in place.
+ *
+ * Factors are packed into @a. Lower triangle of @a, including diagonal, holds
+ * L and strict upper triangle holds U, whose diagonal components are 1 and not
+ * stored.
+ *
+ * Columns are processed by panel, and rest of matrix is updated by matrix
+ * multiplication.
+ *
+ * If this fails, @a is left partially processed.
+ *
+ * Time: O((@a->rn)<superscript>3</superscript>)
+ *
+ * Returns: Whether @a has LU Decomposition.
+ */
 
+/**
+ * crank_lu_p_mat_double_n_self:
+ * @a: (inout): A Square matrix.
+ * @p: (out): Pivoting result.
+ *
+ * Try to get LU decomposition of @a with partial pivoting, in place.
+ *
+ * Factors are packed into @a like crank_lu_mat_double_n_self(). At each
+ * column, the row with largest absolute value is chosen as pivot, and rows are
+ * exchanged. As result, row i of factorized matrix is row @p[i] of @a.
+ *
+ * Unlike crank_lu_mat_double_n_self(), this fails only when @a is singular.
+ *
+ * If this fails, @a is left partially processed, and @p is not set.
+ *
+ * Time: O((@a->rn)<superscript>3</superscript>)
+ *
+ * Returns: Whether @a is non-singular.
+ */
 
 /**
- * crank_lu_p_mat_cplx_float_n:
- * @a: A Matrix.
+ * crank_lu_p_mat_double_n:
+ * @a: A Square matrix.
  * @p: (out): Pivoting result.
  * @l: (out): Lower triangular factor.
- * @u: (out): Upper triangular factor.
+ * @u: (out): Upper triangular factor, whose all diagonal components are 1.
  *
  * Try to get LU decomposition of @a, with pivoting.
  *
@@ -1038,458 +1589,501 @@ crank_lu_mat_cplx_float_n (CrankMatCplxFloatN *a,
  * Generally, the decompositions are expressed with permutation matrices, but
  * in this function, the pivot result is returned as #CrankPermutation.
  *
- * For implementation detail, please see crank_lu_mat_float_n().
+ * For implementation detail, please see crank_lu_mat_double_n().
+ *
+ * Time: O((@a->rn)<superscript>3</superscript>)
  *
  * Returns: Whether @a has LU Decomposition.
  */
-gboolean
-crank_lu_p_mat_cplx_float_n (CrankMatCplxFloatN *a,
-                             CrankPermutation   *p,
-                             CrankMatCplxFloatN *l,
-                             CrankMatCplxFloatN *u)
-{
-  guint i;
-  guint j;
-  CrankMatCplxFloatN na;
 
-  g_return_val_if_fail (a != l, FALSE);
-  g_return_val_if_fail (a != u, FALSE);
+/**
+ * crank_lu_double_n_init:
+ * @lu: (out): A Factorization.
+ * @a: A Square matrix.
+ *
+ * Factorizes @a with crank_lu_p_mat_double_n_self() on copy of @a.
+ *
+ * If @a is singular, @lu is not initialized.
+ *
+ * Time: O((@a->rn)<superscript>3</superscript>)
+ *
+ * Returns: Whether @a is non-singular.
+ */
 
-  CRANK_MAT_WARN_IF_NON_SQUARE_RET ("Advmat-MatCplxFloatN", "lu-pivot", a,
-                                    FALSE);
+/**
+ * crank_lu_double_n_copy:
+ * @lu: A Factorization.
+ * @other: (out): A Factorization to copy to.
+ *
+ * Copies a factorization.
+ */
 
-  // Do pivoting.
-  // Maximaze diagnoal component.
-  crank_permutation_init_identity (p, a->rn);
+/**
+ * crank_lu_double_n_dup:
+ * @lu: A Factorization.
+ *
+ * Allocates and copies a factorization.
+ *
+ * Returns: (transfer full): Newly allocated factorization. Free with
+ *     crank_lu_double_n_free().
+ */
 
-  for (i = 0; i < a->rn; i++)
-    {
-      CrankCplxFloat max;
-      gfloat max_normsq;
-      guint max_index = i;
+/**
+ * crank_lu_double_n_fini:
+ * @lu: A Factorization.
+ *
+ * Releases resources of a factorization.
+ */
 
-      crank_mat_cplx_float_n_get (a,  crank_permutation_get (p, i), i, &max);
-      max_normsq = crank_cplx_float_get_norm_sq (&max);
+/**
+ * crank_lu_double_n_free:
+ * @lu: A Factorization.
+ *
+ * Frees an allocated factorization.
+ */
 
-      for (j = i + 1; j < a->rn; j++)
-        {
-          CrankCplxFloat cur;
-          gfloat cur_normsq;
+/**
+ * crank_lu_double_n_get_size:
+ * @lu: A Factorization.
+ *
+ * Gets size of factorized matrix.
+ *
+ * Returns: Number of rows of factorized matrix.
+ */
 
-          crank_mat_cplx_float_n_get (a,
-                                      crank_permutation_get (p, j), i, &cur);
-          cur_normsq = crank_cplx_float_get_norm_sq (&cur);
-          if (max_normsq < cur_normsq)
-            {
-              max_index = j;
-              max_normsq = cur_normsq;
-            }
-        }
+/**
+ * crank_lu_double_n_get_det:
+ * @lu: A Factorization.
+ *
+ * Gets determinant of factorized matrix, from diagonal components of L.
+ *
+ * Time: O(n)
+ *
+ * Returns: Determinant of factorized matrix.
+ */
 
-      crank_permutation_swap (p, i, max_index);
-    }
+/**
+ * crank_lu_double_n_solve:
+ * @lu: A Factorization.
+ * @b: A Vector.
+ * @x: (out): A Vector to store solution.
+ *
+ * Solves A @x = @b, by forward and backward substitution.
+ *
+ * Time: O(n<superscript>2</superscript>)
+ */
 
-  // Do LU Decomposition.
-  crank_mat_cplx_float_n_shuffle_row (a, p, &na);
-  return crank_lu_mat_cplx_float_n (&na, l, u);
-}
+/**
+ * crank_lu_double_n_solve_multi:
+ * @lu: A Factorization.
+ * @b: A Matrix, whose columns are right hand sides.
+ * @x: (out): A Matrix to store solutions.
+ *
+ * Solves A @x = @b, for all columns of @b at once.
+ *
+ * Time: O(n<superscript>2</superscript> m), where m is number of columns.
+ */
 
 /**
- * crank_ch_mat_cplx_float_n:
- * @a: A Matrix.
- * @l: (out): A Lower triangular matrix.
+ * crank_qr_double_n_init:
+ * @qr: (out): A Factorization.
+ * @a: A Matrix, which has at least as many rows as columns.
  *
- * Performs cholesky decomposition on @a, which results in @l, which
+ * Factorizes @a = Q R by blocked householder method, on copy of @a.
  *
- * * @l.mul (@l.star()) == @a.
+ * Reflectors are stored in place of @a, and Q is not formed. Each panel of
+ * reflectors is kept in compact WY form, so Q<superscript>T</superscript> is
+ * applied by few passes over rows.
  *
- * Returns: Whether cholesky decomposition performed on @a.
+ * If @a does not have full column rank, @qr is not initialized.
+ *
+ * Time: O(m n<superscript>2</superscript>), where @a is m x n.
+ *
+ * Returns: Whether @a has full column rank.
  */
-gboolean
-crank_ch_mat_cplx_float_n (CrankMatCplxFloatN *a,
-                           CrankMatCplxFloatN *l)
-{
-  guint i;
-  guint j;
-  guint k;
-
-  CRANK_MAT_WARN_IF_NON_SQUARE_RET ("advmat", "ch-MatCplxFloatN", a, FALSE);
 
-  crank_mat_cplx_float_n_init_fill_uc (l, a->rn, a->rn, 0.0f, 0.0f);
+/**
+ * crank_qr_double_n_copy:
+ * @qr: A Factorization.
+ * @other: (out): A Factorization to copy to.
+ *
+ * Copies a factorization.
+ */
 
-  // Proceed row by row.
-  for (i = 0; i < a->rn; i++)
-    {
-      CrankCplxFloat l_ij;
+/**
+ * crank_qr_double_n_dup:
+ * @qr: A Factorization.
+ *
+ * Allocates and copies a factorization.
+ *
+ * Returns: (transfer full): Newly allocated factorization. Free with
+ *     crank_qr_double_n_free().
+ */
 
-      // Gets l[i, j] = (a[i, j] - l[i,0]*l[j,0] - l[i,1]*l[j,1] ...) / l[j,j]
+/**
+ * crank_qr_double_n_fini:
+ * @qr: A Factorization.
+ *
+ * Releases resources of a factorization.
+ */
 
-      for (j = 0; j < i; j++)
-        {
-          gfloat d;
+/**
+ * crank_qr_double_n_free:
+ * @qr: A Factorization.
+ *
+ * Frees an allocated factorization.
+ */
 
-          crank_mat_cplx_float_n_get (a, i, j, &l_ij);
-          for (k = 0; k < j; k++)
-            {
-              CrankCplxFloat ik_jk;
+/**
+ * crank_qr_double_n_get_row_size:
+ * @qr: A Factorization.
+ *
+ * Gets number of rows of factorized matrix.
+ *
+ * Returns: Number of rows of factorized matrix.
+ */
 
-              crank_cplx_float_mul_conj (
-                crank_mat_cplx_float_n_peek (l, i, k),
-                crank_mat_cplx_float_n_peek (l, j, k),
-                &ik_jk);
+/**
+ * crank_qr_double_n_get_col_size:
+ * @qr: A Factorization.
+ *
+ * Gets number of columns of factorized matrix.
+ *
+ * Returns: Number of columns of factorized matrix.
+ */
 
-              crank_cplx_float_sub_self (&l_ij, &ik_jk);
-            }
-          crank_cplx_float_div_self (&l_ij, crank_mat_cplx_float_n_peek (l,
-                                                                         j,
-                                                                         j));
-          crank_mat_cplx_float_n_set (l, i, j, &l_ij);
-        }
+/**
+ * crank_qr_double_n_get_r:
+ * @qr: A Factorization.
+ * @r: (out): A Upper triangular matrix.
+ *
+ * Gets R factor, which is n x n for m x n matrix.
+ */
 
+/**
+ * crank_qr_double_n_get_q:
+ * @qr: A Factorization.
+ * @q: (out): A Matrix with orthonormal columns.
+ *
+ * Gets first n columns of Q, which is m x n for m x n matrix. This is only
+ * needed when Q itself is wanted, as crank_qr_double_n_mul_qt() and
+ * crank_qr_double_n_solve() do not form Q.
+ *
+ * Time: O(m n<superscript>2</superscript>)
+ */
 
-      // Gets l[i, i] == a[i, i] - l[i, 0]**2 - ....
+/**
+ * crank_qr_double_n_mul_qt:
+ * @qr: A Factorization.
+ * @b: A Vector with m elements.
+ * @r: (out): A Vector to store Q<superscript>T</superscript> @b.
+ *
+ * Applies Q<superscript>T</superscript> to @b, without forming Q.
+ *
+ * Time: O(m n)
+ */
 
-      crank_mat_cplx_float_n_get (a, i, i, &l_ij);
-      for (k = 0; k < i; k++)
-        {
-          CrankCplxFloat *ep = crank_mat_cplx_float_n_peek (l, i, k);
-          gfloat esq = crank_cplx_float_get_norm_sq (ep);
+/**
+ * crank_qr_double_n_mul_qt_multi:
+ * @qr: A Factorization.
+ * @b: A Matrix with m rows.
+ * @r: (out): A Matrix to store Q<superscript>T</superscript> @b.
+ *
+ * Applies Q<superscript>T</superscript> to all columns of @b, without forming
+ * Q.
+ *
+ * Time: O(m n k), where k is number of columns of @b.
+ */
 
-          crank_cplx_float_subr_self (&l_ij, esq);
-        }
+/**
+ * crank_qr_double_n_mul_q:
+ * @qr: A Factorization.
+ * @b: A Vector with m elements.
+ * @r: (out): A Vector to store Q @b.
+ *
+ * Applies Q to @b, without forming Q.
+ *
+ * Time: O(m n)
+ */
 
-      // Diagonal component should be real positive.
-      // as complex multiplication of its conjugate is always positive real.
-      //
-      // In other word, @l_ij is negative or imaginary, there is no cholesky
-      // decomposition.
-      if (l_ij.real < 0)
-        {
-          crank_mat_cplx_float_n_fini (l);
-          return FALSE;
-        }
+/**
+ * crank_qr_double_n_mul_q_multi:
+ * @qr: A Factorization.
+ * @b: A Matrix with m rows.
+ * @r: (out): A Matrix to store Q @b.
+ *
+ * Applies Q to all columns of @b, without forming Q.
+ *
+ * Time: O(m n k), where k is number of columns of @b.
+ */
 
-      crank_cplx_float_sqrt_self (&l_ij);
-      crank_mat_cplx_float_n_set (l, i, i, &l_ij);
-    }
+/**
+ * crank_qr_double_n_solve:
+ * @qr: A Factorization.
+ * @b: A Vector with m elements.
+ * @x: (out): A Vector to store solution, with n elements.
+ *
+ * Solves least squares problem, which minimizes |A @x - @b|. This applies
+ * Q<superscript>T</superscript> to @b, and solves R @x = (Q<superscript>T</superscript> @b)
+ * by backward substitution.
+ *
+ * If A is square, this solves A @x = @b.
+ *
+ * Time: O(m n)
+ */
 
-  return TRUE;
-}
+/**
+ * crank_qr_double_n_solve_multi:
+ * @qr: A Factorization.
+ * @b: A Matrix with m rows, whose columns are right hand sides.
+ * @x: (out): A Matrix to store solutions, with n rows.
+ *
+ * Solves least squares problems for all columns of @b at once.
+ *
+ * Time: O(m n k), where k is number of columns of @b.
+ */
 
+/**
+ * crank_ch_mat_double_n:
+ * @a: A Symmetric matrix.
+ * @l: (out): A Lower triangular matrix.
+ *
+ * Performs cholesky decomposition on @a, which results in @l, which meets a
+ * statement below.
+ *
+ * * @l.mul (@l.transpose()) == @a.
+ *
+ * This is performed by crank_ch_mat_double_n_self() on copy of @a.
+ *
+ * Time: O((@a->rn)<superscript>3</superscript>)
+ *
+ * Returns: Whether cholesky decomposition performed on @a.
+ */
 
 /**
- * crank_gram_schmidt_mat_cplx_float_n:
+ * crank_ch_mat_double_n_self:
+ * @a: (inout): A Symmetric matrix.
+ *
+ * Performs cholesky decomposition on @a in place. @a becomes lower triangular
+ * factor.
+ *
+ * Only lower triangle of @a is read. Columns are processed by panel, and rest
+ * of matrix is updated by matrix multiplication.
+ *
+ * If this fails, @a is left partially processed.
+ *
+ * Time: O((@a->rn)<superscript>3</superscript>)
+ *
+ * Returns: Whether cholesky decomposition performed on @a.
+ */
+
+/**
+ * crank_ldl_mat_double_n:
+ * @a: A Symmetric atrix.
+ * @l: (out): A Lower triangular matrix.
+ * @d: (out): A Diagonal components.
+ *
+ * Performs LDLT decomposition on @a, which results in @l, @d, which is
+ *
+ * * @l.mul (D.mul (@l.transpose())) == @a.
+ *
+ * where D is diagonal matrix whose diagonal is @d.
+ *
+ * This implementation is differ classical LDLT, by returning diagonal
+ * vector rather than diagonal matrix.
+ *
+ * LDLT avoids performing sqrt on diagonal elements, while multiplication happens
+ * more than Cholskey Decomposition.
+ *
+ * This is performed by crank_ldl_mat_double_n_self() on copy of @a.
+ *
+ * Time: O((@a->rn)<superscript>3</superscript>)
+ *
+ * Returns: Whether cholesky decomposition performed on @a.
+ */
+
+/**
+ * crank_ldl_mat_double_n_self:
+ * @a: (inout): A Symmetric matrix.
+ * @d: (out): A Diagonal components.
+ *
+ * Performs LDLT decomposition on @a in place. @a becomes lower triangular
+ * factor, whose diagonal components are 1.
+ *
+ * Only lower triangle of @a is read. Columns are processed by panel, and rest
+ * of matrix is updated by matrix multiplication.
+ *
+ * If this fails, @a is left partially processed.
+ *
+ * Time: O((@a->rn)<superscript>3</superscript>)
+ *
+ * Returns: Whether cholesky decomposition performed on @a.
+ */
+
+/**
+ * crank_gram_schmidt_mat_double_n:
  * @a: A Matrix.
  * @q: (out): A Resulting Orthogonal Matrix.
  * @r: (out): The upper triangular.
  *
  * Gets QR Decomposition by Gram Schmidt process.
  *
+ * Time: O((@a->rn)<superscript>3</superscript>)
+ *
  * Returns: %TRUE if @a has QR Decomposition.
  */
-gboolean
-crank_gram_schmidt_mat_cplx_float_n (CrankMatCplxFloatN *a,
-                                     CrankMatCplxFloatN *q,
-                                     CrankMatCplxFloatN *r)
-{
-  CrankVecCplxFloatN *e;
-
-  static CrankCplxFloat ZERO = {0.0f, 0.0f};
-  static CrankCplxFloat ONE = {1.0f, 0.0f};
-
-  guint i;
-  guint j;
-  guint k;
-
-  g_return_val_if_fail (a != q, FALSE);
-  g_return_val_if_fail (a != r, FALSE);
-  CRANK_MAT_WARN_IF_NON_SQUARE_RET ("Advmat-MatCplxFloatN",
-                                    "gram-schmidt",
-                                    a,
-                                    FALSE);
-
-  e = g_new (CrankVecCplxFloatN, a->rn);
-  crank_mat_cplx_float_n_init_fill (r, a->rn, a->rn, &ZERO);
-
-  for (i = 0; i < a->rn; i++)
-    {
-      CrankVecCplxFloatN ac;
-      CrankVecCplxFloatN u;
-      CrankCplxFloat ii;
-
-      // u = a.col[i]
-      crank_mat_cplx_float_n_get_col (a, i, &ac);
-      crank_vec_cplx_float_n_copy (&ac, &u);
-
-      // u -= proj(a.col[i], e[0..(i-1)])
-      // r = a.col[i] dot e
-      for (j = 0; j < i; j++)
-        {
-          CrankVecCplxFloatN proj;
-          CrankCplxFloat dot;
-          crank_vec_cplx_float_n_dot (&ac, e + j, &dot);
-
-          crank_vec_cplx_float_n_muls (e + j, &dot, &proj);
-
-          crank_vec_cplx_float_n_sub_self (&u, &proj);
-          crank_mat_cplx_float_n_set (r, j, i, &dot);
-        }
-
-      // e[i] = u.unit
-
-      crank_cplx_float_init (&ii, crank_vec_cplx_float_n_get_magn (&u), 0);
-      crank_mat_cplx_float_n_set (r, i, i, &ii);
-      crank_vec_cplx_float_n_unit (&u, e + i);
-      crank_vec_cplx_float_n_fini (&u);
-    }
-
-  crank_mat_cplx_float_n_init_col_arr (q, a->rn, e);
-
-  for (i = 0; i < a->rn; i++)
-    {
-      crank_vec_cplx_float_n_fini (e + i);
-    }
-  g_free (e);
-
-  return TRUE;
-}
 
 /**
- * crank_qr_householder_mat_cplx_float_n:
+ * crank_qr_householder_mat_double_n:
  * @a: A Matrix.
  * @r: (out): A Lower triangular matrix.
  *
  * Performs QR Decomposition by householder method.
+
+ * Time: O((@a->rn)<superscript>3</superscript>)
  *
  * Returns: %TRUE if @a has QR Decomposition.
  */
-gboolean
-crank_qr_householder_mat_cplx_float_n (CrankMatCplxFloatN *a,
-                                       CrankMatCplxFloatN *r)
-{
-  guint i;
-  guint j;
-  guint k;
-
-  CrankMatCplxFloatN pa = {0};
-  CrankMatCplxFloatN qi = {0};
-  CrankMatCplxFloatN qpai = {0};
-  CrankCplxFloat ancomp;
-
-  static CrankCplxFloat ZERO = {0.0f, 0.0f};
-  static CrankCplxFloat ONE = {1.0f, 0.0f};
-
-
-  g_return_val_if_fail (a != r, FALSE);
-  CRANK_MAT_WARN_IF_NON_SQUARE_RET ("Advmat-MatCplxFloatN",
-                                    "qr-householder",
-                                    a,
-                                    FALSE);
-
-  if (a->rn == 1)
-    {
-      crank_mat_cplx_float_n_init (r, 1, 1, &ZERO);
-      return TRUE;
-    }
-
-
-  // Setup initial state.
-  crank_mat_cplx_float_n_copy (a, &pa);
-  crank_mat_cplx_float_n_init_fill (r, a->rn, a->rn, &ZERO);
-
-  for (i = 0; i < a->rn - 1; i++)
-    {
-      CrankVecCplxFloatN an;
-      CrankVecCplxFloatN u;
-      CrankCplxFloat factor;
-      CrankCplxFloat factor_a;
-      CrankCplxFloat factor_b;
-
-      // Initialize an
-      crank_mat_cplx_float_n_get_col (&pa, 0, &an);
-      crank_vec_cplx_float_n_copy (&an, &u);
-
-      crank_vec_cplx_float_n_get (&an, 0, &ancomp);
-      crank_cplx_float_subr_self (&ancomp,
-                                  crank_vec_cplx_float_n_get_magn (&an));
-      crank_vec_cplx_float_n_set (&u, 0, &ancomp);
-
-      crank_vec_cplx_float_n_unit_self (&u);
-
-      // Initialize qi
-      crank_mat_cplx_float_n_init_fill (&qi, a->rn - i, a->rn - i, &ZERO);
-
-      crank_vec_cplx_float_n_dot (&u, &an, &factor_a);
-      crank_vec_cplx_float_n_dot (&an, &u, &factor_b);
-
-      crank_cplx_float_div (&factor_a, &factor_b, &factor);
-      crank_cplx_float_addr_self (&factor, 1.0f);
-      crank_cplx_float_neg_self (&factor);
-
-
-      for (j = 0; j < a->rn - i; j++)
-        {
-          for (k = 0; k < a->rn - i; k++)
-            {
-              CrankCplxFloat ujcomp;
-              CrankCplxFloat ukcomp;
-              CrankCplxFloat qicomp;
-              crank_vec_cplx_float_n_get (&u, j, &ujcomp);
-              crank_vec_cplx_float_n_get (&u, k, &ukcomp);
-              crank_cplx_float_mul_conj (&ujcomp, &ukcomp, &qicomp);
-              crank_cplx_float_mul_self (&qicomp, &factor);
-
-              crank_mat_cplx_float_n_set (&qi, j, k, &qicomp);
-            }
-
-          CrankCplxFloat qjcomp;
-
-          crank_mat_cplx_float_n_get (&qi, j, j, &qjcomp);
-          crank_cplx_float_addr_self (&qjcomp, 1.0f);
-          crank_mat_cplx_float_n_set (&qi, j, j, &qjcomp);
-        }
-
-      crank_mat_cplx_float_n_mul (&qi, &pa, &qpai);
-
-      // Resulting row 0 of qpai is part of r
-      // and rest part is next pa
-      for (j = 0; j < a->rn - i; j++)
-        {
-          crank_mat_cplx_float_n_set (r, i, i + j,
-                                      crank_mat_cplx_float_n_peek (&qpai, 0,
-                                                                   j));
-        }
-      crank_mat_cplx_float_n_slice (&qpai, 1, 1, qpai.rn, qpai.cn, &pa);
-      crank_vec_cplx_float_n_fini (&an);
-      crank_vec_cplx_float_n_fini (&u);
-    }
-  // Fill last part of r
-  crank_mat_cplx_float_n_get (&qpai, 1, 1, &ancomp);
-  crank_cplx_float_init (&ancomp, crank_cplx_float_get_norm (&ancomp), 0.0f);
-
-  crank_mat_cplx_float_n_set(r, (a->rn - 1), (a->rn - 1), &ancomp);
-
-  crank_mat_cplx_float_n_fini (&pa);
-  crank_mat_cplx_float_n_fini (&qi);
-  crank_mat_cplx_float_n_fini (&qpai);
-  return TRUE;
-}
-
-
 
 /**
- * crank_qr_givens_mat_cplx_float_n:
+ * crank_qr_givens_mat_double_n:
  * @a: A Matrix.
  * @r: (out): A Lower triangular matrix.
  *
  * Performs QR Decomposition by Givens rotation.
+
+ * Time: O((@a->rn)<superscript>3</superscript>)
  *
  * Returns: %TRUE if @a has QR Decomposition.
  */
-gboolean
-crank_qr_givens_mat_cplx_float_n (CrankMatCplxFloatN *a,
-                                  CrankMatCplxFloatN *r)
-{
-  guint i;
-  guint j;
-  guint k;
-
-  CrankMatCplxFloatN pa;
-  CrankCplxFloat last;
-
-
-  static CrankCplxFloat ZERO = {0.0f, 0.0f};
-  static CrankCplxFloat ONE = {1.0f, 0.0f};
 
+/**
+ * crank_eval_power_mat_double_n:
+ * @a: A Matrix.
+ * @b: (nullable): A Seed vector.
+ * @evec: (optional) (out): Associated eigenvector.
+ *
+ * Gets a eigenvalue of given matrix, by power method.
+ *
+ * The returned value is most dominent eigenvalue whose associated eigenvector
+ * is not orthogonal to seed vector.
+ *
+ * If it failed to convergent, it returns NaN.
+ *
+ * If @b is %NULL, this uses first column as seed.
+ *
+ * Returns: Most dominent eigenvalue whose eigenvector is not orthogonal to @b.
+ */
 
-  g_return_val_if_fail (a != r, FALSE);
-  CRANK_MAT_WARN_IF_NON_SQUARE_RET ("Advmat-MatCplxFloatN",
-                                    "qr-givens",
-                                    a,
-                                    FALSE);
-
-  if (a->rn == 1)
-    {
-      crank_mat_cplx_float_n_init (r, 1, 1,
-                                   crank_mat_cplx_float_n_peek (a, 0, 0));
-      return TRUE;
-    }
-
-  crank_mat_cplx_float_n_init_fill (r, a->rn, a->rn, &ZERO);
-  crank_mat_cplx_float_n_copy (a, &pa);
-
-  for (i = 0; i < a->rn - 1; i++)
-    {
-      guint n = a->rn - i;
-
-      for (j = n - 1; 0 < j; j--)
-        {
-          CrankCplxFloat x;
-          CrankCplxFloat y;
-
-          gfloat magn;
-
-          crank_mat_cplx_float_n_get (&pa, j - 1, 0, &x);
-          crank_mat_cplx_float_n_get (&pa, j, 0, &y);
-
-          if (crank_cplx_float_is_zero (&x) || crank_cplx_float_is_zero (&y))
-            {
-              crank_mat_cplx_float_n_fini (&pa);
-              crank_mat_cplx_float_n_fini (r);
-
-              return FALSE;
-            }
-
-          magn = sqrtf (crank_cplx_float_get_norm_sq (&x) +
-                        crank_cplx_float_get_norm_sq (&y) );
-
-          crank_cplx_float_divr_self (&x, magn);
-          crank_cplx_float_divr_self (&y, magn);
-
-          // Multiplies Givens rotation matrix.
-          //
-          // We don't build up Full givens rotation matrix,
-          // instead we apply this with sin, cos value.
-          for (k = 0; k < n; k++)
-            {
-              CrankCplxFloat e;
-              CrankCplxFloat f;
-
-              CrankCplxFloat ea;
-              CrankCplxFloat fa;
-              CrankCplxFloat addment;
-
-              crank_mat_cplx_float_n_get (&pa, j - 1, k, &e);
-              crank_mat_cplx_float_n_get (&pa, j, k, &f);
-
-              crank_cplx_float_mul_conj (&e, &x, &ea);
-              crank_cplx_float_mul_conj (&f, &y, &fa);
-              crank_cplx_float_add (&ea, &fa, &addment);
-
-              crank_mat_cplx_float_n_set (&pa, j - 1, k, &addment);
-
-              crank_cplx_float_mul (&e, &y, &ea);
-              crank_cplx_float_mul (&f, &x, &fa);
-              crank_cplx_float_sub (&fa, &ea, &addment);
-
-              crank_mat_cplx_float_n_set (&pa, j, k, &addment);
-            }
-        }
-
-      for (j = 0; j < n; j++)
-        {
-          crank_mat_cplx_float_n_set (r, i, i + j,
-                                      crank_mat_cplx_float_n_peek (&pa, 0, j));
-        }
+/**
+ * crank_eval_qr_mat_double_n:
+ * @a: A Matrix.
+ * @evals: (out): A Vector contains eigenvalues.
+ *
+ * Eigenvalues are calculated by QR Algorithm; If QR Decompisition is not
+ * possible, an 0-sized vector is returned.
+ *
+ * If the matrix has complex eigenvalues, this function will fill NAN in that
+ * place.
+ */
 
-      crank_mat_cplx_float_n_slice (&pa, 1, 1, pa.rn, pa.cn, &pa);
-    }
+/**
+ * crank_eval_sym_mat_double_n:
+ * @a: A Symmetric matrix.
+ * @evals: (out): A Vector to store eigenvalues, in ascending order.
+ * @evecs: (out) (optional): A Matrix to store eigenvectors as columns.
+ *
+ * Gets eigenvalues and eigenvectors of symmetric matrix.
+ *
+ * This uses crank_eval_sym_jacobi_mat_double_n() for small matrices, and
+ * crank_eval_sym_ql_mat_double_n() for others, with default limits.
+ *
+ * Returns: Whether the iteration converged.
+ */
 
-  crank_cplx_float_init (&last, crank_cplx_float_get_norm (pa.data + 0), 0.0f);
+/**
+ * crank_eval_sym_ql_mat_double_n:
+ * @a: A Symmetric matrix.
+ * @evals: (out): A Vector to store eigenvalues, in ascending order.
+ * @evecs: (out) (optional): A Matrix to store eigenvectors as columns.
+ * @max_iter: Maximum count of iterations for each eigenvalue, or 0 for
+ *     default of 30.
+ * @tol: Relative tolerance of off-diagonal components, or 0 for machine
+ *     epsilon.
+ *
+ * Gets eigenvalues and eigenvectors of symmetric matrix.
+ *
+ * @a is reduced to tridiagonal form by Householder transformations, and the
+ * tridiagonal matrix is diagonalized by QL iteration with implicit shifts.
+ * Eigenvectors are accumulated from both steps. Only lower triangle of @a is
+ * referenced.
+ *
+ * If an eigenvalue does not converge in @max_iter iterations, this stops and
+ * returns %FALSE. @evals and @evecs are still set, with values at that point.
+ *
+ * Time: O((@a->rn)<superscript>3</superscript>)
+ *
+ * Returns: Whether the iteration converged.
+ */
 
-  crank_mat_cplx_float_n_set (r, a->rn - 1, a->rn - 1, &last);
+/**
+ * crank_eval_sym_jacobi_mat_double_n:
+ * @a: A Symmetric matrix.
+ * @evals: (out): A Vector to store eigenvalues, in ascending order.
+ * @evecs: (out) (optional): A Matrix to store eigenvectors as columns.
+ * @max_sweep: Maximum count of sweeps, or 0 for default of 50.
+ * @tol: Relative tolerance of off-diagonal components, or 0 for machine
+ *     epsilon.
+ *
+ * Gets eigenvalues and eigenvectors of symmetric matrix, by cyclic Jacobi
+ * method.
+ *
+ * Each sweep annihilates all off-diagonal components by plane rotations. A
+ * component is skipped if it is smaller than @tol times Frobenius norm of @a,
+ * and iteration stops when a sweep skips all components. Only lower triangle
+ * of @a is referenced.
+ *
+ * This converges quadratically, and gives eigenvalues with good relative
+ * accuracy. But each sweep takes O((@a->rn)<superscript>3</superscript>), so
+ * this is preferred for small matrices.
+ *
+ * Returns: Whether the iteration converged.
+ */
 
-  crank_mat_cplx_float_n_fini (&pa);
+/**
+ * crank_svd_mat_double_n:
+ * @a: A Matrix.
+ * @u: (out) (optional): Left singular vectors, as columns.
+ * @s: (out): Singular values in descending order.
+ * @v: (out) (optional): Right singular vectors, as columns.
+ *
+ * Gets thin singular value decomposition @a = @u diag(@s) @v<superscript>T</superscript>,
+ * with default limits. See crank_svd_jacobi_mat_double_n().
+ *
+ * Returns: Whether the iteration converged.
+ */
 
-  return TRUE;
-}
+/**
+ * crank_svd_jacobi_mat_double_n:
+ * @a: A Matrix.
+ * @u: (out) (optional): Left singular vectors, as columns.
+ * @s: (out): Singular values in descending order.
+ * @v: (out) (optional): Right singular vectors, as columns.
+ * @max_sweep: Maximum count of sweeps, or 0 for default of 50.
+ * @tol: Tolerance of cosine between columns, or 0 for machine epsilon.
+ *
+ * Gets thin singular value decomposition @a = @u diag(@s) @v<superscript>T</superscript>,
+ * by one-sided Jacobi method.
+ *
+ * For @a of m x n with m >= n, @u is m x n, @s has n elements, and @v is
+ * n x n. If m < n, transpose of @a is decomposed and factors are swapped, so
+ * @u is m x m, @s has m elements and @v is n x m.
+ *
+ * Pairs of columns are rotated until all columns are orthogonal, that is,
+ * cosine between every pair is below @tol. Columns are held as rows of
+ * workspace, so rotations run over contiguous memory.
+ *
+ * If a singular value is 0, corresponding column of @u is 0.
+ *
+ * Returns: Whether the iteration converged.
+ */
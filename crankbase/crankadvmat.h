@@ -31,27 +31,121 @@
 
 #include "crankpermutation.h"
 #include "crankveccommon.h"
+#include "crankvecfloat.h"
+#include "crankvecdouble.h"
 #include "crankmatfloat.h"
+#include "crankmatdouble.h"
 #include "crankmatcplxfloat.h"
 
 G_BEGIN_DECLS
 
+//////// Type Definition ///////////////////////////////////////////////////////
+
+#define CRANK_TYPE_LU_FLOAT_N (crank_lu_float_n_get_type ())
+GType    crank_lu_float_n_get_type (void);
+
+/**
+ * CrankLUFloatN:
+ * @lu: Packed factors. Lower triangle, including diagonal, holds L, and strict
+ *      upper triangle holds U, whose diagonal components are 1.
+ * @p: Row permutation. Row i of factorized matrix is row @p[i] of original
+ *     matrix.
+ *
+ * Represents pivoted LU factorization of a square matrix, P A = L U.
+ */
+typedef struct _CrankLUFloatN {
+  CrankMatFloatN   lu;
+  CrankPermutation p;
+} CrankLUFloatN;
+
+#define CRANK_TYPE_LU_DOUBLE_N (crank_lu_double_n_get_type ())
+GType    crank_lu_double_n_get_type (void);
+
+/**
+ * CrankLUDoubleN:
+ * @lu: Packed factors. Lower triangle, including diagonal, holds L, and strict
+ *      upper triangle holds U, whose diagonal components are 1.
+ * @p: Row permutation. Row i of factorized matrix is row @p[i] of original
+ *     matrix.
+ *
+ * Represents pivoted LU factorization of a square matrix, P A = L U.
+ */
+typedef struct _CrankLUDoubleN {
+  CrankMatDoubleN  lu;
+  CrankPermutation p;
+} CrankLUDoubleN;
+
+#define CRANK_TYPE_QR_FLOAT_N (crank_qr_float_n_get_type ())
+GType    crank_qr_float_n_get_type (void);
+
+/**
+ * CrankQRFloatN:
+ * @qr: Packed factors. Upper triangle holds R, and strict lower triangle holds
+ *      householder vectors, whose first components are 1.
+ * @tau: Scale factors of householder reflectors.
+ * @t: Triangular factors of compact WY form. A panel from column j holds its
+ *     factor in rows j .. j + nb - 1.
+ *
+ * Represents householder QR factorization of a matrix with at least as many
+ * rows as columns, A = Q R. Q is held as product of reflectors, and is not
+ * formed.
+ */
+typedef struct _CrankQRFloatN {
+  CrankMatFloatN qr;
+  CrankVecFloatN tau;
+  CrankMatFloatN t;
+} CrankQRFloatN;
+
+#define CRANK_TYPE_QR_DOUBLE_N (crank_qr_double_n_get_type ())
+GType    crank_qr_double_n_get_type (void);
+
+/**
+ * CrankQRDoubleN:
+ * @qr: Packed factors. Upper triangle holds R, and strict lower triangle holds
+ *      householder vectors, whose first components are 1.
+ * @tau: Scale factors of householder reflectors.
+ * @t: Triangular factors of compact WY form. A panel from column j holds its
+ *     factor in rows j .. j + nb - 1.
+ *
+ * Represents householder QR factorization of a matrix with at least as many
+ * rows as columns, A = Q R. Q is held as product of reflectors, and is not
+ * formed.
+ */
+typedef struct _CrankQRDoubleN {
+  CrankMatDoubleN qr;
+  CrankVecDoubleN tau;
+  CrankMatDoubleN t;
+} CrankQRDoubleN;
+
+
+//////// Decompositions ////////////////////////////////////////////////////////
+
 gboolean crank_lu_mat_float_n (CrankMatFloatN *a,
                                CrankMatFloatN *l,
                                CrankMatFloatN *u);
 
+gboolean crank_lu_mat_float_n_self (CrankMatFloatN *a);
+
 gboolean crank_lu_p_mat_float_n (CrankMatFloatN   *a,
                                  CrankPermutation *p,
                                  CrankMatFloatN   *l,
                                  CrankMatFloatN   *u);
 
+gboolean crank_lu_p_mat_float_n_self (CrankMatFloatN   *a,
+                                      CrankPermutation *p);
+
 gboolean crank_ch_mat_float_n (CrankMatFloatN *a,
                                CrankMatFloatN *l);
 
+gboolean crank_ch_mat_float_n_self (CrankMatFloatN *a);
+
 gboolean crank_ldl_mat_float_n (CrankMatFloatN *a,
                                 CrankMatFloatN *l,
                                 CrankVecFloatN *d);
 
+gboolean crank_ldl_mat_float_n_self (CrankMatFloatN *a,
+                                     CrankVecFloatN *d);
+
 
 gboolean crank_gram_schmidt_mat_float_n (CrankMatFloatN *a,
                                          CrankMatFloatN *q,
@@ -72,6 +166,113 @@ gfloat   crank_eval_power_mat_float_n (CrankMatFloatN *a,
 void     crank_eval_qr_mat_float_n (CrankMatFloatN *a,
                                     CrankVecFloatN *evals);
 
+gboolean crank_eval_sym_mat_float_n (CrankMatFloatN *a,
+                                     CrankVecFloatN *evals,
+                                     CrankMatFloatN *evecs);
+
+gboolean crank_eval_sym_ql_mat_float_n (CrankMatFloatN *a,
+                                        CrankVecFloatN *evals,
+                                        CrankMatFloatN *evecs,
+                                        const guint     max_iter,
+                                        const gfloat    tol);
+
+gboolean crank_eval_sym_jacobi_mat_float_n (CrankMatFloatN *a,
+                                            CrankVecFloatN *evals,
+                                            CrankMatFloatN *evecs,
+                                            const guint     max_sweep,
+                                            const gfloat    tol);
+
+
+gboolean crank_svd_mat_float_n (CrankMatFloatN *a,
+                                CrankMatFloatN *u,
+                                CrankVecFloatN *s,
+                                CrankMatFloatN *v);
+
+gboolean crank_svd_jacobi_mat_float_n (CrankMatFloatN *a,
+                                       CrankMatFloatN *u,
+                                       CrankVecFloatN *s,
+                                       CrankMatFloatN *v,
+                                       const guint     max_sweep,
+                                       const gfloat    tol);
+
+
+
+
+gboolean crank_lu_mat_double_n (CrankMatDoubleN *a,
+                                CrankMatDoubleN *l,
+                                CrankMatDoubleN *u);
+
+gboolean crank_lu_mat_double_n_self (CrankMatDoubleN *a);
+
+gboolean crank_lu_p_mat_double_n (CrankMatDoubleN  *a,
+                                  CrankPermutation *p,
+                                  CrankMatDoubleN  *l,
+                                  CrankMatDoubleN  *u);
+
+gboolean crank_lu_p_mat_double_n_self (CrankMatDoubleN  *a,
+                                       CrankPermutation *p);
+
+gboolean crank_ch_mat_double_n (CrankMatDoubleN *a,
+                                CrankMatDoubleN *l);
+
+gboolean crank_ch_mat_double_n_self (CrankMatDoubleN *a);
+
+gboolean crank_ldl_mat_double_n (CrankMatDoubleN *a,
+                                 CrankMatDoubleN *l,
+                                 CrankVecDoubleN *d);
+
+gboolean crank_ldl_mat_double_n_self (CrankMatDoubleN *a,
+                                      CrankVecDoubleN *d);
+
+
+gboolean crank_gram_schmidt_mat_double_n (CrankMatDoubleN *a,
+                                          CrankMatDoubleN *q,
+                                          CrankMatDoubleN *r);
+
+gboolean crank_qr_householder_mat_double_n (CrankMatDoubleN *a,
+                                            CrankMatDoubleN *r);
+
+gboolean crank_qr_givens_mat_double_n (CrankMatDoubleN *a,
+                                       CrankMatDoubleN *r);
+
+
+
+gdouble  crank_eval_power_mat_double_n (CrankMatDoubleN *a,
+                                        CrankVecDoubleN *b,
+                                        CrankVecDoubleN *evec);
+
+void     crank_eval_qr_mat_double_n (CrankMatDoubleN *a,
+                                     CrankVecDoubleN *evals);
+
+gboolean crank_eval_sym_mat_double_n (CrankMatDoubleN *a,
+                                      CrankVecDoubleN *evals,
+                                      CrankMatDoubleN *evecs);
+
+gboolean crank_eval_sym_ql_mat_double_n (CrankMatDoubleN *a,
+                                         CrankVecDoubleN *evals,
+                                         CrankMatDoubleN *evecs,
+                                         const guint      max_iter,
+                                         const gdouble    tol);
+
+gboolean crank_eval_sym_jacobi_mat_double_n (CrankMatDoubleN *a,
+                                             CrankVecDoubleN *evals,
+                                             CrankMatDoubleN *evecs,
+                                             const guint      max_sweep,
+                                             const gdouble    tol);
+
+
+gboolean crank_svd_mat_double_n (CrankMatDoubleN *a,
+                                 CrankMatDoubleN *u,
+                                 CrankVecDoubleN *s,
+                                 CrankMatDoubleN *v);
+
+gboolean crank_svd_jacobi_mat_double_n (CrankMatDoubleN *a,
+                                        CrankMatDoubleN *u,
+                                        CrankVecDoubleN *s,
+                                        CrankMatDoubleN *v,
+                                        const guint      max_sweep,
+                                        const gdouble    tol);
+
 
 
 
@@ -97,6 +298,150 @@ gboolean crank_qr_householder_mat_cplx_float_n (CrankMatCplxFloatN *a,
 gboolean crank_qr_givens_mat_cplx_float_n (CrankMatCplxFloatN *a,
                                            CrankMatCplxFloatN *r);
 
+
+
+//////// Factorization objects /////////////////////////////////////////////////
+
+gboolean        crank_lu_float_n_init (CrankLUFloatN  *lu,
+                                       CrankMatFloatN *a);
+
+void            crank_lu_float_n_copy (CrankLUFloatN *lu,
+                                       CrankLUFloatN *other);
+
+CrankLUFloatN  *crank_lu_float_n_dup (CrankLUFloatN *lu);
+
+void            crank_lu_float_n_fini (CrankLUFloatN *lu);
+
+void            crank_lu_float_n_free (CrankLUFloatN *lu);
+
+guint           crank_lu_float_n_get_size (CrankLUFloatN *lu);
+
+gfloat          crank_lu_float_n_get_det (CrankLUFloatN *lu);
+
+void            crank_lu_float_n_solve (CrankLUFloatN  *lu,
+                                        CrankVecFloatN *b,
+                                        CrankVecFloatN *x);
+
+void            crank_lu_float_n_solve_multi (CrankLUFloatN  *lu,
+                                              CrankMatFloatN *b,
+                                              CrankMatFloatN *x);
+
+gboolean        crank_qr_float_n_init (CrankQRFloatN  *qr,
+                                       CrankMatFloatN *a);
+
+void            crank_qr_float_n_copy (CrankQRFloatN *qr,
+                                       CrankQRFloatN *other);
+
+CrankQRFloatN  *crank_qr_float_n_dup (CrankQRFloatN *qr);
+
+void            crank_qr_float_n_fini (CrankQRFloatN *qr);
+
+void            crank_qr_float_n_free (CrankQRFloatN *qr);
+
+guint           crank_qr_float_n_get_row_size (CrankQRFloatN *qr);
+
+guint           crank_qr_float_n_get_col_size (CrankQRFloatN *qr);
+
+void            crank_qr_float_n_get_r (CrankQRFloatN  *qr,
+                                        CrankMatFloatN *r);
+
+void            crank_qr_float_n_get_q (CrankQRFloatN  *qr,
+                                        CrankMatFloatN *q);
+
+void            crank_qr_float_n_mul_qt (CrankQRFloatN  *qr,
+                                         CrankVecFloatN *b,
+                                         CrankVecFloatN *r);
+
+void            crank_qr_float_n_mul_qt_multi (CrankQRFloatN  *qr,
+                                               CrankMatFloatN *b,
+                                               CrankMatFloatN *r);
+
+void            crank_qr_float_n_mul_q (CrankQRFloatN  *qr,
+                                        CrankVecFloatN *b,
+                                        CrankVecFloatN *r);
+
+void            crank_qr_float_n_mul_q_multi (CrankQRFloatN  *qr,
+                                              CrankMatFloatN *b,
+                                              CrankMatFloatN *r);
+
+void            crank_qr_float_n_solve (CrankQRFloatN  *qr,
+                                        CrankVecFloatN *b,
+                                        CrankVecFloatN *x);
+
+void            crank_qr_float_n_solve_multi (CrankQRFloatN  *qr,
+                                              CrankMatFloatN *b,
+                                              CrankMatFloatN *x);
+
+gboolean        crank_lu_double_n_init (CrankLUDoubleN  *lu,
+                                        CrankMatDoubleN *a);
+
+void            crank_lu_double_n_copy (CrankLUDoubleN *lu,
+                                        CrankLUDoubleN *other);
+
+CrankLUDoubleN *crank_lu_double_n_dup (CrankLUDoubleN *lu);
+
+void            crank_lu_double_n_fini (CrankLUDoubleN *lu);
+
+void            crank_lu_double_n_free (CrankLUDoubleN *lu);
+
+guint           crank_lu_double_n_get_size (CrankLUDoubleN *lu);
+
+gdouble         crank_lu_double_n_get_det (CrankLUDoubleN *lu);
+
+void            crank_lu_double_n_solve (CrankLUDoubleN  *lu,
+                                         CrankVecDoubleN *b,
+                                         CrankVecDoubleN *x);
+
+void            crank_lu_double_n_solve_multi (CrankLUDoubleN  *lu,
+                                               CrankMatDoubleN *b,
+                                               CrankMatDoubleN *x);
+
+gboolean        crank_qr_double_n_init (CrankQRDoubleN  *qr,
+                                        CrankMatDoubleN *a);
+
+void            crank_qr_double_n_copy (CrankQRDoubleN *qr,
+                                        CrankQRDoubleN *other);
+
+CrankQRDoubleN *crank_qr_double_n_dup (CrankQRDoubleN *qr);
+
+void            crank_qr_double_n_fini (CrankQRDoubleN *qr);
+
+void            crank_qr_double_n_free (CrankQRDoubleN *qr);
+
+guint           crank_qr_double_n_get_row_size (CrankQRDoubleN *qr);
+
+guint           crank_qr_double_n_get_col_size (CrankQRDoubleN *qr);
+
+void            crank_qr_double_n_get_r (CrankQRDoubleN  *qr,
+                                         CrankMatDoubleN *r);
+
+void            crank_qr_double_n_get_q (CrankQRDoubleN  *qr,
+                                         CrankMatDoubleN *q);
+
+void            crank_qr_double_n_mul_qt (CrankQRDoubleN  *qr,
+                                          CrankVecDoubleN *b,
+                                          CrankVecDoubleN *r);
+
+void            crank_qr_double_n_mul_qt_multi (CrankQRDoubleN  *qr,
+                                                CrankMatDoubleN *b,
+                                                CrankMatDoubleN *r);
+
+void            crank_qr_double_n_mul_q (CrankQRDoubleN  *qr,
+                                         CrankVecDoubleN *b,
+                                         CrankVecDoubleN *r);
+
+void            crank_qr_double_n_mul_q_multi (CrankQRDoubleN  *qr,
+                                               CrankMatDoubleN *b,
+                                               CrankMatDoubleN *r);
+
+void            crank_qr_double_n_solve (CrankQRDoubleN  *qr,
+                                         CrankVecDoubleN *b,
+                                         CrankVecDoubleN *x);
+
+void            crank_qr_double_n_solve_multi (CrankQRDoubleN  *qr,
+                                               CrankMatDoubleN *b,
+                                               CrankMatDoubleN *x);
+
 G_END_DECLS
 
 #endif /* CRANKADVMAT_H */
\ No newline at end of file
@@ -30,6 +30,8 @@
 #include "crankvalue.h"
 #include "crankbits.h"
 #include "crank128.h"
+#include "crankparallel.h"
+#include "crankfastmath.h"
 
 #include "crankrange.h"
 #include "crankiter.h"
@@ -39,20 +41,31 @@
 #include "crankcomplex.h"
 #include "crankquaternion.h"
 
+#include "crankmatarena.h"
+
 #include "crankveccommon.h"
 #include "crankvecbool.h"
 #include "crankvecuint.h"
 #include "crankvecint.h"
 #include "crankvecfloat.h"
+#include "crankvecdouble.h"
 #include "crankveccplxfloat.h"
 
 #include "crankmatcommon.h"
 #include "crankmatfloat.h"
+#include "crankmatdouble.h"
 #include "crankmatcplxfloat.h"
+#include "crankmatsparsefloat.h"
+#include "crankmatfixed.h"
+#include "cranksplitcplxfloat.h"
 #include "crankadvmat.h"
+#include "crankfft.h"
 
+#include "crankindexheap.h"
 #include "crankdigraph.h"
 #include "crankadvgraph.h"
+#include "crankdigraphfrozen.h"
+#include "crankdigraphlandmarks.h"
 
 #include "crankcellspace2.h"
 #include "crankcellspace3.h"
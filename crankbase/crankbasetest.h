@@ -431,6 +431,61 @@ gchar  *crank_assert_stringify_gptrarray (GPtrArray       *ptrarray,
                                crank_float_to_string, NULL, \
                                __VA_ARGS__)
 
+/**
+ * crank_assert_eqarray_double: (skip)
+ * @a: (element-type gdouble) (array length=an): A array
+ * @an: (type guint): Length of elements.
+ * @b: (element-type gdouble) (array length=bn): A array
+ * @bn: (type guint): Length of elements.
+ *
+ * Asserts two double arrays are equals.
+ */
+#define crank_assert_eqarray_double(a,an,b,bn) \
+  crank_assert_eqarray_double_d(a, an, b, bn, 0.0001)
+/**
+ * crank_assert_eqarray_double_imm: (skip)
+ * @a: (element-type gdouble) (array length=an): A array
+ * @an: (type guint): Length of elements.
+ * @...: Variadic list of double to compare with @a.
+ *
+ * Asserts a given boolean array has same element with given list
+ */
+#define crank_assert_eqarray_double_imm(a, an, ...) \
+  crank_assert_eqarray_double_d_imm(a, an, 0.0001, __VA_ARGS__)
+
+/**
+ * crank_assert_eqarray_double_d: (skip)
+ * @a: (element-type gdouble) (array length=an): A array
+ * @an: (type guint): Length of elements.
+ * @b: (element-type gdouble) (array length=bn): A array
+ * @bn: (type guint): Length of elements.
+ * @d: (type gfloat): Delta value.
+ *
+ * Asserts two double arrays are equals.
+ */
+#define crank_assert_eqarray_double_d(a,an,b,bn,d)   \
+  _crank_assert_eqarray_d(gdouble, \
+                          a, an, G_STRINGIFY (a), \
+                          b, bn, G_STRINGIFY (b), \
+                          crank_double_nan_equal_delta, (d), \
+                          crank_double_to_string, NULL)
+
+/**
+ * crank_assert_eqarray_double_d_imm: (skip)
+ * @a: (element-type gdouble) (array length=an): A array
+ * @an: (type guint): Length of elements.
+ * @d: (type gfloat): Delta value.
+ * @...: Variadic list to compare with @a.
+ *
+ * Asserts a given boolean array has same element with given list
+ */
+#define crank_assert_eqarray_double_d_imm(a,an,d,...)    \
+  _crank_assert_eqarray_d_imm (gdouble, \
+                               a, an, G_STRINGIFY (a), \
+                               crank_double_nan_equal_delta, (d), \
+                               crank_double_to_string, NULL, \
+                               __VA_ARGS__)
+
 
 /**
  * crank_assert_eqarray_pointer: (skip)
@@ -664,6 +719,52 @@ gchar  *crank_assert_stringify_gptrarray (GPtrArray       *ptrarray,
   crank_assert_eqarray_float_imm((a)->data, (a)->n, __VA_ARGS__)
 
 
+/**
+ * crank_assert_eq_vecdouble2_imm: (skip)
+ * @a: (type CrankVecDouble2): A #CrankVecDouble2
+ * @x: (type gdouble): First element to compare.
+ * @y: (type gdouble): Second element to compare.
+ *
+ * Asserts a given double vector has same elements with given elements.
+ */
+#define crank_assert_eq_vecdouble2_imm(a,x,y) \
+  crank_assert_eqarray_double_imm((gdouble*)(a), 2, x,y)
+/**
+ * crank_assert_eq_vecdouble3_imm: (skip)
+ * @a: (type CrankVecDouble3): A #CrankVecDouble3
+ * @x: (type gdouble): First element to compare.
+ * @y: (type gdouble): Second element to compare.
+ * @z: (type gdouble): Third element to compare.
+ *
+ * Asserts a given double vector has same elements with given elements.
+ */
+#define crank_assert_eq_vecdouble3_imm(a,x,y,z) \
+  crank_assert_eqarray_double_imm((gdouble*)(a), 3, x,y,z)
+/**
+ * crank_assert_eq_vecdouble4_imm: (skip)
+ * @a: (type CrankVecDouble4): A #CrankVecDouble4
+ * @x: (type gdouble): First element to compare.
+ * @y: (type gdouble): Second element to compare.
+ * @z: (type gdouble): Third element to compare.
+ * @w: (type gdouble): Fourth element to compare.
+ *
+ * Asserts a given double vector has same elements with given elements.
+ */
+#define crank_assert_eq_vecdouble4_imm(a,x,y,z,w) \
+  crank_assert_eqarray_double_imm((gdouble*)(a), 4, x,y,z,w)
+/**
+ * crank_assert_eq_vecdouble_n_imm: (skip)
+ * @a: (type CrankVecDoubleN): A #CrankVecDoubleN
+ * @...: Variadic list to compare with @a.
+ *
+ * Asserts a given double vector has same elements with given variadic list.
+ *
+ * You don't have to pass length of list, as macro catches length of list.
+ */
+#define crank_assert_eq_vecdouble_n_imm(a,...) \
+  crank_assert_eqarray_double_imm((a)->data, (a)->n, __VA_ARGS__)
+
+
 
 //////// Private Macros ////////////////////////////////////////////////////////
 
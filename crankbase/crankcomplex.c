@@ -28,6 +28,7 @@
 #include <glib-object.h>
 
 #include "crankfunction.h"
+#include "crankfastmath.h"
 #include "crankcomplex.h"
 #include "crankquaternion.h"
 
@@ -71,6 +72,16 @@
  *     </tbody>
  *   </tgroup>
  * </table>
+ *
+ * # Fast approximations
+ *
+ * Exponential, logarithm, hyperbolic and trigonometric functions have variants
+ * with <function>_fast</function> suffix, which use approximations of
+ * #crankfastmath. Functions without suffix use them too, when they are enabled
+ * by crank_fast_math_set_enabled().
+ *
+ * Batch functions process arrays of complexes. Fast variants of them are
+ * vectorized.
  */
 
 
@@ -1144,6 +1155,12 @@ crank_cplx_float_ln (CrankCplxFloat *a,
 
   g_return_if_fail (a != r);
 
+  if (crank_fast_math_get_enabled ())
+    {
+      crank_cplx_float_ln_fast (a, r);
+      return;
+    }
+
   norm = crank_cplx_float_get_norm (a);
 
   if (norm == 0)
@@ -1173,6 +1190,12 @@ crank_cplx_float_exp (CrankCplxFloat *a,
 {
   g_return_if_fail (a != r);
 
+  if (crank_fast_math_get_enabled ())
+    {
+      crank_cplx_float_exp_fast (a, r);
+      return;
+    }
+
   if (a->real == -INFINITY)
     {
       r->real = 0;
@@ -1233,6 +1256,12 @@ crank_cplx_float_sinh (CrankCplxFloat *a,
 
   g_return_if_fail (a != r);
 
+  if (crank_fast_math_get_enabled ())
+    {
+      crank_cplx_float_sinh_fast (a, r);
+      return;
+    }
+
   crank_cplx_float_exp (a, &e_p);
   crank_cplx_float_inverse (&e_p, &e_m);
 
@@ -1257,6 +1286,12 @@ crank_cplx_float_cosh (CrankCplxFloat *a,
 
   g_return_if_fail (a != r);
 
+  if (crank_fast_math_get_enabled ())
+    {
+      crank_cplx_float_cosh_fast (a, r);
+      return;
+    }
+
   crank_cplx_float_exp (a, &e_p);
   crank_cplx_float_inverse (&e_p, &e_m);
 
@@ -1310,6 +1345,12 @@ crank_cplx_float_sin (CrankCplxFloat *a,
 
   g_return_if_fail (a != r);
 
+  if (crank_fast_math_get_enabled ())
+    {
+      crank_cplx_float_sin_fast (a, r);
+      return;
+    }
+
   sr  = sinf (a->real);
   cr  = cosf (a->real);
   shi = sinhf (a->imag);
@@ -1337,6 +1378,12 @@ crank_cplx_float_cos (CrankCplxFloat *a,
 
   g_return_if_fail (a != r);
 
+  if (crank_fast_math_get_enabled ())
+    {
+      crank_cplx_float_cos_fast (a, r);
+      return;
+    }
+
   sr  = sinf (a->real);
   cr  = cosf (a->real);
   shi = sinhf (a->imag);
@@ -1367,6 +1414,428 @@ crank_cplx_float_tan (CrankCplxFloat *a,
 }
 
 
+//////// Fast Approximations ///////////////////////////////////////////////////
+
+/**
+ * crank_cplx_float_ln_fast:
+ * @a: A Complex.
+ * @r: (out): A Complex to store result.
+ *
+ * Gets approximated natural log from a complex. Imaginary part is in
+ * [-PI, PI].
+ *
+ * See #crankfastmath for accuracy.
+ */
+void
+crank_cplx_float_ln_fast (CrankCplxFloat *a,
+                          CrankCplxFloat *r)
+{
+  gfloat nsq = a->real * a->real + a->imag * a->imag;
+  gfloat arg = crank_fast_atan2f (a->imag, a->real);
+
+  r->real = 0.5f * crank_fast_logf (nsq);
+  r->imag = arg;
+}
+
+/**
+ * crank_cplx_float_exp_fast:
+ * @a: A Complex.
+ * @r: (out): A Complex to store result.
+ *
+ * Gets approximated e-based exponential of complex.
+ *
+ * See #crankfastmath for accuracy.
+ */
+void
+crank_cplx_float_exp_fast (CrankCplxFloat *a,
+                           CrankCplxFloat *r)
+{
+  gfloat e = crank_fast_expf (a->real);
+  gfloat s;
+  gfloat c;
+
+  crank_fast_sincosf (a->imag, &s, &c);
+
+  r->real = e * c;
+  r->imag = e * s;
+}
+
+/**
+ * crank_cplx_float_sinh_fast:
+ * @a: A Complex.
+ * @r: (out): A Complex to store result.
+ *
+ * Gets approximated sinh of complex.
+ *
+ * See #crankfastmath for accuracy.
+ */
+void
+crank_cplx_float_sinh_fast (CrankCplxFloat *a,
+                            CrankCplxFloat *r)
+{
+  gfloat shr;
+  gfloat chr;
+  gfloat si;
+  gfloat ci;
+
+  crank_fast_sinhcoshf (a->real, &shr, &chr);
+  crank_fast_sincosf (a->imag, &si, &ci);
+
+  r->real = shr * ci;
+  r->imag = chr * si;
+}
+
+/**
+ * crank_cplx_float_cosh_fast:
+ * @a: A Complex.
+ * @r: (out): A Complex to store result.
+ *
+ * Gets approximated cosh of complex.
+ *
+ * See #crankfastmath for accuracy.
+ */
+void
+crank_cplx_float_cosh_fast (CrankCplxFloat *a,
+                            CrankCplxFloat *r)
+{
+  gfloat shr;
+  gfloat chr;
+  gfloat si;
+  gfloat ci;
+
+  crank_fast_sinhcoshf (a->real, &shr, &chr);
+  crank_fast_sincosf (a->imag, &si, &ci);
+
+  r->real = chr * ci;
+  r->imag = shr * si;
+}
+
+/**
+ * crank_cplx_float_sin_fast:
+ * @a: A Complex.
+ * @r: (out): A Complex to store result.
+ *
+ * Gets approximated sin of complex.
+ *
+ * See #crankfastmath for accuracy.
+ */
+void
+crank_cplx_float_sin_fast (CrankCplxFloat *a,
+                           CrankCplxFloat *r)
+{
+  gfloat sr;
+  gfloat cr;
+  gfloat shi;
+  gfloat chi;
+
+  crank_fast_sincosf (a->real, &sr, &cr);
+  crank_fast_sinhcoshf (a->imag, &shi, &chi);
+
+  r->real = sr * chi;
+  r->imag = cr * shi;
+}
+
+/**
+ * crank_cplx_float_cos_fast:
+ * @a: A Complex.
+ * @r: (out): A Complex to store result.
+ *
+ * Gets approximated cos of complex.
+ *
+ * See #crankfastmath for accuracy.
+ */
+void
+crank_cplx_float_cos_fast (CrankCplxFloat *a,
+                           CrankCplxFloat *r)
+{
+  gfloat sr;
+  gfloat cr;
+  gfloat shi;
+  gfloat chi;
+
+  crank_fast_sincosf (a->real, &sr, &cr);
+  crank_fast_sinhcoshf (a->imag, &shi, &chi);
+
+  r->real = cr * chi;
+  r->imag = -(sr * shi);
+}
+
+
+//////// Batch Operations //////////////////////////////////////////////////////
+
+// Count of complexes, which are converted into streams at once.
+#define CRANK_CPLX_FLOAT_BATCH_CHUNK 64
+
+/*
+ * Runs a function for each complexes, so that @r may be same with @a.
+ */
+static void
+crank_cplx_float_batch_each (const guint           n,
+                             const CrankCplxFloat *a,
+                             CrankCplxFloat       *r,
+                             void                (*func) (CrankCplxFloat *a,
+                                                          CrankCplxFloat *r))
+{
+  guint i;
+
+  for (i = 0; i < n; i++)
+    {
+      CrankCplxFloat e = a[i];
+
+      func (&e, r + i);
+    }
+}
+
+/*
+ * Splits complexes into streams of parts.
+ */
+static void
+crank_cplx_float_batch_split (const guint           n,
+                              const CrankCplxFloat *a,
+                              gfloat               *real,
+                              gfloat               *imag)
+{
+  guint i;
+
+  for (i = 0; i < n; i++)
+    {
+      real[i] = a[i].real;
+      imag[i] = a[i].imag;
+    }
+}
+
+/**
+ * crank_cplx_float_batch_ln:
+ * @n: Count of complexes.
+ * @a: (array length=n): Complexes.
+ * @r: (out caller-allocates) (array length=n): Array to store results.
+ *
+ * Gets natural logs of complexes. @r may be same with @a.
+ *
+ * This uses crank_cplx_float_batch_ln_fast(), if approximations are enabled
+ * by crank_fast_math_set_enabled().
+ */
+void
+crank_cplx_float_batch_ln (const guint           n,
+                           const CrankCplxFloat *a,
+                           CrankCplxFloat       *r)
+{
+  if (crank_fast_math_get_enabled ())
+    crank_cplx_float_batch_ln_fast (n, a, r);
+  else
+    crank_cplx_float_batch_each (n, a, r, crank_cplx_float_ln);
+}
+
+/**
+ * crank_cplx_float_batch_exp:
+ * @n: Count of complexes.
+ * @a: (array length=n): Complexes.
+ * @r: (out caller-allocates) (array length=n): Array to store results.
+ *
+ * Gets e-based exponentials of complexes. @r may be same with @a.
+ *
+ * This uses crank_cplx_float_batch_exp_fast(), if approximations are enabled
+ * by crank_fast_math_set_enabled().
+ */
+void
+crank_cplx_float_batch_exp (const guint           n,
+                            const CrankCplxFloat *a,
+                            CrankCplxFloat       *r)
+{
+  if (crank_fast_math_get_enabled ())
+    crank_cplx_float_batch_exp_fast (n, a, r);
+  else
+    crank_cplx_float_batch_each (n, a, r, crank_cplx_float_exp);
+}
+
+/**
+ * crank_cplx_float_batch_cosh:
+ * @n: Count of complexes.
+ * @a: (array length=n): Complexes.
+ * @r: (out caller-allocates) (array length=n): Array to store results.
+ *
+ * Gets cosh of complexes. @r may be same with @a.
+ *
+ * This uses crank_cplx_float_batch_cosh_fast(), if approximations are enabled
+ * by crank_fast_math_set_enabled().
+ */
+void
+crank_cplx_float_batch_cosh (const guint           n,
+                             const CrankCplxFloat *a,
+                             CrankCplxFloat       *r)
+{
+  if (crank_fast_math_get_enabled ())
+    crank_cplx_float_batch_cosh_fast (n, a, r);
+  else
+    crank_cplx_float_batch_each (n, a, r, crank_cplx_float_cosh);
+}
+
+/**
+ * crank_cplx_float_batch_cos:
+ * @n: Count of complexes.
+ * @a: (array length=n): Complexes.
+ * @r: (out caller-allocates) (array length=n): Array to store results.
+ *
+ * Gets cos of complexes. @r may be same with @a.
+ *
+ * This uses crank_cplx_float_batch_cos_fast(), if approximations are enabled
+ * by crank_fast_math_set_enabled().
+ */
+void
+crank_cplx_float_batch_cos (const guint           n,
+                            const CrankCplxFloat *a,
+                            CrankCplxFloat       *r)
+{
+  if (crank_fast_math_get_enabled ())
+    crank_cplx_float_batch_cos_fast (n, a, r);
+  else
+    crank_cplx_float_batch_each (n, a, r, crank_cplx_float_cos);
+}
+
+/**
+ * crank_cplx_float_batch_ln_fast:
+ * @n: Count of complexes.
+ * @a: (array length=n): Complexes.
+ * @r: (out caller-allocates) (array length=n): Array to store results.
+ *
+ * Gets approximated natural logs of complexes, by vectorized kernels.
+ * @r may be same with @a.
+ */
+void
+crank_cplx_float_batch_ln_fast (const guint           n,
+                                const CrankCplxFloat *a,
+                                CrankCplxFloat       *r)
+{
+  gfloat s[3][CRANK_CPLX_FLOAT_BATCH_CHUNK];
+  guint i;
+  guint j;
+
+  for (i = 0; i < n; i += CRANK_CPLX_FLOAT_BATCH_CHUNK)
+    {
+      guint cn = MIN (n - i, CRANK_CPLX_FLOAT_BATCH_CHUNK);
+
+      crank_cplx_float_batch_split (cn, a + i, s[0], s[1]);
+
+      for (j = 0; j < cn; j++)
+        s[2][j] = s[0][j] * s[0][j] + s[1][j] * s[1][j];
+
+      crank_fast_atan2f_array (cn, s[1], s[0], s[1]);
+      crank_fast_logf_array (cn, s[2], s[2]);
+
+      for (j = 0; j < cn; j++)
+        {
+          r[i + j].real = 0.5f * s[2][j];
+          r[i + j].imag = s[1][j];
+        }
+    }
+}
+
+/**
+ * crank_cplx_float_batch_exp_fast:
+ * @n: Count of complexes.
+ * @a: (array length=n): Complexes.
+ * @r: (out caller-allocates) (array length=n): Array to store results.
+ *
+ * Gets approximated e-based exponentials of complexes, by vectorized kernels.
+ * @r may be same with @a.
+ */
+void
+crank_cplx_float_batch_exp_fast (const guint           n,
+                                 const CrankCplxFloat *a,
+                                 CrankCplxFloat       *r)
+{
+  gfloat s[3][CRANK_CPLX_FLOAT_BATCH_CHUNK];
+  guint i;
+  guint j;
+
+  for (i = 0; i < n; i += CRANK_CPLX_FLOAT_BATCH_CHUNK)
+    {
+      guint cn = MIN (n - i, CRANK_CPLX_FLOAT_BATCH_CHUNK);
+
+      crank_cplx_float_batch_split (cn, a + i, s[0], s[1]);
+
+      crank_fast_expf_array (cn, s[0], s[0]);
+      crank_fast_sincosf_array (cn, s[1], s[1], s[2]);
+
+      for (j = 0; j < cn; j++)
+        {
+          r[i + j].real = s[0][j] * s[2][j];
+          r[i + j].imag = s[0][j] * s[1][j];
+        }
+    }
+}
+
+/**
+ * crank_cplx_float_batch_cosh_fast:
+ * @n: Count of complexes.
+ * @a: (array length=n): Complexes.
+ * @r: (out caller-allocates) (array length=n): Array to store results.
+ *
+ * Gets approximated cosh of complexes, by vectorized kernels. @r may be same
+ * with @a.
+ */
+void
+crank_cplx_float_batch_cosh_fast (const guint           n,
+                                  const CrankCplxFloat *a,
+                                  CrankCplxFloat       *r)
+{
+  gfloat s[4][CRANK_CPLX_FLOAT_BATCH_CHUNK];
+  guint i;
+  guint j;
+
+  for (i = 0; i < n; i += CRANK_CPLX_FLOAT_BATCH_CHUNK)
+    {
+      guint cn = MIN (n - i, CRANK_CPLX_FLOAT_BATCH_CHUNK);
+
+      crank_cplx_float_batch_split (cn, a + i, s[0], s[1]);
+
+      crank_fast_sinhcoshf_array (cn, s[0], s[0], s[2]);
+      crank_fast_sincosf_array (cn, s[1], s[1], s[3]);
+
+      for (j = 0; j < cn; j++)
+        {
+          r[i + j].real = s[2][j] * s[3][j];
+          r[i + j].imag = s[0][j] * s[1][j];
+        }
+    }
+}
+
+/**
+ * crank_cplx_float_batch_cos_fast:
+ * @n: Count of complexes.
+ * @a: (array length=n): Complexes.
+ * @r: (out caller-allocates) (array length=n): Array to store results.
+ *
+ * Gets approximated cos of complexes, by vectorized kernels. @r may be same
+ * with @a.
+ */
+void
+crank_cplx_float_batch_cos_fast (const guint           n,
+                                 const CrankCplxFloat *a,
+                                 CrankCplxFloat       *r)
+{
+  gfloat s[4][CRANK_CPLX_FLOAT_BATCH_CHUNK];
+  guint i;
+  guint j;
+
+  for (i = 0; i < n; i += CRANK_CPLX_FLOAT_BATCH_CHUNK)
+    {
+      guint cn = MIN (n - i, CRANK_CPLX_FLOAT_BATCH_CHUNK);
+
+      crank_cplx_float_batch_split (cn, a + i, s[0], s[1]);
+
+      crank_fast_sincosf_array (cn, s[0], s[0], s[2]);
+      crank_fast_sinhcoshf_array (cn, s[1], s[1], s[3]);
+
+      for (j = 0; j < cn; j++)
+        {
+          r[i + j].real = s[2][j] * s[3][j];
+          r[i + j].imag = -(s[0][j] * s[1][j]);
+        }
+    }
+}
+
+
 //////// GValue Converter //////////////////////////////////////////////////////
 
 static void
@@ -278,6 +278,60 @@ void            crank_cplx_float_cos (CrankCplxFloat *a,
 void            crank_cplx_float_tan (CrankCplxFloat *a,
                                       CrankCplxFloat *r);
 
+//////// Fast Approximations ///////////////////////////////////////////////////
+
+void            crank_cplx_float_ln_fast (CrankCplxFloat *a,
+                                          CrankCplxFloat *r);
+
+void            crank_cplx_float_exp_fast (CrankCplxFloat *a,
+                                           CrankCplxFloat *r);
+
+void            crank_cplx_float_sinh_fast (CrankCplxFloat *a,
+                                            CrankCplxFloat *r);
+
+void            crank_cplx_float_cosh_fast (CrankCplxFloat *a,
+                                            CrankCplxFloat *r);
+
+void            crank_cplx_float_sin_fast (CrankCplxFloat *a,
+                                           CrankCplxFloat *r);
+
+void            crank_cplx_float_cos_fast (CrankCplxFloat *a,
+                                           CrankCplxFloat *r);
+
+//////// Batch Operations //////////////////////////////////////////////////////
+
+void            crank_cplx_float_batch_ln (const guint           n,
+                                           const CrankCplxFloat *a,
+                                           CrankCplxFloat       *r);
+
+void            crank_cplx_float_batch_exp (const guint           n,
+                                            const CrankCplxFloat *a,
+                                            CrankCplxFloat       *r);
+
+void            crank_cplx_float_batch_cosh (const guint           n,
+                                             const CrankCplxFloat *a,
+                                             CrankCplxFloat       *r);
+
+void            crank_cplx_float_batch_cos (const guint           n,
+                                            const CrankCplxFloat *a,
+                                            CrankCplxFloat       *r);
+
+void            crank_cplx_float_batch_ln_fast (const guint           n,
+                                                const CrankCplxFloat *a,
+                                                CrankCplxFloat       *r);
+
+void            crank_cplx_float_batch_exp_fast (const guint           n,
+                                                 const CrankCplxFloat *a,
+                                                 CrankCplxFloat       *r);
+
+void            crank_cplx_float_batch_cosh_fast (const guint           n,
+                                                  const CrankCplxFloat *a,
+                                                  CrankCplxFloat       *r);
+
+void            crank_cplx_float_batch_cos_fast (const guint           n,
+                                                 const CrankCplxFloat *a,
+                                                 CrankCplxFloat       *r);
+
 
 
 //////// Generic Selectors /////////////////////////////////////////////////////
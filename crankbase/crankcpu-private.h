@@ -0,0 +1,101 @@
+#ifndef CRANKCPU_PRIVATE_H
+#define CRANKCPU_PRIVATE_H
+
+/* Copyright (C) 2015, WSID   */
+
+/* Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/* This declares private functions */
+
+#ifndef _CRANKBASE_INSIDE
+#error crankcpu-private.h cannot be included directly.
+#endif
+
+#include <glib.h>
+
+#ifndef __GTK_DOC_IGNORE__
+
+G_BEGIN_DECLS
+
+//////// Architecture //////////////////////////////////////////////////////////
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define CRANK_CPU_X86 1
+#endif
+
+//////// CPU Features //////////////////////////////////////////////////////////
+
+typedef enum _CrankCpuFeature {
+  CRANK_CPU_FEATURE_SSE =     1 << 0,
+  CRANK_CPU_FEATURE_SSE2 =    1 << 1,
+  CRANK_CPU_FEATURE_AVX =     1 << 2,
+  CRANK_CPU_FEATURE_FMA =     1 << 3,
+  CRANK_CPU_FEATURE_AVX2 =    1 << 4,
+  CRANK_CPU_FEATURE_AVX512F = 1 << 5
+} CrankCpuFeature;
+
+G_GNUC_INTERNAL
+guint     _crank_cpu_get_features (void);
+
+G_GNUC_INTERNAL
+gboolean  _crank_cpu_has_feature  (const CrankCpuFeature feature);
+
+//////// SIMD Levels ///////////////////////////////////////////////////////////
+
+typedef enum _CrankCpuSimdLevel {
+  CRANK_CPU_SIMD_NONE,
+  CRANK_CPU_SIMD_SSE2,
+  CRANK_CPU_SIMD_AVX,
+  CRANK_CPU_SIMD_AVX2,
+  CRANK_CPU_SIMD_AVX512
+} CrankCpuSimdLevel;
+
+G_GNUC_INTERNAL
+CrankCpuSimdLevel _crank_cpu_get_simd_level (void);
+
+//////// Aligned Allocation ////////////////////////////////////////////////////
+
+// Alignment of allocated blocks: size of cache line, and widest register.
+#define CRANK_CPU_ALIGN 64
+
+G_GNUC_INTERNAL
+gpointer  _crank_cpu_alloc_aligned  (const gsize size);
+
+G_GNUC_INTERNAL
+gpointer  _crank_cpu_alloc0_aligned (const gsize size);
+
+// Aligned variants of CRANK_VEC_ALLOC() and CRANK_VEC_ALLOC0().
+#define CRANK_VEC_ALLOC_ALIGNED(v,G,_n)                                       \
+  G_STMT_START {                                                              \
+    (v)->data = _crank_cpu_alloc_aligned ((_n) * sizeof (G));                 \
+    (v)->n = _n;                                                              \
+  } G_STMT_END
+
+#define CRANK_VEC_ALLOC0_ALIGNED(v,G,_n)                                      \
+  G_STMT_START {                                                              \
+    (v)->data = _crank_cpu_alloc0_aligned ((_n) * sizeof (G));                \
+    (v)->n = _n;                                                              \
+  } G_STMT_END
+
+G_END_DECLS
+
+#endif
+
+#endif
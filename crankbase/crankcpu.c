@@ -0,0 +1,220 @@
+/* Copyright (C) 2015, WSID   */
+
+/* Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+#define _CRANKBASE_INSIDE
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <glib.h>
+
+#include "crankcpu-private.h"
+
+/*
+ * CPU feature detection for internal kernels.
+ *
+ * Features are queried once, and kept for the lifetime of process. As compiler
+ * builtins are used, it also checks whether operating system saves extended
+ * registers, before reporting AVX family.
+ *
+ * SIMD level summarizes features, for kernels that are written for a few
+ * instruction sets. It can be lowered by environment variable CRANK_SIMD, with
+ * one of "none", "sse2", "avx", "avx2" and "avx512", to test or to compare
+ * kernels.
+ */
+
+static guint
+crank_cpu_detect_features (void)
+{
+  guint features = 0;
+
+#ifdef CRANK_CPU_X86
+  __builtin_cpu_init ();
+
+  if (__builtin_cpu_supports ("sse"))
+    features |= CRANK_CPU_FEATURE_SSE;
+
+  if (__builtin_cpu_supports ("sse2"))
+    features |= CRANK_CPU_FEATURE_SSE2;
+
+  if (__builtin_cpu_supports ("avx"))
+    features |= CRANK_CPU_FEATURE_AVX;
+
+  if (__builtin_cpu_supports ("fma"))
+    features |= CRANK_CPU_FEATURE_FMA;
+
+  if (__builtin_cpu_supports ("avx2"))
+    features |= CRANK_CPU_FEATURE_AVX2;
+
+  if (__builtin_cpu_supports ("avx512f"))
+    features |= CRANK_CPU_FEATURE_AVX512F;
+#endif
+
+  return features;
+}
+
+/*
+ * _crank_cpu_get_features:
+ *
+ * Gets supported features of running CPU.
+ *
+ * Returns: Bitwise OR of #CrankCpuFeature.
+ */
+guint
+_crank_cpu_get_features (void)
+{
+  static gsize features = 0;
+
+  if (g_once_init_enter (&features))
+    {
+      // Keep a bit on, so that 0 can be used as "not detected".
+      gsize detected = crank_cpu_detect_features () | (1u << 31);
+
+      g_once_init_leave (&features, detected);
+    }
+
+  return (guint) features;
+}
+
+/*
+ * _crank_cpu_has_feature:
+ * @feature: A Feature to check.
+ *
+ * Checks whether running CPU supports given feature.
+ *
+ * Returns: Whether running CPU supports @feature.
+ */
+gboolean
+_crank_cpu_has_feature (const CrankCpuFeature feature)
+{
+  return (_crank_cpu_get_features () & feature) == feature;
+}
+
+/*
+ * _crank_cpu_get_simd_level:
+ *
+ * Gets highest SIMD level, that running CPU supports and CRANK_SIMD allows.
+ *
+ * Returns: A SIMD level.
+ */
+CrankCpuSimdLevel
+_crank_cpu_get_simd_level (void)
+{
+  static gsize level = 0;
+
+  if (g_once_init_enter (&level))
+    {
+      CrankCpuSimdLevel detected = CRANK_CPU_SIMD_NONE;
+      CrankCpuSimdLevel selected;
+      const gchar *env;
+
+      if (_crank_cpu_has_feature (CRANK_CPU_FEATURE_AVX512F |
+                                  CRANK_CPU_FEATURE_AVX2 |
+                                  CRANK_CPU_FEATURE_FMA))
+        detected = CRANK_CPU_SIMD_AVX512;
+
+      else if (_crank_cpu_has_feature (CRANK_CPU_FEATURE_AVX2 |
+                                       CRANK_CPU_FEATURE_FMA))
+        detected = CRANK_CPU_SIMD_AVX2;
+
+      else if (_crank_cpu_has_feature (CRANK_CPU_FEATURE_AVX))
+        detected = CRANK_CPU_SIMD_AVX;
+
+      else if (_crank_cpu_has_feature (CRANK_CPU_FEATURE_SSE2))
+        detected = CRANK_CPU_SIMD_SSE2;
+
+      selected = detected;
+      env = g_getenv ("CRANK_SIMD");
+
+      if (env != NULL && env[0] != '\0')
+        {
+          if (g_ascii_strcasecmp (env, "none") == 0)
+            selected = CRANK_CPU_SIMD_NONE;
+          else if (g_ascii_strcasecmp (env, "sse2") == 0)
+            selected = CRANK_CPU_SIMD_SSE2;
+          else if (g_ascii_strcasecmp (env, "avx") == 0)
+            selected = CRANK_CPU_SIMD_AVX;
+          else if (g_ascii_strcasecmp (env, "avx2") == 0)
+            selected = CRANK_CPU_SIMD_AVX2;
+          else if (g_ascii_strcasecmp (env, "avx512") == 0)
+            selected = CRANK_CPU_SIMD_AVX512;
+          else
+            g_warning ("CRANK_SIMD: Unknown level: %s", env);
+
+          if (detected < selected)
+            {
+              g_warning ("CRANK_SIMD: %s is not supported by CPU.", env);
+              selected = detected;
+            }
+        }
+
+      // Keep a bit on, so that 0 can be used as "not detected".
+      g_once_init_leave (&level, (gsize) selected | (1u << 31));
+    }
+
+  return (CrankCpuSimdLevel) (level & ~(1u << 31));
+}
+
+/*
+ * _crank_cpu_alloc_aligned:
+ * @size: Size of block in bytes.
+ *
+ * Allocates a memory block, aligned to %CRANK_CPU_ALIGN. The block can be
+ * freed with g_free(), as other blocks. On platforms without posix_memalign(),
+ * this falls back to g_malloc().
+ *
+ * Returns: (nullable): A Memory block, or %NULL if @size is 0.
+ */
+gpointer
+_crank_cpu_alloc_aligned (const gsize size)
+{
+#ifdef G_OS_UNIX
+  gpointer result;
+
+  if (size == 0)
+    return NULL;
+
+  if (G_UNLIKELY (posix_memalign (&result, CRANK_CPU_ALIGN, size) != 0))
+    g_error ("Failed to allocate %" G_GSIZE_FORMAT " bytes", size);
+
+  return result;
+#else
+  return g_malloc (size);
+#endif
+}
+
+/*
+ * _crank_cpu_alloc0_aligned:
+ * @size: Size of block in bytes.
+ *
+ * Allocates a memory block, aligned to %CRANK_CPU_ALIGN, and fills it with 0.
+ *
+ * Returns: (nullable): A Memory block, or %NULL if @size is 0.
+ */
+gpointer
+_crank_cpu_alloc0_aligned (const gsize size)
+{
+  gpointer result = _crank_cpu_alloc_aligned (size);
+
+  if (result != NULL)
+    memset (result, 0, size);
+
+  return result;
+}
@@ -28,6 +28,7 @@
 #include "crankbasemacro.h"
 #include "crankvalue.h"
 #include "crankdigraph.h"
+#include "crankdigraph-private.h"
 
 /**
  * SECTION: crankdigraph
@@ -54,6 +55,20 @@
  *
  * As nodes and edges are part of graph, memory management is done at graph
  * level. because of that, they don't have GType.
+ *
+ * # Indices and handles
+ *
+ * Nodes and edges know their index in graph, and edges know their position in
+ * edge lists of their nodes. So crank_digraph_index_of_node() and
+ * crank_digraph_index_of_edge() takes O(1), and removing a node takes time of
+ * its degree. Removal moves last node or edge into the place of removed one,
+ * so indices can be changed as graph changes.
+ *
+ * For references that outlive changes of graph, use #CrankDigraphHandle. A
+ * handle consists of slot and generation. Slots of removed nodes and edges are
+ * reused by later ones, but with increased generation, so that stale handles
+ * are not resolved by crank_digraph_lookup_node() or
+ * crank_digraph_lookup_edge().
  */
 
 G_DEFINE_BOXED_TYPE (CrankDigraph,
@@ -70,6 +85,12 @@ struct _CrankDigraph {
   GPtrArray *nodes;
   GPtrArray *edges;
 
+  GArray    *node_slots;
+  guint32    node_free;
+
+  GArray    *edge_slots;
+  guint32    edge_free;
+
   guint _refc;
 };
 
@@ -83,6 +104,9 @@ struct _CrankDigraphNode {
 
   GPtrArray *in_edges;
   GPtrArray *out_edges;
+
+  guint              index;
+  CrankDigraphHandle handle;
 };
 
 /**
@@ -95,8 +119,24 @@ struct _CrankDigraphEdge {
 
   CrankDigraphNode *tail;
   CrankDigraphNode *head;
+
+  guint              index;
+  guint              out_pos;   // Position in tail->out_edges
+  guint              in_pos;    // Position in head->in_edges
+  CrankDigraphHandle handle;
 };
 
+/*
+ * A slot for handle. Free slots are linked by next_free.
+ */
+typedef struct _CrankDigraphSlot {
+  gpointer item;
+  guint32  generation;
+  guint32  next_free;
+} CrankDigraphSlot;
+
+#define CRANK_DIGRAPH_SLOT_NONE G_MAXUINT32
+
 
 //////// Internal Declaration //////////////////////////////////////////////////
 
@@ -110,6 +150,21 @@ CrankDigraphEdge *crank_digraph_edge_new (const GValue     *data,
 
 void              crank_digraph_edge_free (CrankDigraphEdge *edge);
 
+static CrankDigraphHandle crank_digraph_slot_acquire (GArray   *slots,
+                                                      guint32  *free_head,
+                                                      gpointer  item);
+
+static void       crank_digraph_slot_release (GArray             *slots,
+                                              guint32            *free_head,
+                                              CrankDigraphHandle  handle);
+
+static gpointer   crank_digraph_slot_lookup (GArray             *slots,
+                                             CrankDigraphHandle  handle);
+
+static void       crank_digraph_edge_list_remove (GPtrArray      *list,
+                                                  const guint     pos,
+                                                  const gboolean  out);
+
 //////// Definition ////////////////////////////////////////////////////////////
 
 /**
@@ -129,6 +184,12 @@ crank_digraph_new (void)
   graph->edges = g_ptr_array_new_with_free_func (
     (GDestroyNotify)crank_digraph_edge_free);
 
+  graph->node_slots = g_array_new (FALSE, FALSE, sizeof (CrankDigraphSlot));
+  graph->node_free = CRANK_DIGRAPH_SLOT_NONE;
+
+  graph->edge_slots = g_array_new (FALSE, FALSE, sizeof (CrankDigraphSlot));
+  graph->edge_free = CRANK_DIGRAPH_SLOT_NONE;
+
   graph->_refc = 1;
 
   return graph;
@@ -221,6 +282,8 @@ crank_digraph_unref (CrankDigraph *graph)
     {
       g_ptr_array_free (graph->nodes, TRUE);
       g_ptr_array_free (graph->edges, TRUE);
+      g_array_free (graph->node_slots, TRUE);
+      g_array_free (graph->edge_slots, TRUE);
       g_free (graph);
     }
 }
@@ -260,9 +323,11 @@ crank_digraph_get_edges (CrankDigraph *graph)
  * @node: A node.
  *
  * Gets index of node in graph. The index can be used with adjacency matrices.
+ * This takes O(1).
  *
  * Note:
- * The index can be changed as graph changes.
+ * The index can be changed as graph changes. Use
+ * crank_digraph_node_get_handle() to refer node over changes.
  *
  * Returns: Index of node in graph. If node is not in graph, -1 is returned.
  */
@@ -270,11 +335,10 @@ gint
 crank_digraph_index_of_node (CrankDigraph     *graph,
                              CrankDigraphNode *node)
 {
-  gint i;
-
-  for (i = 0; i < graph->nodes->len; i++)
-    if (node == graph->nodes->pdata[i])
-      return i;
+  if ((node != NULL) &&
+      (node->index < graph->nodes->len) &&
+      (graph->nodes->pdata[node->index] == node))
+    return node->index;
 
   return -1;
 }
@@ -284,10 +348,11 @@ crank_digraph_index_of_node (CrankDigraph     *graph,
  * @graph: A digraph.
  * @edge: An edge.
  *
- * Gets index of edge in graph.
+ * Gets index of edge in graph. This takes O(1).
  *
  * Note:
- * The index can be changed as graph changes.
+ * The index can be changed as graph changes. Use
+ * crank_digraph_edge_get_handle() to refer edge over changes.
  *
  * Returns: Index of edge in graph. If edge is not in graph, -1 is returned.
  */
@@ -295,11 +360,10 @@ gint
 crank_digraph_index_of_edge (CrankDigraph     *graph,
                              CrankDigraphEdge *edge)
 {
-  gint i;
-
-  for (i = 0; i < graph->edges->len; i++)
-    if (edge == graph->edges->pdata[i])
-      return i;
+  if ((edge != NULL) &&
+      (edge->index < graph->edges->len) &&
+      (graph->edges->pdata[edge->index] == edge))
+    return edge->index;
 
   return -1;
 }
@@ -350,6 +414,42 @@ crank_digraph_nth_edge (CrankDigraph *graph,
     return NULL;
 }
 
+/**
+ * crank_digraph_lookup_node:
+ * @graph: A digraph.
+ * @handle: A handle of node.
+ *
+ * Gets a node by its handle. This takes O(1).
+ *
+ * Returns: (transfer none) (nullable): The node of handle, or %NULL if node
+ *        was removed.
+ */
+CrankDigraphNode*
+crank_digraph_lookup_node (CrankDigraph       *graph,
+                           CrankDigraphHandle  handle)
+{
+  return (CrankDigraphNode*) crank_digraph_slot_lookup (graph->node_slots,
+                                                        handle);
+}
+
+/**
+ * crank_digraph_lookup_edge:
+ * @graph: A digraph.
+ * @handle: A handle of edge.
+ *
+ * Gets an edge by its handle. This takes O(1).
+ *
+ * Returns: (transfer none) (nullable): The edge of handle, or %NULL if edge
+ *        was removed.
+ */
+CrankDigraphEdge*
+crank_digraph_lookup_edge (CrankDigraph       *graph,
+                           CrankDigraphHandle  handle)
+{
+  return (CrankDigraphEdge*) crank_digraph_slot_lookup (graph->edge_slots,
+                                                        handle);
+}
+
 /**
  * crank_digraph_add:
  * @graph: A digraph.
@@ -365,6 +465,11 @@ crank_digraph_add (CrankDigraph *graph,
 {
   CrankDigraphNode *node = crank_digraph_node_new (value);
 
+  node->index = graph->nodes->len;
+  node->handle = crank_digraph_slot_acquire (graph->node_slots,
+                                             &graph->node_free,
+                                             node);
+
   g_ptr_array_add (graph->nodes, node);
 
   return node;
@@ -376,30 +481,37 @@ crank_digraph_add (CrankDigraph *graph,
  * @node: A node to remove.
  *
  * Removes a node from graph. All connected edges to the nodes are removed also.
+ *
+ * This takes time of degree of @node. Last node in graph is moved to index of
+ * @node.
  */
 void
 crank_digraph_remove (CrankDigraph     *graph,
                       CrankDigraphNode *node)
 {
-  guint i;
+  guint index = node->index;
 
-  for (i = 0; i < node->in_edges->len; i++)
-    {
-      CrankDigraphEdge *e = node->in_edges->pdata [i];
+  g_return_if_fail (crank_digraph_index_of_node (graph, node) != -1);
 
-      g_ptr_array_remove_fast (e->tail->out_edges, e);
-      g_ptr_array_remove_fast (graph->edges, e);
-    }
+  // Edges are removed from back, so that edge lists are not shifted.
+  while (node->in_edges->len != 0)
+    crank_digraph_disconnect_edge (
+        graph,
+        node->in_edges->pdata[node->in_edges->len - 1]);
 
-  for (i = 0; i < node->out_edges->len; i++)
-    {
-      CrankDigraphEdge *e = node->out_edges->pdata [i];
+  while (node->out_edges->len != 0)
+    crank_digraph_disconnect_edge (
+        graph,
+        node->out_edges->pdata[node->out_edges->len - 1]);
 
-      g_ptr_array_remove_fast (e->head->in_edges, e);
-      g_ptr_array_remove_fast (graph->edges, e);
-    }
+  crank_digraph_slot_release (graph->node_slots,
+                              &graph->node_free,
+                              node->handle);
+
+  g_ptr_array_remove_index_fast (graph->nodes, index);
 
-  g_ptr_array_remove_fast (graph->nodes, node);
+  if (index < graph->nodes->len)
+    ((CrankDigraphNode*) graph->nodes->pdata[index])->index = index;
 }
 
 /**
@@ -431,6 +543,14 @@ crank_digraph_connect (CrankDigraph     *graph,
     }
 
   edge = crank_digraph_edge_new (edge_value, tail, head);
+
+  edge->index = graph->edges->len;
+  edge->out_pos = tail->out_edges->len;
+  edge->in_pos = head->in_edges->len;
+  edge->handle = crank_digraph_slot_acquire (graph->edge_slots,
+                                             &graph->edge_free,
+                                             edge);
+
   g_ptr_array_add (tail->out_edges, edge);
   g_ptr_array_add (head->in_edges, edge);
   g_ptr_array_add (graph->edges, edge);
@@ -475,15 +595,29 @@ crank_digraph_disconnect (CrankDigraph     *graph,
  * @graph: A digraph.
  * @e: A edge to remove.
  *
- * Removes a edge from digraph.
+ * Removes a edge from digraph. This takes O(1).
+ *
+ * Last edge in graph is moved to index of @e.
  */
 void
 crank_digraph_disconnect_edge (CrankDigraph     *graph,
                                CrankDigraphEdge *e)
 {
-  g_ptr_array_remove_fast (e->tail->out_edges, e);
-  g_ptr_array_remove_fast (e->head->in_edges, e);
-  g_ptr_array_remove_fast (graph->edges, e);
+  guint index = e->index;
+
+  g_return_if_fail (crank_digraph_index_of_edge (graph, e) != -1);
+
+  crank_digraph_edge_list_remove (e->tail->out_edges, e->out_pos, TRUE);
+  crank_digraph_edge_list_remove (e->head->in_edges, e->in_pos, FALSE);
+
+  crank_digraph_slot_release (graph->edge_slots,
+                              &graph->edge_free,
+                              e->handle);
+
+  g_ptr_array_remove_index_fast (graph->edges, index);
+
+  if (index < graph->edges->len)
+    ((CrankDigraphEdge*) graph->edges->pdata[index])->index = index;
 }
 
 /**
@@ -510,8 +644,13 @@ crank_digraph_reverse (CrankDigraph *graph)
       CrankDigraphEdge *edge = (CrankDigraphEdge*) graph->edges->pdata[i];
 
       CrankDigraphNode *temp = edge->head;
+      guint temp_pos = edge->in_pos;
+
       edge->head = edge->tail;
       edge->tail = temp;
+
+      edge->in_pos = edge->out_pos;
+      edge->out_pos = temp_pos;
     }
 }
 
@@ -545,14 +684,14 @@ crank_digraph_copy (CrankDigraph *graph)
 
   for (i = 0; i < graph->edges->len; i++)
     {
-      CrankDigraphEdge* edge = graph->nodes->pdata[i];
+      CrankDigraphEdge* edge = graph->edges->pdata[i];
       CrankDigraphNode *tail;
       CrankDigraphNode *head;
 
       tail = (CrankDigraphNode*) g_hash_table_lookup (table, edge->tail);
       head = (CrankDigraphNode*) g_hash_table_lookup (table, edge->head);
 
-      crank_digraph_connect (graph, tail, head, &edge->data);
+      crank_digraph_connect (clone, tail, head, &edge->data);
     }
 
   g_hash_table_unref (table);
@@ -719,6 +858,21 @@ crank_digraph_node_get_outdegree (CrankDigraphNode *node)
   return node->out_edges->len;
 }
 
+/**
+ * crank_digraph_node_get_handle:
+ * @node: A node.
+ *
+ * Gets handle of this node. Handle does not change while node is in graph,
+ * and does not resolve to other node after node is removed.
+ *
+ * Returns: Handle of this node.
+ */
+CrankDigraphHandle
+crank_digraph_node_get_handle (CrankDigraphNode *node)
+{
+  return node->handle;
+}
+
 /**
  * crank_digraph_node_is_adjacent:
  * @node: A node.
@@ -983,6 +1137,21 @@ crank_digraph_edge_get_head (CrankDigraphEdge *edge)
   return edge->head;
 }
 
+/**
+ * crank_digraph_edge_get_handle:
+ * @edge: An edge.
+ *
+ * Gets handle of this edge. Handle does not change while edge is in graph,
+ * and does not resolve to other edge after edge is removed.
+ *
+ * Returns: Handle of this edge.
+ */
+CrankDigraphHandle
+crank_digraph_edge_get_handle (CrankDigraphEdge *edge)
+{
+  return edge->handle;
+}
+
 
 
 /**
@@ -1530,6 +1699,19 @@ crank_digraph_edge__gi_get_data (CrankDigraphEdge *edge)
 
 //////// Internal Functions ////////
 
+/*
+ * _crank_digraph_node_get_index: (private)
+ * @node: A node.
+ *
+ * Gets index of node in its graph, without checking graph. Searches use this
+ * to keep their state in arrays.
+ */
+guint
+_crank_digraph_node_get_index (CrankDigraphNode *node)
+{
+  return node->index;
+}
+
 /*
  * crank_digraph_node_new: (private)
  * @value: Value.
@@ -1555,6 +1737,9 @@ crank_digraph_node_free (CrankDigraphNode *node)
   if (G_IS_VALUE (&node->data))
     g_value_unset (&node->data);
 
+  g_ptr_array_unref (node->in_edges);
+  g_ptr_array_unref (node->out_edges);
+
   g_slice_free (CrankDigraphNode, node);
 }
 
@@ -1588,3 +1773,90 @@ crank_digraph_edge_free (CrankDigraphEdge *edge)
 
   g_slice_free (CrankDigraphEdge, edge);
 }
+
+/*
+ * Takes a slot from free list, or appends new slot, and gets handle for it.
+ * Generation of slot is never 0, so that 0 is never a valid handle.
+ */
+static CrankDigraphHandle
+crank_digraph_slot_acquire (GArray   *slots,
+                            guint32  *free_head,
+                            gpointer  item)
+{
+  CrankDigraphSlot *slot;
+  guint32 index;
+
+  if (*free_head != CRANK_DIGRAPH_SLOT_NONE)
+    {
+      index = *free_head;
+      slot = & g_array_index (slots, CrankDigraphSlot, index);
+      *free_head = slot->next_free;
+    }
+  else
+    {
+      CrankDigraphSlot new_slot = {NULL, 1, CRANK_DIGRAPH_SLOT_NONE};
+
+      index = slots->len;
+      g_array_append_val (slots, new_slot);
+      slot = & g_array_index (slots, CrankDigraphSlot, index);
+    }
+
+  slot->item = item;
+  slot->next_free = CRANK_DIGRAPH_SLOT_NONE;
+
+  return (((CrankDigraphHandle) slot->generation) << 32) | index;
+}
+
+static void
+crank_digraph_slot_release (GArray             *slots,
+                            guint32            *free_head,
+                            CrankDigraphHandle  handle)
+{
+  guint32 index = (guint32) handle;
+  CrankDigraphSlot *slot = & g_array_index (slots, CrankDigraphSlot, index);
+
+  slot->item = NULL;
+  slot->generation++;
+  if (slot->generation == 0)
+    slot->generation = 1;
+
+  slot->next_free = *free_head;
+  *free_head = index;
+}
+
+static gpointer
+crank_digraph_slot_lookup (GArray             *slots,
+                           CrankDigraphHandle  handle)
+{
+  guint32 index = (guint32) handle;
+  guint32 generation = (guint32) (handle >> 32);
+  CrankDigraphSlot *slot;
+
+  if (slots->len <= index)
+    return NULL;
+
+  slot = & g_array_index (slots, CrankDigraphSlot, index);
+
+  return (slot->generation == generation) ? slot->item : NULL;
+}
+
+/*
+ * Removes an edge at pos from edge list of a node, by moving last edge to pos.
+ */
+static void
+crank_digraph_edge_list_remove (GPtrArray      *list,
+                                const guint     pos,
+                                const gboolean  out)
+{
+  g_ptr_array_remove_index_fast (list, pos);
+
+  if (pos < list->len)
+    {
+      CrankDigraphEdge *moved = (CrankDigraphEdge*) list->pdata[pos];
+
+      if (out)
+        moved->out_pos = pos;
+      else
+        moved->in_pos = pos;
+    }
+}
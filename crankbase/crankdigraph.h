@@ -39,6 +39,24 @@ typedef struct _CrankDigraphEdge CrankDigraphEdge;
 GType crank_digraph_get_type (void);
 
 
+/**
+ * CrankDigraphHandle:
+ *
+ * A stable handle for #CrankDigraphNode or #CrankDigraphEdge.
+ *
+ * Handles does not change as graph changes, and handles of removed nodes or
+ * edges are never resolved to other ones. 0 is never a valid handle.
+ */
+typedef guint64 CrankDigraphHandle;
+
+/**
+ * CRANK_DIGRAPH_HANDLE_NONE:
+ *
+ * A handle that does not refer any node or edge.
+ */
+#define CRANK_DIGRAPH_HANDLE_NONE ((CrankDigraphHandle) 0)
+
+
 typedef struct _CrankDigraphEdgeIndex CrankDigraphEdgeIndex;
 
 /**
@@ -104,6 +122,12 @@ CrankDigraphNode *crank_digraph_nth_node (CrankDigraph *graph,
 CrankDigraphEdge *crank_digraph_nth_edge (CrankDigraph *graph,
                                           guint         index);
 
+CrankDigraphNode *crank_digraph_lookup_node (CrankDigraph       *graph,
+                                             CrankDigraphHandle  handle);
+
+CrankDigraphEdge *crank_digraph_lookup_edge (CrankDigraph       *graph,
+                                             CrankDigraphHandle  handle);
+
 
 CrankDigraphNode *crank_digraph_add (CrankDigraph *graph,
                                      const GValue *value);
@@ -152,6 +176,8 @@ guint             crank_digraph_node_get_indegree (CrankDigraphNode *node);
 
 guint             crank_digraph_node_get_outdegree(CrankDigraphNode *node);
 
+CrankDigraphHandle crank_digraph_node_get_handle (CrankDigraphNode *node);
+
 
 
 gboolean          crank_digraph_node_is_adjacent (CrankDigraphNode *node,
@@ -189,6 +215,8 @@ CrankDigraphNode *crank_digraph_edge_get_tail (CrankDigraphEdge *edge);
 
 CrankDigraphNode *crank_digraph_edge_get_head (CrankDigraphEdge *edge);
 
+CrankDigraphHandle crank_digraph_edge_get_handle (CrankDigraphEdge *edge);
+
 
 
 
@@ -0,0 +1,1287 @@
+/* Copyright (C) 2015, WSID   */
+
+/* Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#define _CRANKBASE_INSIDE
+
+#include <math.h>
+#include <string.h>
+
+#include <glib.h>
+#include <glib-object.h>
+
+#include "crankbasemacro.h"
+#include "crankindexheap.h"
+#include "crankparallel.h"
+#include "crankdigraph.h"
+#include "crankadvgraph.h"
+#include "crankdigraphfrozen.h"
+
+/**
+ * SECTION: crankdigraphfrozen
+ * @title: CrankDigraphFrozen
+ * @short_description: Immutable compressed sparse row view of digraph.
+ * @stability: Unstable
+ * @include: crankbase.h
+ *
+ * #CrankDigraph keeps each node and edge as separated allocation, so that
+ * graph can be changed freely. But traversal over it chases pointers, and
+ * searches should map nodes to their states by hash tables.
+ *
+ * #CrankDigraphFrozen is a snapshot of digraph for read-mostly use, which is
+ * made by crank_digraph_freeze(). In snapshot, nodes are numbered by their
+ * index in graph, and edges are stored in compressed sparse row form.
+ *
+ * * Outgoing edges of node i are at [out_offsets[i], out_offsets[i + 1]) of
+ *   out_heads and out_weights.
+ * * Incoming edges of node i are at [in_offsets[i], in_offsets[i + 1]) of
+ *   in_tails and in_weights. in_edges maps them to outgoing edge indices.
+ *
+ * Edge weights are evaluated once on freezing, by given function.
+ *
+ * # Searches on snapshot
+ *
+ * Traversals and path finding on snapshot work with node indices. Work arrays
+ * for them are kept in snapshot and reused by following searches, so that
+ * repeated queries do not allocate or clear arrays of size of graph. Searches
+ * may run from multiple threads on same snapshot.
+ *
+ * # Batched queries
+ *
+ * Some queries share one search for multiple nodes.
+ *
+ * * crank_digraph_frozen_dijkstra_nearest() finds the path from nearest source
+ *   to nearest goal, by one search from all sources.
+ * * crank_digraph_frozen_distances() writes distances from sources to all
+ *   nodes, into caller supplied array. crank_digraph_frozen_distances_to()
+ *   writes distances from all nodes to targets.
+ * * crank_digraph_frozen_distance_table() gets distances between all pairs of
+ *   sources and targets. It runs one search per source, or one search per
+ *   target over incoming edges if there are less targets. Each search stops
+ *   when all of other side are reached. Searches run on worker threads with
+ *   crank_digraph_frozen_distance_table_parallel().
+ *
+ * # Changes to graph
+ *
+ * Snapshot does not follow changes of graph after freezing. Take a new
+ * snapshot after changes. Snapshot holds a reference to graph, but nodes and
+ * edges removed from graph should not be accessed through snapshot.
+ */
+
+G_DEFINE_BOXED_TYPE (CrankDigraphFrozen,
+                     crank_digraph_frozen,
+                     crank_digraph_frozen_ref,
+                     crank_digraph_frozen_unref);
+
+#define CRANK_DIGRAPH_FROZEN_NONE G_MAXUINT
+
+typedef struct _CrankDigraphFrozenTableArgs {
+  CrankDigraphFrozen *frozen;
+
+  const guint        *sources;
+  guint               nsources;
+  const guint        *targets;
+  guint               ntargets;
+
+  gfloat             *table;
+  gboolean            reverse;
+} CrankDigraphFrozenTableArgs;
+
+/*
+ * Work arrays for a search. Entries of arrays are valid only if their stamp
+ * equals to current stamp, so arrays need not to be cleared for each search.
+ */
+typedef struct _CrankDigraphFrozenScratch {
+  guint           stamp;
+
+  guint          *seen;
+  guint          *closed;
+  guint          *mark;
+  gfloat         *dist;
+  guint          *prev;
+  guint          *queue;
+
+  CrankIndexHeap  open;
+} CrankDigraphFrozenScratch;
+
+/**
+ * CrankDigraphFrozen:
+ *
+ * A structure for immutable view of digraph.
+ */
+struct _CrankDigraphFrozen {
+  CrankDigraph      *graph;
+
+  guint              nnodes;
+  guint              nedges;
+
+  CrankDigraphNode **nodes;
+  CrankDigraphEdge **edges;
+  GHashTable        *indices; // HashTable<CrankDigraphNode, index + 1>
+
+  guint             *out_offsets;
+  guint             *out_heads;
+  gfloat            *out_weights;
+
+  guint             *in_offsets;
+  guint             *in_tails;
+  gfloat            *in_weights;
+  guint             *in_edges;
+
+  GMutex             scratch_mutex;
+  GSList            *scratches; // SList<CrankDigraphFrozenScratch>
+
+  guint              _refc;
+};
+
+
+//////// Private functions /////////////////////////////////////////////////////
+
+static CrankDigraphFrozenScratch *crank_digraph_frozen_acquire (CrankDigraphFrozen *frozen);
+
+static void crank_digraph_frozen_restamp (CrankDigraphFrozen        *frozen,
+                                          CrankDigraphFrozenScratch *scratch);
+
+static void crank_digraph_frozen_release (CrankDigraphFrozen        *frozen,
+                                          CrankDigraphFrozenScratch *scratch);
+
+static void crank_digraph_frozen_scratch_free (gpointer scratch);
+
+static guint crank_digraph_frozen_mark (CrankDigraphFrozenScratch *scratch,
+                                        const guint               *indices,
+                                        const guint                nindices);
+
+static guint crank_digraph_frozen_run (CrankDigraphFrozen            *frozen,
+                                       CrankDigraphFrozenScratch     *scratch,
+                                       const gboolean                 reverse,
+                                       const guint                   *sources,
+                                       const guint                    nsources,
+                                       const guint                    stop_count,
+                                       CrankDigraphIndexHeuristicFunc heuristic_func,
+                                       gpointer                       heuristic_userdata,
+                                       const guint                    to);
+
+static void crank_digraph_frozen_build_path (CrankDigraphFrozenScratch *scratch,
+                                             const guint                index,
+                                             GArray                    *path);
+
+static gboolean crank_digraph_frozen_search (CrankDigraphFrozen            *frozen,
+                                             const guint                    from,
+                                             const guint                    to,
+                                             CrankDigraphIndexHeuristicFunc heuristic_func,
+                                             gpointer                       heuristic_userdata,
+                                             GArray                        *path,
+                                             gfloat                        *cost);
+
+static void crank_digraph_frozen_distance_table_range (const guint start,
+                                                       const guint end,
+                                                       gpointer    userdata);
+
+
+//////// Construction //////////////////////////////////////////////////////////
+
+/**
+ * crank_digraph_freeze:
+ * @graph: A digraph.
+ * @edge_func: (nullable) (scope call) (closure userdata): Weight function for
+ *     edges.
+ * @userdata: Userdata for @edge_func.
+ *
+ * Takes a compressed sparse row snapshot of @graph. Nodes are numbered by
+ * their index in @graph.
+ *
+ * Weight of each edge is evaluated by @edge_func. If @edge_func is %NULL,
+ * edges holding #gfloat use the value as weight, and others have weight of 1.
+ *
+ * Returns: (transfer full): Snapshot of @graph.
+ */
+CrankDigraphFrozen*
+crank_digraph_freeze (CrankDigraph              *graph,
+                      CrankDigraphEdgeFloatFunc  edge_func,
+                      gpointer                   userdata)
+{
+  CrankDigraphFrozen *frozen;
+  GPtrArray *nodes;
+  guint *cursor;
+  guint i;
+  guint k;
+
+  frozen = g_new (CrankDigraphFrozen, 1);
+  nodes = crank_digraph_get_nodes (graph);
+
+  frozen->graph = crank_digraph_ref (graph);
+  frozen->nnodes = nodes->len;
+  frozen->nedges = crank_digraph_get_edges (graph)->len;
+
+  frozen->nodes = g_new (CrankDigraphNode*, frozen->nnodes);
+  frozen->edges = g_new (CrankDigraphEdge*, frozen->nedges);
+  frozen->indices = g_hash_table_new (g_direct_hash, g_direct_equal);
+
+  frozen->out_offsets = g_new (guint, frozen->nnodes + 1);
+  frozen->out_heads = g_new (guint, frozen->nedges);
+  frozen->out_weights = g_new (gfloat, frozen->nedges);
+
+  frozen->in_offsets = g_new0 (guint, frozen->nnodes + 1);
+  frozen->in_tails = g_new (guint, frozen->nedges);
+  frozen->in_weights = g_new (gfloat, frozen->nedges);
+  frozen->in_edges = g_new (guint, frozen->nedges);
+
+  g_mutex_init (&frozen->scratch_mutex);
+  frozen->scratches = NULL;
+
+  frozen->_refc = 1;
+
+  for (i = 0; i < frozen->nnodes; i++)
+    {
+      frozen->nodes[i] = (CrankDigraphNode*) nodes->pdata[i];
+      g_hash_table_insert (frozen->indices,
+                           frozen->nodes[i],
+                           GUINT_TO_POINTER (i + 1));
+    }
+
+  // Outgoing edges, in order of nodes.
+  k = 0;
+  for (i = 0; i < frozen->nnodes; i++)
+    {
+      GPtrArray *out_edges = crank_digraph_node_get_out_edges (frozen->nodes[i]);
+      guint j;
+
+      frozen->out_offsets[i] = k;
+
+      for (j = 0; j < out_edges->len; j++)
+        {
+          CrankDigraphEdge *edge = (CrankDigraphEdge*) out_edges->pdata[j];
+          CrankDigraphNode *head = crank_digraph_edge_get_head (edge);
+          gfloat weight;
+
+          if (edge_func != NULL)
+            weight = edge_func (edge, userdata);
+          else if (crank_digraph_edge_type_of (edge) == G_TYPE_FLOAT)
+            weight = crank_digraph_edge_get_float (edge);
+          else
+            weight = 1.0f;
+
+          frozen->edges[k] = edge;
+          frozen->out_heads[k] =
+            GPOINTER_TO_UINT (g_hash_table_lookup (frozen->indices, head)) - 1;
+          frozen->out_weights[k] = weight;
+          frozen->in_offsets[frozen->out_heads[k] + 1]++;
+          k++;
+        }
+    }
+  frozen->out_offsets[frozen->nnodes] = k;
+
+  // Incoming edges, by scattering outgoing edges.
+  for (i = 0; i < frozen->nnodes; i++)
+    frozen->in_offsets[i + 1] += frozen->in_offsets[i];
+
+  cursor = g_memdup (frozen->in_offsets, sizeof (guint) * frozen->nnodes);
+
+  for (i = 0; i < frozen->nnodes; i++)
+    {
+      for (k = frozen->out_offsets[i]; k < frozen->out_offsets[i + 1]; k++)
+        {
+          guint pos = cursor[frozen->out_heads[k]]++;
+
+          frozen->in_tails[pos] = i;
+          frozen->in_weights[pos] = frozen->out_weights[k];
+          frozen->in_edges[pos] = k;
+        }
+    }
+
+  g_free (cursor);
+
+  return frozen;
+}
+
+/**
+ * crank_digraph_frozen_ref:
+ * @frozen: A snapshot.
+ *
+ * Increase reference count by 1.
+ *
+ * Returns: (transfer full): A snapshot with increased reference count.
+ */
+CrankDigraphFrozen*
+crank_digraph_frozen_ref (CrankDigraphFrozen *frozen)
+{
+  g_atomic_int_inc (&(frozen->_refc));
+  return frozen;
+}
+
+/**
+ * crank_digraph_frozen_unref:
+ * @frozen: (transfer full): A snapshot.
+ *
+ * Decreases reference count by 1. If reference count reaches 0, then snapshot
+ * is freed.
+ */
+void
+crank_digraph_frozen_unref (CrankDigraphFrozen *frozen)
+{
+  if (g_atomic_int_dec_and_test (&frozen->_refc))
+    {
+      g_slist_free_full (frozen->scratches, crank_digraph_frozen_scratch_free);
+      g_mutex_clear (&frozen->scratch_mutex);
+
+      g_free (frozen->nodes);
+      g_free (frozen->edges);
+      g_hash_table_unref (frozen->indices);
+
+      g_free (frozen->out_offsets);
+      g_free (frozen->out_heads);
+      g_free (frozen->out_weights);
+
+      g_free (frozen->in_offsets);
+      g_free (frozen->in_tails);
+      g_free (frozen->in_weights);
+      g_free (frozen->in_edges);
+
+      crank_digraph_unref (frozen->graph);
+      g_free (frozen);
+    }
+}
+
+
+//////// Properties ////////////////////////////////////////////////////////////
+
+/**
+ * crank_digraph_frozen_get_graph:
+ * @frozen: A snapshot.
+ *
+ * Gets the graph that snapshot was taken from.
+ *
+ * Returns: (transfer none): The graph.
+ */
+CrankDigraph*
+crank_digraph_frozen_get_graph (CrankDigraphFrozen *frozen)
+{
+  return frozen->graph;
+}
+
+/**
+ * crank_digraph_frozen_get_nnodes:
+ * @frozen: A snapshot.
+ *
+ * Gets count of nodes.
+ *
+ * Returns: Count of nodes.
+ */
+guint
+crank_digraph_frozen_get_nnodes (CrankDigraphFrozen *frozen)
+{
+  return frozen->nnodes;
+}
+
+/**
+ * crank_digraph_frozen_get_nedges:
+ * @frozen: A snapshot.
+ *
+ * Gets count of edges.
+ *
+ * Returns: Count of edges.
+ */
+guint
+crank_digraph_frozen_get_nedges (CrankDigraphFrozen *frozen)
+{
+  return frozen->nedges;
+}
+
+/**
+ * crank_digraph_frozen_get_node:
+ * @frozen: A snapshot.
+ * @index: Index of node.
+ *
+ * Gets a node at index.
+ *
+ * Returns: (transfer none) (nullable): The node at the index or %NULL if index
+ *        is out of bound.
+ */
+CrankDigraphNode*
+crank_digraph_frozen_get_node (CrankDigraphFrozen *frozen,
+                               const guint         index)
+{
+  return (index < frozen->nnodes) ? frozen->nodes[index] : NULL;
+}
+
+/**
+ * crank_digraph_frozen_get_edge:
+ * @frozen: A snapshot.
+ * @index: Index of edge, in order of outgoing edges.
+ *
+ * Gets a edge at index.
+ *
+ * Returns: (transfer none) (nullable): The edge at the index or %NULL if index
+ *        is out of bound.
+ */
+CrankDigraphEdge*
+crank_digraph_frozen_get_edge (CrankDigraphFrozen *frozen,
+                               const guint         index)
+{
+  return (index < frozen->nedges) ? frozen->edges[index] : NULL;
+}
+
+/**
+ * crank_digraph_frozen_index_of_node:
+ * @frozen: A snapshot.
+ * @node: A node.
+ *
+ * Gets index of node in snapshot.
+ *
+ * Returns: Index of node. If node is not in snapshot, -1 is returned.
+ */
+gint
+crank_digraph_frozen_index_of_node (CrankDigraphFrozen *frozen,
+                                    CrankDigraphNode   *node)
+{
+  return (gint) GPOINTER_TO_UINT (g_hash_table_lookup (frozen->indices,
+                                                       node)) - 1;
+}
+
+
+//////// Compressed Sparse Rows ////////////////////////////////////////////////
+
+/**
+ * crank_digraph_frozen_get_out_offsets: (skip)
+ * @frozen: A snapshot.
+ *
+ * Gets offsets of outgoing edges of each node. This has nnodes + 1 items.
+ *
+ * Returns: (transfer none): Offsets of outgoing edges.
+ */
+const guint*
+crank_digraph_frozen_get_out_offsets (CrankDigraphFrozen *frozen)
+{
+  return frozen->out_offsets;
+}
+
+/**
+ * crank_digraph_frozen_get_out_heads: (skip)
+ * @frozen: A snapshot.
+ *
+ * Gets head node indices of outgoing edges. This has nedges items.
+ *
+ * Returns: (transfer none): Head node indices.
+ */
+const guint*
+crank_digraph_frozen_get_out_heads (CrankDigraphFrozen *frozen)
+{
+  return frozen->out_heads;
+}
+
+/**
+ * crank_digraph_frozen_get_out_weights: (skip)
+ * @frozen: A snapshot.
+ *
+ * Gets weights of outgoing edges. This has nedges items.
+ *
+ * Returns: (transfer none): Weights of outgoing edges.
+ */
+const gfloat*
+crank_digraph_frozen_get_out_weights (CrankDigraphFrozen *frozen)
+{
+  return frozen->out_weights;
+}
+
+/**
+ * crank_digraph_frozen_get_in_offsets: (skip)
+ * @frozen: A snapshot.
+ *
+ * Gets offsets of incoming edges of each node. This has nnodes + 1 items.
+ *
+ * Returns: (transfer none): Offsets of incoming edges.
+ */
+const guint*
+crank_digraph_frozen_get_in_offsets (CrankDigraphFrozen *frozen)
+{
+  return frozen->in_offsets;
+}
+
+/**
+ * crank_digraph_frozen_get_in_tails: (skip)
+ * @frozen: A snapshot.
+ *
+ * Gets tail node indices of incoming edges. This has nedges items.
+ *
+ * Returns: (transfer none): Tail node indices.
+ */
+const guint*
+crank_digraph_frozen_get_in_tails (CrankDigraphFrozen *frozen)
+{
+  return frozen->in_tails;
+}
+
+/**
+ * crank_digraph_frozen_get_in_weights: (skip)
+ * @frozen: A snapshot.
+ *
+ * Gets weights of incoming edges. This has nedges items.
+ *
+ * Returns: (transfer none): Weights of incoming edges.
+ */
+const gfloat*
+crank_digraph_frozen_get_in_weights (CrankDigraphFrozen *frozen)
+{
+  return frozen->in_weights;
+}
+
+/**
+ * crank_digraph_frozen_get_in_edges: (skip)
+ * @frozen: A snapshot.
+ *
+ * Gets outgoing edge indices of incoming edges. This has nedges items.
+ *
+ * Returns: (transfer none): Outgoing edge indices.
+ */
+const guint*
+crank_digraph_frozen_get_in_edges (CrankDigraphFrozen *frozen)
+{
+  return frozen->in_edges;
+}
+
+/**
+ * crank_digraph_frozen_get_outdegree:
+ * @frozen: A snapshot.
+ * @index: Index of node.
+ *
+ * Gets outdegree of node.
+ *
+ * Returns: Outdegree of node.
+ */
+guint
+crank_digraph_frozen_get_outdegree (CrankDigraphFrozen *frozen,
+                                    const guint         index)
+{
+  g_return_val_if_fail (index < frozen->nnodes, 0);
+
+  return frozen->out_offsets[index + 1] - frozen->out_offsets[index];
+}
+
+/**
+ * crank_digraph_frozen_get_indegree:
+ * @frozen: A snapshot.
+ * @index: Index of node.
+ *
+ * Gets indegree of node.
+ *
+ * Returns: Indegree of node.
+ */
+guint
+crank_digraph_frozen_get_indegree (CrankDigraphFrozen *frozen,
+                                   const guint         index)
+{
+  g_return_val_if_fail (index < frozen->nnodes, 0);
+
+  return frozen->in_offsets[index + 1] - frozen->in_offsets[index];
+}
+
+
+//////// Traversal /////////////////////////////////////////////////////////////
+
+/**
+ * crank_digraph_frozen_foreach_depth:
+ * @frozen: A snapshot.
+ * @from: Index of starting node.
+ * @func: (scope call): A function to iterate over.
+ * @userdata: (closure): userdata for @func.
+ *
+ * Performs depth-first iteration, in same order to
+ * crank_digraph_node_foreach_depth().
+ *
+ * Iteration can be stopped by returning %FALSE from @func.
+ *
+ * Returns: %FALSE, if @func returns %FALSE.
+ */
+gboolean
+crank_digraph_frozen_foreach_depth (CrankDigraphFrozen    *frozen,
+                                    const guint            from,
+                                    CrankDigraphIndexFunc  func,
+                                    gpointer               userdata)
+{
+  CrankDigraphFrozenScratch *scratch;
+  guint stamp;
+  guint n;
+  gboolean result = TRUE;
+
+  g_return_val_if_fail (from < frozen->nnodes, FALSE);
+
+  scratch = crank_digraph_frozen_acquire (frozen);
+  stamp = scratch->stamp;
+
+  // Stack can have duplicated entries, as nodes are marked when popped.
+  scratch->queue[0] = from;
+  n = 1;
+
+  while (n != 0)
+    {
+      guint index = scratch->queue[--n];
+      guint k;
+
+      if (scratch->seen[index] == stamp)
+        continue;
+
+      scratch->seen[index] = stamp;
+      result = func (index, userdata);
+
+      if (!result)
+        break;
+
+      for (k = frozen->out_offsets[index]; k < frozen->out_offsets[index + 1]; k++)
+        scratch->queue[n++] = frozen->out_heads[k];
+    }
+
+  crank_digraph_frozen_release (frozen, scratch);
+
+  return result;
+}
+
+/**
+ * crank_digraph_frozen_foreach_breadth:
+ * @frozen: A snapshot.
+ * @from: Index of starting node.
+ * @func: (scope call): A function to iterate over.
+ * @userdata: (closure): userdata for @func.
+ *
+ * Performs breadth-first iteration, in same order to
+ * crank_digraph_node_foreach_breadth().
+ *
+ * Iteration can be stopped by returning %FALSE from @func.
+ *
+ * Returns: %FALSE, if @func returns %FALSE.
+ */
+gboolean
+crank_digraph_frozen_foreach_breadth (CrankDigraphFrozen    *frozen,
+                                      const guint            from,
+                                      CrankDigraphIndexFunc  func,
+                                      gpointer               userdata)
+{
+  CrankDigraphFrozenScratch *scratch;
+  guint stamp;
+  guint head;
+  guint tail;
+  gboolean result = TRUE;
+
+  g_return_val_if_fail (from < frozen->nnodes, FALSE);
+
+  scratch = crank_digraph_frozen_acquire (frozen);
+  stamp = scratch->stamp;
+
+  // Nodes are marked when pushed, so each node is pushed once.
+  scratch->queue[0] = from;
+  scratch->seen[from] = stamp;
+  head = 0;
+  tail = 1;
+
+  while (head != tail)
+    {
+      guint index = scratch->queue[head++];
+      guint k;
+
+      result = func (index, userdata);
+
+      if (!result)
+        break;
+
+      for (k = frozen->out_offsets[index]; k < frozen->out_offsets[index + 1]; k++)
+        {
+          guint next = frozen->out_heads[k];
+
+          if (scratch->seen[next] != stamp)
+            {
+              scratch->seen[next] = stamp;
+              scratch->queue[tail++] = next;
+            }
+        }
+    }
+
+  crank_digraph_frozen_release (frozen, scratch);
+
+  return result;
+}
+
+
+//////// Path Finding //////////////////////////////////////////////////////////
+
+/**
+ * crank_digraph_frozen_dijkstra:
+ * @frozen: A snapshot.
+ * @from: Index of starting node.
+ * @to: Index of destination node.
+ * @path: (nullable) (element-type guint): An array to store path.
+ * @cost: (out) (optional): Cost of path.
+ *
+ * Gets minimum path from @from to @to, with weights of snapshot.
+ *
+ * If path is found, @path is set to node indices from @from to @to. @path is
+ * not touched if @to is not reachable. Passing an array that is reused for
+ * multiple queries saves allocations.
+ *
+ * Returns: Whether @to is reachable from @from.
+ */
+gboolean
+crank_digraph_frozen_dijkstra (CrankDigraphFrozen *frozen,
+                               const guint         from,
+                               const guint         to,
+                               GArray             *path,
+                               gfloat             *cost)
+{
+  return crank_digraph_frozen_search (frozen, from, to,
+                                      NULL, NULL,
+                                      path, cost);
+}
+
+/**
+ * crank_digraph_frozen_astar:
+ * @frozen: A snapshot.
+ * @from: Index of starting node.
+ * @to: Index of destination node.
+ * @heuristic_func: (scope call) (closure heuristic_userdata): Estimated cost
+ *     function for each node to destination.
+ * @heuristic_userdata: Userdata for @heuristic_func.
+ * @path: (nullable) (element-type guint): An array to store path.
+ * @cost: (out) (optional): Cost of path.
+ *
+ * Gets reasonably short path from @from to @to, with weights of snapshot. If
+ * @heuristic_func never overestimates, the path is shortest one.
+ *
+ * @path is filled like crank_digraph_frozen_dijkstra().
+ *
+ * Returns: Whether @to is reachable from @from.
+ */
+gboolean
+crank_digraph_frozen_astar (CrankDigraphFrozen            *frozen,
+                            const guint                    from,
+                            const guint                    to,
+                            CrankDigraphIndexHeuristicFunc heuristic_func,
+                            gpointer                       heuristic_userdata,
+                            GArray                        *path,
+                            gfloat                        *cost)
+{
+  return crank_digraph_frozen_search (frozen, from, to,
+                                      heuristic_func, heuristic_userdata,
+                                      path, cost);
+}
+
+
+//////// Batched Queries ///////////////////////////////////////////////////////
+
+/**
+ * crank_digraph_frozen_dijkstra_nearest:
+ * @frozen: A snapshot.
+ * @sources: (array length=nsources): Indices of starting nodes.
+ * @nsources: Length of @sources.
+ * @goals: (array length=ngoals): Indices of destination nodes.
+ * @ngoals: Length of @goals.
+ * @path: (nullable) (element-type guint): An array to store path.
+ * @cost: (out) (optional): Cost of path.
+ *
+ * Gets minimum path from any of @sources to any of @goals, by one search. First
+ * item of @path is the nearest source, and last one is the nearest goal.
+ *
+ * @path is filled like crank_digraph_frozen_dijkstra().
+ *
+ * Returns: Whether any of @goals is reachable from any of @sources.
+ */
+gboolean
+crank_digraph_frozen_dijkstra_nearest (CrankDigraphFrozen *frozen,
+                                       const guint        *sources,
+                                       const guint         nsources,
+                                       const guint        *goals,
+                                       const guint         ngoals,
+                                       GArray             *path,
+                                       gfloat             *cost)
+{
+  CrankDigraphFrozenScratch *scratch;
+  guint goal;
+  guint i;
+
+  // Checks indices before taking scratch, as marking goals writes by them.
+  for (i = 0; i < nsources; i++)
+    g_return_val_if_fail (sources[i] < frozen->nnodes, FALSE);
+
+  for (i = 0; i < ngoals; i++)
+    g_return_val_if_fail (goals[i] < frozen->nnodes, FALSE);
+
+  scratch = crank_digraph_frozen_acquire (frozen);
+
+  crank_digraph_frozen_mark (scratch, goals, ngoals);
+
+  goal = crank_digraph_frozen_run (frozen, scratch, FALSE,
+                                   sources, nsources, 1,
+                                   NULL, NULL, 0);
+
+  if (goal != CRANK_DIGRAPH_FROZEN_NONE)
+    {
+      if (path != NULL)
+        crank_digraph_frozen_build_path (scratch, goal, path);
+
+      if (cost != NULL)
+        *cost = scratch->dist[goal];
+    }
+
+  crank_digraph_frozen_release (frozen, scratch);
+
+  return goal != CRANK_DIGRAPH_FROZEN_NONE;
+}
+
+/**
+ * crank_digraph_frozen_distances:
+ * @frozen: A snapshot.
+ * @sources: (array length=nsources): Indices of starting nodes.
+ * @nsources: Length of @sources.
+ * @dist: (array) (out caller-allocates): Array of nnodes items to store
+ *     distances.
+ *
+ * Gets distances from nearest of @sources to all nodes. Unreachable nodes get
+ * %INFINITY.
+ */
+void
+crank_digraph_frozen_distances (CrankDigraphFrozen *frozen,
+                                const guint        *sources,
+                                const guint         nsources,
+                                gfloat             *dist)
+{
+  CrankDigraphFrozenScratch *scratch;
+  guint i;
+
+  scratch = crank_digraph_frozen_acquire (frozen);
+
+  crank_digraph_frozen_run (frozen, scratch, FALSE,
+                            sources, nsources, 0,
+                            NULL, NULL, 0);
+
+  for (i = 0; i < frozen->nnodes; i++)
+    dist[i] = (scratch->seen[i] == scratch->stamp) ? scratch->dist[i] : INFINITY;
+
+  crank_digraph_frozen_release (frozen, scratch);
+}
+
+/**
+ * crank_digraph_frozen_distances_to:
+ * @frozen: A snapshot.
+ * @targets: (array length=ntargets): Indices of destination nodes.
+ * @ntargets: Length of @targets.
+ * @dist: (array) (out caller-allocates): Array of nnodes items to store
+ *     distances.
+ *
+ * Gets distances from all nodes to nearest of @targets, by a search over
+ * incoming edges. Nodes that cannot reach any of @targets get %INFINITY.
+ */
+void
+crank_digraph_frozen_distances_to (CrankDigraphFrozen *frozen,
+                                   const guint        *targets,
+                                   const guint         ntargets,
+                                   gfloat             *dist)
+{
+  CrankDigraphFrozenScratch *scratch;
+  guint i;
+
+  scratch = crank_digraph_frozen_acquire (frozen);
+
+  crank_digraph_frozen_run (frozen, scratch, TRUE,
+                            targets, ntargets, 0,
+                            NULL, NULL, 0);
+
+  for (i = 0; i < frozen->nnodes; i++)
+    dist[i] = (scratch->seen[i] == scratch->stamp) ? scratch->dist[i] : INFINITY;
+
+  crank_digraph_frozen_release (frozen, scratch);
+}
+
+/**
+ * crank_digraph_frozen_distance_table:
+ * @frozen: A snapshot.
+ * @sources: (array length=nsources): Indices of starting nodes.
+ * @nsources: Length of @sources.
+ * @targets: (array length=ntargets): Indices of destination nodes.
+ * @ntargets: Length of @targets.
+ * @table: (array) (out caller-allocates): Array of @nsources * @ntargets
+ *     items to store distances.
+ *
+ * Gets distances from each of @sources to each of @targets. Distance from
+ * sources[i] to targets[j] is stored at table[i * ntargets + j], and it is
+ * %INFINITY if targets[j] is not reachable.
+ */
+void
+crank_digraph_frozen_distance_table (CrankDigraphFrozen *frozen,
+                                     const guint        *sources,
+                                     const guint         nsources,
+                                     const guint        *targets,
+                                     const guint         ntargets,
+                                     gfloat             *table)
+{
+  crank_digraph_frozen_distance_table_parallel (frozen,
+                                                sources, nsources,
+                                                targets, ntargets,
+                                                table, 1);
+}
+
+/**
+ * crank_digraph_frozen_distance_table_parallel:
+ * @frozen: A snapshot.
+ * @sources: (array length=nsources): Indices of starting nodes.
+ * @nsources: Length of @sources.
+ * @targets: (array length=ntargets): Indices of destination nodes.
+ * @ntargets: Length of @targets.
+ * @table: (array) (out caller-allocates): Array of @nsources * @ntargets
+ *     items to store distances.
+ * @n_threads: Number of threads, or 0 for number of processors.
+ *
+ * Gets distances like crank_digraph_frozen_distance_table(), with given
+ * number of threads. Each thread runs its own searches.
+ */
+void
+crank_digraph_frozen_distance_table_parallel (CrankDigraphFrozen *frozen,
+                                              const guint        *sources,
+                                              const guint         nsources,
+                                              const guint        *targets,
+                                              const guint         ntargets,
+                                              gfloat             *table,
+                                              const guint         n_threads)
+{
+  CrankDigraphFrozenTableArgs args;
+  guint i;
+
+  // Searches on threads cannot report errors, so indices are checked here.
+  for (i = 0; i < nsources; i++)
+    g_return_if_fail (sources[i] < frozen->nnodes);
+
+  for (i = 0; i < ntargets; i++)
+    g_return_if_fail (targets[i] < frozen->nnodes);
+
+  if ((nsources == 0) || (ntargets == 0))
+    return;
+
+  args.frozen = frozen;
+  args.sources = sources;
+  args.nsources = nsources;
+  args.targets = targets;
+  args.ntargets = ntargets;
+  args.table = table;
+
+  // Search from smaller side.
+  args.reverse = (ntargets < nsources);
+
+  crank_parallel_for (n_threads,
+                      0, args.reverse ? ntargets : nsources,
+                      1,
+                      crank_digraph_frozen_distance_table_range, &args);
+}
+
+
+//////// Private functions /////////////////////////////////////////////////////
+
+static CrankDigraphFrozenScratch*
+crank_digraph_frozen_acquire (CrankDigraphFrozen *frozen)
+{
+  CrankDigraphFrozenScratch *scratch = NULL;
+
+  g_mutex_lock (&frozen->scratch_mutex);
+
+  if (frozen->scratches != NULL)
+    {
+      scratch = (CrankDigraphFrozenScratch*) frozen->scratches->data;
+      frozen->scratches = g_slist_delete_link (frozen->scratches,
+                                               frozen->scratches);
+    }
+
+  g_mutex_unlock (&frozen->scratch_mutex);
+
+  if (scratch == NULL)
+    {
+      guint n = frozen->nnodes;
+
+      scratch = g_new (CrankDigraphFrozenScratch, 1);
+      scratch->stamp = 0;
+      scratch->seen = g_new0 (guint, n);
+      scratch->closed = g_new0 (guint, n);
+      scratch->mark = g_new0 (guint, n);
+      scratch->dist = g_new (gfloat, n);
+      scratch->prev = g_new (guint, n);
+      scratch->queue = g_new (guint, MAX (n, frozen->nedges + 1));
+
+      crank_index_heap_init (&scratch->open, n);
+    }
+
+  crank_digraph_frozen_restamp (frozen, scratch);
+
+  return scratch;
+}
+
+/*
+ * Starts a new search on scratch, invalidating entries of previous one.
+ */
+static void
+crank_digraph_frozen_restamp (CrankDigraphFrozen        *frozen,
+                              CrankDigraphFrozenScratch *scratch)
+{
+  crank_index_heap_clear (&scratch->open);
+
+  scratch->stamp++;
+
+  // On wrap around, old stamps might be taken as current one.
+  if (scratch->stamp == 0)
+    {
+      memset (scratch->seen, 0, sizeof (guint) * frozen->nnodes);
+      memset (scratch->closed, 0, sizeof (guint) * frozen->nnodes);
+      memset (scratch->mark, 0, sizeof (guint) * frozen->nnodes);
+      scratch->stamp = 1;
+    }
+}
+
+static void
+crank_digraph_frozen_release (CrankDigraphFrozen        *frozen,
+                              CrankDigraphFrozenScratch *scratch)
+{
+  crank_index_heap_clear (&scratch->open);
+
+  g_mutex_lock (&frozen->scratch_mutex);
+  frozen->scratches = g_slist_prepend (frozen->scratches, scratch);
+  g_mutex_unlock (&frozen->scratch_mutex);
+}
+
+static void
+crank_digraph_frozen_scratch_free (gpointer scratch)
+{
+  CrankDigraphFrozenScratch *s = (CrankDigraphFrozenScratch*) scratch;
+
+  g_free (s->seen);
+  g_free (s->closed);
+  g_free (s->mark);
+  g_free (s->dist);
+  g_free (s->prev);
+  g_free (s->queue);
+  crank_index_heap_fini (&s->open);
+
+  g_free (s);
+}
+
+/*
+ * Marks nodes as goals of current search, and returns count of distinct ones.
+ */
+static guint
+crank_digraph_frozen_mark (CrankDigraphFrozenScratch *scratch,
+                           const guint               *indices,
+                           const guint                nindices)
+{
+  guint count = 0;
+  guint i;
+
+  for (i = 0; i < nindices; i++)
+    {
+      if (scratch->mark[indices[i]] != scratch->stamp)
+        {
+          scratch->mark[indices[i]] = scratch->stamp;
+          count++;
+        }
+    }
+
+  return count;
+}
+
+/*
+ * Runs Dijkstra's algorithm from sources, over outgoing edges or incoming
+ * edges if reverse is TRUE. If heuristic_func is not NULL, this runs A* toward
+ * to.
+ *
+ * Search stops when stop_count of marked nodes are closed, or runs over all
+ * reachable nodes if stop_count is 0.
+ *
+ * Returns last closed marked node, or CRANK_DIGRAPH_FROZEN_NONE if search
+ * stopped by running out nodes.
+ */
+static guint
+crank_digraph_frozen_run (CrankDigraphFrozen            *frozen,
+                          CrankDigraphFrozenScratch     *scratch,
+                          const gboolean                 reverse,
+                          const guint                   *sources,
+                          const guint                    nsources,
+                          const guint                    stop_count,
+                          CrankDigraphIndexHeuristicFunc heuristic_func,
+                          gpointer                       heuristic_userdata,
+                          const guint                    to)
+{
+  const guint *offsets = reverse ? frozen->in_offsets : frozen->out_offsets;
+  const guint *adjs = reverse ? frozen->in_tails : frozen->out_heads;
+  const gfloat *weights = reverse ? frozen->in_weights : frozen->out_weights;
+
+  guint stamp = scratch->stamp;
+  guint remaining = stop_count;
+  guint i;
+
+  for (i = 0; i < nsources; i++)
+    {
+      guint source = sources[i];
+
+      g_return_val_if_fail (source < frozen->nnodes, CRANK_DIGRAPH_FROZEN_NONE);
+
+      scratch->seen[source] = stamp;
+      scratch->dist[source] = 0.0f;
+      scratch->prev[source] = CRANK_DIGRAPH_FROZEN_NONE;
+
+      crank_index_heap_update (&scratch->open, source,
+                               (heuristic_func != NULL) ?
+                               heuristic_func (source, to, heuristic_userdata) :
+                               0.0f);
+    }
+
+  while (! crank_index_heap_is_empty (&scratch->open))
+    {
+      guint index = crank_index_heap_pop (&scratch->open, NULL);
+      gfloat dist = scratch->dist[index];
+      guint k;
+
+      scratch->closed[index] = stamp;
+
+      if ((scratch->mark[index] == stamp) && (remaining != 0))
+        {
+          remaining--;
+
+          if (remaining == 0)
+            return index;
+        }
+
+      for (k = offsets[index]; k < offsets[index + 1]; k++)
+        {
+          guint next = adjs[k];
+          gfloat next_dist = dist + weights[k];
+
+          if (scratch->closed[next] == stamp)
+            continue;
+
+          if ((scratch->seen[next] != stamp) || (next_dist < scratch->dist[next]))
+            {
+              gfloat priority = next_dist;
+
+              if (heuristic_func != NULL)
+                priority += heuristic_func (next, to, heuristic_userdata);
+
+              scratch->seen[next] = stamp;
+              scratch->dist[next] = next_dist;
+              scratch->prev[next] = index;
+
+              crank_index_heap_update (&scratch->open, next, priority);
+            }
+        }
+    }
+
+  return CRANK_DIGRAPH_FROZEN_NONE;
+}
+
+static void
+crank_digraph_frozen_build_path (CrankDigraphFrozenScratch *scratch,
+                                 const guint                index,
+                                 GArray                    *path)
+{
+  guint i;
+  guint n = 0;
+
+  for (i = index; i != CRANK_DIGRAPH_FROZEN_NONE; i = scratch->prev[i])
+    n++;
+
+  g_array_set_size (path, n);
+
+  for (i = index; i != CRANK_DIGRAPH_FROZEN_NONE; i = scratch->prev[i])
+    g_array_index (path, guint, --n) = i;
+}
+
+static gboolean
+crank_digraph_frozen_search (CrankDigraphFrozen            *frozen,
+                             const guint                    from,
+                             const guint                    to,
+                             CrankDigraphIndexHeuristicFunc heuristic_func,
+                             gpointer                       heuristic_userdata,
+                             GArray                        *path,
+                             gfloat                        *cost)
+{
+  CrankDigraphFrozenScratch *scratch;
+  guint found;
+
+  g_return_val_if_fail (from < frozen->nnodes, FALSE);
+  g_return_val_if_fail (to < frozen->nnodes, FALSE);
+
+  scratch = crank_digraph_frozen_acquire (frozen);
+
+  scratch->mark[to] = scratch->stamp;
+
+  found = crank_digraph_frozen_run (frozen, scratch, FALSE,
+                                    &from, 1, 1,
+                                    heuristic_func, heuristic_userdata, to);
+
+  if (found != CRANK_DIGRAPH_FROZEN_NONE)
+    {
+      if (path != NULL)
+        crank_digraph_frozen_build_path (scratch, to, path);
+
+      if (cost != NULL)
+        *cost = scratch->dist[to];
+    }
+
+  crank_digraph_frozen_release (frozen, scratch);
+
+  return found != CRANK_DIGRAPH_FROZEN_NONE;
+}
+
+static void
+crank_digraph_frozen_distance_table_range (const guint start,
+                                           const guint end,
+                                           gpointer    userdata)
+{
+  CrankDigraphFrozenTableArgs *args = (CrankDigraphFrozenTableArgs*) userdata;
+  CrankDigraphFrozen *frozen = args->frozen;
+  CrankDigraphFrozenScratch *scratch;
+
+  // Searches run from "from" side, and stop when all of "to" side are closed.
+  const guint *from = args->reverse ? args->targets : args->sources;
+  const guint *to = args->reverse ? args->sources : args->targets;
+  guint nto = args->reverse ? args->nsources : args->ntargets;
+
+  guint i;
+  guint j;
+
+  scratch = crank_digraph_frozen_acquire (frozen);
+
+  for (i = start; i < end; i++)
+    {
+      guint count;
+
+      if (i != start)
+        crank_digraph_frozen_restamp (frozen, scratch);
+
+      count = crank_digraph_frozen_mark (scratch, to, nto);
+
+      crank_digraph_frozen_run (frozen, scratch, args->reverse,
+                                from + i, 1, count,
+                                NULL, NULL, 0);
+
+      for (j = 0; j < nto; j++)
+        {
+          gfloat dist = (scratch->seen[to[j]] == scratch->stamp) ?
+                        scratch->dist[to[j]] : INFINITY;
+
+          if (args->reverse)
+            args->table[(gsize) j * args->ntargets + i] = dist;
+          else
+            args->table[(gsize) i * args->ntargets + j] = dist;
+        }
+    }
+
+  crank_digraph_frozen_release (frozen, scratch);
+}
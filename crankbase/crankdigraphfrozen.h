@@ -0,0 +1,189 @@
+#ifndef CRANKDIGRAPHFROZEN_H
+#define CRANKDIGRAPHFROZEN_H
+
+/* Copyright (C) 2015, WSID   */
+
+/* Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef _CRANKBASE_INSIDE
+#error crankdigraphfrozen.h cannot be included directly.
+#endif
+
+#include <glib.h>
+#include <glib-object.h>
+
+#include "crankdigraph.h"
+#include "crankadvgraph.h"
+
+G_BEGIN_DECLS
+
+typedef struct _CrankDigraphFrozen CrankDigraphFrozen;
+
+#define CRANK_TYPE_DIGRAPH_FROZEN   (crank_digraph_frozen_get_type())
+GType crank_digraph_frozen_get_type (void);
+
+/**
+ * CrankDigraphIndexFunc:
+ * @index: Index of a node.
+ * @userdata: (closure): Userdata.
+ *
+ * A function type for iterating over node indices of #CrankDigraphFrozen.
+ *
+ * Returns: Return %TRUE to keep iteration.
+ */
+typedef gboolean (*CrankDigraphIndexFunc)       (const guint index,
+                                                 gpointer    userdata);
+
+/**
+ * CrankDigraphIndexHeuristicFunc:
+ * @from: Index of starting node.
+ * @to: Index of destination node.
+ * @userdata: (closure): Userdata.
+ *
+ * Estimates cost from @from to @to, by node indices of #CrankDigraphFrozen.
+ *
+ * Returns: Estimation of cost between @from and @to.
+ */
+typedef gfloat   (*CrankDigraphIndexHeuristicFunc) (const guint from,
+                                                    const guint to,
+                                                    gpointer    userdata);
+
+
+//////// Construction //////////////////////////////////////////////////////////
+
+CrankDigraphFrozen *crank_digraph_freeze (CrankDigraph              *graph,
+                                          CrankDigraphEdgeFloatFunc  edge_func,
+                                          gpointer                   userdata);
+
+CrankDigraphFrozen *crank_digraph_frozen_ref   (CrankDigraphFrozen *frozen);
+
+void                crank_digraph_frozen_unref (CrankDigraphFrozen *frozen);
+
+
+//////// Properties ////////////////////////////////////////////////////////////
+
+CrankDigraph       *crank_digraph_frozen_get_graph  (CrankDigraphFrozen *frozen);
+
+guint               crank_digraph_frozen_get_nnodes (CrankDigraphFrozen *frozen);
+
+guint               crank_digraph_frozen_get_nedges (CrankDigraphFrozen *frozen);
+
+CrankDigraphNode   *crank_digraph_frozen_get_node   (CrankDigraphFrozen *frozen,
+                                                     const guint         index);
+
+CrankDigraphEdge   *crank_digraph_frozen_get_edge   (CrankDigraphFrozen *frozen,
+                                                     const guint         index);
+
+gint                crank_digraph_frozen_index_of_node (CrankDigraphFrozen *frozen,
+                                                        CrankDigraphNode   *node);
+
+
+//////// Compressed Sparse Rows ////////////////////////////////////////////////
+
+const guint        *crank_digraph_frozen_get_out_offsets (CrankDigraphFrozen *frozen);
+
+const guint        *crank_digraph_frozen_get_out_heads   (CrankDigraphFrozen *frozen);
+
+const gfloat       *crank_digraph_frozen_get_out_weights (CrankDigraphFrozen *frozen);
+
+const guint        *crank_digraph_frozen_get_in_offsets  (CrankDigraphFrozen *frozen);
+
+const guint        *crank_digraph_frozen_get_in_tails    (CrankDigraphFrozen *frozen);
+
+const gfloat       *crank_digraph_frozen_get_in_weights  (CrankDigraphFrozen *frozen);
+
+const guint        *crank_digraph_frozen_get_in_edges    (CrankDigraphFrozen *frozen);
+
+guint               crank_digraph_frozen_get_outdegree   (CrankDigraphFrozen *frozen,
+                                                          const guint         index);
+
+guint               crank_digraph_frozen_get_indegree    (CrankDigraphFrozen *frozen,
+                                                          const guint         index);
+
+
+//////// Traversal /////////////////////////////////////////////////////////////
+
+gboolean            crank_digraph_frozen_foreach_depth   (CrankDigraphFrozen    *frozen,
+                                                          const guint            from,
+                                                          CrankDigraphIndexFunc  func,
+                                                          gpointer               userdata);
+
+gboolean            crank_digraph_frozen_foreach_breadth (CrankDigraphFrozen    *frozen,
+                                                          const guint            from,
+                                                          CrankDigraphIndexFunc  func,
+                                                          gpointer               userdata);
+
+
+//////// Path Finding //////////////////////////////////////////////////////////
+
+gboolean            crank_digraph_frozen_dijkstra (CrankDigraphFrozen *frozen,
+                                                   const guint         from,
+                                                   const guint         to,
+                                                   GArray             *path,
+                                                   gfloat             *cost);
+
+gboolean            crank_digraph_frozen_astar    (CrankDigraphFrozen            *frozen,
+                                                   const guint                    from,
+                                                   const guint                    to,
+                                                   CrankDigraphIndexHeuristicFunc heuristic_func,
+                                                   gpointer                       heuristic_userdata,
+                                                   GArray                        *path,
+                                                   gfloat                        *cost);
+
+
+//////// Batched Queries ///////////////////////////////////////////////////////
+
+gboolean            crank_digraph_frozen_dijkstra_nearest (CrankDigraphFrozen *frozen,
+                                                           const guint        *sources,
+                                                           const guint         nsources,
+                                                           const guint        *goals,
+                                                           const guint         ngoals,
+                                                           GArray             *path,
+                                                           gfloat             *cost);
+
+void                crank_digraph_frozen_distances (CrankDigraphFrozen *frozen,
+                                                    const guint        *sources,
+                                                    const guint         nsources,
+                                                    gfloat             *dist);
+
+void                crank_digraph_frozen_distances_to (CrankDigraphFrozen *frozen,
+                                                       const guint        *targets,
+                                                       const guint         ntargets,
+                                                       gfloat             *dist);
+
+void                crank_digraph_frozen_distance_table (CrankDigraphFrozen *frozen,
+                                                         const guint        *sources,
+                                                         const guint         nsources,
+                                                         const guint        *targets,
+                                                         const guint         ntargets,
+                                                         gfloat             *table);
+
+void                crank_digraph_frozen_distance_table_parallel (
+  CrankDigraphFrozen *frozen,
+  const guint        *sources,
+  const guint         nsources,
+  const guint        *targets,
+  const guint         ntargets,
+  gfloat             *table,
+  const guint         n_threads);
+
+G_END_DECLS
+
+#endif
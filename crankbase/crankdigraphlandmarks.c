@@ -0,0 +1,680 @@
+/* Copyright (C) 2015, WSID   */
+
+/* Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#define _CRANKBASE_INSIDE
+
+#include <math.h>
+#include <string.h>
+
+#include <glib.h>
+#include <glib-object.h>
+
+#include "crankbasemacro.h"
+#include "crankdigraphfrozen.h"
+#include "crankdigraphlandmarks.h"
+
+/**
+ * SECTION: crankdigraphlandmarks
+ * @title: CrankDigraphLandmarks
+ * @short_description: Landmark distance tables for fast repeated path finding.
+ * @stability: Unstable
+ * @include: crankbase.h
+ *
+ * A* with geometric heuristics, like euclidean distance, still visits many
+ * nodes on road-like graphs, as detours make geometric estimation far below
+ * real costs.
+ *
+ * #CrankDigraphLandmarks holds distances from and to a few chosen nodes, called
+ * landmarks, for all nodes of #CrankDigraphFrozen. By triangle inequality,
+ * for a landmark L,
+ *
+ * * d(from, to) >= d(L, to) - d(L, from)
+ * * d(from, to) >= d(from, L) - d(to, L)
+ *
+ * Maximum of these over landmarks gives lower bound of cost, which is much
+ * tighter than geometric ones. This is known as ALT (A*, Landmarks and
+ * Triangle inequality). crank_digraph_landmarks_astar() runs A* with the
+ * bound, and it gets shortest path as crank_digraph_frozen_dijkstra() does.
+ *
+ * # Preprocessing
+ *
+ * crank_digraph_landmarks_new() picks landmarks by farthest selection, which
+ * picks node that is farthest from already picked landmarks. Nodes that are
+ * not reachable from picked landmarks are picked first, so that every
+ * component gets landmarks. Landmarks can be given explicitly by
+ * crank_digraph_landmarks_new_with_nodes().
+ *
+ * Preprocessing runs two searches over whole graph for each landmark, and
+ * takes 2 * nlandmarks floats for each node. 8 to 16 landmarks are usually
+ * enough.
+ *
+ * # Serialization
+ *
+ * Tables can be saved to file by crank_digraph_landmarks_save(), and loaded
+ * by crank_digraph_landmarks_load() without preprocessing again. Saved file
+ * records fingerprint of snapshot, and loading onto different graph is
+ * rejected with %CRANK_DIGRAPH_LANDMARKS_ERROR_MISMATCH.
+ *
+ * As tables are made for weights on snapshot, changing graph or weights
+ * requires preprocessing again.
+ */
+
+G_DEFINE_BOXED_TYPE (CrankDigraphLandmarks,
+                     crank_digraph_landmarks,
+                     crank_digraph_landmarks_ref,
+                     crank_digraph_landmarks_unref);
+
+G_DEFINE_QUARK (crank-digraph-landmarks-error-quark, crank_digraph_landmarks_error);
+
+#define CRANK_DIGRAPH_LANDMARKS_MAGIC   0x4b4d4c43
+#define CRANK_DIGRAPH_LANDMARKS_VERSION 1
+#define CRANK_DIGRAPH_LANDMARKS_HEADER  6
+
+/**
+ * CrankDigraphLandmarks:
+ *
+ * A structure for landmark distance tables of #CrankDigraphFrozen.
+ */
+struct _CrankDigraphLandmarks {
+  CrankDigraphFrozen *frozen;
+
+  guint               nnodes;
+  guint               nlandmarks;
+  guint              *landmarks;
+
+  // Distances are stored by node, so that estimation reads contiguous memory.
+  gfloat             *dist_from; // [node * nlandmarks + l]: d(landmark, node)
+  gfloat             *dist_to;   // [node * nlandmarks + l]: d(node, landmark)
+
+  guint               _refc;
+};
+
+
+//////// Private functions /////////////////////////////////////////////////////
+
+static CrankDigraphLandmarks *crank_digraph_landmarks_alloc (CrankDigraphFrozen *frozen,
+                                                             const guint         nlandmarks);
+
+static void   crank_digraph_landmarks_fill (CrankDigraphLandmarks *landmarks,
+                                            const guint            l,
+                                            gfloat                *temp);
+
+static gfloat crank_digraph_landmarks_heuristic (const guint from,
+                                                 const guint to,
+                                                 gpointer    userdata);
+
+static guint32 crank_digraph_landmarks_fingerprint (CrankDigraphFrozen *frozen);
+
+
+//////// Construction //////////////////////////////////////////////////////////
+
+/**
+ * crank_digraph_landmarks_new:
+ * @frozen: A snapshot.
+ * @nlandmarks: Number of landmarks.
+ *
+ * Picks @nlandmarks landmarks by farthest selection, and builds distance
+ * tables for them. If @nlandmarks is larger than number of nodes, all nodes
+ * become landmarks.
+ *
+ * Returns: (transfer full): Landmark distance tables.
+ */
+CrankDigraphLandmarks*
+crank_digraph_landmarks_new (CrankDigraphFrozen *frozen,
+                             const guint         nlandmarks)
+{
+  CrankDigraphLandmarks *landmarks;
+  gfloat *score;
+  gfloat *temp;
+  guint nnodes;
+  guint seed = 0;
+  guint l;
+  guint i;
+
+  nnodes = crank_digraph_frozen_get_nnodes (frozen);
+  landmarks = crank_digraph_landmarks_alloc (frozen, MIN (nlandmarks, nnodes));
+
+  if (landmarks->nlandmarks == 0)
+    return landmarks;
+
+  score = g_new (gfloat, nnodes);
+  temp = g_new (gfloat, nnodes);
+
+  // First landmark is farthest one from node 0.
+  crank_digraph_frozen_distances (frozen, &seed, 1, score);
+
+  for (l = 0; l < landmarks->nlandmarks; l++)
+    {
+      guint sel = 0;
+      gfloat best = -1.0f;
+      gfloat *from;
+
+      // Unreachable nodes have score of INFINITY, and picked first.
+      for (i = 0; i < nnodes; i++)
+        {
+          if (best < score[i])
+            {
+              best = score[i];
+              sel = i;
+            }
+        }
+
+      landmarks->landmarks[l] = sel;
+      crank_digraph_landmarks_fill (landmarks, l, temp);
+
+      // Score is distance from nearest landmark.
+      from = landmarks->dist_from + l;
+      for (i = 0; i < nnodes; i++)
+        {
+          gfloat d = from[(gsize) i * landmarks->nlandmarks];
+
+          score[i] = (l == 0) ? d : MIN (score[i], d);
+        }
+
+      for (i = 0; i <= l; i++)
+        score[landmarks->landmarks[i]] = -INFINITY;
+    }
+
+  g_free (score);
+  g_free (temp);
+
+  return landmarks;
+}
+
+/**
+ * crank_digraph_landmarks_new_with_nodes:
+ * @frozen: A snapshot.
+ * @landmarks: (array length=nlandmarks): Indices of landmark nodes.
+ * @nlandmarks: Length of @landmarks.
+ *
+ * Builds distance tables for given landmarks.
+ *
+ * Returns: (transfer full): Landmark distance tables.
+ */
+CrankDigraphLandmarks*
+crank_digraph_landmarks_new_with_nodes (CrankDigraphFrozen *frozen,
+                                        const guint        *landmarks,
+                                        const guint         nlandmarks)
+{
+  CrankDigraphLandmarks *result;
+  gfloat *temp;
+  guint nnodes;
+  guint l;
+
+  nnodes = crank_digraph_frozen_get_nnodes (frozen);
+
+  for (l = 0; l < nlandmarks; l++)
+    g_return_val_if_fail (landmarks[l] < nnodes, NULL);
+
+  result = crank_digraph_landmarks_alloc (frozen, nlandmarks);
+  temp = g_new (gfloat, nnodes);
+
+  for (l = 0; l < nlandmarks; l++)
+    {
+      result->landmarks[l] = landmarks[l];
+      crank_digraph_landmarks_fill (result, l, temp);
+    }
+
+  g_free (temp);
+
+  return result;
+}
+
+/**
+ * crank_digraph_landmarks_ref:
+ * @landmarks: Landmark distance tables.
+ *
+ * Increase reference count by 1.
+ *
+ * Returns: (transfer full): Landmark distance tables with increased reference
+ *     count.
+ */
+CrankDigraphLandmarks*
+crank_digraph_landmarks_ref (CrankDigraphLandmarks *landmarks)
+{
+  g_atomic_int_inc (&(landmarks->_refc));
+  return landmarks;
+}
+
+/**
+ * crank_digraph_landmarks_unref:
+ * @landmarks: (transfer full): Landmark distance tables.
+ *
+ * Decreases reference count by 1. If reference count reaches 0, then tables
+ * are freed.
+ */
+void
+crank_digraph_landmarks_unref (CrankDigraphLandmarks *landmarks)
+{
+  if (g_atomic_int_dec_and_test (&landmarks->_refc))
+    {
+      g_free (landmarks->landmarks);
+      g_free (landmarks->dist_from);
+      g_free (landmarks->dist_to);
+
+      crank_digraph_frozen_unref (landmarks->frozen);
+      g_free (landmarks);
+    }
+}
+
+
+//////// Properties ////////////////////////////////////////////////////////////
+
+/**
+ * crank_digraph_landmarks_get_frozen:
+ * @landmarks: Landmark distance tables.
+ *
+ * Gets snapshot that tables are built on.
+ *
+ * Returns: (transfer none): Snapshot of tables.
+ */
+CrankDigraphFrozen*
+crank_digraph_landmarks_get_frozen (CrankDigraphLandmarks *landmarks)
+{
+  return landmarks->frozen;
+}
+
+/**
+ * crank_digraph_landmarks_get_nlandmarks:
+ * @landmarks: Landmark distance tables.
+ *
+ * Gets number of landmarks.
+ *
+ * Returns: Number of landmarks.
+ */
+guint
+crank_digraph_landmarks_get_nlandmarks (CrankDigraphLandmarks *landmarks)
+{
+  return landmarks->nlandmarks;
+}
+
+/**
+ * crank_digraph_landmarks_get_landmark:
+ * @landmarks: Landmark distance tables.
+ * @index: Index of landmark.
+ *
+ * Gets node index of a landmark.
+ *
+ * Returns: Node index of landmark.
+ */
+guint
+crank_digraph_landmarks_get_landmark (CrankDigraphLandmarks *landmarks,
+                                      const guint            index)
+{
+  g_return_val_if_fail (index < landmarks->nlandmarks, 0);
+
+  return landmarks->landmarks[index];
+}
+
+
+//////// Queries ///////////////////////////////////////////////////////////////
+
+/**
+ * crank_digraph_landmarks_estimate:
+ * @landmarks: Landmark distance tables.
+ * @from: Index of starting node.
+ * @to: Index of destination node.
+ *
+ * Gets lower bound of cost from @from to @to. This never overestimates, so
+ * this can be used as heuristic of crank_digraph_frozen_astar().
+ *
+ * Returns: Lower bound of cost, or %INFINITY if tables show that @to is not
+ *     reachable from @from.
+ */
+gfloat
+crank_digraph_landmarks_estimate (CrankDigraphLandmarks *landmarks,
+                                  const guint            from,
+                                  const guint            to)
+{
+  g_return_val_if_fail (from < landmarks->nnodes, 0.0f);
+  g_return_val_if_fail (to < landmarks->nnodes, 0.0f);
+
+  return crank_digraph_landmarks_heuristic (from, to, landmarks);
+}
+
+/**
+ * crank_digraph_landmarks_astar:
+ * @landmarks: Landmark distance tables.
+ * @from: Index of starting node.
+ * @to: Index of destination node.
+ * @path: (nullable) (element-type guint): An array to store path.
+ * @cost: (out) (optional): Cost of path.
+ *
+ * Gets minimum path from @from to @to, by A* with landmark bounds.
+ *
+ * @path is filled like crank_digraph_frozen_dijkstra().
+ *
+ * Returns: Whether @to is reachable from @from.
+ */
+gboolean
+crank_digraph_landmarks_astar (CrankDigraphLandmarks *landmarks,
+                               const guint            from,
+                               const guint            to,
+                               GArray                *path,
+                               gfloat                *cost)
+{
+  g_return_val_if_fail (from < landmarks->nnodes, FALSE);
+  g_return_val_if_fail (to < landmarks->nnodes, FALSE);
+
+  // Tables may tell unreachable without search.
+  if (isinf (crank_digraph_landmarks_heuristic (from, to, landmarks)))
+    return FALSE;
+
+  return crank_digraph_frozen_astar (landmarks->frozen, from, to,
+                                     crank_digraph_landmarks_heuristic,
+                                     landmarks,
+                                     path, cost);
+}
+
+
+//////// Serialization /////////////////////////////////////////////////////////
+
+/**
+ * crank_digraph_landmarks_save:
+ * @landmarks: Landmark distance tables.
+ * @filename: Name of file to save.
+ * @error: Error.
+ *
+ * Saves tables to file. Saved file is in little endian, regardless of
+ * platform.
+ *
+ * Returns: Whether tables are saved.
+ */
+gboolean
+crank_digraph_landmarks_save (CrankDigraphLandmarks  *landmarks,
+                              const gchar            *filename,
+                              GError                **error)
+{
+  CrankDigraphFrozen *frozen = landmarks->frozen;
+  gsize ntable = (gsize) landmarks->nnodes * landmarks->nlandmarks;
+  gsize len = CRANK_DIGRAPH_LANDMARKS_HEADER + landmarks->nlandmarks + 2 * ntable;
+  guint32 *data;
+  guint32 *ptr;
+  gboolean result;
+  gsize i;
+
+  data = g_new (guint32, len);
+  ptr = data;
+
+  *(ptr++) = GUINT32_TO_LE (CRANK_DIGRAPH_LANDMARKS_MAGIC);
+  *(ptr++) = GUINT32_TO_LE (CRANK_DIGRAPH_LANDMARKS_VERSION);
+  *(ptr++) = GUINT32_TO_LE (landmarks->nnodes);
+  *(ptr++) = GUINT32_TO_LE (crank_digraph_frozen_get_nedges (frozen));
+  *(ptr++) = GUINT32_TO_LE (crank_digraph_landmarks_fingerprint (frozen));
+  *(ptr++) = GUINT32_TO_LE (landmarks->nlandmarks);
+
+  for (i = 0; i < landmarks->nlandmarks; i++)
+    *(ptr++) = GUINT32_TO_LE (landmarks->landmarks[i]);
+
+  // Floats are written by their bits.
+  for (i = 0; i < ntable; i++)
+    {
+      guint32 bits;
+      memcpy (&bits, landmarks->dist_from + i, sizeof (guint32));
+      *(ptr++) = GUINT32_TO_LE (bits);
+    }
+
+  for (i = 0; i < ntable; i++)
+    {
+      guint32 bits;
+      memcpy (&bits, landmarks->dist_to + i, sizeof (guint32));
+      *(ptr++) = GUINT32_TO_LE (bits);
+    }
+
+  result = g_file_set_contents (filename,
+                                (const gchar*) data,
+                                len * sizeof (guint32),
+                                error);
+
+  g_free (data);
+
+  return result;
+}
+
+/**
+ * crank_digraph_landmarks_load:
+ * @frozen: A snapshot.
+ * @filename: Name of file to load.
+ * @error: Error.
+ *
+ * Loads tables that are saved by crank_digraph_landmarks_save(). @frozen
+ * should be snapshot of same graph, with same weights.
+ *
+ * Returns: (transfer full) (nullable): Landmark distance tables, or %NULL if
+ *     failed.
+ */
+CrankDigraphLandmarks*
+crank_digraph_landmarks_load (CrankDigraphFrozen  *frozen,
+                              const gchar         *filename,
+                              GError             **error)
+{
+  CrankDigraphLandmarks *landmarks;
+  gchar *contents;
+  gsize len;
+  guint32 header[CRANK_DIGRAPH_LANDMARKS_HEADER];
+  guint32 *data;
+  gsize ntable;
+  guint nnodes;
+  guint nlandmarks;
+  gsize i;
+
+  if (! g_file_get_contents (filename, &contents, &len, error))
+    return NULL;
+
+  nnodes = crank_digraph_frozen_get_nnodes (frozen);
+
+  if (len < sizeof (header))
+    goto invalid;
+
+  memcpy (header, contents, sizeof (header));
+  for (i = 0; i < CRANK_DIGRAPH_LANDMARKS_HEADER; i++)
+    header[i] = GUINT32_FROM_LE (header[i]);
+
+  if ((header[0] != CRANK_DIGRAPH_LANDMARKS_MAGIC) ||
+      (header[1] != CRANK_DIGRAPH_LANDMARKS_VERSION))
+    goto invalid;
+
+  if ((header[2] != nnodes) ||
+      (header[3] != crank_digraph_frozen_get_nedges (frozen)) ||
+      (header[4] != crank_digraph_landmarks_fingerprint (frozen)))
+    {
+      g_set_error (error, CRANK_DIGRAPH_LANDMARKS_ERROR,
+                   CRANK_DIGRAPH_LANDMARKS_ERROR_MISMATCH,
+                   "Landmark tables are made from different graph.\n"
+                   "%s", filename);
+      g_free (contents);
+      return NULL;
+    }
+
+  nlandmarks = header[5];
+  ntable = (gsize) nnodes * nlandmarks;
+
+  if ((len / sizeof (guint32) < nlandmarks) ||
+      (len != sizeof (guint32) * (CRANK_DIGRAPH_LANDMARKS_HEADER +
+                                  nlandmarks + 2 * ntable)))
+    goto invalid;
+
+  // Reads as whole, as g_file_get_contents() gives malloc-aligned memory.
+  data = (guint32*) contents + CRANK_DIGRAPH_LANDMARKS_HEADER;
+
+  for (i = 0; i < nlandmarks; i++)
+    if (nnodes <= GUINT32_FROM_LE (data[i]))
+      goto invalid;
+
+  landmarks = crank_digraph_landmarks_alloc (frozen, nlandmarks);
+
+  for (i = 0; i < nlandmarks; i++)
+    landmarks->landmarks[i] = GUINT32_FROM_LE (data[i]);
+  data += nlandmarks;
+
+  for (i = 0; i < ntable; i++)
+    {
+      guint32 bits = GUINT32_FROM_LE (data[i]);
+      memcpy (landmarks->dist_from + i, &bits, sizeof (guint32));
+    }
+  data += ntable;
+
+  for (i = 0; i < ntable; i++)
+    {
+      guint32 bits = GUINT32_FROM_LE (data[i]);
+      memcpy (landmarks->dist_to + i, &bits, sizeof (guint32));
+    }
+
+  g_free (contents);
+
+  return landmarks;
+
+invalid:
+  g_set_error (error, CRANK_DIGRAPH_LANDMARKS_ERROR,
+               CRANK_DIGRAPH_LANDMARKS_ERROR_INVALID,
+               "File is not landmark tables, or is truncated.\n"
+               "%s", filename);
+  g_free (contents);
+  return NULL;
+}
+
+
+//////// Private functions /////////////////////////////////////////////////////
+
+static CrankDigraphLandmarks*
+crank_digraph_landmarks_alloc (CrankDigraphFrozen *frozen,
+                               const guint         nlandmarks)
+{
+  CrankDigraphLandmarks *landmarks = g_new (CrankDigraphLandmarks, 1);
+  gsize ntable;
+
+  landmarks->frozen = crank_digraph_frozen_ref (frozen);
+  landmarks->nnodes = crank_digraph_frozen_get_nnodes (frozen);
+  landmarks->nlandmarks = nlandmarks;
+
+  ntable = (gsize) landmarks->nnodes * nlandmarks;
+
+  landmarks->landmarks = g_new (guint, nlandmarks);
+  landmarks->dist_from = g_new (gfloat, ntable);
+  landmarks->dist_to = g_new (gfloat, ntable);
+
+  landmarks->_refc = 1;
+
+  return landmarks;
+}
+
+/*
+ * Fills distances of l-th landmark. temp should hold nnodes items.
+ */
+static void
+crank_digraph_landmarks_fill (CrankDigraphLandmarks *landmarks,
+                              const guint            l,
+                              gfloat                *temp)
+{
+  guint nl = landmarks->nlandmarks;
+  guint i;
+
+  crank_digraph_frozen_distances (landmarks->frozen,
+                                  landmarks->landmarks + l, 1,
+                                  temp);
+
+  for (i = 0; i < landmarks->nnodes; i++)
+    landmarks->dist_from[(gsize) i * nl + l] = temp[i];
+
+  crank_digraph_frozen_distances_to (landmarks->frozen,
+                                     landmarks->landmarks + l, 1,
+                                     temp);
+
+  for (i = 0; i < landmarks->nnodes; i++)
+    landmarks->dist_to[(gsize) i * nl + l] = temp[i];
+}
+
+/*
+ * Lower bound by triangle inequality. Terms with INFINITY on both sides make
+ * NaN, which never passes comparison, so unknown terms are skipped. A term of
+ * INFINITY means that @to is unreachable.
+ */
+static gfloat
+crank_digraph_landmarks_heuristic (const guint from,
+                                   const guint to,
+                                   gpointer    userdata)
+{
+  CrankDigraphLandmarks *landmarks = (CrankDigraphLandmarks*) userdata;
+  guint nl = landmarks->nlandmarks;
+
+  const gfloat *from_from = landmarks->dist_from + (gsize) from * nl;
+  const gfloat *from_to = landmarks->dist_from + (gsize) to * nl;
+  const gfloat *to_from = landmarks->dist_to + (gsize) from * nl;
+  const gfloat *to_to = landmarks->dist_to + (gsize) to * nl;
+
+  gfloat bound = 0.0f;
+  guint l;
+
+  for (l = 0; l < nl; l++)
+    {
+      gfloat a = from_to[l] - from_from[l];
+      gfloat b = to_from[l] - to_to[l];
+
+      if (bound < a)
+        bound = a;
+
+      if (bound < b)
+        bound = b;
+    }
+
+  return bound;
+}
+
+/*
+ * FNV-1a hash over structure and weights of snapshot, in little endian order.
+ */
+static guint32
+crank_digraph_landmarks_fingerprint (CrankDigraphFrozen *frozen)
+{
+  const guint *offsets = crank_digraph_frozen_get_out_offsets (frozen);
+  const guint *heads = crank_digraph_frozen_get_out_heads (frozen);
+  const gfloat *weights = crank_digraph_frozen_get_out_weights (frozen);
+  guint nnodes = crank_digraph_frozen_get_nnodes (frozen);
+  guint nedges = crank_digraph_frozen_get_nedges (frozen);
+
+  guint32 hash = 2166136261u;
+  guint i;
+
+#define HASH(v)                                                 \
+  G_STMT_START {                                                \
+    guint32 _v = (v);                                           \
+    guint _b;                                                   \
+    for (_b = 0; _b < 4; _b++)                                  \
+      hash = (hash ^ ((_v >> (_b * 8)) & 0xff)) * 16777619u;    \
+  } G_STMT_END
+
+  for (i = 0; i <= nnodes; i++)
+    HASH (offsets[i]);
+
+  for (i = 0; i < nedges; i++)
+    {
+      guint32 bits;
+
+      memcpy (&bits, weights + i, sizeof (guint32));
+
+      HASH (heads[i]);
+      HASH (bits);
+    }
+
+#undef HASH
+
+  return hash;
+}
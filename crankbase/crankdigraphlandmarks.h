@@ -0,0 +1,116 @@
+#ifndef CRANKDIGRAPHLANDMARKS_H
+#define CRANKDIGRAPHLANDMARKS_H
+
+/* Copyright (C) 2015, WSID   */
+
+/* Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef _CRANKBASE_INSIDE
+#error crankdigraphlandmarks.h cannot be included directly.
+#endif
+
+#include <glib.h>
+#include <glib-object.h>
+
+#include "crankdigraphfrozen.h"
+
+G_BEGIN_DECLS
+
+typedef struct _CrankDigraphLandmarks CrankDigraphLandmarks;
+
+#define CRANK_TYPE_DIGRAPH_LANDMARKS   (crank_digraph_landmarks_get_type())
+GType crank_digraph_landmarks_get_type (void);
+
+
+//////// Error Declarations ////////////////////////////////////////////////////
+/**
+ * CRANK_DIGRAPH_LANDMARKS_ERROR:
+ *
+ * Error domain for #CrankDigraphLandmarks.
+ */
+#define CRANK_DIGRAPH_LANDMARKS_ERROR crank_digraph_landmarks_error_quark ()
+GQuark  crank_digraph_landmarks_error_quark (void);
+
+/**
+ * CrankDigraphLandmarksError:
+ * @CRANK_DIGRAPH_LANDMARKS_ERROR_INVALID:
+ *   The data is not landmark tables, or is truncated.
+ * @CRANK_DIGRAPH_LANDMARKS_ERROR_MISMATCH:
+ *   The data is made from different graph.
+ *
+ * Represents error codes for #CrankDigraphLandmarks.
+ */
+typedef enum _CrankDigraphLandmarksError
+{
+  CRANK_DIGRAPH_LANDMARKS_ERROR_INVALID,
+  CRANK_DIGRAPH_LANDMARKS_ERROR_MISMATCH
+} CrankDigraphLandmarksError;
+
+
+//////// Construction //////////////////////////////////////////////////////////
+
+CrankDigraphLandmarks *crank_digraph_landmarks_new (CrankDigraphFrozen *frozen,
+                                                    const guint         nlandmarks);
+
+CrankDigraphLandmarks *crank_digraph_landmarks_new_with_nodes (CrankDigraphFrozen *frozen,
+                                                               const guint        *landmarks,
+                                                               const guint         nlandmarks);
+
+CrankDigraphLandmarks *crank_digraph_landmarks_ref   (CrankDigraphLandmarks *landmarks);
+
+void                   crank_digraph_landmarks_unref (CrankDigraphLandmarks *landmarks);
+
+
+//////// Properties ////////////////////////////////////////////////////////////
+
+CrankDigraphFrozen    *crank_digraph_landmarks_get_frozen     (CrankDigraphLandmarks *landmarks);
+
+guint                  crank_digraph_landmarks_get_nlandmarks (CrankDigraphLandmarks *landmarks);
+
+guint                  crank_digraph_landmarks_get_landmark   (CrankDigraphLandmarks *landmarks,
+                                                               const guint            index);
+
+
+//////// Queries ///////////////////////////////////////////////////////////////
+
+gfloat                 crank_digraph_landmarks_estimate (CrankDigraphLandmarks *landmarks,
+                                                         const guint            from,
+                                                         const guint            to);
+
+gboolean               crank_digraph_landmarks_astar    (CrankDigraphLandmarks *landmarks,
+                                                         const guint            from,
+                                                         const guint            to,
+                                                         GArray                *path,
+                                                         gfloat                *cost);
+
+
+//////// Serialization /////////////////////////////////////////////////////////
+
+gboolean               crank_digraph_landmarks_save (CrankDigraphLandmarks  *landmarks,
+                                                     const gchar            *filename,
+                                                     GError                **error);
+
+CrankDigraphLandmarks *crank_digraph_landmarks_load (CrankDigraphFrozen  *frozen,
+                                                     const gchar         *filename,
+                                                     GError             **error);
+
+G_END_DECLS
+
+#endif
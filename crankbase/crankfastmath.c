@@ -0,0 +1,1045 @@
+/* Copyright (C) 2015, WSID   */
+
+/* Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#define _CRANKBASE_INSIDE
+
+#include <math.h>
+#include <glib.h>
+
+#include "crankfastmath.h"
+
+#include "crankcpu-private.h"
+
+#ifdef CRANK_CPU_X86
+#include <immintrin.h>
+#endif
+
+/**
+ * SECTION: crankfastmath
+ * @title: Fast Math
+ * @short_description: Approximated transcendental functions.
+ * @stability: unstable
+ * @include: crankbase.h
+ *
+ * Crank System provides approximations of some transcendental functions, which
+ * are evaluated by polynomials, without calling math library. These are less
+ * accurate than math library, but several values are evaluated at once on
+ * SIMD registers.
+ *
+ * Each function has scalar form and array form. Array forms are vectorized on
+ * CPU with AVX2 and FMA.
+ *
+ * # Accuracy
+ *
+ * Polynomials follow Cephes Math Library. Maximum errors below are measured
+ * against double precision math library, and are worse one of scalar and array
+ * forms, as array forms may use FMA.
+ *
+ * <table><title>Errors of approximations</title>
+ *   <tgroup cols="3" align="left" colsep="1" rowsep="0">
+ *     <thead>
+ *       <row>
+ *         <entry>Function</entry>
+ *         <entry>Domain</entry>
+ *         <entry>Maximum error</entry>
+ *       </row>
+ *     </thead>
+ *     <tbody>
+ *       <row>
+ *         <entry>crank_fast_expf()</entry>
+ *         <entry>[-87.3, 88.7]</entry>
+ *         <entry>1.3 ulp</entry>
+ *       </row>
+ *       <row>
+ *         <entry>crank_fast_logf()</entry>
+ *         <entry>Positive normal numbers</entry>
+ *         <entry>0.8 ulp</entry>
+ *       </row>
+ *       <row>
+ *         <entry morerows="1">crank_fast_sincosf()</entry>
+ *         <entry>[-pi, pi]</entry>
+ *         <entry>1.5 ulp</entry>
+ *       </row>
+ *       <row>
+ *         <entry>[-8192, 8192]</entry>
+ *         <entry>8e-8 (Absolute)</entry>
+ *       </row>
+ *       <row>
+ *         <entry>crank_fast_sinhcoshf()</entry>
+ *         <entry>[-88, 88]</entry>
+ *         <entry>3.1 ulp</entry>
+ *       </row>
+ *       <row>
+ *         <entry>crank_fast_atan2f()</entry>
+ *         <entry>Finite numbers</entry>
+ *         <entry>3.1 ulp</entry>
+ *       </row>
+ *     </tbody>
+ *   </tgroup>
+ * </table>
+ *
+ * Results outside of domain are not accurate. Infinite values and NaN are
+ * handled only for crank_fast_expf() and crank_fast_logf().
+ *
+ * # Fast math tier
+ *
+ * Transcendental functions of #CrankCplxFloat and #CrankQuatFloat have
+ * variants with <function>_fast</function> suffix, which use these
+ * approximations.
+ *
+ * Functions without suffix use math library by default. They can be switched
+ * to approximations globally, by crank_fast_math_set_enabled().
+ */
+
+
+//////// Private Variables /////////////////////////////////////////////////////
+
+static gint crank_fast_math_enabled = FALSE;
+
+
+//////// Constants /////////////////////////////////////////////////////////////
+
+#define CRANK_FAST_LOG2E        1.44269504088896341f
+
+// Splitted ln 2, so that n * CRANK_FAST_LN2_HI is exact.
+#define CRANK_FAST_LN2_HI       0.693359375f
+#define CRANK_FAST_LN2_LO       -2.12194440e-4f
+
+#define CRANK_FAST_EXP_MIN      -104.0f
+#define CRANK_FAST_EXP_MAX      89.0f
+
+#define CRANK_FAST_EXP_P0       1.9875691500e-4f
+#define CRANK_FAST_EXP_P1       1.3981999507e-3f
+#define CRANK_FAST_EXP_P2       8.3334519073e-3f
+#define CRANK_FAST_EXP_P3       4.1665795894e-2f
+#define CRANK_FAST_EXP_P4       1.6666665459e-1f
+#define CRANK_FAST_EXP_P5       5.0000001201e-1f
+
+#define CRANK_FAST_LOG_P0       7.0376836292e-2f
+#define CRANK_FAST_LOG_P1       -1.1514610310e-1f
+#define CRANK_FAST_LOG_P2       1.1676998740e-1f
+#define CRANK_FAST_LOG_P3       -1.2420140846e-1f
+#define CRANK_FAST_LOG_P4       1.4249322787e-1f
+#define CRANK_FAST_LOG_P5       -1.6668057665e-1f
+#define CRANK_FAST_LOG_P6       2.0000714765e-1f
+#define CRANK_FAST_LOG_P7       -2.4999993993e-1f
+#define CRANK_FAST_LOG_P8       3.3333331174e-1f
+
+// Splitted pi / 4, for reduction of trigonometric functions.
+#define CRANK_FAST_PIO4_1       0.78515625f
+#define CRANK_FAST_PIO4_2       2.4187564849853515625e-4f
+#define CRANK_FAST_PIO4_3       3.77489497744594108e-8f
+
+// Limit of octant index, so that it fits in integer.
+#define CRANK_FAST_OCTANT_MAX   1073741824.0f
+
+#define CRANK_FAST_SIN_P0       -1.9515295891e-4f
+#define CRANK_FAST_SIN_P1       8.3321608736e-3f
+#define CRANK_FAST_SIN_P2       -1.6666654611e-1f
+
+#define CRANK_FAST_COS_P0       2.443315711809948e-5f
+#define CRANK_FAST_COS_P1       -1.388731625493765e-3f
+#define CRANK_FAST_COS_P2       4.166664568298827e-2f
+
+// Below this, sinh is evaluated by Taylor series, to avoid cancellation.
+#define CRANK_FAST_SINH_SMALL   0.5f
+
+#define CRANK_FAST_SINH_P0      (1.0f / 5040)
+#define CRANK_FAST_SINH_P1      (1.0f / 120)
+#define CRANK_FAST_SINH_P2      (1.0f / 6)
+
+#define CRANK_FAST_TAN_PIO8     0.414213562373095f
+
+#define CRANK_FAST_ATAN_P0      8.05374449538e-2f
+#define CRANK_FAST_ATAN_P1      -1.38776856032e-1f
+#define CRANK_FAST_ATAN_P2      1.99777106478e-1f
+#define CRANK_FAST_ATAN_P3      -3.33329491539e-1f
+
+
+//////// Private Functions /////////////////////////////////////////////////////
+
+typedef union _CrankFastBits {
+  gfloat  f;
+  gint32  i;
+} CrankFastBits;
+
+// Gets 2 ^ n, for n in normal range of exponent.
+static inline gfloat
+crank_fast_pow2i (const gint32 n)
+{
+  CrankFastBits b;
+
+  b.i = (n + 127) << 23;
+  return b.f;
+}
+
+static inline gfloat
+crank_fast_expf_inline (gfloat x)
+{
+  gfloat n;
+  gfloat r;
+  gfloat y;
+  gint32 ni;
+  gint32 nh;
+
+  if (isnan (x))
+    return x;
+
+  x = CLAMP (x, CRANK_FAST_EXP_MIN, CRANK_FAST_EXP_MAX);
+
+  // x = n ln 2 + r, where |r| <= ln 2 / 2
+  n = rintf (x * CRANK_FAST_LOG2E);
+  r = x - n * CRANK_FAST_LN2_HI;
+  r = r - n * CRANK_FAST_LN2_LO;
+
+  y = CRANK_FAST_EXP_P0;
+  y = y * r + CRANK_FAST_EXP_P1;
+  y = y * r + CRANK_FAST_EXP_P2;
+  y = y * r + CRANK_FAST_EXP_P3;
+  y = y * r + CRANK_FAST_EXP_P4;
+  y = y * r + CRANK_FAST_EXP_P5;
+  y = y * (r * r) + r + 1;
+
+  // 2 ^ n is applied in two steps, so that overflow and subnormal results
+  // are produced by multiplication.
+  ni = (gint32) n;
+  nh = ni >> 1;
+
+  return y * crank_fast_pow2i (nh) * crank_fast_pow2i (ni - nh);
+}
+
+static inline gfloat
+crank_fast_logf_inline (gfloat x)
+{
+  CrankFastBits b;
+  gfloat e;
+  gfloat m;
+  gfloat z;
+  gfloat y;
+
+  if (! (x > 0))
+    return (x == 0) ? -INFINITY : NAN;
+
+  if (x == INFINITY)
+    return x;
+
+  // Subnormal numbers are normalized first.
+  e = 0;
+  if (x < G_MINFLOAT)
+    {
+      x *= 33554432.0f;
+      e = -25;
+    }
+
+  // x = m * 2 ^ e, where 0.5 <= m < 1
+  b.f = x;
+  e += (gfloat) (((b.i >> 23) & 0xff) - 126);
+  b.i = (b.i & 0x807fffff) | 0x3f000000;
+  m = b.f;
+
+  if (m < G_SQRT2 / 2)
+    {
+      e -= 1;
+      m = m + m - 1;
+    }
+  else
+    {
+      m = m - 1;
+    }
+
+  z = m * m;
+
+  y = CRANK_FAST_LOG_P0;
+  y = y * m + CRANK_FAST_LOG_P1;
+  y = y * m + CRANK_FAST_LOG_P2;
+  y = y * m + CRANK_FAST_LOG_P3;
+  y = y * m + CRANK_FAST_LOG_P4;
+  y = y * m + CRANK_FAST_LOG_P5;
+  y = y * m + CRANK_FAST_LOG_P6;
+  y = y * m + CRANK_FAST_LOG_P7;
+  y = y * m + CRANK_FAST_LOG_P8;
+  y = y * m * z;
+
+  y += e * CRANK_FAST_LN2_LO;
+  y -= 0.5f * z;
+
+  return m + y + e * CRANK_FAST_LN2_HI;
+}
+
+static inline void
+crank_fast_sincosf_inline (const gfloat  x,
+                           gfloat       *s,
+                           gfloat       *c)
+{
+  gfloat ax = fabsf (x);
+  gfloat y;
+  gfloat r;
+  gfloat z;
+  gfloat ps;
+  gfloat pc;
+  guint32 j;
+
+  // |x| = j pi / 4 + r, where j is even and |r| <= pi / 4
+  j = (guint32) MIN (ax * (gfloat)(4 / G_PI), CRANK_FAST_OCTANT_MAX);
+  j = (j + 1) & ~1u;
+  y = (gfloat) j;
+
+  r = ax - y * CRANK_FAST_PIO4_1;
+  r = r - y * CRANK_FAST_PIO4_2;
+  r = r - y * CRANK_FAST_PIO4_3;
+  z = r * r;
+
+  ps = CRANK_FAST_SIN_P0;
+  ps = ps * z + CRANK_FAST_SIN_P1;
+  ps = ps * z + CRANK_FAST_SIN_P2;
+  ps = ps * z * r + r;
+
+  pc = CRANK_FAST_COS_P0;
+  pc = pc * z + CRANK_FAST_COS_P1;
+  pc = pc * z + CRANK_FAST_COS_P2;
+  pc = pc * z * z - 0.5f * z + 1;
+
+  // Selects by quadrant.
+  j = (j >> 1) & 3;
+
+  *s = (j & 1) ? pc : ps;
+  *c = (j & 1) ? ps : pc;
+
+  if (j & 2)
+    *s = -*s;
+
+  if ((j + 1) & 2)
+    *c = -*c;
+
+  if (x < 0)
+    *s = -*s;
+}
+
+static inline void
+crank_fast_sinhcoshf_inline (const gfloat  x,
+                             gfloat       *sh,
+                             gfloat       *ch)
+{
+  gfloat ax = fabsf (x);
+  gfloat e = crank_fast_expf_inline (ax);
+  gfloat ei = 1 / e;
+  gfloat s;
+
+  if (ax < CRANK_FAST_SINH_SMALL)
+    {
+      gfloat z = ax * ax;
+
+      s = CRANK_FAST_SINH_P0;
+      s = s * z + CRANK_FAST_SINH_P1;
+      s = s * z + CRANK_FAST_SINH_P2;
+      s = s * z * ax + ax;
+    }
+  else
+    {
+      s = 0.5f * (e - ei);
+    }
+
+  *sh = (x < 0) ? -s : s;
+  *ch = 0.5f * (e + ei);
+}
+
+static inline gfloat
+crank_fast_atan2f_inline (const gfloat y,
+                          const gfloat x)
+{
+  gfloat ax = fabsf (x);
+  gfloat ay = fabsf (y);
+  gfloat mn = MIN (ax, ay);
+  gfloat mx = MAX (ax, ay);
+  gfloat t;
+  gfloat a0;
+  gfloat z;
+  gfloat a;
+
+  // atan of t in [0, 1], and reduced into [-tan (pi / 8), tan (pi / 8)].
+  t = (mx == 0) ? 0 : mn / mx;
+  a0 = 0;
+
+  if (CRANK_FAST_TAN_PIO8 < t)
+    {
+      t = (t - 1) / (t + 1);
+      a0 = G_PI_4;
+    }
+
+  z = t * t;
+
+  a = CRANK_FAST_ATAN_P0;
+  a = a * z + CRANK_FAST_ATAN_P1;
+  a = a * z + CRANK_FAST_ATAN_P2;
+  a = a * z + CRANK_FAST_ATAN_P3;
+  a = a * z * t + t + a0;
+
+  // Restores octant.
+  if (ax < ay)
+    a = (gfloat) G_PI_2 - a;
+
+  if (x < 0)
+    a = (gfloat) G_PI - a;
+
+  return (y < 0) ? -a : a;
+}
+
+static void
+crank_fast_expf_array_generic (const guint   n,
+                               const gfloat *x,
+                               gfloat       *r)
+{
+  guint i;
+
+  for (i = 0; i < n; i++)
+    r[i] = crank_fast_expf_inline (x[i]);
+}
+
+static void
+crank_fast_logf_array_generic (const guint   n,
+                               const gfloat *x,
+                               gfloat       *r)
+{
+  guint i;
+
+  for (i = 0; i < n; i++)
+    r[i] = crank_fast_logf_inline (x[i]);
+}
+
+static void
+crank_fast_sincosf_array_generic (const guint   n,
+                                  const gfloat *x,
+                                  gfloat       *s,
+                                  gfloat       *c)
+{
+  guint i;
+
+  for (i = 0; i < n; i++)
+    crank_fast_sincosf_inline (x[i], s + i, c + i);
+}
+
+static void
+crank_fast_sinhcoshf_array_generic (const guint   n,
+                                    const gfloat *x,
+                                    gfloat       *sh,
+                                    gfloat       *ch)
+{
+  guint i;
+
+  for (i = 0; i < n; i++)
+    crank_fast_sinhcoshf_inline (x[i], sh + i, ch + i);
+}
+
+static void
+crank_fast_atan2f_array_generic (const guint   n,
+                                 const gfloat *y,
+                                 const gfloat *x,
+                                 gfloat       *r)
+{
+  guint i;
+
+  for (i = 0; i < n; i++)
+    r[i] = crank_fast_atan2f_inline (y[i], x[i]);
+}
+
+#ifdef CRANK_CPU_X86
+
+// AVX2 kernels follow scalar ones above. They process 8 values at once, and
+// leave remainings to generic ones. Upper halves of registers are cleared
+// before that, as compiler may not do it on tail calls, and following SSE
+// code in math library would be slowed down.
+
+__attribute__((target ("avx2,fma")))
+static inline __m256
+crank_fast_expf_avx2 (__m256 x)
+{
+  __m256 nan = _mm256_cmp_ps (x, x, _CMP_UNORD_Q);
+  __m256 n;
+  __m256 r;
+  __m256 y;
+  __m256i ni;
+  __m256i nh;
+  __m256i bias = _mm256_set1_epi32 (127);
+
+  x = _mm256_max_ps (x, _mm256_set1_ps (CRANK_FAST_EXP_MIN));
+  x = _mm256_min_ps (x, _mm256_set1_ps (CRANK_FAST_EXP_MAX));
+
+  n = _mm256_round_ps (_mm256_mul_ps (x, _mm256_set1_ps (CRANK_FAST_LOG2E)),
+                       _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+  r = _mm256_fnmadd_ps (n, _mm256_set1_ps (CRANK_FAST_LN2_HI), x);
+  r = _mm256_fnmadd_ps (n, _mm256_set1_ps (CRANK_FAST_LN2_LO), r);
+
+  y = _mm256_set1_ps (CRANK_FAST_EXP_P0);
+  y = _mm256_fmadd_ps (y, r, _mm256_set1_ps (CRANK_FAST_EXP_P1));
+  y = _mm256_fmadd_ps (y, r, _mm256_set1_ps (CRANK_FAST_EXP_P2));
+  y = _mm256_fmadd_ps (y, r, _mm256_set1_ps (CRANK_FAST_EXP_P3));
+  y = _mm256_fmadd_ps (y, r, _mm256_set1_ps (CRANK_FAST_EXP_P4));
+  y = _mm256_fmadd_ps (y, r, _mm256_set1_ps (CRANK_FAST_EXP_P5));
+  y = _mm256_fmadd_ps (y, _mm256_mul_ps (r, r),
+                       _mm256_add_ps (r, _mm256_set1_ps (1)));
+
+  ni = _mm256_cvtps_epi32 (n);
+  nh = _mm256_srai_epi32 (ni, 1);
+  ni = _mm256_sub_epi32 (ni, nh);
+
+  nh = _mm256_slli_epi32 (_mm256_add_epi32 (nh, bias), 23);
+  ni = _mm256_slli_epi32 (_mm256_add_epi32 (ni, bias), 23);
+
+  y = _mm256_mul_ps (y, _mm256_castsi256_ps (nh));
+  y = _mm256_mul_ps (y, _mm256_castsi256_ps (ni));
+
+  return _mm256_or_ps (y, nan);
+}
+
+__attribute__((target ("avx2,fma")))
+static inline __m256
+crank_fast_logf_avx2 (__m256 x)
+{
+  __m256 zero = _mm256_setzero_ps ();
+  __m256 one = _mm256_set1_ps (1);
+  __m256 sub;
+  __m256 e;
+  __m256 m;
+  __m256 lt;
+  __m256 z;
+  __m256 y;
+  __m256 r;
+  __m256i b;
+
+  // Subnormal numbers are normalized first.
+  sub = _mm256_cmp_ps (x, _mm256_set1_ps (G_MINFLOAT), _CMP_LT_OQ);
+  m = _mm256_blendv_ps (x, _mm256_mul_ps (x, _mm256_set1_ps (33554432.0f)),
+                        sub);
+  e = _mm256_and_ps (sub, _mm256_set1_ps (-25));
+
+  b = _mm256_castps_si256 (m);
+  e = _mm256_add_ps (e, _mm256_cvtepi32_ps (
+        _mm256_sub_epi32 (_mm256_and_si256 (_mm256_srli_epi32 (b, 23),
+                                            _mm256_set1_epi32 (0xff)),
+                          _mm256_set1_epi32 (126))));
+  b = _mm256_or_si256 (_mm256_and_si256 (b, _mm256_set1_epi32 (0x807fffff)),
+                       _mm256_set1_epi32 (0x3f000000));
+  m = _mm256_castsi256_ps (b);
+
+  lt = _mm256_cmp_ps (m, _mm256_set1_ps (G_SQRT2 / 2), _CMP_LT_OQ);
+  e = _mm256_sub_ps (e, _mm256_and_ps (lt, one));
+  m = _mm256_sub_ps (_mm256_add_ps (m, _mm256_and_ps (lt, m)), one);
+
+  z = _mm256_mul_ps (m, m);
+
+  y = _mm256_set1_ps (CRANK_FAST_LOG_P0);
+  y = _mm256_fmadd_ps (y, m, _mm256_set1_ps (CRANK_FAST_LOG_P1));
+  y = _mm256_fmadd_ps (y, m, _mm256_set1_ps (CRANK_FAST_LOG_P2));
+  y = _mm256_fmadd_ps (y, m, _mm256_set1_ps (CRANK_FAST_LOG_P3));
+  y = _mm256_fmadd_ps (y, m, _mm256_set1_ps (CRANK_FAST_LOG_P4));
+  y = _mm256_fmadd_ps (y, m, _mm256_set1_ps (CRANK_FAST_LOG_P5));
+  y = _mm256_fmadd_ps (y, m, _mm256_set1_ps (CRANK_FAST_LOG_P6));
+  y = _mm256_fmadd_ps (y, m, _mm256_set1_ps (CRANK_FAST_LOG_P7));
+  y = _mm256_fmadd_ps (y, m, _mm256_set1_ps (CRANK_FAST_LOG_P8));
+  y = _mm256_mul_ps (_mm256_mul_ps (y, m), z);
+
+  y = _mm256_fmadd_ps (e, _mm256_set1_ps (CRANK_FAST_LN2_LO), y);
+  y = _mm256_fnmadd_ps (_mm256_set1_ps (0.5f), z, y);
+  r = _mm256_fmadd_ps (e, _mm256_set1_ps (CRANK_FAST_LN2_HI),
+                       _mm256_add_ps (m, y));
+
+  // Special values: 0 -> -inf, negative and NaN -> NaN, inf -> inf.
+  r = _mm256_blendv_ps (r, _mm256_set1_ps (NAN),
+                        _mm256_cmp_ps (x, zero, _CMP_NGT_UQ));
+  r = _mm256_blendv_ps (r, _mm256_set1_ps (-INFINITY),
+                        _mm256_cmp_ps (x, zero, _CMP_EQ_OQ));
+  r = _mm256_blendv_ps (r, x,
+                        _mm256_cmp_ps (x, _mm256_set1_ps (INFINITY),
+                                       _CMP_EQ_OQ));
+  return r;
+}
+
+__attribute__((target ("avx2,fma")))
+static inline void
+crank_fast_sincosf_avx2 (__m256  x,
+                         __m256 *s,
+                         __m256 *c)
+{
+  __m256 signbit = _mm256_set1_ps (-0.0f);
+  __m256 ax = _mm256_andnot_ps (signbit, x);
+  __m256 y;
+  __m256 r;
+  __m256 z;
+  __m256 ps;
+  __m256 pc;
+  __m256 swap;
+  __m256 ssign;
+  __m256 csign;
+  __m256i j;
+  __m256i one = _mm256_set1_epi32 (1);
+  __m256i two = _mm256_set1_epi32 (2);
+
+  y = _mm256_mul_ps (ax, _mm256_set1_ps ((gfloat)(4 / G_PI)));
+  y = _mm256_min_ps (y, _mm256_set1_ps (CRANK_FAST_OCTANT_MAX));
+  j = _mm256_cvttps_epi32 (y);
+  j = _mm256_andnot_si256 (one, _mm256_add_epi32 (j, one));
+  y = _mm256_cvtepi32_ps (j);
+
+  r = _mm256_fnmadd_ps (y, _mm256_set1_ps (CRANK_FAST_PIO4_1), ax);
+  r = _mm256_fnmadd_ps (y, _mm256_set1_ps (CRANK_FAST_PIO4_2), r);
+  r = _mm256_fnmadd_ps (y, _mm256_set1_ps (CRANK_FAST_PIO4_3), r);
+  z = _mm256_mul_ps (r, r);
+
+  ps = _mm256_set1_ps (CRANK_FAST_SIN_P0);
+  ps = _mm256_fmadd_ps (ps, z, _mm256_set1_ps (CRANK_FAST_SIN_P1));
+  ps = _mm256_fmadd_ps (ps, z, _mm256_set1_ps (CRANK_FAST_SIN_P2));
+  ps = _mm256_fmadd_ps (_mm256_mul_ps (ps, z), r, r);
+
+  pc = _mm256_set1_ps (CRANK_FAST_COS_P0);
+  pc = _mm256_fmadd_ps (pc, z, _mm256_set1_ps (CRANK_FAST_COS_P1));
+  pc = _mm256_fmadd_ps (pc, z, _mm256_set1_ps (CRANK_FAST_COS_P2));
+  pc = _mm256_mul_ps (_mm256_mul_ps (pc, z), z);
+  pc = _mm256_fnmadd_ps (_mm256_set1_ps (0.5f), z, pc);
+  pc = _mm256_add_ps (pc, _mm256_set1_ps (1));
+
+  // Selects by quadrant.
+  j = _mm256_srli_epi32 (j, 1);
+  swap = _mm256_castsi256_ps (
+           _mm256_cmpeq_epi32 (_mm256_and_si256 (j, one), one));
+  ssign = _mm256_castsi256_ps (
+            _mm256_slli_epi32 (_mm256_and_si256 (j, two), 30));
+  csign = _mm256_castsi256_ps (
+            _mm256_slli_epi32 (
+              _mm256_and_si256 (_mm256_add_epi32 (j, one), two), 30));
+  ssign = _mm256_xor_ps (ssign, _mm256_and_ps (x, signbit));
+
+  *s = _mm256_xor_ps (_mm256_blendv_ps (ps, pc, swap), ssign);
+  *c = _mm256_xor_ps (_mm256_blendv_ps (pc, ps, swap), csign);
+}
+
+__attribute__((target ("avx2,fma")))
+static inline void
+crank_fast_sinhcoshf_avx2 (__m256  x,
+                           __m256 *sh,
+                           __m256 *ch)
+{
+  __m256 signbit = _mm256_set1_ps (-0.0f);
+  __m256 half = _mm256_set1_ps (0.5f);
+  __m256 ax = _mm256_andnot_ps (signbit, x);
+  __m256 e = crank_fast_expf_avx2 (ax);
+  __m256 ei = _mm256_div_ps (_mm256_set1_ps (1), e);
+  __m256 z = _mm256_mul_ps (ax, ax);
+  __m256 small;
+  __m256 s;
+  __m256 p;
+
+  p = _mm256_set1_ps (CRANK_FAST_SINH_P0);
+  p = _mm256_fmadd_ps (p, z, _mm256_set1_ps (CRANK_FAST_SINH_P1));
+  p = _mm256_fmadd_ps (p, z, _mm256_set1_ps (CRANK_FAST_SINH_P2));
+  p = _mm256_fmadd_ps (_mm256_mul_ps (p, z), ax, ax);
+
+  s = _mm256_mul_ps (half, _mm256_sub_ps (e, ei));
+  small = _mm256_cmp_ps (ax, _mm256_set1_ps (CRANK_FAST_SINH_SMALL),
+                         _CMP_LT_OQ);
+  s = _mm256_blendv_ps (s, p, small);
+
+  *sh = _mm256_xor_ps (s, _mm256_and_ps (x, signbit));
+  *ch = _mm256_mul_ps (half, _mm256_add_ps (e, ei));
+}
+
+__attribute__((target ("avx2,fma")))
+static inline __m256
+crank_fast_atan2f_avx2 (__m256 y,
+                        __m256 x)
+{
+  __m256 signbit = _mm256_set1_ps (-0.0f);
+  __m256 one = _mm256_set1_ps (1);
+  __m256 ax = _mm256_andnot_ps (signbit, x);
+  __m256 ay = _mm256_andnot_ps (signbit, y);
+  __m256 mn = _mm256_min_ps (ax, ay);
+  __m256 mx = _mm256_max_ps (ax, ay);
+  __m256 t;
+  __m256 big;
+  __m256 z;
+  __m256 a;
+
+  t = _mm256_div_ps (mn, mx);
+  t = _mm256_andnot_ps (_mm256_cmp_ps (mx, _mm256_setzero_ps (), _CMP_EQ_OQ),
+                        t);
+
+  big = _mm256_cmp_ps (_mm256_set1_ps (CRANK_FAST_TAN_PIO8), t, _CMP_LT_OQ);
+  t = _mm256_blendv_ps (t,
+                        _mm256_div_ps (_mm256_sub_ps (t, one),
+                                       _mm256_add_ps (t, one)),
+                        big);
+
+  z = _mm256_mul_ps (t, t);
+
+  a = _mm256_set1_ps (CRANK_FAST_ATAN_P0);
+  a = _mm256_fmadd_ps (a, z, _mm256_set1_ps (CRANK_FAST_ATAN_P1));
+  a = _mm256_fmadd_ps (a, z, _mm256_set1_ps (CRANK_FAST_ATAN_P2));
+  a = _mm256_fmadd_ps (a, z, _mm256_set1_ps (CRANK_FAST_ATAN_P3));
+  a = _mm256_fmadd_ps (_mm256_mul_ps (a, z), t, t);
+  a = _mm256_add_ps (a, _mm256_and_ps (big, _mm256_set1_ps (G_PI_4)));
+
+  // Restores octant.
+  a = _mm256_blendv_ps (a,
+                        _mm256_sub_ps (_mm256_set1_ps (G_PI_2), a),
+                        _mm256_cmp_ps (ax, ay, _CMP_LT_OQ));
+  a = _mm256_blendv_ps (a,
+                        _mm256_sub_ps (_mm256_set1_ps (G_PI), a),
+                        _mm256_cmp_ps (x, _mm256_setzero_ps (), _CMP_LT_OQ));
+
+  return _mm256_or_ps (a, _mm256_and_ps (
+                            _mm256_cmp_ps (y, _mm256_setzero_ps (),
+                                           _CMP_LT_OQ),
+                            signbit));
+}
+
+__attribute__((target ("avx2,fma")))
+static void
+crank_fast_expf_array_avx2 (const guint   n,
+                            const gfloat *x,
+                            gfloat       *r)
+{
+  guint i;
+
+  for (i = 0; i + 8 <= n; i += 8)
+    _mm256_storeu_ps (r + i, crank_fast_expf_avx2 (_mm256_loadu_ps (x + i)));
+
+  _mm256_zeroupper ();
+  crank_fast_expf_array_generic (n - i, x + i, r + i);
+}
+
+__attribute__((target ("avx2,fma")))
+static void
+crank_fast_logf_array_avx2 (const guint   n,
+                            const gfloat *x,
+                            gfloat       *r)
+{
+  guint i;
+
+  for (i = 0; i + 8 <= n; i += 8)
+    _mm256_storeu_ps (r + i, crank_fast_logf_avx2 (_mm256_loadu_ps (x + i)));
+
+  _mm256_zeroupper ();
+  crank_fast_logf_array_generic (n - i, x + i, r + i);
+}
+
+__attribute__((target ("avx2,fma")))
+static void
+crank_fast_sincosf_array_avx2 (const guint   n,
+                               const gfloat *x,
+                               gfloat       *s,
+                               gfloat       *c)
+{
+  guint i;
+
+  for (i = 0; i + 8 <= n; i += 8)
+    {
+      __m256 vs;
+      __m256 vc;
+
+      crank_fast_sincosf_avx2 (_mm256_loadu_ps (x + i), &vs, &vc);
+      _mm256_storeu_ps (s + i, vs);
+      _mm256_storeu_ps (c + i, vc);
+    }
+
+  _mm256_zeroupper ();
+  crank_fast_sincosf_array_generic (n - i, x + i, s + i, c + i);
+}
+
+__attribute__((target ("avx2,fma")))
+static void
+crank_fast_sinhcoshf_array_avx2 (const guint   n,
+                                 const gfloat *x,
+                                 gfloat       *sh,
+                                 gfloat       *ch)
+{
+  guint i;
+
+  for (i = 0; i + 8 <= n; i += 8)
+    {
+      __m256 vsh;
+      __m256 vch;
+
+      crank_fast_sinhcoshf_avx2 (_mm256_loadu_ps (x + i), &vsh, &vch);
+      _mm256_storeu_ps (sh + i, vsh);
+      _mm256_storeu_ps (ch + i, vch);
+    }
+
+  _mm256_zeroupper ();
+  crank_fast_sinhcoshf_array_generic (n - i, x + i, sh + i, ch + i);
+}
+
+__attribute__((target ("avx2,fma")))
+static void
+crank_fast_atan2f_array_avx2 (const guint   n,
+                              const gfloat *y,
+                              const gfloat *x,
+                              gfloat       *r)
+{
+  guint i;
+
+  for (i = 0; i + 8 <= n; i += 8)
+    _mm256_storeu_ps (r + i, crank_fast_atan2f_avx2 (_mm256_loadu_ps (y + i),
+                                                     _mm256_loadu_ps (x + i)));
+
+  _mm256_zeroupper ();
+  crank_fast_atan2f_array_generic (n - i, y + i, x + i, r + i);
+}
+
+#endif
+
+
+//////// Global setting ////////////////////////////////////////////////////////
+
+/**
+ * crank_fast_math_set_enabled:
+ * @enabled: Whether to use approximations.
+ *
+ * Sets whether transcendental functions of #CrankCplxFloat and
+ * #CrankQuatFloat use approximations by default. Initially it is %FALSE.
+ */
+void
+crank_fast_math_set_enabled (const gboolean enabled)
+{
+  g_atomic_int_set (&crank_fast_math_enabled, enabled ? TRUE : FALSE);
+}
+
+/**
+ * crank_fast_math_get_enabled:
+ *
+ * Gets whether transcendental functions of #CrankCplxFloat and
+ * #CrankQuatFloat use approximations by default.
+ *
+ * Returns: Whether approximations are used.
+ */
+gboolean
+crank_fast_math_get_enabled (void)
+{
+  return g_atomic_int_get (&crank_fast_math_enabled);
+}
+
+
+//////// Scalar functions //////////////////////////////////////////////////////
+
+/**
+ * crank_fast_expf:
+ * @x: A Value.
+ *
+ * Gets approximated e-based exponential of @x.
+ *
+ * Returns: Approximation of exp (@x).
+ */
+gfloat
+crank_fast_expf (const gfloat x)
+{
+  return crank_fast_expf_inline (x);
+}
+
+/**
+ * crank_fast_logf:
+ * @x: A Value.
+ *
+ * Gets approximated natural log of @x.
+ *
+ * Returns: Approximation of log (@x).
+ */
+gfloat
+crank_fast_logf (const gfloat x)
+{
+  return crank_fast_logf_inline (x);
+}
+
+/**
+ * crank_fast_sincosf:
+ * @x: A Value.
+ * @s: (out): Approximation of sin (@x).
+ * @c: (out): Approximation of cos (@x).
+ *
+ * Gets approximated sin and cos of @x at once.
+ */
+void
+crank_fast_sincosf (const gfloat  x,
+                    gfloat       *s,
+                    gfloat       *c)
+{
+  crank_fast_sincosf_inline (x, s, c);
+}
+
+/**
+ * crank_fast_sinhcoshf:
+ * @x: A Value.
+ * @sh: (out): Approximation of sinh (@x).
+ * @ch: (out): Approximation of cosh (@x).
+ *
+ * Gets approximated sinh and cosh of @x at once.
+ */
+void
+crank_fast_sinhcoshf (const gfloat  x,
+                      gfloat       *sh,
+                      gfloat       *ch)
+{
+  crank_fast_sinhcoshf_inline (x, sh, ch);
+}
+
+/**
+ * crank_fast_atan2f:
+ * @y: Y coordinate.
+ * @x: X coordinate.
+ *
+ * Gets approximated angle of point (@x, @y), as atan2f() does.
+ *
+ * Returns: Approximation of atan2 (@y, @x), in [-pi, pi].
+ */
+gfloat
+crank_fast_atan2f (const gfloat y,
+                   const gfloat x)
+{
+  return crank_fast_atan2f_inline (y, x);
+}
+
+
+//////// Array functions ///////////////////////////////////////////////////////
+
+/**
+ * crank_fast_expf_array:
+ * @n: Count of values.
+ * @x: (array length=n): Values.
+ * @r: (out caller-allocates) (array length=n): Array to store results.
+ *
+ * Gets approximated e-based exponential of each values. @r may be same with
+ * @x.
+ */
+void
+crank_fast_expf_array (const guint   n,
+                       const gfloat *x,
+                       gfloat       *r)
+{
+#ifdef CRANK_CPU_X86
+  if (CRANK_CPU_SIMD_AVX2 <= _crank_cpu_get_simd_level ())
+    {
+      crank_fast_expf_array_avx2 (n, x, r);
+      return;
+    }
+#endif
+
+  crank_fast_expf_array_generic (n, x, r);
+}
+
+/**
+ * crank_fast_logf_array:
+ * @n: Count of values.
+ * @x: (array length=n): Values.
+ * @r: (out caller-allocates) (array length=n): Array to store results.
+ *
+ * Gets approximated natural log of each values. @r may be same with @x.
+ */
+void
+crank_fast_logf_array (const guint   n,
+                       const gfloat *x,
+                       gfloat       *r)
+{
+#ifdef CRANK_CPU_X86
+  if (CRANK_CPU_SIMD_AVX2 <= _crank_cpu_get_simd_level ())
+    {
+      crank_fast_logf_array_avx2 (n, x, r);
+      return;
+    }
+#endif
+
+  crank_fast_logf_array_generic (n, x, r);
+}
+
+/**
+ * crank_fast_sincosf_array:
+ * @n: Count of values.
+ * @x: (array length=n): Values.
+ * @s: (out caller-allocates) (array length=n): Array to store sin.
+ * @c: (out caller-allocates) (array length=n): Array to store cos.
+ *
+ * Gets approximated sin and cos of each values. @s or @c may be same with @x.
+ */
+void
+crank_fast_sincosf_array (const guint   n,
+                          const gfloat *x,
+                          gfloat       *s,
+                          gfloat       *c)
+{
+#ifdef CRANK_CPU_X86
+  if (CRANK_CPU_SIMD_AVX2 <= _crank_cpu_get_simd_level ())
+    {
+      crank_fast_sincosf_array_avx2 (n, x, s, c);
+      return;
+    }
+#endif
+
+  crank_fast_sincosf_array_generic (n, x, s, c);
+}
+
+/**
+ * crank_fast_sinhcoshf_array:
+ * @n: Count of values.
+ * @x: (array length=n): Values.
+ * @sh: (out caller-allocates) (array length=n): Array to store sinh.
+ * @ch: (out caller-allocates) (array length=n): Array to store cosh.
+ *
+ * Gets approximated sinh and cosh of each values. @sh or @ch may be same with
+ * @x.
+ */
+void
+crank_fast_sinhcoshf_array (const guint   n,
+                            const gfloat *x,
+                            gfloat       *sh,
+                            gfloat       *ch)
+{
+#ifdef CRANK_CPU_X86
+  if (CRANK_CPU_SIMD_AVX2 <= _crank_cpu_get_simd_level ())
+    {
+      crank_fast_sinhcoshf_array_avx2 (n, x, sh, ch);
+      return;
+    }
+#endif
+
+  crank_fast_sinhcoshf_array_generic (n, x, sh, ch);
+}
+
+/**
+ * crank_fast_atan2f_array:
+ * @n: Count of values.
+ * @y: (array length=n): Y coordinates.
+ * @x: (array length=n): X coordinates.
+ * @r: (out caller-allocates) (array length=n): Array to store angles.
+ *
+ * Gets approximated angles of each points. @r may be same with @y or @x.
+ */
+void
+crank_fast_atan2f_array (const guint   n,
+                         const gfloat *y,
+                         const gfloat *x,
+                         gfloat       *r)
+{
+#ifdef CRANK_CPU_X86
+  if (CRANK_CPU_SIMD_AVX2 <= _crank_cpu_get_simd_level ())
+    {
+      crank_fast_atan2f_array_avx2 (n, y, x, r);
+      return;
+    }
+#endif
+
+  crank_fast_atan2f_array_generic (n, y, x, r);
+}
@@ -0,0 +1,83 @@
+#ifndef CRANKFASTMATH_H
+#define CRANKFASTMATH_H
+
+/* Copyright (C) 2015, WSID   */
+
+/* Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef _CRANKBASE_INSIDE
+#error crankfastmath.h cannot be included directly.
+#endif
+
+#include <glib.h>
+
+G_BEGIN_DECLS
+
+//////// Global setting ////////////////////////////////////////////////////////
+
+void      crank_fast_math_set_enabled (const gboolean enabled);
+
+gboolean  crank_fast_math_get_enabled (void);
+
+//////// Scalar functions //////////////////////////////////////////////////////
+
+gfloat    crank_fast_expf             (const gfloat x);
+
+gfloat    crank_fast_logf             (const gfloat x);
+
+void      crank_fast_sincosf          (const gfloat  x,
+                                       gfloat       *s,
+                                       gfloat       *c);
+
+void      crank_fast_sinhcoshf        (const gfloat  x,
+                                       gfloat       *sh,
+                                       gfloat       *ch);
+
+gfloat    crank_fast_atan2f           (const gfloat y,
+                                       const gfloat x);
+
+//////// Array functions ///////////////////////////////////////////////////////
+
+void      crank_fast_expf_array       (const guint   n,
+                                       const gfloat *x,
+                                       gfloat       *r);
+
+void      crank_fast_logf_array       (const guint   n,
+                                       const gfloat *x,
+                                       gfloat       *r);
+
+void      crank_fast_sincosf_array    (const guint   n,
+                                       const gfloat *x,
+                                       gfloat       *s,
+                                       gfloat       *c);
+
+void      crank_fast_sinhcoshf_array  (const guint   n,
+                                       const gfloat *x,
+                                       gfloat       *sh,
+                                       gfloat       *ch);
+
+void      crank_fast_atan2f_array     (const guint   n,
+                                       const gfloat *y,
+                                       const gfloat *x,
+                                       gfloat       *r);
+
+G_END_DECLS
+
+#endif
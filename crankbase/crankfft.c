@@ -0,0 +1,1435 @@
+/* Copyright (C) 2015, WSID   */
+
+/* Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+#define _CRANKBASE_INSIDE
+
+#include <string.h>
+#include <math.h>
+
+#include <glib.h>
+#include <glib-object.h>
+
+#include "crankcomplex.h"
+#include "crankparallel.h"
+#include "crankvecfloat.h"
+#include "crankveccplxfloat.h"
+#include "crankmatcplxfloat.h"
+#include "crankmatarena.h"
+#include "crankfft.h"
+
+#include "crankcpu-private.h"
+
+/**
+ * SECTION: crankfft
+ * @title: Fast Fourier Transform
+ * @short_description: Discrete fourier transform in O(n log n).
+ * @stability: Unstable
+ * @include: crankbase.h
+ *
+ * Crank System provides fast fourier transform over #CrankVecCplxFloatN,
+ * #CrankVecFloatN and #CrankMatCplxFloatN.
+ *
+ * Forward transform of x with n elements is
+ * X[k] = sum of x[j] exp(-2 pi i j k / n), and inverse transform divides
+ * by n, so that inverse of forward transform is the original vector.
+ *
+ * # Plans
+ *
+ * #CrankFFTPlan holds what is needed to transform vectors of a size, like
+ * factorization of size and twiddle factors. As twiddle factors take most of
+ * time to compute, a plan should be reused for many vectors of same size.
+ *
+ * |[<!-- language="C" -->
+ *   CrankFFTPlan *plan = crank_fft_plan_new (1024);
+ *
+ *   for (i = 0; i < nframes; i++)
+ *     crank_fft_plan_forward (plan, frames + i, spectrums + i);
+ *
+ *   crank_fft_plan_unref (plan);
+ * ]|
+ *
+ * Plans are not modified by transforms, so a plan can be used by many threads
+ * at once. crank_fft_plan_get_cached() gets a shared plan for a size, which is
+ * used by convenience functions like crank_fft_vec_cplx_float_n().
+ *
+ * # Algorithm
+ *
+ * Size is factorized by 4, 2, 3 and other small primes, and each factor is
+ * processed by a stage of Stockham algorithm. Stockham algorithm does not need
+ * bit reversal, and innermost loop of each stage runs on contiguous elements.
+ *
+ * If size has a prime factor larger than %CRANK_FFT_MAX_RADIX, the transform
+ * is done by Bluestein algorithm, which uses transform of power of 2 size.
+ * So every sizes are transformed in O(n log n).
+ *
+ * # Real transform
+ *
+ * Transform of real vector is conjugate symmetric, so only first n / 2 + 1
+ * elements are computed by crank_fft_plan_forward_real(). For even n, real
+ * vector is packed into complex vector of n / 2 elements, and transformed by
+ * half size.
+ *
+ * # Two dimensional transform
+ *
+ * crank_fft2_mat_cplx_float_n() transforms rows and then columns of a matrix.
+ * Rows and columns are processed in parallel, by global setting of
+ * crank_parallel_set_n_threads().
+ */
+
+G_DEFINE_BOXED_TYPE (CrankFFTPlan,
+                     crank_fft_plan,
+                     crank_fft_plan_ref,
+                     crank_fft_plan_unref);
+
+//////// Private Macros ////////////////////////////////////////////////////////
+
+// Maximum count of stages. Sizes have at most 32 prime factors.
+#define CRANK_FFT_MAX_STAGES 32
+
+// Count of columns gathered at once, in two dimensional transform.
+#define CRANK_FFT_COLUMN_BLOCK 8
+
+// Minimum count of elements that a thread processes, in two dimensional
+// transform.
+#define CRANK_FFT_PARALLEL_GRAIN 8192
+
+// Maximum count of plans in cache. Least recently used plan is dropped.
+#define CRANK_FFT_PLAN_CACHE_SIZE 16
+
+//////// Private Type //////////////////////////////////////////////////////////
+
+/*
+ * Additional data for real transform. For even n, half is plan of n / 2, and
+ * tw holds exp(-2 pi i k / n) for k < n / 2.
+ */
+typedef struct _CrankFFTReal {
+  CrankFFTPlan   *half;
+  CrankCplxFloat *tw;
+} CrankFFTReal;
+
+/**
+ * CrankFFTPlan:
+ *
+ * A structure for plan of fast fourier transform.
+ */
+struct _CrankFFTPlan {
+  guint           n;
+
+  guint           nstages;
+  guint           radix[CRANK_FFT_MAX_STAGES];
+  CrankCplxFloat *twiddles;
+
+  CrankFFTPlan   *bluestein;
+  CrankCplxFloat *chirp;
+  CrankCplxFloat *chirp_fft;
+
+  CrankFFTReal   *real;
+
+  guint           _refc;
+};
+
+/*
+ * Arguments for range functions of two dimensional transform.
+ */
+typedef struct _CrankFFT2Args {
+  CrankMatCplxFloatN *r;
+  CrankFFTPlan       *plan;
+  gboolean            inverse;
+} CrankFFT2Args;
+
+//////// Internal Declaration //////////////////////////////////////////////////
+
+static void crank_fft_plan_exec       (CrankFFTPlan   *plan,
+                                       CrankCplxFloat *data,
+                                       const gboolean  inverse);
+
+static void crank_fft_plan_stockham   (CrankFFTPlan   *plan,
+                                       CrankCplxFloat *data,
+                                       CrankCplxFloat *work);
+
+static void crank_fft_plan_chirp_z    (CrankFFTPlan   *plan,
+                                       CrankCplxFloat *data);
+
+static CrankFFTReal *crank_fft_plan_get_real (CrankFFTPlan *plan);
+
+static void crank_fft_stage_2         (const guint           m,
+                                       const guint           s,
+                                       const CrankCplxFloat *tw,
+                                       const CrankCplxFloat *x,
+                                       CrankCplxFloat       *y);
+
+static void crank_fft_stage_3         (const guint           m,
+                                       const guint           s,
+                                       const CrankCplxFloat *tw,
+                                       const CrankCplxFloat *x,
+                                       CrankCplxFloat       *y);
+
+static void crank_fft_stage_4         (const guint           m,
+                                       const guint           s,
+                                       const CrankCplxFloat *tw,
+                                       const CrankCplxFloat *x,
+                                       CrankCplxFloat       *y);
+
+static void crank_fft_stage_p         (const guint           p,
+                                       const guint           m,
+                                       const guint           s,
+                                       const CrankCplxFloat *tw,
+                                       const CrankCplxFloat *wp,
+                                       const CrankCplxFloat *x,
+                                       CrankCplxFloat       *y);
+
+static void crank_fft2_mat_cplx_float_n_rows    (const guint start,
+                                                 const guint end,
+                                                 gpointer    userdata);
+
+static void crank_fft2_mat_cplx_float_n_columns (const guint start,
+                                                 const guint end,
+                                                 gpointer    userdata);
+
+static void crank_fft2_mat_cplx_float_n_exec    (CrankMatCplxFloatN *a,
+                                                 CrankMatCplxFloatN *r,
+                                                 const guint         n_threads,
+                                                 const gboolean      inverse);
+
+static GMutex       crank_fft_plan_cache_mutex;
+static GQueue       crank_fft_plan_cache = G_QUEUE_INIT;
+
+
+//////// Definition ////////////////////////////////////////////////////////////
+
+/**
+ * crank_fft_plan_new:
+ * @n: Size of vectors to transform.
+ *
+ * Constructs a plan for vectors of size @n. Twiddle factors are computed in
+ * double precision, and stored in the plan.
+ *
+ * Time: O(n), or O(n log n) if Bluestein algorithm is used.
+ *
+ * Returns: (transfer full): Newly created plan.
+ */
+CrankFFTPlan*
+crank_fft_plan_new (const guint n)
+{
+  CrankFFTPlan *plan;
+  guint rest;
+  guint p;
+  guint i;
+  gsize ntw;
+
+  g_return_val_if_fail (0 < n, NULL);
+
+  plan = g_new0 (CrankFFTPlan, 1);
+  plan->n = n;
+  plan->_refc = 1;
+
+  // Factorizes size, by 4 first as it takes less operations.
+  rest = n;
+
+  while ((rest % 4) == 0)
+    {
+      plan->radix[plan->nstages++] = 4;
+      rest /= 4;
+    }
+
+  p = 2;
+  while ((1 < rest) && (p <= CRANK_FFT_MAX_RADIX))
+    {
+      if ((rest % p) == 0)
+        {
+          plan->radix[plan->nstages++] = p;
+          rest /= p;
+        }
+      else
+        {
+          p += (p == 2) ? 1 : 2;
+        }
+    }
+
+  // Large prime factor remains. Uses Bluestein algorithm with power of 2.
+  if (1 < rest)
+    {
+      guint m = 1;
+      CrankCplxFloat *b;
+
+      while (m < 2 * n - 1)
+        m <<= 1;
+
+      plan->nstages = 0;
+      plan->bluestein = crank_fft_plan_new (m);
+      plan->chirp = g_new (CrankCplxFloat, n);
+      plan->chirp_fft = g_new0 (CrankCplxFloat, m);
+
+      // chirp[k] = exp (-pi i k^2 / n), with k^2 reduced by 2n.
+      for (i = 0; i < n; i++)
+        {
+          guint64 k2 = ((guint64) i * i) % (2 * (guint64) n);
+          gdouble theta = -G_PI * (gdouble) k2 / n;
+
+          plan->chirp[i].real = (gfloat) cos (theta);
+          plan->chirp[i].imag = (gfloat) sin (theta);
+        }
+
+      // Transform of conjugate chirp, scaled for inverse transform.
+      b = plan->chirp_fft;
+      for (i = 0; i < n; i++)
+        {
+          b[i].real = plan->chirp[i].real / m;
+          b[i].imag = - plan->chirp[i].imag / m;
+
+          if (i != 0)
+            b[m - i] = b[i];
+        }
+
+      crank_fft_plan_exec (plan->bluestein, b, FALSE);
+
+      return plan;
+    }
+
+  // Twiddle factors of each stage, followed by roots of unity of generic
+  // radix.
+  ntw = 0;
+  rest = n;
+  for (i = 0; i < plan->nstages; i++)
+    {
+      p = plan->radix[i];
+      ntw += (gsize)(rest / p) * (p - 1);
+      if (4 < p)
+        ntw += p;
+      rest /= p;
+    }
+
+  plan->twiddles = g_new (CrankCplxFloat, MAX (ntw, 1));
+
+  ntw = 0;
+  rest = n;
+  for (i = 0; i < plan->nstages; i++)
+    {
+      guint m;
+      guint k;
+      guint u;
+
+      p = plan->radix[i];
+      m = rest / p;
+
+      for (k = 0; k < m; k++)
+        {
+          for (u = 1; u < p; u++)
+            {
+              gdouble theta = -2 * G_PI * (gdouble)(k * u) / rest;
+              CrankCplxFloat *w = plan->twiddles + ntw + (k * (p - 1)) + u - 1;
+
+              w->real = (gfloat) cos (theta);
+              w->imag = (gfloat) sin (theta);
+            }
+        }
+
+      ntw += (gsize) m * (p - 1);
+
+      if (4 < p)
+        {
+          for (u = 0; u < p; u++)
+            {
+              gdouble theta = -2 * G_PI * (gdouble) u / p;
+
+              plan->twiddles[ntw + u].real = (gfloat) cos (theta);
+              plan->twiddles[ntw + u].imag = (gfloat) sin (theta);
+            }
+          ntw += p;
+        }
+
+      rest = m;
+    }
+
+  return plan;
+}
+
+/**
+ * crank_fft_plan_ref:
+ * @plan: A plan.
+ *
+ * Increase reference count by 1.
+ *
+ * Returns: (transfer full): A plan with increased reference count.
+ */
+CrankFFTPlan*
+crank_fft_plan_ref (CrankFFTPlan *plan)
+{
+  g_return_val_if_fail (plan != NULL, NULL);
+
+  g_atomic_int_inc (&(plan->_refc));
+  return plan;
+}
+
+/**
+ * crank_fft_plan_unref:
+ * @plan: (transfer full): A plan.
+ *
+ * Decreases reference count by 1. If reference count reaches 0, then plan is
+ * freed.
+ */
+void
+crank_fft_plan_unref (CrankFFTPlan *plan)
+{
+  g_return_if_fail (plan != NULL);
+
+  if (g_atomic_int_dec_and_test (&plan->_refc))
+    {
+      if (plan->real != NULL)
+        {
+          if (plan->real->half != NULL)
+            crank_fft_plan_unref (plan->real->half);
+          g_free (plan->real->tw);
+          g_free (plan->real);
+        }
+
+      if (plan->bluestein != NULL)
+        crank_fft_plan_unref (plan->bluestein);
+
+      g_free (plan->chirp);
+      g_free (plan->chirp_fft);
+      g_free (plan->twiddles);
+      g_free (plan);
+    }
+}
+
+/**
+ * crank_fft_plan_get_cached:
+ * @n: Size of vectors to transform.
+ *
+ * Gets a shared plan for vectors of size @n. A plan is created at first
+ * request of each size. Cache keeps plans of up to 16 recently used sizes, and
+ * drops least recently used one when a new size is requested.
+ *
+ * This is useful when sizes of vectors are few, and they are transformed at
+ * different places.
+ *
+ * As a plan may be dropped from cache by other thread, returned plan has its
+ * own reference.
+ *
+ * Returns: (transfer full): A shared plan. Free with crank_fft_plan_unref().
+ */
+CrankFFTPlan*
+crank_fft_plan_get_cached (const guint n)
+{
+  CrankFFTPlan *plan;
+  GList *link;
+
+  g_return_val_if_fail (0 < n, NULL);
+
+  g_mutex_lock (&crank_fft_plan_cache_mutex);
+
+  for (link = crank_fft_plan_cache.head; link != NULL; link = link->next)
+    {
+      if (((CrankFFTPlan*) link->data)->n == n)
+        break;
+    }
+
+  if (link != NULL)
+    {
+      g_queue_unlink (&crank_fft_plan_cache, link);
+      g_queue_push_head_link (&crank_fft_plan_cache, link);
+      plan = link->data;
+    }
+  else
+    {
+      plan = crank_fft_plan_new (n);
+      g_queue_push_head (&crank_fft_plan_cache, plan);
+
+      if (CRANK_FFT_PLAN_CACHE_SIZE < crank_fft_plan_cache.length)
+        crank_fft_plan_unref (g_queue_pop_tail (&crank_fft_plan_cache));
+    }
+
+  crank_fft_plan_ref (plan);
+
+  g_mutex_unlock (&crank_fft_plan_cache_mutex);
+
+  return plan;
+}
+
+/**
+ * crank_fft_plan_clear_cache:
+ *
+ * Drops all plans in cache of crank_fft_plan_get_cached(). Plans that are
+ * still referenced elsewhere stay alive until they are unreferenced.
+ */
+void
+crank_fft_plan_clear_cache (void)
+{
+  g_mutex_lock (&crank_fft_plan_cache_mutex);
+
+  while (! g_queue_is_empty (&crank_fft_plan_cache))
+    crank_fft_plan_unref (g_queue_pop_head (&crank_fft_plan_cache));
+
+  g_mutex_unlock (&crank_fft_plan_cache_mutex);
+}
+
+/**
+ * crank_fft_plan_get_size:
+ * @plan: A plan.
+ *
+ * Gets size of vectors that @plan transforms.
+ *
+ * Returns: Size of vectors.
+ */
+guint
+crank_fft_plan_get_size (CrankFFTPlan *plan)
+{
+  g_return_val_if_fail (plan != NULL, 0);
+
+  return plan->n;
+}
+
+/**
+ * crank_fft_plan_forward:
+ * @plan: A plan.
+ * @x: A Vector.
+ * @r: (out): A Vector to store transform.
+ *
+ * Gets forward transform of @x.
+ *
+ * Time: O(n log n)
+ */
+void
+crank_fft_plan_forward (CrankFFTPlan       *plan,
+                        CrankVecCplxFloatN *x,
+                        CrankVecCplxFloatN *r)
+{
+  g_return_if_fail (plan != NULL);
+  g_return_if_fail (x != r);
+  g_return_if_fail (x->n == plan->n);
+
+  crank_vec_cplx_float_n_copy (x, r);
+  crank_fft_plan_exec (plan, r->data, FALSE);
+}
+
+/**
+ * crank_fft_plan_inverse:
+ * @plan: A plan.
+ * @x: A Vector.
+ * @r: (out): A Vector to store inverse transform.
+ *
+ * Gets inverse transform of @x, which is divided by n.
+ *
+ * Time: O(n log n)
+ */
+void
+crank_fft_plan_inverse (CrankFFTPlan       *plan,
+                        CrankVecCplxFloatN *x,
+                        CrankVecCplxFloatN *r)
+{
+  g_return_if_fail (plan != NULL);
+  g_return_if_fail (x != r);
+  g_return_if_fail (x->n == plan->n);
+
+  crank_vec_cplx_float_n_copy (x, r);
+  crank_fft_plan_exec (plan, r->data, TRUE);
+}
+
+/**
+ * crank_fft_plan_forward_arr: (skip)
+ * @plan: A plan.
+ * @data: (array): Array of n elements.
+ *
+ * Transforms @data in place. Temporary buffer is taken from scratch arena.
+ *
+ * Time: O(n log n)
+ */
+void
+crank_fft_plan_forward_arr (CrankFFTPlan   *plan,
+                            CrankCplxFloat *data)
+{
+  g_return_if_fail (plan != NULL);
+
+  crank_fft_plan_exec (plan, data, FALSE);
+}
+
+/**
+ * crank_fft_plan_inverse_arr: (skip)
+ * @plan: A plan.
+ * @data: (array): Array of n elements.
+ *
+ * Inverse transforms @data in place, and divides by n.
+ *
+ * Time: O(n log n)
+ */
+void
+crank_fft_plan_inverse_arr (CrankFFTPlan   *plan,
+                            CrankCplxFloat *data)
+{
+  g_return_if_fail (plan != NULL);
+
+  crank_fft_plan_exec (plan, data, TRUE);
+}
+
+/**
+ * crank_fft_plan_forward_real:
+ * @plan: A plan.
+ * @x: A Vector of n real numbers.
+ * @r: (out): A Vector to store first n / 2 + 1 elements of transform.
+ *
+ * Gets forward transform of real vector. Rest of transform is conjugate of
+ * them, as X[n - k] = conj (X[k]).
+ *
+ * Time: O(n log n)
+ */
+void
+crank_fft_plan_forward_real (CrankFFTPlan       *plan,
+                             CrankVecFloatN     *x,
+                             CrankVecCplxFloatN *r)
+{
+  guint i;
+  guint k;
+  guint n = plan->n;
+  guint h = n / 2;
+
+  CrankFFTReal *real;
+  CrankMatArena *scratch;
+  gsize mark;
+  CrankCplxFloat *z;
+
+  g_return_if_fail (plan != NULL);
+  g_return_if_fail (x->n == n);
+
+  real = crank_fft_plan_get_real (plan);
+
+  scratch = crank_mat_arena_get_scratch ();
+  mark = crank_mat_arena_get_mark (scratch);
+
+  crank_vec_cplx_float_n_init_arr_take (r, h + 1,
+                                        g_new (CrankCplxFloat, h + 1));
+
+  if (real->half == NULL)
+    {
+      // Odd size. Transforms as complex vector.
+      z = crank_mat_arena_alloc (scratch, sizeof (CrankCplxFloat) * n);
+
+      for (i = 0; i < n; i++)
+        {
+          z[i].real = x->data[i];
+          z[i].imag = 0;
+        }
+
+      crank_fft_plan_exec (plan, z, FALSE);
+      memcpy (r->data, z, sizeof (CrankCplxFloat) * (h + 1));
+    }
+  else
+    {
+      // z[k] = x[2k] + i x[2k + 1], and transform of z is split into
+      // transforms of even and odd elements.
+      z = crank_mat_arena_alloc (scratch, sizeof (CrankCplxFloat) * h);
+      memcpy (z, x->data, sizeof (gfloat) * n);
+
+      crank_fft_plan_exec (real->half, z, FALSE);
+
+      for (k = 0; k <= h; k++)
+        {
+          CrankCplxFloat zk = z[k % h];
+          CrankCplxFloat zh = z[(h - k) % h];
+          CrankCplxFloat w;
+          gfloat er = (zk.real + zh.real) * 0.5f;
+          gfloat ei = (zk.imag - zh.imag) * 0.5f;
+          gfloat or = (zk.imag + zh.imag) * 0.5f;
+          gfloat oi = (zh.real - zk.real) * 0.5f;
+
+          if (k < h)
+            w = real->tw[k];
+          else
+            w = (CrankCplxFloat){-1, 0};
+
+          r->data[k].real = er + (w.real * or - w.imag * oi);
+          r->data[k].imag = ei + (w.real * oi + w.imag * or);
+        }
+    }
+
+  crank_mat_arena_rewind (scratch, mark);
+}
+
+/**
+ * crank_fft_plan_inverse_real:
+ * @plan: A plan.
+ * @x: A Vector of first n / 2 + 1 elements of transform.
+ * @r: (out): A Vector to store n real numbers.
+ *
+ * Gets inverse transform, which is real, from first half of transform. This is
+ * inverse of crank_fft_plan_forward_real().
+ *
+ * Time: O(n log n)
+ */
+void
+crank_fft_plan_inverse_real (CrankFFTPlan       *plan,
+                             CrankVecCplxFloatN *x,
+                             CrankVecFloatN     *r)
+{
+  guint i;
+  guint k;
+  guint n = plan->n;
+  guint h = n / 2;
+
+  CrankFFTReal *real;
+  CrankMatArena *scratch;
+  gsize mark;
+  CrankCplxFloat *z;
+
+  g_return_if_fail (plan != NULL);
+  g_return_if_fail (x->n == h + 1);
+
+  real = crank_fft_plan_get_real (plan);
+
+  scratch = crank_mat_arena_get_scratch ();
+  mark = crank_mat_arena_get_mark (scratch);
+
+  CRANK_VEC_ALLOC_ALIGNED (r, gfloat, n);
+
+  if (real->half == NULL)
+    {
+      // Odd size. Restores conjugate half, and transforms as complex vector.
+      z = crank_mat_arena_alloc (scratch, sizeof (CrankCplxFloat) * n);
+
+      for (i = 0; i <= h; i++)
+        z[i] = x->data[i];
+
+      for (i = h + 1; i < n; i++)
+        {
+          z[i].real = x->data[n - i].real;
+          z[i].imag = - x->data[n - i].imag;
+        }
+
+      crank_fft_plan_exec (plan, z, TRUE);
+
+      for (i = 0; i < n; i++)
+        r->data[i] = z[i].real;
+    }
+  else
+    {
+      // Restores transforms of even and odd elements, as z = e + i o.
+      z = crank_mat_arena_alloc (scratch, sizeof (CrankCplxFloat) * h);
+
+      for (k = 0; k < h; k++)
+        {
+          CrankCplxFloat xk = x->data[k];
+          CrankCplxFloat xh = x->data[h - k];
+          CrankCplxFloat w = real->tw[k];
+          gfloat er = (xk.real + xh.real) * 0.5f;
+          gfloat ei = (xk.imag - xh.imag) * 0.5f;
+          gfloat dr = (xk.real - xh.real) * 0.5f;
+          gfloat di = (xk.imag + xh.imag) * 0.5f;
+
+          // o = d conj (w)
+          gfloat or = dr * w.real + di * w.imag;
+          gfloat oi = di * w.real - dr * w.imag;
+
+          z[k].real = er - oi;
+          z[k].imag = ei + or;
+        }
+
+      crank_fft_plan_exec (real->half, z, TRUE);
+      memcpy (r->data, z, sizeof (gfloat) * n);
+    }
+
+  crank_mat_arena_rewind (scratch, mark);
+}
+
+/**
+ * crank_fft_vec_cplx_float_n:
+ * @a: A Vector.
+ * @r: (out): A Vector to store transform.
+ *
+ * Gets forward transform of @a, with shared plan from
+ * crank_fft_plan_get_cached().
+ *
+ * Time: O(n log n)
+ */
+void
+crank_fft_vec_cplx_float_n (CrankVecCplxFloatN *a,
+                            CrankVecCplxFloatN *r)
+{
+  CrankFFTPlan *plan;
+
+  if (a->n == 0)
+    {
+      crank_vec_cplx_float_n_init_arr_take (r, 0, NULL);
+      return;
+    }
+
+  plan = crank_fft_plan_get_cached (a->n);
+
+  crank_fft_plan_forward (plan, a, r);
+
+  crank_fft_plan_unref (plan);
+}
+
+/**
+ * crank_ifft_vec_cplx_float_n:
+ * @a: A Vector.
+ * @r: (out): A Vector to store inverse transform.
+ *
+ * Gets inverse transform of @a, with shared plan from
+ * crank_fft_plan_get_cached().
+ *
+ * Time: O(n log n)
+ */
+void
+crank_ifft_vec_cplx_float_n (CrankVecCplxFloatN *a,
+                             CrankVecCplxFloatN *r)
+{
+  CrankFFTPlan *plan;
+
+  if (a->n == 0)
+    {
+      crank_vec_cplx_float_n_init_arr_take (r, 0, NULL);
+      return;
+    }
+
+  plan = crank_fft_plan_get_cached (a->n);
+
+  crank_fft_plan_inverse (plan, a, r);
+
+  crank_fft_plan_unref (plan);
+}
+
+/**
+ * crank_rfft_vec_float_n:
+ * @a: A Vector.
+ * @r: (out): A Vector to store first n / 2 + 1 elements of transform.
+ *
+ * Gets forward transform of real vector, with shared plan from
+ * crank_fft_plan_get_cached().
+ *
+ * Time: O(n log n)
+ */
+void
+crank_rfft_vec_float_n (CrankVecFloatN     *a,
+                        CrankVecCplxFloatN *r)
+{
+  CrankFFTPlan *plan;
+
+  if (a->n == 0)
+    {
+      crank_vec_cplx_float_n_init_arr_take (r, 0, NULL);
+      return;
+    }
+
+  plan = crank_fft_plan_get_cached (a->n);
+
+  crank_fft_plan_forward_real (plan, a, r);
+
+  crank_fft_plan_unref (plan);
+}
+
+/**
+ * crank_irfft_vec_cplx_float_n:
+ * @a: A Vector of first n / 2 + 1 elements of transform.
+ * @n: Size of real vector.
+ * @r: (out): A Vector to store real vector.
+ *
+ * Gets inverse transform to real vector, with shared plan from
+ * crank_fft_plan_get_cached(). As both of n = 2m and n = 2m + 1 have m + 1
+ * elements in first half, size should be given.
+ *
+ * Time: O(n log n)
+ */
+void
+crank_irfft_vec_cplx_float_n (CrankVecCplxFloatN *a,
+                              const guint         n,
+                              CrankVecFloatN     *r)
+{
+  CrankFFTPlan *plan;
+
+  if (n == 0)
+    {
+      crank_vec_float_n_init_arr_take (r, 0, NULL);
+      return;
+    }
+
+  plan = crank_fft_plan_get_cached (n);
+
+  crank_fft_plan_inverse_real (plan, a, r);
+
+  crank_fft_plan_unref (plan);
+}
+
+/**
+ * crank_fft2_mat_cplx_float_n:
+ * @a: A Matrix.
+ * @r: (out): A Matrix to store transform.
+ *
+ * Gets two dimensional forward transform of @a.
+ *
+ * This runs on threads by global setting. See crank_parallel_set_n_threads().
+ *
+ * Time: O(rn cn log (rn cn))
+ */
+void
+crank_fft2_mat_cplx_float_n (CrankMatCplxFloatN *a,
+                             CrankMatCplxFloatN *r)
+{
+  crank_fft2_mat_cplx_float_n_exec (a, r, crank_parallel_get_n_threads (),
+                                    FALSE);
+}
+
+/**
+ * crank_ifft2_mat_cplx_float_n:
+ * @a: A Matrix.
+ * @r: (out): A Matrix to store inverse transform.
+ *
+ * Gets two dimensional inverse transform of @a, which is divided by number of
+ * elements.
+ *
+ * This runs on threads by global setting. See crank_parallel_set_n_threads().
+ *
+ * Time: O(rn cn log (rn cn))
+ */
+void
+crank_ifft2_mat_cplx_float_n (CrankMatCplxFloatN *a,
+                              CrankMatCplxFloatN *r)
+{
+  crank_fft2_mat_cplx_float_n_exec (a, r, crank_parallel_get_n_threads (),
+                                    TRUE);
+}
+
+/**
+ * crank_fft2_mat_cplx_float_n_parallel:
+ * @a: A Matrix.
+ * @r: (out): A Matrix to store transform.
+ * @n_threads: Number of threads, or 0 for number of processors.
+ *
+ * Gets two dimensional forward transform of @a, with given number of threads.
+ * Rows are transformed in parallel, and then columns.
+ */
+void
+crank_fft2_mat_cplx_float_n_parallel (CrankMatCplxFloatN *a,
+                                      CrankMatCplxFloatN *r,
+                                      const guint         n_threads)
+{
+  crank_fft2_mat_cplx_float_n_exec (a, r, n_threads, FALSE);
+}
+
+/**
+ * crank_ifft2_mat_cplx_float_n_parallel:
+ * @a: A Matrix.
+ * @r: (out): A Matrix to store inverse transform.
+ * @n_threads: Number of threads, or 0 for number of processors.
+ *
+ * Gets two dimensional inverse transform of @a, with given number of threads.
+ */
+void
+crank_ifft2_mat_cplx_float_n_parallel (CrankMatCplxFloatN *a,
+                                       CrankMatCplxFloatN *r,
+                                       const guint         n_threads)
+{
+  crank_fft2_mat_cplx_float_n_exec (a, r, n_threads, TRUE);
+}
+
+
+//////// Private Functions /////////////////////////////////////////////////////
+
+/*
+ * Transforms data in place. Inverse transform is done by conjugating before
+ * and after forward transform, and divided by n.
+ */
+static void
+crank_fft_plan_exec (CrankFFTPlan   *plan,
+                     CrankCplxFloat *data,
+                     const gboolean  inverse)
+{
+  guint i;
+  guint n = plan->n;
+
+  if (inverse)
+    for (i = 0; i < n; i++)
+      data[i].imag = - data[i].imag;
+
+  if (plan->bluestein != NULL)
+    {
+      crank_fft_plan_chirp_z (plan, data);
+    }
+  else if (1 < n)
+    {
+      CrankMatArena *scratch = crank_mat_arena_get_scratch ();
+      gsize mark = crank_mat_arena_get_mark (scratch);
+      CrankCplxFloat *work;
+
+      work = crank_mat_arena_alloc (scratch, sizeof (CrankCplxFloat) * n);
+      crank_fft_plan_stockham (plan, data, work);
+
+      crank_mat_arena_rewind (scratch, mark);
+    }
+
+  if (inverse)
+    {
+      gfloat scale = 1.0f / n;
+
+      for (i = 0; i < n; i++)
+        {
+          data[i].real = data[i].real * scale;
+          data[i].imag = - data[i].imag * scale;
+        }
+    }
+}
+
+/*
+ * Runs stages of Stockham algorithm. Each stage reads one of data and work and
+ * writes to other. Result is copied to data, if it ends in work.
+ */
+static void
+crank_fft_plan_stockham (CrankFFTPlan   *plan,
+                         CrankCplxFloat *data,
+                         CrankCplxFloat *work)
+{
+  guint i;
+  guint s = 1;
+  guint rest = plan->n;
+  CrankCplxFloat *tw = plan->twiddles;
+  CrankCplxFloat *x = data;
+  CrankCplxFloat *y = work;
+
+  for (i = 0; i < plan->nstages; i++)
+    {
+      guint p = plan->radix[i];
+      guint m = rest / p;
+      CrankCplxFloat *temp;
+
+      switch (p)
+        {
+        case 2:
+          crank_fft_stage_2 (m, s, tw, x, y);
+          break;
+        case 3:
+          crank_fft_stage_3 (m, s, tw, x, y);
+          break;
+        case 4:
+          crank_fft_stage_4 (m, s, tw, x, y);
+          break;
+        default:
+          crank_fft_stage_p (p, m, s, tw, tw + ((gsize) m * (p - 1)), x, y);
+          tw += p;
+        }
+
+      tw += (gsize) m * (p - 1);
+
+      temp = x;
+      x = y;
+      y = temp;
+
+      rest = m;
+      s *= p;
+    }
+
+  if (x != data)
+    memcpy (data, x, sizeof (CrankCplxFloat) * plan->n);
+}
+
+/*
+ * Transforms by Bluestein algorithm, as convolution of chirp-multiplied data
+ * and conjugate chirp, by transforms of power of 2 size.
+ */
+static void
+crank_fft_plan_chirp_z (CrankFFTPlan   *plan,
+                        CrankCplxFloat *data)
+{
+  guint i;
+  guint n = plan->n;
+  guint m = plan->bluestein->n;
+
+  CrankMatArena *scratch = crank_mat_arena_get_scratch ();
+  gsize mark = crank_mat_arena_get_mark (scratch);
+  CrankCplxFloat *a;
+
+  a = crank_mat_arena_alloc0 (scratch, sizeof (CrankCplxFloat) * m);
+
+  for (i = 0; i < n; i++)
+    {
+      CrankCplxFloat c = plan->chirp[i];
+      CrankCplxFloat d = data[i];
+
+      a[i].real = d.real * c.real - d.imag * c.imag;
+      a[i].imag = d.real * c.imag + d.imag * c.real;
+    }
+
+  crank_fft_plan_exec (plan->bluestein, a, FALSE);
+
+  // Multiplies by transform of conjugate chirp, and transforms back without
+  // scaling, as the chirp transform is already scaled.
+  for (i = 0; i < m; i++)
+    {
+      CrankCplxFloat b = plan->chirp_fft[i];
+      CrankCplxFloat v = a[i];
+
+      a[i].real = v.real * b.real - v.imag * b.imag;
+      a[i].imag = - (v.real * b.imag + v.imag * b.real);
+    }
+
+  crank_fft_plan_exec (plan->bluestein, a, FALSE);
+
+  for (i = 0; i < n; i++)
+    {
+      CrankCplxFloat c = plan->chirp[i];
+      gfloat vr = a[i].real;
+      gfloat vi = - a[i].imag;
+
+      data[i].real = vr * c.real - vi * c.imag;
+      data[i].imag = vr * c.imag + vi * c.real;
+    }
+
+  crank_mat_arena_rewind (scratch, mark);
+}
+
+/*
+ * Gets data for real transform, creating it at first call.
+ */
+static CrankFFTReal*
+crank_fft_plan_get_real (CrankFFTPlan *plan)
+{
+  CrankFFTReal *real = g_atomic_pointer_get (&plan->real);
+
+  if (G_UNLIKELY (real == NULL))
+    {
+      guint k;
+      guint h = plan->n / 2;
+
+      real = g_new0 (CrankFFTReal, 1);
+
+      if ((plan->n % 2) == 0)
+        {
+          real->half = crank_fft_plan_new (h);
+          real->tw = g_new (CrankCplxFloat, h);
+
+          for (k = 0; k < h; k++)
+            {
+              gdouble theta = -2 * G_PI * (gdouble) k / plan->n;
+
+              real->tw[k].real = (gfloat) cos (theta);
+              real->tw[k].imag = (gfloat) sin (theta);
+            }
+        }
+
+      // Other thread may have set it first.
+      if (! g_atomic_pointer_compare_and_exchange (&plan->real, NULL, real))
+        {
+          if (real->half != NULL)
+            crank_fft_plan_unref (real->half);
+          g_free (real->tw);
+          g_free (real);
+
+          real = g_atomic_pointer_get (&plan->real);
+        }
+    }
+
+  return real;
+}
+
+/*
+ * Stages of Stockham algorithm. Current subsequence length is p m, and stride
+ * is s. For each k < m and q < s, p inputs x[q + s (k + t m)] are transformed
+ * and multiplied by twiddles, into y[q + s (p k + u)].
+ */
+static void
+crank_fft_stage_2 (const guint           m,
+                   const guint           s,
+                   const CrankCplxFloat *tw,
+                   const CrankCplxFloat *x,
+                   CrankCplxFloat       *y)
+{
+  guint k;
+  guint q;
+
+  for (k = 0; k < m; k++)
+    {
+      CrankCplxFloat w = tw[k];
+      const CrankCplxFloat *x0 = x + ((gsize) s * k);
+      const CrankCplxFloat *x1 = x + ((gsize) s * (k + m));
+      CrankCplxFloat *y0 = y + ((gsize) s * (2 * k));
+      CrankCplxFloat *y1 = y0 + s;
+
+      for (q = 0; q < s; q++)
+        {
+          gfloat dr = x0[q].real - x1[q].real;
+          gfloat di = x0[q].imag - x1[q].imag;
+
+          y0[q].real = x0[q].real + x1[q].real;
+          y0[q].imag = x0[q].imag + x1[q].imag;
+          y1[q].real = dr * w.real - di * w.imag;
+          y1[q].imag = dr * w.imag + di * w.real;
+        }
+    }
+}
+
+static void
+crank_fft_stage_3 (const guint           m,
+                   const guint           s,
+                   const CrankCplxFloat *tw,
+                   const CrankCplxFloat *x,
+                   CrankCplxFloat       *y)
+{
+  guint k;
+  guint q;
+
+  // sin (2 pi / 3)
+  const gfloat sn = 0.86602540378443864676f;
+
+  for (k = 0; k < m; k++)
+    {
+      CrankCplxFloat w1 = tw[2 * k];
+      CrankCplxFloat w2 = tw[2 * k + 1];
+      const CrankCplxFloat *x0 = x + ((gsize) s * k);
+      const CrankCplxFloat *x1 = x + ((gsize) s * (k + m));
+      const CrankCplxFloat *x2 = x + ((gsize) s * (k + 2 * m));
+      CrankCplxFloat *y0 = y + ((gsize) s * (3 * k));
+      CrankCplxFloat *y1 = y0 + s;
+      CrankCplxFloat *y2 = y1 + s;
+
+      for (q = 0; q < s; q++)
+        {
+          gfloat tr = x1[q].real + x2[q].real;
+          gfloat ti = x1[q].imag + x2[q].imag;
+          gfloat dr = sn * (x1[q].real - x2[q].real);
+          gfloat di = sn * (x1[q].imag - x2[q].imag);
+          gfloat hr = x0[q].real - 0.5f * tr;
+          gfloat hi = x0[q].imag - 0.5f * ti;
+
+          // a0 + a1 w + a2 w^2, where w = -1/2 - i sn.
+          gfloat v1r = hr + di;
+          gfloat v1i = hi - dr;
+          gfloat v2r = hr - di;
+          gfloat v2i = hi + dr;
+
+          y0[q].real = x0[q].real + tr;
+          y0[q].imag = x0[q].imag + ti;
+          y1[q].real = v1r * w1.real - v1i * w1.imag;
+          y1[q].imag = v1r * w1.imag + v1i * w1.real;
+          y2[q].real = v2r * w2.real - v2i * w2.imag;
+          y2[q].imag = v2r * w2.imag + v2i * w2.real;
+        }
+    }
+}
+
+static void
+crank_fft_stage_4 (const guint           m,
+                   const guint           s,
+                   const CrankCplxFloat *tw,
+                   const CrankCplxFloat *x,
+                   CrankCplxFloat       *y)
+{
+  guint k;
+  guint q;
+
+  for (k = 0; k < m; k++)
+    {
+      CrankCplxFloat w1 = tw[3 * k];
+      CrankCplxFloat w2 = tw[3 * k + 1];
+      CrankCplxFloat w3 = tw[3 * k + 2];
+      const CrankCplxFloat *x0 = x + ((gsize) s * k);
+      const CrankCplxFloat *x1 = x + ((gsize) s * (k + m));
+      const CrankCplxFloat *x2 = x + ((gsize) s * (k + 2 * m));
+      const CrankCplxFloat *x3 = x + ((gsize) s * (k + 3 * m));
+      CrankCplxFloat *y0 = y + ((gsize) s * (4 * k));
+      CrankCplxFloat *y1 = y0 + s;
+      CrankCplxFloat *y2 = y1 + s;
+      CrankCplxFloat *y3 = y2 + s;
+
+      for (q = 0; q < s; q++)
+        {
+          gfloat t0r = x0[q].real + x2[q].real;
+          gfloat t0i = x0[q].imag + x2[q].imag;
+          gfloat t1r = x0[q].real - x2[q].real;
+          gfloat t1i = x0[q].imag - x2[q].imag;
+          gfloat t2r = x1[q].real + x3[q].real;
+          gfloat t2i = x1[q].imag + x3[q].imag;
+
+          // -i (a1 - a3)
+          gfloat t3r = x1[q].imag - x3[q].imag;
+          gfloat t3i = x3[q].real - x1[q].real;
+
+          gfloat v1r = t1r + t3r;
+          gfloat v1i = t1i + t3i;
+          gfloat v2r = t0r - t2r;
+          gfloat v2i = t0i - t2i;
+          gfloat v3r = t1r - t3r;
+          gfloat v3i = t1i - t3i;
+
+          y0[q].real = t0r + t2r;
+          y0[q].imag = t0i + t2i;
+          y1[q].real = v1r * w1.real - v1i * w1.imag;
+          y1[q].imag = v1r * w1.imag + v1i * w1.real;
+          y2[q].real = v2r * w2.real - v2i * w2.imag;
+          y2[q].imag = v2r * w2.imag + v2i * w2.real;
+          y3[q].real = v3r * w3.real - v3i * w3.imag;
+          y3[q].imag = v3r * w3.imag + v3i * w3.real;
+        }
+    }
+}
+
+/*
+ * Stage of generic radix p, with roots of unity wp. It takes O(p) for each
+ * element. Outputs are accumulated over inputs, so that innermost loop runs
+ * on contiguous elements.
+ */
+static void
+crank_fft_stage_p (const guint           p,
+                   const guint           m,
+                   const guint           s,
+                   const CrankCplxFloat *tw,
+                   const CrankCplxFloat *wp,
+                   const CrankCplxFloat *x,
+                   CrankCplxFloat       *y)
+{
+  guint k;
+  guint q;
+  guint t;
+  guint u;
+
+  for (k = 0; k < m; k++)
+    {
+      for (u = 0; u < p; u++)
+        {
+          CrankCplxFloat *yu = y + (gsize) s * (p * k + u);
+          guint tu = 0;
+
+          memcpy (yu, x + (gsize) s * k, sizeof (CrankCplxFloat) * s);
+
+          for (t = 1; t < p; t++)
+            {
+              const CrankCplxFloat *xt = x + (gsize) s * (k + t * m);
+              CrankCplxFloat w;
+
+              tu += u;
+              if (p <= tu)
+                tu -= p;
+
+              w = wp[tu];
+
+              for (q = 0; q < s; q++)
+                {
+                  yu[q].real += xt[q].real * w.real - xt[q].imag * w.imag;
+                  yu[q].imag += xt[q].real * w.imag + xt[q].imag * w.real;
+                }
+            }
+
+          if (u != 0)
+            {
+              CrankCplxFloat w = tw[k * (p - 1) + u - 1];
+
+              for (q = 0; q < s; q++)
+                {
+                  gfloat vr = yu[q].real;
+                  gfloat vi = yu[q].imag;
+
+                  yu[q].real = vr * w.real - vi * w.imag;
+                  yu[q].imag = vr * w.imag + vi * w.real;
+                }
+            }
+        }
+    }
+}
+
+/*
+ * Transforms rows of a matrix in place.
+ */
+static void
+crank_fft2_mat_cplx_float_n_rows (const guint start,
+                                  const guint end,
+                                  gpointer    userdata)
+{
+  CrankFFT2Args *args = (CrankFFT2Args*) userdata;
+  CrankMatCplxFloatN *r = args->r;
+  guint i;
+
+  for (i = start; i < end; i++)
+    crank_fft_plan_exec (args->plan, r->data + ((gsize) i * r->cn),
+                         args->inverse);
+}
+
+/*
+ * Transforms columns of a matrix in place. Blocks of columns are gathered into
+ * contiguous buffer from scratch arena of each thread.
+ */
+static void
+crank_fft2_mat_cplx_float_n_columns (const guint start,
+                                     const guint end,
+                                     gpointer    userdata)
+{
+  CrankFFT2Args *args = (CrankFFT2Args*) userdata;
+  CrankMatCplxFloatN *r = args->r;
+  guint rn = r->rn;
+  guint cn = r->cn;
+  guint i;
+  guint j;
+  guint jb;
+
+  CrankMatArena *scratch = crank_mat_arena_get_scratch ();
+  gsize mark = crank_mat_arena_get_mark (scratch);
+  CrankCplxFloat *buf;
+
+  buf = crank_mat_arena_alloc (scratch,
+                               sizeof (CrankCplxFloat) * rn *
+                               CRANK_FFT_COLUMN_BLOCK);
+
+  for (jb = start; jb < end; jb += CRANK_FFT_COLUMN_BLOCK)
+    {
+      guint je = MIN (jb + CRANK_FFT_COLUMN_BLOCK, end);
+
+      for (i = 0; i < rn; i++)
+        for (j = jb; j < je; j++)
+          buf[(gsize)(j - jb) * rn + i] = r->data[(gsize) i * cn + j];
+
+      for (j = jb; j < je; j++)
+        crank_fft_plan_exec (args->plan, buf + (gsize)(j - jb) * rn,
+                             args->inverse);
+
+      for (i = 0; i < rn; i++)
+        for (j = jb; j < je; j++)
+          r->data[(gsize) i * cn + j] = buf[(gsize)(j - jb) * rn + i];
+    }
+
+  crank_mat_arena_rewind (scratch, mark);
+}
+
+static void
+crank_fft2_mat_cplx_float_n_exec (CrankMatCplxFloatN *a,
+                                  CrankMatCplxFloatN *r,
+                                  const guint         n_threads,
+                                  const gboolean      inverse)
+{
+  CrankFFT2Args args;
+
+  g_return_if_fail (a != r);
+
+  crank_mat_cplx_float_n_copy (a, r);
+
+  if ((r->rn == 0) || (r->cn == 0))
+    return;
+
+  args.r = r;
+  args.inverse = inverse;
+
+  args.plan = crank_fft_plan_get_cached (r->cn);
+  crank_parallel_for (n_threads, 0, r->rn,
+                      MAX (1, CRANK_FFT_PARALLEL_GRAIN / r->cn),
+                      crank_fft2_mat_cplx_float_n_rows, &args);
+  crank_fft_plan_unref (args.plan);
+
+  args.plan = crank_fft_plan_get_cached (r->rn);
+  crank_parallel_for (n_threads, 0, r->cn,
+                      MAX (CRANK_FFT_COLUMN_BLOCK,
+                           CRANK_FFT_PARALLEL_GRAIN / r->rn),
+                      crank_fft2_mat_cplx_float_n_columns, &args);
+  crank_fft_plan_unref (args.plan);
+}
@@ -0,0 +1,127 @@
+#ifndef CRANKFFT_H
+#define CRANKFFT_H
+
+/* Copyright (C) 2015, WSID   */
+
+/* Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef _CRANKBASE_INSIDE
+#error crankfft.h cannot be included directly.
+#endif
+
+#include <glib.h>
+#include <glib-object.h>
+
+#include "crankvecfloat.h"
+#include "crankveccplxfloat.h"
+#include "crankmatcplxfloat.h"
+
+G_BEGIN_DECLS
+
+//////// Type Definition ///////////////////////////////////////////////////////
+
+#define CRANK_TYPE_FFT_PLAN (crank_fft_plan_get_type ())
+GType crank_fft_plan_get_type (void);
+
+typedef struct _CrankFFTPlan CrankFFTPlan;
+
+/**
+ * CRANK_FFT_MAX_RADIX:
+ *
+ * Largest prime factor that is processed by a stage. Sizes with larger prime
+ * factor are transformed by Bluestein algorithm.
+ */
+#define CRANK_FFT_MAX_RADIX 31
+
+
+//////// Life cycle ////////////////////////////////////////////////////////////
+
+CrankFFTPlan   *crank_fft_plan_new            (const guint n);
+
+CrankFFTPlan   *crank_fft_plan_ref            (CrankFFTPlan *plan);
+
+void            crank_fft_plan_unref          (CrankFFTPlan *plan);
+
+CrankFFTPlan   *crank_fft_plan_get_cached     (const guint n);
+
+void            crank_fft_plan_clear_cache    (void);
+
+guint           crank_fft_plan_get_size       (CrankFFTPlan *plan);
+
+
+//////// Transforms ////////////////////////////////////////////////////////////
+
+void            crank_fft_plan_forward        (CrankFFTPlan       *plan,
+                                               CrankVecCplxFloatN *x,
+                                               CrankVecCplxFloatN *r);
+
+void            crank_fft_plan_inverse        (CrankFFTPlan       *plan,
+                                               CrankVecCplxFloatN *x,
+                                               CrankVecCplxFloatN *r);
+
+void            crank_fft_plan_forward_arr    (CrankFFTPlan   *plan,
+                                               CrankCplxFloat *data);
+
+void            crank_fft_plan_inverse_arr    (CrankFFTPlan   *plan,
+                                               CrankCplxFloat *data);
+
+void            crank_fft_plan_forward_real   (CrankFFTPlan       *plan,
+                                               CrankVecFloatN     *x,
+                                               CrankVecCplxFloatN *r);
+
+void            crank_fft_plan_inverse_real   (CrankFFTPlan       *plan,
+                                               CrankVecCplxFloatN *x,
+                                               CrankVecFloatN     *r);
+
+
+//////// Convenience ///////////////////////////////////////////////////////////
+
+void            crank_fft_vec_cplx_float_n    (CrankVecCplxFloatN *a,
+                                               CrankVecCplxFloatN *r);
+
+void            crank_ifft_vec_cplx_float_n   (CrankVecCplxFloatN *a,
+                                               CrankVecCplxFloatN *r);
+
+void            crank_rfft_vec_float_n        (CrankVecFloatN     *a,
+                                               CrankVecCplxFloatN *r);
+
+void            crank_irfft_vec_cplx_float_n  (CrankVecCplxFloatN *a,
+                                               const guint         n,
+                                               CrankVecFloatN     *r);
+
+void            crank_fft2_mat_cplx_float_n   (CrankMatCplxFloatN *a,
+                                               CrankMatCplxFloatN *r);
+
+void            crank_ifft2_mat_cplx_float_n  (CrankMatCplxFloatN *a,
+                                               CrankMatCplxFloatN *r);
+
+void            crank_fft2_mat_cplx_float_n_parallel (
+  CrankMatCplxFloatN *a,
+  CrankMatCplxFloatN *r,
+  const guint         n_threads);
+
+void            crank_ifft2_mat_cplx_float_n_parallel (
+  CrankMatCplxFloatN *a,
+  CrankMatCplxFloatN *r,
+  const guint         n_threads);
+
+G_END_DECLS
+
+#endif
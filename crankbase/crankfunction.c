@@ -227,6 +227,26 @@ crank_float_nan_equal_delta (gconstpointer a,
   return isnanf (av) ? isnanf (bv) : ((bv - d < av) && (av < bv + d));
 }
 
+/**
+ * crank_double_nan_equal_delta:
+ * @a: A Pointer pointing a double value.
+ * @b: A Pointer pointing a double value.
+ * @d: A delta value.
+ *
+ * Checks *@a and *@b are sufficiently equal, treating two NaN as same.
+ *
+ * Returns: Whether @a and @b are sufficiently equal.
+ */
+gboolean
+crank_double_nan_equal_delta (gconstpointer a,
+                              gconstpointer b,
+                              const gfloat  d)
+{
+  gdouble av = *(gdouble*)a;
+  gdouble bv = *(gdouble*)b;
+  return isnan (av) ? isnan (bv) : ((bv - d < av) && (av < bv + d));
+}
+
 
 
 /**
@@ -356,6 +376,23 @@ crank_float_to_string (gpointer value,
   return g_strdup_printf (format, *(gfloat*)value);
 }
 
+/**
+ * crank_double_to_string:
+ * @value: A pointer pointing a double value.
+ * @userdata: (nullable): Format for stringification.
+ *
+ * Stringify a double value.
+ *
+ * Returns: string represents of double. free with g_free()
+ */
+gchar*
+crank_double_to_string (gpointer value,
+                        gpointer userdata)
+{
+  gchar *format = (userdata != NULL) ? (gchar*)userdata : "%g";
+  return g_strdup_printf (format, *(gdouble*)value);
+}
+
 /**
  * crank_pointer_to_string:
  * @value: A pointer.
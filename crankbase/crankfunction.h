@@ -123,6 +123,22 @@ typedef gboolean (*CrankBoolFloatFunc) (const gfloat value,
                                         gpointer     userdata);
 
 
+/**
+ * CrankBoolDoubleFunc:
+ * @value: Value for function.
+ * @userdata: (closure): A userdata for callback.
+ *
+ * This function receives #gdouble and returns #gboolean.
+ *
+ * This is mainly used for iteration functions and the return value is checked
+ * to determine whether to keep iteration.
+ *
+ * Returns: A boolean value.
+ */
+typedef gboolean (*CrankBoolDoubleFunc) (const gdouble value,
+                                         gpointer      userdata);
+
+
 /**
  * CrankBoolCplxFloatFunc:
  * @value: Value for function.
@@ -230,6 +246,10 @@ gboolean crank_float_nan_equal_delta(gconstpointer a,
                                     gconstpointer b,
                                     const gfloat  d);
 
+gboolean crank_double_nan_equal_delta(gconstpointer a,
+                                     gconstpointer b,
+                                     const gfloat  d);
+
 
 
 gint     crank_uint_compare        (gconstpointer a,
@@ -254,6 +274,9 @@ gchar   *crank_uint_to_string      (gpointer value,
 gchar   *crank_float_to_string     (gpointer value,
                                     gpointer userdata);
 
+gchar   *crank_double_to_string    (gpointer value,
+                                    gpointer userdata);
+
 gchar   *crank_pointer_to_string   (gpointer value,
                                     gpointer userdata);
 
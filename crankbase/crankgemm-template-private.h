@@ -0,0 +1,501 @@
+/* Copyright (C) 2015, WSID   */
+
+/* Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/* This is template for blocked matrix multiplication, and is included by
+ * crankgemm.c once for each precision. */
+
+#ifndef _CRANKBASE_INSIDE
+#error crankgemm-template-private.h cannot be included directly.
+#endif
+
+#ifndef CRANK_GEMM_T
+#error CRANK_GEMM_T should be defined before including template.
+#endif
+
+#ifndef __GTK_DOC_IGNORE__
+
+/*
+ * Parameters of template.
+ *
+ * CRANK_GEMM_T: Element type. (gfloat, gdouble)
+ * CRANK_GEMM_FUNC: Name of entry function.
+ * CRANK_GEMM_PREFIX(name): Makes private name with type prefix.
+ * CRANK_GEMM_KERNEL, CRANK_GEMM_KERNEL_FUNC: Names of private types.
+ * CRANK_GEMM_INTRIN(f): Appends type suffix to intrinsic. (_ps, _pd)
+ * CRANK_GEMM_BROADCAST: Broadcasting load of an element into 256 bits.
+ * CRANK_GEMM_W: Number of elements in 128 bits.
+ * CRANK_GEMM_M128, CRANK_GEMM_M256: Vector types.
+ */
+
+#define T       CRANK_GEMM_T
+#define F(name) CRANK_GEMM_PREFIX(name)
+#define I(f)    CRANK_GEMM_INTRIN(f)
+
+//////// Private Type //////////////////////////////////////////////////////////
+
+typedef void (*CRANK_GEMM_KERNEL_FUNC) (const guint  kc,
+                                        const T     *ap,
+                                        const T     *bp,
+                                        T           *c,
+                                        const guint  ldc);
+
+typedef struct {
+  guint                  mr;
+  guint                  nr;
+  CRANK_GEMM_KERNEL_FUNC func;
+} CRANK_GEMM_KERNEL;
+
+
+//////// Micro kernels /////////////////////////////////////////////////////////
+
+static void
+F(kernel_generic) (const guint  kc,
+                   const T     *ap,
+                   const T     *bp,
+                   T           *c,
+                   const guint  ldc)
+{
+  T t[4][4] = {{0}};
+  guint p;
+  guint i;
+  guint j;
+
+  for (p = 0; p < kc; p++)
+    {
+      for (i = 0; i < 4; i++)
+        {
+          T ae = ap[i];
+
+          for (j = 0; j < 4; j++)
+            t[i][j] += ae * bp[j];
+        }
+
+      ap += 4;
+      bp += 4;
+    }
+
+  for (i = 0; i < 4; i++)
+    for (j = 0; j < 4; j++)
+      c[i * ldc + j] += t[i][j];
+}
+
+#ifdef CRANK_CPU_X86
+
+#define W128 CRANK_GEMM_W
+#define V128 CRANK_GEMM_M128
+#define W256 (2 * CRANK_GEMM_W)
+#define V256 CRANK_GEMM_M256
+
+// 4 x (2 * W128) Tile: 8 accumulators.
+__attribute__((target ("sse2")))
+static void
+F(kernel_sse) (const guint  kc,
+               const T     *ap,
+               const T     *bp,
+               T           *c,
+               const guint  ldc)
+{
+  V128 c00 = I(_mm_setzero) ();
+  V128 c01 = I(_mm_setzero) ();
+  V128 c10 = I(_mm_setzero) ();
+  V128 c11 = I(_mm_setzero) ();
+  V128 c20 = I(_mm_setzero) ();
+  V128 c21 = I(_mm_setzero) ();
+  V128 c30 = I(_mm_setzero) ();
+  V128 c31 = I(_mm_setzero) ();
+  guint p;
+
+  for (p = 0; p < kc; p++)
+    {
+      V128 b0 = I(_mm_loadu) (bp);
+      V128 b1 = I(_mm_loadu) (bp + W128);
+      V128 ae;
+
+      ae = I(_mm_set1) (ap[0]);
+      c00 = I(_mm_add) (c00, I(_mm_mul) (ae, b0));
+      c01 = I(_mm_add) (c01, I(_mm_mul) (ae, b1));
+
+      ae = I(_mm_set1) (ap[1]);
+      c10 = I(_mm_add) (c10, I(_mm_mul) (ae, b0));
+      c11 = I(_mm_add) (c11, I(_mm_mul) (ae, b1));
+
+      ae = I(_mm_set1) (ap[2]);
+      c20 = I(_mm_add) (c20, I(_mm_mul) (ae, b0));
+      c21 = I(_mm_add) (c21, I(_mm_mul) (ae, b1));
+
+      ae = I(_mm_set1) (ap[3]);
+      c30 = I(_mm_add) (c30, I(_mm_mul) (ae, b0));
+      c31 = I(_mm_add) (c31, I(_mm_mul) (ae, b1));
+
+      ap += 4;
+      bp += 2 * W128;
+    }
+
+#define CRANK_GEMM_SSE_STORE(i, ci0, ci1)                                   \
+  I(_mm_storeu) (c + (i) * ldc,                                             \
+                 I(_mm_add) (I(_mm_loadu) (c + (i) * ldc), ci0));           \
+  I(_mm_storeu) (c + (i) * ldc + W128,                                      \
+                 I(_mm_add) (I(_mm_loadu) (c + (i) * ldc + W128), ci1));
+
+  CRANK_GEMM_SSE_STORE (0, c00, c01);
+  CRANK_GEMM_SSE_STORE (1, c10, c11);
+  CRANK_GEMM_SSE_STORE (2, c20, c21);
+  CRANK_GEMM_SSE_STORE (3, c30, c31);
+
+#undef CRANK_GEMM_SSE_STORE
+}
+
+
+// 6 x (2 * W256) Tile: 12 accumulators, which leaves 4 registers for operands.
+#define CRANK_GEMM_AVX_KERNEL_BODY(MADD)                                    \
+  V256 c00 = I(_mm256_setzero) ();                                          \
+  V256 c01 = I(_mm256_setzero) ();                                          \
+  V256 c10 = I(_mm256_setzero) ();                                          \
+  V256 c11 = I(_mm256_setzero) ();                                          \
+  V256 c20 = I(_mm256_setzero) ();                                          \
+  V256 c21 = I(_mm256_setzero) ();                                          \
+  V256 c30 = I(_mm256_setzero) ();                                          \
+  V256 c31 = I(_mm256_setzero) ();                                          \
+  V256 c40 = I(_mm256_setzero) ();                                          \
+  V256 c41 = I(_mm256_setzero) ();                                          \
+  V256 c50 = I(_mm256_setzero) ();                                          \
+  V256 c51 = I(_mm256_setzero) ();                                          \
+  guint p;                                                                  \
+                                                                            \
+  for (p = 0; p < kc; p++)                                                  \
+    {                                                                       \
+      V256 b0 = I(_mm256_loadu) (bp);                                       \
+      V256 b1 = I(_mm256_loadu) (bp + W256);                                \
+      V256 ae;                                                              \
+                                                                            \
+      ae = CRANK_GEMM_BROADCAST (ap + 0);                                   \
+      c00 = MADD (ae, b0, c00);                                             \
+      c01 = MADD (ae, b1, c01);                                             \
+      ae = CRANK_GEMM_BROADCAST (ap + 1);                                   \
+      c10 = MADD (ae, b0, c10);                                             \
+      c11 = MADD (ae, b1, c11);                                             \
+      ae = CRANK_GEMM_BROADCAST (ap + 2);                                   \
+      c20 = MADD (ae, b0, c20);                                             \
+      c21 = MADD (ae, b1, c21);                                             \
+      ae = CRANK_GEMM_BROADCAST (ap + 3);                                   \
+      c30 = MADD (ae, b0, c30);                                             \
+      c31 = MADD (ae, b1, c31);                                             \
+      ae = CRANK_GEMM_BROADCAST (ap + 4);                                   \
+      c40 = MADD (ae, b0, c40);                                             \
+      c41 = MADD (ae, b1, c41);                                             \
+      ae = CRANK_GEMM_BROADCAST (ap + 5);                                   \
+      c50 = MADD (ae, b0, c50);                                             \
+      c51 = MADD (ae, b1, c51);                                             \
+                                                                            \
+      ap += 6;                                                              \
+      bp += 2 * W256;                                                       \
+    }                                                                       \
+                                                                            \
+  CRANK_GEMM_AVX_STORE (0, c00, c01);                                       \
+  CRANK_GEMM_AVX_STORE (1, c10, c11);                                       \
+  CRANK_GEMM_AVX_STORE (2, c20, c21);                                       \
+  CRANK_GEMM_AVX_STORE (3, c30, c31);                                       \
+  CRANK_GEMM_AVX_STORE (4, c40, c41);                                       \
+  CRANK_GEMM_AVX_STORE (5, c50, c51);
+
+#define CRANK_GEMM_AVX_STORE(i, ci0, ci1)                                   \
+  I(_mm256_storeu) (c + (i) * ldc,                                          \
+                    I(_mm256_add) (I(_mm256_loadu) (c + (i) * ldc), ci0));  \
+  I(_mm256_storeu) (c + (i) * ldc + W256,                                   \
+                    I(_mm256_add) (I(_mm256_loadu) (c + (i) * ldc + W256),  \
+                                   ci1));
+
+#define CRANK_GEMM_AVX_MADD(a, b, c)  I(_mm256_add) (c, I(_mm256_mul) (a, b))
+#define CRANK_GEMM_FMA_MADD(a, b, c)  I(_mm256_fmadd) (a, b, c)
+
+__attribute__((target ("avx")))
+static void
+F(kernel_avx) (const guint  kc,
+               const T     *ap,
+               const T     *bp,
+               T           *c,
+               const guint  ldc)
+{
+  CRANK_GEMM_AVX_KERNEL_BODY (CRANK_GEMM_AVX_MADD)
+}
+
+__attribute__((target ("avx2,fma")))
+static void
+F(kernel_fma) (const guint  kc,
+               const T     *ap,
+               const T     *bp,
+               T           *c,
+               const guint  ldc)
+{
+  CRANK_GEMM_AVX_KERNEL_BODY (CRANK_GEMM_FMA_MADD)
+}
+
+#undef CRANK_GEMM_AVX_KERNEL_BODY
+#undef CRANK_GEMM_AVX_STORE
+#undef CRANK_GEMM_AVX_MADD
+#undef CRANK_GEMM_FMA_MADD
+
+#endif
+
+
+static const CRANK_GEMM_KERNEL F(kernel_info_generic) =
+  { 4, 4, F(kernel_generic) };
+
+#ifdef CRANK_CPU_X86
+static const CRANK_GEMM_KERNEL F(kernel_info_sse) =
+  { 4, 2 * W128, F(kernel_sse) };
+
+static const CRANK_GEMM_KERNEL F(kernel_info_avx) =
+  { 6, 2 * W256, F(kernel_avx) };
+
+static const CRANK_GEMM_KERNEL F(kernel_info_fma) =
+  { 6, 2 * W256, F(kernel_fma) };
+
+#undef W128
+#undef V128
+#undef W256
+#undef V256
+#endif
+
+static const CRANK_GEMM_KERNEL*
+F(get_kernel) (void)
+{
+  static gsize kernel = 0;
+
+  if (g_once_init_enter (&kernel))
+    {
+      const CRANK_GEMM_KERNEL *selected = &F(kernel_info_generic);
+
+#ifdef CRANK_CPU_X86
+      switch (_crank_cpu_get_simd_level ())
+        {
+        case CRANK_CPU_SIMD_AVX512:
+        case CRANK_CPU_SIMD_AVX2:
+          selected = &F(kernel_info_fma);
+          break;
+
+        case CRANK_CPU_SIMD_AVX:
+          selected = &F(kernel_info_avx);
+          break;
+
+        case CRANK_CPU_SIMD_SSE2:
+          selected = &F(kernel_info_sse);
+          break;
+
+        default:
+          break;
+        }
+#endif
+
+      g_once_init_leave (&kernel, (gsize) selected);
+    }
+
+  return (const CRANK_GEMM_KERNEL*) kernel;
+}
+
+
+//////// Packing ///////////////////////////////////////////////////////////////
+
+static void
+F(pack_a) (const guint  mr,
+           const guint  mc,
+           const guint  kc,
+           const T     *a,
+           const guint  lda,
+           T           *ap)
+{
+  guint ir;
+  guint i;
+  guint p;
+
+  for (ir = 0; ir < mc; ir += mr)
+    {
+      guint mrc = MIN (mr, mc - ir);
+
+      for (i = 0; i < mrc; i++)
+        {
+          const T *arow = a + (gsize)(ir + i) * lda;
+
+          for (p = 0; p < kc; p++)
+            ap[p * mr + i] = arow[p];
+        }
+
+      for (; i < mr; i++)
+        for (p = 0; p < kc; p++)
+          ap[p * mr + i] = 0;
+
+      ap += mr * kc;
+    }
+}
+
+static void
+F(pack_b) (const guint  nr,
+           const guint  kc,
+           const guint  nc,
+           const T     *b,
+           const guint  ldb,
+           T           *bp)
+{
+  guint jr;
+  guint j;
+  guint p;
+
+  for (jr = 0; jr < nc; jr += nr)
+    {
+      guint nrc = MIN (nr, nc - jr);
+
+      for (p = 0; p < kc; p++)
+        {
+          const T *brow = b + (gsize)p * ldb + jr;
+
+          for (j = 0; j < nrc; j++)
+            bp[j] = brow[j];
+
+          for (; j < nr; j++)
+            bp[j] = 0;
+
+          bp += nr;
+        }
+    }
+}
+
+
+//////// Macro kernel //////////////////////////////////////////////////////////
+
+static void
+F(macro_kernel) (const CRANK_GEMM_KERNEL *kernel,
+                 const guint              mc,
+                 const guint              nc,
+                 const guint              kc,
+                 const T                 *ap,
+                 const T                 *bp,
+                 T                       *c,
+                 const guint              ldc)
+{
+  guint mr = kernel->mr;
+  guint nr = kernel->nr;
+  guint ir;
+  guint jr;
+
+  for (jr = 0; jr < nc; jr += nr)
+    {
+      guint nrc = MIN (nr, nc - jr);
+      const T *bpj = bp + (gsize)jr * kc;
+
+      for (ir = 0; ir < mc; ir += mr)
+        {
+          guint mrc = MIN (mr, mc - ir);
+          const T *api = ap + (gsize)ir * kc;
+          T *cij = c + (gsize)ir * ldc + jr;
+
+          if ((mrc == mr) && (nrc == nr))
+            {
+              kernel->func (kc, api, bpj, cij, ldc);
+            }
+          else
+            {
+              // Edge tiles are computed on temporary tile, and only valid
+              // part is accumulated.
+              T tile[CRANK_GEMM_MR_MAX * CRANK_GEMM_NR_MAX] = {0};
+              guint i;
+              guint j;
+
+              kernel->func (kc, api, bpj, tile, nr);
+
+              for (i = 0; i < mrc; i++)
+                for (j = 0; j < nrc; j++)
+                  cij[(gsize)i * ldc + j] += tile[i * nr + j];
+            }
+        }
+    }
+}
+
+
+//////// Entry /////////////////////////////////////////////////////////////////
+
+void
+CRANK_GEMM_FUNC (const guint  m,
+                 const guint  n,
+                 const guint  k,
+                 const T     *a,
+                 const guint  lda,
+                 const T     *b,
+                 const guint  ldb,
+                 T           *c,
+                 const guint  ldc)
+{
+  const CRANK_GEMM_KERNEL *kernel = F(get_kernel) ();
+
+  guint mcb = (CRANK_GEMM_MC_BASE / kernel->mr) * kernel->mr;
+  guint ncb = CRANK_GEMM_NC;
+  guint kcb = CRANK_GEMM_KC;
+
+  guint ic;
+  guint jc;
+  guint pc;
+
+  CrankMatArena *scratch;
+  gsize mark;
+  T *ap;
+  T *bp;
+
+  if ((m == 0) || (n == 0) || (k == 0))
+    return;
+
+  // Packing buffers are reused from scratch arena, as this is called often.
+  scratch = crank_mat_arena_get_scratch ();
+  mark = crank_mat_arena_get_mark (scratch);
+
+  ap = crank_mat_arena_alloc (scratch, sizeof (T) * mcb * kcb);
+  bp = crank_mat_arena_alloc (scratch, sizeof (T) * ncb * kcb);
+
+  for (jc = 0; jc < n; jc += ncb)
+    {
+      guint nc = MIN (ncb, n - jc);
+
+      for (pc = 0; pc < k; pc += kcb)
+        {
+          guint kc = MIN (kcb, k - pc);
+
+          F(pack_b) (kernel->nr, kc, nc,
+                     b + (gsize)pc * ldb + jc, ldb, bp);
+
+          for (ic = 0; ic < m; ic += mcb)
+            {
+              guint mc = MIN (mcb, m - ic);
+
+              F(pack_a) (kernel->mr, mc, kc,
+                         a + (gsize)ic * lda + pc, lda, ap);
+
+              F(macro_kernel) (kernel, mc, nc, kc, ap, bp,
+                               c + (gsize)ic * ldc + jc, ldc);
+            }
+        }
+    }
+
+  crank_mat_arena_rewind (scratch, mark);
+}
+
+#undef T
+#undef F
+#undef I
+
+#endif
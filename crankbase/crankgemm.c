@@ -0,0 +1,128 @@
+/* Copyright (C) 2015, WSID   */
+
+/* Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+#define _CRANKBASE_INSIDE
+
+#include <string.h>
+
+#include <glib.h>
+
+#include "crankcpu-private.h"
+#include "crankgemm-private.h"
+#include "crankmatarena.h"
+
+#ifdef CRANK_CPU_X86
+#include <immintrin.h>
+#endif
+
+/*
+ * Blocked matrix multiplication.
+ *
+ * Matrices are row-major, as #CrankMatFloatN and #CrankMatDoubleN do.
+ * Computation is done in three level of blocking.
+ *
+ * * B is sliced into KC x NC panels, which is packed into NR-wide slivers.
+ * * A is sliced into MC x KC blocks, which is packed into MR-tall slivers.
+ * * Micro kernel computes MR x NR tile of C from two slivers.
+ *
+ * Packed slivers are read sequentially by micro kernel, so they stay in cache
+ * and are easy to vectorize. Micro kernel is selected when it is first used, by
+ * _crank_cpu_get_simd_level(), so it can be limited by CRANK_SIMD.
+ *
+ * Kernels are written once in crankgemm-template-private.h, and instantiated
+ * for each precision here.
+ */
+
+//////// Block Sizes ///////////////////////////////////////////////////////////
+
+#define CRANK_GEMM_MR_MAX   8
+#define CRANK_GEMM_NR_MAX   16
+
+#define CRANK_GEMM_MC_BASE  128
+#define CRANK_GEMM_KC       256
+#define CRANK_GEMM_NC       2048
+
+
+//////// Float /////////////////////////////////////////////////////////////////
+
+/*
+ * _crank_gemm_float:
+ * @m: Row count of @a and @c.
+ * @n: Column count of @b and @c.
+ * @k: Column count of @a and row count of @b.
+ * @a: Row-major matrix data.
+ * @lda: Row stride of @a.
+ * @b: Row-major matrix data.
+ * @ldb: Row stride of @b.
+ * @c: (inout): Row-major matrix data to accumulate on.
+ * @ldc: Row stride of @c.
+ *
+ * Accumulates product of two matrices. (c += a * b)
+ *
+ * Packing buffers are taken from scratch arena. Still, this should be used for
+ * sufficiently large matrices. (See %CRANK_GEMM_FLOAT_THRESHOLD)
+ */
+
+#define CRANK_GEMM_T              gfloat
+#define CRANK_GEMM_FUNC           _crank_gemm_float
+#define CRANK_GEMM_PREFIX(name)   crank_gemm_float_##name
+#define CRANK_GEMM_KERNEL         CrankGemmFloatKernel
+#define CRANK_GEMM_KERNEL_FUNC    CrankGemmFloatKernelFunc
+#define CRANK_GEMM_INTRIN(f)      f##_ps
+#define CRANK_GEMM_BROADCAST      _mm256_broadcast_ss
+#define CRANK_GEMM_W              4
+#define CRANK_GEMM_M128           __m128
+#define CRANK_GEMM_M256           __m256
+
+#include "crankgemm-template-private.h"
+
+#undef CRANK_GEMM_T
+#undef CRANK_GEMM_FUNC
+#undef CRANK_GEMM_PREFIX
+#undef CRANK_GEMM_KERNEL
+#undef CRANK_GEMM_KERNEL_FUNC
+#undef CRANK_GEMM_INTRIN
+#undef CRANK_GEMM_BROADCAST
+#undef CRANK_GEMM_W
+#undef CRANK_GEMM_M128
+#undef CRANK_GEMM_M256
+
+
+//////// Double ////////////////////////////////////////////////////////////////
+
+/*
+ * _crank_gemm_double:
+ *
+ * Double version of _crank_gemm_float(). Tiles are half as wide, as a register
+ * holds half as many elements.
+ */
+
+#define CRANK_GEMM_T              gdouble
+#define CRANK_GEMM_FUNC           _crank_gemm_double
+#define CRANK_GEMM_PREFIX(name)   crank_gemm_double_##name
+#define CRANK_GEMM_KERNEL         CrankGemmDoubleKernel
+#define CRANK_GEMM_KERNEL_FUNC    CrankGemmDoubleKernelFunc
+#define CRANK_GEMM_INTRIN(f)      f##_pd
+#define CRANK_GEMM_BROADCAST      _mm256_broadcast_sd
+#define CRANK_GEMM_W              2
+#define CRANK_GEMM_M128           __m128d
+#define CRANK_GEMM_M256           __m256d
+
+#include "crankgemm-template-private.h"
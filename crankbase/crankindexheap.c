@@ -0,0 +1,460 @@
+/* Copyright (C) 2015, WSID   */
+
+/* Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#define _CRANKBASE_INSIDE
+
+#include <math.h>
+#include <string.h>
+
+#include <glib.h>
+
+#include "crankindexheap.h"
+
+/**
+ * SECTION: crankindexheap
+ * @title: Index Heap
+ * @short_description: Min-heap of indices, with decrease-key.
+ * @stability: Unstable
+ * @include: crankbase.h
+ *
+ * #CrankIndexHeap is a binary min-heap of indices in [0, capacity), with
+ * #gfloat priorities. Each index can be in heap at most once, and its position
+ * is tracked, so that priority of it can be changed in O(log n), rather than
+ * pushing duplicated entries.
+ *
+ * This is intended to be used by graph searches, like Dijkstra's algorithm or
+ * A*, where nodes are numbered densely.
+ *
+ * |[ <!-- language="C" -->
+ *   crank_index_heap_update (&heap, from, 0.0f);
+ *
+ *   while (! crank_index_heap_is_empty (&heap))
+ *     {
+ *       gfloat cost;
+ *       guint node = crank_index_heap_pop (&heap, &cost);
+ *
+ *       // For each neighbor, lower its cost.
+ *       crank_index_heap_update (&heap, next, cost + edge_cost);
+ *     }
+ * ]|
+ *
+ * A heap can be reused by crank_index_heap_clear(), which takes time of count
+ * of remaining entries, rather than capacity.
+ */
+
+#define CRANK_INDEX_HEAP_NONE G_MAXUINT
+
+//////// Private functions /////////////////////////////////////////////////////
+
+static void crank_index_heap_sift_up   (CrankIndexHeap *heap,
+                                        guint           pos);
+
+static void crank_index_heap_sift_down (CrankIndexHeap *heap,
+                                        guint           pos);
+
+
+//////// Initialization ////////////////////////////////////////////////////////
+
+/**
+ * crank_index_heap_init:
+ * @heap: (out): A Heap.
+ * @capacity: Count of indices.
+ *
+ * Initializes an empty heap, which can hold indices less than @capacity.
+ * Unset with crank_index_heap_fini() after use.
+ */
+void
+crank_index_heap_init (CrankIndexHeap *heap,
+                       const guint     capacity)
+{
+  heap->entries = g_new (CrankIndexHeapEntry, MAX (capacity, 1));
+  heap->n = 0;
+
+  heap->positions = g_new (guint, MAX (capacity, 1));
+  heap->capacity = capacity;
+
+  memset (heap->positions, 0xFF, sizeof (guint) * capacity);
+}
+
+/**
+ * crank_index_heap_fini:
+ * @heap: A Heap.
+ *
+ * Frees associated resources.
+ */
+void
+crank_index_heap_fini (CrankIndexHeap *heap)
+{
+  g_free (heap->entries);
+  g_free (heap->positions);
+
+  heap->entries = NULL;
+  heap->positions = NULL;
+  heap->n = 0;
+  heap->capacity = 0;
+}
+
+/**
+ * crank_index_heap_reserve:
+ * @heap: A Heap.
+ * @capacity: Count of indices.
+ *
+ * Makes @heap able to hold indices less than @capacity. This keeps entries in
+ * heap.
+ *
+ * Storage is grown geometrically, so this can be called for each new index.
+ */
+void
+crank_index_heap_reserve (CrankIndexHeap *heap,
+                          const guint     capacity)
+{
+  guint ncapacity;
+
+  if (capacity <= heap->capacity)
+    return;
+
+  ncapacity = MAX (capacity, heap->capacity * 2);
+
+  heap->entries = g_renew (CrankIndexHeapEntry, heap->entries, ncapacity);
+  heap->positions = g_renew (guint, heap->positions, ncapacity);
+
+  memset (heap->positions + heap->capacity, 0xFF,
+          sizeof (guint) * (ncapacity - heap->capacity));
+
+  heap->capacity = ncapacity;
+}
+
+/**
+ * crank_index_heap_clear:
+ * @heap: A Heap.
+ *
+ * Removes all entries, to reuse @heap.
+ */
+void
+crank_index_heap_clear (CrankIndexHeap *heap)
+{
+  guint i;
+
+  for (i = 0; i < heap->n; i++)
+    heap->positions[heap->entries[i].index] = CRANK_INDEX_HEAP_NONE;
+
+  heap->n = 0;
+}
+
+
+//////// Properties ////////////////////////////////////////////////////////////
+
+/**
+ * crank_index_heap_get_size:
+ * @heap: A Heap.
+ *
+ * Gets count of entries.
+ *
+ * Returns: Count of entries.
+ */
+guint
+crank_index_heap_get_size (CrankIndexHeap *heap)
+{
+  return heap->n;
+}
+
+/**
+ * crank_index_heap_is_empty:
+ * @heap: A Heap.
+ *
+ * Checks whether heap is empty.
+ *
+ * Returns: Whether heap is empty.
+ */
+gboolean
+crank_index_heap_is_empty (CrankIndexHeap *heap)
+{
+  return heap->n == 0;
+}
+
+/**
+ * crank_index_heap_contains:
+ * @heap: A Heap.
+ * @index: An index.
+ *
+ * Checks whether @index is in heap.
+ *
+ * Returns: Whether @index is in heap.
+ */
+gboolean
+crank_index_heap_contains (CrankIndexHeap *heap,
+                           const guint     index)
+{
+  return (index < heap->capacity) &&
+         (heap->positions[index] != CRANK_INDEX_HEAP_NONE);
+}
+
+/**
+ * crank_index_heap_get_priority:
+ * @heap: A Heap.
+ * @index: An index.
+ *
+ * Gets priority of @index.
+ *
+ * Returns: Priority of @index, or %INFINITY if @index is not in heap.
+ */
+gfloat
+crank_index_heap_get_priority (CrankIndexHeap *heap,
+                               const guint     index)
+{
+  if (! crank_index_heap_contains (heap, index))
+    return INFINITY;
+
+  return heap->entries[heap->positions[index]].priority;
+}
+
+
+//////// Operations ////////////////////////////////////////////////////////////
+
+/**
+ * crank_index_heap_push:
+ * @heap: A Heap.
+ * @index: An index, which is not in heap.
+ * @priority: Priority of @index.
+ *
+ * Pushes @index with @priority.
+ */
+void
+crank_index_heap_push (CrankIndexHeap *heap,
+                       const guint     index,
+                       const gfloat    priority)
+{
+  g_return_if_fail (index < heap->capacity);
+  g_return_if_fail (heap->positions[index] == CRANK_INDEX_HEAP_NONE);
+
+  heap->entries[heap->n].priority = priority;
+  heap->entries[heap->n].index = index;
+  heap->positions[index] = heap->n;
+  heap->n++;
+
+  crank_index_heap_sift_up (heap, heap->n - 1);
+}
+
+/**
+ * crank_index_heap_decrease:
+ * @heap: A Heap.
+ * @index: An index in heap.
+ * @priority: New priority, which is not greater than current one.
+ *
+ * Decreases priority of @index.
+ */
+void
+crank_index_heap_decrease (CrankIndexHeap *heap,
+                           const guint     index,
+                           const gfloat    priority)
+{
+  guint pos;
+
+  g_return_if_fail (crank_index_heap_contains (heap, index));
+
+  pos = heap->positions[index];
+
+  g_return_if_fail (priority <= heap->entries[pos].priority);
+
+  heap->entries[pos].priority = priority;
+  crank_index_heap_sift_up (heap, pos);
+}
+
+/**
+ * crank_index_heap_update:
+ * @heap: A Heap.
+ * @index: An index.
+ * @priority: Priority of @index.
+ *
+ * Pushes @index if it is not in heap, or decreases its priority if @priority
+ * is less than current one. This is relaxation step of Dijkstra's algorithm.
+ *
+ * Returns: Whether @index was pushed or decreased.
+ */
+gboolean
+crank_index_heap_update (CrankIndexHeap *heap,
+                         const guint     index,
+                         const gfloat    priority)
+{
+  guint pos;
+
+  g_return_val_if_fail (index < heap->capacity, FALSE);
+
+  pos = heap->positions[index];
+
+  if (pos == CRANK_INDEX_HEAP_NONE)
+    {
+      crank_index_heap_push (heap, index, priority);
+      return TRUE;
+    }
+
+  if (priority < heap->entries[pos].priority)
+    {
+      heap->entries[pos].priority = priority;
+      crank_index_heap_sift_up (heap, pos);
+      return TRUE;
+    }
+
+  return FALSE;
+}
+
+/**
+ * crank_index_heap_peek:
+ * @heap: A Heap.
+ * @priority: (out) (optional): Priority of index.
+ *
+ * Gets index with minimum priority, without removing it.
+ *
+ * Returns: An index with minimum priority, or %G_MAXUINT if heap is empty.
+ */
+guint
+crank_index_heap_peek (CrankIndexHeap *heap,
+                       gfloat         *priority)
+{
+  if (heap->n == 0)
+    {
+      if (priority != NULL)
+        *priority = INFINITY;
+      return G_MAXUINT;
+    }
+
+  if (priority != NULL)
+    *priority = heap->entries[0].priority;
+
+  return heap->entries[0].index;
+}
+
+/**
+ * crank_index_heap_pop:
+ * @heap: A Heap.
+ * @priority: (out) (optional): Priority of index.
+ *
+ * Removes index with minimum priority.
+ *
+ * Returns: An index with minimum priority, or %G_MAXUINT if heap is empty.
+ */
+guint
+crank_index_heap_pop (CrankIndexHeap *heap,
+                      gfloat         *priority)
+{
+  guint index = crank_index_heap_peek (heap, priority);
+
+  if (heap->n == 0)
+    return index;
+
+  heap->positions[index] = CRANK_INDEX_HEAP_NONE;
+  heap->n--;
+
+  if (heap->n != 0)
+    {
+      heap->entries[0] = heap->entries[heap->n];
+      heap->positions[heap->entries[0].index] = 0;
+      crank_index_heap_sift_down (heap, 0);
+    }
+
+  return index;
+}
+
+/**
+ * crank_index_heap_remove:
+ * @heap: A Heap.
+ * @index: An index.
+ *
+ * Removes @index from heap, if it is in heap.
+ */
+void
+crank_index_heap_remove (CrankIndexHeap *heap,
+                         const guint     index)
+{
+  guint pos;
+
+  if (! crank_index_heap_contains (heap, index))
+    return;
+
+  pos = heap->positions[index];
+  heap->positions[index] = CRANK_INDEX_HEAP_NONE;
+  heap->n--;
+
+  if (pos != heap->n)
+    {
+      heap->entries[pos] = heap->entries[heap->n];
+      heap->positions[heap->entries[pos].index] = pos;
+
+      crank_index_heap_sift_up (heap, pos);
+      crank_index_heap_sift_down (heap, heap->positions[heap->entries[pos].index]);
+    }
+}
+
+
+//////// Private functions /////////////////////////////////////////////////////
+
+/* Moves hole up, and places entry at its final position, rather than swapping
+ * on each level. */
+static void
+crank_index_heap_sift_up (CrankIndexHeap *heap,
+                          guint           pos)
+{
+  CrankIndexHeapEntry entry = heap->entries[pos];
+
+  while (pos != 0)
+    {
+      guint parent = (pos - 1) / 2;
+
+      if (heap->entries[parent].priority <= entry.priority)
+        break;
+
+      heap->entries[pos] = heap->entries[parent];
+      heap->positions[heap->entries[pos].index] = pos;
+      pos = parent;
+    }
+
+  heap->entries[pos] = entry;
+  heap->positions[entry.index] = pos;
+}
+
+static void
+crank_index_heap_sift_down (CrankIndexHeap *heap,
+                            guint           pos)
+{
+  CrankIndexHeapEntry entry = heap->entries[pos];
+
+  while (TRUE)
+    {
+      guint child = pos * 2 + 1;
+
+      if (heap->n <= child)
+        break;
+
+      if ((child + 1 < heap->n) &&
+          (heap->entries[child + 1].priority < heap->entries[child].priority))
+        child++;
+
+      if (entry.priority <= heap->entries[child].priority)
+        break;
+
+      heap->entries[pos] = heap->entries[child];
+      heap->positions[heap->entries[pos].index] = pos;
+      pos = child;
+    }
+
+  heap->entries[pos] = entry;
+  heap->positions[entry.index] = pos;
+}
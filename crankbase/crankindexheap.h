@@ -0,0 +1,114 @@
+#ifndef CRANKINDEXHEAP_H
+#define CRANKINDEXHEAP_H
+
+/* Copyright (C) 2015, WSID   */
+
+/* Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef _CRANKBASE_INSIDE
+#error crankindexheap.h cannot be included directly.
+#endif
+
+#include <glib.h>
+
+G_BEGIN_DECLS
+
+/**
+ * CrankIndexHeapEntry:
+ * @priority: Priority of entry.
+ * @index: Index of entry.
+ *
+ * An entry of #CrankIndexHeap.
+ */
+typedef struct _CrankIndexHeapEntry {
+  gfloat priority;
+  guint  index;
+} CrankIndexHeapEntry;
+
+/**
+ * CrankIndexHeap:
+ * @entries: (array length=n): Entries in heap order.
+ * @n: Count of entries.
+ * @positions: (array length=capacity): Positions of indices in @entries.
+ * @capacity: Count of indices.
+ *
+ * A min-heap of indices with float priorities.
+ */
+typedef struct _CrankIndexHeap {
+  CrankIndexHeapEntry *entries;
+  guint                n;
+
+  guint               *positions;
+  guint                capacity;
+} CrankIndexHeap;
+
+
+//////// Initialization ////////////////////////////////////////////////////////
+
+void      crank_index_heap_init     (CrankIndexHeap *heap,
+                                     const guint     capacity);
+
+void      crank_index_heap_fini     (CrankIndexHeap *heap);
+
+void      crank_index_heap_reserve  (CrankIndexHeap *heap,
+                                     const guint     capacity);
+
+void      crank_index_heap_clear    (CrankIndexHeap *heap);
+
+
+//////// Properties ////////////////////////////////////////////////////////////
+
+guint     crank_index_heap_get_size (CrankIndexHeap *heap);
+
+gboolean  crank_index_heap_is_empty (CrankIndexHeap *heap);
+
+gboolean  crank_index_heap_contains (CrankIndexHeap *heap,
+                                     const guint     index);
+
+gfloat    crank_index_heap_get_priority (CrankIndexHeap *heap,
+                                         const guint     index);
+
+
+//////// Operations ////////////////////////////////////////////////////////////
+
+void      crank_index_heap_push     (CrankIndexHeap *heap,
+                                     const guint     index,
+                                     const gfloat    priority);
+
+void      crank_index_heap_decrease (CrankIndexHeap *heap,
+                                     const guint     index,
+                                     const gfloat    priority);
+
+gboolean  crank_index_heap_update   (CrankIndexHeap *heap,
+                                     const guint     index,
+                                     const gfloat    priority);
+
+guint     crank_index_heap_peek     (CrankIndexHeap *heap,
+                                     gfloat         *priority);
+
+guint     crank_index_heap_pop      (CrankIndexHeap *heap,
+                                     gfloat         *priority);
+
+void      crank_index_heap_remove   (CrankIndexHeap *heap,
+                                     const guint     index);
+
+G_END_DECLS
+
+#endif
@@ -635,6 +635,151 @@ crank_iter_mem_float_foreach (CrankIterMemFloat *iter,
 
 
 
+//////// Double Memory Iterators ///////////////////////////////////////////////
+//////// Initialization ////////////////////////////////////////////////////////
+
+/**
+ * crank_iter_mem_double_init:
+ * @iter: (out): Iterator to initialize.
+ * @from: Start of memory range.
+ * @to: End of memory range.
+ *
+ * Initialize memory iterator by start and end points.
+ */
+void
+crank_iter_mem_double_init (CrankIterMemDouble *iter,
+                            gdouble            *from,
+                            gdouble            *to)
+{
+  crank_ran_ptr_init (&(iter->range), from, to);
+  iter->ptr = from - 1;
+}
+
+/**
+ * crank_iter_mem_double_init_with_count:
+ * @iter: (out): Iterator to initialize.
+ * @from: Start of memory range.
+ * @count: Number of #guint from start point.
+ *
+ * Initialize memory iterator by start point and count.
+ *
+ * Useful especially for array of #guint.
+ */
+void
+crank_iter_mem_double_init_with_count (CrankIterMemDouble *iter,
+                                       gdouble            *from,
+                                       guint               count)
+{
+  crank_iter_mem_double_init (iter, from, from + count);
+}
+
+/**
+ * crank_iter_mem_double_init_with_range:
+ * @iter: (out): Iterator to initialize.
+ * @range: Memory range to iterate.
+ *
+ * Initialize memory iterator by memory range.
+ */
+void
+crank_iter_mem_double_init_with_range (CrankIterMemDouble *iter,
+                                       CrankRanPtr        *range)
+{
+  crank_ran_ptr_copy (range, &(iter->range));
+  iter->ptr = (gdouble*)(range->start) - 1;
+}
+
+//////// Iteration /////////////////////////////////////////////////////////////
+
+/**
+ * crank_iter_mem_double_is_valid:
+ * @iter: A Iterator.
+ *
+ * Checks iterator is valid and can return valid value.
+ *
+ * Returns: Whether iterator is valid
+ */
+gboolean
+crank_iter_mem_double_is_valid (CrankIterMemDouble *iter)
+{
+  return (crank_ran_ptr_contains (&(iter->range), iter->ptr));
+}
+
+/**
+ * crank_iter_mem_double_next:
+ * @iter: A Iterator.
+ *
+ * Proceed iterator to next position.
+ *
+ * Returns: Whether iterator proceed to next position.
+ */
+gboolean
+crank_iter_mem_double_next (CrankIterMemDouble *iter)
+{
+  if (iter->ptr + 1 < (gdouble*)((iter->range).end))
+    {
+      iter->ptr++;
+      return TRUE;
+    }
+  else
+    return FALSE;
+}
+
+/**
+ * crank_iter_mem_double_get:
+ * @iter: A Iterator.
+ *
+ * Retrieve value positioned at iterator's position.
+ *
+ * Returns: A Value.
+ */
+gdouble
+crank_iter_mem_double_get (CrankIterMemDouble *iter)
+{
+  if (crank_iter_mem_double_is_valid (iter))
+    {
+      return (*iter->ptr);
+    }
+  else
+    return 0;
+}
+
+/**
+ * crank_iter_mem_double_foreach:
+ * @iter: A Iterator
+ * @func: (scope call): Function to iterate over.
+ * @userdata: (closure): Userdata for @func.
+ *
+ * Iterate a iterator with given @func.
+ *
+ * To continue, @func should return %TRUE and, to break, return %FALSE.
+ *
+ * This will consume @iter to end, unless @func returns %FALSE at the some point
+ * in the middle.
+ *
+ * Returns: Whether the function doesn't return %FALSE.
+ */
+gboolean
+crank_iter_mem_double_foreach (CrankIterMemDouble *iter,
+                               CrankBoolDoubleFunc func,
+                               gpointer            userdata)
+{
+  if (!crank_iter_mem_double_is_valid(iter) &&
+      !crank_iter_mem_double_next (iter))
+    return TRUE;
+
+  do
+    {
+      if (!func (crank_iter_mem_double_get(iter), userdata))
+        return FALSE;
+    }
+  while (crank_iter_mem_double_next (iter));
+
+  return TRUE;
+}
+
+
+
+
 //////// Pointer Memory Iterators //////////////////////////////////////////////
 //////// Initialization ////////////////////////////////////////////////////////
 
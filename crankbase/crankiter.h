@@ -82,6 +82,18 @@ typedef struct _CrankIterMemFloat {
   gfloat *ptr;
 } CrankIterMemFloat;
 
+/**
+ * CrankIterMemDouble:
+ * @range: Memory range to iterate.
+ * @ptr: Current Iteration position.
+ *
+ * Iterator for memory range (for example, plain #gdouble arrays.)
+ */
+typedef struct _CrankIterMemDouble {
+  CrankRanPtr range;
+  gdouble *ptr;
+} CrankIterMemDouble;
+
 /**
  * CrankIterMemPtr:
  * @range: Memory range to iterate.
@@ -226,6 +238,35 @@ gboolean crank_iter_mem_float_foreach (CrankIterMemFloat *iter,
 
 
 
+//////// Double Memory Iterator ////////////////////////////////////////////////
+//////// Initialization ////////////////////////////////////////////////////////
+
+void     crank_iter_mem_double_init (CrankIterMemDouble *iter,
+                                     gdouble            *from,
+                                     gdouble            *to);
+
+void     crank_iter_mem_double_init_with_count (CrankIterMemDouble *iter,
+                                                gdouble            *from,
+                                                guint               count);
+
+void     crank_iter_mem_double_init_with_range (CrankIterMemDouble *iter,
+                                                CrankRanPtr        *range);
+
+//////// Iteration /////////////////////////////////////////////////////////////
+
+gboolean crank_iter_mem_double_is_valid (CrankIterMemDouble *iter);
+
+gboolean crank_iter_mem_double_next (CrankIterMemDouble *iter);
+
+gdouble  crank_iter_mem_double_get (CrankIterMemDouble *iter);
+
+
+gboolean crank_iter_mem_double_foreach (CrankIterMemDouble *iter,
+                                        CrankBoolDoubleFunc func,
+                                        gpointer            userdata);
+
+
+
 //////// Pointer Memory Iterator ///////////////////////////////////////////////
 //////// Initialization ////////////////////////////////////////////////////////
 
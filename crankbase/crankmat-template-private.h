@@ -0,0 +1,4826 @@
+/* Copyright (C) 2015, WSID   */
+
+/* Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/* This is template for matrices, and is included by crankmatfloat.c and
+ * crankmatdouble.c. */
+
+#ifndef _CRANKBASE_INSIDE
+#error crankmat-template-private.h cannot be included directly.
+#endif
+
+#ifndef CRANK_MAT_T
+#error CRANK_MAT_T should be defined before including template.
+#endif
+
+#ifndef __GTK_DOC_IGNORE__
+
+/*
+ * Parameters of template.
+ *
+ * CRANK_MAT_T: Element type. (gfloat, gdouble)
+ * CRANK_MAT_TYPE(n): Makes matrix type name with size. (2, 3, 4, N)
+ * CRANK_MAT_FUNC(n, name): Makes function name with size. (2, 3, 4, _n)
+ * CRANK_MAT_SYM(n): Makes type prefix with size, for type definition.
+ * CRANK_MAT_GTYPE(n): Makes GType macro name with size. (2, 3, 4, _N)
+ * CRANK_MAT_VEC_TYPE(n), CRANK_MAT_VEC_FUNC(n, name): Same for vectors.
+ * CRANK_MAT_LU_TYPE, CRANK_MAT_LU_FUNC(name): LU factorization and its
+ *     functions.
+ * CRANK_MAT_NAME: Name of variable sized matrix, in warnings.
+ * CRANK_MAT_HASH: Hash function for an element.
+ * CRANK_MAT_MATH(f): Appends type suffix to math function. (sinf, sin)
+ * CRANK_MAT_GEMM, CRANK_MAT_GEMM_THRESHOLD: Blocked multiplication, and
+ *     count of multiplications to use it.
+ * CRANK_MAT_INTRIN(f): Appends type suffix to intrinsic. (_ps, _pd)
+ * CRANK_MAT_M256: Vector type of 256 bits.
+ * CRANK_MAT_W256: Number of elements in 256 bits.
+ *
+ * Optional parameters.
+ *
+ * CRANK_MAT_FIXED_HAS_SIZE(n), CRANK_MAT_FIXED_MAX, CRANK_MAT_FIXED_FUNC(name):
+ *     Fixed size kernels, which small square matrices use.
+ *
+ * Including file should define these kernels, which are specific to precision,
+ * when CRANK_CPU_X86 is defined.
+ *
+ * - F(4, batch_mulv_avx)
+ * - F(4, batch_mul_avx)
+ * - F(4, batch_transform_avx)
+ */
+
+#define T           CRANK_MAT_T
+#define M(n)        CRANK_MAT_TYPE(n)
+#define V(n)        CRANK_MAT_VEC_TYPE(n)
+#define LU          CRANK_MAT_LU_TYPE
+#define F(n, name)  CRANK_MAT_FUNC(n, name)
+#define FV(n, name) CRANK_MAT_VEC_FUNC(n, name)
+#define FLU(name)   CRANK_MAT_LU_FUNC(name)
+#define I(f)        CRANK_MAT_INTRIN(f)
+#define V256        CRANK_MAT_M256
+#define W256        CRANK_MAT_W256
+
+//////// Private Macros ////////////////////////////////////////////////////////
+
+// Minimum count of elements that a thread processes, in parallel operations.
+#define CRANK_MAT_PARALLEL_GRAIN  16384
+
+// Minimum count of rows that a thread processes, when each row costs given.
+#define CRANK_MAT_PARALLEL_ROW_GRAIN(cost) \
+  MAX (1, CRANK_MAT_PARALLEL_GRAIN / MAX ((cost), 1))
+
+// Size of column block in transposing.
+#define CRANK_MAT_TRANSPOSE_BLOCK 64
+
+// Count of rows that are copied out at once, in in-place multiplication.
+#define CRANK_MAT_MUL_PANEL 64
+
+#define DET4(a, b, c, d) \
+  ((a) * (d) - (b) * (c))
+
+
+static void F(2, transform_to_string) (const GValue *src,
+                                       GValue       *dest);
+
+
+G_DEFINE_BOXED_TYPE_WITH_CODE (
+  M(2),
+  CRANK_MAT_SYM(2),
+  F(2, dup),
+  g_free,
+  {
+    g_value_register_transform_func (
+      g_define_type_id,
+      G_TYPE_STRING,
+      F(2, transform_to_string));
+  })
+
+void
+F(2, init) (M(2)    *mat,
+            const T  m00,
+            const T  m01,
+            const T  m10,
+            const T  m11)
+{
+  mat->m00 = m00;
+  mat->m01 = m01;
+  mat->m10 = m10;
+  mat->m11 = m11;
+}
+
+void
+F(2, init_arr) (M(2)    *mat,
+                const T *marr)
+{
+  memcpy (mat, marr, sizeof(T) * 4);
+}
+
+void
+F(2, init_row) (M(2) *mat,
+                V(2) *row0,
+                V(2) *row1)
+{
+  FV(2, init_arr) ((V(2)*)mat,       (T*)row0);
+  FV(2, init_arr) (((V(2)*)mat) + 1, (T*)row1);
+}
+
+void
+F(2, init_row_arr) (M(2) *mat,
+                    V(2) *row_arr)
+{
+  F(2, init_arr) (mat, (T*)row_arr);
+}
+
+void
+F(2, init_row_parr) (M(2)  *mat,
+                     V(2) **row_parr)
+{
+  F(2, init_row) (mat, row_parr[0], row_parr[1]);
+}
+
+void
+F(2, init_col) (M(2) *mat,
+                V(2) *col0,
+                V(2) *col1)
+{
+  mat->m00 = col0->x;
+  mat->m01 = col1->x;
+  mat->m10 = col0->y;
+  mat->m11 = col1->y;
+}
+
+void
+F(2, init_col_arr) (M(2) *mat,
+                    V(2) *col_arr)
+{
+  F(2, init_col) (mat, col_arr, col_arr + 1);
+}
+
+void
+F(2, init_col_parr) (M(2)  *mat,
+                     V(2) **col_parr)
+{
+  F(2, init_col) (mat, col_parr[0], col_parr[1]);
+}
+
+void
+F(2, init_diag) (M(2)    *mat,
+                 const T  m00,
+                 const T  m11)
+{
+  mat->m00 = m00;
+  mat->m01 = 0;
+  mat->m10 = 0;
+  mat->m11 = m11;
+}
+
+void
+F(2, init_diag_arr) (M(2)    *mat,
+                     const T *darr)
+{
+  F(2, init_diag) (mat, darr[0], darr[1]);
+}
+
+void
+F(2, init_diag_vec) (M(2) *mat,
+                     V(2) *dvec)
+{
+  F(2, init_diag) (mat, dvec->x, dvec->y);
+}
+
+void
+F(2, init_fill) (M(2)    *mat,
+                 const T  fill)
+{
+  mat->m00 = fill;
+  mat->m01 = fill;
+  mat->m10 = fill;
+  mat->m11 = fill;
+}
+
+void
+F(2, copy) (M(2) *mat,
+            M(2) *other)
+{
+  F(2, init_arr) (other, (T*) mat);
+}
+
+M(2)*
+F(2, dup) (M(2) *mat)
+{
+  M(2) *result = g_new (M(2), 1);
+  F(2, copy) (mat, result);
+  return result;
+}
+
+
+//////// Basic Operations //////////////////////////////////////////////////////
+
+guint
+F(2, hash) (gconstpointer a)
+{
+  const M(2) *mat = (const M(2)*)a;
+
+  guint hash;
+  hash =  CRANK_MAT_HASH (&(mat->m00));
+  hash =  CRANK_MAT_HASH (&(mat->m01)) + hash * 37;
+  hash =  CRANK_MAT_HASH (&(mat->m10)) + hash * 37;
+  hash =  CRANK_MAT_HASH (&(mat->m11)) + hash * 37;
+  return hash;
+}
+
+gboolean
+F(2, equal) (gconstpointer a,
+             gconstpointer b)
+{
+  const M(2) *mat_a = (const M(2)*)a;
+  const M(2) *mat_b = (const M(2)*)b;
+
+  return (mat_a->m00 == mat_b->m00) &&
+         (mat_a->m01 == mat_b->m01) &&
+         (mat_a->m10 == mat_b->m10) &&
+         (mat_a->m11 == mat_b->m11);
+}
+
+gchar*
+F(2, to_string) (M(2) *mat)
+{
+  return F(2, to_string_full) (mat, "[", ", ", "]", "[", ", ", "]", "%g");
+}
+
+gchar*
+F(2, to_string_full) (M(2)        *mat,
+                      const gchar *mat_left,
+                      const gchar *mat_in,
+                      const gchar *mat_right,
+                      const gchar *row_left,
+                      const gchar *row_in,
+                      const gchar *row_right,
+                      const gchar *format)
+{
+  GString *builder;
+  gchar *str;
+
+  builder = g_string_new (mat_left);
+  g_string_append (builder,
+                   FV(2, to_string_full) (((V(2)*)mat) + 0,
+                                          row_left, row_in, row_right,
+                                          format)   );
+
+  g_string_append (builder, mat_in);
+  g_string_append (builder,
+                   FV(2, to_string_full) (((V(2)*)mat) + 1,
+                                          row_left, row_in, row_right,
+                                          format)   );
+
+  g_string_append (builder, mat_right);
+
+  str = builder->str;
+
+  g_string_free (builder, FALSE);
+  return str;
+}
+
+T
+F(2, get) (M(2)        *mat,
+           const guint  i,
+           const guint  j)
+{
+  return ((T*)mat) [(2 * i)  +  j];
+}
+
+void
+F(2, set) (M(2)        *mat,
+           const guint  i,
+           const guint  j,
+           const T      value)
+{
+  ((T*)mat) [(2 * i)  +  j] = value;
+}
+
+void
+F(2, get_row) (M(2)        *mat,
+               const guint  index,
+               V(2)        *row)
+{
+  FV(2, init_arr) (row, ((T*)mat) + 2 * index);
+}
+
+void
+F(2, set_row) (M(2)        *mat,
+               const guint  index,
+               V(2)        *row)
+{
+  FV(2, init_arr) (((V(2)*)mat) + index, (T*)row);
+}
+
+
+void
+F(2, get_col) (M(2)        *mat,
+               const guint  index,
+               V(2)        *col)
+{
+  T *ptr = ((T*)mat) + index;
+  col->x = ptr[0];
+  col->y = ptr[2];
+}
+
+void
+F(2, set_col) (M(2)        *mat,
+               const guint  index,
+               V(2)        *col)
+{
+  T *ptr = ((T*)mat) + index;
+  ptr[0] = col->x;
+  ptr[2] = col->y;
+}
+
+T
+F(2, get_tr) (M(2) *mat)
+{
+  return mat->m00 + mat->m11;
+}
+
+T
+F(2, get_det) (M(2) *mat)
+{
+  return DET4(mat->m00, mat->m01, mat->m10, mat->m11);
+}
+
+void
+F(2, get_cof) (M(2) *mat,
+               M(2) *r)
+{
+  r->m00 =    mat->m11;
+  r->m01 = -mat->m10;
+  r->m10 = -mat->m01;
+  r->m11 =    mat->m00;
+}
+
+void
+F(2, get_adj) (M(2) *mat,
+               M(2) *r)
+{
+  F(2, get_cof) (mat, r);
+  F(2, transpose_self) (r);
+}
+
+void
+F(2, neg) (M(2) *a,
+           M(2) *r)
+{
+  r->m00 = -a->m00;
+  r->m01 = -a->m01;
+  r->m10 = -a->m10;
+  r->m11 = -a->m11;
+}
+
+void
+F(2, neg_self) (M(2) *a)
+{
+  a->m00 = -a->m00;
+  a->m01 = -a->m01;
+  a->m10 = -a->m10;
+  a->m11 = -a->m11;
+}
+
+void
+F(2, transpose) (M(2) *a,
+                 M(2) *r)
+{
+  r->m00 = a->m00;
+  r->m01 = a->m10;
+  r->m10 = a->m01;
+  r->m11 = a->m11;
+}
+
+void
+F(2, transpose_self) (M(2) *a)
+{
+  T temp;
+
+  temp = a->m01;
+  a->m01 = a->m10;
+  a->m10 = temp;
+}
+
+void
+F(2, inverse) (M(2) *a,
+               M(2) *r)
+{
+  T detinv = 1 / F(2, get_det) (a);
+
+  r->m00 = a->m11 * detinv;
+  r->m11 = a->m00 * detinv;
+  r->m01 = -a->m01 * detinv;
+  r->m10 = -a->m10 * detinv;
+}
+
+void
+F(2, inverse_self) (M(2) *a)
+{
+  T detinv = 1 / F(2, get_det) (a);
+
+  T temp;
+
+  temp = a->m00 * detinv;
+  a->m00 = a->m11 * detinv;
+  a->m11 = temp;
+
+  a->m01 *= -detinv;
+  a->m10 *= -detinv;
+}
+
+gboolean
+F(2, try_inverse) (M(2) *a,
+                   M(2) *r)
+{
+  T det = F(2, get_det) (a);
+
+  if (det != 0)
+    {
+      T detinv = 1 / det;
+
+      r->m00 = a->m11 * detinv;
+      r->m11 = a->m00 * detinv;
+      r->m01 = -a->m01 * detinv;
+      r->m10 = -a->m10 * detinv;
+
+      return TRUE;
+    }
+  else
+    return FALSE;
+}
+
+gboolean
+F(2, try_inverse_self) (M(2) *a)
+{
+  T det = F(2, get_det) (a);
+
+  if (det != 0)
+    {
+      T detinv = 1 / det;
+
+      T temp;
+
+      temp = a->m00 * detinv;
+      a->m00 = a->m11 * detinv;
+      a->m11 = temp;
+
+      a->m01 *= -detinv;
+      a->m10 *= -detinv;
+
+      return TRUE;
+    }
+  else
+    return FALSE;
+}
+
+void
+F(2, muls) (M(2)    *a,
+            const T  b,
+            M(2)    *r)
+{
+  g_return_if_fail (a != r);
+
+  r->m00 = a->m00 * b;
+  r->m01 = a->m01 * b;
+  r->m10 = a->m10 * b;
+  r->m11 = a->m11 * b;
+}
+
+void
+F(2, muls_self) (M(2)    *a,
+                 const T  b)
+{
+  a->m00 *= b;
+  a->m01 *= b;
+  a->m10 *= b;
+  a->m11 *= b;
+}
+
+void
+F(2, mulv) (M(2) *a,
+            V(2) *b,
+            V(2) *r)
+{
+  T nx;
+  T ny;
+
+  g_return_if_fail (b != r);
+
+  nx = a->m00 * b->x + a->m01 * b->y;
+  ny = a->m10 * b->x + a->m11 * b->y;
+
+  r->x = nx;
+  r->y = ny;
+}
+
+void
+F(2, mul) (M(2) *a,
+           M(2) *b,
+           M(2) *r)
+{
+  M(2) nr;
+
+  g_return_if_fail (a != r);
+  g_return_if_fail (b != r);
+
+  nr.m00 = (a->m00 * b->m00) + (a->m01 * b->m10);
+  nr.m01 = (a->m00 * b->m01) + (a->m01 * b->m11);
+  nr.m10 = (a->m10 * b->m00) + (a->m11 * b->m10);
+  nr.m11 = (a->m10 * b->m01) + (a->m11 * b->m11);
+
+  F(2, init_arr) (r, (T*)&nr);
+}
+
+void
+F(2, mul_self) (M(2) *a,
+                M(2) *b)
+{
+  M(2) nr;
+
+  nr.m00 = (a->m00 * b->m00) + (a->m01 * b->m10);
+  nr.m01 = (a->m00 * b->m01) + (a->m01 * b->m11);
+  nr.m10 = (a->m10 * b->m00) + (a->m11 * b->m10);
+  nr.m11 = (a->m10 * b->m01) + (a->m11 * b->m11);
+
+  F(2, copy) (&nr, a);
+}
+
+void
+F(2, divs) (M(2)    *a,
+            const T  b,
+            M(2)    *r)
+{
+  g_return_if_fail (a != r);
+
+  r->m00 = a->m00 / b;
+  r->m01 = a->m01 / b;
+  r->m10 = a->m10 / b;
+  r->m11 = a->m11 / b;
+}
+
+void
+F(2, divs_self) (M(2)    *a,
+                 const T  b)
+{
+  a->m00 /= b;
+  a->m01 /= b;
+  a->m10 /= b;
+  a->m11 /= b;
+}
+
+
+void
+F(2, add) (M(2) *a,
+           M(2) *b,
+           M(2) *r)
+{
+  g_return_if_fail (a != r);
+  g_return_if_fail (b != r);
+
+  r->m00 = a->m00 + b->m00;
+  r->m01 = a->m01 + b->m01;
+  r->m10 = a->m10 + b->m10;
+  r->m11 = a->m11 + b->m11;
+}
+
+void
+F(2, add_self) (M(2) *a,
+                M(2) *b)
+{
+  a->m00 += b->m00;
+  a->m01 += b->m01;
+  a->m10 += b->m10;
+  a->m11 += b->m11;
+}
+
+
+void
+F(2, sub) (M(2) *a,
+           M(2) *b,
+           M(2) *r)
+{
+  g_return_if_fail (a != r);
+  g_return_if_fail (b != r);
+
+  r->m00 = a->m00 - b->m00;
+  r->m01 = a->m01 - b->m01;
+  r->m10 = a->m10 - b->m10;
+  r->m11 = a->m11 - b->m11;
+}
+void
+F(2, sub_self) (M(2) *a,
+                M(2) *b)
+{
+  a->m00 -= b->m00;
+  a->m01 -= b->m01;
+  a->m10 -= b->m10;
+  a->m11 -= b->m11;
+}
+
+void
+F(2, mixs) (M(2)    *a,
+            M(2)    *b,
+            const T  c,
+            M(2)    *r)
+{
+  T d;
+
+  g_return_if_fail (a != r);
+  g_return_if_fail (b != r);
+
+
+  d = 1 - c;
+
+  r->m00 = (a->m00 * d) + (b->m00 * c);
+  r->m01 = (a->m01 * d) + (b->m01 * c);
+  r->m10 = (a->m10 * d) + (b->m10 * c);
+  r->m11 = (a->m11 * d) + (b->m11 * c);
+}
+
+void
+F(2, mix) (M(2) *a,
+           M(2) *b,
+           M(2) *c,
+           M(2) *r)
+{
+  g_return_if_fail (a != r);
+  g_return_if_fail (b != r);
+  g_return_if_fail (c != r);
+
+  r->m00 = (a->m00 * (1 - c->m00)) + (b->m00 * c->m00);
+  r->m01 = (a->m01 * (1 - c->m01)) + (b->m01 * c->m01);
+  r->m10 = (a->m10 * (1 - c->m10)) + (b->m10 * c->m10);
+  r->m11 = (a->m11 * (1 - c->m11)) + (b->m11 * c->m11);
+}
+
+//////// GValue Transformation /////////////////////////////////////////////////
+
+static void
+F(2, transform_to_string) (const GValue *src,
+                           GValue       *dest)
+{
+  M(2) *mat = (M(2)*) g_value_get_boxed (src);
+  gchar *str = F(2, to_string) (mat);
+  g_value_take_string (dest, str);
+}
+
+
+static void F(3, transform_to_string) (const GValue *src,
+                                       GValue       *dest);
+
+G_DEFINE_BOXED_TYPE_WITH_CODE (
+  M(3),
+  CRANK_MAT_SYM(3),
+  F(3, dup),
+  g_free,
+  {
+    g_value_register_transform_func (
+      g_define_type_id,
+      G_TYPE_STRING,
+      F(3, transform_to_string));
+  })
+
+void
+F(3, init) (M(3)    *mat,
+            const T  m00,
+            const T  m01,
+            const T  m02,
+            const T  m10,
+            const T  m11,
+            const T  m12,
+            const T  m20,
+            const T  m21,
+            const T  m22)
+{
+  mat->m00 = m00;
+  mat->m01 = m01;
+  mat->m02 = m02;
+  mat->m10 = m10;
+  mat->m11 = m11;
+  mat->m12 = m12;
+  mat->m20 = m20;
+  mat->m21 = m21;
+  mat->m22 = m22;
+}
+
+void
+F(3, init_arr) (M(3)    *mat,
+                const T *marr)
+{
+  memcpy (mat, marr, sizeof(T) * 9);
+}
+
+void
+F(3, init_row) (M(3) *mat,
+                V(3) *row0,
+                V(3) *row1,
+                V(3) *row2)
+{
+  FV(3, init_arr) ((V(3)*)mat,       (T*)row0);
+  FV(3, init_arr) (((V(3)*)mat) + 1, (T*)row1);
+  FV(3, init_arr) (((V(3)*)mat) + 2, (T*)row2);
+}
+
+void
+F(3, init_row_arr) (M(3) *mat,
+                    V(3) *row_arr)
+{
+  F(3, init_row) (mat, row_arr, row_arr + 1, row_arr + 2);
+}
+
+void
+F(3, init_row_parr) (M(3)  *mat,
+                     V(3) **row_parr)
+{
+  F(3, init_row) (mat, row_parr[0], row_parr[1], row_parr[2]);
+}
+
+
+void
+F(3, init_col) (M(3) *mat,
+                V(3) *col0,
+                V(3) *col1,
+                V(3) *col2)
+{
+  mat->m00 = col0->x;
+  mat->m01 = col1->x;
+  mat->m02 = col2->x;
+  mat->m10 = col0->y;
+  mat->m11 = col1->y;
+  mat->m12 = col2->y;
+  mat->m20 = col0->z;
+  mat->m21 = col1->z;
+  mat->m22 = col2->z;
+}
+
+void
+F(3, init_col_arr) (M(3) *mat,
+                    V(3) *col_arr)
+{
+  F(3, init_col) (mat, col_arr, col_arr + 1, col_arr + 2);
+}
+
+void
+F(3, init_col_parr) (M(3)  *mat,
+                     V(3) **col_parr)
+{
+  F(3, init_col) (mat, col_parr[0], col_parr[1], col_parr[2]);
+}
+
+void
+F(3, init_diag) (M(3)    *mat,
+                 const T  m00,
+                 const T  m11,
+                 const T  m22)
+{
+  mat->m00 = m00;
+  mat->m01 = 0;
+  mat->m02 = 0;
+  mat->m10 = 0;
+  mat->m11 = m11;
+  mat->m12 = 0;
+  mat->m20 = 0;
+  mat->m21 = 0;
+  mat->m22 = m22;
+}
+
+void
+F(3, init_diag_arr) (M(3)    *mat,
+                     const T *darr)
+{
+  F(3, init_diag) (mat, darr[0], darr[1], darr[2]);
+}
+
+void
+F(3, init_diag_vec) (M(3) *mat,
+                     V(3) *dvec)
+{
+  F(3, init_diag) (mat, dvec->x, dvec->y, dvec->z);
+}
+
+void
+F(3, init_fill) (M(3)    *mat,
+                 const T  fill)
+{
+  mat->m00 = fill;
+  mat->m01 = fill;
+  mat->m02 = fill;
+  mat->m10 = fill;
+  mat->m11 = fill;
+  mat->m12 = fill;
+  mat->m20 = fill;
+  mat->m21 = fill;
+  mat->m22 = fill;
+}
+
+void
+F(3, init_rot) (M(3)    *mat,
+                const T  angle,
+                V(3)    *axis)
+{
+  V(3) uvec;
+  T s, c, c1;
+
+  FV(3, unit) (axis, &uvec);
+
+  s = CRANK_MAT_MATH(sin) (angle);
+  c = CRANK_MAT_MATH(cos) (angle);
+  c1 = 1 - c;
+
+  mat->m00 = uvec.x * uvec.x * c1 + c;
+  mat->m01 = uvec.x * uvec.y * c1 - uvec.z * s;
+  mat->m02 = uvec.x * uvec.z * c1 + uvec.y * s;
+
+  mat->m10 = uvec.y * uvec.x * c1 + uvec.z * s;
+  mat->m11 = uvec.y * uvec.y * c1 + c;
+  mat->m12 = uvec.y * uvec.z * c1 - uvec.x * s;
+
+  mat->m20 = uvec.z * uvec.x * c1 - uvec.y * s;
+  mat->m21 = uvec.z * uvec.y * c1 + uvec.x * s;
+  mat->m22 = uvec.z * uvec.z * c1 + c;
+}
+
+void
+F(3, init_urot) (M(3)    *mat,
+                 const T  angle,
+                 const T  axis_x,
+                 const T  axis_y,
+                 const T  axis_z)
+{
+  V(3) axis = {axis_x, axis_y, axis_z};
+
+  F(3, init_rot) (mat, angle, &axis);
+}
+
+void
+F(3, copy) (M(3) *mat,
+            M(3) *other)
+{
+  F(3, init_arr) (other, (T*) mat);
+}
+
+M(3)*
+F(3, dup) (M(3) *mat)
+{
+  M(3) *result = g_new (M(3), 1);
+  F(3, copy) (mat, result);
+  return result;
+}
+
+
+//////// Basic Operations //////////////////////////////////////////////////////
+
+guint
+F(3, hash) (gconstpointer a)
+{
+  const M(3) *mat = (const M(3)*)a;
+
+  guint hash = CRANK_MAT_HASH (&(mat->m00));
+  hash = CRANK_MAT_HASH (&(mat->m01)) + hash * 37;
+  hash = CRANK_MAT_HASH (&(mat->m02)) + hash * 37;
+  hash = CRANK_MAT_HASH (&(mat->m10)) + hash * 37;
+  hash = CRANK_MAT_HASH (&(mat->m11)) + hash * 37;
+  hash = CRANK_MAT_HASH (&(mat->m12)) + hash * 37;
+  hash = CRANK_MAT_HASH (&(mat->m20)) + hash * 37;
+  hash = CRANK_MAT_HASH (&(mat->m21)) + hash * 37;
+  hash = CRANK_MAT_HASH (&(mat->m22)) + hash * 37;
+  return hash;
+}
+
+gboolean
+F(3, equal) (gconstpointer a,
+             gconstpointer b)
+{
+  const M(3) *mat_a = (const M(3)*)a;
+  const M(3) *mat_b = (const M(3)*)b;
+
+  return (mat_a->m00 == mat_b->m00) &&
+         (mat_a->m01 == mat_b->m01) &&
+         (mat_a->m02 == mat_b->m02) &&
+         (mat_a->m10 == mat_b->m10) &&
+         (mat_a->m11 == mat_b->m11) &&
+         (mat_a->m12 == mat_b->m12) &&
+         (mat_a->m20 == mat_b->m20) &&
+         (mat_a->m21 == mat_b->m21) &&
+         (mat_a->m22 == mat_b->m22);
+}
+
+gchar*
+F(3, to_string) (M(3) *mat)
+{
+  return F(3, to_string_full) (mat, "[", ", ", "]", "[", ", ", "]", "%g");
+}
+
+gchar*
+F(3, to_string_full) (M(3)        *mat,
+                      const gchar *mat_left,
+                      const gchar *mat_in,
+                      const gchar *mat_right,
+                      const gchar *row_left,
+                      const gchar *row_in,
+                      const gchar *row_right,
+                      const gchar *format)
+{
+  GString *builder;
+  gchar *str;
+
+  builder = g_string_new (mat_left);
+  g_string_append (builder,
+                   FV(3, to_string_full) (((V(3)*)mat) + 0,
+                                          row_left, row_in, row_right,
+                                          format)   );
+
+  g_string_append (builder, mat_in);
+  g_string_append (builder,
+                   FV(3, to_string_full) (((V(3)*)mat) + 1,
+                                          row_left, row_in, row_right,
+                                          format)   );
+
+  g_string_append (builder, mat_in);
+  g_string_append (builder,
+                   FV(3, to_string_full) (((V(3)*)mat) + 2,
+                                          row_left, row_in, row_right,
+                                          format)   );
+
+  g_string_append (builder, mat_right);
+
+  str = builder->str;
+
+  g_string_free (builder, FALSE);
+  return str;
+}
+
+T
+F(3, get) (M(3)        *mat,
+           const guint  i,
+           const guint  j)
+{
+  return ((T*)mat) [(3 * i)  +  j];
+}
+
+void
+F(3, set) (M(3)        *mat,
+           const guint  i,
+           const guint  j,
+           const T      value)
+{
+  ((T*)mat) [(3 * i)  +  j] = value;
+}
+
+void
+F(3, get_row) (M(3)        *mat,
+               const guint  index,
+               V(3)        *row)
+{
+  FV(3, init_arr) (row, ((T*)mat) + 3 * index);
+}
+
+void
+F(3, set_row) (M(3)        *mat,
+               const guint  index,
+               V(3)        *row)
+{
+  FV(3, init_arr) (((V(3)*)mat) + index, (T*)row);
+}
+
+
+void
+F(3, get_col) (M(3)        *mat,
+               const guint  index,
+               V(3)        *col)
+{
+  T *ptr = ((T*)mat) + index;
+  col->x = ptr[0];
+  col->y = ptr[3];
+  col->z = ptr[6];
+}
+
+void
+F(3, set_col) (M(3)        *mat,
+               const guint  index,
+               V(3)        *col)
+{
+  T *ptr = ((T*)mat) + index;
+  ptr[0] = col->x;
+  ptr[3] = col->y;
+  ptr[6] = col->z;
+}
+
+T
+F(3, get_tr) (M(3) *mat)
+{
+  return mat->m00 + mat->m11 + mat->m22;
+}
+
+T
+F(3, get_det) (M(3) *mat)
+{
+  return (mat->m00 * DET4(mat->m11, mat->m12, mat->m21, mat->m22)) -
+         (mat->m01 * DET4(mat->m10, mat->m12, mat->m20, mat->m22)) +
+         (mat->m02 * DET4(mat->m10, mat->m11, mat->m20, mat->m21));
+}
+
+void
+F(3, get_cof) (M(3) *mat,
+               M(3) *r)
+{
+  r->m00 =  DET4(mat->m11, mat->m12, mat->m21, mat->m22);
+  r->m01 = -DET4(mat->m10, mat->m12, mat->m20, mat->m22);
+  r->m02 =  DET4(mat->m10, mat->m11, mat->m20, mat->m21);
+
+  r->m10 = -DET4(mat->m01, mat->m02, mat->m21, mat->m22);
+  r->m11 =  DET4(mat->m00, mat->m02, mat->m20, mat->m22);
+  r->m12 = -DET4(mat->m00, mat->m01, mat->m20, mat->m21);
+
+  r->m20 =  DET4(mat->m01, mat->m02, mat->m11, mat->m12);
+  r->m21 = -DET4(mat->m00, mat->m02, mat->m10, mat->m12);
+  r->m22 =  DET4(mat->m00, mat->m01, mat->m10, mat->m11);
+}
+
+void
+F(3, get_adj) (M(3) *mat,
+               M(3) *r)
+{
+  F(3, get_cof) (mat, r);
+  F(3, transpose_self) (r);
+}
+
+
+T
+F(3, get_rangle) (M(3) *mat)
+{
+  V(3) a;
+  T t;
+
+  a.x = mat->m21 - mat->m12;
+  a.y = mat->m02 - mat->m20;
+  a.z = mat->m10 - mat->m01;
+  t = mat->m00 + mat->m11 + mat->m22 - 1;
+
+  return CRANK_MAT_MATH(atan2) (FV(3, get_magn) (&a), t);
+}
+
+void
+F(3, get_raxis) (M(3) *mat,
+                 V(3) *axis)
+{
+  V(3) a;
+
+  a.x = mat->m21 - mat->m12;
+  a.y = mat->m02 - mat->m20;
+  a.z = mat->m10 - mat->m01;
+
+  FV(3, unit) (&a, axis);
+}
+
+
+void
+F(3, neg) (M(3) *a,
+           M(3) *r)
+{
+  r->m00 = -a->m00;
+  r->m01 = -a->m01;
+  r->m02 = -a->m02;
+  r->m10 = -a->m10;
+  r->m11 = -a->m11;
+  r->m12 = -a->m12;
+  r->m20 = -a->m20;
+  r->m21 = -a->m21;
+  r->m22 = -a->m22;
+}
+
+void
+F(3, neg_self) (M(3) *a)
+{
+  a->m00 = -a->m00;
+  a->m01 = -a->m01;
+  a->m02 = -a->m02;
+  a->m10 = -a->m10;
+  a->m11 = -a->m11;
+  a->m12 = -a->m12;
+  a->m20 = -a->m20;
+  a->m21 = -a->m21;
+  a->m22 = -a->m22;
+}
+
+void
+F(3, transpose) (M(3) *a,
+                 M(3) *r)
+{
+  r->m00 = a->m00;
+  r->m01 = a->m10;
+  r->m02 = a->m20;
+  r->m10 = a->m01;
+  r->m11 = a->m11;
+  r->m12 = a->m21;
+  r->m20 = a->m02;
+  r->m21 = a->m12;
+  r->m22 = a->m22;
+}
+
+void
+F(3, transpose_self) (M(3) *a)
+{
+  T temp;
+
+  temp = a->m01;
+  a->m01 = a->m10;
+  a->m10 = temp;
+
+  temp = a->m02;
+  a->m02 = a->m20;
+  a->m20 = temp;
+
+  temp = a->m12;
+  a->m12 = a->m21;
+  a->m21 = temp;
+}
+
+void
+F(3, inverse) (M(3) *a,
+               M(3) *r)
+{
+  M(3) adj;
+  T det = F(3, get_det) (a);
+
+  F(3, get_adj) (a, &adj);
+  F(3, divs) (&adj, det, r);
+}
+
+void
+F(3, inverse_self) (M(3) *a)
+{
+  M(3) adj;
+  T det = F(3, get_det) (a);
+
+  F(3, get_adj) (a, &adj);
+  F(3, divs) (&adj, det, a);
+}
+
+gboolean
+F(3, try_inverse) (M(3) *a,
+                   M(3) *r)
+{
+  M(3) adj;
+  T det = F(3, get_det) (a);
+
+  if (det != 0)
+    {
+      F(3, get_adj) (a, &adj);
+      F(3, divs) (&adj, det, r);
+
+      return TRUE;
+    }
+  else
+    return FALSE;
+}
+
+gboolean
+F(3, try_inverse_self) (M(3) *a)
+{
+  M(3) adj;
+  T det = F(3, get_det) (a);
+
+  if (det != 0)
+    {
+      F(3, get_adj) (a, &adj);
+      F(3, divs) (&adj, det, a);
+
+      return TRUE;
+    }
+  else
+    return FALSE;
+}
+
+
+void
+F(3, muls) (M(3)    *a,
+            const T  b,
+            M(3)    *r)
+{
+  g_return_if_fail (a != r);
+
+  r->m00 = a->m00 * b;
+  r->m01 = a->m01 * b;
+  r->m02 = a->m02 * b;
+  r->m10 = a->m10 * b;
+  r->m11 = a->m11 * b;
+  r->m12 = a->m12 * b;
+  r->m20 = a->m20 * b;
+  r->m21 = a->m21 * b;
+  r->m22 = a->m22 * b;
+}
+
+void
+F(3, muls_self) (M(3)    *a,
+                 const T  b)
+{
+  a->m00 *= b;
+  a->m01 *= b;
+  a->m02 *= b;
+  a->m10 *= b;
+  a->m11 *= b;
+  a->m12 *= b;
+  a->m20 *= b;
+  a->m21 *= b;
+  a->m22 *= b;
+}
+
+void
+F(3, mulv) (M(3) *a,
+            V(3) *b,
+            V(3) *r)
+{
+  T nx;
+  T ny;
+  T nz;
+
+  g_return_if_fail (b != r);
+
+  nx = (a->m00 * b->x) + (a->m01 * b->y) + (a->m02 * b->z);
+  ny = (a->m10 * b->x) + (a->m11 * b->y) + (a->m12 * b->z);
+  nz = (a->m20 * b->x) + (a->m21 * b->y) + (a->m22 * b->z);
+
+  r->x = nx;
+  r->y = ny;
+  r->z = nz;
+}
+
+void
+F(3, mul) (M(3) *a,
+           M(3) *b,
+           M(3) *r)
+{
+  M(3) nr;
+
+  g_return_if_fail (a != r);
+  g_return_if_fail (b != r);
+
+  nr.m00 = (a->m00 * b->m00) + (a->m01 * b->m10) + (a->m02 * b->m20);
+  nr.m01 = (a->m00 * b->m01) + (a->m01 * b->m11) + (a->m02 * b->m21);
+  nr.m02 = (a->m00 * b->m02) + (a->m01 * b->m12) + (a->m02 * b->m22);
+
+  nr.m10 = (a->m10 * b->m00) + (a->m11 * b->m10) + (a->m12 * b->m20);
+  nr.m11 = (a->m10 * b->m01) + (a->m11 * b->m11) + (a->m12 * b->m21);
+  nr.m12 = (a->m10 * b->m02) + (a->m11 * b->m12) + (a->m12 * b->m22);
+
+  nr.m20 = (a->m20 * b->m00) + (a->m21 * b->m10) + (a->m22 * b->m20);
+  nr.m21 = (a->m20 * b->m01) + (a->m21 * b->m11) + (a->m22 * b->m21);
+  nr.m22 = (a->m20 * b->m02) + (a->m21 * b->m12) + (a->m22 * b->m22);
+
+  F(3, copy) (&nr, r);
+}
+
+void
+F(3, mul_self) (M(3) *a,
+                M(3) *b)
+{
+  M(3) nr;
+
+  nr.m00 = (a->m00 * b->m00) + (a->m01 * b->m10) + (a->m02 * b->m20);
+  nr.m01 = (a->m00 * b->m01) + (a->m01 * b->m11) + (a->m02 * b->m21);
+  nr.m02 = (a->m00 * b->m02) + (a->m01 * b->m12) + (a->m02 * b->m22);
+
+  nr.m10 = (a->m10 * b->m00) + (a->m11 * b->m10) + (a->m12 * b->m20);
+  nr.m11 = (a->m10 * b->m01) + (a->m11 * b->m11) + (a->m12 * b->m21);
+  nr.m12 = (a->m10 * b->m02) + (a->m11 * b->m12) + (a->m12 * b->m22);
+
+  nr.m20 = (a->m20 * b->m00) + (a->m21 * b->m10) + (a->m22 * b->m20);
+  nr.m21 = (a->m20 * b->m01) + (a->m21 * b->m11) + (a->m22 * b->m21);
+  nr.m22 = (a->m20 * b->m02) + (a->m21 * b->m12) + (a->m22 * b->m22);
+
+  F(3, copy) (&nr, a);
+}
+
+void
+F(3, divs) (M(3)    *a,
+            const T  b,
+            M(3)    *r)
+{
+  g_return_if_fail (a != r);
+
+  r->m00 = a->m00 / b;
+  r->m01 = a->m01 / b;
+  r->m02 = a->m02 / b;
+  r->m10 = a->m10 / b;
+  r->m11 = a->m11 / b;
+  r->m12 = a->m12 / b;
+  r->m20 = a->m20 / b;
+  r->m21 = a->m21 / b;
+  r->m22 = a->m22 / b;
+}
+
+void
+F(3, divs_self) (M(3)    *a,
+                 const T  b)
+{
+  a->m00 /= b;
+  a->m01 /= b;
+  a->m02 /= b;
+  a->m10 /= b;
+  a->m11 /= b;
+  a->m12 /= b;
+  a->m20 /= b;
+  a->m21 /= b;
+  a->m22 /= b;
+}
+
+
+void
+F(3, add) (M(3) *a,
+           M(3) *b,
+           M(3) *r)
+{
+  g_return_if_fail (a != r);
+  g_return_if_fail (b != r);
+
+  r->m00 = a->m00 + b->m00;
+  r->m01 = a->m01 + b->m01;
+  r->m02 = a->m02 + b->m02;
+  r->m10 = a->m10 + b->m10;
+  r->m11 = a->m11 + b->m11;
+  r->m12 = a->m12 + b->m12;
+  r->m20 = a->m20 + b->m20;
+  r->m21 = a->m21 + b->m21;
+  r->m22 = a->m22 + b->m22;
+}
+
+void
+F(3, add_self) (M(3) *a,
+                M(3) *b)
+{
+  a->m00 += b->m00;
+  a->m01 += b->m01;
+  a->m02 += b->m02;
+  a->m10 += b->m10;
+  a->m11 += b->m11;
+  a->m12 += b->m12;
+  a->m20 += b->m20;
+  a->m21 += b->m21;
+  a->m22 += b->m22;
+}
+
+void
+F(3, sub) (M(3) *a,
+           M(3) *b,
+           M(3) *r)
+{
+  g_return_if_fail (a != r);
+  g_return_if_fail (b != r);
+
+  r->m00 = a->m00 - b->m00;
+  r->m01 = a->m01 - b->m01;
+  r->m02 = a->m02 - b->m02;
+  r->m10 = a->m10 - b->m10;
+  r->m11 = a->m11 - b->m11;
+  r->m12 = a->m12 - b->m12;
+  r->m20 = a->m20 - b->m20;
+  r->m21 = a->m21 - b->m21;
+  r->m22 = a->m22 - b->m22;
+}
+
+void
+F(3, sub_self) (M(3) *a,
+                M(3) *b)
+{
+  a->m00 -= b->m00;
+  a->m01 -= b->m01;
+  a->m02 -= b->m02;
+  a->m10 -= b->m10;
+  a->m11 -= b->m11;
+  a->m12 -= b->m12;
+  a->m20 -= b->m20;
+  a->m21 -= b->m21;
+  a->m22 -= b->m22;
+}
+
+
+void
+F(3, mixs) (M(3)    *a,
+            M(3)    *b,
+            const T  c,
+            M(3)    *r)
+{
+  T d;
+
+  g_return_if_fail (a != r);
+  g_return_if_fail (b != r);
+
+  d = 1 - c;
+
+  r->m00 = (a->m00 * d) + (b->m00 * c);
+  r->m01 = (a->m01 * d) + (b->m01 * c);
+  r->m02 = (a->m02 * d) + (b->m02 * c);
+  r->m10 = (a->m10 * d) + (b->m10 * c);
+  r->m11 = (a->m11 * d) + (b->m11 * c);
+  r->m12 = (a->m12 * d) + (b->m12 * c);
+  r->m20 = (a->m20 * d) + (b->m20 * c);
+  r->m21 = (a->m21 * d) + (b->m21 * c);
+  r->m22 = (a->m22 * d) + (b->m22 * c);
+}
+
+void
+F(3, mix) (M(3) *a,
+           M(3) *b,
+           M(3) *c,
+           M(3) *r)
+{
+  g_return_if_fail (a != r);
+  g_return_if_fail (b != r);
+  g_return_if_fail (c != r);
+
+  r->m00 = (a->m00 * (1 - c->m00)) + (b->m00 * c->m00);
+  r->m01 = (a->m01 * (1 - c->m01)) + (b->m01 * c->m01);
+  r->m02 = (a->m02 * (1 - c->m02)) + (b->m02 * c->m02);
+  r->m10 = (a->m10 * (1 - c->m10)) + (b->m10 * c->m10);
+  r->m11 = (a->m11 * (1 - c->m11)) + (b->m11 * c->m11);
+  r->m12 = (a->m12 * (1 - c->m12)) + (b->m12 * c->m12);
+  r->m20 = (a->m20 * (1 - c->m20)) + (b->m20 * c->m20);
+  r->m21 = (a->m21 * (1 - c->m21)) + (b->m21 * c->m21);
+  r->m22 = (a->m22 * (1 - c->m22)) + (b->m22 * c->m22);
+}
+
+//////// GValue Transformation /////////////////////////////////////////////////
+
+static void
+F(3, transform_to_string) (const GValue *src,
+                           GValue       *dest)
+{
+  M(3) *mat = (M(3)*) g_value_get_boxed (src);
+  gchar *str = F(3, to_string) (mat);
+  g_value_take_string (dest, str);
+}
+
+
+static void F(4, transform_to_string) (const GValue *src,
+                                       GValue       *dest);
+
+G_DEFINE_BOXED_TYPE_WITH_CODE (
+  M(4),
+  CRANK_MAT_SYM(4),
+  F(4, dup),
+  g_free,
+  {
+    g_value_register_transform_func (
+      g_define_type_id,
+      G_TYPE_STRING,
+      F(4, transform_to_string));
+  })
+
+void
+F(4, init) (M(4)    *mat,
+            const T  m00,
+            const T  m01,
+            const T  m02,
+            const T  m03,
+            const T  m10,
+            const T  m11,
+            const T  m12,
+            const T  m13,
+            const T  m20,
+            const T  m21,
+            const T  m22,
+            const T  m23,
+            const T  m30,
+            const T  m31,
+            const T  m32,
+            const T  m33)
+{
+  mat->m00 = m00;
+  mat->m01 = m01;
+  mat->m02 = m02;
+  mat->m03 = m03;
+  mat->m10 = m10;
+  mat->m11 = m11;
+  mat->m12 = m12;
+  mat->m13 = m13;
+  mat->m20 = m20;
+  mat->m21 = m21;
+  mat->m22 = m22;
+  mat->m23 = m23;
+  mat->m30 = m30;
+  mat->m31 = m31;
+  mat->m32 = m32;
+  mat->m33 = m33;
+}
+
+void
+F(4, init_arr) (M(4)    *mat,
+                const T *marr)
+{
+  memcpy (mat, marr, sizeof(T) * 16);
+}
+
+void
+F(4, init_row) (M(4) *mat,
+                V(4) *row0,
+                V(4) *row1,
+                V(4) *row2,
+                V(4) *row3)
+{
+  FV(4, init_arr) ((V(4)*)mat,       (T*)row0);
+  FV(4, init_arr) (((V(4)*)mat) + 1, (T*)row1);
+  FV(4, init_arr) (((V(4)*)mat) + 2, (T*)row2);
+  FV(4, init_arr) (((V(4)*)mat) + 3, (T*)row3);
+}
+
+void
+F(4, init_row_arr) (M(4) *mat,
+                    V(4) *row_arr)
+{
+  F(4, init_row) (mat, row_arr, row_arr + 1, row_arr + 2, row_arr +
+                  3);
+}
+
+void
+F(4, init_row_parr) (M(4)  *mat,
+                     V(4) **row_parr)
+{
+  F(4, init_row) (mat,
+                  row_parr[0],
+                  row_parr[1],
+                  row_parr[2],
+                  row_parr[3]);
+}
+
+void
+F(4, init_col) (M(4) *mat,
+                V(4) *col0,
+                V(4) *col1,
+                V(4) *col2,
+                V(4) *col3)
+{
+  mat->m00 = col0->x;
+  mat->m01 = col1->x;
+  mat->m02 = col2->x;
+  mat->m03 = col3->x;
+  mat->m10 = col0->y;
+  mat->m11 = col1->y;
+  mat->m12 = col2->y;
+  mat->m13 = col3->y;
+  mat->m20 = col0->z;
+  mat->m21 = col1->z;
+  mat->m22 = col2->z;
+  mat->m23 = col3->z;
+  mat->m30 = col0->w;
+  mat->m31 = col1->w;
+  mat->m32 = col2->w;
+  mat->m33 = col3->w;
+}
+
+void
+F(4, init_col_arr) (M(4) *mat,
+                    V(4) *col_arr)
+{
+  F(4, init_col) (mat, col_arr, col_arr + 1, col_arr + 2, col_arr +
+                  3);
+}
+
+
+void
+F(4, init_col_parr) (M(4)  *mat,
+                     V(4) **col_parr)
+{
+  F(4, init_col) (mat,
+                  col_parr[0],
+                  col_parr[1],
+                  col_parr[2],
+                  col_parr[3]);
+}
+
+void
+F(4, init_diag) (M(4)    *mat,
+                 const T  m00,
+                 const T  m11,
+                 const T  m22,
+                 const T  m33)
+{
+  mat->m00 = m00;
+  mat->m01 = 0;
+  mat->m02 = 0;
+  mat->m03 = 0;
+  mat->m10 = 0;
+  mat->m11 = m11;
+  mat->m12 = 0;
+  mat->m13 = 0;
+  mat->m20 = 0;
+  mat->m21 = 0;
+  mat->m22 = m22;
+  mat->m23 = 0;
+  mat->m30 = 0;
+  mat->m31 = 0;
+  mat->m32 = 0;
+  mat->m33 = m33;
+}
+
+void
+F(4, init_diag_arr) (M(4)    *mat,
+                     const T *darr)
+{
+  F(4, init_diag) (mat, darr[0], darr[1], darr[2], darr[3]);
+}
+
+void
+F(4, init_diag_vec) (M(4) *mat,
+                     V(4) *dvec)
+{
+  F(4, init_diag) (mat, dvec->x, dvec->y, dvec->z, dvec->w);
+}
+
+void
+F(4, init_fill) (M(4)    *mat,
+                 const T  fill)
+{
+  mat->m00 = fill;
+  mat->m01 = fill;
+  mat->m02 = fill;
+  mat->m03 = fill;
+  mat->m10 = fill;
+  mat->m11 = fill;
+  mat->m12 = fill;
+  mat->m13 = fill;
+  mat->m20 = fill;
+  mat->m21 = fill;
+  mat->m22 = fill;
+  mat->m23 = fill;
+  mat->m30 = fill;
+  mat->m31 = fill;
+  mat->m32 = fill;
+  mat->m33 = fill;
+}
+
+void
+F(4, init_rot) (M(4)    *mat,
+                const T  angle,
+                V(3)    *axis)
+{
+  V(3) uvec;
+  T s, c, c1;
+
+  FV(3, unit) (axis, &uvec);
+
+  s = CRANK_MAT_MATH(sin) (angle);
+  c = CRANK_MAT_MATH(cos) (angle);
+  c1 = 1 - c;
+
+  mat->m00 = uvec.x * uvec.x * c1 + c;
+  mat->m01 = uvec.x * uvec.y * c1 - uvec.z * s;
+  mat->m02 = uvec.x * uvec.z * c1 + uvec.y * s;
+  mat->m03 = 0;
+
+  mat->m10 = uvec.y * uvec.x * c1 + uvec.z * s;
+  mat->m11 = uvec.y * uvec.y * c1 + c;
+  mat->m12 = uvec.y * uvec.z * c1 - uvec.x * s;
+  mat->m13 = 0;
+
+  mat->m20 = uvec.z * uvec.x * c1 - uvec.y * s;
+  mat->m21 = uvec.z * uvec.y * c1 + uvec.x * s;
+  mat->m22 = uvec.z * uvec.z * c1 + c;
+  mat->m23 = 0;
+
+  mat->m30 = 0;
+  mat->m31 = 0;
+  mat->m32 = 0;
+  mat->m33 = 1;
+}
+
+void
+F(4, init_urot) (M(4)    *mat,
+                 const T  angle,
+                 const T  axis_x,
+                 const T  axis_y,
+                 const T  axis_z)
+{
+  V(3) axis = {axis_x, axis_y, axis_z};
+
+  F(4, init_rot) (mat, angle, &axis);
+}
+
+
+void
+F(4, copy) (M(4) *mat,
+            M(4) *other)
+{
+  F(4, init_arr) (other, (T*) mat);
+}
+
+M(4)*
+F(4, dup) (M(4) *mat)
+{
+  M(4) *result = g_new (M(4), 1);
+  F(4, copy) (mat, result);
+  return result;
+}
+
+
+//////// Basic Operations //////////////////////////////////////////////////////
+
+guint
+F(4, hash) (gconstpointer a)
+{
+  const M(4) *mat = (const M(4)*)a;
+
+  guint hash;
+  hash = CRANK_MAT_HASH (&(mat->m00));
+  hash = CRANK_MAT_HASH (&(mat->m01)) + hash * 37;
+  hash = CRANK_MAT_HASH (&(mat->m02)) + hash * 37;
+  hash = CRANK_MAT_HASH (&(mat->m03)) + hash * 37;
+  hash = CRANK_MAT_HASH (&(mat->m10)) + hash * 37;
+  hash = CRANK_MAT_HASH (&(mat->m11)) + hash * 37;
+  hash = CRANK_MAT_HASH (&(mat->m12)) + hash * 37;
+  hash = CRANK_MAT_HASH (&(mat->m13)) + hash * 37;
+  hash = CRANK_MAT_HASH (&(mat->m20)) + hash * 37;
+  hash = CRANK_MAT_HASH (&(mat->m21)) + hash * 37;
+  hash = CRANK_MAT_HASH (&(mat->m22)) + hash * 37;
+  hash = CRANK_MAT_HASH (&(mat->m23)) + hash * 37;
+  hash = CRANK_MAT_HASH (&(mat->m30)) + hash * 37;
+  hash = CRANK_MAT_HASH (&(mat->m31)) + hash * 37;
+  hash = CRANK_MAT_HASH (&(mat->m32)) + hash * 37;
+  hash = CRANK_MAT_HASH (&(mat->m33)) + hash * 37;
+  return hash;
+}
+
+gboolean
+F(4, equal) (gconstpointer a,
+             gconstpointer b)
+{
+  const M(4) *mat_a = (const M(4)*)a;
+  const M(4) *mat_b = (const M(4)*)b;
+
+  return (mat_a->m00 == mat_b->m00) &&
+         (mat_a->m01 == mat_b->m01) &&
+         (mat_a->m02 == mat_b->m02) &&
+         (mat_a->m03 == mat_b->m03) &&
+         (mat_a->m10 == mat_b->m10) &&
+         (mat_a->m11 == mat_b->m11) &&
+         (mat_a->m12 == mat_b->m12) &&
+         (mat_a->m13 == mat_b->m13) &&
+         (mat_a->m20 == mat_b->m20) &&
+         (mat_a->m21 == mat_b->m21) &&
+         (mat_a->m22 == mat_b->m22) &&
+         (mat_a->m23 == mat_b->m23) &&
+         (mat_a->m30 == mat_b->m30) &&
+         (mat_a->m31 == mat_b->m31) &&
+         (mat_a->m32 == mat_b->m32) &&
+         (mat_a->m33 == mat_b->m33);
+}
+
+gchar*
+F(4, to_string) (M(4) *mat)
+{
+  return F(4, to_string_full) (mat, "[", ", ", "]", "[", ", ", "]", "%g");
+}
+
+gchar*
+F(4, to_string_full) (M(4)        *mat,
+                      const gchar *mat_left,
+                      const gchar *mat_in,
+                      const gchar *mat_right,
+                      const gchar *row_left,
+                      const gchar *row_in,
+                      const gchar *row_right,
+                      const gchar *format)
+{
+  GString *builder;
+  gchar *str;
+
+  builder = g_string_new (mat_left);
+  g_string_append (builder,
+                   FV(4, to_string_full) (((V(4)*)mat) + 0,
+                                          row_left, row_in, row_right,
+                                          format)   );
+
+  g_string_append (builder, mat_in);
+  g_string_append (builder,
+                   FV(4, to_string_full) (((V(4)*)mat) + 1,
+                                          row_left, row_in, row_right,
+                                          format)   );
+
+  g_string_append (builder, mat_in);
+  g_string_append (builder,
+                   FV(4, to_string_full) (((V(4)*)mat) + 2,
+                                          row_left, row_in, row_right,
+                                          format)   );
+
+  g_string_append (builder, mat_in);
+  g_string_append (builder,
+                   FV(4, to_string_full) (((V(4)*)mat) + 3,
+                                          row_left, row_in, row_right,
+                                          format)   );
+
+  g_string_append (builder, mat_right);
+
+  str = builder->str;
+
+  g_string_free (builder, FALSE);
+  return str;
+}
+
+T
+F(4, get) (M(4)        *mat,
+           const guint  i,
+           const guint  j)
+{
+  return ((T*)mat) [(4 * i)  +  j];
+}
+
+void
+F(4, set) (M(4)        *mat,
+           const guint  i,
+           const guint  j,
+           const T      value)
+{
+  ((T*)mat) [(4 * i)  +  j] = value;
+}
+
+void
+F(4, get_row) (M(4)        *mat,
+               const guint  index,
+               V(4)        *row)
+{
+  FV(4, init_arr) (row, ((T*)mat) + 4 * index);
+}
+
+void
+F(4, set_row) (M(4)        *mat,
+               const guint  index,
+               V(4)        *row)
+{
+  FV(4, init_arr) (((V(4)*)mat) + index, (T*)row);
+}
+
+
+void
+F(4, get_col) (M(4)        *mat,
+               const guint  index,
+               V(4)        *col)
+{
+  T *ptr = ((T*)mat) + index;
+  col->x = ptr[0];
+  col->y = ptr[4];
+  col->z = ptr[8];
+  col->w = ptr[12];
+}
+
+void
+F(4, set_col) (M(4)        *mat,
+               const guint  index,
+               V(4)        *col)
+{
+  T *ptr = ((T*)mat) + index;
+  ptr[0] = col->x;
+  ptr[4] = col->y;
+  ptr[8] = col->z;
+  ptr[12] = col->w;
+}
+
+T
+F(4, get_tr) (M(4) *mat)
+{
+  return mat->m00 + mat->m11 + mat->m22 + mat->m33;
+}
+
+T
+F(4, get_det) (M(4) *mat)
+{
+  return (DET4(mat->m00, mat->m01, mat->m10, mat->m11) *
+          DET4(mat->m22, mat->m23, mat->m32, mat->m33)) -
+
+         (DET4(mat->m00, mat->m02, mat->m10, mat->m12) *
+          DET4(mat->m21, mat->m23, mat->m31, mat->m33)) +
+
+         (DET4(mat->m00, mat->m03, mat->m10, mat->m13) *
+          DET4(mat->m21, mat->m22, mat->m31, mat->m32)) +
+
+         (DET4(mat->m01, mat->m02, mat->m11, mat->m12) *
+          DET4(mat->m20, mat->m23, mat->m30, mat->m33)) -
+
+         (DET4(mat->m01, mat->m03, mat->m11, mat->m13) *
+          DET4(mat->m20, mat->m22, mat->m30, mat->m32)) +
+
+         (DET4(mat->m02, mat->m03, mat->m12, mat->m13) *
+          DET4(mat->m20, mat->m21, mat->m30, mat->m31));
+}
+
+void
+F(4, get_cof) (M(4) *mat,
+               M(4) *r)
+{
+  T m01_01 = DET4(mat->m00, mat->m01, mat->m10, mat->m11);
+  T m01_02 = DET4(mat->m00, mat->m02, mat->m10, mat->m12);
+  T m01_03 = DET4(mat->m00, mat->m03, mat->m10, mat->m13);
+  T m01_12 = DET4(mat->m01, mat->m02, mat->m11, mat->m12);
+  T m01_13 = DET4(mat->m01, mat->m03, mat->m11, mat->m13);
+  T m01_23 = DET4(mat->m02, mat->m03, mat->m12, mat->m13);
+
+  T m23_01 = DET4(mat->m20, mat->m21, mat->m30, mat->m31);
+  T m23_02 = DET4(mat->m20, mat->m22, mat->m30, mat->m32);
+  T m23_03 = DET4(mat->m20, mat->m23, mat->m30, mat->m33);
+  T m23_12 = DET4(mat->m21, mat->m22, mat->m31, mat->m32);
+  T m23_13 = DET4(mat->m21, mat->m23, mat->m31, mat->m33);
+  T m23_23 = DET4(mat->m22, mat->m23, mat->m32, mat->m33);
+
+  r->m00 =  mat->m11 * m23_23 - mat->m12 * m23_13 + mat->m13 * m23_12;
+  r->m01 = -mat->m10 * m23_23 + mat->m12 * m23_03 - mat->m13 * m23_02;
+  r->m02 =  mat->m10 * m23_13 - mat->m11 * m23_03 + mat->m13 * m23_01;
+  r->m03 = -mat->m10 * m23_12 + mat->m11 * m23_02 - mat->m12 * m23_01;
+
+  r->m10 = -mat->m01 * m23_23 + mat->m02 * m23_13 - mat->m03 * m23_12;
+  r->m11 =  mat->m00 * m23_23 - mat->m02 * m23_03 + mat->m03 * m23_02;
+  r->m12 = -mat->m00 * m23_13 + mat->m01 * m23_03 - mat->m03 * m23_01;
+  r->m13 =  mat->m00 * m23_12 - mat->m01 * m23_02 + mat->m02 * m23_01;
+
+  r->m20 =  m01_12 * mat->m33 - m01_13 * mat->m32 + m01_23 * mat->m31;
+  r->m21 = -m01_02 * mat->m33 + m01_03 * mat->m32 - m01_23 * mat->m30;
+  r->m22 =  m01_01 * mat->m33 - m01_03 * mat->m31 + m01_13 * mat->m30;
+  r->m23 = -m01_01 * mat->m32 + m01_02 * mat->m31 - m01_12 * mat->m30;
+
+  r->m30 = -m01_12 * mat->m23 + m01_13 * mat->m22 - m01_23 * mat->m21;
+  r->m31 =  m01_02 * mat->m23 - m01_03 * mat->m22 + m01_23 * mat->m20;
+  r->m32 = -m01_01 * mat->m23 + m01_03 * mat->m21 - m01_13 * mat->m20;
+  r->m33 =  m01_01 * mat->m22 - m01_02 * mat->m21 + m01_12 * mat->m20;
+}
+
+void
+F(4, get_adj) (M(4) *mat,
+               M(4) *r)
+{
+  F(4, get_cof) (mat, r);
+  F(4, transpose_self) (r);
+}
+
+T
+F(4, get_rangle) (M(4) *mat)
+{
+  V(3) a;
+  T t;
+
+  a.x = mat->m21 - mat->m12;
+  a.y = mat->m02 - mat->m20;
+  a.z = mat->m10 - mat->m01;
+  t = mat->m00 + mat->m11 + mat->m22 - 1;
+
+  return CRANK_MAT_MATH(atan2) (FV(3, get_magn) (&a), t);
+}
+
+void
+F(4, get_raxis) (M(4) *mat,
+                 V(3) *axis)
+{
+  V(3) a;
+
+  a.x = mat->m21 - mat->m12;
+  a.y = mat->m02 - mat->m20;
+  a.z = mat->m10 - mat->m01;
+
+  FV(3, unit) (&a, axis);
+}
+
+void
+F(4, neg) (M(4) *a,
+           M(4) *r)
+{
+  r->m00 = -a->m00;
+  r->m01 = -a->m01;
+  r->m02 = -a->m02;
+  r->m03 = -a->m03;
+  r->m10 = -a->m10;
+  r->m11 = -a->m11;
+  r->m12 = -a->m12;
+  r->m13 = -a->m13;
+  r->m20 = -a->m20;
+  r->m21 = -a->m21;
+  r->m22 = -a->m22;
+  r->m23 = -a->m23;
+  r->m30 = -a->m30;
+  r->m31 = -a->m31;
+  r->m32 = -a->m32;
+  r->m33 = -a->m33;
+}
+
+void
+F(4, neg_self) (M(4) *a)
+{
+  a->m00 = -a->m00;
+  a->m01 = -a->m01;
+  a->m02 = -a->m02;
+  a->m03 = -a->m03;
+  a->m10 = -a->m10;
+  a->m11 = -a->m11;
+  a->m12 = -a->m12;
+  a->m13 = -a->m13;
+  a->m20 = -a->m20;
+  a->m21 = -a->m21;
+  a->m22 = -a->m22;
+  a->m23 = -a->m23;
+  a->m30 = -a->m30;
+  a->m31 = -a->m31;
+  a->m32 = -a->m32;
+  a->m33 = -a->m33;
+}
+
+void
+F(4, transpose) (M(4) *a,
+                 M(4) *r)
+{
+  if (a != r)
+    {
+      r->m00 = a->m00;
+      r->m01 = a->m10;
+      r->m02 = a->m20;
+      r->m03 = a->m30;
+      r->m10 = a->m01;
+      r->m11 = a->m11;
+      r->m12 = a->m21;
+      r->m13 = a->m31;
+      r->m20 = a->m02;
+      r->m21 = a->m12;
+      r->m22 = a->m22;
+      r->m23 = a->m32;
+      r->m30 = a->m03;
+      r->m31 = a->m13;
+      r->m32 = a->m23;
+      r->m33 = a->m33;
+    }
+  else
+    {
+      T temp;
+
+      temp = a->m01;
+      a->m01 = a->m10;
+      a->m10 = temp;
+
+      temp = a->m02;
+      a->m02 = a->m20;
+      a->m20 = temp;
+
+      temp = a->m03;
+      a->m03 = a->m30;
+      a->m30 = temp;
+
+      temp = a->m12;
+      a->m12 = a->m21;
+      a->m21 = temp;
+
+      temp = a->m13;
+      a->m13 = a->m31;
+      a->m31 = temp;
+
+      temp = a->m23;
+      a->m23 = a->m32;
+      a->m32 = temp;
+    }
+}
+
+void
+F(4, transpose_self) (M(4) *a)
+{
+  T temp;
+
+  temp = a->m01;
+  a->m01 = a->m10;
+  a->m10 = temp;
+
+  temp = a->m02;
+  a->m02 = a->m20;
+  a->m20 = temp;
+
+  temp = a->m03;
+  a->m03 = a->m30;
+  a->m30 = temp;
+
+  temp = a->m12;
+  a->m12 = a->m21;
+  a->m21 = temp;
+
+  temp = a->m13;
+  a->m13 = a->m31;
+  a->m31 = temp;
+
+  temp = a->m23;
+  a->m23 = a->m32;
+  a->m32 = temp;
+}
+
+void
+F(4, inverse) (M(4) *a,
+               M(4) *r)
+{
+  M(4) adj;
+  T det = F(4, get_det) (a);
+
+  F(4, get_adj) (a, &adj);
+  F(4, divs) (&adj, det, r);
+}
+
+void
+F(4, inverse_self) (M(4) *a)
+{
+  M(4) adj;
+  T det = F(4, get_det) (a);
+
+  F(4, get_adj) (a, &adj);
+  F(4, divs) (&adj, det, a);
+}
+
+gboolean
+F(4, try_inverse) (M(4) *a,
+                   M(4) *r)
+{
+  M(4) adj;
+  T det = F(4, get_det) (a);
+
+  if (det != 0)
+    {
+      F(4, get_adj) (a, &adj);
+      F(4, divs) (&adj, det, r);
+
+      return TRUE;
+    }
+  else
+    return FALSE;
+}
+
+gboolean
+F(4, try_inverse_self) (M(4) *a)
+{
+  M(4) adj;
+  T det = F(4, get_det) (a);
+
+  if (det != 0)
+    {
+      F(4, get_adj) (a, &adj);
+      F(4, divs) (&adj, det, a);
+
+      return TRUE;
+    }
+  else
+    return FALSE;
+}
+
+
+void
+F(4, muls) (M(4)    *a,
+            const T  b,
+            M(4)    *r)
+{
+  r->m00 = a->m00 * b;
+  r->m01 = a->m01 * b;
+  r->m02 = a->m02 * b;
+  r->m03 = a->m03 * b;
+  r->m10 = a->m10 * b;
+  r->m11 = a->m11 * b;
+  r->m12 = a->m12 * b;
+  r->m13 = a->m13 * b;
+  r->m20 = a->m20 * b;
+  r->m21 = a->m21 * b;
+  r->m22 = a->m22 * b;
+  r->m23 = a->m23 * b;
+  r->m30 = a->m30 * b;
+  r->m31 = a->m31 * b;
+  r->m32 = a->m32 * b;
+  r->m33 = a->m33 * b;
+}
+
+void
+F(4, muls_self) (M(4)    *a,
+                 const T  b)
+{
+  a->m00 *= b;
+  a->m01 *= b;
+  a->m02 *= b;
+  a->m03 *= b;
+  a->m10 *= b;
+  a->m11 *= b;
+  a->m12 *= b;
+  a->m13 *= b;
+  a->m20 *= b;
+  a->m21 *= b;
+  a->m22 *= b;
+  a->m23 *= b;
+  a->m30 *= b;
+  a->m31 *= b;
+  a->m32 *= b;
+  a->m33 *= b;
+}
+
+void
+F(4, mulv) (M(4) *a,
+            V(4) *b,
+            V(4) *r)
+{
+  r->x = (a->m00 * b->x) + (a->m01 * b->y) + (a->m02 * b->z) + (a->m03 * b->w);
+  r->y = (a->m10 * b->x) + (a->m11 * b->y) + (a->m12 * b->z) + (a->m13 * b->w);
+  r->z = (a->m20 * b->x) + (a->m21 * b->y) + (a->m22 * b->z) + (a->m23 * b->w);
+  r->w = (a->m30 * b->x) + (a->m31 * b->y) + (a->m32 * b->z) + (a->m33 * b->w);
+}
+
+void
+F(4, mul) (M(4) *a,
+           M(4) *b,
+           M(4) *r)
+{
+  M(4) nr;
+
+  nr.m00 =
+    (a->m00 * b->m00) + (a->m01 * b->m10) + (a->m02 * b->m20) + (a->m03 * b->m30);
+  nr.m01 =
+    (a->m00 * b->m01) + (a->m01 * b->m11) + (a->m02 * b->m21) + (a->m03 * b->m31);
+  nr.m02 =
+    (a->m00 * b->m02) + (a->m01 * b->m12) + (a->m02 * b->m22) + (a->m03 * b->m32);
+  nr.m03 =
+    (a->m00 * b->m03) + (a->m01 * b->m13) + (a->m02 * b->m23) + (a->m03 * b->m33);
+
+  nr.m10 =
+    (a->m10 * b->m00) + (a->m11 * b->m10) + (a->m12 * b->m20) + (a->m13 * b->m30);
+  nr.m11 =
+    (a->m10 * b->m01) + (a->m11 * b->m11) + (a->m12 * b->m21) + (a->m13 * b->m31);
+  nr.m12 =
+    (a->m10 * b->m02) + (a->m11 * b->m12) + (a->m12 * b->m22) + (a->m13 * b->m32);
+  nr.m13 =
+    (a->m10 * b->m03) + (a->m11 * b->m13) + (a->m12 * b->m23) + (a->m13 * b->m33);
+
+  nr.m20 =
+    (a->m20 * b->m00) + (a->m21 * b->m10) + (a->m22 * b->m20) + (a->m23 * b->m30);
+  nr.m21 =
+    (a->m20 * b->m01) + (a->m21 * b->m11) + (a->m22 * b->m21) + (a->m23 * b->m31);
+  nr.m22 =
+    (a->m20 * b->m02) + (a->m21 * b->m12) + (a->m22 * b->m22) + (a->m23 * b->m32);
+  nr.m23 =
+    (a->m20 * b->m03) + (a->m21 * b->m13) + (a->m22 * b->m23) + (a->m23 * b->m33);
+
+  nr.m30 =
+    (a->m30 * b->m00) + (a->m31 * b->m10) + (a->m32 * b->m20) + (a->m33 * b->m30);
+  nr.m31 =
+    (a->m30 * b->m01) + (a->m31 * b->m11) + (a->m32 * b->m21) + (a->m33 * b->m31);
+  nr.m32 =
+    (a->m30 * b->m02) + (a->m31 * b->m12) + (a->m32 * b->m22) + (a->m33 * b->m32);
+  nr.m33 =
+    (a->m30 * b->m03) + (a->m31 * b->m13) + (a->m32 * b->m23) + (a->m33 * b->m33);
+
+  F(4, copy) (&nr, r);
+}
+
+void
+F(4, mul_self) (M(4) *a,
+                M(4) *b)
+{
+  M(4) nr;
+
+  nr.m00 =
+    (a->m00 *
+     b->m00) + (a->m01 * b->m10) + (a->m02 * b->m20) + (a->m03 * b->m30);
+  nr.m01 =
+    (a->m00 *
+     b->m01) + (a->m01 * b->m11) + (a->m02 * b->m21) + (a->m03 * b->m31);
+  nr.m02 =
+    (a->m00 *
+     b->m02) + (a->m01 * b->m12) + (a->m02 * b->m22) + (a->m03 * b->m32);
+  nr.m03 =
+    (a->m00 *
+     b->m03) + (a->m01 * b->m13) + (a->m02 * b->m23) + (a->m03 * b->m33);
+
+  nr.m10 =
+    (a->m10 *
+     b->m00) + (a->m11 * b->m10) + (a->m12 * b->m20) + (a->m13 * b->m30);
+  nr.m11 =
+    (a->m10 *
+     b->m01) + (a->m11 * b->m11) + (a->m12 * b->m21) + (a->m13 * b->m31);
+  nr.m12 =
+    (a->m10 *
+     b->m02) + (a->m11 * b->m12) + (a->m12 * b->m22) + (a->m13 * b->m32);
+  nr.m13 =
+    (a->m10 *
+     b->m03) + (a->m11 * b->m13) + (a->m12 * b->m23) + (a->m13 * b->m33);
+
+  nr.m20 =
+    (a->m20 *
+     b->m00) + (a->m21 * b->m10) + (a->m22 * b->m20) + (a->m23 * b->m30);
+  nr.m21 =
+    (a->m20 *
+     b->m01) + (a->m21 * b->m11) + (a->m22 * b->m21) + (a->m23 * b->m31);
+  nr.m22 =
+    (a->m20 *
+     b->m02) + (a->m21 * b->m12) + (a->m22 * b->m22) + (a->m23 * b->m32);
+  nr.m23 =
+    (a->m20 *
+     b->m03) + (a->m21 * b->m13) + (a->m22 * b->m23) + (a->m23 * b->m33);
+
+  nr.m30 =
+    (a->m30 *
+     b->m00) + (a->m31 * b->m10) + (a->m32 * b->m20) + (a->m33 * b->m30);
+  nr.m31 =
+    (a->m30 *
+     b->m01) + (a->m31 * b->m11) + (a->m32 * b->m21) + (a->m33 * b->m31);
+  nr.m32 =
+    (a->m30 *
+     b->m02) + (a->m31 * b->m12) + (a->m32 * b->m22) + (a->m33 * b->m32);
+  nr.m33 =
+    (a->m30 *
+     b->m03) + (a->m31 * b->m13) + (a->m32 * b->m23) + (a->m33 * b->m33);
+
+  F(4, copy) (&nr, a);
+}
+
+void
+F(4, divs) (M(4)    *a,
+            const T  b,
+            M(4)    *r)
+{
+  F(4, muls) (a, 1 / b, r);
+}
+
+void
+F(4, divs_self) (M(4)    *a,
+                 const T  b)
+{
+  F(4, muls_self) (a, 1 / b);
+}
+
+void
+F(4, add) (M(4) *a,
+           M(4) *b,
+           M(4) *r)
+{
+  r->m00 = a->m00 + b->m00;
+  r->m01 = a->m01 + b->m01;
+  r->m02 = a->m02 + b->m02;
+  r->m03 = a->m03 + b->m03;
+  r->m10 = a->m10 + b->m10;
+  r->m11 = a->m11 + b->m11;
+  r->m12 = a->m12 + b->m12;
+  r->m13 = a->m13 + b->m13;
+  r->m20 = a->m20 + b->m20;
+  r->m21 = a->m21 + b->m21;
+  r->m22 = a->m22 + b->m22;
+  r->m23 = a->m23 + b->m23;
+  r->m30 = a->m30 + b->m30;
+  r->m31 = a->m31 + b->m31;
+  r->m32 = a->m32 + b->m32;
+  r->m33 = a->m33 + b->m33;
+}
+
+void
+F(4, add_self) (M(4) *a,
+                M(4) *b)
+{
+  a->m00 += b->m00;
+  a->m01 += b->m01;
+  a->m02 += b->m02;
+  a->m03 += b->m03;
+  a->m10 += b->m10;
+  a->m11 += b->m11;
+  a->m12 += b->m12;
+  a->m13 += b->m13;
+  a->m20 += b->m20;
+  a->m21 += b->m21;
+  a->m22 += b->m22;
+  a->m23 += b->m23;
+  a->m30 += b->m30;
+  a->m31 += b->m31;
+  a->m32 += b->m32;
+  a->m33 += b->m33;
+}
+
+void
+F(4, sub) (M(4) *a,
+           M(4) *b,
+           M(4) *r)
+{
+  r->m00 = a->m00 - b->m00;
+  r->m01 = a->m01 - b->m01;
+  r->m02 = a->m02 - b->m02;
+  r->m03 = a->m03 - b->m03;
+  r->m10 = a->m10 - b->m10;
+  r->m11 = a->m11 - b->m11;
+  r->m12 = a->m12 - b->m12;
+  r->m13 = a->m13 - b->m13;
+  r->m20 = a->m20 - b->m20;
+  r->m21 = a->m21 - b->m21;
+  r->m22 = a->m22 - b->m22;
+  r->m23 = a->m23 - b->m23;
+  r->m30 = a->m30 - b->m30;
+  r->m31 = a->m31 - b->m31;
+  r->m32 = a->m32 - b->m32;
+  r->m33 = a->m33 - b->m33;
+}
+
+void
+F(4, sub_self) (M(4) *a,
+                M(4) *b)
+{
+  a->m00 -= b->m00;
+  a->m01 -= b->m01;
+  a->m02 -= b->m02;
+  a->m03 -= b->m03;
+  a->m10 -= b->m10;
+  a->m11 -= b->m11;
+  a->m12 -= b->m12;
+  a->m13 -= b->m13;
+  a->m20 -= b->m20;
+  a->m21 -= b->m21;
+  a->m22 -= b->m22;
+  a->m23 -= b->m23;
+  a->m30 -= b->m30;
+  a->m31 -= b->m31;
+  a->m32 -= b->m32;
+  a->m33 -= b->m33;
+}
+
+
+void
+F(4, mixs) (M(4)    *a,
+            M(4)    *b,
+            const T  c,
+            M(4)    *r)
+{
+  T d = 1 - c;
+
+  r->m00 = (a->m00 * d) + (b->m00 * c);
+  r->m01 = (a->m01 * d) + (b->m01 * c);
+  r->m02 = (a->m02 * d) + (b->m02 * c);
+  r->m03 = (a->m03 * d) + (b->m03 * c);
+  r->m10 = (a->m10 * d) + (b->m10 * c);
+  r->m11 = (a->m11 * d) + (b->m11 * c);
+  r->m12 = (a->m12 * d) + (b->m12 * c);
+  r->m13 = (a->m13 * d) + (b->m13 * c);
+  r->m20 = (a->m20 * d) + (b->m20 * c);
+  r->m21 = (a->m21 * d) + (b->m21 * c);
+  r->m22 = (a->m22 * d) + (b->m22 * c);
+  r->m23 = (a->m23 * d) + (b->m23 * c);
+  r->m30 = (a->m30 * d) + (b->m30 * c);
+  r->m31 = (a->m31 * d) + (b->m31 * c);
+  r->m32 = (a->m32 * d) + (b->m32 * c);
+  r->m33 = (a->m33 * d) + (b->m33 * c);
+}
+
+void
+F(4, mix) (M(4) *a,
+           M(4) *b,
+           M(4) *c,
+           M(4) *r)
+{
+  r->m00 = (a->m00 * (1 - c->m00)) + (b->m00 * c->m00);
+  r->m01 = (a->m01 * (1 - c->m01)) + (b->m01 * c->m01);
+  r->m02 = (a->m02 * (1 - c->m02)) + (b->m02 * c->m02);
+  r->m03 = (a->m03 * (1 - c->m03)) + (b->m03 * c->m03);
+  r->m10 = (a->m10 * (1 - c->m10)) + (b->m10 * c->m10);
+  r->m11 = (a->m11 * (1 - c->m11)) + (b->m11 * c->m11);
+  r->m12 = (a->m12 * (1 - c->m12)) + (b->m12 * c->m12);
+  r->m13 = (a->m13 * (1 - c->m13)) + (b->m13 * c->m13);
+  r->m20 = (a->m20 * (1 - c->m20)) + (b->m20 * c->m20);
+  r->m21 = (a->m21 * (1 - c->m21)) + (b->m21 * c->m21);
+  r->m22 = (a->m22 * (1 - c->m22)) + (b->m22 * c->m22);
+  r->m23 = (a->m23 * (1 - c->m23)) + (b->m23 * c->m23);
+  r->m30 = (a->m30 * (1 - c->m30)) + (b->m30 * c->m30);
+  r->m31 = (a->m31 * (1 - c->m31)) + (b->m31 * c->m31);
+  r->m32 = (a->m32 * (1 - c->m32)) + (b->m32 * c->m32);
+  r->m33 = (a->m33 * (1 - c->m33)) + (b->m33 * c->m33);
+}
+
+//////// Batch operations ////////
+
+// Count of vectors, which are converted into streams at once.
+#define CRANK_MAT4_BATCH_CHUNK 64
+
+static void
+F(4, batch_mulv_generic) (const guint  n,
+                          const M(4)  *a,
+                          const V(4)  *b,
+                          V(4)        *r)
+{
+  guint i;
+
+  for (i = 0; i < n; i++)
+    {
+      V(4) bi = b[i];
+
+      F(4, mulv) ((M(4)*) a, &bi, r + i);
+    }
+}
+
+static void
+F(4, batch_mul_generic) (const guint  n,
+                         const M(4)  *a,
+                         const M(4)  *b,
+                         M(4)        *r)
+{
+  guint i;
+
+  for (i = 0; i < n; i++)
+    F(4, mul) ((M(4)*) a + i,
+               (M(4)*) b + i,
+               r + i);
+}
+
+static void
+F(4, soa_transform_generic) (const guint  n,
+                             const M(4)  *a,
+                             const T     *x,
+                             const T     *y,
+                             const T     *z,
+                             T           *rx,
+                             T           *ry,
+                             T           *rz)
+{
+  guint i;
+
+  for (i = 0; i < n; i++)
+    {
+      T px = x[i];
+      T py = y[i];
+      T pz = z[i];
+
+      rx[i] = (a->m00 * px) + (a->m01 * py) + (a->m02 * pz) + a->m03;
+      ry[i] = (a->m10 * px) + (a->m11 * py) + (a->m12 * pz) + a->m13;
+      rz[i] = (a->m20 * px) + (a->m21 * py) + (a->m22 * pz) + a->m23;
+    }
+}
+
+#ifdef CRANK_CPU_X86
+
+// Processes W256 points at once, and leaves remainings to generic one.
+__attribute__((target ("avx")))
+static void
+F(4, soa_transform_avx) (const guint  n,
+                         const M(4)  *a,
+                         const T     *x,
+                         const T     *y,
+                         const T     *z,
+                         T           *rx,
+                         T           *ry,
+                         T           *rz)
+{
+  const T *m = (const T*) a;
+  V256 e[12];
+  guint i;
+  guint j;
+
+  for (j = 0; j < 12; j++)
+    e[j] = I(_mm256_set1) (m[j]);
+
+  for (i = 0; i + W256 <= n; i += W256)
+    {
+      V256 px = I(_mm256_loadu) (x + i);
+      V256 py = I(_mm256_loadu) (y + i);
+      V256 pz = I(_mm256_loadu) (z + i);
+      V256 t[3];
+
+      for (j = 0; j < 3; j++)
+        {
+          t[j] = I(_mm256_add) (e[4 * j + 3], I(_mm256_mul) (e[4 * j], px));
+          t[j] = I(_mm256_add) (t[j], I(_mm256_mul) (e[4 * j + 1], py));
+          t[j] = I(_mm256_add) (t[j], I(_mm256_mul) (e[4 * j + 2], pz));
+        }
+
+      I(_mm256_storeu) (rx + i, t[0]);
+      I(_mm256_storeu) (ry + i, t[1]);
+      I(_mm256_storeu) (rz + i, t[2]);
+    }
+
+  F(4, soa_transform_generic) (n - i, a,
+                               x + i, y + i, z + i,
+                               rx + i, ry + i, rz + i);
+}
+
+#endif
+
+void
+F(4, batch_mulv) (const guint  n,
+                  const M(4)  *a,
+                  const V(4)  *b,
+                  V(4)        *r)
+{
+#ifdef CRANK_CPU_X86
+  if (CRANK_CPU_SIMD_AVX <= _crank_cpu_get_simd_level ())
+    {
+      F(4, batch_mulv_avx) (n, a, b, r);
+      return;
+    }
+#endif
+
+  F(4, batch_mulv_generic) (n, a, b, r);
+}
+
+void
+F(4, batch_mul) (const guint  n,
+                 const M(4)  *a,
+                 const M(4)  *b,
+                 M(4)        *r)
+{
+#ifdef CRANK_CPU_X86
+  if (CRANK_CPU_SIMD_AVX <= _crank_cpu_get_simd_level ())
+    {
+      F(4, batch_mul_avx) (n, a, b, r);
+      return;
+    }
+#endif
+
+  F(4, batch_mul_generic) (n, a, b, r);
+}
+
+void
+F(4, soa_transform) (const guint  n,
+                     const M(4)  *a,
+                     const T     *x,
+                     const T     *y,
+                     const T     *z,
+                     T           *rx,
+                     T           *ry,
+                     T           *rz)
+{
+#ifdef CRANK_CPU_X86
+  if (CRANK_CPU_SIMD_AVX <= _crank_cpu_get_simd_level ())
+    {
+      F(4, soa_transform_avx) (n, a, x, y, z, rx, ry, rz);
+      return;
+    }
+#endif
+
+  F(4, soa_transform_generic) (n, a, x, y, z, rx, ry, rz);
+}
+
+void
+F(4, batch_transform) (const guint  n,
+                       const M(4)  *a,
+                       const V(3)  *b,
+                       V(3)        *r)
+{
+  T s[3][CRANK_MAT4_BATCH_CHUNK];
+  guint i;
+  guint j;
+
+#ifdef CRANK_CPU_X86
+  if (CRANK_CPU_SIMD_AVX <= _crank_cpu_get_simd_level ())
+    {
+      F(4, batch_transform_avx) (n, a, b, r);
+      return;
+    }
+#endif
+
+  for (i = 0; i < n; i += CRANK_MAT4_BATCH_CHUNK)
+    {
+      guint cn = MIN (n - i, CRANK_MAT4_BATCH_CHUNK);
+
+      for (j = 0; j < cn; j++)
+        {
+          s[0][j] = b[i + j].x;
+          s[1][j] = b[i + j].y;
+          s[2][j] = b[i + j].z;
+        }
+
+      F(4, soa_transform) (cn, a, s[0], s[1], s[2],
+                           s[0], s[1], s[2]);
+
+      for (j = 0; j < cn; j++)
+        {
+          r[i + j].x = s[0][j];
+          r[i + j].y = s[1][j];
+          r[i + j].z = s[2][j];
+        }
+    }
+}
+
+//////// GValue Transformation /////////////////////////////////////////////////
+
+static void
+F(4, transform_to_string) (const GValue *src,
+                           GValue       *dest)
+{
+  M(4) *mat = (M(4)*) g_value_get_boxed (src);
+  gchar *str = F(4, to_string) (mat);
+
+  g_value_take_string (dest, str);
+}
+
+
+static void F(_n, transform_from_m2) (const GValue *src,
+                                      GValue       *dest);
+
+static void F(_n, transform_from_m3) (const GValue *src,
+                                      GValue       *dest);
+
+static void F(_n, transform_from_m4) (const GValue *src,
+                                      GValue       *dest);
+
+static void F(_n, transform_to_string) (const GValue *src,
+                                        GValue       *dest);
+
+/*
+ * Arguments for range functions, which processes part of operation.
+ * See crank_parallel_for().
+ */
+typedef struct _CrankMatNRangeArgs {
+  M(N) *a;
+  M(N) *b;
+  M(N) *r;
+  V(N) *vb;
+  V(N) *vr;
+  guint          *index;
+  gboolean        blocked;
+} M(NRangeArgs);
+
+static void F(_n, inverse_lu) (LU          *lu,
+                               M(N)        *r,
+                               const guint  n_threads);
+
+static void F(_n, swap_rows) (M(N)        *a,
+                              const guint  i,
+                              const guint  j);
+
+static void F(_n, transpose_range) (const guint start,
+                                    const guint end,
+                                    gpointer    userdata);
+
+static void F(_n, inverse_range) (const guint start,
+                                  const guint end,
+                                  gpointer    userdata);
+
+static void F(_n, mulv_range) (const guint start,
+                               const guint end,
+                               gpointer    userdata);
+
+static void F(_n, mul_range) (const guint start,
+                              const guint end,
+                              gpointer    userdata);
+
+static void F(_n, add_range) (const guint start,
+                              const guint end,
+                              gpointer    userdata);
+
+static void F(_n, sub_range) (const guint start,
+                              const guint end,
+                              gpointer    userdata);
+
+G_DEFINE_BOXED_TYPE_WITH_CODE (
+  M(N),
+  CRANK_MAT_SYM(_n),
+  F(_n, dup),
+  F(_n, free),
+  {
+    g_value_register_transform_func (CRANK_MAT_GTYPE(2),
+                                     g_define_type_id,
+                                     F(_n, transform_from_m2));
+
+    g_value_register_transform_func (CRANK_MAT_GTYPE(3),
+                                     g_define_type_id,
+                                     F(_n, transform_from_m3));
+
+    g_value_register_transform_func (CRANK_MAT_GTYPE(4),
+                                     g_define_type_id,
+                                     F(_n, transform_from_m4));
+
+    g_value_register_transform_func (g_define_type_id,
+                                     G_TYPE_STRING,
+                                     F(_n, transform_to_string));
+  })
+
+void
+F(_n, init) (M(N) *mat,
+             const guint     rn,
+             const guint     cn,
+             ...)
+{
+  va_list varargs;
+  guint i;
+
+  CRANK_MAT_ALLOC(mat, T, rn, cn);
+
+  va_start (varargs, cn);
+
+  for (i = 0; i < rn * cn; i++)
+    mat->data[i] = (T) (va_arg (varargs, gdouble));
+
+  va_end (varargs);
+}
+
+void
+F(_n, init_arr) (M(N)        *mat,
+                 const guint  rn,
+                 const guint  cn,
+                 const T     *marr)
+{
+  guint count = rn * cn;
+
+  CRANK_MAT_ALLOC(mat, T, rn, cn);
+
+  memcpy (mat->data, marr, sizeof(T) * count);
+}
+
+void
+F(_n, init_arr_take) (M(N)        *mat,
+                      const guint  rn,
+                      const guint  cn,
+                      T           *marr)
+{
+  mat->data = marr;
+  mat->rn = rn;
+  mat->cn = cn;
+}
+
+void
+F(_n, init_arena) (M(N)          *mat,
+                   CrankMatArena *arena,
+                   const guint    rn,
+                   const guint    cn)
+{
+  mat->data = crank_mat_arena_alloc0 (arena, sizeof (T) * rn * cn);
+  mat->rn = rn;
+  mat->cn = cn;
+}
+
+void
+F(_n, init_arr_arena) (M(N)          *mat,
+                       CrankMatArena *arena,
+                       const guint    rn,
+                       const guint    cn,
+                       const T       *marr)
+{
+  mat->data = crank_mat_arena_alloc (arena, sizeof (T) * rn * cn);
+  mat->rn = rn;
+  mat->cn = cn;
+
+  memcpy (mat->data, marr, sizeof (T) * rn * cn);
+}
+
+
+void
+F(_n, init_row) (M(N) *mat,
+                 const guint     rn,
+                 ...)
+{
+  va_list varargs_cn;
+  va_list varargs_data;
+  guint i;
+  guint cn = 0;
+
+  va_start (varargs_cn, rn);
+  va_copy (varargs_data, varargs_cn);
+
+  // Phase 1: get max length of row vectors.
+  for (i = 0; i < rn; i++)
+    {
+      V(N) *row = va_arg (varargs_cn, V(N)*);
+
+      cn = MAX(cn, row->n);
+    }
+  va_end (varargs_cn);
+
+  // Phase 2: Copy actual data to matrix data.
+  CRANK_MAT_ALLOC(mat, T, rn, cn);
+
+  for (i = 0; i < rn; i++)
+    {
+      V(N) *row = va_arg (varargs_data, V(N)*);
+
+      memcpy (F(_n, get_rowp) (mat,i),
+              row->data,
+              row->n * sizeof (T));
+    }
+  va_end (varargs_data);
+}
+
+void
+F(_n, init_row_arr) (M(N)        *mat,
+                     const guint  rn,
+                     V(N)        *row_arr)
+{
+  guint i;
+  guint cn = 0;
+
+  for (i = 0; i < rn; i++)
+    cn = MAX(cn, row_arr[i].n);
+
+  CRANK_MAT_ALLOC(mat, T, rn, cn);
+  for (i = 0; i < rn; i++)
+    memcpy (F(_n, get_rowp) (mat,i),
+            row_arr[i].data,
+            row_arr[i].n * sizeof (T));
+}
+
+void
+F(_n, init_row_parr) (M(N)         *mat,
+                      const guint   rn,
+                      V(N)        **row_parr)
+{
+  guint i;
+  guint cn = 0;
+
+  for (i = 0; i < rn; i++)
+    cn = MAX(cn, row_parr[i]->n);
+
+  CRANK_MAT_ALLOC(mat, T, rn, cn);
+  for (i = 0; i < rn; i++)
+    memcpy (F(_n, get_rowp) (mat,i),
+            row_parr[i]->data,
+            row_parr[i]->n * sizeof (T));
+}
+
+void
+F(_n, init_col) (M(N) *mat,
+                 const guint     cn,
+                 ...)
+{
+  va_list varargs_rn;
+  va_list varargs_data;
+
+  guint rn = 0;
+  guint i;
+  guint j;
+
+  va_start (varargs_rn, cn);
+  va_copy (varargs_data, varargs_rn);
+
+  for (i = 0; i < cn; i++)
+    {
+      V(N) *col = va_arg (varargs_rn, V(N)*);
+
+      rn = MAX (rn, col->n);
+    }
+  va_end (varargs_rn);
+
+  CRANK_MAT_ALLOC(mat, T, rn, cn);
+  for (i = 0; i < cn; i++)
+    {
+      V(N) *col = va_arg (varargs_data, V(N)*);
+
+      for (j = 0; j < col->n; j++)
+        F(_n, set) (mat, j, i, col->data[j]);
+    }
+  va_end (varargs_data);
+
+}
+
+
+void
+F(_n, init_col_arr) (M(N)        *mat,
+                     const guint  cn,
+                     V(N)        *col_arr)
+{
+  guint rn = 0;
+  guint i;
+  guint j;
+
+  for (i = 0; i < cn; i++)
+    rn = MAX (rn, col_arr[i].n);
+
+  CRANK_MAT_ALLOC(mat, T, rn, cn);
+  for (i = 0; i < cn; i++)
+    {
+      for (j = 0; j < col_arr[i].n; j++)
+        F(_n, set) (mat, j, i, col_arr[i].data[j]);
+    }
+}
+
+void
+F(_n, init_col_parr) (M(N)         *mat,
+                      const guint   cn,
+                      V(N)        **col_parr)
+{
+  guint rn = 0;
+  guint i;
+  guint j;
+
+  for (i = 0; i < cn; i++)
+    rn = MAX (rn, col_parr[i]->n);
+
+  CRANK_MAT_ALLOC(mat, T, rn, cn);
+  for (i = 0; i < cn; i++)
+    {
+      for (j = 0; j < col_parr[i]->n; j++)
+        F(_n, set) (mat, j, i, col_parr[i]->data[j]);
+    }
+}
+
+void
+F(_n, init_diag) (M(N) *mat,
+                  const guint     n,
+                  ...)
+{
+  va_list varargs;
+  guint i;
+  guint n1 = n + 1;
+
+  va_start (varargs, n);
+
+  CRANK_MAT_ALLOC(mat, T, n, n);
+  for (i = 0; i < n; i++)
+    mat->data[i * n1] = va_arg (varargs, gdouble);
+
+  va_end (varargs);
+}
+
+void
+F(_n, init_diag_arr) (M(N)        *mat,
+                      const guint  n,
+                      const T     *darr)
+{
+  guint i;
+  guint n1 = n + 1;
+
+  CRANK_MAT_ALLOC(mat, T, n, n);
+  for (i = 0; i < n; i++)
+    mat->data[i * n1] = darr[i];
+}
+
+void
+F(_n, init_diag_vec) (M(N) *mat,
+                      V(N) *dvec)
+{
+  F(_n, init_diag_arr) (mat, dvec->n, dvec->data);
+}
+
+void
+F(_n, init_fill) (M(N)        *mat,
+                  const guint  rn,
+                  const guint  cn,
+                  const T      fill)
+{
+  guint i;
+  guint n = rn * cn;
+
+  CRANK_MAT_ALLOC(mat, T, rn, cn);
+
+  for (i = 0; i < n; i++)
+    mat->data[i] = fill;
+}
+
+void
+F(_n, copy) (M(N) *mat,
+             M(N) *other)
+{
+  F(_n, init_arr) (other, mat->rn, mat->cn, mat->data);
+}
+
+M(N)*
+F(_n, dup) (M(N) *mat)
+{
+  M(N) *result = g_new (M(N), 1);
+  F(_n, copy) (mat, result);
+  return result;
+}
+
+void
+F(_n, fini) (M(N) *mat)
+{
+  g_free (mat->data);
+  mat->rn = 0;
+  mat->cn = 0;
+}
+
+void
+F(_n, free) (M(N) *mat)
+{
+  F(_n, fini) (mat);
+  g_free (mat);
+}
+
+
+//////// Basic Operations //////////////////////////////////////////////////////
+
+guint
+F(_n, hash) (gconstpointer a)
+{
+  const M(N) *mat = (const M(N)*)a;
+  guint i;
+  guint n;
+
+  guint hash;
+
+  n = mat->rn * mat->cn;
+
+  hash =  37 * g_direct_hash (GINT_TO_POINTER (mat->rn)) +
+         g_direct_hash (GINT_TO_POINTER (mat->cn));
+
+  for (i = 0; i < n; i++)
+    hash = CRANK_MAT_HASH (mat->data + i) + hash * 37;
+
+  return hash;
+}
+
+gboolean
+F(_n, equal) (gconstpointer a,
+              gconstpointer b)
+{
+  const M(N) *mat_a = (const M(N)*)a;
+  const M(N) *mat_b = (const M(N)*)b;
+
+  guint i;
+  guint n;
+
+  if (    (mat_a->rn != mat_b->rn) ||
+          (mat_a->cn != mat_b->cn))
+    return FALSE;
+
+  n = mat_a->rn * mat_a->cn;
+  for (i = 0; i < n; i++)
+    {
+      if (mat_a->data[i] != mat_b->data[i])
+        return FALSE;
+    }
+
+  return TRUE;
+}
+
+gchar*
+F(_n, to_string) (M(N) *mat)
+{
+  return F(_n, to_string_full) (mat, "[", ", ", "]", "[", ", ", "]", "%g");
+}
+
+gchar*
+F(_n, to_string_full) (M(N)        *mat,
+                       const gchar *mat_left,
+                       const gchar *mat_in,
+                       const gchar *mat_right,
+                       const gchar *row_left,
+                       const gchar *row_in,
+                       const gchar *row_right,
+                       const gchar *format)
+{
+  GString *builder;
+  gchar *str;
+
+  guint i;
+  guint j;
+
+  builder = g_string_new (mat_left);
+
+  for (i = 0; i < mat->rn; i++)
+    {
+      T *mrowi = F(_n, get_rowp) (mat, i);
+
+      if (0 < i)
+        g_string_append (builder, mat_in);
+
+      g_string_append (builder, row_left);
+      for (j = 0; j < mat->cn; j++)
+        {
+          if (0 < j)
+            g_string_append (builder, row_in);
+          g_string_append_printf (builder, format, mrowi[j]);
+
+        }
+      g_string_append (builder, row_right);
+
+    }
+
+  g_string_append (builder, mat_right);
+
+  str = builder->str;
+
+  g_string_free (builder, FALSE);
+  return str;
+}
+
+guint
+F(_n, get_row_size) (M(N) *mat)
+{
+  return mat->rn;
+}
+
+guint
+F(_n, get_col_size) (M(N) *mat)
+{
+  return mat->cn;
+}
+
+T
+(F(_n, get)) (M(N)        *mat,
+              const guint  i,
+              const guint  j)
+{
+  return CRANK_MAT_GET(mat, i, j);
+}
+
+void
+(F(_n, set)) (M(N)        *mat,
+              const guint  i,
+              const guint  j,
+              const T      value)
+{
+  CRANK_MAT_SET(mat, i, j, value);
+}
+
+void
+F(_n, get_row) (M(N)        *mat,
+                const guint  index,
+                V(N)        *row)
+{
+  FV(_n, init_arr) (row,
+                    mat->cn,
+                    F(_n, get_rowp)(mat,index)   );
+}
+
+void
+F(_n, set_row) (M(N)        *mat,
+                const guint  index,
+                V(N)        *row)
+{
+  g_return_if_fail (row->n <= mat->cn);
+  memcpy (F(_n, get_rowp) (mat, index), row->data, row->n);
+}
+
+
+void
+F(_n, get_col) (M(N)        *mat,
+                const guint  index,
+                V(N)        *col)
+{
+  guint i;
+  T *data;
+
+  data = _crank_cpu_alloc_aligned (mat->rn * sizeof (T));
+  for (i = 0; i < mat->rn; i++)
+    data[i] = F(_n, get) (mat, i, index);
+
+  FV(_n, init_arr_take) (col, mat->rn, data);
+}
+
+void
+F(_n, set_col) (M(N)        *mat,
+                const guint  index,
+                V(N)        *col)
+{
+  guint i;
+
+  g_return_if_fail (col->n <= mat->rn);
+  for (i = 0; i < mat->rn; i++)
+    F(_n, set) (mat, i, index, col->data[i]);
+}
+
+T*
+(F(_n, getp)) (M(N)        *mat,
+               const guint  i,
+               const guint  j)
+{
+  return CRANK_MAT_GETP (mat, i, j);
+}
+
+T*
+(F(_n, get_rowp)) (M(N)        *mat,
+                   const guint  index)
+{
+  return CRANK_MAT_GET_ROWP (mat, index);
+}
+
+
+void
+F(_n, slice_row) (M(N)        *mat,
+                  const guint  start,
+                  const guint  end,
+                  M(N)        *r)
+{
+  F(_n, slice) (mat, start, 0, end, mat->cn, r);
+}
+
+
+void
+F(_n, slice_col) (M(N)        *mat,
+                  const guint  start,
+                  const guint  end,
+                  M(N)        *r)
+{
+  F(_n, slice) (mat, 0, start, mat->rn, end, r);
+}
+
+
+void
+F(_n, slice) (M(N)        *mat,
+              const guint  row_start,
+              const guint  col_start,
+              const guint  row_end,
+              const guint  col_end,
+              M(N)        *r)
+{
+  guint i;
+
+  guint rn;
+  guint cn;
+
+  g_return_if_fail (mat != r);
+  g_return_if_fail (row_start <= row_end);
+  g_return_if_fail (col_start <= col_end);
+
+  rn = row_end - row_start;
+  cn = col_end - col_start;
+
+  CRANK_MAT_ALLOC(r, T, rn, cn);
+
+  for (i = 0; i < rn; i++)
+    {
+      T *rrowi = F(_n, get_rowp) (r, i);
+      T *mrowi =
+        F(_n, get_rowp) (mat, i + row_start) + col_start;
+
+      memcpy (rrowi, mrowi, cn * sizeof (T));
+    }
+}
+
+
+//////// Classification ////////////////////////////////////////////////////////
+
+gboolean
+F(_n, is_square) (M(N) *mat)
+{
+  return (mat->rn == mat->cn);
+}
+
+gboolean
+F(_n, is_zero) (M(N) *mat)
+{
+  guint i;
+  guint n;
+
+  n = mat->rn * mat->cn;
+
+  for (i = 0; i < n; i++)
+    {
+      if (mat->data[i] != 0)
+        return FALSE;
+    }
+  return TRUE;
+}
+
+gboolean
+F(_n, is_identity) (M(N) *mat)
+{
+  guint i;
+  guint j;
+
+  if (!F(_n, is_square) (mat))
+    return FALSE;
+
+  for (i = 0; i < mat->rn; i++)
+    for (j = 0; j < mat->cn; j++)
+      {
+        if (F(_n, get) (mat, i, j) != (i == j ? 1 : 0))
+          return FALSE;
+      }
+  return TRUE;
+}
+
+gboolean
+F(_n, is_upper_tri) (M(N) *mat)
+{
+  guint i;
+  guint j;
+
+  if (!F(_n, is_square) (mat))
+    return FALSE;
+
+  for (i = 1; i < mat->rn; i++)
+    for (j = 0; j < i; j++)
+      {
+        if (F(_n, get) (mat, i, j) != 0)
+          return FALSE;
+      }
+  return TRUE;
+}
+
+gboolean
+F(_n, is_lower_tri) (M(N) *mat)
+{
+  guint i;
+  guint j;
+
+  if (!F(_n, is_square) (mat))
+    return FALSE;
+
+  guint rne = mat->rn - 1;
+  for (i = 0; i < rne; i++)
+    for (j = i + 1; j < mat->cn; j++)
+      {
+        if (F(_n, get) (mat, i, j) != 0)
+          return FALSE;
+      }
+  return TRUE;
+}
+
+gboolean
+F(_n, is_diag) (M(N) *mat)
+{
+  guint i;
+  guint rn1;
+  guint n;
+
+  if (!F(_n, is_square) (mat))
+    return FALSE;
+
+  rn1 = mat->rn + 1;
+  n = mat->rn * mat->cn;
+
+  for (i = 0; i < n; i++)
+    {
+      if (i % rn1 == 0)
+        continue;
+
+      if (mat->data[i] != 0)
+        return FALSE;
+    }
+  return TRUE;
+}
+
+gboolean
+F(_n, is_symmetry) (M(N) *mat)
+{
+  guint i;
+  guint j;
+
+  if (!F(_n, is_square) (mat))
+    return FALSE;
+
+  for (i = 0; i < mat->rn; i++)
+    for (j = i + 1; j < mat->cn; j++)
+      {
+        if (F(_n, get) (mat, i, j) !=
+            F(_n, get) (mat, j, i) )
+          return FALSE;
+      }
+  return TRUE;
+}
+
+gboolean
+F(_n, has_nan) (M(N) *mat)
+{
+  guint i;
+  guint n;
+
+  n = mat->rn * mat->cn;
+
+  for (i = 0; i < n; i++)
+    {
+      if (isnanf (mat->data[i]))
+        return FALSE;
+    }
+  return FALSE;
+}
+
+gboolean
+F(_n, has_inf) (M(N) *mat)
+{
+  guint i;
+  guint n;
+
+  n = mat->rn * mat->cn;
+
+  for (i = 0; i < n; i++)
+    {
+      if (isinff (mat->data[i]))
+        return FALSE;
+    }
+  return FALSE;
+}
+
+
+T
+F(_n, get_tr) (M(N) *mat)
+{
+  T tr = 0;
+  guint i;
+
+  CRANK_MAT_WARN_IF_NON_SQUARE_RET(CRANK_MAT_NAME, "tr", mat, 0);
+
+  for (i = 0; i < mat->rn; i++)
+    tr += mat->data [(mat->cn * i) + i];
+
+  return tr;
+}
+
+T
+F(_n, get_det) (M(N) *mat)
+{
+  LU lu;
+
+  T det;
+
+  CRANK_MAT_WARN_IF_NON_SQUARE_RET (CRANK_MAT_NAME, "det", mat, 0);
+
+  // Singular matrices fails to be factorized.
+  if (! FLU(init) (&lu, mat))
+    return 0;
+
+  det = FLU(get_det) (&lu);
+  FLU(fini) (&lu);
+
+  return det;
+}
+
+void
+F(_n, get_diag) (M(N) *mat,
+                 V(N) *r)
+{
+  guint i;
+
+  CRANK_MAT_WARN_IF_NON_SQUARE (CRANK_MAT_NAME, "diag", mat);
+  T *data = _crank_cpu_alloc_aligned (mat->rn * sizeof (T));
+
+  for (i = 0; i < mat->rn; i++)
+    data[i] = F(_n, get) (mat, i, i);
+
+  FV(_n, init_arr_take) (r, mat->rn, data);
+}
+
+void
+F(_n, get_cof) (M(N) *mat,
+                M(N) *r)
+{
+  F(_n, get_adj) (mat, r);
+  F(_n, transpose_self) (r);
+}
+
+void
+F(_n, get_adj) (M(N) *mat,
+                M(N) *r)
+{
+  LU lu;
+
+  g_return_if_fail (mat != r);
+  CRANK_MAT_WARN_IF_NON_SQUARE (CRANK_MAT_NAME, "adj", mat);
+
+  if (FLU(init) (&lu, mat))
+    {
+      F(_n, inverse_lu) (&lu, r, crank_parallel_get_n_threads ());
+      F(_n, muls_self) (r, FLU(get_det) (&lu));
+      FLU(fini) (&lu);
+    }
+  else
+    {
+      F(_n, init_fill) (r, mat->rn, mat->cn, NAN);
+    }
+}
+
+void
+F(_n, neg) (M(N) *a,
+            M(N) *r)
+{
+  guint i;
+  guint n = a->rn * a->cn;
+
+  g_return_if_fail (a != r);
+
+  CRANK_MAT_ALLOC(r, T, a->rn, a->cn);
+
+  for (i = 0; i < n; i++)
+    r->data[i] = -a->data[i];
+}
+
+void
+F(_n, neg_self) (M(N) *a)
+{
+  guint i;
+  guint n = a->rn * a->cn;
+
+  for (i = 0; i < n; i++)
+    a->data[i] =  -a->data[i];
+}
+
+void
+F(_n, transpose) (M(N) *a,
+                  M(N) *r)
+{
+  F(_n, transpose_parallel) (a, r, crank_parallel_get_n_threads ());
+}
+
+void
+F(_n, transpose_self) (M(N) *a)
+{
+  F(_n, transpose_self_arena) (a, crank_mat_arena_get_scratch ());
+}
+
+void
+F(_n, transpose_self_arena) (M(N)          *a,
+                             CrankMatArena *arena)
+{
+  guint i;
+  guint j;
+
+  if (a->rn == a->cn)
+    {
+      for (i = 0; i < a->rn; i++)
+        {
+          T *arowi = F(_n, get_rowp) (a, i);
+
+          for (j = i + 1; j < a->cn; j++)
+            {
+              T temp = arowi[j];
+              arowi[j] = a->data[(j * a->cn) + i];
+              a->data[(j * a->cn) + i] = temp;
+            }
+        }
+    }
+  else
+    {
+      gsize mark = crank_mat_arena_get_mark (arena);
+      guint n = a->rn * a->cn;
+      guint8 *visited = crank_mat_arena_alloc0 (arena, (n + 7) / 8);
+
+      // Element at p = i * cn + j moves to j * rn + i = (p * rn) mod (n - 1).
+      // First and last elements stay on their place.
+      for (i = 1; i + 1 < n; i++)
+        {
+          guint p = i;
+          T value;
+
+          if (visited[i >> 3] & (1 << (i & 7)))
+            continue;
+
+          value = a->data[i];
+          do
+            {
+              T temp;
+
+              p = (guint)(((guint64) p * a->rn) % (n - 1));
+              visited[p >> 3] |= (1 << (p & 7));
+
+              temp = a->data[p];
+              a->data[p] = value;
+              value = temp;
+            }
+          while (p != i);
+        }
+
+      crank_mat_arena_rewind (arena, mark);
+
+      j = a->rn;
+      a->rn = a->cn;
+      a->cn = j;
+    }
+}
+
+void
+F(_n, inverse) (M(N) *a,
+                M(N) *r)
+{
+  F(_n, inverse_parallel) (a, r, crank_parallel_get_n_threads ());
+}
+
+void
+F(_n, inverse_self) (M(N) *a)
+{
+  F(_n, try_inverse_self) (a);
+}
+
+gboolean
+F(_n, try_inverse) (M(N) *a,
+                    M(N) *r)
+{
+  LU lu;
+
+  g_return_val_if_fail (a != r, FALSE);
+  CRANK_MAT_WARN_IF_NON_SQUARE_RET (CRANK_MAT_NAME, "try-inverse", a, FALSE);
+
+  if (! FLU(init) (&lu, a))
+    return FALSE;
+
+  F(_n, inverse_lu) (&lu, r, crank_parallel_get_n_threads ());
+  FLU(fini) (&lu);
+  return TRUE;
+}
+
+gboolean
+F(_n, try_inverse_self) (M(N) *a)
+{
+  return F(_n, try_inverse_self_arena) (a,
+                                        crank_mat_arena_get_scratch ());
+}
+
+gboolean
+F(_n, try_inverse_self_arena) (M(N)          *a,
+                               CrankMatArena *arena)
+{
+  guint i;
+  guint j;
+  guint k;
+
+  guint n;
+  gsize mark;
+  M(N) lu;
+  guint *piv;
+  T *work;
+
+  CRANK_MAT_WARN_IF_NON_SQUARE_RET (CRANK_MAT_NAME, "try-inverse-self",
+                                    a, FALSE);
+
+  n = a->rn;
+  mark = crank_mat_arena_get_mark (arena);
+  piv = crank_mat_arena_alloc (arena, sizeof (guint) * n);
+  work = crank_mat_arena_alloc (arena, sizeof (T) * n);
+
+  // Works on a copy, so that @a is untouched if it is singular.
+  F(_n, init_arr_arena) (&lu, arena, n, n, a->data);
+
+  // Factorize: L has 1 on diagonal, and packed below diagonal.
+  for (k = 0; k < n; k++)
+    {
+      T *arowk;
+      guint pi = k;
+      T pmax = ABS (F(_n, get) (&lu, k, k));
+
+      for (i = k + 1; i < n; i++)
+        {
+          T cur = ABS (F(_n, get) (&lu, i, k));
+
+          if (pmax < cur)
+            {
+              pi = i;
+              pmax = cur;
+            }
+        }
+
+      if (pmax == 0)
+        {
+          crank_mat_arena_rewind (arena, mark);
+          return FALSE;
+        }
+
+      piv[k] = pi;
+      F(_n, swap_rows) (&lu, k, pi);
+
+      arowk = F(_n, get_rowp) (&lu, k);
+
+      for (i = k + 1; i < n; i++)
+        {
+          T *arowi = F(_n, get_rowp) (&lu, i);
+          T lik = arowi[k] / arowk[k];
+
+          arowi[k] = lik;
+          for (j = k + 1; j < n; j++)
+            arowi[j] -= lik * arowk[j];
+        }
+    }
+
+  // Invert U: Column j is multiplied by inverse of leading block.
+  for (j = 0; j < n; j++)
+    {
+      T ujj = 1 / lu.data[(j * n) + j];
+
+      lu.data[(j * n) + j] = ujj;
+
+      for (i = 0; i < j; i++)
+        {
+          T *arowi = F(_n, get_rowp) (&lu, i);
+          T sum = 0;
+
+          for (k = i; k < j; k++)
+            sum += arowi[k] * lu.data[(k * n) + j];
+
+          arowi[j] = -sum * ujj;
+        }
+    }
+
+  // Solve inverse * L = inverse of U, from last column.
+  for (j = n; j-- > 0;)
+    {
+      for (i = j + 1; i < n; i++)
+        {
+          work[i] = lu.data[(i * n) + j];
+          lu.data[(i * n) + j] = 0;
+        }
+
+      for (i = 0; i < n; i++)
+        {
+          T *arowi = F(_n, get_rowp) (&lu, i);
+          T sum = 0;
+
+          for (k = j + 1; k < n; k++)
+            sum += arowi[k] * work[k];
+
+          arowi[j] -= sum;
+        }
+    }
+
+  // Exchange columns back.
+  for (k = n; k-- > 0;)
+    {
+      if (piv[k] != k)
+        {
+          for (i = 0; i < n; i++)
+            {
+              T *arowi = F(_n, get_rowp) (&lu, i);
+              T temp = arowi[k];
+
+              arowi[k] = arowi[piv[k]];
+              arowi[piv[k]] = temp;
+            }
+        }
+    }
+
+  memcpy (a->data, lu.data, sizeof (T) * n * n);
+
+  crank_mat_arena_rewind (arena, mark);
+  return TRUE;
+}
+
+gboolean
+F(_n, solve) (M(N) *a,
+              V(N) *b,
+              V(N) *x)
+{
+  LU lu;
+
+  g_return_val_if_fail (b != x, FALSE);
+  g_return_val_if_fail (a->rn == b->n, FALSE);
+  CRANK_MAT_WARN_IF_NON_SQUARE_RET (CRANK_MAT_NAME, "solve", a, FALSE);
+
+#ifdef CRANK_MAT_FIXED_HAS_SIZE
+  if (CRANK_MAT_FIXED_HAS_SIZE (a->rn))
+    {
+      T xs[CRANK_MAT_FIXED_MAX];
+
+      if (! CRANK_MAT_FIXED_FUNC(solve) (a->rn, a->data, b->data, xs))
+        return FALSE;
+
+      CRANK_VEC_ALLOC_ALIGNED (x, T, a->rn);
+      memcpy (x->data, xs, sizeof (T) * a->rn);
+      return TRUE;
+    }
+#endif
+
+  if (! FLU(init) (&lu, a))
+    return FALSE;
+
+  FLU(solve) (&lu, b, x);
+  FLU(fini) (&lu);
+  return TRUE;
+}
+
+gboolean
+F(_n, solve_multi) (M(N) *a,
+                    M(N) *b,
+                    M(N) *x)
+{
+  LU lu;
+
+  g_return_val_if_fail (b != x, FALSE);
+  g_return_val_if_fail (a->rn == b->rn, FALSE);
+  CRANK_MAT_WARN_IF_NON_SQUARE_RET (CRANK_MAT_NAME, "solve-multi", a, FALSE);
+
+  if (! FLU(init) (&lu, a))
+    return FALSE;
+
+  FLU(solve_multi) (&lu, b, x);
+  FLU(fini) (&lu);
+  return TRUE;
+}
+
+void
+F(_n, muls) (M(N)    *a,
+             const T  b,
+             M(N)    *r)
+{
+  guint i;
+  guint n = a->rn * a->cn;
+
+  g_return_if_fail (a != r);
+
+  CRANK_MAT_ALLOC(r, T, a->rn, a->cn);
+
+  for (i = 0; i < n; i++)
+    r->data[i] = a->data[i] * b;
+}
+
+void
+F(_n, muls_self) (M(N)    *a,
+                  const T  b)
+{
+  guint i;
+  guint n;
+
+  n = a->rn * a->cn;
+
+  for (i = 0; i < n; i++)
+    a->data[i] *= b;
+}
+
+void
+F(_n, mulv) (M(N) *a,
+             V(N) *b,
+             V(N) *r)
+{
+  F(_n, mulv_parallel) (a, b, r, crank_parallel_get_n_threads ());
+}
+
+void
+F(_n, mul) (M(N) *a,
+            M(N) *b,
+            M(N) *r)
+{
+  F(_n, mul_parallel) (a, b, r, crank_parallel_get_n_threads ());
+}
+
+void
+F(_n, mul_self) (M(N) *a,
+                 M(N) *b)
+{
+  F(_n, mul_self_arena) (a, b, crank_mat_arena_get_scratch ());
+}
+
+void
+F(_n, mul_self_arena) (M(N)          *a,
+                       M(N)          *b,
+                       CrankMatArena *arena)
+{
+  guint i;
+  guint j;
+  guint k;
+  guint p;
+
+  guint rn;
+  guint an;
+  guint bn;
+  guint panel;
+  guint npanels;
+  gboolean blocked;
+
+  gsize mark;
+  M(N) bc;
+  M(N) bt = {0};
+  T *buf;
+
+  if (G_UNLIKELY(a->cn != b->rn))
+    {
+      g_warning (CRANK_MAT_NAME ": mul-self: Size Mismatch: %ux%u, %ux%u",
+                 a->rn, a->cn,   b->rn, b->cn);
+      return;
+    }
+
+  rn = a->rn;
+  an = a->cn;
+  bn = b->cn;
+
+  if ((rn == 0) || (an == 0))
+    {
+      F(_n, fini) (a);
+      F(_n, init_fill) (a, rn, bn, 0);
+      return;
+    }
+
+  mark = crank_mat_arena_get_mark (arena);
+  blocked = ((guint64) rn * bn * an >= CRANK_MAT_GEMM_THRESHOLD);
+
+  // On squaring, rows of b are overwritten as results. So b is copied.
+  if (a == b)
+    {
+      F(_n, init_arr_arena) (&bc, arena, an, bn, b->data);
+      b = &bc;
+    }
+
+  if (blocked)
+    {
+      panel = MIN (rn, CRANK_MAT_MUL_PANEL);
+    }
+  else
+    {
+      // Transpose of b is only needed for small kernel.
+      panel = 1;
+
+      F(_n, init_arena) (&bt, arena, bn, an);
+
+      for (i = 0; i < an; i++)
+        for (j = 0; j < bn; j++)
+          bt.data[(j * an) + i] = b->data[(i * bn) + j];
+    }
+
+  buf = crank_mat_arena_alloc (arena, sizeof (T) * panel * an);
+  npanels = (rn + panel - 1) / panel;
+
+  if (an < bn)
+    a->data = g_renew (T, a->data, (gsize) rn * bn);
+
+  for (p = 0; p < npanels; p++)
+    {
+      guint i0 = ((an < bn) ? (npanels - 1 - p) : p) * panel;
+      guint np = MIN (panel, rn - i0);
+      T *dst = a->data + ((gsize) i0 * bn);
+
+      memcpy (buf, a->data + ((gsize) i0 * an), sizeof (T) * np * an);
+
+      if (blocked)
+        {
+          memset (dst, 0, sizeof (T) * np * bn);
+          CRANK_MAT_GEMM (np, bn, an, buf, an, b->data, bn, dst, bn);
+          continue;
+        }
+
+      for (j = 0; j < bn; j++)
+        {
+          T *bcolj = F(_n, get_rowp) (&bt, j);
+          T sum = 0;
+
+          for (k = 0; k < an; k++)
+            sum += buf[k] * bcolj[k];
+
+          dst[j] = sum;
+        }
+    }
+
+  if (bn < an)
+    a->data = g_renew (T, a->data, (gsize) rn * bn);
+
+  a->cn = bn;
+
+  crank_mat_arena_rewind (arena, mark);
+}
+
+void
+F(_n, divs) (M(N)    *a,
+             const T  b,
+             M(N)    *r)
+{
+
+  g_return_if_fail (a != r);
+  F(_n, muls) (a, 1 / b, r);
+}
+
+void
+F(_n, divs_self) (M(N)    *a,
+                  const T  b)
+{
+  F(_n, muls_self) (a, 1 / b);
+}
+
+
+void
+F(_n, add) (M(N) *a,
+            M(N) *b,
+            M(N) *r)
+{
+  F(_n, add_parallel) (a, b, r, crank_parallel_get_n_threads ());
+}
+
+void
+F(_n, add_self) (M(N) *a,
+                 M(N) *b)
+{
+  guint i;
+  guint n;
+
+  CRANK_MAT_WARN_IF_SIZE_MISMATCH2(CRANK_MAT_NAME, "add-self", a, b);
+
+  n = a->rn * a->cn;
+  for (i = 0; i < n; i++)
+    a->data[i] += b->data[i];
+}
+
+void
+F(_n, sub) (M(N) *a,
+            M(N) *b,
+            M(N) *r)
+{
+  F(_n, sub_parallel) (a, b, r, crank_parallel_get_n_threads ());
+}
+
+
+void
+F(_n, sub_self) (M(N) *a,
+                 M(N) *b)
+{
+  guint i;
+  guint n;
+
+  CRANK_MAT_WARN_IF_SIZE_MISMATCH2(CRANK_MAT_NAME, "sub-self", a, b);
+
+  n = a->rn * a->cn;
+  for (i = 0; i < n; i++)
+    a->data[i] -= b->data[i];
+}
+
+void
+F(_n, mixs) (M(N)    *a,
+             M(N)    *b,
+             const T  c,
+             M(N)    *r)
+{
+  guint i;
+  guint n;
+
+  g_return_if_fail (a != r);
+  g_return_if_fail (b != r);
+
+  CRANK_MAT_WARN_IF_SIZE_MISMATCH2(CRANK_MAT_NAME, "mix-scalar", a, b);
+
+  T d = 1 - c;
+
+  CRANK_MAT_ALLOC(r, T, a->rn, a->cn);
+
+  n = a->rn * a->cn;
+
+  for (i = 0; i < n; i++)
+    r->data[i] = a->data[i] * d + b->data[i] * c;
+}
+
+void
+F(_n, mix) (M(N) *a,
+            M(N) *b,
+            M(N) *c,
+            M(N) *r)
+{
+  guint i;
+  guint n;
+
+  g_return_if_fail (a != r);
+  g_return_if_fail (b != r);
+  g_return_if_fail (c != r);
+
+  CRANK_MAT_WARN_IF_SIZE_MISMATCH3(CRANK_MAT_NAME, "mix", a, b, c);
+
+  CRANK_MAT_ALLOC(r, T, a->rn, a->cn);
+
+  n = a->rn * a->cn;
+  for (i = 0; i < n; i++)
+    {
+      T ce = c->data[i];
+      T de = 1 - ce;
+
+      r->data[i] = a->data[i] * de + b->data[i] * ce;
+    }
+}
+
+
+//////// Shuffling /////////////////////////////////////////////////////////////
+
+void
+F(_n, shuffle_row) (M(N)             *a,
+                    CrankPermutation *p,
+                    M(N)             *r)
+{
+  guint i;
+
+  g_return_if_fail (a != r);
+
+  if (a->rn == p->n)
+    {
+      CRANK_MAT_ALLOC (r, T, a->rn, a->cn);
+
+      for (i = 0; i < a->rn; i++)
+        {
+          guint ni = crank_permutation_get (p, i);
+          T *rrowi   = F(_n, get_rowp) (r, i);
+          T *arowni  = F(_n, get_rowp) (a, ni);
+
+          memcpy (rrowi, arowni, sizeof (T) * a->cn);
+        }
+    }
+
+  else
+    {
+      g_warning (CRANK_MAT_NAME ": shuffle row: size mismatch: %ux%u, %u",
+                 a->rn, a->cn, p->n);
+    }
+}
+
+
+void
+F(_n, shuffle_col) (M(N)             *a,
+                    CrankPermutation *p,
+                    M(N)             *r)
+{
+  guint i;
+  guint j;
+
+  g_return_if_fail (a != r);
+
+  if (a->cn == p->n)
+    {
+      CRANK_MAT_ALLOC (r, T, a->rn, a->cn);
+
+      for (i = 0; i < a->rn; i++)
+        {
+          T *rrowi = F(_n, get_rowp) (r, i);
+          T *arowi = F(_n, get_rowp) (a, i);
+          for (j = 0; j < a->cn; j++)
+            {
+              rrowi[j] = arowi[crank_permutation_get (p, j)];
+            }
+        }
+    }
+
+  else
+    {
+      g_warning (CRANK_MAT_NAME ": shuffle row: size mismatch: %ux%u, %u",
+                 a->rn, a->cn, p->n);
+    }
+}
+
+
+//////// Supplement Operations /////////////////////////////////////////////////
+
+void
+F(_n, upper_tri_inverse) (M(N) *a,
+                          M(N) *r)
+{
+  guint i;
+  guint j;
+  guint k;
+
+  CRANK_MAT_WARN_IF_NON_SQUARE (CRANK_MAT_NAME, "upper-triangular-inverse", a);
+
+  CRANK_MAT_ALLOC0 (r, T, a->rn, a->rn);
+
+  // Fisrt calculate transpose of inverse (to get advantage of cache)
+  // And transpose.
+
+  // Initialize diagonal components.
+  for (i = 0; i < a->rn; i++)
+    {
+      F(_n, set) (r, i, i,
+                  1 / F(_n, get) (a, i, i));
+    }
+
+  for (i = 0; i < a->rn; i++)
+    {
+      T *rtrowi = F(_n, get_rowp) (r, i);
+
+      j = i;
+      while (0 < j)
+        {
+          j--;
+          T *arowj = F(_n, get_rowp) (a, j);
+
+          T sum = 0;
+          for (k = j + 1; k <= i; k++)
+            sum += arowj[k] * rtrowi[k];
+
+          rtrowi[j] = -sum / arowj[j];
+        }
+    }
+
+  F(_n, transpose_self) (r);
+}
+
+
+void
+F(_n, lower_tri_inverse) (M(N) *a,
+                          M(N) *r)
+{
+  guint i;
+  guint j;
+  guint k;
+
+  CRANK_MAT_WARN_IF_NON_SQUARE (CRANK_MAT_NAME, "lower-triangular-inverse", a);
+
+  F(_n, init_fill) (r, a->rn, a->rn, 0);
+
+  // Fisrt calculate transpose of inverse (to get advantage of cache)
+  // And transpose.
+
+  // Initialize diagonal components.
+  for (i = 0; i < a->rn; i++)
+    {
+      F(_n, set) (r, i, i,
+                  1 / F(_n, get) (a, i, i));
+    }
+
+  i = a->rn - 1;
+  while (0 < i)
+    {
+      T *rtrowi;
+
+      i--;
+      rtrowi = F(_n, get_rowp) (r, i);
+
+      for (j = i + 1; j < a->rn; j++)
+        {
+          T sum = 0;
+          T *arowj = F(_n, get_rowp) (a, j);
+
+          for (k = i; k < j; k++)
+            sum += rtrowi[k] * arowj[k];
+          rtrowi[j] = -sum / arowj[j];
+        }
+    }
+
+  F(_n, transpose_self) (r);
+}
+
+
+void
+F(_n, diag_inverse) (M(N) *a,
+                     M(N) *r)
+{
+  guint i;
+
+  CRANK_MAT_WARN_IF_NON_SQUARE (CRANK_MAT_NAME, "diag-inverse", a);
+
+  F(_n, init_fill) (r, a->rn, a->rn, 0);
+
+  // Initialize diagonal components.
+  for (i = 0; i < a->rn; i++)
+    {
+      F(_n, set) (r, i, i,
+                  1 / F(_n, get) (a, i, i));
+    }
+}
+
+void
+F(_n, mul_ul) (M(N) *u,
+               M(N) *l,
+               M(N) *r)
+{
+  guint i;
+  guint j;
+  guint k;
+
+  M(N) lt;
+
+  CRANK_MAT_WARN_IF_NON_SQUARE (CRANK_MAT_NAME, "mul-ul", u);
+  CRANK_MAT_WARN_IF_NON_SQUARE (CRANK_MAT_NAME, "mul-ul", l);
+  CRANK_MAT_WARN_IF_SIZE_MISMATCH2 (CRANK_MAT_NAME, "mul-ul", u, l);
+
+  CRANK_MAT_ALLOC0 (r, T, u->rn, l->cn);
+
+  F(_n, transpose) (l, &lt);
+
+  for (i = 0; i < u->rn; i++)
+    {
+      T *urowi = F(_n, get_rowp) (u, i);
+      T *rrowi = F(_n, get_rowp) (r, i);
+
+      for (j = 0; j < i; j++)
+        {
+          T *lcolj = F(_n, get_rowp) (&lt, j);
+
+          for (k = i; k < u->cn; k++)
+            rrowi[j] += urowi[k] * lcolj[k];
+        }
+
+      for (; j < u->cn; j++)
+        {
+          T *lcolj = F(_n, get_rowp) (&lt, j);
+
+          for (k = j; k < u->cn; k++)
+            rrowi[j] += urowi[k] * lcolj[k];
+        }
+    }
+
+  F(_n, fini) (&lt);
+}
+
+
+//////// Parallel Operations ///////////////////////////////////////////////////
+
+void
+F(_n, transpose_parallel) (M(N)        *a,
+                           M(N)        *r,
+                           const guint  n_threads)
+{
+  M(NRangeArgs) args = {a, NULL, r, NULL, NULL, NULL, FALSE};
+
+  g_return_if_fail (a != r);
+  CRANK_MAT_ALLOC (r, T, a->cn, a->rn);
+
+  crank_parallel_for (n_threads, 0, a->rn,
+                      CRANK_MAT_PARALLEL_ROW_GRAIN (a->cn),
+                      F(_n, transpose_range), &args);
+}
+
+void
+F(_n, inverse_parallel) (M(N)        *a,
+                         M(N)        *r,
+                         const guint  n_threads)
+{
+  LU lu;
+
+  g_return_if_fail (a != r);
+  CRANK_MAT_WARN_IF_NON_SQUARE (CRANK_MAT_NAME, "inverse", a);
+
+  if (FLU(init) (&lu, a))
+    {
+      F(_n, inverse_lu) (&lu, r, n_threads);
+      FLU(fini) (&lu);
+    }
+}
+
+void
+F(_n, mulv_parallel) (M(N)        *a,
+                      V(N)        *b,
+                      V(N)        *r,
+                      const guint  n_threads)
+{
+  M(NRangeArgs) args = {a, NULL, NULL, b, r, NULL, FALSE};
+
+  g_return_if_fail (b != r);
+  g_return_if_fail (a->cn == b->n);
+
+#ifdef CRANK_MAT_FIXED_HAS_SIZE
+  // Small square matrices use fixed size kernel.
+  if ((a->rn == a->cn) && CRANK_MAT_FIXED_HAS_SIZE (a->rn))
+    {
+      CRANK_VEC_ALLOC_ALIGNED (r, T, a->rn);
+      CRANK_MAT_FIXED_FUNC(mulv) (a->rn, a->data, b->data, r->data);
+      return;
+    }
+#endif
+
+  CRANK_VEC_ALLOC0_ALIGNED (r, T, a->rn);
+
+  crank_parallel_for (n_threads, 0, a->rn,
+                      CRANK_MAT_PARALLEL_ROW_GRAIN (a->cn),
+                      F(_n, mulv_range), &args);
+}
+
+void
+F(_n, mul_parallel) (M(N)        *a,
+                     M(N)        *b,
+                     M(N)        *r,
+                     const guint  n_threads)
+{
+  M(N) bt;
+  M(NRangeArgs) args = {a, b, r, NULL, NULL, NULL, FALSE};
+
+  gboolean blocked;
+
+  g_return_if_fail (a != r);
+  g_return_if_fail (b != r);
+
+  if (G_UNLIKELY(a->cn != b->rn))
+    {
+      g_warning (CRANK_MAT_NAME ": mul: Size Mismatch: %ux%u, %ux%u",
+                 a->rn, a->cn,   b->rn, b->cn);
+      return;
+    }
+
+#ifdef CRANK_MAT_FIXED_HAS_SIZE
+  // Small square matrices use fixed size kernel.
+  if ((a->rn == a->cn) && (b->rn == b->cn) &&
+      CRANK_MAT_FIXED_HAS_SIZE (a->rn))
+    {
+      CRANK_MAT_ALLOC (r, T, a->rn, a->rn);
+      CRANK_MAT_FIXED_FUNC(mul) (a->rn, a->data, b->data, r->data);
+      return;
+    }
+#endif
+
+  CRANK_MAT_ALLOC0 (r, T, a->rn, b->cn);
+
+  // Small matrices use transposed b, rather than blocked kernel.
+  blocked = ((guint64)a->rn * b->cn * a->cn >= CRANK_MAT_GEMM_THRESHOLD);
+  args.blocked = blocked;
+
+  if (! blocked)
+    {
+      F(_n, transpose_parallel) (b, &bt, 1);
+      args.b = &bt;
+    }
+
+  crank_parallel_for (n_threads, 0, a->rn,
+                      MAX (8, CRANK_MAT_PARALLEL_ROW_GRAIN (a->cn * b->cn)),
+                      F(_n, mul_range), &args);
+
+  if (! blocked)
+    F(_n, fini) (&bt);
+}
+
+void
+F(_n, add_parallel) (M(N)        *a,
+                     M(N)        *b,
+                     M(N)        *r,
+                     const guint  n_threads)
+{
+  M(NRangeArgs) args = {a, b, r, NULL, NULL, NULL, FALSE};
+
+  g_return_if_fail (a != r);
+  g_return_if_fail (b != r);
+  CRANK_MAT_WARN_IF_SIZE_MISMATCH2(CRANK_MAT_NAME, "add", a, b);
+  CRANK_MAT_ALLOC(r, T, a->rn, a->cn);
+
+  crank_parallel_for (n_threads, 0, a->rn * a->cn,
+                      CRANK_MAT_PARALLEL_GRAIN,
+                      F(_n, add_range), &args);
+}
+
+void
+F(_n, sub_parallel) (M(N)        *a,
+                     M(N)        *b,
+                     M(N)        *r,
+                     const guint  n_threads)
+{
+  M(NRangeArgs) args = {a, b, r, NULL, NULL, NULL, FALSE};
+
+  g_return_if_fail (a != r);
+  g_return_if_fail (b != r);
+  CRANK_MAT_WARN_IF_SIZE_MISMATCH2(CRANK_MAT_NAME, "sub", a, b);
+  CRANK_MAT_ALLOC(r, T, a->rn, a->cn);
+
+  crank_parallel_for (n_threads, 0, a->rn * a->cn,
+                      CRANK_MAT_PARALLEL_GRAIN,
+                      F(_n, sub_range), &args);
+}
+
+
+//////// Range Functions ///////////////////////////////////////////////////////
+
+static void
+F(_n, transpose_range) (const guint start,
+                        const guint end,
+                        gpointer    userdata)
+{
+  M(NRangeArgs) *args = (M(NRangeArgs)*) userdata;
+  M(N) *a = args->a;
+  M(N) *r = args->r;
+
+  guint i;
+  guint j;
+  guint jb;
+
+  // Blocks columns, so that written rows of r stay in cache.
+  for (jb = 0; jb < a->cn; jb += CRANK_MAT_TRANSPOSE_BLOCK)
+    {
+      guint je = MIN (jb + CRANK_MAT_TRANSPOSE_BLOCK, a->cn);
+
+      for (i = start; i < end; i++)
+        {
+          T *arowi = F(_n, get_rowp) (a, i);
+
+          for (j = jb; j < je; j++)
+            F(_n, set) (r, j, i, arowi[j]);
+        }
+    }
+}
+
+static void
+F(_n, inverse_range) (const guint start,
+                      const guint end,
+                      gpointer    userdata)
+{
+  M(NRangeArgs) *args = (M(NRangeArgs)*) userdata;
+  M(N) *lu = args->a;
+  M(N) *rt = args->r;
+  guint *pinv = args->index;
+
+  guint n = lu->rn;
+  guint c;
+  guint i;
+  guint k;
+
+  for (c = start; c < end; c++)
+    {
+      T *x = F(_n, get_rowp) (rt, c);
+      guint   c0 = pinv[c];
+
+      // Forward substitution: L y = P e[c], where P e[c] = e[pinv[c]]
+      for (i = 0; i < c0; i++)
+        x[i] = 0;
+
+      x[c0] = 1 / F(_n, get) (lu, c0, c0);
+
+      for (i = c0 + 1; i < n; i++)
+        {
+          T *lurowi = F(_n, get_rowp) (lu, i);
+          T sum = 0;
+
+          for (k = c0; k < i; k++)
+            sum += lurowi[k] * x[k];
+
+          x[i] = -sum / lurowi[i];
+        }
+
+      // Backward substitution: U x = y, Diagonal of U is 1.
+      i = n - 1;
+      while (0 < i)
+        {
+          T *lurowi;
+          T sum = 0;
+
+          i--;
+          lurowi = F(_n, get_rowp) (lu, i);
+
+          for (k = i + 1; k < n; k++)
+            sum += lurowi[k] * x[k];
+
+          x[i] -= sum;
+        }
+    }
+}
+
+/*
+ * Exchanges two rows of matrix.
+ */
+static void
+F(_n, swap_rows) (M(N)        *a,
+                  const guint  i,
+                  const guint  j)
+{
+  guint c;
+  T *arowi;
+  T *arowj;
+
+  if (i == j)
+    return;
+
+  arowi = F(_n, get_rowp) (a, i);
+  arowj = F(_n, get_rowp) (a, j);
+
+  for (c = 0; c < a->cn; c++)
+    {
+      T temp = arowi[c];
+      arowi[c] = arowj[c];
+      arowj[c] = temp;
+    }
+}
+
+/*
+ * Gets inverse from factorization, by solving each columns in parallel.
+ */
+static void
+F(_n, inverse_lu) (LU          *lu,
+                   M(N)        *r,
+                   const guint  n_threads)
+{
+  M(N) rt;
+  M(NRangeArgs) args = {&lu->lu, NULL, &rt, NULL, NULL, NULL, FALSE};
+
+  CrankMatArena *scratch = crank_mat_arena_get_scratch ();
+  gsize mark = crank_mat_arena_get_mark (scratch);
+
+  guint n = lu->lu.rn;
+  guint nt = crank_parallel_resolve_n_threads (n_threads);
+  guint i;
+
+  args.index = crank_mat_arena_alloc (scratch, sizeof (guint) * n);
+  for (i = 0; i < n; i++)
+    args.index[lu->p.data[i]] = i;
+
+  // Columns of inverse are stored as rows of rt.
+  F(_n, init_arena) (&rt, scratch, n, n);
+
+  crank_parallel_for (nt, 0, n,
+                      CRANK_MAT_PARALLEL_ROW_GRAIN (n * n),
+                      F(_n, inverse_range), &args);
+
+  F(_n, transpose_parallel) (&rt, r, nt);
+
+  crank_mat_arena_rewind (scratch, mark);
+}
+
+static void
+F(_n, mulv_range) (const guint start,
+                   const guint end,
+                   gpointer    userdata)
+{
+  M(NRangeArgs) *args = (M(NRangeArgs)*) userdata;
+  M(N) *a = args->a;
+  V(N) *b = args->vb;
+  V(N) *r = args->vr;
+
+  guint i;
+  guint j;
+
+  for (i = start; i < end; i++)
+    {
+      T *arowi = F(_n, get_rowp) (a, i);
+
+      for (j = 0; j < a->cn; j++)
+        r->data[i] += arowi[j] * b->data[j];
+    }
+}
+
+static void
+F(_n, mul_range) (const guint start,
+                  const guint end,
+                  gpointer    userdata)
+{
+  M(NRangeArgs) *args = (M(NRangeArgs)*) userdata;
+  M(N) *a = args->a;
+  M(N) *b = args->b;
+  M(N) *r = args->r;
+
+  guint i;
+  guint j;
+  guint k;
+
+  // Blocked kernel is used when b is not transposed.
+  if (args->blocked)
+    {
+      CRANK_MAT_GEMM (end - start, b->cn, a->cn,
+                      F(_n, get_rowp) (a, start), a->cn,
+                      b->data, b->cn,
+                      F(_n, get_rowp) (r, start), r->cn);
+      return;
+    }
+
+  for (i = start; i < end; i++)
+    {
+      T *arowi = F(_n, get_rowp) (a, i);
+      T *rrowi = F(_n, get_rowp) (r, i);
+
+      for (j = 0; j < b->rn; j++)
+        {
+          T *bcolj = F(_n, get_rowp) (b, j);
+
+          for (k = 0; k < a->cn; k++)
+            rrowi[j] += arowi[k] * bcolj[k];
+        }
+    }
+}
+
+static void
+F(_n, add_range) (const guint start,
+                  const guint end,
+                  gpointer    userdata)
+{
+  M(NRangeArgs) *args = (M(NRangeArgs)*) userdata;
+  guint i;
+
+  for (i = start; i < end; i++)
+    args->r->data[i] = args->a->data[i] + args->b->data[i];
+}
+
+static void
+F(_n, sub_range) (const guint start,
+                  const guint end,
+                  gpointer    userdata)
+{
+  M(NRangeArgs) *args = (M(NRangeArgs)*) userdata;
+  guint i;
+
+  for (i = start; i < end; i++)
+    args->r->data[i] = args->a->data[i] - args->b->data[i];
+}
+
+
+//////// GValue Transformation /////////////////////////////////////////////////
+
+static void
+F(_n, transform_from_m2) (const GValue *src,
+                          GValue       *dest)
+{
+  M(N) *mat = g_new (M(N), 1);
+  T *array = (T*) g_value_get_boxed (src);
+
+  F(_n, init_arr) (mat, 2, 2, array);
+  g_value_take_boxed (dest, mat);
+}
+
+static void
+F(_n, transform_from_m3) (const GValue *src,
+                          GValue       *dest)
+{
+  M(N) *mat = g_new (M(N), 1);
+  T *array = (T*) g_value_get_boxed (src);
+
+  F(_n, init_arr) (mat, 3, 3, array);
+  g_value_take_boxed (dest, mat);
+}
+
+static void
+F(_n, transform_from_m4) (const GValue *src,
+                          GValue       *dest)
+{
+  M(N) *mat = g_new (M(N), 1);
+  T *array = (T*) g_value_get_boxed (src);
+
+  F(_n, init_arr) (mat, 4, 4, array);
+
+  g_value_take_boxed (dest, mat);
+}
+
+static void
+F(_n, transform_to_string) (const GValue *src,
+                            GValue       *dest)
+{
+  M(N) *mat = (M(N)*) g_value_get_boxed (src);
+  gchar *str = F(_n, to_string) (mat);
+
+  g_value_take_string (dest, str);
+}
+
+#undef CRANK_MAT_PARALLEL_GRAIN
+#undef CRANK_MAT_PARALLEL_ROW_GRAIN
+#undef CRANK_MAT_TRANSPOSE_BLOCK
+#undef CRANK_MAT_MUL_PANEL
+#undef CRANK_MAT4_BATCH_CHUNK
+#undef DET4
+
+#undef T
+#undef M
+#undef V
+#undef LU
+#undef F
+#undef FV
+#undef FLU
+#undef I
+#undef V256
+#undef W256
+
+#endif
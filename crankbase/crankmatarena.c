@@ -0,0 +1,385 @@
+/* Copyright (C) 2015, WSID   */
+
+/* Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+#define _CRANKBASE_INSIDE
+
+#include <string.h>
+
+#include <glib.h>
+#include <glib-object.h>
+
+#include "crankcpu-private.h"
+#include "crankmatarena.h"
+
+/**
+ * SECTION: crankmatarena
+ * @title: Arena for Vectors and Matrices
+ * @short_description: Scoped allocation for temporary vectors and matrices.
+ * @stability: Unstable
+ * @include: crankbase.h
+ *
+ * #CrankMatArena is a region of memory, where memory is taken by moving a
+ * pointer forward. Memory taken from arena is not freed individually, but all
+ * at once, by rewinding arena.
+ *
+ * This is useful when many of temporary vectors and matrices are created and
+ * discarded in a loop, as a frame of simulation. Each of them would otherwise
+ * calls malloc() and free().
+ *
+ * # Usage
+ *
+ * An arena can be used in scoped way, by taking mark and rewinding to it.
+ *
+ * |[<!-- language="C" -->
+ *   gsize mark = crank_mat_arena_get_mark (arena);
+ *
+ *   crank_mat_float_n_init_arena (&tmp, arena, 16, 16);
+ *   ... use tmp ...
+ *
+ *   crank_mat_arena_rewind (arena, mark);
+ * ]|
+ *
+ * Or it can be reset at end of each frame, with crank_mat_arena_reset().
+ *
+ * As vectors and matrices from arena does not own their data, they should not
+ * be passed to _fini() functions, or to functions that reallocates their data.
+ *
+ * Memory from arena is aligned to 64 bytes.
+ *
+ * # Growth
+ *
+ * When an allocation does not fit in current block, new block is added. When
+ * an arena is rewound to the beginning, blocks are merged into one block that
+ * can hold all of them. So an arena that is used in same way for each frame
+ * stops allocating after first few frames.
+ *
+ * # Scratch arena
+ *
+ * Each thread has a scratch arena, from crank_mat_arena_get_scratch(). Some
+ * of functions use it for their temporary buffers, and rewinds it before they
+ * return. Users may use it in same way, but should not keep memory from it
+ * after returning to their callers.
+ */
+
+G_DEFINE_BOXED_TYPE (CrankMatArena,
+                     crank_mat_arena,
+                     crank_mat_arena_ref,
+                     crank_mat_arena_unref);
+
+//////// Private Type //////////////////////////////////////////////////////////
+
+typedef struct _CrankMatArenaBlock {
+  guint8 *data;
+  gsize   size;
+} CrankMatArenaBlock;
+
+/**
+ * CrankMatArena:
+ *
+ * A structure for arena.
+ */
+struct _CrankMatArena {
+  gsize               block_size;
+
+  CrankMatArenaBlock *blocks;
+  guint               nblocks;
+
+  guint               current;
+  gsize               base;
+  gsize               offset;
+
+  guint               _refc;
+};
+
+//////// Internal Declaration //////////////////////////////////////////////////
+
+static void crank_mat_arena_free_blocks (CrankMatArena *arena);
+
+static void crank_mat_arena_add_block   (CrankMatArena *arena,
+                                         const gsize    size);
+
+static GPrivate crank_mat_arena_scratch =
+    G_PRIVATE_INIT ((GDestroyNotify) crank_mat_arena_unref);
+
+
+//////// Definition ////////////////////////////////////////////////////////////
+
+/**
+ * crank_mat_arena_new:
+ * @block_size: Size of a block in bytes, or 0 for
+ *     %CRANK_MAT_ARENA_BLOCK_SIZE.
+ *
+ * Constructs an empty arena. Blocks are allocated when memory is requested.
+ *
+ * Returns: (transfer full): Newly created arena.
+ */
+CrankMatArena*
+crank_mat_arena_new (const gsize block_size)
+{
+  CrankMatArena *arena = g_new (CrankMatArena, 1);
+
+  arena->block_size = (block_size != 0) ?
+                      block_size : CRANK_MAT_ARENA_BLOCK_SIZE;
+  arena->blocks = NULL;
+  arena->nblocks = 0;
+  arena->current = 0;
+  arena->base = 0;
+  arena->offset = 0;
+  arena->_refc = 1;
+
+  return arena;
+}
+
+/**
+ * crank_mat_arena_ref:
+ * @arena: An arena.
+ *
+ * Increase reference count by 1.
+ *
+ * Returns: (transfer full): An arena with increased reference count.
+ */
+CrankMatArena*
+crank_mat_arena_ref (CrankMatArena *arena)
+{
+  g_atomic_int_inc (&(arena->_refc));
+  return arena;
+}
+
+/**
+ * crank_mat_arena_unref:
+ * @arena: (transfer full): An arena.
+ *
+ * Decreases reference count by 1. If reference count reaches 0, then arena and
+ * all memory from it are freed.
+ */
+void
+crank_mat_arena_unref (CrankMatArena *arena)
+{
+  if (g_atomic_int_dec_and_test (&arena->_refc))
+    {
+      crank_mat_arena_free_blocks (arena);
+      g_free (arena);
+    }
+}
+
+/**
+ * crank_mat_arena_get_scratch:
+ *
+ * Gets scratch arena of current thread. It is created at first call, and freed
+ * when thread exits.
+ *
+ * Functions that use scratch arena should rewind it to mark, which is taken at
+ * the beginning of them, before they return.
+ *
+ * Returns: (transfer none): Scratch arena of current thread.
+ */
+CrankMatArena*
+crank_mat_arena_get_scratch (void)
+{
+  CrankMatArena *arena = g_private_get (&crank_mat_arena_scratch);
+
+  if (G_UNLIKELY (arena == NULL))
+    {
+      arena = crank_mat_arena_new (0);
+      g_private_set (&crank_mat_arena_scratch, arena);
+    }
+
+  return arena;
+}
+
+
+/**
+ * crank_mat_arena_alloc:
+ * @arena: An arena.
+ * @size: Size of memory in bytes.
+ *
+ * Takes memory from arena. Memory is aligned to 64 bytes, and valid until arena
+ * is rewound to mark that is taken before this call.
+ *
+ * Returns: (transfer none) (nullable): Memory from arena, or %NULL if @size is
+ *     0.
+ */
+gpointer
+crank_mat_arena_alloc (CrankMatArena *arena,
+                       const gsize    size)
+{
+  gsize asize;
+  gpointer result;
+
+  if (size == 0)
+    return NULL;
+
+  // Keep every allocation aligned.
+  asize = (size + CRANK_CPU_ALIGN - 1) & ~((gsize) CRANK_CPU_ALIGN - 1);
+
+  while ((arena->nblocks == 0) ||
+         (arena->blocks[arena->current].size < arena->offset + asize))
+    {
+      if (arena->nblocks == 0)
+        {
+          crank_mat_arena_add_block (arena, MAX (arena->block_size, asize));
+          continue;
+        }
+
+      if (arena->current + 1 == arena->nblocks)
+        crank_mat_arena_add_block (arena, MAX (arena->block_size, asize));
+
+      arena->base += arena->blocks[arena->current].size;
+      arena->current++;
+      arena->offset = 0;
+    }
+
+  result = arena->blocks[arena->current].data + arena->offset;
+  arena->offset += asize;
+
+  return result;
+}
+
+/**
+ * crank_mat_arena_alloc0:
+ * @arena: An arena.
+ * @size: Size of memory in bytes.
+ *
+ * Takes memory from arena, and fills it with 0.
+ *
+ * Returns: (transfer none) (nullable): Memory from arena, or %NULL if @size is
+ *     0.
+ */
+gpointer
+crank_mat_arena_alloc0 (CrankMatArena *arena,
+                        const gsize    size)
+{
+  gpointer result = crank_mat_arena_alloc (arena, size);
+
+  if (result != NULL)
+    memset (result, 0, size);
+
+  return result;
+}
+
+/**
+ * crank_mat_arena_get_mark:
+ * @arena: An arena.
+ *
+ * Gets current position of arena, to rewind to it later.
+ *
+ * Returns: A mark of current position.
+ */
+gsize
+crank_mat_arena_get_mark (CrankMatArena *arena)
+{
+  return arena->base + arena->offset;
+}
+
+/**
+ * crank_mat_arena_rewind:
+ * @arena: An arena.
+ * @mark: A mark from crank_mat_arena_get_mark().
+ *
+ * Rewinds arena to @mark. All memory taken after @mark becomes invalid.
+ *
+ * If @mark is 0, blocks are merged into one.
+ */
+void
+crank_mat_arena_rewind (CrankMatArena *arena,
+                        const gsize    mark)
+{
+  g_return_if_fail (mark <= arena->base + arena->offset);
+
+  while (mark < arena->base)
+    {
+      arena->current--;
+      arena->base -= arena->blocks[arena->current].size;
+    }
+
+  arena->offset = mark - arena->base;
+
+  if ((mark == 0) && (1 < arena->nblocks))
+    {
+      gsize size = crank_mat_arena_get_capacity (arena);
+
+      crank_mat_arena_free_blocks (arena);
+      crank_mat_arena_add_block (arena, size);
+    }
+}
+
+/**
+ * crank_mat_arena_reset:
+ * @arena: An arena.
+ *
+ * Rewinds arena to the beginning. This is same to rewinding to 0.
+ */
+void
+crank_mat_arena_reset (CrankMatArena *arena)
+{
+  crank_mat_arena_rewind (arena, 0);
+}
+
+/**
+ * crank_mat_arena_get_capacity:
+ * @arena: An arena.
+ *
+ * Gets total size of blocks of arena.
+ *
+ * Returns: Total size of blocks, in bytes.
+ */
+gsize
+crank_mat_arena_get_capacity (CrankMatArena *arena)
+{
+  gsize result = 0;
+  guint i;
+
+  for (i = 0; i < arena->nblocks; i++)
+    result += arena->blocks[i].size;
+
+  return result;
+}
+
+
+//////// Internal Definition ///////////////////////////////////////////////////
+
+static void
+crank_mat_arena_free_blocks (CrankMatArena *arena)
+{
+  guint i;
+
+  for (i = 0; i < arena->nblocks; i++)
+    g_free (arena->blocks[i].data);
+
+  g_free (arena->blocks);
+
+  arena->blocks = NULL;
+  arena->nblocks = 0;
+  arena->current = 0;
+  arena->base = 0;
+  arena->offset = 0;
+}
+
+static void
+crank_mat_arena_add_block (CrankMatArena *arena,
+                           const gsize    size)
+{
+  arena->blocks = g_renew (CrankMatArenaBlock, arena->blocks,
+                           arena->nblocks + 1);
+
+  arena->blocks[arena->nblocks].data = _crank_cpu_alloc_aligned (size);
+  arena->blocks[arena->nblocks].size = size;
+  arena->nblocks++;
+}
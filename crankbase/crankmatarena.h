@@ -0,0 +1,79 @@
+#ifndef CRANKMATARENA_H
+#define CRANKMATARENA_H
+
+/* Copyright (C) 2015, WSID   */
+
+/* Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef _CRANKBASE_INSIDE
+#error crankmatarena.h cannot be included directly.
+#endif
+
+#include <glib.h>
+#include <glib-object.h>
+
+G_BEGIN_DECLS
+
+//////// Type Definition ///////////////////////////////////////////////////////
+
+#define CRANK_TYPE_MAT_ARENA (crank_mat_arena_get_type ())
+GType crank_mat_arena_get_type (void);
+
+typedef struct _CrankMatArena CrankMatArena;
+
+/**
+ * CRANK_MAT_ARENA_BLOCK_SIZE:
+ *
+ * Default size of a block of #CrankMatArena, in bytes.
+ */
+#define CRANK_MAT_ARENA_BLOCK_SIZE (64 * 1024)
+
+
+//////// Life cycle ////////////////////////////////////////////////////////////
+
+CrankMatArena  *crank_mat_arena_new           (const gsize block_size);
+
+CrankMatArena  *crank_mat_arena_ref           (CrankMatArena *arena);
+
+void            crank_mat_arena_unref         (CrankMatArena *arena);
+
+CrankMatArena  *crank_mat_arena_get_scratch   (void);
+
+
+//////// Allocation ////////////////////////////////////////////////////////////
+
+gpointer        crank_mat_arena_alloc         (CrankMatArena *arena,
+                                               const gsize    size);
+
+gpointer        crank_mat_arena_alloc0        (CrankMatArena *arena,
+                                               const gsize    size);
+
+gsize           crank_mat_arena_get_mark      (CrankMatArena *arena);
+
+void            crank_mat_arena_rewind        (CrankMatArena *arena,
+                                               const gsize    mark);
+
+void            crank_mat_arena_reset         (CrankMatArena *arena);
+
+gsize           crank_mat_arena_get_capacity  (CrankMatArena *arena);
+
+G_END_DECLS
+
+#endif
@@ -41,6 +41,11 @@ typedef struct _CrankVecFloat3 CrankVecFloat3;
 typedef struct _CrankVecFloat4 CrankVecFloat4;
 typedef struct _CrankVecFloatN CrankVecFloatN;
 
+typedef struct _CrankVecDouble2 CrankVecDouble2;
+typedef struct _CrankVecDouble3 CrankVecDouble3;
+typedef struct _CrankVecDouble4 CrankVecDouble4;
+typedef struct _CrankVecDoubleN CrankVecDoubleN;
+
 typedef struct _CrankVecCplxFloatN CrankVecCplxFloatN;
 
 typedef struct _CrankMatFloat2 CrankMatFloat2;
@@ -48,6 +53,11 @@ typedef struct _CrankMatFloat3 CrankMatFloat3;
 typedef struct _CrankMatFloat4 CrankMatFloat4;
 typedef struct _CrankMatFloatN CrankMatFloatN;
 
+typedef struct _CrankMatDouble2 CrankMatDouble2;
+typedef struct _CrankMatDouble3 CrankMatDouble3;
+typedef struct _CrankMatDouble4 CrankMatDouble4;
+typedef struct _CrankMatDoubleN CrankMatDoubleN;
+
 typedef struct _CrankMatCplxFloatN CrankMatCplxFloatN;
 
 /**
@@ -83,9 +93,9 @@ typedef struct _CrankMatCplxFloatN CrankMatCplxFloatN;
  */
 #define CRANK_MAT_ALLOC(m,G,_rn,_cn)                                        \
   G_STMT_START {                                                          \
-    (m)->data = g_new (G, _rn * _cn);                                   \
-    (m)->rn = _rn;                                                      \
-    (m)->cn = _cn;                                                      \
+    (m)->data = g_new (G, (_rn) * (_cn));                               \
+    (m)->rn = (_rn);                                                    \
+    (m)->cn = (_cn);                                                    \
   } G_STMT_END
 
 /**
@@ -99,9 +109,9 @@ typedef struct _CrankMatCplxFloatN CrankMatCplxFloatN;
  */
 #define CRANK_MAT_ALLOC0(m,G,_rn,_cn)                                       \
   G_STMT_START {                                                          \
-    (m)->data = g_new0 (G, _rn * _cn);                                  \
-    (m)->rn = _rn;                                                      \
-    (m)->cn = _cn;                                                      \
+    (m)->data = g_new0 (G, (_rn) * (_cn));                              \
+    (m)->rn = (_rn);                                                    \
+    (m)->cn = (_cn);                                                    \
   } G_STMT_END
 
 //////// Getter and setter /////////////////////////////////////////////////////
@@ -38,6 +38,7 @@
 #include "crankmatcommon.h"
 #include "crankmatfloat.h"
 #include "crankmatcplxfloat.h"
+#include "crankparallel.h"
 
 
 /**
@@ -969,6 +970,61 @@ crank_mat_cplx_float_n_free (CrankMatCplxFloatN *mat)
 }
 
 
+//////// Private Definitions ///////////////////////////////////////////////////
+
+// Minimum count of elements that a thread processes, in parallel operations.
+#define CRANK_MAT_PARALLEL_GRAIN  8192
+
+// Minimum count of rows that a thread processes, when each row costs given.
+#define CRANK_MAT_PARALLEL_ROW_GRAIN(cost) \
+  MAX (1, CRANK_MAT_PARALLEL_GRAIN / MAX ((cost), 1))
+
+// Minimum size of matrix to get inverse in parallel.
+#define CRANK_MAT_PARALLEL_INVERSE_MIN  32
+
+// Size of column block in transposing.
+#define CRANK_MAT_TRANSPOSE_BLOCK 32
+
+/*
+ * Arguments for range functions, which processes part of operation.
+ * See crank_parallel_for().
+ */
+typedef struct _CrankMatCplxFloatNRangeArgs {
+  CrankMatCplxFloatN *a;
+  CrankMatCplxFloatN *b;
+  CrankMatCplxFloatN *r;
+  CrankVecCplxFloatN *vb;
+  CrankVecCplxFloatN *vr;
+} CrankMatCplxFloatNRangeArgs;
+
+static void crank_mat_cplx_float_n_inverse_serial (CrankMatCplxFloatN *a,
+                                                   CrankMatCplxFloatN *r);
+
+static void crank_mat_cplx_float_n_transpose_range (const guint start,
+                                                    const guint end,
+                                                    gpointer    userdata);
+
+static void crank_mat_cplx_float_n_inverse_range (const guint start,
+                                                  const guint end,
+                                                  gpointer    userdata);
+
+static void crank_mat_cplx_float_n_mulv_range (const guint start,
+                                               const guint end,
+                                               gpointer    userdata);
+
+static void crank_mat_cplx_float_n_mul_range (const guint start,
+                                              const guint end,
+                                              gpointer    userdata);
+
+static void crank_mat_cplx_float_n_add_range (const guint start,
+                                              const guint end,
+                                              gpointer    userdata);
+
+static void crank_mat_cplx_float_n_sub_range (const guint start,
+                                              const guint end,
+                                              gpointer    userdata);
+
+
 //////// Basic Operations //////////////////////////////////////////////////////
 
 /**
@@ -2151,23 +2207,15 @@ crank_mat_cplx_float_n_neg_self (CrankMatCplxFloatN *a)
  * @r: (out): A Matrix to store result.
  *
  * Gets a transpose of matrix.
+ *
+ * This runs on threads by global setting. See crank_parallel_set_n_threads().
  */
 void
 crank_mat_cplx_float_n_transpose (CrankMatCplxFloatN *a,
                                   CrankMatCplxFloatN *r)
 {
-  guint i;
-  guint j;
-
-  CrankCplxFloat *data = g_new (CrankCplxFloat, a->rn * a->cn);
-
-  for (i = 0; i < a->rn; i++)
-    for (j = 0; j < a->cn; j++)
-      crank_cplx_float_copy (
-        a->data + (i * a->cn) + j,
-        data + (j * a->rn) + i);
-
-  crank_mat_cplx_float_n_init_arr_take (r, a->cn, a->rn, data);
+  crank_mat_cplx_float_n_transpose_parallel (a, r,
+                                             crank_parallel_get_n_threads ());
 }
 
 /**
@@ -2201,38 +2249,15 @@ crank_mat_cplx_float_n_transpose_self (CrankMatCplxFloatN *a)
  *
  * Gets an inverse of matrix.
  * If the matrix is singular, then NaN matrix may be returned.
+ *
+ * This runs on threads by global setting. See crank_parallel_set_n_threads().
  */
 void
 crank_mat_cplx_float_n_inverse (CrankMatCplxFloatN *a,
                                 CrankMatCplxFloatN *r)
 {
-  CrankMatCplxFloatN l;
-  CrankMatCplxFloatN u;
-
-  guint i;
-
-  CRANK_MAT_WARN_IF_NON_SQUARE("MatCplxFloatN", "inverse", a);
-
-  if (crank_lu_mat_cplx_float_n (a, &l, &u))
-    {
-
-      CrankMatCplxFloatN linv;
-      CrankMatCplxFloatN uinv;
-
-      crank_mat_cplx_float_n_lower_tri_inverse (&l, &linv);
-      crank_mat_cplx_float_n_upper_tri_inverse (&u, &uinv);
-
-      crank_mat_cplx_float_n_mul (&uinv, &linv, r);
-
-      crank_mat_cplx_float_n_fini (&l);
-      crank_mat_cplx_float_n_fini (&u);
-      crank_mat_cplx_float_n_fini (&linv);
-      crank_mat_cplx_float_n_fini (&uinv);
-    }
-  else
-    {
-      crank_mat_cplx_float_n_init_fill_uc (r, a->rn, a->rn, NAN, NAN);
-    }
+  crank_mat_cplx_float_n_inverse_parallel (a, r,
+                                           crank_parallel_get_n_threads ());
 }
 
 /**
@@ -2609,36 +2634,16 @@ crank_mat_cplx_float_n_mulrv (CrankMatCplxFloatN *a,
  * @r: (out): A Matrix to store result.
  *
  * Multiplies a matrix by vector.
+ *
+ * This runs on threads by global setting. See crank_parallel_set_n_threads().
  */
 void
 crank_mat_cplx_float_n_mulv (CrankMatCplxFloatN *a,
                              CrankVecCplxFloatN *b,
                              CrankVecCplxFloatN *r)
 {
-  guint i;
-  guint j;
-
-  CrankCplxFloat *data;
-
-  g_return_if_fail (b != r);
-
-  g_return_if_fail (a->cn == b->n);
-
-  data = g_new0 (CrankCplxFloat, a->rn);
-
-  for (i = 0; i < a->rn; i++)
-    {
-      for (j = 0; j < a->cn; j++)
-        {
-          CrankCplxFloat mul;
-          crank_cplx_float_mul (a->data + (a->cn * i) + j,
-                                b->data + j,
-                                &mul);
-          crank_cplx_float_add_self (data + i,   &mul);
-        }
-    }
-
-  crank_vec_cplx_float_n_init_arr_take (r, a->rn, data);
+  crank_mat_cplx_float_n_mulv_parallel (a, b, r,
+                                        crank_parallel_get_n_threads ());
 }
 
 /**
@@ -2735,42 +2740,16 @@ crank_mat_cplx_float_n_mulr_self (CrankMatCplxFloatN *a,
  * @r: (out): A Matrix to store result.
  *
  * Multiplies two matrices.
+ *
+ * This runs on threads by global setting. See crank_parallel_set_n_threads().
  */
 void
 crank_mat_cplx_float_n_mul (CrankMatCplxFloatN *a,
                             CrankMatCplxFloatN *b,
                             CrankMatCplxFloatN *r)
 {
-  guint i;
-  guint j;
-  guint k;
-
-  CrankCplxFloat *data;
-
-  g_return_if_fail (a != r);
-  g_return_if_fail (b != r);
-  g_return_if_fail (a->cn == b->rn);
-
-  data = g_new0 (CrankCplxFloat, a->rn * b->cn);
-
-  for (i = 0; i < a->rn; i++)
-    {
-      for (j = 0; j < b->cn; j++)
-        {
-          for (k = 0; k < a->cn; k++)
-            {
-              CrankCplxFloat mul;
-              crank_cplx_float_mul (a->data + (a->cn * i) + k,
-                                    b->data + (b->cn * k) + j,
-                                    &mul);
-
-              crank_cplx_float_add_self (data + (b->cn * i) + j,
-                                         &mul);
-            }
-        }
-    }
-
-  crank_mat_cplx_float_n_init_arr_take (r, a->rn, b->cn, data);
+  crank_mat_cplx_float_n_mul_parallel (a, b, r,
+                                       crank_parallel_get_n_threads ());
 }
 
 /**
@@ -2949,31 +2928,16 @@ crank_mat_cplx_float_n_addr_self (CrankMatCplxFloatN *a,
  * @r: (out): A Matrix to store result.
  *
  * Adds a matrix.
+ *
+ * This runs on threads by global setting. See crank_parallel_set_n_threads().
  */
 void
 crank_mat_cplx_float_n_add (CrankMatCplxFloatN *a,
                             CrankMatCplxFloatN *b,
                             CrankMatCplxFloatN *r)
 {
-  guint i;
-  guint j;
-
-  g_return_if_fail (a != r);
-  g_return_if_fail (b != r);
-  CRANK_MAT_WARN_IF_SIZE_MISMATCH2("MatCplxFloatN", "add", a, b);
-
-  r->data = g_new (CrankCplxFloat, a->rn * a->cn);
-  r->rn = a->rn;
-  r->cn = a->cn;
-
-  for (i = 0; i < a->rn; i++)
-    {
-      for (j = 0; j < a->cn; j++)
-        {
-          guint ei = (i * a->cn) + j;
-          crank_cplx_float_add (a->data + ei, b->data + ei,   r->data + ei);
-        }
-    }
+  crank_mat_cplx_float_n_add_parallel (a, b, r,
+                                       crank_parallel_get_n_threads ());
 }
 
 /**
@@ -3060,32 +3024,16 @@ crank_mat_cplx_float_n_subr_self (CrankMatCplxFloatN *a,
  * @r: (out): A Matrix to store result.
  *
  * Subtracts a matrix.
+ *
+ * This runs on threads by global setting. See crank_parallel_set_n_threads().
  */
 void
 crank_mat_cplx_float_n_sub (CrankMatCplxFloatN *a,
                             CrankMatCplxFloatN *b,
                             CrankMatCplxFloatN *r)
 {
-  guint i;
-  guint j;
-
-  g_return_if_fail (a != r);
-  g_return_if_fail (b != r);
-  CRANK_MAT_WARN_IF_SIZE_MISMATCH2("MatCplxFloatN", "sub", a, b);
-
-  r->data = g_new (CrankCplxFloat, a->rn * a->cn);
-  r->rn = a->rn;
-  r->cn = a->cn;
-
-  for (i = 0; i < a->rn; i++)
-    {
-      for (j = 0; j < a->cn; j++)
-        {
-          guint ei = (i * a->cn) + j;
-
-          crank_cplx_float_sub (a->data + ei, b->data + ei,   r->data + ei);
-        }
-    }
+  crank_mat_cplx_float_n_sub_parallel (a, b, r,
+                                       crank_parallel_get_n_threads ());
 }
 
 /**
@@ -3450,6 +3398,423 @@ crank_mat_cplx_float_n_diag_inverse (CrankMatCplxFloatN *a,
     }
 }
 
+//////// Parallel Operations ///////////////////////////////////////////////////
+
+/**
+ * crank_mat_cplx_float_n_transpose_parallel:
+ * @a: A Matrix.
+ * @r: (out): A Matrix to store result.
+ * @n_threads: Number of threads, or 0 for number of processors.
+ *
+ * Gets a transpose of matrix, with given number of threads.
+ */
+void
+crank_mat_cplx_float_n_transpose_parallel (CrankMatCplxFloatN *a,
+                                           CrankMatCplxFloatN *r,
+                                           const guint         n_threads)
+{
+  CrankMatCplxFloatNRangeArgs args = {a, NULL, r, NULL, NULL};
+
+  g_return_if_fail (a != r);
+
+  crank_mat_cplx_float_n_init_arr_take (r, a->cn, a->rn,
+                                        g_new (CrankCplxFloat,
+                                               a->rn * a->cn));
+
+  crank_parallel_for (n_threads, 0, a->rn,
+                      CRANK_MAT_PARALLEL_ROW_GRAIN (a->cn),
+                      crank_mat_cplx_float_n_transpose_range, &args);
+}
+
+/**
+ * crank_mat_cplx_float_n_inverse_parallel:
+ * @a: A Matrix.
+ * @r: (out): A Matrix to store result.
+ * @n_threads: Number of threads, or 0 for number of processors.
+ *
+ * Gets an inverse of matrix, with given number of threads.
+ * If the matrix is singular, then NaN matrix may be returned.
+ *
+ * After LU decomposition, each columns of inverse are solved by forward and
+ * backward substitution, which are independent to each other.
+ */
+void
+crank_mat_cplx_float_n_inverse_parallel (CrankMatCplxFloatN *a,
+                                         CrankMatCplxFloatN *r,
+                                         const guint         n_threads)
+{
+  CrankMatCplxFloatN l;
+  CrankMatCplxFloatN u;
+  CrankMatCplxFloatN rt;
+
+  CrankMatCplxFloatNRangeArgs args = {&l, &u, &rt, NULL, NULL};
+  guint nt;
+
+  g_return_if_fail (a != r);
+  CRANK_MAT_WARN_IF_NON_SQUARE("MatCplxFloatN", "inverse", a);
+
+  nt = crank_parallel_resolve_n_threads (n_threads);
+
+  if ((nt == 1) || (a->rn < CRANK_MAT_PARALLEL_INVERSE_MIN))
+    {
+      crank_mat_cplx_float_n_inverse_serial (a, r);
+      return;
+    }
+
+  if (crank_lu_mat_cplx_float_n (a, &l, &u))
+    {
+      // Columns of inverse are stored as rows of rt.
+      crank_mat_cplx_float_n_init_arr_take (&rt, a->rn, a->rn,
+                                            g_new (CrankCplxFloat,
+                                                   a->rn * a->rn));
+
+      crank_parallel_for (nt, 0, a->rn,
+                          CRANK_MAT_PARALLEL_ROW_GRAIN (a->rn * a->rn),
+                          crank_mat_cplx_float_n_inverse_range, &args);
+
+      crank_mat_cplx_float_n_transpose_parallel (&rt, r, nt);
+
+      crank_mat_cplx_float_n_fini (&l);
+      crank_mat_cplx_float_n_fini (&u);
+      crank_mat_cplx_float_n_fini (&rt);
+    }
+  else
+    {
+      crank_mat_cplx_float_n_init_fill_uc (r, a->rn, a->rn, NAN, NAN);
+    }
+}
+
+/**
+ * crank_mat_cplx_float_n_mulv_parallel:
+ * @a: A Matrix.
+ * @b: A Vector.
+ * @r: (out): A Vector to store result.
+ * @n_threads: Number of threads, or 0 for number of processors.
+ *
+ * Multiplies a matrix by vector, with given number of threads.
+ */
+void
+crank_mat_cplx_float_n_mulv_parallel (CrankMatCplxFloatN *a,
+                                      CrankVecCplxFloatN *b,
+                                      CrankVecCplxFloatN *r,
+                                      const guint         n_threads)
+{
+  CrankMatCplxFloatNRangeArgs args = {a, NULL, NULL, b, r};
+
+  g_return_if_fail (b != r);
+  g_return_if_fail (a->cn == b->n);
+
+  crank_vec_cplx_float_n_init_arr_take (r, a->rn,
+                                        g_new0 (CrankCplxFloat, a->rn));
+
+  crank_parallel_for (n_threads, 0, a->rn,
+                      CRANK_MAT_PARALLEL_ROW_GRAIN (a->cn),
+                      crank_mat_cplx_float_n_mulv_range, &args);
+}
+
+/**
+ * crank_mat_cplx_float_n_mul_parallel:
+ * @a: A Matrix.
+ * @b: A Matrix.
+ * @r: (out): A Matrix to store result.
+ * @n_threads: Number of threads, or 0 for number of processors.
+ *
+ * Multiplies two matrices, with given number of threads. Rows of result are
+ * split across threads.
+ */
+void
+crank_mat_cplx_float_n_mul_parallel (CrankMatCplxFloatN *a,
+                                     CrankMatCplxFloatN *b,
+                                     CrankMatCplxFloatN *r,
+                                     const guint         n_threads)
+{
+  CrankMatCplxFloatNRangeArgs args = {a, b, r, NULL, NULL};
+
+  g_return_if_fail (a != r);
+  g_return_if_fail (b != r);
+  g_return_if_fail (a->cn == b->rn);
+
+  crank_mat_cplx_float_n_init_arr_take (r, a->rn, b->cn,
+                                        g_new0 (CrankCplxFloat,
+                                                a->rn * b->cn));
+
+  crank_parallel_for (n_threads, 0, a->rn,
+                      CRANK_MAT_PARALLEL_ROW_GRAIN (a->cn * b->cn),
+                      crank_mat_cplx_float_n_mul_range, &args);
+}
+
+/**
+ * crank_mat_cplx_float_n_add_parallel:
+ * @a: A Matrix
+ * @b: A Matrix
+ * @r: (out): A Matrix to store result.
+ * @n_threads: Number of threads, or 0 for number of processors.
+ *
+ * Adds a matrix, with given number of threads.
+ */
+void
+crank_mat_cplx_float_n_add_parallel (CrankMatCplxFloatN *a,
+                                     CrankMatCplxFloatN *b,
+                                     CrankMatCplxFloatN *r,
+                                     const guint         n_threads)
+{
+  CrankMatCplxFloatNRangeArgs args = {a, b, r, NULL, NULL};
+
+  g_return_if_fail (a != r);
+  g_return_if_fail (b != r);
+  CRANK_MAT_WARN_IF_SIZE_MISMATCH2("MatCplxFloatN", "add", a, b);
+
+  r->data = g_new (CrankCplxFloat, a->rn * a->cn);
+  r->rn = a->rn;
+  r->cn = a->cn;
+
+  crank_parallel_for (n_threads, 0, a->rn * a->cn,
+                      CRANK_MAT_PARALLEL_GRAIN,
+                      crank_mat_cplx_float_n_add_range, &args);
+}
+
+/**
+ * crank_mat_cplx_float_n_sub_parallel:
+ * @a: A Matrix
+ * @b: A Matrix
+ * @r: (out): A Matrix to store result.
+ * @n_threads: Number of threads, or 0 for number of processors.
+ *
+ * Subtracts a matrix, with given number of threads.
+ */
+void
+crank_mat_cplx_float_n_sub_parallel (CrankMatCplxFloatN *a,
+                                     CrankMatCplxFloatN *b,
+                                     CrankMatCplxFloatN *r,
+                                     const guint         n_threads)
+{
+  CrankMatCplxFloatNRangeArgs args = {a, b, r, NULL, NULL};
+
+  g_return_if_fail (a != r);
+  g_return_if_fail (b != r);
+  CRANK_MAT_WARN_IF_SIZE_MISMATCH2("MatCplxFloatN", "sub", a, b);
+
+  r->data = g_new (CrankCplxFloat, a->rn * a->cn);
+  r->rn = a->rn;
+  r->cn = a->cn;
+
+  crank_parallel_for (n_threads, 0, a->rn * a->cn,
+                      CRANK_MAT_PARALLEL_GRAIN,
+                      crank_mat_cplx_float_n_sub_range, &args);
+}
+
+
+//////// Range Functions ///////////////////////////////////////////////////////
+
+static void
+crank_mat_cplx_float_n_transpose_range (const guint start,
+                                        const guint end,
+                                        gpointer    userdata)
+{
+  CrankMatCplxFloatNRangeArgs *args = (CrankMatCplxFloatNRangeArgs*) userdata;
+  CrankMatCplxFloatN *a = args->a;
+  CrankMatCplxFloatN *r = args->r;
+
+  guint i;
+  guint j;
+  guint jb;
+
+  // Blocks columns, so that written rows of r stay in cache.
+  for (jb = 0; jb < a->cn; jb += CRANK_MAT_TRANSPOSE_BLOCK)
+    {
+      guint je = MIN (jb + CRANK_MAT_TRANSPOSE_BLOCK, a->cn);
+
+      for (i = start; i < end; i++)
+        for (j = jb; j < je; j++)
+          crank_cplx_float_copy (
+            a->data + (i * a->cn) + j,
+            r->data + (j * a->rn) + i);
+    }
+}
+
+static void
+crank_mat_cplx_float_n_inverse_range (const guint start,
+                                      const guint end,
+                                      gpointer    userdata)
+{
+  CrankMatCplxFloatNRangeArgs *args = (CrankMatCplxFloatNRangeArgs*) userdata;
+  CrankMatCplxFloatN *l = args->a;
+  CrankMatCplxFloatN *u = args->b;
+  CrankMatCplxFloatN *rt = args->r;
+
+  guint n = l->rn;
+  guint c;
+  guint i;
+  guint k;
+
+  for (c = start; c < end; c++)
+    {
+      CrankCplxFloat *x = rt->data + (c * n);
+
+      // Forward substitution: L y = e[c]
+      for (i = 0; i < c; i++)
+        crank_cplx_float_init (x + i, 0.0f, 0.0f);
+
+      crank_cplx_float_inverse (l->data + (c * n) + c, x + c);
+
+      for (i = c + 1; i < n; i++)
+        {
+          CrankCplxFloat *lrowi = l->data + (i * n);
+          CrankCplxFloat sum = {0.0f, 0.0f};
+          CrankCplxFloat mul;
+
+          for (k = c; k < i; k++)
+            {
+              crank_cplx_float_mul (lrowi + k, x + k, &mul);
+              crank_cplx_float_add_self (&sum, &mul);
+            }
+
+          crank_cplx_float_neg_self (&sum);
+          crank_cplx_float_div (&sum, lrowi + i, x + i);
+        }
+
+      // Backward substitution: U x = y, Diagonal of U is 1.
+      i = n - 1;
+      while (0 < i)
+        {
+          CrankCplxFloat *urowi;
+          CrankCplxFloat sum = {0.0f, 0.0f};
+          CrankCplxFloat mul;
+
+          i--;
+          urowi = u->data + (i * n);
+
+          for (k = i + 1; k < n; k++)
+            {
+              crank_cplx_float_mul (urowi + k, x + k, &mul);
+              crank_cplx_float_add_self (&sum, &mul);
+            }
+
+          crank_cplx_float_sub_self (x + i, &sum);
+        }
+    }
+}
+
+static void
+crank_mat_cplx_float_n_mulv_range (const guint start,
+                                   const guint end,
+                                   gpointer    userdata)
+{
+  CrankMatCplxFloatNRangeArgs *args = (CrankMatCplxFloatNRangeArgs*) userdata;
+  CrankMatCplxFloatN *a = args->a;
+  CrankVecCplxFloatN *b = args->vb;
+  CrankVecCplxFloatN *r = args->vr;
+
+  guint i;
+  guint j;
+
+  for (i = start; i < end; i++)
+    {
+      for (j = 0; j < a->cn; j++)
+        {
+          CrankCplxFloat mul;
+          crank_cplx_float_mul (a->data + (a->cn * i) + j,
+                                b->data + j,
+                                &mul);
+          crank_cplx_float_add_self (r->data + i,   &mul);
+        }
+    }
+}
+
+static void
+crank_mat_cplx_float_n_mul_range (const guint start,
+                                  const guint end,
+                                  gpointer    userdata)
+{
+  CrankMatCplxFloatNRangeArgs *args = (CrankMatCplxFloatNRangeArgs*) userdata;
+  CrankMatCplxFloatN *a = args->a;
+  CrankMatCplxFloatN *b = args->b;
+  CrankMatCplxFloatN *r = args->r;
+
+  guint i;
+  guint j;
+  guint k;
+
+  // Iterates in i-k-j order, so that b and r are accessed by rows.
+  for (i = start; i < end; i++)
+    {
+      CrankCplxFloat *rrowi = r->data + (b->cn * i);
+
+      for (k = 0; k < a->cn; k++)
+        {
+          CrankCplxFloat *aik = a->data + (a->cn * i) + k;
+          CrankCplxFloat *browk = b->data + (b->cn * k);
+
+          for (j = 0; j < b->cn; j++)
+            {
+              CrankCplxFloat mul;
+              crank_cplx_float_mul (aik, browk + j, &mul);
+              crank_cplx_float_add_self (rrowi + j, &mul);
+            }
+        }
+    }
+}
+
+static void
+crank_mat_cplx_float_n_add_range (const guint start,
+                                  const guint end,
+                                  gpointer    userdata)
+{
+  CrankMatCplxFloatNRangeArgs *args = (CrankMatCplxFloatNRangeArgs*) userdata;
+  guint i;
+
+  for (i = start; i < end; i++)
+    crank_cplx_float_add (args->a->data + i,
+                          args->b->data + i,
+                          args->r->data + i);
+}
+
+static void
+crank_mat_cplx_float_n_sub_range (const guint start,
+                                  const guint end,
+                                  gpointer    userdata)
+{
+  CrankMatCplxFloatNRangeArgs *args = (CrankMatCplxFloatNRangeArgs*) userdata;
+  guint i;
+
+  for (i = start; i < end; i++)
+    crank_cplx_float_sub (args->a->data + i,
+                          args->b->data + i,
+                          args->r->data + i);
+}
+
+
+//////// Serial Operations /////////////////////////////////////////////////////
+
+static void
+crank_mat_cplx_float_n_inverse_serial (CrankMatCplxFloatN *a,
+                                       CrankMatCplxFloatN *r)
+{
+  CrankMatCplxFloatN l;
+  CrankMatCplxFloatN u;
+
+  if (crank_lu_mat_cplx_float_n (a, &l, &u))
+    {
+      CrankMatCplxFloatN linv;
+      CrankMatCplxFloatN uinv;
+
+      crank_mat_cplx_float_n_lower_tri_inverse (&l, &linv);
+      crank_mat_cplx_float_n_upper_tri_inverse (&u, &uinv);
+
+      crank_mat_cplx_float_n_mul (&uinv, &linv, r);
+
+      crank_mat_cplx_float_n_fini (&l);
+      crank_mat_cplx_float_n_fini (&u);
+      crank_mat_cplx_float_n_fini (&linv);
+      crank_mat_cplx_float_n_fini (&uinv);
+    }
+  else
+    {
+      crank_mat_cplx_float_n_init_fill_uc (r, a->rn, a->rn, NAN, NAN);
+    }
+}
+
+
 //////// GValue Transform //////////////////////////////////////////////////////
 
 static void
@@ -501,6 +501,43 @@ void            crank_mat_cplx_float_n_lower_tri_inverse (
 void            crank_mat_cplx_float_n_diag_inverse (CrankMatCplxFloatN *a,
                                                      CrankMatCplxFloatN *r);
 
+
+//////// Parallel Operations ///////////////////////////////////////////////////
+
+void            crank_mat_cplx_float_n_transpose_parallel (
+  CrankMatCplxFloatN *a,
+  CrankMatCplxFloatN *r,
+  const guint         n_threads);
+
+void            crank_mat_cplx_float_n_inverse_parallel (
+  CrankMatCplxFloatN *a,
+  CrankMatCplxFloatN *r,
+  const guint         n_threads);
+
+void            crank_mat_cplx_float_n_mulv_parallel (
+  CrankMatCplxFloatN *a,
+  CrankVecCplxFloatN *b,
+  CrankVecCplxFloatN *r,
+  const guint         n_threads);
+
+void            crank_mat_cplx_float_n_mul_parallel (
+  CrankMatCplxFloatN *a,
+  CrankMatCplxFloatN *b,
+  CrankMatCplxFloatN *r,
+  const guint         n_threads);
+
+void            crank_mat_cplx_float_n_add_parallel (
+  CrankMatCplxFloatN *a,
+  CrankMatCplxFloatN *b,
+  CrankMatCplxFloatN *r,
+  const guint         n_threads);
+
+void            crank_mat_cplx_float_n_sub_parallel (
+  CrankMatCplxFloatN *a,
+  CrankMatCplxFloatN *b,
+  CrankMatCplxFloatN *r,
+  const guint         n_threads);
+
 G_END_DECLS
 
 #endif
\ No newline at end of file
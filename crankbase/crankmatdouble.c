@@ -0,0 +1,2756 @@
+/* Copyright (C) 2015, WSID   */
+
+/* Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+#define _CRANKBASE_INSIDE
+
+#include <math.h>
+#include <string.h>
+
+#include <glib.h>
+#include <glib-object.h>
+
+#include "crankbasemacro.h"
+#include "crankfunction.h"
+#include "crankpermutation.h"
+#include "crankveccommon.h"
+#include "crankvecdouble.h"
+#include "crankadvmat.h"
+
+#include "crankmatcommon.h"
+#include "crankmatdouble.h"
+
+#include "crankparallel.h"
+#include "crankgemm-private.h"
+#include "crankcpu-private.h"
+
+#ifdef CRANK_CPU_X86
+#include <immintrin.h>
+#endif
+
+/**
+ * SECTION: crankmatdouble
+ * @title: Double Matrices
+ * @short_description: Double precision valued matrices.
+ * @stability: unstable
+ * @include: crankbase.h
+ *
+ * Crank System provides double matrices, for where precision of float matrices
+ * is not enough.
+ *
+ * Currently following operations are supported.
+ *
+ * It is compared to dmat in GLSL
+ *
+ * # Notes about involuement of advanced operations.
+ *
+ * If matrices grows bigger, then it is harder and requires much operations to
+ * get its property. Therefore, we need to use advanced operations to decompose
+ * matrices to more simpler form.
+ * For example: Crank System uses LU Decomposition to get determinent of matrices.
+ *
+ * # #CrankMatDouble3 as Rotation representation.
+ *
+ * A 3x3 Matrix can handle linear transform and it is sometime used for
+ * rotation representations. but itself is not useful so much, so  4x4 Matrices
+ * are used more for rotations.
+ *
+ * # #CrankMatDouble4 as Rotation representation.
+ *
+ * A 4x4 Matrix can handle affine transform in 3D Space. (includes translation)
+ * And sometime it is used for rotation representation. This has some advantages.
+ *
+ * * Unified transformation representation.
+ *
+ *   4x4 Matrix can represent not only rotation, but also translate, scale and
+ *   even projections.
+ *   This means it can be combined with other transforms like translation and
+ *   scales, and so on, in arbitarily order.
+ *
+ * # Batch operations of #CrankMatDouble4
+ *
+ * Transforming many vectors by a matrix, one by one, takes much time in
+ * function calls. crank_mat_double4_batch_mulv() and
+ * crank_mat_double4_batch_transform() transform arrays of vectors at once, and
+ * crank_mat_double4_soa_transform() transforms separated streams of x, y and z
+ * components. crank_mat_double4_batch_mul() multiplies arrays of matrix pairs.
+ *
+ * They process several elements at once, with SIMD instructions, when CPU
+ * supports them.
+ *
+ * # Type Conversion
+ *
+ * <table><title>Type Conversion of #CrankMatDouble2</title>
+ *   <tgroup cols="3" align="left">
+ *     <thead> <row> <entry>Type</entry>
+ *                   <entry>Related Functions</entry>
+ *                   <entry>Remarks</entry> </row> </thead>
+ *     <tbody>
+ *       <row> <entry morerows="1">To string.</entry>
+ *             <entry>crank_mat_double2_to_string()</entry>
+ *             <entry>GValue Transform</entry> </row>
+ *       <row> <entry>crank_mat_double2_to_string_full()</entry> </row>
+ *
+ *       <row> <entry>To #CrankMatDoubleN.</entry>
+ *             <entry>crank_mat_double_n_init_arr()</entry>
+ *             <entry>GValue Transform,
+ *                    Cast matrix into array,
+ *                    Defined at #CrankMatDoubleN</entry> </row>
+ *     </tbody>
+ *   </tgroup>
+ * </table>
+ *
+ * <table><title>Type Conversion of #CrankMatDouble3</title>
+ *   <tgroup cols="3" align="left">
+ *     <thead> <row> <entry>Type</entry>
+ *                   <entry>Related Functions</entry>
+ *                   <entry>Remarks</entry> </row> </thead>
+ *     <tbody>
+ *       <row> <entry morerows="1">To string.</entry>
+ *             <entry>crank_mat_double3_to_string()</entry>
+ *             <entry>GValue Transform</entry> </row>
+ *       <row> <entry>crank_mat_double3_to_string_full()</entry> </row>
+ *
+ *       <row> <entry>To #CrankMatDoubleN.</entry>
+ *             <entry>crank_mat_double_n_init_arr()</entry>
+ *             <entry>GValue Transform,
+ *                    Cast matrix into array,
+ *                    Defined at #CrankMatDoubleN</entry> </row>
+ *     </tbody>
+ *   </tgroup>
+ * </table>
+ *
+ * <table><title>Type Conversion of #CrankMatDouble4</title>
+ *   <tgroup cols="3" align="left">
+ *     <thead> <row> <entry>Type</entry>
+ *                   <entry>Related Functions</entry>
+ *                   <entry>Remarks</entry> </row> </thead>
+ *     <tbody>
+ *       <row> <entry morerows="1">To string.</entry>
+ *             <entry>crank_mat_double4_to_string()</entry>
+ *             <entry>GValue Transform</entry> </row>
+ *       <row> <entry>crank_mat_double4_to_string_full()</entry> </row>
+ *
+ *       <row> <entry>To #CrankMatDoubleN.</entry>
+ *             <entry>crank_mat_double_n_init_arr()</entry>
+ *             <entry>GValue Transform,
+ *                    Cast matrix into array,
+ *                    Defined at #CrankMatDoubleN</entry> </row>
+ *     </tbody>
+ *   </tgroup>
+ * </table>
+ *
+ * <table><title>Type Conversion of #CrankMatDoubleN</title>
+ *   <tgroup cols="3" align="left">
+ *     <thead> <row> <entry>Type</entry>
+ *                   <entry>Related Functions</entry>
+ *                   <entry>Remarks</entry> </row> </thead>
+ *     <tbody>
+ *       <row> <entry>From #CrankMatDouble2 </entry>
+ *             <entry>crank_mat_double_n_init_arr() </entry>
+ *             <entry>GValue Transform, Cast Matrix to array</entry> </row>
+ *
+ *       <row> <entry>From #CrankMatDouble3</entry>
+ *             <entry>crank_mat_double_n_init_arr()</entry>
+ *             <entry>GValue Transform, Cast vector into array</entry> </row>
+ *
+ *       <row> <entry>From #CrankMatDouble4</entry>
+ *             <entry>crank_mat_double_n_init_arr()</entry>
+ *             <entry>GValue Transform, Cast vector into array</entry> </row>
+ *
+ *       <row> <entry morerows="1">To string.</entry>
+ *             <entry>crank_mat_double_n_to_string()</entry>
+ *             <entry>GValue Transform</entry> </row>
+ *       <row> <entry>crank_mat_double_n_to_string_full()</entry> </row>
+ *     </tbody>
+ *   </tgroup>
+ * </table>
+ */
+
+//////// Batch Kernels /////////////////////////////////////////////////////////
+
+/* Batch kernels that are specific to precision. They are used by batch
+ * operations of template. */
+
+#ifdef CRANK_CPU_X86
+
+// Processes a vector at once, as a vector fits in a register.
+__attribute__((target ("avx")))
+static void
+crank_mat_double4_batch_mulv_avx (const guint            n,
+                                  const CrankMatDouble4 *a,
+                                  const CrankVecDouble4 *b,
+                                  CrankVecDouble4       *r)
+{
+  __m256d c0 = _mm256_setr_pd (a->m00, a->m10, a->m20, a->m30);
+  __m256d c1 = _mm256_setr_pd (a->m01, a->m11, a->m21, a->m31);
+  __m256d c2 = _mm256_setr_pd (a->m02, a->m12, a->m22, a->m32);
+  __m256d c3 = _mm256_setr_pd (a->m03, a->m13, a->m23, a->m33);
+  guint i;
+
+  for (i = 0; i < n; i++)
+    {
+      const gdouble *v = (const gdouble*) (b + i);
+      __m256d rv;
+
+      rv = _mm256_mul_pd (c0, _mm256_broadcast_sd (v + 0));
+      rv = _mm256_add_pd (rv, _mm256_mul_pd (c1, _mm256_broadcast_sd (v + 1)));
+      rv = _mm256_add_pd (rv, _mm256_mul_pd (c2, _mm256_broadcast_sd (v + 2)));
+      rv = _mm256_add_pd (rv, _mm256_mul_pd (c3, _mm256_broadcast_sd (v + 3)));
+
+      _mm256_storeu_pd ((gdouble*) (r + i), rv);
+    }
+}
+
+// Processes a row at once. All of rows are loaded before stored.
+__attribute__((target ("avx")))
+static void
+crank_mat_double4_batch_mul_avx (const guint            n,
+                                 const CrankMatDouble4 *a,
+                                 const CrankMatDouble4 *b,
+                                 CrankMatDouble4       *r)
+{
+  guint i;
+  guint j;
+
+  for (i = 0; i < n; i++)
+    {
+      const gdouble *ap = (const gdouble*) (a + i);
+      const gdouble *bp = (const gdouble*) (b + i);
+      gdouble *rp = (gdouble*) (r + i);
+
+      __m256d b0 = _mm256_loadu_pd (bp + 0);
+      __m256d b1 = _mm256_loadu_pd (bp + 4);
+      __m256d b2 = _mm256_loadu_pd (bp + 8);
+      __m256d b3 = _mm256_loadu_pd (bp + 12);
+      __m256d rr[4];
+
+      for (j = 0; j < 4; j++)
+        {
+          const gdouble *arow = ap + 4 * j;
+
+          rr[j] = _mm256_mul_pd (_mm256_broadcast_sd (arow + 0), b0);
+          rr[j] = _mm256_add_pd (rr[j], _mm256_mul_pd (
+                                          _mm256_broadcast_sd (arow + 1), b1));
+          rr[j] = _mm256_add_pd (rr[j], _mm256_mul_pd (
+                                          _mm256_broadcast_sd (arow + 2), b2));
+          rr[j] = _mm256_add_pd (rr[j], _mm256_mul_pd (
+                                          _mm256_broadcast_sd (arow + 3), b3));
+        }
+
+      for (j = 0; j < 4; j++)
+        _mm256_storeu_pd (rp + 4 * j, rr[j]);
+    }
+}
+
+// Transforms a point at once, with columns of matrix.
+__attribute__((target ("avx")))
+static void
+crank_mat_double4_batch_transform_avx (const guint            n,
+                                       const CrankMatDouble4 *a,
+                                       const CrankVecDouble3 *b,
+                                       CrankVecDouble3       *r)
+{
+  __m256d c0 = _mm256_setr_pd (a->m00, a->m10, a->m20, 0);
+  __m256d c1 = _mm256_setr_pd (a->m01, a->m11, a->m21, 0);
+  __m256d c2 = _mm256_setr_pd (a->m02, a->m12, a->m22, 0);
+  __m256d c3 = _mm256_setr_pd (a->m03, a->m13, a->m23, 0);
+  guint i;
+
+  for (i = 0; i < n; i++)
+    {
+      __m256d rv;
+
+      rv = _mm256_add_pd (c3, _mm256_mul_pd (c0, _mm256_broadcast_sd (&b[i].x)));
+      rv = _mm256_add_pd (rv, _mm256_mul_pd (c1, _mm256_broadcast_sd (&b[i].y)));
+      rv = _mm256_add_pd (rv, _mm256_mul_pd (c2, _mm256_broadcast_sd (&b[i].z)));
+
+      _mm_storeu_pd (&r[i].x, _mm256_castpd256_pd128 (rv));
+      _mm_store_sd (&r[i].z, _mm256_extractf128_pd (rv, 1));
+    }
+}
+
+#endif
+
+
+//////// Template Instance /////////////////////////////////////////////////////
+
+/* Functions are written once in crankmat-template-private.h, and instantiated
+ * for double here. Documentations of them follow. */
+
+#define CRANK_MAT_T                   gdouble
+#define CRANK_MAT_TYPE(n)             CrankMatDouble##n
+#define CRANK_MAT_FUNC(n, name)       crank_mat_double##n##_##name
+#define CRANK_MAT_SYM(n)              crank_mat_double##n
+#define CRANK_MAT_GTYPE(n)            CRANK_TYPE_MAT_DOUBLE##n
+#define CRANK_MAT_VEC_TYPE(n)         CrankVecDouble##n
+#define CRANK_MAT_VEC_FUNC(n, name)   crank_vec_double##n##_##name
+#define CRANK_MAT_LU_TYPE             CrankLUDoubleN
+#define CRANK_MAT_LU_FUNC(name)       crank_lu_double_n_##name
+#define CRANK_MAT_NAME                "MatDoubleN"
+#define CRANK_MAT_HASH                g_double_hash
+#define CRANK_MAT_MATH(func)          func
+#define CRANK_MAT_GEMM                _crank_gemm_double
+#define CRANK_MAT_GEMM_THRESHOLD      CRANK_GEMM_DOUBLE_THRESHOLD
+#define CRANK_MAT_INTRIN(f)           f##_pd
+#define CRANK_MAT_M256                __m256d
+#define CRANK_MAT_W256                4
+
+#include "crankmat-template-private.h"
+
+
+//////// Documentations ////////////////////////////////////////////////////////
+
+/**
+ * crank_mat_double2_init:
+ * @mat: (out): A Matrix.
+ * @m00: Matrix element.
+ * @m01: Matrix element.
+ * @m10: Matrix element.
+ * @m11: Matrix element.
+ *
+ * Initialize a matrix with given elements.
+ */
+
+/**
+ * crank_mat_double2_init_arr:
+ * @mat: (out): A Matrix.
+ * @marr: (array fixed-size=4): An array of matrix.
+ *
+ * Initialize a matrix with given array.
+ */
+
+/**
+ * crank_mat_double2_init_row:
+ * @mat: (out): A Matrix.
+ * @row0: A Row vector.
+ * @row1: A Row vector.
+ *
+ * Initialize a matrix with given row vectors.
+ */
+
+/**
+ * crank_mat_double2_init_row_arr:
+ * @mat: (out): A Matrix.
+ * @row_arr: (array fixed-size=2): An array of row vectors.
+ *
+ * Initialize a matrix with array of row vectors.
+ */
+
+/**
+ * crank_mat_double2_init_row_parr:
+ * @mat: (out): A Matrix.
+ * @row_parr: (array fixed-size=2): An array of row vectors.
+ *
+ * Initialize a matrix with array of row vectors.
+ */
+
+/**
+ * crank_mat_double2_init_col:
+ * @mat: (out): A Matrix.
+ * @col0: A Column Vector.
+ * @col1: A Column Vector.
+ *
+ * Initialize a matrix with column vectors.
+ */
+
+/**
+ * crank_mat_double2_init_col_arr:
+ * @mat: (out): A Matrix.
+ * @col_arr: (array fixed-size=2): An array of column vectors.
+ *
+ * Initialize a matrix with an array of column vectors.
+ */
+
+/**
+ * crank_mat_double2_init_col_parr:
+ * @mat: (out): A Matrix.
+ * @col_parr: (array fixed-size=2): An array of column vectors.
+ *
+ * Initialize a matrix with an array of column vectors.
+ */
+
+/**
+ * crank_mat_double2_init_diag:
+ * @mat: (out): A Matrix.
+ * @m00: A diagonal element.
+ * @m11: A diagonal element.
+ *
+ * Initialize a matrix with diagonal elements.
+ * Other elements are initialized with 0.
+ */
+
+/**
+ * crank_mat_double2_init_diag_arr:
+ * @mat: (out): A Matrix.
+ * @darr: (array fixed-size=2): An array of diagonal elements.
+ *
+ * Initialize a matrix with an array of diagonal elements.
+ * Other elements are initialized with 0.
+ */
+
+/**
+ * crank_mat_double2_init_diag_vec:
+ * @mat: (out): A Matrix.
+ * @dvec: A vector with diagonal components.
+ *
+ * Initialize a matrix with a vector of diagonal elements.
+ * Other elements are initialized with 0.
+ */
+
+/**
+ * crank_mat_double2_init_fill:
+ * @mat: (out): A Matrix.
+ * @fill: A fill value to fill the matrix.
+ *
+ * Initialize a matrix by filling with a value.
+ */
+
+/**
+ * crank_mat_double2_copy:
+ * @mat: A Matrix.
+ * @other: (out): Another matrix.
+ *
+ * Copies a matrix to other matrix.
+ */
+
+/**
+ * crank_mat_double2_dup:
+ * @mat: A Matrix
+ *
+ * Allocates a matrix and copy on it.
+ *
+ * Returns: an allocated copy. Free it with g_free()
+ */
+
+/**
+ * crank_mat_double2_hash:
+ * @a: (type CrankMatDouble2): A matrix.
+ *
+ * Gets hash value of a matrix.
+ * This is useful when using matrix as key or value for #GHashTable.
+ *
+ * Returns: hash value of a matrix.
+ */
+
+/**
+ * crank_mat_double2_equal:
+ * @a: (type CrankMatDouble2): A matrix.
+ * @b: (type CrankMatDouble2): A matrix.
+ *
+ * Compares the value of matrix and check their equality.
+ * This is useful when using matrix as a key.
+ *
+ * Returns: %TRUE if the two are same.
+ */
+
+/**
+ * crank_mat_double2_to_string:
+ * @mat: A Matrix.
+ *
+ * Stringify a matrix to string.
+ * A typical identity matrix can be expressed like below.
+ *
+ * |[
+ *     [[1.000, 0.000], [0.000, 1.000]]
+ * ]|
+ *
+ * Returns: string representation of matrix.
+ */
+
+/**
+ * crank_mat_double2_to_string_full:
+ * @mat: A Matrix.
+ * @mat_left: Start of matrix.
+ * @mat_in: Divider for row vectors.
+ * @mat_right: End of matrix.
+ * @row_left: Start of row.
+ * @row_in: Divider for elements.
+ * @row_right: End of matrix.
+ * @format: Format for each element. should consume 1 double parameter.
+ *
+ * Stringify a matrix to string, with given parts.
+ *
+ * Returns: string representation of matrix.
+ */
+
+/**
+ * crank_mat_double2_get:
+ * @mat: A Matrix.
+ * @i: A row index.
+ * @j: A Column index.
+ *
+ * Gets element at given indices.
+ *
+ * Returns: Element at given indices.
+ */
+
+/**
+ * crank_mat_double2_set:
+ * @mat: A Matrix.
+ * @i: A row index.
+ * @j: A Column index.
+ * @value: Value of element.
+ *
+ * Sets element at given indices.
+ */
+
+/**
+ * crank_mat_double2_get_row:
+ * @mat: A Matrix.
+ * @index: A index.
+ * @row: (out): A Row vector.
+ *
+ * Gets a row vector at given index.
+ */
+
+/**
+ * crank_mat_double2_set_row:
+ * @mat: A Matrix.
+ * @index: A index.
+ * @row: A Row vector.
+ *
+ * Sets a row vector at given index.
+ */
+
+/**
+ * crank_mat_double2_get_col:
+ * @mat: A Matrix.
+ * @index: A index.
+ * @col: (out): A Column vector.
+ *
+ * Gets a column vector at given index.
+ */
+
+/**
+ * crank_mat_double2_set_col:
+ * @mat: A Matrix.
+ * @index: A index.
+ * @col: A Column vector.
+ *
+ * Sets a column vector at given index.
+ */
+
+/**
+ * crank_mat_double2_get_tr:
+ * @mat: A Matrix
+ *
+ * Gets a trace of matrix.
+ *
+ * A trace is sum of diagonal elements.
+ *
+ * Returns: A trace of matrix.
+ */
+
+/**
+ * crank_mat_double2_get_det:
+ * @mat: A Matrix
+ *
+ * Gets a determinent of matrix.
+ *
+ * Returns: A determinent of matrix.
+ */
+
+/**
+ * crank_mat_double2_get_cof:
+ * @mat: A Matrix.
+ * @r: (out): A cofactor matrix.
+ *
+ * Gets a cofactor matrix.
+ */
+
+/**
+ * crank_mat_double2_get_adj:
+ * @mat: A Matrix.
+ * @r: (out): A adjugate matrix.
+ *
+ * Gets a adjugate matrix.
+ */
+
+/**
+ * crank_mat_double2_neg:
+ * @a: A Matrix.
+ * @r: (out): A Matrix to store result.
+ *
+ * Negates a matrix.
+ */
+
+/**
+ * crank_mat_double2_neg_self:
+ * @a: A Matrix.
+ *
+ * Negates a matrix.
+ */
+
+/**
+ * crank_mat_double2_transpose:
+ * @a: A Matrix.
+ * @r: (out): A Matrix to store result.
+ *
+ * Gets a transpose of matrix.
+ */
+
+/**
+ * crank_mat_double2_transpose_self:
+ * @a: A Matrix.
+ *
+ * Gets a transpose of matrix.
+ */
+
+/**
+ * crank_mat_double2_inverse:
+ * @a: A Matrix.
+ * @r: (out): A Matrix to store result.
+ *
+ * Gets an inverse of matrix.
+ * If the matrix is singular, then NaN matrix may be returned.
+ */
+
+/**
+ * crank_mat_double2_inverse_self:
+ * @a: A Matrix.
+ *
+ * Gets an inverse of matrix.
+ * If the matrix is singular, then NaN matrix may be returned.
+ */
+
+/**
+ * crank_mat_double2_try_inverse:
+ * @a: A Matrix.
+ * @r: (out): A Matrix to store result.
+ *
+ * Gets an inverse of matrix.
+ * If the matrix is singular, then this operation is nop and returns %FALSE.
+ *
+ * Returns: Whether the matrix is non-singular and inverse is done.
+ */
+
+/**
+ * crank_mat_double2_try_inverse_self:
+ * @a: A Matrix.
+ *
+ * Gets an inverse of matrix.
+ * If the matrix is singular, then this operation is nop and returns %FALSE.
+ *
+ * Returns: Whether the matrix is non-singular and inverse is done.
+ */
+
+/**
+ * crank_mat_double2_muls:
+ * @a: A Matrix.
+ * @b: A Scalar.
+ * @r: (out): A Matrix to store result.
+ *
+ * Multiplies a matrix by scalar.
+ */
+
+/**
+ * crank_mat_double2_muls_self:
+ * @a: A Matrix.
+ * @b: A Scalar.
+ *
+ * Multiplies a matrix by scalar.
+ */
+
+/**
+ * crank_mat_double2_mulv:
+ * @a: A Matrix.
+ * @b: A Vector.
+ * @r: (out): A Matrix to store result.
+ *
+ * Multiplies a matrix by vector.
+ */
+
+/**
+ * crank_mat_double2_mul:
+ * @a: A Matrix.
+ * @b: A Matrix.
+ * @r: (out): A Matrix to store result.
+ *
+ * Multiplies two matrices.
+ */
+
+/**
+ * crank_mat_double2_mul_self:
+ * @a: A Matrix.
+ * @b: A Matrix.
+ *
+ * Multiplies two matrices.
+ */
+
+/**
+ * crank_mat_double2_divs:
+ * @a: A Matrix.
+ * @b: A Scalar.
+ * @r: (out): A Matrix to store result.
+ *
+ * Divides a matrix by scalar.
+ */
+
+/**
+ * crank_mat_double2_divs_self:
+ * @a: A Matrix.
+ * @b: A Scalar.
+ *
+ * Divides a matrix by scalar.
+ */
+
+/**
+ * crank_mat_double2_add:
+ * @a: A Matrix
+ * @b: A Matrix
+ * @r: (out): A Matrix to store result.
+ *
+ * Adds a matrix.
+ */
+
+/**
+ * crank_mat_double2_add_self:
+ * @a: A Matrix
+ * @b: A Matrix
+ *
+ * Adds a matrix.
+ */
+
+/**
+ * crank_mat_double2_sub:
+ * @a: A Matrix
+ * @b: A Matrix
+ * @r: (out): A Matrix to store result.
+ *
+ * Subtracts a matrix.
+ */
+
+/**
+ * crank_mat_double2_sub_self:
+ * @a: A Matrix
+ * @b: A Matrix
+ *
+ * Subtracts a matrix.
+ */
+
+/**
+ * crank_mat_double2_mixs:
+ * @a: A Matrix.
+ * @b: A Matrix.
+ * @c: A coefficient scalar.
+ * @r: (out): A Matrix to store result.
+ *
+ * Mixes two matrix.
+ *
+ * The result is calculated by,
+ * * (a * (1 - c)) + (b * c)
+ */
+
+/**
+ * crank_mat_double2_mix:
+ * @a: A Matrix
+ * @b: A Matrix
+ * @c: A coefficient matrix.
+ * @r: (out): A Matrix to store result.
+ *
+ * Mixes two matrix.
+ *
+ * The result is calculated by,
+ * * r[i, j] = (a[i, j] * (1 - c[i, j]) + (b[i, j] * c[i, j])
+ */
+
+/**
+ * crank_mat_double3_init:
+ * @mat: (out): A Matrix.
+ * @m00: Matrix element.
+ * @m01: Matrix element.
+ * @m02: Matrix element.
+ * @m10: Matrix element.
+ * @m11: Matrix element.
+ * @m12: Matrix element.
+ * @m20: Matrix element.
+ * @m21: Matrix element.
+ * @m22: Matrix element.
+ *
+ * Initialize a matrix with given elements.
+ */
+
+/**
+ * crank_mat_double3_init_arr:
+ * @mat: (out): A Matrix.
+ * @marr: (array fixed-size=9): An array of matrix.
+ *
+ * Initialize a matrix with given array.
+ */
+
+/**
+ * crank_mat_double3_init_row:
+ * @mat: (out): A Matrix.
+ * @row0: A Row vector.
+ * @row1: A Row vector.
+ * @row2: A Row vector.
+ *
+ * Initialize a matrix with given row vectors.
+ */
+
+/**
+ * crank_mat_double3_init_row_arr:
+ * @mat: (out): A Matrix.
+ * @row_arr: (array fixed-size=3): An array of row vectors.
+ *
+ * Initialize a matrix with array of row vectors.
+ */
+
+/**
+ * crank_mat_double3_init_row_parr:
+ * @mat: (out): A Matrix.
+ * @row_parr: (array fixed-size=3): An array of row vectors.
+ *
+ * Initialize a matrix with array of row vectors.
+ */
+
+/**
+ * crank_mat_double3_init_col:
+ * @mat: (out): A Matrix.
+ * @col0: A Column Vector.
+ * @col1: A Column Vector.
+ * @col2: A Column Vector.
+ *
+ * Initialize a matrix with column vectors.
+ */
+
+/**
+ * crank_mat_double3_init_col_arr:
+ * @mat: (out): A Matrix.
+ * @col_arr: (array fixed-size=3): An array of column vectors.
+ *
+ * Initialize a matrix with an array of column vectors.
+ */
+
+/**
+ * crank_mat_double3_init_col_parr:
+ * @mat: (out): A Matrix.
+ * @col_parr: (array fixed-size=3): An array of column vectors.
+ *
+ * Initialize a matrix with an array of column vectors.
+ */
+
+/**
+ * crank_mat_double3_init_diag:
+ * @mat: (out): A Matrix.
+ * @m00: A diagonal element.
+ * @m11: A diagonal element.
+ * @m22: A diagonal element.
+ *
+ * Initialize a matrix with diagonal elements.
+ * Other elements are initialized with 0.
+ */
+
+/**
+ * crank_mat_double3_init_diag_arr:
+ * @mat: (out): A Matrix.
+ * @darr: (array fixed-size=3): An array of diagonal elements.
+ *
+ * Initialize a matrix with an array of diagonal elements.
+ * Other elements are initialized with 0.
+ */
+
+/**
+ * crank_mat_double3_init_diag_vec:
+ * @mat: (out): A Matrix.
+ * @dvec: A vector with diagonal components.
+ *
+ * Initialize a matrix with a vector of diagonal elements.
+ * Other elements are initialized with 0.
+ */
+
+/**
+ * crank_mat_double3_init_fill:
+ * @mat: (out): A Matrix.
+ * @fill: A fill value to fill the matrix.
+ *
+ * Initialize a matrix by filling with a value.
+ */
+
+/**
+ * crank_mat_double3_init_rot:
+ * @mat: (out): A Matrix.
+ * @angle: Angle of rotation.
+ * @axis: Axis of rotation.
+ *
+ * Initialize a matrix by rotation.
+ */
+
+/**
+ * crank_mat_double3_init_urot:
+ * @mat: (out): A Matrix.
+ * @angle: Angle of rotation.
+ * @axis_x: X coord of axis.
+ * @axis_y: Y coord of axis.
+ * @axis_z: Z coord of axis.
+ *
+ * Initialize a matrix by rotation.
+ */
+
+/**
+ * crank_mat_double3_copy:
+ * @mat: A Matrix.
+ * @other: (out): Another matrix.
+ *
+ * Copies a matrix to other matrix.
+ */
+
+/**
+ * crank_mat_double3_dup:
+ * @mat: A Matrix
+ *
+ * Allocates a matrix and copy on it.
+ *
+ * Returns: an allocated copy. Free it with g_free()
+ */
+
+/**
+ * crank_mat_double3_hash:
+ * @a: (type CrankMatDouble3): A matrix.
+ *
+ * Gets hash value of a matrix.
+ * This is useful when using matrix as key or value for #GHashTable.
+ *
+ * Returns: hash value of a matrix.
+ */
+
+/**
+ * crank_mat_double3_equal:
+ * @a: (type CrankMatDouble3): A matrix.
+ * @b: (type CrankMatDouble3): A matrix.
+ *
+ * Compares the value of matrix and check their equality.
+ * This is useful when using matrix as a key.
+ *
+ * Returns: %TRUE if the two are same.
+ */
+
+/**
+ * crank_mat_double3_to_string:
+ * @mat: A Matrix.
+ *
+ * Stringify a matrix to string.
+ * A typical identity matrix can be expressed like below.
+ *
+ * |[
+ *     [[1, 0, 0], [0, 1, 0], [0, 0, 1]]
+ * ]|
+ *
+ * Returns: string representation of matrix.
+ */
+
+/**
+ * crank_mat_double3_to_string_full:
+ * @mat: A Matrix.
+ * @mat_left: Start of matrix.
+ * @mat_in: Divider for row vectors.
+ * @mat_right: End of matrix.
+ * @row_left: Start of row.
+ * @row_in: Divider for elements.
+ * @row_right: End of matrix.
+ * @format: Format for each element. should consume 1 double parameter.
+ *
+ * Stringify a matrix to string, with given parts.
+ *
+ * Returns: string representation of matrix.
+ */
+
+/**
+ * crank_mat_double3_get:
+ * @mat: A Matrix.
+ * @i: A row index.
+ * @j: A Column index.
+ *
+ * Gets element at given indices.
+ *
+ * Returns: Element at given indices.
+ */
+
+/**
+ * crank_mat_double3_set:
+ * @mat: A Matrix.
+ * @i: A row index.
+ * @j: A Column index.
+ * @value: Value of element.
+ *
+ * Sets element at given indices.
+ */
+
+/**
+ * crank_mat_double3_get_row:
+ * @mat: A Matrix.
+ * @index: A index.
+ * @row: (out): A Row vector.
+ *
+ * Gets a row vector at given index.
+ */
+
+/**
+ * crank_mat_double3_set_row:
+ * @mat: A Matrix.
+ * @index: A index.
+ * @row: A Row vector.
+ *
+ * Sets a row vector at given index.
+ */
+
+/**
+ * crank_mat_double3_get_col:
+ * @mat: A Matrix.
+ * @index: A index.
+ * @col: (out): A Column vector.
+ *
+ * Gets a column vector at given index.
+ */
+
+/**
+ * crank_mat_double3_set_col:
+ * @mat: A Matrix.
+ * @index: A index.
+ * @col: A Column vector.
+ *
+ * Sets a column vector at given index.
+ */
+
+/**
+ * crank_mat_double3_get_tr:
+ * @mat: A Matrix
+ *
+ * Gets a trace of matrix.
+ *
+ * A trace is sum of diagonal elements.
+ *
+ * Returns: A trace of matrix.
+ */
+
+/**
+ * crank_mat_double3_get_det:
+ * @mat: A Matrix
+ *
+ * Gets a determinent of matrix.
+ *
+ * Returns: A determinent of matrix.
+ */
+
+/**
+ * crank_mat_double3_get_cof:
+ * @mat: A Matrix.
+ * @r: (out): A cofactor matrix.
+ *
+ * Gets a cofactor matrix.
+ */
+
+/**
+ * crank_mat_double3_get_adj:
+ * @mat: A Matrix.
+ * @r: (out): A adjugate matrix.
+ *
+ * Gets a adjugate matrix.
+ */
+
+/**
+ * crank_mat_double3_get_rangle:
+ * @mat: A Matrix.
+ *
+ * Gets rotation angle of rotation that @mat represents.
+ *
+ * Returns: rotation angle, in radian.
+ */
+
+/**
+ * crank_mat_double3_get_raxis:
+ * @mat: A Matrix.
+ * @axis: (out): Rotation axis, as unit vector.
+ *
+ * Gets rotation axis of rotation that @mat represents.
+ */
+
+/**
+ * crank_mat_double3_neg:
+ * @a: A Matrix.
+ * @r: (out): A Matrix to store result.
+ *
+ * Negates a matrix.
+ */
+
+/**
+ * crank_mat_double3_neg_self:
+ * @a: A Matrix.
+ *
+ * Negates a matrix.
+ */
+
+/**
+ * crank_mat_double3_transpose:
+ * @a: A Matrix.
+ * @r: (out): A Matrix to store result.
+ *
+ * Gets a transpose of matrix.
+ */
+
+/**
+ * crank_mat_double3_transpose_self:
+ * @a: A Matrix.
+ *
+ * Gets a transpose of matrix.
+ */
+
+/**
+ * crank_mat_double3_inverse:
+ * @a: A Matrix.
+ * @r: (out): A Matrix to store result.
+ *
+ * Gets an inverse of matrix.
+ * If the matrix is singular, then NaN matrix may be returned.
+ */
+
+/**
+ * crank_mat_double3_inverse_self:
+ * @a: A Matrix.
+ *
+ * Gets an inverse of matrix.
+ * If the matrix is singular, then NaN matrix may be returned.
+ */
+
+/**
+ * crank_mat_double3_try_inverse:
+ * @a: A Matrix.
+ * @r: (out): A Matrix to store result.
+ *
+ * Gets an inverse of matrix.
+ * If the matrix is singular, then this operation is nop and returns %FALSE.
+ *
+ * Returns: Whether the matrix is non-singular and inverse is done.
+ */
+
+/**
+ * crank_mat_double3_try_inverse_self:
+ * @a: A Matrix.
+ *
+ * Gets an inverse of matrix.
+ * If the matrix is singular, then NaN matrix may be returned.
+ */
+
+/**
+ * crank_mat_double3_muls:
+ * @a: A Matrix.
+ * @b: A Scalar.
+ * @r: (out): A Matrix to store result.
+ *
+ * Multiplies a matrix by scalar.
+ */
+
+/**
+ * crank_mat_double3_muls_self:
+ * @a: A Matrix.
+ * @b: A Scalar.
+ *
+ * Multiplies a matrix by scalar.
+ */
+
+/**
+ * crank_mat_double3_mulv:
+ * @a: A Matrix.
+ * @b: A Vector.
+ * @r: (out): A Matrix to store result.
+ *
+ * Multiplies a matrix by vector.
+ */
+
+/**
+ * crank_mat_double3_mul:
+ * @a: A Matrix.
+ * @b: A Matrix.
+ * @r: (out): A Matrix to store result.
+ *
+ * Multiplies two matrices.
+ */
+
+/**
+ * crank_mat_double3_mul_self:
+ * @a: A Matrix.
+ * @b: A Matrix.
+ *
+ * Multiplies two matrices.
+ */
+
+/**
+ * crank_mat_double3_divs:
+ * @a: A Matrix.
+ * @b: A Scalar.
+ * @r: (out): A Matrix to store result.
+ *
+ * Divides a matrix by scalar.
+ */
+
+/**
+ * crank_mat_double3_divs_self:
+ * @a: A Matrix.
+ * @b: A Scalar.
+ *
+ * Divides a matrix by scalar.
+ */
+
+/**
+ * crank_mat_double3_add:
+ * @a: A Matrix
+ * @b: A Matrix
+ * @r: (out): A Matrix to store result.
+ *
+ * Adds a matrix.
+ */
+
+/**
+ * crank_mat_double3_add_self:
+ * @a: A Matrix
+ * @b: A Matrix
+ *
+ * Adds a matrix.
+ */
+
+/**
+ * crank_mat_double3_sub:
+ * @a: A Matrix
+ * @b: A Matrix
+ * @r: (out): A Matrix to store result.
+ *
+ * Subtracts a matrix.
+ */
+
+/**
+ * crank_mat_double3_sub_self:
+ * @a: A Matrix
+ * @b: A Matrix
+ *
+ * Subtracts a matrix.
+ */
+
+/**
+ * crank_mat_double3_mixs:
+ * @a: A Matrix.
+ * @b: A Matrix.
+ * @c: A coefficient scalar.
+ * @r: (out): A Matrix to store result.
+ *
+ * Mixes two matrix.
+ *
+ * The result is calculated by,
+ * * (a * (1 - c)) + (b * c)
+ */
+
+/**
+ * crank_mat_double3_mix:
+ * @a: A Matrix
+ * @b: A Matrix
+ * @c: A coefficient matrix.
+ * @r: (out): A Matrix to store result.
+ *
+ * Mixes two matrix.
+ *
+ * The result is calculated by,
+ * * r[i, j] = (a[i, j] * (1 - c[i, j]) + (b[i, j] * c[i, j])
+ */
+
+/**
+ * crank_mat_double4_init:
+ * @mat: (out): A Matrix.
+ * @m00: Matrix element.
+ * @m01: Matrix element.
+ * @m02: Matrix element.
+ * @m03: Matrix element.
+ * @m10: Matrix element.
+ * @m11: Matrix element.
+ * @m12: Matrix element.
+ * @m13: Matrix element.
+ * @m20: Matrix element.
+ * @m21: Matrix element.
+ * @m22: Matrix element.
+ * @m23: Matrix element.
+ * @m30: Matrix element.
+ * @m31: Matrix element.
+ * @m32: Matrix element.
+ * @m33: Matrix element.
+ *
+ * Initialize a matrix with given elements.
+ */
+
+/**
+ * crank_mat_double4_init_arr:
+ * @mat: (out): A Matrix.
+ * @marr: (array fixed-size=16): An array of matrix.
+ *
+ * Initialize a matrix with given array.
+ */
+
+/**
+ * crank_mat_double4_init_row:
+ * @mat: (out): A Matrix.
+ * @row0: A Row vector.
+ * @row1: A Row vector.
+ * @row2: A Row vector.
+ * @row3: A Row vector.
+ *
+ * Initialize a matrix with given row vectors.
+ */
+
+/**
+ * crank_mat_double4_init_row_arr:
+ * @mat: (out): A Matrix.
+ * @row_arr: (array fixed-size=4): An array of row vectors.
+ *
+ * Initialize a matrix with array of row vectors.
+ */
+
+/**
+ * crank_mat_double4_init_row_parr:
+ * @mat: (out): A Matrix.
+ * @row_parr: (array fixed-size=4): An array of row vectors.
+ *
+ * Initialize a matrix with array of row vectors.
+ */
+
+/**
+ * crank_mat_double4_init_col:
+ * @mat: (out): A Matrix.
+ * @col0: A Column Vector.
+ * @col1: A Column Vector.
+ * @col2: A Column Vector.
+ * @col3: A Column Vector.
+ *
+ * Initialize a matrix with column vectors.
+ */
+
+/**
+ * crank_mat_double4_init_col_arr:
+ * @mat: (out): A Matrix.
+ * @col_arr: (array fixed-size=4): An array of column vectors.
+ *
+ * Initialize a matrix with an array of column vectors.
+ */
+
+/**
+ * crank_mat_double4_init_col_parr:
+ * @mat: (out): A Matrix.
+ * @col_parr: (array fixed-size=4): An array of column vectors.
+ *
+ * Initialize a matrix with an array of column vectors.
+ */
+
+/**
+ * crank_mat_double4_init_diag:
+ * @mat: (out): A Matrix.
+ * @m00: A diagonal element.
+ * @m11: A diagonal element.
+ * @m22: A diagonal element.
+ * @m33: A diagonal element.
+ *
+ * Initialize a matrix with diagonal elements.
+ * Other elements are initialized with 0.
+ */
+
+/**
+ * crank_mat_double4_init_diag_arr:
+ * @mat: (out): A Matrix.
+ * @darr: (array fixed-size=4): An array of diagonal elements.
+ *
+ * Initialize a matrix with an array of diagonal elements.
+ * Other elements are initialized with 0.
+ */
+
+/**
+ * crank_mat_double4_init_diag_vec:
+ * @mat: (out): A Matrix.
+ * @dvec: A vector with diagonal components.
+ *
+ * Initialize a matrix with a vector of diagonal elements.
+ * Other elements are initialized with 0.
+ */
+
+/**
+ * crank_mat_double4_init_fill:
+ * @mat: (out): A Matrix.
+ * @fill: A fill value to fill the matrix.
+ *
+ * Initialize a matrix by filling with a value.
+ */
+
+/**
+ * crank_mat_double4_init_rot:
+ * @mat: (out): A Matrix.
+ * @angle: Angle of rotation.
+ * @axis: Axis of rotation.
+ *
+ * Initialize a matrix by rotation.
+ */
+
+/**
+ * crank_mat_double4_init_urot:
+ * @mat: (out): A Matrix.
+ * @angle: Angle of rotation.
+ * @axis_x: X coord of axis.
+ * @axis_y: Y coord of axis.
+ * @axis_z: Z coord of axis.
+ *
+ * Initialize a matrix by rotation.
+ */
+
+/**
+ * crank_mat_double4_copy:
+ * @mat: A Matrix.
+ * @other: (out): Another matrix.
+ *
+ * Copies a matrix to other matrix.
+ */
+
+/**
+ * crank_mat_double4_dup:
+ * @mat: A Matrix
+ *
+ * Allocates a matrix and copy on it.
+ *
+ * Returns: an allocated copy. Free it with g_free()
+ */
+
+/**
+ * crank_mat_double4_hash:
+ * @a: (type CrankMatDouble4): A matrix.
+ *
+ * Gets hash value of a matrix.
+ * This is useful when using matrix as key or value for #GHashTable.
+ *
+ * Returns: hash value of a matrix.
+ */
+
+/**
+ * crank_mat_double4_equal:
+ * @a: (type CrankMatDouble4): A matrix.
+ * @b: (type CrankMatDouble4): A matrix.
+ *
+ * Compares the value of matrix and check their equality.
+ * This is useful when using matrix as a key.
+ *
+ * Returns: %TRUE if the two are same.
+ */
+
+/**
+ * crank_mat_double4_to_string:
+ * @mat: A Matrix.
+ *
+ * Stringify a matrix to string.
+ * A typical identity matrix can be expressed like below.
+ *
+ * |[
+ *     [[1, 0, 0], [0, 1, 0], [0, 0, 1]]
+ * ]|
+ *
+ * Returns: string representation of matrix.
+ */
+
+/**
+ * crank_mat_double4_to_string_full:
+ * @mat: A Matrix.
+ * @mat_left: Start of matrix.
+ * @mat_in: Divider for row vectors.
+ * @mat_right: End of matrix.
+ * @row_left: Start of row.
+ * @row_in: Divider for elements.
+ * @row_right: End of matrix.
+ * @format: Format for each element. should consume 1 double parameter.
+ *
+ * Stringify a matrix to string, with given parts.
+ *
+ * Returns: string representation of matrix.
+ */
+
+/**
+ * crank_mat_double4_get:
+ * @mat: A Matrix.
+ * @i: A row index.
+ * @j: A Column index.
+ *
+ * Gets element at given indices.
+ *
+ * Returns: Element at given indices.
+ */
+
+/**
+ * crank_mat_double4_set:
+ * @mat: A Matrix.
+ * @i: A row index.
+ * @j: A Column index.
+ * @value: Value of element.
+ *
+ * Sets element at given indices.
+ */
+
+/**
+ * crank_mat_double4_get_row:
+ * @mat: A Matrix.
+ * @index: A index.
+ * @row: (out): A Row vector.
+ *
+ * Gets a row vector at given index.
+ */
+
+/**
+ * crank_mat_double4_set_row:
+ * @mat: A Matrix.
+ * @index: A index.
+ * @row: A Row vector.
+ *
+ * Sets a row vector at given index.
+ */
+
+/**
+ * crank_mat_double4_get_col:
+ * @mat: A Matrix.
+ * @index: A index.
+ * @col: (out): A Column vector.
+ *
+ * Gets a column vector at given index.
+ */
+
+/**
+ * crank_mat_double4_set_col:
+ * @mat: A Matrix.
+ * @index: A index.
+ * @col: A Column vector.
+ *
+ * Sets a column vector at given index.
+ */
+
+/**
+ * crank_mat_double4_get_tr:
+ * @mat: A Matrix
+ *
+ * Gets a trace of matrix.
+ *
+ * A trace is sum of diagonal elements.
+ *
+ * Returns: A trace of matrix.
+ */
+
+/**
+ * crank_mat_double4_get_det:
+ * @mat: A Matrix
+ *
+ * Gets a determinent of matrix.
+ *
+ * Returns: A determinent of matrix.
+ */
+
+/**
+ * crank_mat_double4_get_cof:
+ * @mat: A Matrix.
+ * @r: (out): A cofactor matrix.
+ *
+ * Gets a cofactor matrix.
+ */
+
+/**
+ * crank_mat_double4_get_adj:
+ * @mat: A Matrix.
+ * @r: (out): A adjugate matrix.
+ *
+ * Gets a adjugate matrix.
+ */
+
+/**
+ * crank_mat_double4_get_rangle:
+ * @mat: A Matrix.
+ *
+ * Gets rotation angle of rotation that @mat represents.
+ *
+ * Returns: rotation angle, in radian.
+ */
+
+/**
+ * crank_mat_double4_get_raxis:
+ * @mat: A Matrix.
+ * @axis: (out): Rotation axis, as unit vector.
+ *
+ * Gets rotation axis of rotation that @mat represents.
+ */
+
+/**
+ * crank_mat_double4_neg:
+ * @a: A Matrix.
+ * @r: (out): A Matrix to store result.
+ *
+ * Negates a matrix.
+ */
+
+/**
+ * crank_mat_double4_neg_self:
+ * @a: A Matrix.
+ *
+ * Negates a matrix.
+ */
+
+/**
+ * crank_mat_double4_transpose:
+ * @a: A Matrix.
+ * @r: (out): A Matrix to store result.
+ *
+ * Gets a transpose of matrix.
+ */
+
+/**
+ * crank_mat_double4_transpose_self:
+ * @a: A Matrix.
+ *
+ * Gets a transpose of matrix.
+ */
+
+/**
+ * crank_mat_double4_inverse:
+ * @a: A Matrix.
+ * @r: (out): A Matrix to store result.
+ *
+ * Gets an inverse of matrix.
+ * If the matrix is singular, then NaN matrix may be returned.
+ */
+
+/**
+ * crank_mat_double4_inverse_self:
+ * @a: A Matrix.
+ *
+ * Gets an inverse of matrix.
+ * If the matrix is singular, then NaN matrix may be returned.
+ */
+
+/**
+ * crank_mat_double4_try_inverse:
+ * @a: A Matrix.
+ * @r: (out): A Matrix to store result.
+ *
+ * Gets an inverse of matrix.
+ * If the matrix is singular, then this operation is nop and returns %FALSE.
+ *
+ * Returns: Whether the matrix is non-singular and inverse is done.
+ */
+
+/**
+ * crank_mat_double4_try_inverse_self:
+ * @a: A Matrix.
+ *
+ * Gets an inverse of matrix.
+ * If the matrix is singular, then this operation is nop and returns %FALSE.
+ *
+ * Returns: Whether the matrix is non-singular and inverse is done.
+ */
+
+/**
+ * crank_mat_double4_muls:
+ * @a: A Matrix.
+ * @b: A Scalar.
+ * @r: (out): A Matrix to store result.
+ *
+ * Multiplies a matrix by scalar.
+ */
+
+/**
+ * crank_mat_double4_muls_self:
+ * @a: A Matrix.
+ * @b: A Scalar.
+ *
+ * Multiplies a matrix by scalar.
+ */
+
+/**
+ * crank_mat_double4_mulv:
+ * @a: A Matrix.
+ * @b: A Vector.
+ * @r: (out): A Matrix to store result.
+ *
+ * Multiplies a matrix by vector.
+ */
+
+/**
+ * crank_mat_double4_mul:
+ * @a: A Matrix.
+ * @b: A Matrix.
+ * @r: (out): A Matrix to store result.
+ *
+ * Multiplies two matrices.
+ */
+
+/**
+ * crank_mat_double4_mul_self:
+ * @a: A Matrix.
+ * @b: A Matrix.
+ *
+ * Multiplies two matrices.
+ */
+
+/**
+ * crank_mat_double4_divs:
+ * @a: A Matrix.
+ * @b: A Scalar.
+ * @r: (out): A Matrix to store result.
+ *
+ * Divides a matrix by scalar.
+ */
+
+/**
+ * crank_mat_double4_divs_self:
+ * @a: A Matrix.
+ * @b: A Scalar.
+ *
+ * Divides a matrix by scalar.
+ */
+
+/**
+ * crank_mat_double4_add:
+ * @a: A Matrix
+ * @b: A Matrix
+ * @r: (out): A Matrix to store result.
+ *
+ * Adds a matrix.
+ */
+
+/**
+ * crank_mat_double4_add_self:
+ * @a: A Matrix
+ * @b: A Matrix
+ *
+ * Adds a matrix.
+ */
+
+/**
+ * crank_mat_double4_sub:
+ * @a: A Matrix
+ * @b: A Matrix
+ * @r: (out): A Matrix to store result.
+ *
+ * Subtracts a matrix.
+ */
+
+/**
+ * crank_mat_double4_sub_self:
+ * @a: A Matrix
+ * @b: A Matrix
+ *
+ * Subtracts a matrix.
+ */
+
+/**
+ * crank_mat_double4_mixs:
+ * @a: A Matrix.
+ * @b: A Matrix.
+ * @c: A coefficient scalar.
+ * @r: (out): A Matrix to store result.
+ *
+ * Mixes two matrix.
+ *
+ * The result is calculated by,
+ * * (a * (1 - c)) + (b * c)
+ */
+
+/**
+ * crank_mat_double4_mix:
+ * @a: A Matrix
+ * @b: A Matrix
+ * @c: A coefficient matrix.
+ * @r: (out): A Matrix to store result.
+ *
+ * Mixes two matrix.
+ *
+ * The result is calculated by,
+ * * r[i, j] = (a[i, j] * (1 - c[i, j]) + (b[i, j] * c[i, j])
+ */
+
+/**
+ * crank_mat_double4_batch_mulv:
+ * @n: Count of vectors.
+ * @a: A Matrix.
+ * @b: (array length=n): Vectors.
+ * @r: (out caller-allocates) (array length=n): Array to store results.
+ *
+ * Multiplies a matrix by @n vectors. @r may be same with @b.
+ *
+ * Several vectors are processed at once, if CPU supports.
+ */
+
+/**
+ * crank_mat_double4_batch_mul:
+ * @n: Count of matrices.
+ * @a: (array length=n): Matrices.
+ * @b: (array length=n): Matrices.
+ * @r: (out caller-allocates) (array length=n): Array to store results.
+ *
+ * Multiplies @n pairs of matrices, as in r[i] = a[i] b[i]. @r may be same with
+ * @a or @b.
+ */
+
+/**
+ * crank_mat_double4_soa_transform:
+ * @n: Count of points.
+ * @a: A Matrix.
+ * @x: (array length=n): X components of points.
+ * @y: (array length=n): Y components of points.
+ * @z: (array length=n): Z components of points.
+ * @rx: (out caller-allocates) (array length=n): X components of results.
+ * @ry: (out caller-allocates) (array length=n): Y components of results.
+ * @rz: (out caller-allocates) (array length=n): Z components of results.
+ *
+ * Transforms @n points, which are stored as separated streams of components.
+ * Points are treated as having w = 1, and w of results are dropped. So last
+ * row of @a is not used.
+ *
+ * Result streams may be same with input streams.
+ */
+
+/**
+ * crank_mat_double4_batch_transform:
+ * @n: Count of points.
+ * @a: A Matrix.
+ * @b: (array length=n): Points.
+ * @r: (out caller-allocates) (array length=n): Array to store results.
+ *
+ * Transforms @n points, as crank_mat_double4_soa_transform() does. @r may be
+ * same with @b.
+ */
+
+/**
+ * crank_mat_double_n_init:
+ * @mat: (out): A Matrix.
+ * @rn: Row count.
+ * @cn: Column count.
+ * @...: Elements.
+ *
+ * Initialize a matrix with given elements.
+ */
+
+/**
+ * crank_mat_double_n_init_arr:
+ * @mat: (out): A Matrix.
+ * @rn: Row count.
+ * @cn: Column count.
+ * @marr: (array): An array of matrix.
+ *
+ * Initialize a matrix with given array.
+ */
+
+/**
+ * crank_mat_double_n_init_arr_take:
+ * @mat: (out): A Matrix.
+ * @rn: Row count.
+ * @cn: Column count.
+ * @marr: (array) (transfer full): An array of matrix.
+ *
+ * Initialize a matrix by taking given array
+ */
+
+/**
+ * crank_mat_double_n_init_arena:
+ * @mat: (out): A Matrix.
+ * @arena: An arena.
+ * @rn: Row count.
+ * @cn: Column count.
+ *
+ * Initialize a matrix filled with 0, with data from @arena.
+ *
+ * Data is owned by @arena, so @mat should not be passed to
+ * crank_mat_double_n_fini(), or to functions that reallocate its data.
+ */
+
+/**
+ * crank_mat_double_n_init_arr_arena:
+ * @mat: (out): A Matrix.
+ * @arena: An arena.
+ * @rn: Row count.
+ * @cn: Column count.
+ * @marr: (array): An array of matrix.
+ *
+ * Initialize a matrix with given array, with data from @arena.
+ *
+ * Data is owned by @arena, so @mat should not be passed to
+ * crank_mat_double_n_fini(), or to functions that reallocate its data.
+ */
+
+/**
+ * crank_mat_double_n_init_row:
+ * @mat: (out): A Matrix.
+ * @rn: Row count
+ * @...: Row vectors.
+ *
+ * Initialize a matrix with given row vectors.
+ */
+
+/**
+ * crank_mat_double_n_init_row_arr:
+ * @mat: (out): A Matrix.
+ * @rn: Row count.
+ * @row_arr: (array length=rn): An array of row vectors.
+ *
+ * Initialize a matrix with array of row vectors.
+ */
+
+/**
+ * crank_mat_double_n_init_row_parr:
+ * @mat: (out): A Matrix.
+ * @rn: Row count.
+ * @row_parr: (array length=rn): An array of row vectors.
+ *
+ * Initialize a matrix with array of row vectors.
+ */
+
+/**
+ * crank_mat_double_n_init_col:
+ * @mat: (out): A Matrix.
+ * @cn: Column count.
+ * @...: Column Vectors.
+ *
+ * Initialize a matrix with column vectors.
+ */
+
+/**
+ * crank_mat_double_n_init_col_arr:
+ * @mat: (out): A Matrix.
+ * @cn: Column count.
+ * @col_arr: (array length=cn): An array of column vectors.
+ *
+ * Initialize a matrix with an array of column vectors.
+ */
+
+/**
+ * crank_mat_double_n_init_col_parr:
+ * @mat: (out): A Matrix.
+ * @cn: Column count.
+ * @col_parr: (array length=cn): An array of column vectors.
+ *
+ * Initialize a matrix with an array of column vectors.
+ */
+
+/**
+ * crank_mat_double_n_init_diag:
+ * @mat: (out): A Matrix.
+ * @n: Element count.
+ * @...: Diagonal elements.
+ *
+ * Initialize a matrix with diagonal elements.
+ * Other elements are initialized with 0.
+ */
+
+/**
+ * crank_mat_double_n_init_diag_arr:
+ * @mat: (out): A Matrix.
+ * @n: Element count.
+ * @darr: (array length=n): An array of diagonal elements.
+ *
+ * Initialize a matrix with an array of diagonal elements.
+ * Other elements are initialized with 0.
+ */
+
+/**
+ * crank_mat_double_n_init_diag_vec:
+ * @mat: (out): A Matrix.
+ * @dvec: A vector with diagonal components.
+ *
+ * Initialize a matrix with a vector of diagonal elements.
+ * Other elements are initialized with 0.
+ */
+
+/**
+ * crank_mat_double_n_init_fill:
+ * @mat: (out): A Matrix.
+ * @rn: Row count.
+ * @cn: Column count.
+ * @fill: A fill value to fill the matrix.
+ *
+ * Initialize a matrix by filling with a value.
+ */
+
+/**
+ * crank_mat_double_n_copy:
+ * @mat: A Matrix.
+ * @other: (out): Another matrix.
+ *
+ * Copies a matrix to other matrix.
+ */
+
+/**
+ * crank_mat_double_n_dup:
+ * @mat: A Matrix
+ *
+ * Allocates a matrix and copy on it.
+ *
+ * Returns: an allocated copy. Free it with g_free()
+ */
+
+/**
+ * crank_mat_double_n_fini:
+ * @mat: A Matrix to reset.
+ *
+ * Resets a matrix and frees its associated memory block.
+ */
+
+/**
+ * crank_mat_double_n_free:
+ * @mat: A Matrix to free.
+ *
+ * Frees allocated matrix.
+ */
+
+/**
+ * crank_mat_double_n_hash:
+ * @a: (type CrankMatDoubleN): A matrix.
+ *
+ * Gets hash value of a matrix.
+ * This is useful when using matrix as key or value for #GHashTable.
+ *
+ * Returns: hash value of a matrix.
+ */
+
+/**
+ * crank_mat_double_n_equal:
+ * @a: (type CrankMatDoubleN): A matrix.
+ * @b: (type CrankMatDoubleN): A matrix.
+ *
+ * Compares the value of matrix and check their equality.
+ * This is useful when using matrix as a key.
+ *
+ * Returns: %TRUE if the two are same.
+ */
+
+/**
+ * crank_mat_double_n_to_string:
+ * @mat: A Matrix.
+ *
+ * Stringify a matrix to string.
+ * A typical identity matrix can be expressed like below.
+ *
+ * |[
+ *     [[1.000, 0.000], [0.000, 1.000]]
+ * ]|
+ *
+ * Returns: string representation of matrix.
+ */
+
+/**
+ * crank_mat_double_n_to_string_full:
+ * @mat: A Matrix.
+ * @mat_left: Start of matrix.
+ * @mat_in: Divider for row vectors.
+ * @mat_right: End of matrix.
+ * @row_left: Start of row.
+ * @row_in: Divider for elements.
+ * @row_right: End of matrix.
+ * @format: Format for each element. should consume 1 double parameter.
+ *
+ * Stringify a matrix to string, with given parts.
+ *
+ * Returns: string representation of matrix.
+ */
+
+/**
+ * crank_mat_double_n_get_row_size:
+ * @mat: A Matrix.
+ *
+ * Gets row size (Row count) of given matrix.
+ *
+ * Returns: Row count of matrix.
+ */
+
+/**
+ * crank_mat_double_n_get_col_size:
+ * @mat: A Matrix.
+ *
+ * Gets column size (Column count) of given matrix.
+ *
+ * Returns: Column count of matrix.
+ */
+
+/**
+ * crank_mat_double_n_get:
+ * @mat: A Matrix.
+ * @i: A row index.
+ * @j: A Column index.
+ *
+ * Gets element at given indices.
+ *
+ * Returns: Element at given indices.
+ */
+
+/**
+ * crank_mat_double_n_set:
+ * @mat: A Matrix.
+ * @i: A row index.
+ * @j: A Column index.
+ * @value: Value of element.
+ *
+ * Sets element at given indices.
+ */
+
+/**
+ * crank_mat_double_n_get_row:
+ * @mat: A Matrix.
+ * @index: A index.
+ * @row: (out): A Row vector.
+ *
+ * Gets a row vector at given index.
+ */
+
+/**
+ * crank_mat_double_n_set_row:
+ * @mat: A Matrix.
+ * @index: A index.
+ * @row: A Row vector.
+ *
+ * Sets a row vector at given index.
+ */
+
+/**
+ * crank_mat_double_n_get_col:
+ * @mat: A Matrix.
+ * @index: A index.
+ * @col: (out): A Column vector.
+ *
+ * Gets a column vector at given index.
+ */
+
+/**
+ * crank_mat_double_n_set_col:
+ * @mat: A Matrix.
+ * @index: A index.
+ * @col: A Column vector.
+ *
+ * Sets a column vector at given index.
+ */
+
+/**
+ * crank_mat_double_n_getp:
+ * @mat: A Matrix.
+ * @i: Row index.
+ * @j: Column index.
+ *
+ * Gets a pointer to item at given indices.
+ *
+ * Returns: A Pointer to item at given indices.
+ */
+
+/**
+ * crank_mat_double_n_get_rowp:
+ * @mat: A Matrix.
+ * @index: Row index.
+ *
+ * Gets a pointer to row at given index.
+ *
+ * Returns: A Pointer to row at given index.
+ */
+
+/**
+ * crank_mat_double_n_slice_row:
+ * @mat: A Matrix.
+ * @start: Starting index.
+ * @end: Ending index.
+ * @r: (out): A Sliced Matrix.
+ *
+ * Slices rows of a matrix.
+ */
+
+/**
+ * crank_mat_double_n_slice_col:
+ * @mat: A Matrix.
+ * @start: Starting index.
+ * @end: Ending index.
+ * @r: (out): A Sliced Matrix.
+ *
+ * Slices columns of a matrix.
+ */
+
+/**
+ * crank_mat_double_n_slice:
+ * @mat: A Matrix.
+ * @row_start: Starting row index.
+ * @col_start: Starting column index.
+ * @row_end: Ending row index.
+ * @col_end: Ending column index.
+ * @r: (out): A Sliced Matrix.
+ *
+ * Slices a matrix.
+ */
+
+/**
+ * crank_mat_double_n_is_square:
+ * @mat: A Matrix.
+ *
+ * Checks whether the matrix is square matrix.
+ *
+ * Returns: Whether the matrix is square matrix.
+ */
+
+/**
+ * crank_mat_double_n_is_zero:
+ * @mat: A Matrix.
+ *
+ * Checks whether the matrix is zero matrix, whose all components are 0.
+ *
+ * Returns: Whether the matrix is zero matrix.
+ */
+
+/**
+ * crank_mat_double_n_is_identity:
+ * @mat: A Matrix
+ *
+ * Checks whether the matrix is identity matrix.
+ *
+ * A Identity matrix has its all diagonal components as 1, while rest components
+ * are 0.
+ *
+ * Returns: Whether the matrix is identity matrix.
+ */
+
+/**
+ * crank_mat_double_n_is_upper_tri:
+ * @mat: A Matrix.
+ *
+ * Checks whether the matrix is upper triangular matrix.
+ *
+ * In an upper triangular matrix, All component in lower part under diagonal are
+ * 0.
+ *
+ * Returns: Whether the matrix is upper triangular matrix.
+ */
+
+/**
+ * crank_mat_double_n_is_lower_tri:
+ * @mat: A Matrix.
+ *
+ * Checks whether the matrix is lower triangular matrix.
+ *
+ * In an lower triangular matrix, All component in upper part under diagonal are
+ * 0.
+ *
+ * Returns: Whether the matrix is lower triangular matrix.
+ */
+
+/**
+ * crank_mat_double_n_is_diag:
+ * @mat: A Matrix.
+ *
+ * Checkes whether the matrix is diagonal matrix.
+ *
+ * A diagonal matrix has 0 as non-diagonal componenets.
+ *
+ * Returns: Whether the matrix is diagonal matrix.
+ */
+
+/**
+ * crank_mat_double_n_is_symmetry:
+ * @mat: A Matrix.
+ *
+ * Checks whether the matrix is symmetry matrix.
+ *
+ * A symmetry matrix is symmetry along its diagonal, thus its transpose is same
+ * to itself.
+ *
+ * Returns: Whether the matrix is symmetry matrix.
+ */
+
+/**
+ * crank_mat_double_n_has_nan:
+ * @mat: A Matrix
+ *
+ * Checks whether the matrix has NaN value.
+ *
+ * If matrix has NaN value, operations results in scalar NaN, or vector/matrices
+ * contain NaN values.
+ *
+ * Returns: Whether the matrix has NaN value.
+ */
+
+/**
+ * crank_mat_double_n_has_inf:
+ * @mat: A Matrix
+ *
+ * Checks whether the matrix has infinity.
+ *
+ * If matrix has NaN value, operations results in scalar infinity, or vector/
+ * matrices contain infinity values.
+ *
+ * Returns: Whether the matrix has infinity.
+ */
+
+/**
+ * crank_mat_double_n_get_tr:
+ * @mat: A Matrix
+ *
+ * Gets a trace of matrix.
+ *
+ * A trace is sum of diagonal elements.
+ *
+ * Returns: A trace of matrix.
+ */
+
+/**
+ * crank_mat_double_n_get_det:
+ * @mat: A Matrix
+ *
+ * Gets a determinent of matrix.
+ *
+ * This is computed from pivoted LU factorization. See #CrankLUDoubleN.
+ *
+ * Returns: A determinent of matrix.
+ */
+
+/**
+ * crank_mat_double_n_get_diag:
+ * @mat: A Matrix.
+ * @r: (out): A Diagonal vector.
+ *
+ * Gets diagonal components as vector.
+ */
+
+/**
+ * crank_mat_double_n_get_cof:
+ * @mat: A Matrix.
+ * @r: (out): A cofactor matrix.
+ *
+ * Gets a cofactor matrix.
+ */
+
+/**
+ * crank_mat_double_n_get_adj:
+ * @mat: A Matrix.
+ * @r: (out): A adjugate matrix.
+ *
+ * Gets a adjugate matrix.
+ *
+ * For variable sized matrix, this is calculated from inverse matrix. So if
+ * the matrix is singular, NaN matrix is returned.
+ */
+
+/**
+ * crank_mat_double_n_neg:
+ * @a: A Matrix.
+ * @r: (out): A Matrix to store result.
+ *
+ * Negates a matrix.
+ */
+
+/**
+ * crank_mat_double_n_neg_self:
+ * @a: A Matrix.
+ *
+ * Negates a matrix.
+ */
+
+/**
+ * crank_mat_double_n_transpose:
+ * @a: A Matrix.
+ * @r: (out): A Matrix to store result.
+ *
+ * Gets a transpose of matrix.
+ *
+ * This runs on threads by global setting. See crank_parallel_set_n_threads().
+ */
+
+/**
+ * crank_mat_double_n_transpose_self:
+ * @a: A Matrix.
+ *
+ * Gets a transpose of matrix.
+ *
+ * This is done in place. Square matrices are transposed by exchanging
+ * elements, and other matrices are transposed by following cycles of
+ * permutation. For this, a bitmap of visited elements is taken from scratch
+ * arena. See crank_mat_double_n_transpose_self_arena().
+ */
+
+/**
+ * crank_mat_double_n_transpose_self_arena:
+ * @a: A Matrix.
+ * @arena: An arena to take workspace from.
+ *
+ * Gets a transpose of matrix, in place.
+ *
+ * For non-square matrix, bitmap of (@a->rn * @a->cn) bits is taken from
+ * @arena, and returned before this returns.
+ */
+
+/**
+ * crank_mat_double_n_inverse:
+ * @a: A Matrix.
+ * @r: (out): A Matrix to store result.
+ *
+ * Gets an inverse of matrix.
+ * If the matrix is singular, then NaN matrix may be returned.
+ *
+ * Current implementation make uses LU Decomposition.
+ *
+ * This runs on threads by global setting. See crank_parallel_set_n_threads().
+ */
+
+/**
+ * crank_mat_double_n_inverse_self:
+ * @a: A Matrix.
+ *
+ * Gets an inverse of matrix.
+ * If the matrix is singular, then NaN matrix may be returned.
+ *
+ * This is done in place. See crank_mat_double_n_try_inverse_self().
+ */
+
+/**
+ * crank_mat_double_n_try_inverse:
+ * @a: A Matrix.
+ * @r: (out): A Matrix to store result.
+ *
+ * Gets an inverse of matrix.
+ * If the matrix is singular, then this operation is nop and returns %FALSE.
+ *
+ * Current implementation make uses LU Decomposition.
+ *
+ * Returns: Whether the matrix is non-singular and inverse is done.
+ */
+
+/**
+ * crank_mat_double_n_try_inverse_self:
+ * @a: A Matrix.
+ *
+ * Gets an inverse of matrix.
+ * If the matrix is singular, then this operation is nop and returns %FALSE.
+ *
+ * This is done in place, by LU factorization with partial pivoting. A copy of
+ * @a, pivots and a column of workspace are taken from scratch arena. See
+ * crank_mat_double_n_try_inverse_self_arena().
+ *
+ * Returns: Whether the matrix is non-singular and inverse is done.
+ */
+
+/**
+ * crank_mat_double_n_try_inverse_self_arena:
+ * @a: A Matrix.
+ * @arena: An arena to take workspace from.
+ *
+ * Gets an inverse of matrix, in place.
+ * If the matrix is singular, then @a is left untouched and returns %FALSE.
+ *
+ * A copy of @a is factorized in place as P @a = L U, and U is inverted in
+ * place. Then inverse is solved from inverse * L = inverse of U, column by
+ * column from last one. Finally columns are exchanged back by P, and the copy
+ * is written over @a.
+ *
+ * Workspace of the copy, @a->rn pivots and elements is taken from @arena, and
+ * returned before this returns.
+ *
+ * Returns: Whether the matrix is non-singular and inverse is done.
+ */
+
+/**
+ * crank_mat_double_n_solve:
+ * @a: A Square matrix.
+ * @b: A Vector.
+ * @x: (out): A Vector to store solution.
+ *
+ * Solves linear system @a @x = @b, without getting inverse of @a.
+ *
+ * This factorizes @a with #CrankLUDoubleN. To solve many systems with same @a,
+ * reuse a factorization with crank_lu_double_n_solve().
+ *
+ * Returns: Whether the matrix is non-singular and @x is solved.
+ */
+
+/**
+ * crank_mat_double_n_solve_multi:
+ * @a: A Square matrix.
+ * @b: A Matrix, whose columns are right hand sides.
+ * @x: (out): A Matrix to store solutions.
+ *
+ * Solves linear system @a @x = @b, for all columns of @b.
+ *
+ * Returns: Whether the matrix is non-singular and @x is solved.
+ */
+
+/**
+ * crank_mat_double_n_muls:
+ * @a: A Matrix.
+ * @b: A Scalar.
+ * @r: (out): A Matrix to store result.
+ *
+ * Multiplies a matrix by scalar.
+ */
+
+/**
+ * crank_mat_double_n_muls_self:
+ * @a: A Matrix.
+ * @b: A Scalar.
+ *
+ * Multiplies a matrix by scalar.
+ */
+
+/**
+ * crank_mat_double_n_mulv:
+ * @a: A Matrix.
+ * @b: A Vector.
+ * @r: (out): A Matrix to store result.
+ *
+ * Multiplies a matrix by vector.
+ *
+ * This runs on threads by global setting. See crank_parallel_set_n_threads().
+ */
+
+/**
+ * crank_mat_double_n_mul:
+ * @a: A Matrix.
+ * @b: A Matrix.
+ * @r: (out): A Matrix to store result.
+ *
+ * Multiplies two matrices.
+ *
+ * For large matrices, this uses cache-blocked kernel, which is vectorized by
+ * CPU features.
+ *
+ * This runs on threads by global setting. See crank_parallel_set_n_threads().
+ */
+
+/**
+ * crank_mat_double_n_mul_self:
+ * @a: A Matrix.
+ * @b: A Matrix.
+ *
+ * Multiplies two matrices.
+ *
+ * As each row of result only depends on same row of @a, result is written
+ * over @a, a panel of rows at a time. Only the panel and transpose of @b are
+ * taken from scratch arena. See crank_mat_double_n_mul_self_arena().
+ */
+
+/**
+ * crank_mat_double_n_mul_self_arena:
+ * @a: A Matrix.
+ * @b: A Matrix.
+ * @arena: An arena to take workspace from.
+ *
+ * Multiplies two matrices, writing result over @a.
+ *
+ * Rows of @a are copied to a panel from @arena and multiplied by @b. If @b has
+ * more columns than rows, storage of @a is grown first and panels are
+ * processed from last one, so that results do not overwrite unprocessed rows.
+ *
+ * Workspace is a panel of 64 rows for large matrices, or a row and transpose
+ * of @b for small matrices.
+ *
+ * @b may be same with @a. Then @b is copied to @arena first.
+ */
+
+/**
+ * crank_mat_double_n_divs:
+ * @a: A Matrix.
+ * @b: A Scalar.
+ * @r: (out): A Matrix to store result.
+ *
+ * Divides a matrix by scalar.
+ */
+
+/**
+ * crank_mat_double_n_divs_self:
+ * @a: A Matrix.
+ * @b: A Scalar.
+ *
+ * Divides a matrix by scalar.
+ */
+
+/**
+ * crank_mat_double_n_add:
+ * @a: A Matrix
+ * @b: A Matrix
+ * @r: (out): A Matrix to store result.
+ *
+ * Adds a matrix.
+ *
+ * This runs on threads by global setting. See crank_parallel_set_n_threads().
+ */
+
+/**
+ * crank_mat_double_n_add_self:
+ * @a: A Matrix
+ * @b: A Matrix
+ *
+ * Adds a matrix.
+ */
+
+/**
+ * crank_mat_double_n_sub:
+ * @a: A Matrix
+ * @b: A Matrix
+ * @r: (out): A Matrix to store result.
+ *
+ * Subtracts a matrix.
+ *
+ * This runs on threads by global setting. See crank_parallel_set_n_threads().
+ */
+
+/**
+ * crank_mat_double_n_sub_self:
+ * @a: A Matrix
+ * @b: A Matrix
+ *
+ * Subtracts a matrix.
+ */
+
+/**
+ * crank_mat_double_n_mixs:
+ * @a: A Matrix.
+ * @b: A Matrix.
+ * @c: A coefficient scalar.
+ * @r: (out): A Matrix to store result.
+ *
+ * Mixes two matrix.
+ *
+ * The result is calculated by,
+ * * (a * (1 - c)) + (b * c)
+ */
+
+/**
+ * crank_mat_double_n_mix:
+ * @a: A Matrix
+ * @b: A Matrix
+ * @c: A coefficient matrix.
+ * @r: (out): A Matrix to store result.
+ *
+ * Mixes two matrix.
+ *
+ * The result is calculated by,
+ * * r[i, j] = (a[i, j] * (1 - c[i, j]) + (b[i, j] * c[i, j])
+ */
+
+/**
+ * crank_mat_double_n_shuffle_row:
+ * @a: A Matrix
+ * @p: A Permutation to shuffle row.
+ * @r: (out): A Matrix to store result.
+ *
+ * Shuffles row vectors by given permutation.
+ */
+
+/**
+ * crank_mat_double_n_shuffle_col:
+ * @a: A Matrix
+ * @p: A Permutation to shuffle row.
+ * @r: (out): A Matrix to store result.
+ *
+ * Shuffles row vectors by given permutation.
+ */
+
+/**
+ * crank_mat_double_n_upper_tri_inverse:
+ * @a: A Matrix
+ * @r: (out): A Matrix.
+ *
+ * Calculates inverse of upper triangular components.
+ *
+ * This is used to calculating inverse with decompositions.
+ */
+
+/**
+ * crank_mat_double_n_lower_tri_inverse:
+ * @a: A Matrix
+ * @r: (out): A Matrix.
+ *
+ * Calculates inverse of lower triangular components.
+ *
+ * This is used to calculating inverse with decompositions.
+ */
+
+/**
+ * crank_mat_double_n_diag_inverse:
+ * @a: A Matrix
+ * @r: (out): A Matrix.
+ *
+ * Calculates inverse of diagonal components.
+ *
+ * This is used to calculating inverse with decompositions.
+ */
+
+/**
+ * crank_mat_double_n_mul_ul:
+ * @u: A Upper triangular matrix.
+ * @l: A Lower triangular matrix.
+ * @r: (out): A Matrix.
+ *
+ * Calculates multiplication of upper triangular matrix and lower triangular matrix.
+ *
+ * This function is more like internal function, used for calculating inverse.
+ */
+
+/**
+ * crank_mat_double_n_transpose_parallel:
+ * @a: A Matrix.
+ * @r: (out): A Matrix to store result.
+ * @n_threads: Number of threads, or 0 for number of processors.
+ *
+ * Gets a transpose of matrix, with given number of threads.
+ */
+
+/**
+ * crank_mat_double_n_inverse_parallel:
+ * @a: A Matrix.
+ * @r: (out): A Matrix to store result.
+ * @n_threads: Number of threads, or 0 for number of processors.
+ *
+ * Gets an inverse of matrix, with given number of threads.
+ *
+ * After LU decomposition, each columns of inverse are solved by forward and
+ * backward substitution, which are independent to each other.
+ */
+
+/**
+ * crank_mat_double_n_mulv_parallel:
+ * @a: A Matrix.
+ * @b: A Vector.
+ * @r: (out): A Vector to store result.
+ * @n_threads: Number of threads, or 0 for number of processors.
+ *
+ * Multiplies a matrix by vector, with given number of threads.
+ */
+
+/**
+ * crank_mat_double_n_mul_parallel:
+ * @a: A Matrix.
+ * @b: A Matrix.
+ * @r: (out): A Matrix to store result.
+ * @n_threads: Number of threads, or 0 for number of processors.
+ *
+ * Multiplies two matrices, with given number of threads. Rows of result are
+ * split across threads.
+ */
+
+/**
+ * crank_mat_double_n_add_parallel:
+ * @a: A Matrix
+ * @b: A Matrix
+ * @r: (out): A Matrix to store result.
+ * @n_threads: Number of threads, or 0 for number of processors.
+ *
+ * Adds a matrix, with given number of threads.
+ */
+
+/**
+ * crank_mat_double_n_sub_parallel:
+ * @a: A Matrix
+ * @b: A Matrix
+ * @r: (out): A Matrix to store result.
+ * @n_threads: Number of threads, or 0 for number of processors.
+ *
+ * Subtracts a matrix, with given number of threads.
+ */
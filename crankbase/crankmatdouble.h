@@ -0,0 +1,1140 @@
+#ifndef CRANKMATDOUBLE_H
+#define CRANKMATDOUBLE_H
+
+/* Copyright (C) 2015, WSID   */
+
+/* Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef _CRANKBASE_INSIDE
+#error crankmatdouble.h cannot be included directly.
+#endif
+
+#include <glib.h>
+#include <glib-object.h>
+
+#include "crankfunction.h"
+#include "crankpermutation.h"
+#include "crankveccommon.h"
+#include "crankmatcommon.h"
+#include "crankmatarena.h"
+
+G_BEGIN_DECLS
+
+/**
+ * CrankMatDouble2:
+ * @m00: A Matrix element.
+ * @m01: A Matrix element.
+ * @m10: A Matrix element.
+ * @m11: A Matrix element.
+ *
+ * 2x2 Double Matrix.
+ */
+struct _CrankMatDouble2 {
+  gdouble m00;
+  gdouble m01;
+  gdouble m10;
+  gdouble m11;
+};
+
+#define CRANK_TYPE_MAT_DOUBLE2  (crank_mat_double2_get_type ())
+GType           crank_mat_double2_get_type  (void);
+
+
+void            crank_mat_double2_init (CrankMatDouble2 *mat,
+                                        const gdouble    m00,
+                                        const gdouble    m01,
+                                        const gdouble    m10,
+                                        const gdouble    m11);
+
+void            crank_mat_double2_init_arr (CrankMatDouble2 *mat,
+                                            const gdouble   *marr);
+
+void            crank_mat_double2_init_row (CrankMatDouble2 *mat,
+                                            CrankVecDouble2 *row0,
+                                            CrankVecDouble2 *row1);
+
+void            crank_mat_double2_init_row_arr (CrankMatDouble2 *mat,
+                                                CrankVecDouble2 *row_arr);
+
+void            crank_mat_double2_init_row_parr (CrankMatDouble2  *mat,
+                                                 CrankVecDouble2 **row_parr);
+
+void            crank_mat_double2_init_col (CrankMatDouble2 *mat,
+                                            CrankVecDouble2 *col0,
+                                            CrankVecDouble2 *col1);
+
+void            crank_mat_double2_init_col_arr (CrankMatDouble2 *mat,
+                                                CrankVecDouble2 *col_arr);
+
+void            crank_mat_double2_init_col_parr (CrankMatDouble2  *mat,
+                                                 CrankVecDouble2 **col_parr);
+
+void            crank_mat_double2_init_diag (CrankMatDouble2 *mat,
+                                             const gdouble    m00,
+                                             const gdouble    m11);
+
+void            crank_mat_double2_init_diag_arr (CrankMatDouble2 *mat,
+                                                 const gdouble   *darr);
+
+void            crank_mat_double2_init_diag_vec (CrankMatDouble2 *mat,
+                                                 CrankVecDouble2 *dvec);
+
+void            crank_mat_double2_init_fill (CrankMatDouble2 *mat,
+                                             const gdouble    fill);
+
+void            crank_mat_double2_copy (CrankMatDouble2 *mat,
+                                        CrankMatDouble2 *other);
+
+CrankMatDouble2 *crank_mat_double2_dup (CrankMatDouble2 *mat);
+
+//////// Basic operations ////////
+
+guint           crank_mat_double2_hash (gconstpointer a);
+
+gboolean        crank_mat_double2_equal (gconstpointer a,
+                                         gconstpointer b);
+
+gchar          *crank_mat_double2_to_string (CrankMatDouble2 *mat);
+
+gchar          *crank_mat_double2_to_string_full (CrankMatDouble2 *mat,
+                                                  const gchar     *mat_left,
+                                                  const gchar     *mat_in,
+                                                  const gchar     *mat_right,
+                                                  const gchar     *row_left,
+                                                  const gchar     *row_in,
+                                                  const gchar     *row_right,
+                                                  const gchar     *format);
+
+//////// Collectional functions ////////
+
+gdouble  crank_mat_double2_get (CrankMatDouble2 *mat,
+                                const guint      i,
+                                const guint      j);
+
+void     crank_mat_double2_set (CrankMatDouble2 *mat,
+                                const guint      i,
+                                const guint      j,
+                                const gdouble    value);
+
+void     crank_mat_double2_get_row (CrankMatDouble2 *mat,
+                                    guint            index,
+                                    CrankVecDouble2 *row);
+
+void     crank_mat_double2_set_row (CrankMatDouble2 *mat,
+                                    guint            index,
+                                    CrankVecDouble2 *row);
+
+void     crank_mat_double2_get_col (CrankMatDouble2 *mat,
+                                    guint            index,
+                                    CrankVecDouble2 *col);
+
+void     crank_mat_double2_set_col (CrankMatDouble2 *mat,
+                                    guint            index,
+                                    CrankVecDouble2 *col);
+
+
+//////// Property of matrices ////////
+
+gdouble  crank_mat_double2_get_tr (CrankMatDouble2 *mat);
+
+gdouble  crank_mat_double2_get_det (CrankMatDouble2 *mat);
+
+void     crank_mat_double2_get_cof (CrankMatDouble2 *mat,
+                                    CrankMatDouble2 *r);
+
+void     crank_mat_double2_get_adj (CrankMatDouble2 *mat,
+                                    CrankMatDouble2 *r);
+
+//////// Unary operations ////////
+
+void     crank_mat_double2_neg (CrankMatDouble2 *a,
+                                CrankMatDouble2 *r);
+
+void     crank_mat_double2_neg_self (CrankMatDouble2 *a);
+
+void     crank_mat_double2_transpose (CrankMatDouble2 *a,
+                                      CrankMatDouble2 *r);
+
+void     crank_mat_double2_transpose_self (CrankMatDouble2 *a);
+
+void     crank_mat_double2_inverse (CrankMatDouble2 *a,
+                                    CrankMatDouble2 *r);
+
+void     crank_mat_double2_inverse_self (CrankMatDouble2 *a);
+
+gboolean crank_mat_double2_try_inverse (CrankMatDouble2 *a,
+                                        CrankMatDouble2 *r);
+
+gboolean crank_mat_double2_try_inverse_self (CrankMatDouble2 *a);
+
+//////// Airthmetics ////////
+
+void     crank_mat_double2_muls (CrankMatDouble2 *a,
+                                 const gdouble    b,
+                                 CrankMatDouble2 *r);
+
+void     crank_mat_double2_muls_self (CrankMatDouble2 *a,
+                                      const gdouble    b);
+
+void     crank_mat_double2_mulv (CrankMatDouble2 *a,
+                                 CrankVecDouble2 *b,
+                                 CrankVecDouble2 *r);
+
+void     crank_mat_double2_mul (CrankMatDouble2 *a,
+                                CrankMatDouble2 *b,
+                                CrankMatDouble2 *r);
+
+void     crank_mat_double2_mul_self (CrankMatDouble2 *a,
+                                     CrankMatDouble2 *b);
+
+void     crank_mat_double2_divs (CrankMatDouble2 *a,
+                                 const gdouble    b,
+                                 CrankMatDouble2 *r);
+
+void     crank_mat_double2_divs_self (CrankMatDouble2 *a,
+                                      const gdouble    b);
+
+void     crank_mat_double2_add (CrankMatDouble2 *a,
+                                CrankMatDouble2 *b,
+                                CrankMatDouble2 *r);
+
+void     crank_mat_double2_add_self (CrankMatDouble2 *a,
+                                     CrankMatDouble2 *b);
+
+void     crank_mat_double2_sub (CrankMatDouble2 *a,
+                                CrankMatDouble2 *b,
+                                CrankMatDouble2 *r);
+
+void     crank_mat_double2_sub_self (CrankMatDouble2 *a,
+                                     CrankMatDouble2 *b);
+
+//////// Ternary operaions ////////
+
+void     crank_mat_double2_mixs (CrankMatDouble2 *a,
+                                 CrankMatDouble2 *b,
+                                 const gdouble    c,
+                                 CrankMatDouble2 *r);
+
+void     crank_mat_double2_mix (CrankMatDouble2 *a,
+                                CrankMatDouble2 *b,
+                                CrankMatDouble2 *c,
+                                CrankMatDouble2 *r);
+
+
+
+
+
+/**
+ * CrankMatDouble3:
+ * @m00: A Matrix element.
+ * @m01: A Matrix element.
+ * @m02: A Matrix element.
+ * @m10: A Matrix element.
+ * @m11: A Matrix element.
+ * @m12: A Matrix element.
+ * @m20: A Matrix element.
+ * @m21: A Matrix element.
+ * @m22: A Matrix element.
+ *
+ * 3x3 Double Matrix.
+ */
+struct _CrankMatDouble3 {
+  gdouble m00;
+  gdouble m01;
+  gdouble m02;
+
+  gdouble m10;
+  gdouble m11;
+  gdouble m12;
+
+  gdouble m20;
+  gdouble m21;
+  gdouble m22;
+};
+
+#define CRANK_TYPE_MAT_DOUBLE3  (crank_mat_double3_get_type ())
+GType crank_mat_double3_get_type  (void);
+
+
+void  crank_mat_double3_init (CrankMatDouble3 *mat,
+                              const gdouble    m00,
+                              const gdouble    m01,
+                              const gdouble    m02,
+                              const gdouble    m10,
+                              const gdouble    m11,
+                              const gdouble    m12,
+                              const gdouble    m20,
+                              const gdouble    m21,
+                              const gdouble    m22);
+
+void            crank_mat_double3_init_arr (CrankMatDouble3 *mat,
+                                            const gdouble   *marr);
+
+void            crank_mat_double3_init_row (CrankMatDouble3 *mat,
+                                            CrankVecDouble3 *row0,
+                                            CrankVecDouble3 *row1,
+                                            CrankVecDouble3 *row2);
+
+void            crank_mat_double3_init_row_arr (CrankMatDouble3 *mat,
+                                                CrankVecDouble3 *row_arr);
+
+void            crank_mat_double3_init_row_parr (CrankMatDouble3  *mat,
+                                                 CrankVecDouble3 **row_parr);
+
+void            crank_mat_double3_init_col (CrankMatDouble3 *mat,
+                                            CrankVecDouble3 *col0,
+                                            CrankVecDouble3 *col1,
+                                            CrankVecDouble3 *col2);
+
+void            crank_mat_double3_init_col_arr (CrankMatDouble3 *mat,
+                                                CrankVecDouble3 *col_arr);
+
+void            crank_mat_double3_init_col_parr (CrankMatDouble3  *mat,
+                                                 CrankVecDouble3 **col_parr);
+
+void            crank_mat_double3_init_diag (CrankMatDouble3 *mat,
+                                             const gdouble    m00,
+                                             const gdouble    m11,
+                                             const gdouble    m22);
+
+void            crank_mat_double3_init_diag_arr (CrankMatDouble3 *mat,
+                                                 const gdouble   *darr);
+
+void            crank_mat_double3_init_diag_vec (CrankMatDouble3 *mat,
+                                                 CrankVecDouble3 *dvec);
+
+void            crank_mat_double3_init_fill (CrankMatDouble3 *mat,
+                                             const gdouble    fill);
+
+void            crank_mat_double3_init_rot (CrankMatDouble3 *mat,
+                                            const gdouble    angle,
+                                            CrankVecDouble3 *axis);
+
+void            crank_mat_double3_init_urot (CrankMatDouble3 *mat,
+                                             const gdouble    angle,
+                                             const gdouble    axis_x,
+                                             const gdouble    axis_y,
+                                             const gdouble    axis_z);
+
+void            crank_mat_double3_copy (CrankMatDouble3 *mat,
+                                        CrankMatDouble3 *other);
+
+CrankMatDouble3 *crank_mat_double3_dup (CrankMatDouble3 *mat);
+
+//////// Basic operations ////////
+
+guint           crank_mat_double3_hash (gconstpointer a);
+
+gboolean        crank_mat_double3_equal (gconstpointer a,
+                                         gconstpointer b);
+
+gchar          *crank_mat_double3_to_string (CrankMatDouble3 *mat);
+
+gchar          *crank_mat_double3_to_string_full (CrankMatDouble3 *mat,
+                                                  const gchar     *mat_left,
+                                                  const gchar     *mat_in,
+                                                  const gchar     *mat_right,
+                                                  const gchar     *row_left,
+                                                  const gchar     *row_in,
+                                                  const gchar     *row_right,
+                                                  const gchar     *format);
+
+//////// Collectional functions ////////
+
+gdouble  crank_mat_double3_get (CrankMatDouble3 *mat,
+                                const guint      i,
+                                const guint      j);
+
+void     crank_mat_double3_set (CrankMatDouble3 *mat,
+                                const guint      i,
+                                const guint      j,
+                                const gdouble    value);
+
+void     crank_mat_double3_get_row (CrankMatDouble3 *mat,
+                                    guint            index,
+                                    CrankVecDouble3 *row);
+
+void     crank_mat_double3_set_row (CrankMatDouble3 *mat,
+                                    guint            index,
+                                    CrankVecDouble3 *row);
+
+void     crank_mat_double3_get_col (CrankMatDouble3 *mat,
+                                    guint            index,
+                                    CrankVecDouble3 *col);
+
+void     crank_mat_double3_set_col (CrankMatDouble3 *mat,
+                                    guint            index,
+                                    CrankVecDouble3 *col);
+
+
+//////// Property of matrices ////////
+
+gdouble  crank_mat_double3_get_tr (CrankMatDouble3 *mat);
+
+gdouble  crank_mat_double3_get_det (CrankMatDouble3 *mat);
+
+void     crank_mat_double3_get_cof (CrankMatDouble3 *mat,
+                                    CrankMatDouble3 *r);
+
+void     crank_mat_double3_get_adj (CrankMatDouble3 *mat,
+                                    CrankMatDouble3 *r);
+
+gdouble  crank_mat_double3_get_rangle (CrankMatDouble3 *mat);
+
+void     crank_mat_double3_get_raxis (CrankMatDouble3 *mat,
+                                      CrankVecDouble3 *axis);
+
+//////// Unary operations ////////
+
+void     crank_mat_double3_neg (CrankMatDouble3 *a,
+                                CrankMatDouble3 *r);
+
+void     crank_mat_double3_neg_self (CrankMatDouble3 *a);
+
+void     crank_mat_double3_transpose (CrankMatDouble3 *a,
+                                      CrankMatDouble3 *r);
+
+void     crank_mat_double3_transpose_self (CrankMatDouble3 *a);
+
+void     crank_mat_double3_inverse (CrankMatDouble3 *a,
+                                    CrankMatDouble3 *r);
+
+void     crank_mat_double3_inverse_self (CrankMatDouble3 *a);
+
+gboolean crank_mat_double3_try_inverse (CrankMatDouble3 *a,
+                                        CrankMatDouble3 *r);
+
+gboolean crank_mat_double3_try_inverse_self (CrankMatDouble3 *a);
+
+//////// Airthmetics ////////
+
+void     crank_mat_double3_muls (CrankMatDouble3 *a,
+                                 const gdouble    b,
+                                 CrankMatDouble3 *r);
+
+void     crank_mat_double3_muls_self (CrankMatDouble3 *a,
+                                      const gdouble    b);
+
+void     crank_mat_double3_mulv (CrankMatDouble3 *a,
+                                 CrankVecDouble3 *b,
+                                 CrankVecDouble3 *r);
+
+void     crank_mat_double3_mul (CrankMatDouble3 *a,
+                                CrankMatDouble3 *b,
+                                CrankMatDouble3 *r);
+
+void     crank_mat_double3_mul_self (CrankMatDouble3 *a,
+                                     CrankMatDouble3 *b);
+
+void     crank_mat_double3_divs (CrankMatDouble3 *a,
+                                 const gdouble    b,
+                                 CrankMatDouble3 *r);
+
+void     crank_mat_double3_divs_self (CrankMatDouble3 *a,
+                                      const gdouble    b);
+
+void     crank_mat_double3_add (CrankMatDouble3 *a,
+                                CrankMatDouble3 *b,
+                                CrankMatDouble3 *r);
+
+void     crank_mat_double3_add_self (CrankMatDouble3 *a,
+                                     CrankMatDouble3 *b);
+
+void     crank_mat_double3_sub (CrankMatDouble3 *a,
+                                CrankMatDouble3 *b,
+                                CrankMatDouble3 *r);
+
+void     crank_mat_double3_sub_self (CrankMatDouble3 *a,
+                                     CrankMatDouble3 *b);
+
+//////// Ternary operaions ////////
+
+void     crank_mat_double3_mixs (CrankMatDouble3 *a,
+                                 CrankMatDouble3 *b,
+                                 const gdouble    c,
+                                 CrankMatDouble3 *r);
+
+void     crank_mat_double3_mix (CrankMatDouble3 *a,
+                                CrankMatDouble3 *b,
+                                CrankMatDouble3 *c,
+                                CrankMatDouble3 *r);
+
+
+
+
+
+
+/**
+ * CrankMatDouble4:
+ * @m00: A Matrix element.
+ * @m01: A Matrix element.
+ * @m02: A Matrix element.
+ * @m03: A Matrix element.
+ * @m10: A Matrix element.
+ * @m11: A Matrix element.
+ * @m12: A Matrix element.
+ * @m13: A Matrix element.
+ * @m20: A Matrix element.
+ * @m21: A Matrix element.
+ * @m22: A Matrix element.
+ * @m23: A Matrix element.
+ * @m30: A Matrix element.
+ * @m31: A Matrix element.
+ * @m32: A Matrix element.
+ * @m33: A Matrix element.
+ *
+ * 4x4 Double Matrix.
+ */
+struct _CrankMatDouble4 {
+  gdouble m00;
+  gdouble m01;
+  gdouble m02;
+  gdouble m03;
+
+  gdouble m10;
+  gdouble m11;
+  gdouble m12;
+  gdouble m13;
+
+  gdouble m20;
+  gdouble m21;
+  gdouble m22;
+  gdouble m23;
+
+  gdouble m30;
+  gdouble m31;
+  gdouble m32;
+  gdouble m33;
+};
+
+#define CRANK_TYPE_MAT_DOUBLE4  (crank_mat_double4_get_type ())
+GType crank_mat_double4_get_type  (void);
+
+void  crank_mat_double4_init (CrankMatDouble4 *mat,
+                              const gdouble    m00,
+                              const gdouble    m01,
+                              const gdouble    m02,
+                              const gdouble    m03,
+                              const gdouble    m10,
+                              const gdouble    m11,
+                              const gdouble    m12,
+                              const gdouble    m13,
+                              const gdouble    m20,
+                              const gdouble    m21,
+                              const gdouble    m22,
+                              const gdouble    m23,
+                              const gdouble    m30,
+                              const gdouble    m31,
+                              const gdouble    m32,
+                              const gdouble    m33);
+
+void            crank_mat_double4_init_arr (CrankMatDouble4 *mat,
+                                            const gdouble   *marr);
+
+void            crank_mat_double4_init_row (CrankMatDouble4 *mat,
+                                            CrankVecDouble4 *row0,
+                                            CrankVecDouble4 *row1,
+                                            CrankVecDouble4 *row2,
+                                            CrankVecDouble4 *row3);
+
+void            crank_mat_double4_init_row_arr (CrankMatDouble4 *mat,
+                                                CrankVecDouble4 *row_arr);
+
+void            crank_mat_double4_init_row_parr (CrankMatDouble4  *mat,
+                                                 CrankVecDouble4 **row_parr);
+
+void            crank_mat_double4_init_col (CrankMatDouble4 *mat,
+                                            CrankVecDouble4 *col0,
+                                            CrankVecDouble4 *col1,
+                                            CrankVecDouble4 *col2,
+                                            CrankVecDouble4 *col3);
+
+void            crank_mat_double4_init_col_arr (CrankMatDouble4 *mat,
+                                                CrankVecDouble4 *col_arr);
+
+void            crank_mat_double4_init_col_parr (CrankMatDouble4  *mat,
+                                                 CrankVecDouble4 **col_parr);
+
+void            crank_mat_double4_init_diag (CrankMatDouble4 *mat,
+                                             const gdouble    m00,
+                                             const gdouble    m11,
+                                             const gdouble    m22,
+                                             const gdouble    m33);
+
+void            crank_mat_double4_init_diag_arr (CrankMatDouble4 *mat,
+                                                 const gdouble   *darr);
+
+void            crank_mat_double4_init_diag_vec (CrankMatDouble4 *mat,
+                                                 CrankVecDouble4 *dvec);
+
+void            crank_mat_double4_init_fill (CrankMatDouble4 *mat,
+                                             const gdouble    fill);
+
+void            crank_mat_double4_init_rot (CrankMatDouble4 *mat,
+                                            const gdouble    angle,
+                                            CrankVecDouble3 *axis);
+
+void            crank_mat_double4_init_urot (CrankMatDouble4 *mat,
+                                             const gdouble    angle,
+                                             const gdouble    axis_x,
+                                             const gdouble    axis_y,
+                                             const gdouble    axis_z);
+
+void            crank_mat_double4_copy (CrankMatDouble4 *mat,
+                                        CrankMatDouble4 *other);
+
+CrankMatDouble4 *crank_mat_double4_dup (CrankMatDouble4 *mat);
+
+//////// Basic operations ////////
+
+guint           crank_mat_double4_hash (gconstpointer a);
+
+gboolean        crank_mat_double4_equal (gconstpointer a,
+                                         gconstpointer b);
+
+gchar          *crank_mat_double4_to_string (CrankMatDouble4 *mat);
+
+gchar          *crank_mat_double4_to_string_full (CrankMatDouble4 *mat,
+                                                  const gchar     *mat_left,
+                                                  const gchar     *mat_in,
+                                                  const gchar     *mat_right,
+                                                  const gchar     *row_left,
+                                                  const gchar     *row_in,
+                                                  const gchar     *row_right,
+                                                  const gchar     *format);
+
+//////// Collectional functions ////////
+
+gdouble  crank_mat_double4_get (CrankMatDouble4 *mat,
+                                const guint      i,
+                                const guint      j);
+
+void     crank_mat_double4_set (CrankMatDouble4 *mat,
+                                const guint      i,
+                                const guint      j,
+                                const gdouble    value);
+
+void     crank_mat_double4_get_row (CrankMatDouble4 *mat,
+                                    guint            index,
+                                    CrankVecDouble4 *row);
+
+void     crank_mat_double4_set_row (CrankMatDouble4 *mat,
+                                    guint            index,
+                                    CrankVecDouble4 *row);
+
+void     crank_mat_double4_get_col (CrankMatDouble4 *mat,
+                                    guint            index,
+                                    CrankVecDouble4 *col);
+
+void     crank_mat_double4_set_col (CrankMatDouble4 *mat,
+                                    guint            index,
+                                    CrankVecDouble4 *col);
+
+
+//////// Property of matrices ////////
+
+gdouble  crank_mat_double4_get_tr (CrankMatDouble4 *mat);
+
+gdouble  crank_mat_double4_get_det (CrankMatDouble4 *mat);
+
+void     crank_mat_double4_get_cof (CrankMatDouble4 *mat,
+                                    CrankMatDouble4 *r);
+
+void     crank_mat_double4_get_adj (CrankMatDouble4 *mat,
+                                    CrankMatDouble4 *r);
+
+gdouble  crank_mat_double4_get_rangle (CrankMatDouble4 *mat);
+
+void     crank_mat_double4_get_raxis (CrankMatDouble4 *mat,
+                                      CrankVecDouble3 *axis);
+
+//////// Unary operations ////////
+
+void     crank_mat_double4_neg (CrankMatDouble4 *a,
+                                CrankMatDouble4 *r);
+
+void     crank_mat_double4_neg_self (CrankMatDouble4 *a);
+
+void     crank_mat_double4_transpose (CrankMatDouble4 *a,
+                                      CrankMatDouble4 *r);
+
+void     crank_mat_double4_transpose_self (CrankMatDouble4 *a);
+
+void     crank_mat_double4_inverse (CrankMatDouble4 *a,
+                                    CrankMatDouble4 *r);
+
+void     crank_mat_double4_inverse_self (CrankMatDouble4 *a);
+
+gboolean crank_mat_double4_try_inverse (CrankMatDouble4 *a,
+                                        CrankMatDouble4 *r);
+
+gboolean crank_mat_double4_try_inverse_self (CrankMatDouble4 *a);
+
+//////// Airthmetics ////////
+
+void     crank_mat_double4_muls (CrankMatDouble4 *a,
+                                 const gdouble    b,
+                                 CrankMatDouble4 *r);
+
+void     crank_mat_double4_muls_self (CrankMatDouble4 *a,
+                                      const gdouble    b);
+
+void     crank_mat_double4_mulv (CrankMatDouble4 *a,
+                                 CrankVecDouble4 *b,
+                                 CrankVecDouble4 *r);
+
+void     crank_mat_double4_mul (CrankMatDouble4 *a,
+                                CrankMatDouble4 *b,
+                                CrankMatDouble4 *r);
+
+void     crank_mat_double4_mul_self (CrankMatDouble4 *a,
+                                     CrankMatDouble4 *b);
+
+void     crank_mat_double4_divs (CrankMatDouble4 *a,
+                                 const gdouble    b,
+                                 CrankMatDouble4 *r);
+
+void     crank_mat_double4_divs_self (CrankMatDouble4 *a,
+                                      const gdouble    b);
+
+void     crank_mat_double4_add (CrankMatDouble4 *a,
+                                CrankMatDouble4 *b,
+                                CrankMatDouble4 *r);
+
+void     crank_mat_double4_add_self (CrankMatDouble4 *a,
+                                     CrankMatDouble4 *b);
+
+void     crank_mat_double4_sub (CrankMatDouble4 *a,
+                                CrankMatDouble4 *b,
+                                CrankMatDouble4 *r);
+
+void     crank_mat_double4_sub_self (CrankMatDouble4 *a,
+                                     CrankMatDouble4 *b);
+
+//////// Ternary operaions ////////
+
+void     crank_mat_double4_mixs (CrankMatDouble4 *a,
+                                 CrankMatDouble4 *b,
+                                 const gdouble    c,
+                                 CrankMatDouble4 *r);
+
+void     crank_mat_double4_mix (CrankMatDouble4 *a,
+                                CrankMatDouble4 *b,
+                                CrankMatDouble4 *c,
+                                CrankMatDouble4 *r);
+
+//////// Batch operations ////////
+
+void     crank_mat_double4_batch_mulv (const guint            n,
+                                       const CrankMatDouble4 *a,
+                                       const CrankVecDouble4 *b,
+                                       CrankVecDouble4       *r);
+
+void     crank_mat_double4_batch_mul (const guint            n,
+                                      const CrankMatDouble4 *a,
+                                      const CrankMatDouble4 *b,
+                                      CrankMatDouble4       *r);
+
+void     crank_mat_double4_batch_transform (const guint            n,
+                                            const CrankMatDouble4 *a,
+                                            const CrankVecDouble3 *b,
+                                            CrankVecDouble3       *r);
+
+void     crank_mat_double4_soa_transform (const guint            n,
+                                          const CrankMatDouble4 *a,
+                                          const gdouble         *x,
+                                          const gdouble         *y,
+                                          const gdouble         *z,
+                                          gdouble               *rx,
+                                          gdouble               *ry,
+                                          gdouble               *rz);
+
+/**
+ * CrankMatDoubleN:
+ * @data: Matrix data array.
+ * @rn: row count.
+ * @cn: column count.
+ *
+ * Variable sized Double Matrix.
+ */
+struct _CrankMatDoubleN {
+  gdouble *data;
+  guint rn;
+  guint cn;
+};
+
+#define CRANK_TYPE_MAT_DOUBLE_N (crank_mat_double_n_get_type ())
+GType           crank_mat_double_n_get_type (void);
+
+
+void            crank_mat_double_n_init (CrankMatDoubleN *mat,
+                                         const guint     rn,
+                                         const guint     cn,
+                                         ...);
+
+void            crank_mat_double_n_init_arr (CrankMatDoubleN *mat,
+                                             const guint      rn,
+                                             const guint      cn,
+                                             const gdouble   *marr);
+
+void            crank_mat_double_n_init_arr_take (CrankMatDoubleN *mat,
+                                                  const guint      rn,
+                                                  const guint      cn,
+                                                  gdouble         *marr);
+
+void            crank_mat_double_n_init_arena (CrankMatDoubleN *mat,
+                                               CrankMatArena   *arena,
+                                               const guint      rn,
+                                               const guint      cn);
+
+void            crank_mat_double_n_init_arr_arena (CrankMatDoubleN *mat,
+                                                   CrankMatArena   *arena,
+                                                   const guint      rn,
+                                                   const guint      cn,
+                                                   const gdouble   *marr);
+
+void            crank_mat_double_n_init_row (CrankMatDoubleN *mat,
+                                             const guint     rn,
+                                             ...);
+
+void            crank_mat_double_n_init_row_arr (CrankMatDoubleN *mat,
+                                                 const guint      rn,
+                                                 CrankVecDoubleN *row_arr);
+
+void            crank_mat_double_n_init_row_parr (CrankMatDoubleN  *mat,
+                                                  const guint       rn,
+                                                  CrankVecDoubleN **row_parr);
+
+void            crank_mat_double_n_init_col (CrankMatDoubleN *mat,
+                                             const guint     cn,
+                                             ...);
+
+void            crank_mat_double_n_init_col_arr (CrankMatDoubleN *mat,
+                                                 const guint      cn,
+                                                 CrankVecDoubleN *col_arr);
+
+void            crank_mat_double_n_init_col_parr (CrankMatDoubleN  *mat,
+                                                  const guint       cn,
+                                                  CrankVecDoubleN **col_parr);
+
+void            crank_mat_double_n_init_diag (CrankMatDoubleN *mat,
+                                              const guint     n,
+                                              ...);
+
+void            crank_mat_double_n_init_diag_arr (CrankMatDoubleN *mat,
+                                                  const guint      n,
+                                                  const gdouble   *darr);
+
+void            crank_mat_double_n_init_diag_vec (CrankMatDoubleN *mat,
+                                                  CrankVecDoubleN *dvec);
+
+void            crank_mat_double_n_init_fill (CrankMatDoubleN *mat,
+                                              const guint      rn,
+                                              const guint      cn,
+                                              const gdouble    fill);
+
+void            crank_mat_double_n_fini (CrankMatDoubleN *mat);
+
+void            crank_mat_double_n_copy (CrankMatDoubleN *mat,
+                                         CrankMatDoubleN *other);
+
+CrankMatDoubleN *crank_mat_double_n_dup (CrankMatDoubleN *mat);
+
+void            crank_mat_double_n_free (CrankMatDoubleN *mat);
+
+//////// Basic operations ////////
+
+guint           crank_mat_double_n_hash (gconstpointer a);
+
+gboolean        crank_mat_double_n_equal (gconstpointer a,
+                                          gconstpointer b);
+
+gchar          *crank_mat_double_n_to_string (CrankMatDoubleN *mat);
+
+gchar          *crank_mat_double_n_to_string_full (CrankMatDoubleN *mat,
+                                                   const gchar     *mat_left,
+                                                   const gchar     *mat_in,
+                                                   const gchar     *mat_right,
+                                                   const gchar     *row_left,
+                                                   const gchar     *row_in,
+                                                   const gchar     *row_right,
+                                                   const gchar     *format);
+
+//////// Collectional functions ////////
+
+guint    crank_mat_double_n_get_row_size (CrankMatDoubleN *mat);
+
+guint    crank_mat_double_n_get_col_size (CrankMatDoubleN *mat);
+
+gdouble  crank_mat_double_n_get (CrankMatDoubleN *mat,
+                                 const guint      i,
+                                 const guint      j);
+
+void     crank_mat_double_n_set (CrankMatDoubleN *mat,
+                                 const guint      i,
+                                 const guint      j,
+                                 const gdouble    value);
+
+void     crank_mat_double_n_get_row (CrankMatDoubleN *mat,
+                                     guint            index,
+                                     CrankVecDoubleN *row);
+
+void     crank_mat_double_n_set_row (CrankMatDoubleN *mat,
+                                     guint            index,
+                                     CrankVecDoubleN *row);
+
+void     crank_mat_double_n_get_col (CrankMatDoubleN *mat,
+                                     guint            index,
+                                     CrankVecDoubleN *col);
+
+void     crank_mat_double_n_set_col (CrankMatDoubleN *mat,
+                                     guint            index,
+                                     CrankVecDoubleN *col);
+
+
+gdouble *crank_mat_double_n_getp (CrankMatDoubleN *mat,
+                                  const guint      i,
+                                  const guint      j);
+
+gdouble *crank_mat_double_n_get_rowp(CrankMatDoubleN *mat,
+                                     const guint      index);
+
+
+void     crank_mat_double_n_slice_row (CrankMatDoubleN *mat,
+                                       const guint      start,
+                                       const guint      end,
+                                       CrankMatDoubleN *r);
+
+void     crank_mat_double_n_slice_col (CrankMatDoubleN *mat,
+                                       const guint      start,
+                                       const guint      end,
+                                       CrankMatDoubleN *r);
+
+void     crank_mat_double_n_slice (CrankMatDoubleN *mat,
+                                   const guint      row_start,
+                                   const guint      col_start,
+                                   const guint      row_end,
+                                   const guint      col_end,
+                                   CrankMatDoubleN *r);
+
+//////// Classification ////////////////////////////////////////////////////////
+
+gboolean crank_mat_double_n_is_square (CrankMatDoubleN *mat);
+
+gboolean crank_mat_double_n_is_zero (CrankMatDoubleN *mat);
+
+gboolean crank_mat_double_n_is_identity (CrankMatDoubleN *mat);
+
+gboolean crank_mat_double_n_is_upper_tri (CrankMatDoubleN *mat);
+
+gboolean crank_mat_double_n_is_lower_tri (CrankMatDoubleN *mat);
+
+gboolean crank_mat_double_n_is_diag (CrankMatDoubleN *mat);
+
+gboolean crank_mat_double_n_is_symmetry (CrankMatDoubleN *mat);
+
+gboolean crank_mat_double_n_has_nan (CrankMatDoubleN *mat);
+
+gboolean crank_mat_double_n_has_inf (CrankMatDoubleN *mat);
+
+//////// Property of matrices ////////
+
+gdouble  crank_mat_double_n_get_tr (CrankMatDoubleN *mat);
+
+gdouble  crank_mat_double_n_get_det (CrankMatDoubleN *mat);
+
+void     crank_mat_double_n_get_cof (CrankMatDoubleN *mat,
+                                     CrankMatDoubleN *r);
+
+void     crank_mat_double_n_get_adj (CrankMatDoubleN *mat,
+                                     CrankMatDoubleN *r);
+
+void     crank_mat_double_n_get_diag (CrankMatDoubleN *mat,
+                                      CrankVecDoubleN *r);
+
+//////// Unary operations ////////
+
+void     crank_mat_double_n_neg (CrankMatDoubleN *a,
+                                 CrankMatDoubleN *r);
+
+void     crank_mat_double_n_neg_self (CrankMatDoubleN *a);
+
+void     crank_mat_double_n_transpose (CrankMatDoubleN *a,
+                                       CrankMatDoubleN *r);
+
+void     crank_mat_double_n_transpose_self (CrankMatDoubleN *a);
+
+void     crank_mat_double_n_transpose_self_arena (CrankMatDoubleN *a,
+                                                  CrankMatArena   *arena);
+
+void     crank_mat_double_n_inverse (CrankMatDoubleN *a,
+                                     CrankMatDoubleN *r);
+
+void     crank_mat_double_n_inverse_self (CrankMatDoubleN *a);
+
+gboolean crank_mat_double_n_try_inverse (CrankMatDoubleN *a,
+                                         CrankMatDoubleN *r);
+
+gboolean crank_mat_double_n_try_inverse_self (CrankMatDoubleN *a);
+
+gboolean crank_mat_double_n_try_inverse_self_arena (CrankMatDoubleN *a,
+                                                    CrankMatArena   *arena);
+
+//////// Linear systems ////////
+
+gboolean crank_mat_double_n_solve (CrankMatDoubleN *a,
+                                   CrankVecDoubleN *b,
+                                   CrankVecDoubleN *x);
+
+gboolean crank_mat_double_n_solve_multi (CrankMatDoubleN *a,
+                                         CrankMatDoubleN *b,
+                                         CrankMatDoubleN *x);
+
+//////// Scalar operations ////////
+
+void     crank_mat_double_n_muls (CrankMatDoubleN *a,
+                                  const gdouble    b,
+                                  CrankMatDoubleN *r);
+
+void     crank_mat_double_n_muls_self (CrankMatDoubleN *a,
+                                       const gdouble    b);
+
+void     crank_mat_double_n_mulv (CrankMatDoubleN *a,
+                                  CrankVecDoubleN *b,
+                                  CrankVecDoubleN *r);
+
+void     crank_mat_double_n_mul (CrankMatDoubleN *a,
+                                 CrankMatDoubleN *b,
+                                 CrankMatDoubleN *r);
+
+void     crank_mat_double_n_mul_self (CrankMatDoubleN *a,
+                                      CrankMatDoubleN *b);
+
+void     crank_mat_double_n_mul_self_arena (CrankMatDoubleN *a,
+                                            CrankMatDoubleN *b,
+                                            CrankMatArena   *arena);
+
+void     crank_mat_double_n_divs (CrankMatDoubleN *a,
+                                  const gdouble    b,
+                                  CrankMatDoubleN *r);
+
+void     crank_mat_double_n_divs_self (CrankMatDoubleN *a,
+                                       const gdouble    b);
+
+void     crank_mat_double_n_add (CrankMatDoubleN *a,
+                                 CrankMatDoubleN *b,
+                                 CrankMatDoubleN *r);
+
+void     crank_mat_double_n_add_self (CrankMatDoubleN *a,
+                                      CrankMatDoubleN *b);
+
+void     crank_mat_double_n_sub (CrankMatDoubleN *a,
+                                 CrankMatDoubleN *b,
+                                 CrankMatDoubleN *r);
+
+void     crank_mat_double_n_sub_self (CrankMatDoubleN *a,
+                                      CrankMatDoubleN *b);
+
+//////// Ternary operaions ////////
+
+void     crank_mat_double_n_mixs (CrankMatDoubleN *a,
+                                  CrankMatDoubleN *b,
+                                  const gdouble    c,
+                                  CrankMatDoubleN *r);
+
+void     crank_mat_double_n_mix (CrankMatDoubleN *a,
+                                 CrankMatDoubleN *b,
+                                 CrankMatDoubleN *c,
+                                 CrankMatDoubleN *r);
+
+//////// Shuffling ////////
+
+void     crank_mat_double_n_shuffle_row (CrankMatDoubleN  *a,
+                                         CrankPermutation *p,
+                                         CrankMatDoubleN  *r);
+
+void     crank_mat_double_n_shuffle_col (CrankMatDoubleN  *a,
+                                         CrankPermutation *p,
+                                         CrankMatDoubleN  *r);
+
+
+//////// Supplement Operations /////////////////////////////////////////////////
+
+void     crank_mat_double_n_upper_tri_inverse (CrankMatDoubleN *a,
+                                               CrankMatDoubleN *r);
+
+void     crank_mat_double_n_lower_tri_inverse (CrankMatDoubleN *a,
+                                               CrankMatDoubleN *r);
+
+void     crank_mat_double_n_diag_inverse (CrankMatDoubleN *a,
+                                          CrankMatDoubleN *r);
+
+void     crank_mat_double_n_mul_ul (CrankMatDoubleN *u,
+                                    CrankMatDoubleN *l,
+                                    CrankMatDoubleN *r);
+
+
+//////// Parallel Operations ///////////////////////////////////////////////////
+
+void     crank_mat_double_n_transpose_parallel (CrankMatDoubleN *a,
+                                                CrankMatDoubleN *r,
+                                                const guint      n_threads);
+
+void     crank_mat_double_n_inverse_parallel (CrankMatDoubleN *a,
+                                              CrankMatDoubleN *r,
+                                              const guint      n_threads);
+
+void     crank_mat_double_n_mulv_parallel (CrankMatDoubleN *a,
+                                           CrankVecDoubleN *b,
+                                           CrankVecDoubleN *r,
+                                           const guint      n_threads);
+
+void     crank_mat_double_n_mul_parallel (CrankMatDoubleN *a,
+                                          CrankMatDoubleN *b,
+                                          CrankMatDoubleN *r,
+                                          const guint      n_threads);
+
+void     crank_mat_double_n_add_parallel (CrankMatDoubleN *a,
+                                          CrankMatDoubleN *b,
+                                          CrankMatDoubleN *r,
+                                          const guint      n_threads);
+
+void     crank_mat_double_n_sub_parallel (CrankMatDoubleN *a,
+                                          CrankMatDoubleN *b,
+                                          CrankMatDoubleN *r,
+                                          const guint      n_threads);
+
+//////// Macro variants ////////////////////////////////////////////////////////
+
+#define crank_mat_double_n_get(mat,ri,ci)   \
+  CRANK_MAT_GET(mat,ri,ci)
+
+#define crank_mat_double_n_set(mat,ri,ci,value) \
+  CRANK_MAT_SET(mat,ri,ci,value)
+
+#define crank_mat_double_n_getp(mat,ri,ci)  \
+  CRANK_MAT_GETP(mat,ri,ci)
+
+#define crank_mat_double_n_get_rowp(mat,ri) \
+  CRANK_MAT_GET_ROWP(mat,ri)
+
+G_END_DECLS
+
+#endif //CRANKMATDOUBLE_H
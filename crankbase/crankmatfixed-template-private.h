@@ -0,0 +1,246 @@
+/* Copyright (C) 2015, WSID   */
+
+/* Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/* This is template for fixed size matrix kernels, and is included by
+ * crankmatfixed.c once for each size. */
+
+#ifndef _CRANKBASE_INSIDE
+#error crankmatfixed-template-private.h cannot be included directly.
+#endif
+
+#ifndef CRANK_MAT_FIXED_N
+#error CRANK_MAT_FIXED_N should be defined before including template.
+#endif
+
+#ifndef __GTK_DOC_IGNORE__
+
+/*
+ * Parameters of template.
+ *
+ * CRANK_MAT_FIXED_N: Size of matrices.
+ * CRANK_MAT_FIXED_PREFIX(name): Makes private name with size prefix.
+ * CRANK_MAT_FIXED_UNROLL: Asks compiler to unroll following loop.
+ *
+ * Matrices are row-major and have N x N elements. Temporaries are in stack,
+ * and results are written at last, so results may be same with operands.
+ */
+
+#define N       CRANK_MAT_FIXED_N
+#define F(name) CRANK_MAT_FIXED_PREFIX(name)
+
+static void
+F(mul) (const gfloat *a,
+        const gfloat *b,
+        gfloat       *r)
+{
+  gfloat t[N * N];
+  guint i;
+  guint j;
+  guint k;
+
+  for (i = 0; i < N; i++)
+    {
+      gfloat *trowi = t + (i * N);
+
+      CRANK_MAT_FIXED_UNROLL
+      for (j = 0; j < N; j++)
+        trowi[j] = 0;
+
+      CRANK_MAT_FIXED_UNROLL
+      for (k = 0; k < N; k++)
+        {
+          const gfloat *browk = b + (k * N);
+          gfloat aik = a[(i * N) + k];
+
+          CRANK_MAT_FIXED_UNROLL
+          for (j = 0; j < N; j++)
+            trowi[j] += aik * browk[j];
+        }
+    }
+
+  memcpy (r, t, sizeof (t));
+}
+
+static void
+F(mulv) (const gfloat *a,
+         const gfloat *b,
+         gfloat       *r)
+{
+  gfloat t[N];
+  guint i;
+  guint k;
+
+  for (i = 0; i < N; i++)
+    {
+      const gfloat *arowi = a + (i * N);
+      gfloat sum = 0;
+
+      CRANK_MAT_FIXED_UNROLL
+      for (k = 0; k < N; k++)
+        sum += arowi[k] * b[k];
+
+      t[i] = sum;
+    }
+
+  memcpy (r, t, sizeof (t));
+}
+
+/*
+ * Solves by Gaussian elimination with partial pivoting, applying eliminations
+ * on right hand side as well. Returns FALSE for singular matrix, without
+ * writing to x.
+ */
+static gboolean
+F(solve) (const gfloat *a,
+          const gfloat *b,
+          gfloat       *x)
+{
+  gfloat lu[N * N];
+  gfloat y[N];
+  guint i;
+  guint j;
+  guint k;
+
+  memcpy (lu, a, sizeof (lu));
+  memcpy (y, b, sizeof (y));
+
+  for (k = 0; k < N; k++)
+    {
+      gfloat *lurowk = lu + (k * N);
+      gfloat pmax = ABS (lurowk[k]);
+      guint p = k;
+
+      for (i = k + 1; i < N; i++)
+        {
+          gfloat cur = ABS (lu[(i * N) + k]);
+
+          if (pmax < cur)
+            {
+              pmax = cur;
+              p = i;
+            }
+        }
+
+      if (pmax == 0)
+        return FALSE;
+
+      if (p != k)
+        {
+          gfloat *lurowp = lu + (p * N);
+          gfloat temp;
+
+          CRANK_MAT_FIXED_UNROLL
+          for (j = 0; j < N; j++)
+            {
+              temp = lurowk[j];
+              lurowk[j] = lurowp[j];
+              lurowp[j] = temp;
+            }
+
+          temp = y[k];
+          y[k] = y[p];
+          y[p] = temp;
+        }
+
+      for (i = k + 1; i < N; i++)
+        {
+          gfloat *lurowi = lu + (i * N);
+          gfloat f = lurowi[k] / lurowk[k];
+
+          for (j = k + 1; j < N; j++)
+            lurowi[j] -= f * lurowk[j];
+
+          y[i] -= f * y[k];
+        }
+    }
+
+  i = N;
+  while (0 < i)
+    {
+      gfloat *lurowi;
+      gfloat sum;
+
+      i--;
+      lurowi = lu + (i * N);
+      sum = y[i];
+
+      for (j = i + 1; j < N; j++)
+        sum -= lurowi[j] * y[j];
+
+      y[i] = sum / lurowi[i];
+    }
+
+  memcpy (x, y, sizeof (y));
+  return TRUE;
+}
+
+/*
+ * Performs Cholesky decomposition row by row, reading only lower triangle.
+ * Returns FALSE if matrix is not positive definite, without writing to l.
+ */
+static gboolean
+F(ch) (const gfloat *a,
+       gfloat       *l)
+{
+  gfloat t[N * N];
+  guint i;
+  guint j;
+  guint k;
+
+  for (i = 0; i < N; i++)
+    {
+      gfloat *trowi = t + (i * N);
+      gfloat sum;
+
+      for (j = 0; j < i; j++)
+        {
+          gfloat *trowj = t + (j * N);
+
+          sum = a[(i * N) + j];
+
+          for (k = 0; k < j; k++)
+            sum -= trowi[k] * trowj[k];
+
+          trowi[j] = sum / trowj[j];
+        }
+
+      sum = a[(i * N) + i];
+
+      for (k = 0; k < i; k++)
+        sum -= trowi[k] * trowi[k];
+
+      if (sum < 0.0f)
+        return FALSE;
+
+      trowi[i] = sqrtf (sum);
+
+      for (j = i + 1; j < N; j++)
+        trowi[j] = 0.0f;
+    }
+
+  memcpy (l, t, sizeof (t));
+  return TRUE;
+}
+
+#undef N
+#undef F
+
+#endif
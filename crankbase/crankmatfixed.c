@@ -0,0 +1,257 @@
+/* Copyright (C) 2015, WSID   */
+
+/* Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+#define _CRANKBASE_INSIDE
+
+#include <string.h>
+#include <math.h>
+
+#include <glib.h>
+
+#include "crankmatfixed.h"
+
+/**
+ * SECTION: crankmatfixed
+ * @title: Fixed Size Matrix Kernels
+ * @short_description: Specialized kernels for small square matrices.
+ * @stability: unstable
+ * @include: crankbase.h
+ *
+ * Between #CrankMatFloat4 and #CrankMatFloatN, there are many sizes of matrices
+ * in common use, like 6 x 6 for rigid bodies, or 12 x 12 for constraint blocks.
+ * Going through #CrankMatFloatN, these pay for heap allocations and loops
+ * whose bounds are not known to compiler.
+ *
+ * This provides kernels, which are specialized for each size from
+ * %CRANK_MAT_FLOAT_FIXED_MIN to %CRANK_MAT_FLOAT_FIXED_MAX. Matrices are given
+ * as row-major arrays of n x n elements, so they can be kept in stack. Loops in
+ * kernels have constant bounds, and are unrolled and vectorized by compiler.
+ * Temporaries are kept in stack as well.
+ *
+ * #CrankMatFloatN uses these kernels for square matrices of supported sizes, in
+ * crank_mat_float_n_mul(), crank_mat_float_n_mulv(), crank_mat_float_n_solve()
+ * and crank_ch_mat_float_n().
+ */
+
+
+//////// Kernels ///////////////////////////////////////////////////////////////
+
+/*
+ * Kernels are written once in crankmatfixed-template-private.h, and
+ * instantiated for each size here, as crank_mat_float_fixed<n>_<name>.
+ */
+
+#if defined (__clang__) || (defined (__GNUC__) && (8 <= __GNUC__))
+#define CRANK_MAT_FIXED_UNROLL _Pragma ("GCC unroll 16")
+#else
+#define CRANK_MAT_FIXED_UNROLL
+#endif
+
+#define CRANK_MAT_FIXED_PASTE(p, n, name)  CRANK_MAT_FIXED_PASTE2 (p, n, name)
+#define CRANK_MAT_FIXED_PASTE2(p, n, name) p##n##_##name
+#define CRANK_MAT_FIXED_PREFIX(name) \
+  CRANK_MAT_FIXED_PASTE (crank_mat_float_fixed, CRANK_MAT_FIXED_N, name)
+
+#define CRANK_MAT_FIXED_N 2
+#include "crankmatfixed-template-private.h"
+#undef CRANK_MAT_FIXED_N
+
+#define CRANK_MAT_FIXED_N 3
+#include "crankmatfixed-template-private.h"
+#undef CRANK_MAT_FIXED_N
+
+#define CRANK_MAT_FIXED_N 4
+#include "crankmatfixed-template-private.h"
+#undef CRANK_MAT_FIXED_N
+
+#define CRANK_MAT_FIXED_N 5
+#include "crankmatfixed-template-private.h"
+#undef CRANK_MAT_FIXED_N
+
+#define CRANK_MAT_FIXED_N 6
+#include "crankmatfixed-template-private.h"
+#undef CRANK_MAT_FIXED_N
+
+#define CRANK_MAT_FIXED_N 7
+#include "crankmatfixed-template-private.h"
+#undef CRANK_MAT_FIXED_N
+
+#define CRANK_MAT_FIXED_N 8
+#include "crankmatfixed-template-private.h"
+#undef CRANK_MAT_FIXED_N
+
+#define CRANK_MAT_FIXED_N 9
+#include "crankmatfixed-template-private.h"
+#undef CRANK_MAT_FIXED_N
+
+#define CRANK_MAT_FIXED_N 10
+#include "crankmatfixed-template-private.h"
+#undef CRANK_MAT_FIXED_N
+
+#define CRANK_MAT_FIXED_N 11
+#include "crankmatfixed-template-private.h"
+#undef CRANK_MAT_FIXED_N
+
+#define CRANK_MAT_FIXED_N 12
+#include "crankmatfixed-template-private.h"
+#undef CRANK_MAT_FIXED_N
+
+#define CRANK_MAT_FIXED_N 13
+#include "crankmatfixed-template-private.h"
+#undef CRANK_MAT_FIXED_N
+
+#define CRANK_MAT_FIXED_N 14
+#include "crankmatfixed-template-private.h"
+#undef CRANK_MAT_FIXED_N
+
+#define CRANK_MAT_FIXED_N 15
+#include "crankmatfixed-template-private.h"
+#undef CRANK_MAT_FIXED_N
+
+#define CRANK_MAT_FIXED_N 16
+#include "crankmatfixed-template-private.h"
+#undef CRANK_MAT_FIXED_N
+
+
+//////// Private Type //////////////////////////////////////////////////////////
+
+typedef struct _CrankMatFloatFixedKernels {
+  void      (*mul)    (const gfloat *a, const gfloat *b, gfloat *r);
+  void      (*mulv)   (const gfloat *a, const gfloat *b, gfloat *r);
+  gboolean  (*solve)  (const gfloat *a, const gfloat *b, gfloat *x);
+  gboolean  (*ch)     (const gfloat *a, gfloat *l);
+} CrankMatFloatFixedKernels;
+
+#define CRANK_MAT_FIXED_KERNELS(n)    \
+  { crank_mat_float_fixed##n##_mul,   \
+    crank_mat_float_fixed##n##_mulv,  \
+    crank_mat_float_fixed##n##_solve, \
+    crank_mat_float_fixed##n##_ch }
+
+static const CrankMatFloatFixedKernels crank_mat_float_fixed_kernels[] = {
+  CRANK_MAT_FIXED_KERNELS (2),
+  CRANK_MAT_FIXED_KERNELS (3),
+  CRANK_MAT_FIXED_KERNELS (4),
+  CRANK_MAT_FIXED_KERNELS (5),
+  CRANK_MAT_FIXED_KERNELS (6),
+  CRANK_MAT_FIXED_KERNELS (7),
+  CRANK_MAT_FIXED_KERNELS (8),
+  CRANK_MAT_FIXED_KERNELS (9),
+  CRANK_MAT_FIXED_KERNELS (10),
+  CRANK_MAT_FIXED_KERNELS (11),
+  CRANK_MAT_FIXED_KERNELS (12),
+  CRANK_MAT_FIXED_KERNELS (13),
+  CRANK_MAT_FIXED_KERNELS (14),
+  CRANK_MAT_FIXED_KERNELS (15),
+  CRANK_MAT_FIXED_KERNELS (16)
+};
+
+#define CRANK_MAT_FIXED_GET(n) \
+  (crank_mat_float_fixed_kernels + ((n) - CRANK_MAT_FLOAT_FIXED_MIN))
+
+
+//////// Fixed size kernels ////////////////////////////////////////////////////
+
+/**
+ * crank_mat_float_fixed_mul:
+ * @n: Size of matrices.
+ * @a: (array): A Matrix, with @n x @n elements.
+ * @b: (array): A Matrix, with @n x @n elements.
+ * @r: (out caller-allocates) (array): A Matrix to store result.
+ *
+ * Multiplies two @n x @n matrices. @r may be same with @a or @b.
+ */
+void
+crank_mat_float_fixed_mul (const guint   n,
+                           const gfloat *a,
+                           const gfloat *b,
+                           gfloat       *r)
+{
+  g_return_if_fail (CRANK_MAT_FLOAT_FIXED_HAS_SIZE (n));
+
+  CRANK_MAT_FIXED_GET (n)->mul (a, b, r);
+}
+
+/**
+ * crank_mat_float_fixed_mulv:
+ * @n: Size of matrix.
+ * @a: (array): A Matrix, with @n x @n elements.
+ * @b: (array): A Vector, with @n elements.
+ * @r: (out caller-allocates) (array): A Vector to store result.
+ *
+ * Multiplies a @n x @n matrix by vector. @r may be same with @b.
+ */
+void
+crank_mat_float_fixed_mulv (const guint   n,
+                            const gfloat *a,
+                            const gfloat *b,
+                            gfloat       *r)
+{
+  g_return_if_fail (CRANK_MAT_FLOAT_FIXED_HAS_SIZE (n));
+
+  CRANK_MAT_FIXED_GET (n)->mulv (a, b, r);
+}
+
+/**
+ * crank_mat_float_fixed_solve:
+ * @n: Size of matrix.
+ * @a: (array): A Matrix, with @n x @n elements.
+ * @b: (array): A Vector, with @n elements.
+ * @x: (out caller-allocates) (array): A Vector to store solution.
+ *
+ * Solves linear system @a @x = @b, by LU decomposition with partial pivoting.
+ * Factors are kept in stack and are not returned. @x may be same with @b.
+ *
+ * Returns: Whether the matrix is non-singular and @x is solved. If not, @x is
+ *     not modified.
+ */
+gboolean
+crank_mat_float_fixed_solve (const guint   n,
+                             const gfloat *a,
+                             const gfloat *b,
+                             gfloat       *x)
+{
+  g_return_val_if_fail (CRANK_MAT_FLOAT_FIXED_HAS_SIZE (n), FALSE);
+
+  return CRANK_MAT_FIXED_GET (n)->solve (a, b, x);
+}
+
+/**
+ * crank_mat_float_fixed_ch:
+ * @n: Size of matrix.
+ * @a: (array): A Symmetric matrix, with @n x @n elements.
+ * @l: (out caller-allocates) (array): A Matrix to store lower triangular
+ *     factor.
+ *
+ * Performs cholesky decomposition on @a, as crank_ch_mat_float_n() does. Only
+ * lower triangle of @a is read. @l may be same with @a.
+ *
+ * Returns: Whether cholesky decomposition performed on @a. If not, @l is not
+ *     modified.
+ */
+gboolean
+crank_mat_float_fixed_ch (const guint   n,
+                          const gfloat *a,
+                          gfloat       *l)
+{
+  g_return_val_if_fail (CRANK_MAT_FLOAT_FIXED_HAS_SIZE (n), FALSE);
+
+  return CRANK_MAT_FIXED_GET (n)->ch (a, l);
+}
@@ -0,0 +1,79 @@
+#ifndef CRANKMATFIXED_H
+#define CRANKMATFIXED_H
+
+/* Copyright (C) 2015, WSID   */
+
+/* Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef _CRANKBASE_INSIDE
+#error crankmatfixed.h cannot be included directly.
+#endif
+
+#include <glib.h>
+
+G_BEGIN_DECLS
+
+/**
+ * CRANK_MAT_FLOAT_FIXED_MIN:
+ *
+ * Smallest size of matrices that fixed size kernels support.
+ */
+#define CRANK_MAT_FLOAT_FIXED_MIN 2
+
+/**
+ * CRANK_MAT_FLOAT_FIXED_MAX:
+ *
+ * Largest size of matrices that fixed size kernels support.
+ */
+#define CRANK_MAT_FLOAT_FIXED_MAX 16
+
+/**
+ * CRANK_MAT_FLOAT_FIXED_HAS_SIZE:
+ * @n: Size of matrix.
+ *
+ * Checks whether fixed size kernels support @n x @n matrices.
+ */
+#define CRANK_MAT_FLOAT_FIXED_HAS_SIZE(n) \
+  ((CRANK_MAT_FLOAT_FIXED_MIN <= (n)) && ((n) <= CRANK_MAT_FLOAT_FIXED_MAX))
+
+//////// Fixed size kernels ////////////////////////////////////////////////////
+
+void            crank_mat_float_fixed_mul   (const guint   n,
+                                             const gfloat *a,
+                                             const gfloat *b,
+                                             gfloat       *r);
+
+void            crank_mat_float_fixed_mulv  (const guint   n,
+                                             const gfloat *a,
+                                             const gfloat *b,
+                                             gfloat       *r);
+
+gboolean        crank_mat_float_fixed_solve (const guint   n,
+                                             const gfloat *a,
+                                             const gfloat *b,
+                                             gfloat       *x);
+
+gboolean        crank_mat_float_fixed_ch    (const guint   n,
+                                             const gfloat *a,
+                                             gfloat       *l);
+
+G_END_DECLS
+
+#endif
@@ -35,11 +35,15 @@
 
 #include "crankmatcommon.h"
 #include "crankmatfloat.h"
+#include "crankmatfixed.h"
 
-//////// Private Macros ////////////////////////////////////////////////////////
-#define DET4(a, b, c, d) \
-  ((a) * (d) - (b) * (c))
+#include "crankparallel.h"
+#include "crankgemm-private.h"
+#include "crankcpu-private.h"
 
+#ifdef CRANK_CPU_X86
+#include <immintrin.h>
+#endif
 
 /**
  * SECTION: crankmatfloat
@@ -79,6 +83,17 @@
  *   This means it can be combined with other transforms like translation and
  *   scales, and so on, in arbitarily order.
  *
+ * # Batch operations of #CrankMatFloat4
+ *
+ * Transforming many vectors by a matrix, one by one, takes much time in
+ * function calls. crank_mat_float4_batch_mulv() and
+ * crank_mat_float4_batch_transform() transform arrays of vectors at once, and
+ * crank_mat_float4_soa_transform() transforms separated streams of x, y and z
+ * components. crank_mat_float4_batch_mul() multiplies arrays of matrix pairs.
+ *
+ * They process several elements at once, with SIMD instructions, when CPU
+ * supports them.
+ *
  * # Type Conversion
  *
  * <table><title>Type Conversion of #CrankMatFloat2</title>
@@ -168,21 +183,152 @@
  * </table>
  */
 
-static void crank_mat_float2_transform_to_string (const GValue *src,
-                                                  GValue       *dest);
+//////// Batch Kernels /////////////////////////////////////////////////////////
+
+/* Batch kernels that are specific to precision. They are used by batch
+ * operations of template. */
+
+#ifdef CRANK_CPU_X86
+
+static void crank_mat_float4_batch_mulv_generic (const guint           n,
+                                                 const CrankMatFloat4 *a,
+                                                 const CrankVecFloat4 *b,
+                                                 CrankVecFloat4       *r);
+
+// Processes 2 vectors at once, by broadcasting elements in each lane.
+__attribute__((target ("avx")))
+static void
+crank_mat_float4_batch_mulv_avx (const guint           n,
+                                 const CrankMatFloat4 *a,
+                                 const CrankVecFloat4 *b,
+                                 CrankVecFloat4       *r)
+{
+  __m256 c0 = _mm256_setr_ps (a->m00, a->m10, a->m20, a->m30,
+                              a->m00, a->m10, a->m20, a->m30);
+  __m256 c1 = _mm256_setr_ps (a->m01, a->m11, a->m21, a->m31,
+                              a->m01, a->m11, a->m21, a->m31);
+  __m256 c2 = _mm256_setr_ps (a->m02, a->m12, a->m22, a->m32,
+                              a->m02, a->m12, a->m22, a->m32);
+  __m256 c3 = _mm256_setr_ps (a->m03, a->m13, a->m23, a->m33,
+                              a->m03, a->m13, a->m23, a->m33);
+  guint i;
+
+  for (i = 0; i + 2 <= n; i += 2)
+    {
+      __m256 v = _mm256_loadu_ps ((const gfloat*) (b + i));
+      __m256 rv;
+
+      rv = _mm256_mul_ps (c0, _mm256_permute_ps (v, 0x00));
+      rv = _mm256_add_ps (rv, _mm256_mul_ps (c1, _mm256_permute_ps (v, 0x55)));
+      rv = _mm256_add_ps (rv, _mm256_mul_ps (c2, _mm256_permute_ps (v, 0xAA)));
+      rv = _mm256_add_ps (rv, _mm256_mul_ps (c3, _mm256_permute_ps (v, 0xFF)));
+
+      _mm256_storeu_ps ((gfloat*) (r + i), rv);
+    }
+
+  crank_mat_float4_batch_mulv_generic (n - i, a, b + i, r + i);
+}
+
+// Processes 2 rows at once. All of rows are loaded before stored.
+__attribute__((target ("avx")))
+static void
+crank_mat_float4_batch_mul_avx (const guint           n,
+                                const CrankMatFloat4 *a,
+                                const CrankMatFloat4 *b,
+                                CrankMatFloat4       *r)
+{
+  guint i;
+
+  for (i = 0; i < n; i++)
+    {
+      const gfloat *ap = (const gfloat*) (a + i);
+      const gfloat *bp = (const gfloat*) (b + i);
+      gfloat *rp = (gfloat*) (r + i);
+
+      __m256 b0 = _mm256_broadcast_ps ((const __m128*) (bp + 0));
+      __m256 b1 = _mm256_broadcast_ps ((const __m128*) (bp + 4));
+      __m256 b2 = _mm256_broadcast_ps ((const __m128*) (bp + 8));
+      __m256 b3 = _mm256_broadcast_ps ((const __m128*) (bp + 12));
+      __m256 a01 = _mm256_loadu_ps (ap);
+      __m256 a23 = _mm256_loadu_ps (ap + 8);
+      __m256 r01;
+      __m256 r23;
+
+      r01 = _mm256_mul_ps (_mm256_permute_ps (a01, 0x00), b0);
+      r01 = _mm256_add_ps (r01, _mm256_mul_ps (_mm256_permute_ps (a01, 0x55), b1));
+      r01 = _mm256_add_ps (r01, _mm256_mul_ps (_mm256_permute_ps (a01, 0xAA), b2));
+      r01 = _mm256_add_ps (r01, _mm256_mul_ps (_mm256_permute_ps (a01, 0xFF), b3));
+
+      r23 = _mm256_mul_ps (_mm256_permute_ps (a23, 0x00), b0);
+      r23 = _mm256_add_ps (r23, _mm256_mul_ps (_mm256_permute_ps (a23, 0x55), b1));
+      r23 = _mm256_add_ps (r23, _mm256_mul_ps (_mm256_permute_ps (a23, 0xAA), b2));
+      r23 = _mm256_add_ps (r23, _mm256_mul_ps (_mm256_permute_ps (a23, 0xFF), b3));
+
+      _mm256_storeu_ps (rp, r01);
+      _mm256_storeu_ps (rp + 8, r23);
+    }
+}
+
+// Transforms a point at once, with columns of matrix.
+__attribute__((target ("avx")))
+static void
+crank_mat_float4_batch_transform_avx (const guint           n,
+                                      const CrankMatFloat4 *a,
+                                      const CrankVecFloat3 *b,
+                                      CrankVecFloat3       *r)
+{
+  __m128 c0 = _mm_setr_ps (a->m00, a->m10, a->m20, 0);
+  __m128 c1 = _mm_setr_ps (a->m01, a->m11, a->m21, 0);
+  __m128 c2 = _mm_setr_ps (a->m02, a->m12, a->m22, 0);
+  __m128 c3 = _mm_setr_ps (a->m03, a->m13, a->m23, 0);
+  guint i;
+
+  for (i = 0; i < n; i++)
+    {
+      __m128 rv;
+
+      rv = _mm_add_ps (c3, _mm_mul_ps (c0, _mm_broadcast_ss (&b[i].x)));
+      rv = _mm_add_ps (rv, _mm_mul_ps (c1, _mm_broadcast_ss (&b[i].y)));
+      rv = _mm_add_ps (rv, _mm_mul_ps (c2, _mm_broadcast_ss (&b[i].z)));
 
+      _mm_storel_pi ((__m64*) &r[i].x, rv);
+      _mm_store_ss (&r[i].z, _mm_movehl_ps (rv, rv));
+    }
+}
+
+#endif
+
+
+//////// Template Instance /////////////////////////////////////////////////////
+
+/* Functions are written once in crankmat-template-private.h, and instantiated
+ * for float here. Documentations of them follow. */
+
+#define CRANK_MAT_T                   gfloat
+#define CRANK_MAT_TYPE(n)             CrankMatFloat##n
+#define CRANK_MAT_FUNC(n, name)       crank_mat_float##n##_##name
+#define CRANK_MAT_SYM(n)              crank_mat_float##n
+#define CRANK_MAT_GTYPE(n)            CRANK_TYPE_MAT_FLOAT##n
+#define CRANK_MAT_VEC_TYPE(n)         CrankVecFloat##n
+#define CRANK_MAT_VEC_FUNC(n, name)   crank_vec_float##n##_##name
+#define CRANK_MAT_LU_TYPE             CrankLUFloatN
+#define CRANK_MAT_LU_FUNC(name)       crank_lu_float_n_##name
+#define CRANK_MAT_NAME                "MatFloatN"
+#define CRANK_MAT_HASH                crank_float_hash
+#define CRANK_MAT_MATH(func)          func##f
+#define CRANK_MAT_GEMM                _crank_gemm_float
+#define CRANK_MAT_GEMM_THRESHOLD      CRANK_GEMM_FLOAT_THRESHOLD
+#define CRANK_MAT_FIXED_HAS_SIZE(n)   CRANK_MAT_FLOAT_FIXED_HAS_SIZE (n)
+#define CRANK_MAT_FIXED_MAX           CRANK_MAT_FLOAT_FIXED_MAX
+#define CRANK_MAT_FIXED_FUNC(name)    crank_mat_float_fixed_##name
+#define CRANK_MAT_INTRIN(f)           f##_ps
+#define CRANK_MAT_M256                __m256
+#define CRANK_MAT_W256                8
+
+#include "crankmat-template-private.h"
 
-G_DEFINE_BOXED_TYPE_WITH_CODE (
-  CrankMatFloat2,
-  crank_mat_float2,
-  crank_mat_float2_dup,
-  g_free,
-  {
-    g_value_register_transform_func (
-      g_define_type_id,
-      G_TYPE_STRING,
-      crank_mat_float2_transform_to_string);
-  })
+
+//////// Documentations ////////////////////////////////////////////////////////
 
 /**
  * crank_mat_float2_init:
@@ -194,18 +340,6 @@ G_DEFINE_BOXED_TYPE_WITH_CODE (
  *
  * Initialize a matrix with given elements.
  */
-void
-crank_mat_float2_init (CrankMatFloat2 *mat,
-                       const gfloat    m00,
-                       const gfloat    m01,
-                       const gfloat    m10,
-                       const gfloat    m11)
-{
-  mat->m00 = m00;
-  mat->m01 = m01;
-  mat->m10 = m10;
-  mat->m11 = m11;
-}
 
 /**
  * crank_mat_float2_init_arr:
@@ -214,12 +348,6 @@ crank_mat_float2_init (CrankMatFloat2 *mat,
  *
  * Initialize a matrix with given array.
  */
-void
-crank_mat_float2_init_arr (CrankMatFloat2 *mat,
-                           const gfloat   *marr)
-{
-  memcpy (mat, marr, sizeof(gfloat) * 4);
-}
 
 /**
  * crank_mat_float2_init_row:
@@ -229,14 +357,6 @@ crank_mat_float2_init_arr (CrankMatFloat2 *mat,
  *
  * Initialize a matrix with given row vectors.
  */
-void
-crank_mat_float2_init_row (CrankMatFloat2 *mat,
-                           CrankVecFloat2 *row0,
-                           CrankVecFloat2 *row1)
-{
-  crank_vec_float2_init_arr ((CrankVecFloat2*)mat,       (gfloat*)row0);
-  crank_vec_float2_init_arr (((CrankVecFloat2*)mat) + 1, (gfloat*)row1);
-}
 
 /**
  * crank_mat_float2_init_row_arr:
@@ -245,12 +365,6 @@ crank_mat_float2_init_row (CrankMatFloat2 *mat,
  *
  * Initialize a matrix with array of row vectors.
  */
-void
-crank_mat_float2_init_row_arr (CrankMatFloat2 *mat,
-                               CrankVecFloat2 *row_arr)
-{
-  crank_mat_float2_init_arr (mat, (gfloat*)row_arr);
-}
 
 /**
  * crank_mat_float2_init_row_parr:
@@ -259,12 +373,6 @@ crank_mat_float2_init_row_arr (CrankMatFloat2 *mat,
  *
  * Initialize a matrix with array of row vectors.
  */
-void
-crank_mat_float2_init_row_parr (CrankMatFloat2  *mat,
-                                CrankVecFloat2 **row_parr)
-{
-  crank_mat_float2_init_row (mat, row_parr[0], row_parr[1]);
-}
 
 /**
  * crank_mat_float2_init_col:
@@ -274,16 +382,6 @@ crank_mat_float2_init_row_parr (CrankMatFloat2  *mat,
  *
  * Initialize a matrix with column vectors.
  */
-void
-crank_mat_float2_init_col (CrankMatFloat2 *mat,
-                           CrankVecFloat2 *col0,
-                           CrankVecFloat2 *col1)
-{
-  mat->m00 = col0->x;
-  mat->m01 = col1->x;
-  mat->m10 = col0->y;
-  mat->m11 = col1->y;
-}
 
 /**
  * crank_mat_float2_init_col_arr:
@@ -292,12 +390,6 @@ crank_mat_float2_init_col (CrankMatFloat2 *mat,
  *
  * Initialize a matrix with an array of column vectors.
  */
-void
-crank_mat_float2_init_col_arr (CrankMatFloat2 *mat,
-                               CrankVecFloat2 *col_arr)
-{
-  crank_mat_float2_init_col (mat, col_arr, col_arr + 1);
-}
 
 /**
  * crank_mat_float2_init_col_parr:
@@ -306,12 +398,6 @@ crank_mat_float2_init_col_arr (CrankMatFloat2 *mat,
  *
  * Initialize a matrix with an array of column vectors.
  */
-void
-crank_mat_float2_init_col_parr (CrankMatFloat2  *mat,
-                                CrankVecFloat2 **col_parr)
-{
-  crank_mat_float2_init_col (mat, col_parr[0], col_parr[1]);
-}
 
 /**
  * crank_mat_float2_init_diag:
@@ -322,16 +408,6 @@ crank_mat_float2_init_col_parr (CrankMatFloat2  *mat,
  * Initialize a matrix with diagonal elements.
  * Other elements are initialized with 0.
  */
-void
-crank_mat_float2_init_diag (CrankMatFloat2 *mat,
-                            const gfloat    m00,
-                            const gfloat    m11)
-{
-  mat->m00 = m00;
-  mat->m01 = 0;
-  mat->m10 = 0;
-  mat->m11 = m11;
-}
 
 /**
  * crank_mat_float2_init_diag_arr:
@@ -341,12 +417,6 @@ crank_mat_float2_init_diag (CrankMatFloat2 *mat,
  * Initialize a matrix with an array of diagonal elements.
  * Other elements are initialized with 0.
  */
-void
-crank_mat_float2_init_diag_arr (CrankMatFloat2 *mat,
-                                const gfloat   *darr)
-{
-  crank_mat_float2_init_diag (mat, darr[0], darr[1]);
-}
 
 /**
  * crank_mat_float2_init_diag_vec:
@@ -356,12 +426,6 @@ crank_mat_float2_init_diag_arr (CrankMatFloat2 *mat,
  * Initialize a matrix with a vector of diagonal elements.
  * Other elements are initialized with 0.
  */
-void
-crank_mat_float2_init_diag_vec (CrankMatFloat2 *mat,
-                                CrankVecFloat2 *dvec)
-{
-  crank_mat_float2_init_diag (mat, dvec->x, dvec->y);
-}
 
 /**
  * crank_mat_float2_init_fill:
@@ -370,15 +434,6 @@ crank_mat_float2_init_diag_vec (CrankMatFloat2 *mat,
  *
  * Initialize a matrix by filling with a value.
  */
-void
-crank_mat_float2_init_fill (CrankMatFloat2 *mat,
-                            const gfloat    fill)
-{
-  mat->m00 = fill;
-  mat->m01 = fill;
-  mat->m10 = fill;
-  mat->m11 = fill;
-}
 
 /**
  * crank_mat_float2_copy:
@@ -387,12 +442,6 @@ crank_mat_float2_init_fill (CrankMatFloat2 *mat,
  *
  * Copies a matrix to other matrix.
  */
-void
-crank_mat_float2_copy (CrankMatFloat2 *mat,
-                       CrankMatFloat2 *other)
-{
-  crank_mat_float2_init_arr (other, (gfloat*) mat);
-}
 
 /**
  * crank_mat_float2_dup:
@@ -402,16 +451,6 @@ crank_mat_float2_copy (CrankMatFloat2 *mat,
  *
  * Returns: an allocated copy. Free it with g_free()
  */
-CrankMatFloat2*
-crank_mat_float2_dup (CrankMatFloat2 *mat)
-{
-  CrankMatFloat2 *result = g_new (CrankMatFloat2, 1);
-  crank_mat_float2_copy (mat, result);
-  return result;
-}
-
-
-//////// Basic Operations //////////////////////////////////////////////////////
 
 /**
  * crank_mat_float2_hash:
@@ -422,18 +461,6 @@ crank_mat_float2_dup (CrankMatFloat2 *mat)
  *
  * Returns: hash value of a matrix.
  */
-guint
-crank_mat_float2_hash (gconstpointer a)
-{
-  const CrankMatFloat2 *mat = (const CrankMatFloat2*)a;
-
-  guint hash;
-  hash =  crank_float_hash (&(mat->m00));
-  hash =  crank_float_hash (&(mat->m01)) + hash * 37;
-  hash =  crank_float_hash (&(mat->m10)) + hash * 37;
-  hash =  crank_float_hash (&(mat->m11)) + hash * 37;
-  return hash;
-}
 
 /**
  * crank_mat_float2_equal:
@@ -445,18 +472,6 @@ crank_mat_float2_hash (gconstpointer a)
  *
  * Returns: %TRUE if the two are same.
  */
-gboolean
-crank_mat_float2_equal (gconstpointer a,
-                        gconstpointer b)
-{
-  const CrankMatFloat2 *mat_a = (const CrankMatFloat2*)a;
-  const CrankMatFloat2 *mat_b = (const CrankMatFloat2*)b;
-
-  return (mat_a->m00 == mat_b->m00) &&
-         (mat_a->m01 == mat_b->m01) &&
-         (mat_a->m10 == mat_b->m10) &&
-         (mat_a->m11 == mat_b->m11);
-}
 
 /**
  * crank_mat_float2_to_string:
@@ -471,11 +486,6 @@ crank_mat_float2_equal (gconstpointer a,
  *
  * Returns: string representation of matrix.
  */
-gchar*
-crank_mat_float2_to_string (CrankMatFloat2 *mat)
-{
-  return crank_mat_float2_to_string_full (mat, "[", ", ", "]", "[", ", ", "]", "%g");
-}
 
 /**
  * crank_mat_float2_to_string_full:
@@ -492,38 +502,6 @@ crank_mat_float2_to_string (CrankMatFloat2 *mat)
  *
  * Returns: string representation of matrix.
  */
-gchar*
-crank_mat_float2_to_string_full (CrankMatFloat2 *mat,
-                                 const gchar    *mat_left,
-                                 const gchar    *mat_in,
-                                 const gchar    *mat_right,
-                                 const gchar    *row_left,
-                                 const gchar    *row_in,
-                                 const gchar    *row_right,
-                                 const gchar    *format)
-{
-  GString *builder;
-  gchar *str;
-
-  builder = g_string_new (mat_left);
-  g_string_append (builder,
-                   crank_vec_float2_to_string_full (((CrankVecFloat2*)mat) + 0,
-                                                    row_left, row_in, row_right,
-                                                    format)   );
-
-  g_string_append (builder, mat_in);
-  g_string_append (builder,
-                   crank_vec_float2_to_string_full (((CrankVecFloat2*)mat) + 1,
-                                                    row_left, row_in, row_right,
-                                                    format)   );
-
-  g_string_append (builder, mat_right);
-
-  str = builder->str;
-
-  g_string_free (builder, FALSE);
-  return str;
-}
 
 /**
  * crank_mat_float2_get:
@@ -535,13 +513,6 @@ crank_mat_float2_to_string_full (CrankMatFloat2 *mat,
  *
  * Returns: Element at given indices.
  */
-gfloat
-crank_mat_float2_get (CrankMatFloat2 *mat,
-                      const guint     i,
-                      const guint     j)
-{
-  return ((gfloat*)mat) [(2 * i)  +  j];
-}
 
 /**
  * crank_mat_float2_set:
@@ -552,14 +523,6 @@ crank_mat_float2_get (CrankMatFloat2 *mat,
  *
  * Sets element at given indices.
  */
-void
-crank_mat_float2_set (CrankMatFloat2 *mat,
-                      const guint     i,
-                      const guint     j,
-                      const gfloat    value)
-{
-  ((gfloat*)mat) [(2 * i)  +  j] = value;
-}
 
 /**
  * crank_mat_float2_get_row:
@@ -569,13 +532,6 @@ crank_mat_float2_set (CrankMatFloat2 *mat,
  *
  * Gets a row vector at given index.
  */
-void
-crank_mat_float2_get_row (CrankMatFloat2 *mat,
-                          const guint     index,
-                          CrankVecFloat2 *row)
-{
-  crank_vec_float2_init_arr (row, ((gfloat*)mat) + 2 * index);
-}
 
 /**
  * crank_mat_float2_set_row:
@@ -585,14 +541,6 @@ crank_mat_float2_get_row (CrankMatFloat2 *mat,
  *
  * Sets a row vector at given index.
  */
-void
-crank_mat_float2_set_row (CrankMatFloat2 *mat,
-                          const guint     index,
-                          CrankVecFloat2 *row)
-{
-  crank_vec_float2_init_arr (((CrankVecFloat2*)mat) + index, (gfloat*)row);
-}
-
 
 /**
  * crank_mat_float2_get_col:
@@ -602,15 +550,6 @@ crank_mat_float2_set_row (CrankMatFloat2 *mat,
  *
  * Gets a column vector at given index.
  */
-void
-crank_mat_float2_get_col (CrankMatFloat2 *mat,
-                          const guint     index,
-                          CrankVecFloat2 *col)
-{
-  gfloat *ptr = ((gfloat*)mat) + index;
-  col->x = ptr[0];
-  col->y = ptr[2];
-}
 
 /**
  * crank_mat_float2_set_col:
@@ -620,15 +559,6 @@ crank_mat_float2_get_col (CrankMatFloat2 *mat,
  *
  * Sets a column vector at given index.
  */
-void
-crank_mat_float2_set_col (CrankMatFloat2 *mat,
-                          const guint     index,
-                          CrankVecFloat2 *col)
-{
-  gfloat *ptr = ((gfloat*)mat) + index;
-  ptr[0] = col->x;
-  ptr[2] = col->y;
-}
 
 /**
  * crank_mat_float2_get_tr:
@@ -640,11 +570,6 @@ crank_mat_float2_set_col (CrankMatFloat2 *mat,
  *
  * Returns: A trace of matrix.
  */
-gfloat
-crank_mat_float2_get_tr (CrankMatFloat2 *mat)
-{
-  return mat->m00 + mat->m11;
-}
 
 /**
  * crank_mat_float2_get_det:
@@ -654,11 +579,6 @@ crank_mat_float2_get_tr (CrankMatFloat2 *mat)
  *
  * Returns: A determinent of matrix.
  */
-gfloat
-crank_mat_float2_get_det (CrankMatFloat2 *mat)
-{
-  return DET4(mat->m00, mat->m01, mat->m10, mat->m11);
-}
 
 /**
  * crank_mat_float2_get_cof:
@@ -667,15 +587,6 @@ crank_mat_float2_get_det (CrankMatFloat2 *mat)
  *
  * Gets a cofactor matrix.
  */
-void
-crank_mat_float2_get_cof (CrankMatFloat2 *mat,
-                          CrankMatFloat2 *r)
-{
-  r->m00 =    mat->m11;
-  r->m01 = -mat->m10;
-  r->m10 = -mat->m01;
-  r->m11 =    mat->m00;
-}
 
 /**
  * crank_mat_float2_get_adj:
@@ -684,13 +595,6 @@ crank_mat_float2_get_cof (CrankMatFloat2 *mat,
  *
  * Gets a adjugate matrix.
  */
-void
-crank_mat_float2_get_adj (CrankMatFloat2 *mat,
-                          CrankMatFloat2 *r)
-{
-  crank_mat_float2_get_cof (mat, r);
-  crank_mat_float2_transpose_self (r);
-}
 
 /**
  * crank_mat_float2_neg:
@@ -699,15 +603,6 @@ crank_mat_float2_get_adj (CrankMatFloat2 *mat,
  *
  * Negates a matrix.
  */
-void
-crank_mat_float2_neg (CrankMatFloat2 *a,
-                      CrankMatFloat2 *r)
-{
-  r->m00 = -a->m00;
-  r->m01 = -a->m01;
-  r->m10 = -a->m10;
-  r->m11 = -a->m11;
-}
 
 /**
  * crank_mat_float2_neg_self:
@@ -715,14 +610,6 @@ crank_mat_float2_neg (CrankMatFloat2 *a,
  *
  * Negates a matrix.
  */
-void
-crank_mat_float2_neg_self (CrankMatFloat2 *a)
-{
-  a->m00 = -a->m00;
-  a->m01 = -a->m01;
-  a->m10 = -a->m10;
-  a->m11 = -a->m11;
-}
 
 /**
  * crank_mat_float2_transpose:
@@ -731,15 +618,6 @@ crank_mat_float2_neg_self (CrankMatFloat2 *a)
  *
  * Gets a transpose of matrix.
  */
-void
-crank_mat_float2_transpose (CrankMatFloat2 *a,
-                            CrankMatFloat2 *r)
-{
-  r->m00 = a->m00;
-  r->m01 = a->m10;
-  r->m10 = a->m01;
-  r->m11 = a->m11;
-}
 
 /**
  * crank_mat_float2_transpose_self:
@@ -747,15 +625,6 @@ crank_mat_float2_transpose (CrankMatFloat2 *a,
  *
  * Gets a transpose of matrix.
  */
-void
-crank_mat_float2_transpose_self (CrankMatFloat2 *a)
-{
-  gfloat temp;
-
-  temp = a->m01;
-  a->m01 = a->m10;
-  a->m10 = temp;
-}
 
 /**
  * crank_mat_float2_inverse:
@@ -765,17 +634,6 @@ crank_mat_float2_transpose_self (CrankMatFloat2 *a)
  * Gets an inverse of matrix.
  * If the matrix is singular, then NaN matrix may be returned.
  */
-void
-crank_mat_float2_inverse (CrankMatFloat2 *a,
-                          CrankMatFloat2 *r)
-{
-  gfloat detinv = 1 / crank_mat_float2_get_det (a);
-
-  r->m00 = a->m11 * detinv;
-  r->m11 = a->m00 * detinv;
-  r->m01 = -a->m01 * detinv;
-  r->m10 = -a->m10 * detinv;
-}
 
 /**
  * crank_mat_float2_inverse_self:
@@ -784,20 +642,6 @@ crank_mat_float2_inverse (CrankMatFloat2 *a,
  * Gets an inverse of matrix.
  * If the matrix is singular, then NaN matrix may be returned.
  */
-void
-crank_mat_float2_inverse_self (CrankMatFloat2 *a)
-{
-  gfloat detinv = 1 / crank_mat_float2_get_det (a);
-
-  gfloat temp;
-
-  temp = a->m00 * detinv;
-  a->m00 = a->m11 * detinv;
-  a->m11 = temp;
-
-  a->m01 *= -detinv;
-  a->m10 *= -detinv;
-}
 
 /**
  * crank_mat_float2_try_inverse:
@@ -809,26 +653,6 @@ crank_mat_float2_inverse_self (CrankMatFloat2 *a)
  *
  * Returns: Whether the matrix is non-singular and inverse is done.
  */
-gboolean
-crank_mat_float2_try_inverse (CrankMatFloat2 *a,
-                              CrankMatFloat2 *r)
-{
-  gfloat det = crank_mat_float2_get_det (a);
-
-  if (det != 0)
-    {
-      gfloat detinv = 1 / det;
-
-      r->m00 = a->m11 * detinv;
-      r->m11 = a->m00 * detinv;
-      r->m01 = -a->m01 * detinv;
-      r->m10 = -a->m10 * detinv;
-
-      return TRUE;
-    }
-  else
-    return FALSE;
-}
 
 /**
  * crank_mat_float2_try_inverse_self:
@@ -839,29 +663,6 @@ crank_mat_float2_try_inverse (CrankMatFloat2 *a,
  *
  * Returns: Whether the matrix is non-singular and inverse is done.
  */
-gboolean
-crank_mat_float2_try_inverse_self (CrankMatFloat2 *a)
-{
-  gfloat det = crank_mat_float2_get_det (a);
-
-  if (det != 0)
-    {
-      gfloat detinv = 1 / det;
-
-      gfloat temp;
-
-      temp = a->m00 * detinv;
-      a->m00 = a->m11 * detinv;
-      a->m11 = temp;
-
-      a->m01 *= -detinv;
-      a->m10 *= -detinv;
-
-      return TRUE;
-    }
-  else
-    return FALSE;
-}
 
 /**
  * crank_mat_float2_muls:
@@ -871,18 +672,6 @@ crank_mat_float2_try_inverse_self (CrankMatFloat2 *a)
  *
  * Multiplies a matrix by scalar.
  */
-void
-crank_mat_float2_muls (CrankMatFloat2 *a,
-                       const gfloat    b,
-                       CrankMatFloat2 *r)
-{
-  g_return_if_fail (a != r);
-
-  r->m00 = a->m00 * b;
-  r->m01 = a->m01 * b;
-  r->m10 = a->m10 * b;
-  r->m11 = a->m11 * b;
-}
 
 /**
  * crank_mat_float2_muls_self:
@@ -891,15 +680,6 @@ crank_mat_float2_muls (CrankMatFloat2 *a,
  *
  * Multiplies a matrix by scalar.
  */
-void
-crank_mat_float2_muls_self (CrankMatFloat2 *a,
-                            const gfloat    b)
-{
-  a->m00 *= b;
-  a->m01 *= b;
-  a->m10 *= b;
-  a->m11 *= b;
-}
 
 /**
  * crank_mat_float2_mulv:
@@ -909,22 +689,6 @@ crank_mat_float2_muls_self (CrankMatFloat2 *a,
  *
  * Multiplies a matrix by vector.
  */
-void
-crank_mat_float2_mulv (CrankMatFloat2 *a,
-                       CrankVecFloat2 *b,
-                       CrankVecFloat2 *r)
-{
-  gfloat nx;
-  gfloat ny;
-
-  g_return_if_fail (b != r);
-
-  nx = a->m00 * b->x + a->m01 * b->y;
-  ny = a->m10 * b->x + a->m11 * b->y;
-
-  r->x = nx;
-  r->y = ny;
-}
 
 /**
  * crank_mat_float2_mul:
@@ -934,23 +698,6 @@ crank_mat_float2_mulv (CrankMatFloat2 *a,
  *
  * Multiplies two matrices.
  */
-void
-crank_mat_float2_mul (CrankMatFloat2 *a,
-                      CrankMatFloat2 *b,
-                      CrankMatFloat2 *r)
-{
-  CrankMatFloat2 nr;
-
-  g_return_if_fail (a != r);
-  g_return_if_fail (b != r);
-
-  nr.m00 = (a->m00 * b->m00) + (a->m01 * b->m10);
-  nr.m01 = (a->m00 * b->m01) + (a->m01 * b->m11);
-  nr.m10 = (a->m10 * b->m00) + (a->m11 * b->m10);
-  nr.m11 = (a->m10 * b->m01) + (a->m11 * b->m11);
-
-  crank_mat_float2_init_arr (r, (gfloat*)&nr);
-}
 
 /**
  * crank_mat_float2_mul_self:
@@ -959,19 +706,6 @@ crank_mat_float2_mul (CrankMatFloat2 *a,
  *
  * Multiplies two matrices.
  */
-void
-crank_mat_float2_mul_self (CrankMatFloat2 *a,
-                           CrankMatFloat2 *b)
-{
-  CrankMatFloat2 nr;
-
-  nr.m00 = (a->m00 * b->m00) + (a->m01 * b->m10);
-  nr.m01 = (a->m00 * b->m01) + (a->m01 * b->m11);
-  nr.m10 = (a->m10 * b->m00) + (a->m11 * b->m10);
-  nr.m11 = (a->m10 * b->m01) + (a->m11 * b->m11);
-
-  crank_mat_float2_copy (&nr, a);
-}
 
 /**
  * crank_mat_float2_divs:
@@ -981,18 +715,6 @@ crank_mat_float2_mul_self (CrankMatFloat2 *a,
  *
  * Divides a matrix by scalar.
  */
-void
-crank_mat_float2_divs (CrankMatFloat2 *a,
-                       const gfloat    b,
-                       CrankMatFloat2 *r)
-{
-  g_return_if_fail (a != r);
-
-  r->m00 = a->m00 / b;
-  r->m01 = a->m01 / b;
-  r->m10 = a->m10 / b;
-  r->m11 = a->m11 / b;
-}
 
 /**
  * crank_mat_float2_divs_self:
@@ -1001,17 +723,6 @@ crank_mat_float2_divs (CrankMatFloat2 *a,
  *
  * Divides a matrix by scalar.
  */
-void
-crank_mat_float2_divs_self (CrankMatFloat2 *a,
-                            const gfloat    b)
-{
-  a->m00 /= b;
-  a->m01 /= b;
-  a->m10 /= b;
-  a->m11 /= b;
-}
-
-
 
 /**
  * crank_mat_float2_add:
@@ -1021,19 +732,6 @@ crank_mat_float2_divs_self (CrankMatFloat2 *a,
  *
  * Adds a matrix.
  */
-void
-crank_mat_float2_add (CrankMatFloat2 *a,
-                      CrankMatFloat2 *b,
-                      CrankMatFloat2 *r)
-{
-  g_return_if_fail (a != r);
-  g_return_if_fail (b != r);
-
-  r->m00 = a->m00 + b->m00;
-  r->m01 = a->m01 + b->m01;
-  r->m10 = a->m10 + b->m10;
-  r->m11 = a->m11 + b->m11;
-}
 
 /**
  * crank_mat_float2_add_self:
@@ -1042,16 +740,6 @@ crank_mat_float2_add (CrankMatFloat2 *a,
  *
  * Adds a matrix.
  */
-void
-crank_mat_float2_add_self (CrankMatFloat2 *a,
-                           CrankMatFloat2 *b)
-{
-  a->m00 += b->m00;
-  a->m01 += b->m01;
-  a->m10 += b->m10;
-  a->m11 += b->m11;
-}
-
 
 /**
  * crank_mat_float2_sub:
@@ -1061,19 +749,7 @@ crank_mat_float2_add_self (CrankMatFloat2 *a,
  *
  * Subtracts a matrix.
  */
-void
-crank_mat_float2_sub (CrankMatFloat2 *a,
-                      CrankMatFloat2 *b,
-                      CrankMatFloat2 *r)
-{
-  g_return_if_fail (a != r);
-  g_return_if_fail (b != r);
 
-  r->m00 = a->m00 - b->m00;
-  r->m01 = a->m01 - b->m01;
-  r->m10 = a->m10 - b->m10;
-  r->m11 = a->m11 - b->m11;
-}
 /**
  * crank_mat_float2_sub_self:
  * @a: A Matrix
@@ -1081,15 +757,6 @@ crank_mat_float2_sub (CrankMatFloat2 *a,
  *
  * Subtracts a matrix.
  */
-void
-crank_mat_float2_sub_self (CrankMatFloat2 *a,
-                           CrankMatFloat2 *b)
-{
-  a->m00 -= b->m00;
-  a->m01 -= b->m01;
-  a->m10 -= b->m10;
-  a->m11 -= b->m11;
-}
 
 /**
  * crank_mat_float2_mixs:
@@ -1103,25 +770,6 @@ crank_mat_float2_sub_self (CrankMatFloat2 *a,
  * The result is calculated by,
  * * (a * (1 - c)) + (b * c)
  */
-void
-crank_mat_float2_mixs (CrankMatFloat2 *a,
-                       CrankMatFloat2 *b,
-                       const gfloat    c,
-                       CrankMatFloat2 *r)
-{
-  gfloat d;
-
-  g_return_if_fail (a != r);
-  g_return_if_fail (b != r);
-
-
-  d = 1 - c;
-
-  r->m00 = (a->m00 * d) + (b->m00 * c);
-  r->m01 = (a->m01 * d) + (b->m01 * c);
-  r->m10 = (a->m10 * d) + (b->m10 * c);
-  r->m11 = (a->m11 * d) + (b->m11 * c);
-}
 
 /**
  * crank_mat_float2_mix:
@@ -1135,51 +783,6 @@ crank_mat_float2_mixs (CrankMatFloat2 *a,
  * The result is calculated by,
  * * r[i, j] = (a[i, j] * (1 - c[i, j]) + (b[i, j] * c[i, j])
  */
-void
-crank_mat_float2_mix (CrankMatFloat2 *a,
-                      CrankMatFloat2 *b,
-                      CrankMatFloat2 *c,
-                      CrankMatFloat2 *r)
-{
-  g_return_if_fail (a != r);
-  g_return_if_fail (b != r);
-  g_return_if_fail (c != r);
-
-  r->m00 = (a->m00 * (1 - c->m00)) + (b->m00 * c->m00);
-  r->m01 = (a->m01 * (1 - c->m01)) + (b->m01 * c->m01);
-  r->m10 = (a->m10 * (1 - c->m10)) + (b->m10 * c->m10);
-  r->m11 = (a->m11 * (1 - c->m11)) + (b->m11 * c->m11);
-}
-
-//////// GValue Transformation /////////////////////////////////////////////////
-
-static void
-crank_mat_float2_transform_to_string (const GValue *src,
-                                      GValue       *dest)
-{
-  CrankMatFloat2 *mf = (CrankMatFloat2*) g_value_get_boxed (src);
-  gchar *str = crank_mat_float2_to_string (mf);
-  g_value_take_string (dest, str);
-}
-
-
-
-
-
-static void crank_mat_float3_transform_to_string (const GValue *src,
-                                                  GValue       *dest);
-
-G_DEFINE_BOXED_TYPE_WITH_CODE (
-  CrankMatFloat3,
-  crank_mat_float3,
-  crank_mat_float3_dup,
-  g_free,
-  {
-    g_value_register_transform_func (
-      g_define_type_id,
-      G_TYPE_STRING,
-      crank_mat_float3_transform_to_string);
-  })
 
 /**
  * crank_mat_float3_init:
@@ -1196,28 +799,6 @@ G_DEFINE_BOXED_TYPE_WITH_CODE (
  *
  * Initialize a matrix with given elements.
  */
-void
-crank_mat_float3_init (CrankMatFloat3 *mat,
-                       const gfloat    m00,
-                       const gfloat    m01,
-                       const gfloat    m02,
-                       const gfloat    m10,
-                       const gfloat    m11,
-                       const gfloat    m12,
-                       const gfloat    m20,
-                       const gfloat    m21,
-                       const gfloat    m22)
-{
-  mat->m00 = m00;
-  mat->m01 = m01;
-  mat->m02 = m02;
-  mat->m10 = m10;
-  mat->m11 = m11;
-  mat->m12 = m12;
-  mat->m20 = m20;
-  mat->m21 = m21;
-  mat->m22 = m22;
-}
 
 /**
  * crank_mat_float3_init_arr:
@@ -1226,12 +807,6 @@ crank_mat_float3_init (CrankMatFloat3 *mat,
  *
  * Initialize a matrix with given array.
  */
-void
-crank_mat_float3_init_arr (CrankMatFloat3 *mat,
-                           const gfloat   *marr)
-{
-  memcpy (mat, marr, sizeof(gfloat) * 9);
-}
 
 /**
  * crank_mat_float3_init_row:
@@ -1242,16 +817,6 @@ crank_mat_float3_init_arr (CrankMatFloat3 *mat,
  *
  * Initialize a matrix with given row vectors.
  */
-void
-crank_mat_float3_init_row (CrankMatFloat3 *mat,
-                           CrankVecFloat3 *row0,
-                           CrankVecFloat3 *row1,
-                           CrankVecFloat3 *row2)
-{
-  crank_vec_float3_init_arr ((CrankVecFloat3*)mat,       (gfloat*)row0);
-  crank_vec_float3_init_arr (((CrankVecFloat3*)mat) + 1, (gfloat*)row1);
-  crank_vec_float3_init_arr (((CrankVecFloat3*)mat) + 2, (gfloat*)row2);
-}
 
 /**
  * crank_mat_float3_init_row_arr:
@@ -1260,12 +825,6 @@ crank_mat_float3_init_row (CrankMatFloat3 *mat,
  *
  * Initialize a matrix with array of row vectors.
  */
-void
-crank_mat_float3_init_row_arr (CrankMatFloat3 *mat,
-                               CrankVecFloat3 *row_arr)
-{
-  crank_mat_float3_init_row (mat, row_arr, row_arr + 1, row_arr + 2);
-}
 
 /**
  * crank_mat_float3_init_row_parr:
@@ -1274,13 +833,6 @@ crank_mat_float3_init_row_arr (CrankMatFloat3 *mat,
  *
  * Initialize a matrix with array of row vectors.
  */
-void
-crank_mat_float3_init_row_parr (CrankMatFloat3  *mat,
-                                CrankVecFloat3 **row_parr)
-{
-  crank_mat_float3_init_row (mat, row_parr[0], row_parr[1], row_parr[2]);
-}
-
 
 /**
  * crank_mat_float3_init_col:
@@ -1291,22 +843,6 @@ crank_mat_float3_init_row_parr (CrankMatFloat3  *mat,
  *
  * Initialize a matrix with column vectors.
  */
-void
-crank_mat_float3_init_col (CrankMatFloat3 *mat,
-                           CrankVecFloat3 *col0,
-                           CrankVecFloat3 *col1,
-                           CrankVecFloat3 *col2)
-{
-  mat->m00 = col0->x;
-  mat->m01 = col1->x;
-  mat->m02 = col2->x;
-  mat->m10 = col0->y;
-  mat->m11 = col1->y;
-  mat->m12 = col2->y;
-  mat->m20 = col0->z;
-  mat->m21 = col1->z;
-  mat->m22 = col2->z;
-}
 
 /**
  * crank_mat_float3_init_col_arr:
@@ -1315,12 +851,6 @@ crank_mat_float3_init_col (CrankMatFloat3 *mat,
  *
  * Initialize a matrix with an array of column vectors.
  */
-void
-crank_mat_float3_init_col_arr (CrankMatFloat3 *mat,
-                               CrankVecFloat3 *col_arr)
-{
-  crank_mat_float3_init_col (mat, col_arr, col_arr + 1, col_arr + 2);
-}
 
 /**
  * crank_mat_float3_init_col_parr:
@@ -1329,12 +859,6 @@ crank_mat_float3_init_col_arr (CrankMatFloat3 *mat,
  *
  * Initialize a matrix with an array of column vectors.
  */
-void
-crank_mat_float3_init_col_parr (CrankMatFloat3  *mat,
-                                CrankVecFloat3 **col_parr)
-{
-  crank_mat_float3_init_col (mat, col_parr[0], col_parr[1], col_parr[2]);
-}
 
 /**
  * crank_mat_float3_init_diag:
@@ -1346,22 +870,6 @@ crank_mat_float3_init_col_parr (CrankMatFloat3  *mat,
  * Initialize a matrix with diagonal elements.
  * Other elements are initialized with 0.
  */
-void
-crank_mat_float3_init_diag (CrankMatFloat3 *mat,
-                            const gfloat    m00,
-                            const gfloat    m11,
-                            const gfloat    m22)
-{
-  mat->m00 = m00;
-  mat->m01 = 0;
-  mat->m02 = 0;
-  mat->m10 = 0;
-  mat->m11 = m11;
-  mat->m12 = 0;
-  mat->m20 = 0;
-  mat->m21 = 0;
-  mat->m22 = m22;
-}
 
 /**
  * crank_mat_float3_init_diag_arr:
@@ -1371,12 +879,6 @@ crank_mat_float3_init_diag (CrankMatFloat3 *mat,
  * Initialize a matrix with an array of diagonal elements.
  * Other elements are initialized with 0.
  */
-void
-crank_mat_float3_init_diag_arr (CrankMatFloat3 *mat,
-                                const gfloat   *darr)
-{
-  crank_mat_float3_init_diag (mat, darr[0], darr[1], darr[2]);
-}
 
 /**
  * crank_mat_float3_init_diag_vec:
@@ -1386,12 +888,6 @@ crank_mat_float3_init_diag_arr (CrankMatFloat3 *mat,
  * Initialize a matrix with a vector of diagonal elements.
  * Other elements are initialized with 0.
  */
-void
-crank_mat_float3_init_diag_vec (CrankMatFloat3 *mat,
-                                CrankVecFloat3 *dvec)
-{
-  crank_mat_float3_init_diag (mat, dvec->x, dvec->y, dvec->z);
-}
 
 /**
  * crank_mat_float3_init_fill:
@@ -1400,20 +896,6 @@ crank_mat_float3_init_diag_vec (CrankMatFloat3 *mat,
  *
  * Initialize a matrix by filling with a value.
  */
-void
-crank_mat_float3_init_fill (CrankMatFloat3 *mat,
-                            const gfloat    fill)
-{
-  mat->m00 = fill;
-  mat->m01 = fill;
-  mat->m02 = fill;
-  mat->m10 = fill;
-  mat->m11 = fill;
-  mat->m12 = fill;
-  mat->m20 = fill;
-  mat->m21 = fill;
-  mat->m22 = fill;
-}
 
 /**
  * crank_mat_float3_init_rot:
@@ -1423,32 +905,6 @@ crank_mat_float3_init_fill (CrankMatFloat3 *mat,
  *
  * Initialize a matrix by rotation.
  */
-void
-crank_mat_float3_init_rot (CrankMatFloat3 *mat,
-                           const gfloat    angle,
-                           CrankVecFloat3 *axis)
-{
-  CrankVecFloat3 uvec;
-  gfloat s, c, c1;
-
-  crank_vec_float3_unit (axis, &uvec);
-
-  s = sinf (angle);
-  c = cosf (angle);
-  c1 = 1 - c;
-
-  mat->m00 = uvec.x * uvec.x * c1 + c;
-  mat->m01 = uvec.x * uvec.y * c1 - uvec.z * s;
-  mat->m02 = uvec.x * uvec.z * c1 + uvec.y * s;
-
-  mat->m10 = uvec.y * uvec.x * c1 + uvec.z * s;
-  mat->m11 = uvec.y * uvec.y * c1 + c;
-  mat->m12 = uvec.y * uvec.z * c1 - uvec.x * s;
-
-  mat->m20 = uvec.z * uvec.x * c1 - uvec.y * s;
-  mat->m21 = uvec.z * uvec.y * c1 + uvec.x * s;
-  mat->m22 = uvec.z * uvec.z * c1 + c;
-}
 
 /**
  * crank_mat_float3_init_urot:
@@ -1460,17 +916,6 @@ crank_mat_float3_init_rot (CrankMatFloat3 *mat,
  *
  * Initialize a matrix by rotation.
  */
-void
-crank_mat_float3_init_urot (CrankMatFloat3 *mat,
-                           const gfloat    angle,
-                           const gfloat    axis_x,
-                           const gfloat    axis_y,
-                           const gfloat    axis_z)
-{
-  CrankVecFloat3 axis = {axis_x, axis_y, axis_z};
-
-  crank_mat_float3_init_rot (mat, angle, &axis);
-}
 
 /**
  * crank_mat_float3_copy:
@@ -1479,12 +924,6 @@ crank_mat_float3_init_urot (CrankMatFloat3 *mat,
  *
  * Copies a matrix to other matrix.
  */
-void
-crank_mat_float3_copy (CrankMatFloat3 *mat,
-                       CrankMatFloat3 *other)
-{
-  crank_mat_float3_init_arr (other, (gfloat*) mat);
-}
 
 /**
  * crank_mat_float3_dup:
@@ -1494,16 +933,6 @@ crank_mat_float3_copy (CrankMatFloat3 *mat,
  *
  * Returns: an allocated copy. Free it with g_free()
  */
-CrankMatFloat3*
-crank_mat_float3_dup (CrankMatFloat3 *mat)
-{
-  CrankMatFloat3 *result = g_new (CrankMatFloat3, 1);
-  crank_mat_float3_copy (mat, result);
-  return result;
-}
-
-
-//////// Basic Operations //////////////////////////////////////////////////////
 
 /**
  * crank_mat_float3_hash:
@@ -1514,22 +943,6 @@ crank_mat_float3_dup (CrankMatFloat3 *mat)
  *
  * Returns: hash value of a matrix.
  */
-guint
-crank_mat_float3_hash (gconstpointer a)
-{
-  const CrankMatFloat3 *mat = (const CrankMatFloat3*)a;
-
-  guint hash = crank_float_hash (&(mat->m00));
-  hash = crank_float_hash (&(mat->m01)) + hash * 37;
-  hash = crank_float_hash (&(mat->m02)) + hash * 37;
-  hash = crank_float_hash (&(mat->m10)) + hash * 37;
-  hash = crank_float_hash (&(mat->m11)) + hash * 37;
-  hash = crank_float_hash (&(mat->m12)) + hash * 37;
-  hash = crank_float_hash (&(mat->m20)) + hash * 37;
-  hash = crank_float_hash (&(mat->m21)) + hash * 37;
-  hash = crank_float_hash (&(mat->m22)) + hash * 37;
-  return hash;
-}
 
 /**
  * crank_mat_float3_equal:
@@ -1541,23 +954,6 @@ crank_mat_float3_hash (gconstpointer a)
  *
  * Returns: %TRUE if the two are same.
  */
-gboolean
-crank_mat_float3_equal (gconstpointer a,
-                        gconstpointer b)
-{
-  const CrankMatFloat3 *mat_a = (const CrankMatFloat3*)a;
-  const CrankMatFloat3 *mat_b = (const CrankMatFloat3*)b;
-
-  return (mat_a->m00 == mat_b->m00) &&
-         (mat_a->m01 == mat_b->m01) &&
-         (mat_a->m02 == mat_b->m02) &&
-         (mat_a->m10 == mat_b->m10) &&
-         (mat_a->m11 == mat_b->m11) &&
-         (mat_a->m12 == mat_b->m12) &&
-         (mat_a->m20 == mat_b->m20) &&
-         (mat_a->m21 == mat_b->m21) &&
-         (mat_a->m22 == mat_b->m22);
-}
 
 /**
  * crank_mat_float3_to_string:
@@ -1572,11 +968,6 @@ crank_mat_float3_equal (gconstpointer a,
  *
  * Returns: string representation of matrix.
  */
-gchar*
-crank_mat_float3_to_string (CrankMatFloat3 *mat)
-{
-  return crank_mat_float3_to_string_full (mat, "[", ", ", "]", "[", ", ", "]", "%g");
-}
 
 /**
  * crank_mat_float3_to_string_full:
@@ -1593,44 +984,6 @@ crank_mat_float3_to_string (CrankMatFloat3 *mat)
  *
  * Returns: string representation of matrix.
  */
-gchar*
-crank_mat_float3_to_string_full (CrankMatFloat3 *mat,
-                                 const gchar    *mat_left,
-                                 const gchar    *mat_in,
-                                 const gchar    *mat_right,
-                                 const gchar    *row_left,
-                                 const gchar    *row_in,
-                                 const gchar    *row_right,
-                                 const gchar    *format)
-{
-  GString *builder;
-  gchar *str;
-
-  builder = g_string_new (mat_left);
-  g_string_append (builder,
-                   crank_vec_float3_to_string_full (((CrankVecFloat3*)mat) + 0,
-                                                    row_left, row_in, row_right,
-                                                    format)   );
-
-  g_string_append (builder, mat_in);
-  g_string_append (builder,
-                   crank_vec_float3_to_string_full (((CrankVecFloat3*)mat) + 1,
-                                                    row_left, row_in, row_right,
-                                                    format)   );
-
-  g_string_append (builder, mat_in);
-  g_string_append (builder,
-                   crank_vec_float3_to_string_full (((CrankVecFloat3*)mat) + 2,
-                                                    row_left, row_in, row_right,
-                                                    format)   );
-
-  g_string_append (builder, mat_right);
-
-  str = builder->str;
-
-  g_string_free (builder, FALSE);
-  return str;
-}
 
 /**
  * crank_mat_float3_get:
@@ -1642,13 +995,6 @@ crank_mat_float3_to_string_full (CrankMatFloat3 *mat,
  *
  * Returns: Element at given indices.
  */
-gfloat
-crank_mat_float3_get (CrankMatFloat3 *mat,
-                      const guint     i,
-                      const guint     j)
-{
-  return ((gfloat*)mat) [(3 * i)  +  j];
-}
 
 /**
  * crank_mat_float3_set:
@@ -1659,14 +1005,6 @@ crank_mat_float3_get (CrankMatFloat3 *mat,
  *
  * Sets element at given indices.
  */
-void
-crank_mat_float3_set (CrankMatFloat3 *mat,
-                      const guint     i,
-                      const guint     j,
-                      const gfloat    value)
-{
-  ((gfloat*)mat) [(3 * i)  +  j] = value;
-}
 
 /**
  * crank_mat_float3_get_row:
@@ -1676,13 +1014,6 @@ crank_mat_float3_set (CrankMatFloat3 *mat,
  *
  * Gets a row vector at given index.
  */
-void
-crank_mat_float3_get_row (CrankMatFloat3 *mat,
-                          const guint     index,
-                          CrankVecFloat3 *row)
-{
-  crank_vec_float3_init_arr (row, ((gfloat*)mat) + 3 * index);
-}
 
 /**
  * crank_mat_float3_set_row:
@@ -1692,14 +1023,6 @@ crank_mat_float3_get_row (CrankMatFloat3 *mat,
  *
  * Sets a row vector at given index.
  */
-void
-crank_mat_float3_set_row (CrankMatFloat3 *mat,
-                          const guint     index,
-                          CrankVecFloat3 *row)
-{
-  crank_vec_float3_init_arr (((CrankVecFloat3*)mat) + index, (gfloat*)row);
-}
-
 
 /**
  * crank_mat_float3_get_col:
@@ -1709,16 +1032,6 @@ crank_mat_float3_set_row (CrankMatFloat3 *mat,
  *
  * Gets a column vector at given index.
  */
-void
-crank_mat_float3_get_col (CrankMatFloat3 *mat,
-                          const guint     index,
-                          CrankVecFloat3 *col)
-{
-  gfloat *ptr = ((gfloat*)mat) + index;
-  col->x = ptr[0];
-  col->y = ptr[3];
-  col->z = ptr[6];
-}
 
 /**
  * crank_mat_float3_set_col:
@@ -1728,16 +1041,6 @@ crank_mat_float3_get_col (CrankMatFloat3 *mat,
  *
  * Sets a column vector at given index.
  */
-void
-crank_mat_float3_set_col (CrankMatFloat3 *mat,
-                          const guint     index,
-                          CrankVecFloat3 *col)
-{
-  gfloat *ptr = ((gfloat*)mat) + index;
-  ptr[0] = col->x;
-  ptr[3] = col->y;
-  ptr[6] = col->z;
-}
 
 /**
  * crank_mat_float3_get_tr:
@@ -1749,11 +1052,6 @@ crank_mat_float3_set_col (CrankMatFloat3 *mat,
  *
  * Returns: A trace of matrix.
  */
-gfloat
-crank_mat_float3_get_tr (CrankMatFloat3 *mat)
-{
-  return mat->m00 + mat->m11 + mat->m22;
-}
 
 /**
  * crank_mat_float3_get_det:
@@ -1763,13 +1061,6 @@ crank_mat_float3_get_tr (CrankMatFloat3 *mat)
  *
  * Returns: A determinent of matrix.
  */
-gfloat
-crank_mat_float3_get_det (CrankMatFloat3 *mat)
-{
-  return (mat->m00 * DET4(mat->m11, mat->m12, mat->m21, mat->m22)) -
-         (mat->m01 * DET4(mat->m10, mat->m12, mat->m20, mat->m22)) +
-         (mat->m02 * DET4(mat->m10, mat->m11, mat->m20, mat->m21));
-}
 
 /**
  * crank_mat_float3_get_cof:
@@ -1778,22 +1069,6 @@ crank_mat_float3_get_det (CrankMatFloat3 *mat)
  *
  * Gets a cofactor matrix.
  */
-void
-crank_mat_float3_get_cof (CrankMatFloat3 *mat,
-                          CrankMatFloat3 *r)
-{
-  r->m00 =  DET4(mat->m11, mat->m12, mat->m21, mat->m22);
-  r->m01 = -DET4(mat->m10, mat->m12, mat->m20, mat->m22);
-  r->m02 =  DET4(mat->m10, mat->m11, mat->m20, mat->m21);
-
-  r->m10 = -DET4(mat->m01, mat->m02, mat->m21, mat->m22);
-  r->m11 =  DET4(mat->m00, mat->m02, mat->m20, mat->m22);
-  r->m12 = -DET4(mat->m00, mat->m01, mat->m20, mat->m21);
-
-  r->m20 =  DET4(mat->m01, mat->m02, mat->m11, mat->m12);
-  r->m21 = -DET4(mat->m00, mat->m02, mat->m10, mat->m12);
-  r->m22 =  DET4(mat->m00, mat->m01, mat->m10, mat->m11);
-}
 
 /**
  * crank_mat_float3_get_adj:
@@ -1802,14 +1077,6 @@ crank_mat_float3_get_cof (CrankMatFloat3 *mat,
  *
  * Gets a adjugate matrix.
  */
-void
-crank_mat_float3_get_adj (CrankMatFloat3 *mat,
-                          CrankMatFloat3 *r)
-{
-  crank_mat_float3_get_cof (mat, r);
-  crank_mat_float3_transpose_self (r);
-}
-
 
 /**
  * crank_mat_float3_get_rangle:
@@ -1819,19 +1086,6 @@ crank_mat_float3_get_adj (CrankMatFloat3 *mat,
  *
  * Returns: rotation angle, in radian.
  */
-gfloat
-crank_mat_float3_get_rangle (CrankMatFloat3 *mat)
-{
-  CrankVecFloat3 a;
-  gfloat t;
-
-  a.x = mat->m21 - mat->m12;
-  a.y = mat->m02 - mat->m20;
-  a.z = mat->m10 - mat->m01;
-  t = mat->m00 + mat->m11 + mat->m22 - 1;
-
-  return atan2f (crank_vec_float3_get_magn (&a), t);
-}
 
 /**
  * crank_mat_float3_get_raxis:
@@ -1840,19 +1094,6 @@ crank_mat_float3_get_rangle (CrankMatFloat3 *mat)
  *
  * Gets rotation axis of rotation that @mat represents.
  */
-void
-crank_mat_float3_get_raxis (CrankMatFloat3 *mat,
-                            CrankVecFloat3 *axis)
-{
-  CrankVecFloat3 a;
-
-  a.x = mat->m21 - mat->m12;
-  a.y = mat->m02 - mat->m20;
-  a.z = mat->m10 - mat->m01;
-
-  crank_vec_float3_unit (&a, axis);
-}
-
 
 /**
  * crank_mat_float3_neg:
@@ -1861,20 +1102,6 @@ crank_mat_float3_get_raxis (CrankMatFloat3 *mat,
  *
  * Negates a matrix.
  */
-void
-crank_mat_float3_neg (CrankMatFloat3 *a,
-                      CrankMatFloat3 *r)
-{
-  r->m00 = -a->m00;
-  r->m01 = -a->m01;
-  r->m02 = -a->m02;
-  r->m10 = -a->m10;
-  r->m11 = -a->m11;
-  r->m12 = -a->m12;
-  r->m20 = -a->m20;
-  r->m21 = -a->m21;
-  r->m22 = -a->m22;
-}
 
 /**
  * crank_mat_float3_neg_self:
@@ -1882,19 +1109,6 @@ crank_mat_float3_neg (CrankMatFloat3 *a,
  *
  * Negates a matrix.
  */
-void
-crank_mat_float3_neg_self (CrankMatFloat3 *a)
-{
-  a->m00 = -a->m00;
-  a->m01 = -a->m01;
-  a->m02 = -a->m02;
-  a->m10 = -a->m10;
-  a->m11 = -a->m11;
-  a->m12 = -a->m12;
-  a->m20 = -a->m20;
-  a->m21 = -a->m21;
-  a->m22 = -a->m22;
-}
 
 /**
  * crank_mat_float3_transpose:
@@ -1903,20 +1117,6 @@ crank_mat_float3_neg_self (CrankMatFloat3 *a)
  *
  * Gets a transpose of matrix.
  */
-void
-crank_mat_float3_transpose (CrankMatFloat3 *a,
-                            CrankMatFloat3 *r)
-{
-  r->m00 = a->m00;
-  r->m01 = a->m10;
-  r->m02 = a->m20;
-  r->m10 = a->m01;
-  r->m11 = a->m11;
-  r->m12 = a->m21;
-  r->m20 = a->m02;
-  r->m21 = a->m12;
-  r->m22 = a->m22;
-}
 
 /**
  * crank_mat_float3_transpose_self:
@@ -1924,23 +1124,6 @@ crank_mat_float3_transpose (CrankMatFloat3 *a,
  *
  * Gets a transpose of matrix.
  */
-void
-crank_mat_float3_transpose_self (CrankMatFloat3 *a)
-{
-  gfloat temp;
-
-  temp = a->m01;
-  a->m01 = a->m10;
-  a->m10 = temp;
-
-  temp = a->m02;
-  a->m02 = a->m20;
-  a->m20 = temp;
-
-  temp = a->m12;
-  a->m12 = a->m21;
-  a->m21 = temp;
-}
 
 /**
  * crank_mat_float3_inverse:
@@ -1950,16 +1133,6 @@ crank_mat_float3_transpose_self (CrankMatFloat3 *a)
  * Gets an inverse of matrix.
  * If the matrix is singular, then NaN matrix may be returned.
  */
-void
-crank_mat_float3_inverse (CrankMatFloat3 *a,
-                          CrankMatFloat3 *r)
-{
-  CrankMatFloat3 adj;
-  gfloat det = crank_mat_float3_get_det (a);
-
-  crank_mat_float3_get_adj (a, &adj);
-  crank_mat_float3_divs (&adj, det, r);
-}
 
 /**
  * crank_mat_float3_inverse_self:
@@ -1968,15 +1141,6 @@ crank_mat_float3_inverse (CrankMatFloat3 *a,
  * Gets an inverse of matrix.
  * If the matrix is singular, then NaN matrix may be returned.
  */
-void
-crank_mat_float3_inverse_self (CrankMatFloat3 *a)
-{
-  CrankMatFloat3 adj;
-  gfloat det = crank_mat_float3_get_det (a);
-
-  crank_mat_float3_get_adj (a, &adj);
-  crank_mat_float3_divs (&adj, det, a);
-}
 
 /**
  * crank_mat_float3_try_inverse:
@@ -1988,23 +1152,6 @@ crank_mat_float3_inverse_self (CrankMatFloat3 *a)
  *
  * Returns: Whether the matrix is non-singular and inverse is done.
  */
-gboolean
-crank_mat_float3_try_inverse (CrankMatFloat3 *a,
-                              CrankMatFloat3 *r)
-{
-  CrankMatFloat3 adj;
-  gfloat det = crank_mat_float3_get_det (a);
-
-  if (det != 0)
-    {
-      crank_mat_float3_get_adj (a, &adj);
-      crank_mat_float3_divs (&adj, det, r);
-
-      return TRUE;
-    }
-  else
-    return FALSE;
-}
 
 /**
  * crank_mat_float3_try_inverse_self:
@@ -2013,23 +1160,6 @@ crank_mat_float3_try_inverse (CrankMatFloat3 *a,
  * Gets an inverse of matrix.
  * If the matrix is singular, then NaN matrix may be returned.
  */
-gboolean
-crank_mat_float3_try_inverse_self (CrankMatFloat3 *a)
-{
-  CrankMatFloat3 adj;
-  gfloat det = crank_mat_float3_get_det (a);
-
-  if (det != 0)
-    {
-      crank_mat_float3_get_adj (a, &adj);
-      crank_mat_float3_divs (&adj, det, a);
-
-      return TRUE;
-    }
-  else
-    return FALSE;
-}
-
 
 /**
  * crank_mat_float3_muls:
@@ -2039,23 +1169,6 @@ crank_mat_float3_try_inverse_self (CrankMatFloat3 *a)
  *
  * Multiplies a matrix by scalar.
  */
-void
-crank_mat_float3_muls (CrankMatFloat3 *a,
-                       const gfloat    b,
-                       CrankMatFloat3 *r)
-{
-  g_return_if_fail (a != r);
-
-  r->m00 = a->m00 * b;
-  r->m01 = a->m01 * b;
-  r->m02 = a->m02 * b;
-  r->m10 = a->m10 * b;
-  r->m11 = a->m11 * b;
-  r->m12 = a->m12 * b;
-  r->m20 = a->m20 * b;
-  r->m21 = a->m21 * b;
-  r->m22 = a->m22 * b;
-}
 
 /**
  * crank_mat_float3_muls_self:
@@ -2064,20 +1177,6 @@ crank_mat_float3_muls (CrankMatFloat3 *a,
  *
  * Multiplies a matrix by scalar.
  */
-void
-crank_mat_float3_muls_self (CrankMatFloat3 *a,
-                            const gfloat    b)
-{
-  a->m00 *= b;
-  a->m01 *= b;
-  a->m02 *= b;
-  a->m10 *= b;
-  a->m11 *= b;
-  a->m12 *= b;
-  a->m20 *= b;
-  a->m21 *= b;
-  a->m22 *= b;
-}
 
 /**
  * crank_mat_float3_mulv:
@@ -2087,25 +1186,6 @@ crank_mat_float3_muls_self (CrankMatFloat3 *a,
  *
  * Multiplies a matrix by vector.
  */
-void
-crank_mat_float3_mulv (CrankMatFloat3 *a,
-                       CrankVecFloat3 *b,
-                       CrankVecFloat3 *r)
-{
-  gfloat nx;
-  gfloat ny;
-  gfloat nz;
-
-  g_return_if_fail (b != r);
-
-  nx = (a->m00 * b->x) + (a->m01 * b->y) + (a->m02 * b->z);
-  ny = (a->m10 * b->x) + (a->m11 * b->y) + (a->m12 * b->z);
-  nz = (a->m20 * b->x) + (a->m21 * b->y) + (a->m22 * b->z);
-
-  r->x = nx;
-  r->y = ny;
-  r->z = nz;
-}
 
 /**
  * crank_mat_float3_mul:
@@ -2115,30 +1195,6 @@ crank_mat_float3_mulv (CrankMatFloat3 *a,
  *
  * Multiplies two matrices.
  */
-void
-crank_mat_float3_mul (CrankMatFloat3 *a,
-                      CrankMatFloat3 *b,
-                      CrankMatFloat3 *r)
-{
-  CrankMatFloat3 nr;
-
-  g_return_if_fail (a != r);
-  g_return_if_fail (b != r);
-
-  nr.m00 = (a->m00 * b->m00) + (a->m01 * b->m10) + (a->m02 * b->m20);
-  nr.m01 = (a->m00 * b->m01) + (a->m01 * b->m11) + (a->m02 * b->m21);
-  nr.m02 = (a->m00 * b->m02) + (a->m01 * b->m12) + (a->m02 * b->m22);
-
-  nr.m10 = (a->m10 * b->m00) + (a->m11 * b->m10) + (a->m12 * b->m20);
-  nr.m11 = (a->m10 * b->m01) + (a->m11 * b->m11) + (a->m12 * b->m21);
-  nr.m12 = (a->m10 * b->m02) + (a->m11 * b->m12) + (a->m12 * b->m22);
-
-  nr.m20 = (a->m20 * b->m00) + (a->m21 * b->m10) + (a->m22 * b->m20);
-  nr.m21 = (a->m20 * b->m01) + (a->m21 * b->m11) + (a->m22 * b->m21);
-  nr.m22 = (a->m20 * b->m02) + (a->m21 * b->m12) + (a->m22 * b->m22);
-
-  crank_mat_float3_copy (&nr, r);
-}
 
 /**
  * crank_mat_float3_mul_self:
@@ -2147,26 +1203,6 @@ crank_mat_float3_mul (CrankMatFloat3 *a,
  *
  * Multiplies two matrices.
  */
-void
-crank_mat_float3_mul_self (CrankMatFloat3 *a,
-                           CrankMatFloat3 *b)
-{
-  CrankMatFloat3 nr;
-
-  nr.m00 = (a->m00 * b->m00) + (a->m01 * b->m10) + (a->m02 * b->m20);
-  nr.m01 = (a->m00 * b->m01) + (a->m01 * b->m11) + (a->m02 * b->m21);
-  nr.m02 = (a->m00 * b->m02) + (a->m01 * b->m12) + (a->m02 * b->m22);
-
-  nr.m10 = (a->m10 * b->m00) + (a->m11 * b->m10) + (a->m12 * b->m20);
-  nr.m11 = (a->m10 * b->m01) + (a->m11 * b->m11) + (a->m12 * b->m21);
-  nr.m12 = (a->m10 * b->m02) + (a->m11 * b->m12) + (a->m12 * b->m22);
-
-  nr.m20 = (a->m20 * b->m00) + (a->m21 * b->m10) + (a->m22 * b->m20);
-  nr.m21 = (a->m20 * b->m01) + (a->m21 * b->m11) + (a->m22 * b->m21);
-  nr.m22 = (a->m20 * b->m02) + (a->m21 * b->m12) + (a->m22 * b->m22);
-
-  crank_mat_float3_copy (&nr, a);
-}
 
 /**
  * crank_mat_float3_divs:
@@ -2176,23 +1212,6 @@ crank_mat_float3_mul_self (CrankMatFloat3 *a,
  *
  * Divides a matrix by scalar.
  */
-void
-crank_mat_float3_divs (CrankMatFloat3 *a,
-                       const gfloat    b,
-                       CrankMatFloat3 *r)
-{
-  g_return_if_fail (a != r);
-
-  r->m00 = a->m00 / b;
-  r->m01 = a->m01 / b;
-  r->m02 = a->m02 / b;
-  r->m10 = a->m10 / b;
-  r->m11 = a->m11 / b;
-  r->m12 = a->m12 / b;
-  r->m20 = a->m20 / b;
-  r->m21 = a->m21 / b;
-  r->m22 = a->m22 / b;
-}
 
 /**
  * crank_mat_float3_divs_self:
@@ -2201,21 +1220,6 @@ crank_mat_float3_divs (CrankMatFloat3 *a,
  *
  * Divides a matrix by scalar.
  */
-void
-crank_mat_float3_divs_self (CrankMatFloat3 *a,
-                            const gfloat    b)
-{
-  a->m00 /= b;
-  a->m01 /= b;
-  a->m02 /= b;
-  a->m10 /= b;
-  a->m11 /= b;
-  a->m12 /= b;
-  a->m20 /= b;
-  a->m21 /= b;
-  a->m22 /= b;
-}
-
 
 /**
  * crank_mat_float3_add:
@@ -2225,24 +1229,6 @@ crank_mat_float3_divs_self (CrankMatFloat3 *a,
  *
  * Adds a matrix.
  */
-void
-crank_mat_float3_add (CrankMatFloat3 *a,
-                      CrankMatFloat3 *b,
-                      CrankMatFloat3 *r)
-{
-  g_return_if_fail (a != r);
-  g_return_if_fail (b != r);
-
-  r->m00 = a->m00 + b->m00;
-  r->m01 = a->m01 + b->m01;
-  r->m02 = a->m02 + b->m02;
-  r->m10 = a->m10 + b->m10;
-  r->m11 = a->m11 + b->m11;
-  r->m12 = a->m12 + b->m12;
-  r->m20 = a->m20 + b->m20;
-  r->m21 = a->m21 + b->m21;
-  r->m22 = a->m22 + b->m22;
-}
 
 /**
  * crank_mat_float3_add_self:
@@ -2251,20 +1237,6 @@ crank_mat_float3_add (CrankMatFloat3 *a,
  *
  * Adds a matrix.
  */
-void
-crank_mat_float3_add_self (CrankMatFloat3 *a,
-                           CrankMatFloat3 *b)
-{
-  a->m00 += b->m00;
-  a->m01 += b->m01;
-  a->m02 += b->m02;
-  a->m10 += b->m10;
-  a->m11 += b->m11;
-  a->m12 += b->m12;
-  a->m20 += b->m20;
-  a->m21 += b->m21;
-  a->m22 += b->m22;
-}
 
 /**
  * crank_mat_float3_sub:
@@ -2274,24 +1246,6 @@ crank_mat_float3_add_self (CrankMatFloat3 *a,
  *
  * Subtracts a matrix.
  */
-void
-crank_mat_float3_sub (CrankMatFloat3 *a,
-                      CrankMatFloat3 *b,
-                      CrankMatFloat3 *r)
-{
-  g_return_if_fail (a != r);
-  g_return_if_fail (b != r);
-
-  r->m00 = a->m00 - b->m00;
-  r->m01 = a->m01 - b->m01;
-  r->m02 = a->m02 - b->m02;
-  r->m10 = a->m10 - b->m10;
-  r->m11 = a->m11 - b->m11;
-  r->m12 = a->m12 - b->m12;
-  r->m20 = a->m20 - b->m20;
-  r->m21 = a->m21 - b->m21;
-  r->m22 = a->m22 - b->m22;
-}
 
 /**
  * crank_mat_float3_sub_self:
@@ -2300,22 +1254,6 @@ crank_mat_float3_sub (CrankMatFloat3 *a,
  *
  * Subtracts a matrix.
  */
-void
-crank_mat_float3_sub_self (CrankMatFloat3 *a,
-                           CrankMatFloat3 *b)
-{
-  a->m00 -= b->m00;
-  a->m01 -= b->m01;
-  a->m02 -= b->m02;
-  a->m10 -= b->m10;
-  a->m11 -= b->m11;
-  a->m12 -= b->m12;
-  a->m20 -= b->m20;
-  a->m21 -= b->m21;
-  a->m22 -= b->m22;
-}
-
-
 
 /**
  * crank_mat_float3_mixs:
@@ -2329,29 +1267,6 @@ crank_mat_float3_sub_self (CrankMatFloat3 *a,
  * The result is calculated by,
  * * (a * (1 - c)) + (b * c)
  */
-void
-crank_mat_float3_mixs (CrankMatFloat3 *a,
-                       CrankMatFloat3 *b,
-                       const gfloat    c,
-                       CrankMatFloat3 *r)
-{
-  gfloat d;
-
-  g_return_if_fail (a != r);
-  g_return_if_fail (b != r);
-
-  d = 1 - c;
-
-  r->m00 = (a->m00 * d) + (b->m00 * c);
-  r->m01 = (a->m01 * d) + (b->m01 * c);
-  r->m02 = (a->m02 * d) + (b->m02 * c);
-  r->m10 = (a->m10 * d) + (b->m10 * c);
-  r->m11 = (a->m11 * d) + (b->m11 * c);
-  r->m12 = (a->m12 * d) + (b->m12 * c);
-  r->m20 = (a->m20 * d) + (b->m20 * c);
-  r->m21 = (a->m21 * d) + (b->m21 * c);
-  r->m22 = (a->m22 * d) + (b->m22 * c);
-}
 
 /**
  * crank_mat_float3_mix:
@@ -2365,57 +1280,6 @@ crank_mat_float3_mixs (CrankMatFloat3 *a,
  * The result is calculated by,
  * * r[i, j] = (a[i, j] * (1 - c[i, j]) + (b[i, j] * c[i, j])
  */
-void
-crank_mat_float3_mix (CrankMatFloat3 *a,
-                      CrankMatFloat3 *b,
-                      CrankMatFloat3 *c,
-                      CrankMatFloat3 *r)
-{
-  g_return_if_fail (a != r);
-  g_return_if_fail (b != r);
-  g_return_if_fail (c != r);
-
-  r->m00 = (a->m00 * (1 - c->m00)) + (b->m00 * c->m00);
-  r->m01 = (a->m01 * (1 - c->m01)) + (b->m01 * c->m01);
-  r->m02 = (a->m02 * (1 - c->m02)) + (b->m02 * c->m02);
-  r->m10 = (a->m10 * (1 - c->m10)) + (b->m10 * c->m10);
-  r->m11 = (a->m11 * (1 - c->m11)) + (b->m11 * c->m11);
-  r->m12 = (a->m12 * (1 - c->m12)) + (b->m12 * c->m12);
-  r->m20 = (a->m20 * (1 - c->m20)) + (b->m20 * c->m20);
-  r->m21 = (a->m21 * (1 - c->m21)) + (b->m21 * c->m21);
-  r->m22 = (a->m22 * (1 - c->m22)) + (b->m22 * c->m22);
-}
-
-//////// GValue Transformation /////////////////////////////////////////////////
-
-static void
-crank_mat_float3_transform_to_string (const GValue *src,
-                                      GValue       *dest)
-{
-  CrankMatFloat3 *mf = (CrankMatFloat3*) g_value_get_boxed (src);
-  gchar *str = crank_mat_float3_to_string (mf);
-  g_value_take_string (dest, str);
-}
-
-
-
-
-
-
-static void crank_mat_float4_transform_to_string (const GValue *src,
-                                                  GValue       *dest);
-
-G_DEFINE_BOXED_TYPE_WITH_CODE (
-  CrankMatFloat4,
-  crank_mat_float4,
-  crank_mat_float4_dup,
-  g_free,
-  {
-    g_value_register_transform_func (
-      g_define_type_id,
-      G_TYPE_STRING,
-      crank_mat_float4_transform_to_string);
-  })
 
 /**
  * crank_mat_float4_init:
@@ -2439,42 +1303,6 @@ G_DEFINE_BOXED_TYPE_WITH_CODE (
  *
  * Initialize a matrix with given elements.
  */
-void
-crank_mat_float4_init (CrankMatFloat4 *mat,
-                       const gfloat    m00,
-                       const gfloat    m01,
-                       const gfloat    m02,
-                       const gfloat    m03,
-                       const gfloat    m10,
-                       const gfloat    m11,
-                       const gfloat    m12,
-                       const gfloat    m13,
-                       const gfloat    m20,
-                       const gfloat    m21,
-                       const gfloat    m22,
-                       const gfloat    m23,
-                       const gfloat    m30,
-                       const gfloat    m31,
-                       const gfloat    m32,
-                       const gfloat    m33)
-{
-  mat->m00 = m00;
-  mat->m01 = m01;
-  mat->m02 = m02;
-  mat->m03 = m03;
-  mat->m10 = m10;
-  mat->m11 = m11;
-  mat->m12 = m12;
-  mat->m13 = m13;
-  mat->m20 = m20;
-  mat->m21 = m21;
-  mat->m22 = m22;
-  mat->m23 = m23;
-  mat->m30 = m30;
-  mat->m31 = m31;
-  mat->m32 = m32;
-  mat->m33 = m33;
-}
 
 /**
  * crank_mat_float4_init_arr:
@@ -2483,12 +1311,6 @@ crank_mat_float4_init (CrankMatFloat4 *mat,
  *
  * Initialize a matrix with given array.
  */
-void
-crank_mat_float4_init_arr (CrankMatFloat4 *mat,
-                           const gfloat   *marr)
-{
-  memcpy (mat, marr, sizeof(gfloat) * 16);
-}
 
 /**
  * crank_mat_float4_init_row:
@@ -2500,18 +1322,6 @@ crank_mat_float4_init_arr (CrankMatFloat4 *mat,
  *
  * Initialize a matrix with given row vectors.
  */
-void
-crank_mat_float4_init_row (CrankMatFloat4 *mat,
-                           CrankVecFloat4 *row0,
-                           CrankVecFloat4 *row1,
-                           CrankVecFloat4 *row2,
-                           CrankVecFloat4 *row3)
-{
-  crank_vec_float4_init_arr ((CrankVecFloat4*)mat,       (gfloat*)row0);
-  crank_vec_float4_init_arr (((CrankVecFloat4*)mat) + 1, (gfloat*)row1);
-  crank_vec_float4_init_arr (((CrankVecFloat4*)mat) + 2, (gfloat*)row2);
-  crank_vec_float4_init_arr (((CrankVecFloat4*)mat) + 3, (gfloat*)row3);
-}
 
 /**
  * crank_mat_float4_init_row_arr:
@@ -2520,13 +1330,6 @@ crank_mat_float4_init_row (CrankMatFloat4 *mat,
  *
  * Initialize a matrix with array of row vectors.
  */
-void
-crank_mat_float4_init_row_arr (CrankMatFloat4 *mat,
-                               CrankVecFloat4 *row_arr)
-{
-  crank_mat_float4_init_row (mat, row_arr, row_arr + 1, row_arr + 2, row_arr +
-                             3);
-}
 
 /**
  * crank_mat_float4_init_row_parr:
@@ -2535,16 +1338,6 @@ crank_mat_float4_init_row_arr (CrankMatFloat4 *mat,
  *
  * Initialize a matrix with array of row vectors.
  */
-void
-crank_mat_float4_init_row_parr (CrankMatFloat4  *mat,
-                                CrankVecFloat4 **row_parr)
-{
-  crank_mat_float4_init_row (mat,
-                             row_parr[0],
-                             row_parr[1],
-                             row_parr[2],
-                             row_parr[3]);
-}
 
 /**
  * crank_mat_float4_init_col:
@@ -2556,30 +1349,6 @@ crank_mat_float4_init_row_parr (CrankMatFloat4  *mat,
  *
  * Initialize a matrix with column vectors.
  */
-void
-crank_mat_float4_init_col (CrankMatFloat4 *mat,
-                           CrankVecFloat4 *col0,
-                           CrankVecFloat4 *col1,
-                           CrankVecFloat4 *col2,
-                           CrankVecFloat4 *col3)
-{
-  mat->m00 = col0->x;
-  mat->m01 = col1->x;
-  mat->m02 = col2->x;
-  mat->m03 = col3->x;
-  mat->m10 = col0->y;
-  mat->m11 = col1->y;
-  mat->m12 = col2->y;
-  mat->m13 = col3->y;
-  mat->m20 = col0->z;
-  mat->m21 = col1->z;
-  mat->m22 = col2->z;
-  mat->m23 = col3->z;
-  mat->m30 = col0->w;
-  mat->m31 = col1->w;
-  mat->m32 = col2->w;
-  mat->m33 = col3->w;
-}
 
 /**
  * crank_mat_float4_init_col_arr:
@@ -2588,14 +1357,6 @@ crank_mat_float4_init_col (CrankMatFloat4 *mat,
  *
  * Initialize a matrix with an array of column vectors.
  */
-void
-crank_mat_float4_init_col_arr (CrankMatFloat4 *mat,
-                               CrankVecFloat4 *col_arr)
-{
-  crank_mat_float4_init_col (mat, col_arr, col_arr + 1, col_arr + 2, col_arr +
-                             3);
-}
-
 
 /**
  * crank_mat_float4_init_col_parr:
@@ -2604,16 +1365,6 @@ crank_mat_float4_init_col_arr (CrankMatFloat4 *mat,
  *
  * Initialize a matrix with an array of column vectors.
  */
-void
-crank_mat_float4_init_col_parr (CrankMatFloat4  *mat,
-                                CrankVecFloat4 **col_parr)
-{
-  crank_mat_float4_init_col (mat,
-                             col_parr[0],
-                             col_parr[1],
-                             col_parr[2],
-                             col_parr[3]);
-}
 
 /**
  * crank_mat_float4_init_diag:
@@ -2626,30 +1377,6 @@ crank_mat_float4_init_col_parr (CrankMatFloat4  *mat,
  * Initialize a matrix with diagonal elements.
  * Other elements are initialized with 0.
  */
-void
-crank_mat_float4_init_diag (CrankMatFloat4 *mat,
-                            const gfloat    m00,
-                            const gfloat    m11,
-                            const gfloat    m22,
-                            const gfloat    m33)
-{
-  mat->m00 = m00;
-  mat->m01 = 0;
-  mat->m02 = 0;
-  mat->m03 = 0;
-  mat->m10 = 0;
-  mat->m11 = m11;
-  mat->m12 = 0;
-  mat->m13 = 0;
-  mat->m20 = 0;
-  mat->m21 = 0;
-  mat->m22 = m22;
-  mat->m23 = 0;
-  mat->m30 = 0;
-  mat->m31 = 0;
-  mat->m32 = 0;
-  mat->m33 = m33;
-}
 
 /**
  * crank_mat_float4_init_diag_arr:
@@ -2659,12 +1386,6 @@ crank_mat_float4_init_diag (CrankMatFloat4 *mat,
  * Initialize a matrix with an array of diagonal elements.
  * Other elements are initialized with 0.
  */
-void
-crank_mat_float4_init_diag_arr (CrankMatFloat4 *mat,
-                                const gfloat   *darr)
-{
-  crank_mat_float4_init_diag (mat, darr[0], darr[1], darr[2], darr[3]);
-}
 
 /**
  * crank_mat_float4_init_diag_vec:
@@ -2674,12 +1395,6 @@ crank_mat_float4_init_diag_arr (CrankMatFloat4 *mat,
  * Initialize a matrix with a vector of diagonal elements.
  * Other elements are initialized with 0.
  */
-void
-crank_mat_float4_init_diag_vec (CrankMatFloat4 *mat,
-                                CrankVecFloat4 *dvec)
-{
-  crank_mat_float4_init_diag (mat, dvec->x, dvec->y, dvec->z, dvec->w);
-}
 
 /**
  * crank_mat_float4_init_fill:
@@ -2688,27 +1403,6 @@ crank_mat_float4_init_diag_vec (CrankMatFloat4 *mat,
  *
  * Initialize a matrix by filling with a value.
  */
-void
-crank_mat_float4_init_fill (CrankMatFloat4 *mat,
-                            const gfloat    fill)
-{
-  mat->m00 = fill;
-  mat->m01 = fill;
-  mat->m02 = fill;
-  mat->m03 = fill;
-  mat->m10 = fill;
-  mat->m11 = fill;
-  mat->m12 = fill;
-  mat->m13 = fill;
-  mat->m20 = fill;
-  mat->m21 = fill;
-  mat->m22 = fill;
-  mat->m23 = fill;
-  mat->m30 = fill;
-  mat->m31 = fill;
-  mat->m32 = fill;
-  mat->m33 = fill;
-}
 
 /**
  * crank_mat_float4_init_rot:
@@ -2718,40 +1412,6 @@ crank_mat_float4_init_fill (CrankMatFloat4 *mat,
  *
  * Initialize a matrix by rotation.
  */
-void
-crank_mat_float4_init_rot (CrankMatFloat4 *mat,
-                           const gfloat    angle,
-                           CrankVecFloat3 *axis)
-{
-  CrankVecFloat3 uvec;
-  gfloat s, c, c1;
-
-  crank_vec_float3_unit (axis, &uvec);
-
-  s = sinf (angle);
-  c = cosf (angle);
-  c1 = 1 - c;
-
-  mat->m00 = uvec.x * uvec.x * c1 + c;
-  mat->m01 = uvec.x * uvec.y * c1 - uvec.z * s;
-  mat->m02 = uvec.x * uvec.z * c1 + uvec.y * s;
-  mat->m03 = 0;
-
-  mat->m10 = uvec.y * uvec.x * c1 + uvec.z * s;
-  mat->m11 = uvec.y * uvec.y * c1 + c;
-  mat->m12 = uvec.y * uvec.z * c1 - uvec.x * s;
-  mat->m13 = 0;
-
-  mat->m20 = uvec.z * uvec.x * c1 - uvec.y * s;
-  mat->m21 = uvec.z * uvec.y * c1 + uvec.x * s;
-  mat->m22 = uvec.z * uvec.z * c1 + c;
-  mat->m23 = 0;
-
-  mat->m30 = 0;
-  mat->m31 = 0;
-  mat->m32 = 0;
-  mat->m33 = 1.0f;
-}
 
 /**
  * crank_mat_float4_init_urot:
@@ -2763,18 +1423,6 @@ crank_mat_float4_init_rot (CrankMatFloat4 *mat,
  *
  * Initialize a matrix by rotation.
  */
-void
-crank_mat_float4_init_urot (CrankMatFloat4 *mat,
-                           const gfloat    angle,
-                           const gfloat    axis_x,
-                           const gfloat    axis_y,
-                           const gfloat    axis_z)
-{
-  CrankVecFloat3 axis = {axis_x, axis_y, axis_z};
-
-  crank_mat_float4_init_rot (mat, angle, &axis);
-}
-
 
 /**
  * crank_mat_float4_copy:
@@ -2783,12 +1431,6 @@ crank_mat_float4_init_urot (CrankMatFloat4 *mat,
  *
  * Copies a matrix to other matrix.
  */
-void
-crank_mat_float4_copy (CrankMatFloat4 *mat,
-                       CrankMatFloat4 *other)
-{
-  crank_mat_float4_init_arr (other, (gfloat*) mat);
-}
 
 /**
  * crank_mat_float4_dup:
@@ -2798,16 +1440,6 @@ crank_mat_float4_copy (CrankMatFloat4 *mat,
  *
  * Returns: an allocated copy. Free it with g_free()
  */
-CrankMatFloat4*
-crank_mat_float4_dup (CrankMatFloat4 *mat)
-{
-  CrankMatFloat4 *result = g_new (CrankMatFloat4, 1);
-  crank_mat_float4_copy (mat, result);
-  return result;
-}
-
-
-//////// Basic Operations //////////////////////////////////////////////////////
 
 /**
  * crank_mat_float4_hash:
@@ -2818,30 +1450,6 @@ crank_mat_float4_dup (CrankMatFloat4 *mat)
  *
  * Returns: hash value of a matrix.
  */
-guint
-crank_mat_float4_hash (gconstpointer a)
-{
-  const CrankMatFloat4 *mat = (const CrankMatFloat4*)a;
-
-  guint hash;
-  hash = crank_float_hash (&(mat->m00));
-  hash = crank_float_hash (&(mat->m01)) + hash * 37;
-  hash = crank_float_hash (&(mat->m02)) + hash * 37;
-  hash = crank_float_hash (&(mat->m03)) + hash * 37;
-  hash = crank_float_hash (&(mat->m10)) + hash * 37;
-  hash = crank_float_hash (&(mat->m11)) + hash * 37;
-  hash = crank_float_hash (&(mat->m12)) + hash * 37;
-  hash = crank_float_hash (&(mat->m13)) + hash * 37;
-  hash = crank_float_hash (&(mat->m20)) + hash * 37;
-  hash = crank_float_hash (&(mat->m21)) + hash * 37;
-  hash = crank_float_hash (&(mat->m22)) + hash * 37;
-  hash = crank_float_hash (&(mat->m23)) + hash * 37;
-  hash = crank_float_hash (&(mat->m30)) + hash * 37;
-  hash = crank_float_hash (&(mat->m31)) + hash * 37;
-  hash = crank_float_hash (&(mat->m32)) + hash * 37;
-  hash = crank_float_hash (&(mat->m33)) + hash * 37;
-  return hash;
-}
 
 /**
  * crank_mat_float4_equal:
@@ -2853,30 +1461,6 @@ crank_mat_float4_hash (gconstpointer a)
  *
  * Returns: %TRUE if the two are same.
  */
-gboolean
-crank_mat_float4_equal (gconstpointer a,
-                        gconstpointer b)
-{
-  const CrankMatFloat4 *mat_a = (const CrankMatFloat4*)a;
-  const CrankMatFloat4 *mat_b = (const CrankMatFloat4*)b;
-
-  return (mat_a->m00 == mat_b->m00) &&
-         (mat_a->m01 == mat_b->m01) &&
-         (mat_a->m02 == mat_b->m02) &&
-         (mat_a->m03 == mat_b->m03) &&
-         (mat_a->m10 == mat_b->m10) &&
-         (mat_a->m11 == mat_b->m11) &&
-         (mat_a->m12 == mat_b->m12) &&
-         (mat_a->m13 == mat_b->m13) &&
-         (mat_a->m20 == mat_b->m20) &&
-         (mat_a->m21 == mat_b->m21) &&
-         (mat_a->m22 == mat_b->m22) &&
-         (mat_a->m23 == mat_b->m23) &&
-         (mat_a->m30 == mat_b->m30) &&
-         (mat_a->m31 == mat_b->m31) &&
-         (mat_a->m32 == mat_b->m32) &&
-         (mat_a->m33 == mat_b->m33);
-}
 
 /**
  * crank_mat_float4_to_string:
@@ -2891,11 +1475,6 @@ crank_mat_float4_equal (gconstpointer a,
  *
  * Returns: string representation of matrix.
  */
-gchar*
-crank_mat_float4_to_string (CrankMatFloat4 *mat)
-{
-  return crank_mat_float4_to_string_full (mat, "[", ", ", "]", "[", ", ", "]", "%g");
-}
 
 /**
  * crank_mat_float4_to_string_full:
@@ -2912,50 +1491,6 @@ crank_mat_float4_to_string (CrankMatFloat4 *mat)
  *
  * Returns: string representation of matrix.
  */
-gchar*
-crank_mat_float4_to_string_full (CrankMatFloat4 *mat,
-                                 const gchar    *mat_left,
-                                 const gchar    *mat_in,
-                                 const gchar    *mat_right,
-                                 const gchar    *row_left,
-                                 const gchar    *row_in,
-                                 const gchar    *row_right,
-                                 const gchar    *format)
-{
-  GString *builder;
-  gchar *str;
-
-  builder = g_string_new (mat_left);
-  g_string_append (builder,
-                   crank_vec_float4_to_string_full (((CrankVecFloat4*)mat) + 0,
-                                                    row_left, row_in, row_right,
-                                                    format)   );
-
-  g_string_append (builder, mat_in);
-  g_string_append (builder,
-                   crank_vec_float4_to_string_full (((CrankVecFloat4*)mat) + 1,
-                                                    row_left, row_in, row_right,
-                                                    format)   );
-
-  g_string_append (builder, mat_in);
-  g_string_append (builder,
-                   crank_vec_float4_to_string_full (((CrankVecFloat4*)mat) + 2,
-                                                    row_left, row_in, row_right,
-                                                    format)   );
-
-  g_string_append (builder, mat_in);
-  g_string_append (builder,
-                   crank_vec_float4_to_string_full (((CrankVecFloat4*)mat) + 3,
-                                                    row_left, row_in, row_right,
-                                                    format)   );
-
-  g_string_append (builder, mat_right);
-
-  str = builder->str;
-
-  g_string_free (builder, FALSE);
-  return str;
-}
 
 /**
  * crank_mat_float4_get:
@@ -2967,13 +1502,6 @@ crank_mat_float4_to_string_full (CrankMatFloat4 *mat,
  *
  * Returns: Element at given indices.
  */
-gfloat
-crank_mat_float4_get (CrankMatFloat4 *mat,
-                      const guint     i,
-                      const guint     j)
-{
-  return ((gfloat*)mat) [(4 * i)  +  j];
-}
 
 /**
  * crank_mat_float4_set:
@@ -2984,14 +1512,6 @@ crank_mat_float4_get (CrankMatFloat4 *mat,
  *
  * Sets element at given indices.
  */
-void
-crank_mat_float4_set (CrankMatFloat4 *mat,
-                      const guint     i,
-                      const guint     j,
-                      const gfloat    value)
-{
-  ((gfloat*)mat) [(4 * i)  +  j] = value;
-}
 
 /**
  * crank_mat_float4_get_row:
@@ -3001,13 +1521,6 @@ crank_mat_float4_set (CrankMatFloat4 *mat,
  *
  * Gets a row vector at given index.
  */
-void
-crank_mat_float4_get_row (CrankMatFloat4 *mat,
-                          const guint     index,
-                          CrankVecFloat4 *row)
-{
-  crank_vec_float4_init_arr (row, ((gfloat*)mat) + 4 * index);
-}
 
 /**
  * crank_mat_float4_set_row:
@@ -3017,14 +1530,6 @@ crank_mat_float4_get_row (CrankMatFloat4 *mat,
  *
  * Sets a row vector at given index.
  */
-void
-crank_mat_float4_set_row (CrankMatFloat4 *mat,
-                          const guint     index,
-                          CrankVecFloat4 *row)
-{
-  crank_vec_float4_init_arr (((CrankVecFloat4*)mat) + index, (gfloat*)row);
-}
-
 
 /**
  * crank_mat_float4_get_col:
@@ -3034,17 +1539,6 @@ crank_mat_float4_set_row (CrankMatFloat4 *mat,
  *
  * Gets a column vector at given index.
  */
-void
-crank_mat_float4_get_col (CrankMatFloat4 *mat,
-                          const guint     index,
-                          CrankVecFloat4 *col)
-{
-  gfloat *ptr = ((gfloat*)mat) + index;
-  col->x = ptr[0];
-  col->y = ptr[4];
-  col->z = ptr[8];
-  col->w = ptr[12];
-}
 
 /**
  * crank_mat_float4_set_col:
@@ -3054,17 +1548,6 @@ crank_mat_float4_get_col (CrankMatFloat4 *mat,
  *
  * Sets a column vector at given index.
  */
-void
-crank_mat_float4_set_col (CrankMatFloat4 *mat,
-                          const guint     index,
-                          CrankVecFloat4 *col)
-{
-  gfloat *ptr = ((gfloat*)mat) + index;
-  ptr[0] = col->x;
-  ptr[4] = col->y;
-  ptr[8] = col->z;
-  ptr[12] = col->w;
-}
 
 /**
  * crank_mat_float4_get_tr:
@@ -3076,11 +1559,6 @@ crank_mat_float4_set_col (CrankMatFloat4 *mat,
  *
  * Returns: A trace of matrix.
  */
-gfloat
-crank_mat_float4_get_tr (CrankMatFloat4 *mat)
-{
-  return mat->m00 + mat->m11 + mat->m22 + mat->m33;
-}
 
 /**
  * crank_mat_float4_get_det:
@@ -3090,27 +1568,6 @@ crank_mat_float4_get_tr (CrankMatFloat4 *mat)
  *
  * Returns: A determinent of matrix.
  */
-gfloat
-crank_mat_float4_get_det (CrankMatFloat4 *mat)
-{
-  return (DET4(mat->m00, mat->m01, mat->m10, mat->m11) *
-          DET4(mat->m22, mat->m23, mat->m32, mat->m33)) -
-
-         (DET4(mat->m00, mat->m02, mat->m10, mat->m12) *
-          DET4(mat->m21, mat->m23, mat->m31, mat->m33)) +
-
-         (DET4(mat->m00, mat->m03, mat->m10, mat->m13) *
-          DET4(mat->m21, mat->m22, mat->m31, mat->m32)) +
-
-         (DET4(mat->m01, mat->m02, mat->m11, mat->m12) *
-          DET4(mat->m20, mat->m23, mat->m30, mat->m33)) -
-
-         (DET4(mat->m01, mat->m03, mat->m11, mat->m13) *
-          DET4(mat->m20, mat->m22, mat->m30, mat->m32)) +
-
-         (DET4(mat->m02, mat->m03, mat->m12, mat->m13) *
-          DET4(mat->m20, mat->m21, mat->m30, mat->m31));
-}
 
 /**
  * crank_mat_float4_get_cof:
@@ -3119,44 +1576,6 @@ crank_mat_float4_get_det (CrankMatFloat4 *mat)
  *
  * Gets a cofactor matrix.
  */
-void
-crank_mat_float4_get_cof (CrankMatFloat4 *mat,
-                          CrankMatFloat4 *r)
-{
-  gfloat m01_01 = DET4(mat->m00, mat->m01, mat->m10, mat->m11);
-  gfloat m01_02 = DET4(mat->m00, mat->m02, mat->m10, mat->m12);
-  gfloat m01_03 = DET4(mat->m00, mat->m03, mat->m10, mat->m13);
-  gfloat m01_12 = DET4(mat->m01, mat->m02, mat->m11, mat->m12);
-  gfloat m01_13 = DET4(mat->m01, mat->m03, mat->m11, mat->m13);
-  gfloat m01_23 = DET4(mat->m02, mat->m03, mat->m12, mat->m13);
-
-  gfloat m23_01 = DET4(mat->m20, mat->m21, mat->m30, mat->m31);
-  gfloat m23_02 = DET4(mat->m20, mat->m22, mat->m30, mat->m32);
-  gfloat m23_03 = DET4(mat->m20, mat->m23, mat->m30, mat->m33);
-  gfloat m23_12 = DET4(mat->m21, mat->m22, mat->m31, mat->m32);
-  gfloat m23_13 = DET4(mat->m21, mat->m23, mat->m31, mat->m33);
-  gfloat m23_23 = DET4(mat->m22, mat->m23, mat->m32, mat->m33);
-
-  r->m00 =  mat->m11 * m23_23 - mat->m12 * m23_13 + mat->m13 * m23_12;
-  r->m01 = -mat->m10 * m23_23 + mat->m12 * m23_03 - mat->m13 * m23_02;
-  r->m02 =  mat->m10 * m23_13 - mat->m11 * m23_03 + mat->m13 * m23_01;
-  r->m03 = -mat->m10 * m23_12 + mat->m11 * m23_02 - mat->m12 * m23_01;
-
-  r->m10 = -mat->m01 * m23_23 + mat->m02 * m23_13 - mat->m03 * m23_12;
-  r->m11 =  mat->m00 * m23_23 - mat->m02 * m23_03 + mat->m03 * m23_02;
-  r->m12 = -mat->m00 * m23_13 + mat->m01 * m23_03 - mat->m03 * m23_01;
-  r->m13 =  mat->m00 * m23_12 - mat->m01 * m23_02 + mat->m02 * m23_01;
-
-  r->m20 =  m01_12 * mat->m33 - m01_13 * mat->m32 + m01_23 * mat->m31;
-  r->m21 = -m01_02 * mat->m33 + m01_03 * mat->m32 - m01_23 * mat->m30;
-  r->m22 =  m01_01 * mat->m33 - m01_03 * mat->m31 + m01_13 * mat->m30;
-  r->m23 = -m01_01 * mat->m32 + m01_02 * mat->m31 - m01_12 * mat->m30;
-
-  r->m30 = -m01_12 * mat->m23 + m01_13 * mat->m22 - m01_23 * mat->m21;
-  r->m31 =  m01_02 * mat->m23 - m01_03 * mat->m22 + m01_23 * mat->m20;
-  r->m32 = -m01_01 * mat->m23 + m01_03 * mat->m21 - m01_13 * mat->m20;
-  r->m33 =  m01_01 * mat->m22 - m01_02 * mat->m21 + m01_12 * mat->m20;
-}
 
 /**
  * crank_mat_float4_get_adj:
@@ -3165,13 +1584,6 @@ crank_mat_float4_get_cof (CrankMatFloat4 *mat,
  *
  * Gets a adjugate matrix.
  */
-void
-crank_mat_float4_get_adj (CrankMatFloat4 *mat,
-                          CrankMatFloat4 *r)
-{
-  crank_mat_float4_get_cof (mat, r);
-  crank_mat_float4_transpose_self (r);
-}
 
 /**
  * crank_mat_float4_get_rangle:
@@ -3181,19 +1593,6 @@ crank_mat_float4_get_adj (CrankMatFloat4 *mat,
  *
  * Returns: rotation angle, in radian.
  */
-gfloat
-crank_mat_float4_get_rangle (CrankMatFloat4 *mat)
-{
-  CrankVecFloat3 a;
-  gfloat t;
-
-  a.x = mat->m21 - mat->m12;
-  a.y = mat->m02 - mat->m20;
-  a.z = mat->m10 - mat->m01;
-  t = mat->m00 + mat->m11 + mat->m22 - 1;
-
-  return atan2f (crank_vec_float3_get_magn (&a), t);
-}
 
 /**
  * crank_mat_float4_get_raxis:
@@ -3202,18 +1601,6 @@ crank_mat_float4_get_rangle (CrankMatFloat4 *mat)
  *
  * Gets rotation axis of rotation that @mat represents.
  */
-void
-crank_mat_float4_get_raxis (CrankMatFloat4 *mat,
-                            CrankVecFloat3 *axis)
-{
-  CrankVecFloat3 a;
-
-  a.x = mat->m21 - mat->m12;
-  a.y = mat->m02 - mat->m20;
-  a.z = mat->m10 - mat->m01;
-
-  crank_vec_float3_unit (&a, axis);
-}
 
 /**
  * crank_mat_float4_neg:
@@ -3222,27 +1609,6 @@ crank_mat_float4_get_raxis (CrankMatFloat4 *mat,
  *
  * Negates a matrix.
  */
-void
-crank_mat_float4_neg (CrankMatFloat4 *a,
-                      CrankMatFloat4 *r)
-{
-  r->m00 = -a->m00;
-  r->m01 = -a->m01;
-  r->m02 = -a->m02;
-  r->m03 = -a->m03;
-  r->m10 = -a->m10;
-  r->m11 = -a->m11;
-  r->m12 = -a->m12;
-  r->m13 = -a->m13;
-  r->m20 = -a->m20;
-  r->m21 = -a->m21;
-  r->m22 = -a->m22;
-  r->m23 = -a->m23;
-  r->m30 = -a->m30;
-  r->m31 = -a->m31;
-  r->m32 = -a->m32;
-  r->m33 = -a->m33;
-}
 
 /**
  * crank_mat_float4_neg_self:
@@ -3250,26 +1616,6 @@ crank_mat_float4_neg (CrankMatFloat4 *a,
  *
  * Negates a matrix.
  */
-void
-crank_mat_float4_neg_self (CrankMatFloat4 *a)
-{
-  a->m00 = -a->m00;
-  a->m01 = -a->m01;
-  a->m02 = -a->m02;
-  a->m03 = -a->m03;
-  a->m10 = -a->m10;
-  a->m11 = -a->m11;
-  a->m12 = -a->m12;
-  a->m13 = -a->m13;
-  a->m20 = -a->m20;
-  a->m21 = -a->m21;
-  a->m22 = -a->m22;
-  a->m23 = -a->m23;
-  a->m30 = -a->m30;
-  a->m31 = -a->m31;
-  a->m32 = -a->m32;
-  a->m33 = -a->m33;
-}
 
 /**
  * crank_mat_float4_transpose:
@@ -3278,58 +1624,6 @@ crank_mat_float4_neg_self (CrankMatFloat4 *a)
  *
  * Gets a transpose of matrix.
  */
-void
-crank_mat_float4_transpose (CrankMatFloat4 *a,
-                            CrankMatFloat4 *r)
-{
-  if (a != r)
-    {
-      r->m00 = a->m00;
-      r->m01 = a->m10;
-      r->m02 = a->m20;
-      r->m03 = a->m30;
-      r->m10 = a->m01;
-      r->m11 = a->m11;
-      r->m12 = a->m21;
-      r->m13 = a->m31;
-      r->m20 = a->m02;
-      r->m21 = a->m12;
-      r->m22 = a->m22;
-      r->m23 = a->m32;
-      r->m30 = a->m03;
-      r->m31 = a->m13;
-      r->m32 = a->m23;
-      r->m33 = a->m33;
-    }
-  else
-    {
-      gfloat temp;
-
-      temp = a->m01;
-      a->m01 = a->m10;
-      a->m10 = temp;
-
-      temp = a->m02;
-      a->m02 = a->m20;
-      a->m20 = temp;
-
-      temp = a->m03;
-      a->m03 = a->m30;
-      a->m30 = temp;
-
-      temp = a->m12;
-      a->m12 = a->m21;
-      a->m21 = temp;
-
-      temp = a->m13;
-      a->m13 = a->m31;
-      a->m31 = temp;
-
-      temp = a->m23;
-      a->m23 = a->m32;
-      a->m32 = temp;
-    }
-}
 
 /**
  * crank_mat_float4_transpose_self:
@@ -3337,35 +1631,6 @@ crank_mat_float4_transpose (CrankMatFloat4 *a,
  *
  * Gets a transpose of matrix.
  */
-void
-crank_mat_float4_transpose_self (CrankMatFloat4 *a)
-{
-  gfloat temp;
-
-  temp = a->m01;
-  a->m01 = a->m10;
-  a->m10 = temp;
-
-  temp = a->m02;
-  a->m02 = a->m20;
-  a->m20 = temp;
-
-  temp = a->m03;
-  a->m03 = a->m30;
-  a->m30 = temp;
-
-  temp = a->m12;
-  a->m12 = a->m21;
-  a->m21 = temp;
-
-  temp = a->m13;
-  a->m13 = a->m31;
-  a->m31 = temp;
-
-  temp = a->m23;
-  a->m23 = a->m32;
-  a->m32 = temp;
-}
 
 /**
  * crank_mat_float4_inverse:
@@ -3375,16 +1640,6 @@ crank_mat_float4_transpose_self (CrankMatFloat4 *a)
  * Gets an inverse of matrix.
  * If the matrix is singular, then NaN matrix may be returned.
  */
-void
-crank_mat_float4_inverse (CrankMatFloat4 *a,
-                          CrankMatFloat4 *r)
-{
-  CrankMatFloat4 adj;
-  gfloat det = crank_mat_float4_get_det (a);
-
-  crank_mat_float4_get_adj (a, &adj);
-  crank_mat_float4_divs (&adj, det, r);
-}
 
 /**
  * crank_mat_float4_inverse_self:
@@ -3393,15 +1648,6 @@ crank_mat_float4_inverse (CrankMatFloat4 *a,
  * Gets an inverse of matrix.
  * If the matrix is singular, then NaN matrix may be returned.
  */
-void
-crank_mat_float4_inverse_self (CrankMatFloat4 *a)
-{
-  CrankMatFloat4 adj;
-  gfloat det = crank_mat_float4_get_det (a);
-
-  crank_mat_float4_get_adj (a, &adj);
-  crank_mat_float4_divs (&adj, det, a);
-}
 
 /**
  * crank_mat_float4_try_inverse:
@@ -3413,23 +1659,6 @@ crank_mat_float4_inverse_self (CrankMatFloat4 *a)
  *
  * Returns: Whether the matrix is non-singular and inverse is done.
  */
-gboolean
-crank_mat_float4_try_inverse (CrankMatFloat4 *a,
-                              CrankMatFloat4 *r)
-{
-  CrankMatFloat4 adj;
-  gfloat det = crank_mat_float4_get_det (a);
-
-  if (det != 0)
-    {
-      crank_mat_float4_get_adj (a, &adj);
-      crank_mat_float4_divs (&adj, det, r);
-
-      return TRUE;
-    }
-  else
-    return FALSE;
-}
 
 /**
  * crank_mat_float4_try_inverse_self:
@@ -3440,23 +1669,6 @@ crank_mat_float4_try_inverse (CrankMatFloat4 *a,
  *
  * Returns: Whether the matrix is non-singular and inverse is done.
  */
-gboolean
-crank_mat_float4_try_inverse_self (CrankMatFloat4 *a)
-{
-  CrankMatFloat4 adj;
-  gfloat det = crank_mat_float4_get_det (a);
-
-  if (det != 0)
-    {
-      crank_mat_float4_get_adj (a, &adj);
-      crank_mat_float4_divs (&adj, det, a);
-
-      return TRUE;
-    }
-  else
-    return FALSE;
-}
-
 
 /**
  * crank_mat_float4_muls:
@@ -3466,28 +1678,6 @@ crank_mat_float4_try_inverse_self (CrankMatFloat4 *a)
  *
  * Multiplies a matrix by scalar.
  */
-void
-crank_mat_float4_muls (CrankMatFloat4 *a,
-                       const gfloat    b,
-                       CrankMatFloat4 *r)
-{
-  r->m00 = a->m00 * b;
-  r->m01 = a->m01 * b;
-  r->m02 = a->m02 * b;
-  r->m03 = a->m03 * b;
-  r->m10 = a->m10 * b;
-  r->m11 = a->m11 * b;
-  r->m12 = a->m12 * b;
-  r->m13 = a->m13 * b;
-  r->m20 = a->m20 * b;
-  r->m21 = a->m21 * b;
-  r->m22 = a->m22 * b;
-  r->m23 = a->m23 * b;
-  r->m30 = a->m30 * b;
-  r->m31 = a->m31 * b;
-  r->m32 = a->m32 * b;
-  r->m33 = a->m33 * b;
-}
 
 /**
  * crank_mat_float4_muls_self:
@@ -3496,27 +1686,6 @@ crank_mat_float4_muls (CrankMatFloat4 *a,
  *
  * Multiplies a matrix by scalar.
  */
-void
-crank_mat_float4_muls_self (CrankMatFloat4 *a,
-                            const gfloat    b)
-{
-  a->m00 *= b;
-  a->m01 *= b;
-  a->m02 *= b;
-  a->m03 *= b;
-  a->m10 *= b;
-  a->m11 *= b;
-  a->m12 *= b;
-  a->m13 *= b;
-  a->m20 *= b;
-  a->m21 *= b;
-  a->m22 *= b;
-  a->m23 *= b;
-  a->m30 *= b;
-  a->m31 *= b;
-  a->m32 *= b;
-  a->m33 *= b;
-}
 
 /**
  * crank_mat_float4_mulv:
@@ -3526,16 +1695,6 @@ crank_mat_float4_muls_self (CrankMatFloat4 *a,
  *
  * Multiplies a matrix by vector.
  */
-void
-crank_mat_float4_mulv (CrankMatFloat4 *a,
-                       CrankVecFloat4 *b,
-                       CrankVecFloat4 *r)
-{
-  r->x = (a->m00 * b->x) + (a->m01 * b->y) + (a->m02 * b->z) + (a->m03 * b->w);
-  r->y = (a->m10 * b->x) + (a->m11 * b->y) + (a->m12 * b->z) + (a->m13 * b->w);
-  r->z = (a->m20 * b->x) + (a->m21 * b->y) + (a->m22 * b->z) + (a->m23 * b->w);
-  r->w = (a->m30 * b->x) + (a->m31 * b->y) + (a->m32 * b->z) + (a->m33 * b->w);
-}
 
 /**
  * crank_mat_float4_mul:
@@ -3545,51 +1704,6 @@ crank_mat_float4_mulv (CrankMatFloat4 *a,
  *
  * Multiplies two matrices.
  */
-void
-crank_mat_float4_mul (CrankMatFloat4 *a,
-                      CrankMatFloat4 *b,
-                      CrankMatFloat4 *r)
-{
-  CrankMatFloat4 nr;
-
-  nr.m00 =
-    (a->m00 * b->m00) + (a->m01 * b->m10) + (a->m02 * b->m20) + (a->m03 * b->m30);
-  nr.m01 =
-    (a->m00 * b->m01) + (a->m01 * b->m11) + (a->m02 * b->m21) + (a->m03 * b->m31);
-  nr.m02 =
-    (a->m00 * b->m02) + (a->m01 * b->m12) + (a->m02 * b->m22) + (a->m03 * b->m32);
-  nr.m03 =
-    (a->m00 * b->m03) + (a->m01 * b->m13) + (a->m02 * b->m23) + (a->m03 * b->m33);
-
-  nr.m10 =
-    (a->m10 * b->m00) + (a->m11 * b->m10) + (a->m12 * b->m20) + (a->m13 * b->m30);
-  nr.m11 =
-    (a->m10 * b->m01) + (a->m11 * b->m11) + (a->m12 * b->m21) + (a->m13 * b->m31);
-  nr.m12 =
-    (a->m10 * b->m02) + (a->m11 * b->m12) + (a->m12 * b->m22) + (a->m13 * b->m32);
-  nr.m13 =
-    (a->m10 * b->m03) + (a->m11 * b->m13) + (a->m12 * b->m23) + (a->m13 * b->m33);
-
-  nr.m20 =
-    (a->m20 * b->m00) + (a->m21 * b->m10) + (a->m22 * b->m20) + (a->m23 * b->m30);
-  nr.m21 =
-    (a->m20 * b->m01) + (a->m21 * b->m11) + (a->m22 * b->m21) + (a->m23 * b->m31);
-  nr.m22 =
-    (a->m20 * b->m02) + (a->m21 * b->m12) + (a->m22 * b->m22) + (a->m23 * b->m32);
-  nr.m23 =
-    (a->m20 * b->m03) + (a->m21 * b->m13) + (a->m22 * b->m23) + (a->m23 * b->m33);
-
-  nr.m30 =
-    (a->m30 * b->m00) + (a->m31 * b->m10) + (a->m32 * b->m20) + (a->m33 * b->m30);
-  nr.m31 =
-    (a->m30 * b->m01) + (a->m31 * b->m11) + (a->m32 * b->m21) + (a->m33 * b->m31);
-  nr.m32 =
-    (a->m30 * b->m02) + (a->m31 * b->m12) + (a->m32 * b->m22) + (a->m33 * b->m32);
-  nr.m33 =
-    (a->m30 * b->m03) + (a->m31 * b->m13) + (a->m32 * b->m23) + (a->m33 * b->m33);
-
-  crank_mat_float4_copy (&nr, r);
-}
 
 /**
  * crank_mat_float4_mul_self:
@@ -3598,66 +1712,6 @@ crank_mat_float4_mul (CrankMatFloat4 *a,
  *
  * Multiplies two matrices.
  */
-void
-crank_mat_float4_mul_self (CrankMatFloat4 *a,
-                           CrankMatFloat4 *b)
-{
-  CrankMatFloat4 nr;
-
-  nr.m00 =
-    (a->m00 *
-     b->m00) + (a->m01 * b->m10) + (a->m02 * b->m20) + (a->m03 * b->m30);
-  nr.m01 =
-    (a->m00 *
-     b->m01) + (a->m01 * b->m11) + (a->m02 * b->m21) + (a->m03 * b->m31);
-  nr.m02 =
-    (a->m00 *
-     b->m02) + (a->m01 * b->m12) + (a->m02 * b->m22) + (a->m03 * b->m32);
-  nr.m02 =
-    (a->m00 *
-     b->m03) + (a->m01 * b->m13) + (a->m02 * b->m23) + (a->m03 * b->m33);
-
-  nr.m10 =
-    (a->m10 *
-     b->m00) + (a->m11 * b->m10) + (a->m12 * b->m20) + (a->m13 * b->m30);
-  nr.m11 =
-    (a->m10 *
-     b->m01) + (a->m11 * b->m11) + (a->m12 * b->m21) + (a->m13 * b->m31);
-  nr.m12 =
-    (a->m10 *
-     b->m02) + (a->m11 * b->m12) + (a->m12 * b->m22) + (a->m13 * b->m32);
-  nr.m12 =
-    (a->m10 *
-     b->m03) + (a->m11 * b->m13) + (a->m12 * b->m23) + (a->m13 * b->m33);
-
-  nr.m20 =
-    (a->m20 *
-     b->m00) + (a->m21 * b->m10) + (a->m22 * b->m20) + (a->m23 * b->m30);
-  nr.m21 =
-    (a->m20 *
-     b->m01) + (a->m21 * b->m11) + (a->m22 * b->m21) + (a->m23 * b->m31);
-  nr.m22 =
-    (a->m20 *
-     b->m02) + (a->m21 * b->m12) + (a->m22 * b->m22) + (a->m23 * b->m32);
-  nr.m22 =
-    (a->m20 *
-     b->m03) + (a->m21 * b->m13) + (a->m22 * b->m23) + (a->m23 * b->m33);
-
-  nr.m30 =
-    (a->m30 *
-     b->m00) + (a->m31 * b->m10) + (a->m32 * b->m20) + (a->m33 * b->m30);
-  nr.m31 =
-    (a->m30 *
-     b->m01) + (a->m31 * b->m11) + (a->m32 * b->m21) + (a->m33 * b->m31);
-  nr.m32 =
-    (a->m30 *
-     b->m02) + (a->m31 * b->m12) + (a->m32 * b->m22) + (a->m33 * b->m32);
-  nr.m32 =
-    (a->m30 *
-     b->m03) + (a->m31 * b->m13) + (a->m32 * b->m23) + (a->m33 * b->m33);
-
-  crank_mat_float4_copy (&nr, a);
-}
 
 /**
  * crank_mat_float4_divs:
@@ -3667,13 +1721,6 @@ crank_mat_float4_mul_self (CrankMatFloat4 *a,
  *
  * Divides a matrix by scalar.
  */
-void
-crank_mat_float4_divs (CrankMatFloat4 *a,
-                       const gfloat    b,
-                       CrankMatFloat4 *r)
-{
-  crank_mat_float4_muls (a, 1 / b, r);
-}
 
 /**
  * crank_mat_float4_divs_self:
@@ -3682,12 +1729,6 @@ crank_mat_float4_divs (CrankMatFloat4 *a,
  *
  * Divides a matrix by scalar.
  */
-void
-crank_mat_float4_divs_self (CrankMatFloat4 *a,
-                            const gfloat    b)
-{
-  crank_mat_float4_muls_self (a, 1 / b);
-}
 
 /**
  * crank_mat_float4_add:
@@ -3697,28 +1738,6 @@ crank_mat_float4_divs_self (CrankMatFloat4 *a,
  *
  * Adds a matrix.
  */
-void
-crank_mat_float4_add (CrankMatFloat4 *a,
-                      CrankMatFloat4 *b,
-                      CrankMatFloat4 *r)
-{
-  r->m00 = a->m00 + b->m00;
-  r->m01 = a->m01 + b->m01;
-  r->m02 = a->m02 + b->m02;
-  r->m03 = a->m03 + b->m03;
-  r->m10 = a->m10 + b->m10;
-  r->m11 = a->m11 + b->m11;
-  r->m12 = a->m12 + b->m12;
-  r->m13 = a->m13 + b->m13;
-  r->m20 = a->m20 + b->m20;
-  r->m21 = a->m21 + b->m21;
-  r->m22 = a->m22 + b->m22;
-  r->m23 = a->m23 + b->m23;
-  r->m30 = a->m30 + b->m30;
-  r->m31 = a->m31 + b->m31;
-  r->m32 = a->m32 + b->m32;
-  r->m33 = a->m33 + b->m33;
-}
 
 /**
  * crank_mat_float4_add_self:
@@ -3727,27 +1746,6 @@ crank_mat_float4_add (CrankMatFloat4 *a,
  *
  * Adds a matrix.
  */
-void
-crank_mat_float4_add_self (CrankMatFloat4 *a,
-                           CrankMatFloat4 *b)
-{
-  a->m00 += b->m00;
-  a->m01 += b->m01;
-  a->m02 += b->m02;
-  a->m03 += b->m03;
-  a->m10 += b->m10;
-  a->m11 += b->m11;
-  a->m12 += b->m12;
-  a->m13 += b->m13;
-  a->m20 += b->m20;
-  a->m21 += b->m21;
-  a->m22 += b->m22;
-  a->m23 += b->m23;
-  a->m30 += b->m30;
-  a->m31 += b->m31;
-  a->m32 += b->m32;
-  a->m33 += b->m33;
-}
 
 /**
  * crank_mat_float4_sub:
@@ -3757,28 +1755,6 @@ crank_mat_float4_add_self (CrankMatFloat4 *a,
  *
  * Subtracts a matrix.
  */
-void
-crank_mat_float4_sub (CrankMatFloat4 *a,
-                      CrankMatFloat4 *b,
-                      CrankMatFloat4 *r)
-{
-  r->m00 = a->m00 - b->m00;
-  r->m01 = a->m01 - b->m01;
-  r->m02 = a->m02 - b->m02;
-  r->m03 = a->m03 - b->m03;
-  r->m10 = a->m10 - b->m10;
-  r->m11 = a->m11 - b->m11;
-  r->m12 = a->m12 - b->m12;
-  r->m13 = a->m13 - b->m13;
-  r->m20 = a->m20 - b->m20;
-  r->m21 = a->m21 - b->m21;
-  r->m22 = a->m22 - b->m22;
-  r->m23 = a->m23 - b->m23;
-  r->m30 = a->m30 - b->m30;
-  r->m31 = a->m31 - b->m31;
-  r->m32 = a->m32 - b->m32;
-  r->m33 = a->m33 - b->m33;
-}
 
 /**
  * crank_mat_float4_sub_self:
@@ -3787,29 +1763,6 @@ crank_mat_float4_sub (CrankMatFloat4 *a,
  *
  * Subtracts a matrix.
  */
-void
-crank_mat_float4_sub_self (CrankMatFloat4 *a,
-                           CrankMatFloat4 *b)
-{
-  a->m00 -= b->m00;
-  a->m01 -= b->m01;
-  a->m02 -= b->m02;
-  a->m03 -= b->m03;
-  a->m10 -= b->m10;
-  a->m11 -= b->m11;
-  a->m12 -= b->m12;
-  a->m13 -= b->m13;
-  a->m20 -= b->m20;
-  a->m21 -= b->m21;
-  a->m22 -= b->m22;
-  a->m23 -= b->m23;
-  a->m30 -= b->m30;
-  a->m31 -= b->m31;
-  a->m32 -= b->m32;
-  a->m33 -= b->m33;
-}
-
-
 
 /**
  * crank_mat_float4_mixs:
@@ -3823,31 +1776,6 @@ crank_mat_float4_sub_self (CrankMatFloat4 *a,
  * The result is calculated by,
  * * (a * (1 - c)) + (b * c)
  */
-void
-crank_mat_float4_mixs (CrankMatFloat4 *a,
-                       CrankMatFloat4 *b,
-                       const gfloat    c,
-                       CrankMatFloat4 *r)
-{
-  gfloat d = 1 - c;
-
-  r->m00 = (a->m00 * d) + (b->m00 * c);
-  r->m01 = (a->m01 * d) + (b->m01 * c);
-  r->m02 = (a->m02 * d) + (b->m02 * c);
-  r->m03 = (a->m03 * d) + (b->m03 * c);
-  r->m10 = (a->m10 * d) + (b->m10 * c);
-  r->m11 = (a->m11 * d) + (b->m11 * c);
-  r->m12 = (a->m12 * d) + (b->m12 * c);
-  r->m13 = (a->m13 * d) + (b->m13 * c);
-  r->m20 = (a->m20 * d) + (b->m20 * c);
-  r->m21 = (a->m21 * d) + (b->m21 * c);
-  r->m22 = (a->m22 * d) + (b->m22 * c);
-  r->m23 = (a->m23 * d) + (b->m23 * c);
-  r->m30 = (a->m30 * d) + (b->m30 * c);
-  r->m31 = (a->m31 * d) + (b->m31 * c);
-  r->m32 = (a->m32 * d) + (b->m32 * c);
-  r->m33 = (a->m33 * d) + (b->m33 * c);
-}
 
 /**
  * crank_mat_float4_mix:
@@ -3861,62 +1789,58 @@ crank_mat_float4_mixs (CrankMatFloat4 *a,
  * The result is calculated by,
  * * r[i, j] = (a[i, j] * (1 - c[i, j]) + (b[i, j] * c[i, j])
  */
-void
-crank_mat_float4_mix (CrankMatFloat4 *a,
-                      CrankMatFloat4 *b,
-                      CrankMatFloat4 *c,
-                      CrankMatFloat4 *r)
-{
-  r->m00 = (a->m00 * (1 - c->m00)) + (b->m00 * c->m00);
-  r->m01 = (a->m01 * (1 - c->m01)) + (b->m01 * c->m01);
-  r->m02 = (a->m02 * (1 - c->m02)) + (b->m02 * c->m02);
-  r->m03 = (a->m03 * (1 - c->m03)) + (b->m03 * c->m03);
-  r->m10 = (a->m10 * (1 - c->m10)) + (b->m10 * c->m10);
-  r->m11 = (a->m11 * (1 - c->m11)) + (b->m11 * c->m11);
-  r->m12 = (a->m12 * (1 - c->m12)) + (b->m12 * c->m12);
-  r->m13 = (a->m13 * (1 - c->m13)) + (b->m13 * c->m13);
-  r->m20 = (a->m20 * (1 - c->m20)) + (b->m20 * c->m20);
-  r->m21 = (a->m21 * (1 - c->m21)) + (b->m21 * c->m21);
-  r->m22 = (a->m22 * (1 - c->m22)) + (b->m22 * c->m22);
-  r->m23 = (a->m23 * (1 - c->m23)) + (b->m23 * c->m23);
-  r->m30 = (a->m30 * (1 - c->m30)) + (b->m30 * c->m30);
-  r->m31 = (a->m31 * (1 - c->m31)) + (b->m31 * c->m31);
-  r->m32 = (a->m32 * (1 - c->m32)) + (b->m32 * c->m32);
-  r->m33 = (a->m33 * (1 - c->m33)) + (b->m33 * c->m33);
-}
-
-//////// GValue Transformation /////////////////////////////////////////////////
-
-static void
-crank_mat_float4_transform_to_string (const GValue *src,
-                                      GValue       *dest)
-{
-  CrankMatFloat4 *mf = (CrankMatFloat4*) g_value_get_boxed (src);
-  gchar *str = crank_mat_float4_to_string (mf);
-
-  g_value_take_string (dest, str);
-}
-
-
-
 
+/**
+ * crank_mat_float4_batch_mulv:
+ * @n: Count of vectors.
+ * @a: A Matrix.
+ * @b: (array length=n): Vectors.
+ * @r: (out caller-allocates) (array length=n): Array to store results.
+ *
+ * Multiplies a matrix by @n vectors. @r may be same with @b.
+ *
+ * Several vectors are processed at once, if CPU supports.
+ */
 
+/**
+ * crank_mat_float4_batch_mul:
+ * @n: Count of matrices.
+ * @a: (array length=n): Matrices.
+ * @b: (array length=n): Matrices.
+ * @r: (out caller-allocates) (array length=n): Array to store results.
+ *
+ * Multiplies @n pairs of matrices, as in r[i] = a[i] b[i]. @r may be same with
+ * @a or @b.
+ */
 
-static void crank_mat_float_n_transform_from_m2 (const GValue *src,
-                                                 GValue       *dest);
-
-static void crank_mat_float_n_transform_from_m3 (const GValue *src,
-                                                 GValue       *dest);
-
-static void crank_mat_float_n_transform_from_m4 (const GValue *src,
-                                                 GValue       *dest);
-
-static void crank_mat_float_n_transform_to_string (const GValue *src,
-                                                   GValue       *dest);
+/**
+ * crank_mat_float4_soa_transform:
+ * @n: Count of points.
+ * @a: A Matrix.
+ * @x: (array length=n): X components of points.
+ * @y: (array length=n): Y components of points.
+ * @z: (array length=n): Z components of points.
+ * @rx: (out caller-allocates) (array length=n): X components of results.
+ * @ry: (out caller-allocates) (array length=n): Y components of results.
+ * @rz: (out caller-allocates) (array length=n): Z components of results.
+ *
+ * Transforms @n points, which are stored as separated streams of components.
+ * Points are treated as having w = 1, and w of results are dropped. So last
+ * row of @a is not used.
+ *
+ * Result streams may be same with input streams.
+ */
 
-G_DEFINE_BOXED_TYPE(CrankMatFloatN, crank_mat_float_n,
-                    crank_mat_float_n_dup, \
-                    crank_mat_float_n_free)
+/**
+ * crank_mat_float4_batch_transform:
+ * @n: Count of points.
+ * @a: A Matrix.
+ * @b: (array length=n): Points.
+ * @r: (out caller-allocates) (array length=n): Array to store results.
+ *
+ * Transforms @n points, as crank_mat_float4_soa_transform() does. @r may be
+ * same with @b.
+ */
 
 /**
  * crank_mat_float_n_init:
@@ -3927,24 +1851,6 @@ G_DEFINE_BOXED_TYPE(CrankMatFloatN, crank_mat_float_n,
  *
  * Initialize a matrix with given elements.
  */
-void
-crank_mat_float_n_init (CrankMatFloatN *mat,
-                        const guint     rn,
-                        const guint     cn,
-                        ...)
-{
-  va_list varargs;
-  guint i;
-
-  CRANK_MAT_ALLOC(mat, gfloat, rn, cn);
-
-  va_start (varargs, cn);
-
-  for (i = 0; i < rn * cn; i++)
-    mat->data[i] = (gfloat) (va_arg (varargs, gdouble));
-
-  va_end (varargs);
-}
 
 /**
  * crank_mat_float_n_init_arr:
@@ -3955,18 +1861,6 @@ crank_mat_float_n_init (CrankMatFloatN *mat,
  *
  * Initialize a matrix with given array.
  */
-void
-crank_mat_float_n_init_arr (CrankMatFloatN *mat,
-                            const guint     rn,
-                            const guint     cn,
-                            const gfloat   *marr)
-{
-  guint count = rn * cn;
-
-  CRANK_MAT_ALLOC(mat, gfloat, rn, cn);
-
-  memcpy (mat->data, marr, sizeof(gfloat) * count);
-}
 
 /**
  * crank_mat_float_n_init_arr_take:
@@ -3977,17 +1871,33 @@ crank_mat_float_n_init_arr (CrankMatFloatN *mat,
  *
  * Initialize a matrix by taking given array
  */
-void
-crank_mat_float_n_init_arr_take (CrankMatFloatN *mat,
-                                 const guint     rn,
-                                 const guint     cn,
-                                 gfloat         *marr)
-{
-  mat->data = marr;
-  mat->rn = rn;
-  mat->cn = cn;
-}
 
+/**
+ * crank_mat_float_n_init_arena:
+ * @mat: (out): A Matrix.
+ * @arena: An arena.
+ * @rn: Row count.
+ * @cn: Column count.
+ *
+ * Initialize a matrix filled with 0, with data from @arena.
+ *
+ * Data is owned by @arena, so @mat should not be passed to
+ * crank_mat_float_n_fini(), or to functions that reallocate its data.
+ */
+
+/**
+ * crank_mat_float_n_init_arr_arena:
+ * @mat: (out): A Matrix.
+ * @arena: An arena.
+ * @rn: Row count.
+ * @cn: Column count.
+ * @marr: (array): An array of matrix.
+ *
+ * Initialize a matrix with given array, with data from @arena.
+ *
+ * Data is owned by @arena, so @mat should not be passed to
+ * crank_mat_float_n_fini(), or to functions that reallocate its data.
+ */
 
 /**
  * crank_mat_float_n_init_row:
@@ -3997,41 +1907,6 @@ crank_mat_float_n_init_arr_take (CrankMatFloatN *mat,
  *
  * Initialize a matrix with given row vectors.
  */
-void
-crank_mat_float_n_init_row (CrankMatFloatN *mat,
-                            const guint     rn,
-                            ...)
-{
-  va_list varargs_cn;
-  va_list varargs_data;
-  guint i;
-  guint cn = 0;
-
-  va_start (varargs_cn, rn);
-  va_copy (varargs_data, varargs_cn);
-
-  // Phase 1: get max length of row vectors.
-  for (i = 0; i < rn; i++)
-    {
-      CrankVecFloatN *row = va_arg (varargs_cn, CrankVecFloatN*);
-
-      cn = MAX(cn, row->n);
-    }
-  va_end (varargs_cn);
-
-  // Phase 2: Copy actual data to matrix data.
-  CRANK_MAT_ALLOC(mat, gfloat, rn, cn);
-
-  for (i = 0; i < rn; i++)
-    {
-      CrankVecFloatN *row = va_arg (varargs_data, CrankVecFloatN*);
-
-      memcpy (crank_mat_float_n_get_rowp (mat,i),
-              row->data,
-              row->n * sizeof (gfloat));
-    }
-  va_end (varargs_data);
-}
 
 /**
  * crank_mat_float_n_init_row_arr:
@@ -4041,23 +1916,6 @@ crank_mat_float_n_init_row (CrankMatFloatN *mat,
  *
  * Initialize a matrix with array of row vectors.
  */
-void
-crank_mat_float_n_init_row_arr (CrankMatFloatN *mat,
-                                const guint     rn,
-                                CrankVecFloatN *row_arr)
-{
-  guint i;
-  guint cn = 0;
-
-  for (i = 0; i < rn; i++)
-    cn = MAX(cn, row_arr[i].n);
-
-  CRANK_MAT_ALLOC(mat, gfloat, rn, cn);
-  for (i = 0; i < rn; i++)
-    memcpy (crank_mat_float_n_get_rowp (mat,i),
-            row_arr[i].data,
-            row_arr[i].n * sizeof (gfloat));
-}
 
 /**
  * crank_mat_float_n_init_row_parr:
@@ -4067,23 +1925,6 @@ crank_mat_float_n_init_row_arr (CrankMatFloatN *mat,
  *
  * Initialize a matrix with array of row vectors.
  */
-void
-crank_mat_float_n_init_row_parr (CrankMatFloatN  *mat,
-                                 const guint      rn,
-                                 CrankVecFloatN **row_parr)
-{
-  guint i;
-  guint cn = 0;
-
-  for (i = 0; i < rn; i++)
-    cn = MAX(cn, row_parr[i]->n);
-
-  CRANK_MAT_ALLOC(mat, gfloat, rn, cn);
-  for (i = 0; i < rn; i++)
-    memcpy (crank_mat_float_n_get_rowp (mat,i),
-            row_parr[i]->data,
-            row_parr[i]->n * sizeof (gfloat));
-}
 
 /**
  * crank_mat_float_n_init_col:
@@ -4093,41 +1934,6 @@ crank_mat_float_n_init_row_parr (CrankMatFloatN  *mat,
  *
  * Initialize a matrix with column vectors.
  */
-void
-crank_mat_float_n_init_col (CrankMatFloatN *mat,
-                            const guint     cn,
-                            ...)
-{
-  va_list varargs_rn;
-  va_list varargs_data;
-
-  guint rn = 0;
-  guint i;
-  guint j;
-
-  va_start (varargs_rn, cn);
-  va_copy (varargs_data, varargs_rn);
-
-  for (i = 0; i < cn; i++)
-    {
-      CrankVecFloatN *col = va_arg (varargs_rn, CrankVecFloatN*);
-
-      rn = MAX (rn, col->n);
-    }
-  va_end (varargs_rn);
-
-  CRANK_MAT_ALLOC(mat, gfloat, rn, cn);
-  for (i = 0; i < cn; i++)
-    {
-      CrankVecFloatN *col = va_arg (varargs_data, CrankVecFloatN*);
-
-      for (j = 0; j < col->n; j++)
-        crank_mat_float_n_set (mat, j, i, col->data[j]);
-    }
-  va_end (varargs_data);
-
-}
-
 
 /**
  * crank_mat_float_n_init_col_arr:
@@ -4137,25 +1943,6 @@ crank_mat_float_n_init_col (CrankMatFloatN *mat,
  *
  * Initialize a matrix with an array of column vectors.
  */
-void
-crank_mat_float_n_init_col_arr (CrankMatFloatN *mat,
-                                const guint     cn,
-                                CrankVecFloatN *col_arr)
-{
-  guint rn = 0;
-  guint i;
-  guint j;
-
-  for (i = 0; i < cn; i++)
-    rn = MAX (rn, col_arr[i].n);
-
-  CRANK_MAT_ALLOC(mat, gfloat, rn, cn);
-  for (i = 0; i < cn; i++)
-    {
-      for (j = 0; j < col_arr[i].n; j++)
-        crank_mat_float_n_set (mat, j, i, col_arr[i].data[j]);
-    }
-}
 
 /**
  * crank_mat_float_n_init_col_parr:
@@ -4165,25 +1952,6 @@ crank_mat_float_n_init_col_arr (CrankMatFloatN *mat,
  *
  * Initialize a matrix with an array of column vectors.
  */
-void
-crank_mat_float_n_init_col_parr (CrankMatFloatN  *mat,
-                                 const guint      cn,
-                                 CrankVecFloatN **col_parr)
-{
-  guint rn = 0;
-  guint i;
-  guint j;
-
-  for (i = 0; i < cn; i++)
-    rn = MAX (rn, col_parr[i]->n);
-
-  CRANK_MAT_ALLOC(mat, gfloat, rn, cn);
-  for (i = 0; i < cn; i++)
-    {
-      for (j = 0; j < col_parr[i]->n; j++)
-        crank_mat_float_n_set (mat, j, i, col_parr[i]->data[j]);
-    }
-}
 
 /**
  * crank_mat_float_n_init_diag:
@@ -4194,23 +1962,6 @@ crank_mat_float_n_init_col_parr (CrankMatFloatN  *mat,
  * Initialize a matrix with diagonal elements.
  * Other elements are initialized with 0.
  */
-void
-crank_mat_float_n_init_diag (CrankMatFloatN *mat,
-                             const guint     n,
-                             ...)
-{
-  va_list varargs;
-  guint i;
-  guint n1 = n + 1;
-
-  va_start (varargs, n);
-
-  CRANK_MAT_ALLOC(mat, gfloat, n, n);
-  for (i = 0; i < n; i++)
-    mat->data[i * n1] = va_arg (varargs, gdouble);
-
-  va_end (varargs);
-}
 
 /**
  * crank_mat_float_n_init_diag_arr:
@@ -4221,18 +1972,6 @@ crank_mat_float_n_init_diag (CrankMatFloatN *mat,
  * Initialize a matrix with an array of diagonal elements.
  * Other elements are initialized with 0.
  */
-void
-crank_mat_float_n_init_diag_arr (CrankMatFloatN *mat,
-                                 const guint     n,
-                                 const gfloat   *darr)
-{
-  guint i;
-  guint n1 = n + 1;
-
-  CRANK_MAT_ALLOC(mat, gfloat, n, n);
-  for (i = 0; i < n; i++)
-    mat->data[i * n1] = darr[i];
-}
 
 /**
  * crank_mat_float_n_init_diag_vec:
@@ -4242,12 +1981,6 @@ crank_mat_float_n_init_diag_arr (CrankMatFloatN *mat,
  * Initialize a matrix with a vector of diagonal elements.
  * Other elements are initialized with 0.
  */
-void
-crank_mat_float_n_init_diag_vec (CrankMatFloatN *mat,
-                                 CrankVecFloatN *dvec)
-{
-  crank_mat_float_n_init_diag_arr (mat, dvec->n, dvec->data);
-}
 
 /**
  * crank_mat_float_n_init_fill:
@@ -4258,20 +1991,6 @@ crank_mat_float_n_init_diag_vec (CrankMatFloatN *mat,
  *
  * Initialize a matrix by filling with a value.
  */
-void
-crank_mat_float_n_init_fill (CrankMatFloatN *mat,
-                             const guint     rn,
-                             const guint     cn,
-                             const gfloat    fill)
-{
-  guint i;
-  guint n = rn * cn;
-
-  CRANK_MAT_ALLOC(mat, gfloat, rn, cn);
-
-  for (i = 0; i < n; i++)
-    mat->data[i] = fill;
-}
 
 /**
  * crank_mat_float_n_copy:
@@ -4280,12 +1999,6 @@ crank_mat_float_n_init_fill (CrankMatFloatN *mat,
  *
  * Copies a matrix to other matrix.
  */
-void
-crank_mat_float_n_copy (CrankMatFloatN *mat,
-                        CrankMatFloatN *other)
-{
-  crank_mat_float_n_init_arr (other, mat->rn, mat->cn, mat->data);
-}
 
 /**
  * crank_mat_float_n_dup:
@@ -4295,13 +2008,6 @@ crank_mat_float_n_copy (CrankMatFloatN *mat,
  *
  * Returns: an allocated copy. Free it with g_free()
  */
-CrankMatFloatN*
-crank_mat_float_n_dup (CrankMatFloatN *mat)
-{
-  CrankMatFloatN *result = g_new (CrankMatFloatN, 1);
-  crank_mat_float_n_copy (mat, result);
-  return result;
-}
 
 /**
  * crank_mat_float_n_fini:
@@ -4309,13 +2015,6 @@ crank_mat_float_n_dup (CrankMatFloatN *mat)
  *
  * Resets a matrix and frees its associated memory block.
  */
-void
-crank_mat_float_n_fini (CrankMatFloatN *mat)
-{
-  g_free (mat->data);
-  mat->rn = 0;
-  mat->cn = 0;
-}
 
 /**
  * crank_mat_float_n_free:
@@ -4323,15 +2022,6 @@ crank_mat_float_n_fini (CrankMatFloatN *mat)
  *
  * Frees allocated matrix.
  */
-void
-crank_mat_float_n_free (CrankMatFloatN *mat)
-{
-  crank_mat_float_n_fini (mat);
-  g_free (mat);
-}
-
-
-//////// Basic Operations //////////////////////////////////////////////////////
 
 /**
  * crank_mat_float_n_hash:
@@ -4342,25 +2032,6 @@ crank_mat_float_n_free (CrankMatFloatN *mat)
  *
  * Returns: hash value of a matrix.
  */
-guint
-crank_mat_float_n_hash (gconstpointer a)
-{
-  const CrankMatFloatN *mat = (const CrankMatFloatN*)a;
-  guint i;
-  guint n;
-
-  guint hash;
-
-  n = mat->rn * mat->cn;
-
-  hash =  37 * g_direct_hash (GINT_TO_POINTER (mat->rn)) +
-         g_direct_hash (GINT_TO_POINTER (mat->cn));
-
-  for (i = 0; i < n; i++)
-    hash = crank_float_hash (mat->data + i) + hash * 37;
-
-  return hash;
-}
 
 /**
  * crank_mat_float_n_equal:
@@ -4372,29 +2043,6 @@ crank_mat_float_n_hash (gconstpointer a)
  *
  * Returns: %TRUE if the two are same.
  */
-gboolean
-crank_mat_float_n_equal (gconstpointer a,
-                         gconstpointer b)
-{
-  const CrankMatFloatN *mat_a = (const CrankMatFloatN*)a;
-  const CrankMatFloatN *mat_b = (const CrankMatFloatN*)b;
-
-  guint i;
-  guint n;
-
-  if (    (mat_a->rn != mat_b->rn) ||
-          (mat_a->cn != mat_b->cn))
-    return FALSE;
-
-  n = mat_a->rn * mat_a->cn;
-  for (i = 0; i < n; i++)
-    {
-      if (mat_a->data[i] != mat_b->data[i])
-        return FALSE;
-    }
-
-  return TRUE;
-}
 
 /**
  * crank_mat_float_n_to_string:
@@ -4409,11 +2057,6 @@ crank_mat_float_n_equal (gconstpointer a,
  *
  * Returns: string representation of matrix.
  */
-gchar*
-crank_mat_float_n_to_string (CrankMatFloatN *mat)
-{
-  return crank_mat_float_n_to_string_full (mat, "[", ", ", "]", "[", ", ", "]", "%g");
-}
 
 /**
  * crank_mat_float_n_to_string_full:
@@ -4430,50 +2073,6 @@ crank_mat_float_n_to_string (CrankMatFloatN *mat)
  *
  * Returns: string representation of matrix.
  */
-gchar*
-crank_mat_float_n_to_string_full (CrankMatFloatN *mat,
-                                  const gchar    *mat_left,
-                                  const gchar    *mat_in,
-                                  const gchar    *mat_right,
-                                  const gchar    *row_left,
-                                  const gchar    *row_in,
-                                  const gchar    *row_right,
-                                  const gchar    *format)
-{
-  GString *builder;
-  gchar *str;
-
-  guint i;
-  guint j;
-
-  builder = g_string_new (mat_left);
-
-  for (i = 0; i < mat->rn; i++)
-    {
-      gfloat *mrowi = crank_mat_float_n_get_rowp (mat, i);
-
-      if (0 < i)
-        g_string_append (builder, mat_in);
-
-      g_string_append (builder, row_left);
-      for (j = 0; j < mat->cn; j++)
-        {
-          if (0 < j)
-            g_string_append (builder, row_in);
-          g_string_append_printf (builder, format, mrowi[j]);
-
-        }
-      g_string_append (builder, row_right);
-
-    }
-
-  g_string_append (builder, mat_right);
-
-  str = builder->str;
-
-  g_string_free (builder, FALSE);
-  return str;
-}
 
 /**
  * crank_mat_float_n_get_row_size:
@@ -4483,11 +2082,6 @@ crank_mat_float_n_to_string_full (CrankMatFloatN *mat,
  *
  * Returns: Row count of matrix.
  */
-guint
-crank_mat_float_n_get_row_size (CrankMatFloatN *mat)
-{
-  return mat->rn;
-}
 
 /**
  * crank_mat_float_n_get_col_size:
@@ -4497,11 +2091,6 @@ crank_mat_float_n_get_row_size (CrankMatFloatN *mat)
  *
  * Returns: Column count of matrix.
  */
-guint
-crank_mat_float_n_get_col_size (CrankMatFloatN *mat)
-{
-  return mat->cn;
-}
 
 /**
  * crank_mat_float_n_get:
@@ -4513,13 +2102,6 @@ crank_mat_float_n_get_col_size (CrankMatFloatN *mat)
  *
  * Returns: Element at given indices.
  */
-gfloat
-(crank_mat_float_n_get) (CrankMatFloatN *mat,
-                         const guint     i,
-                         const guint     j)
-{
-  return CRANK_MAT_GET(mat, i, j);
-}
 
 /**
  * crank_mat_float_n_set:
@@ -4530,14 +2112,6 @@ gfloat
  *
  * Sets element at given indices.
  */
-void
-(crank_mat_float_n_set) (CrankMatFloatN *mat,
-                         const guint     i,
-                         const guint     j,
-                         const gfloat    value)
-{
-  CRANK_MAT_SET(mat, i, j, value);
-}
 
 /**
  * crank_mat_float_n_get_row:
@@ -4547,15 +2121,6 @@ void
  *
  * Gets a row vector at given index.
  */
-void
-crank_mat_float_n_get_row (CrankMatFloatN *mat,
-                           const guint     index,
-                           CrankVecFloatN *row)
-{
-  crank_vec_float_n_init_arr (row,
-                              mat->cn,
-                              crank_mat_float_n_get_rowp(mat,index)   );
-}
 
 /**
  * crank_mat_float_n_set_row:
@@ -4565,15 +2130,6 @@ crank_mat_float_n_get_row (CrankMatFloatN *mat,
  *
  * Sets a row vector at given index.
  */
-void
-crank_mat_float_n_set_row (CrankMatFloatN *mat,
-                           const guint     index,
-                           CrankVecFloatN *row)
-{
-  g_return_if_fail (row->n <= mat->cn);
-  memcpy (crank_mat_float_n_get_rowp (mat, index), row->data, row->n);
-}
-
 
 /**
  * crank_mat_float_n_get_col:
@@ -4583,20 +2139,6 @@ crank_mat_float_n_set_row (CrankMatFloatN *mat,
  *
  * Gets a column vector at given index.
  */
-void
-crank_mat_float_n_get_col (CrankMatFloatN *mat,
-                           const guint     index,
-                           CrankVecFloatN *col)
-{
-  guint i;
-  gfloat *data;
-
-  data = g_new (gfloat, mat->rn);
-  for (i = 0; i < mat->rn; i++)
-    data[i] = crank_mat_float_n_get (mat, i, index);
-
-  crank_vec_float_n_init_arr_take (col, mat->rn, data);
-}
 
 /**
  * crank_mat_float_n_set_col:
@@ -4606,17 +2148,6 @@ crank_mat_float_n_get_col (CrankMatFloatN *mat,
  *
  * Sets a column vector at given index.
  */
-void
-crank_mat_float_n_set_col (CrankMatFloatN *mat,
-                           const guint     index,
-                           CrankVecFloatN *col)
-{
-  guint i;
-
-  g_return_if_fail (col->n <= mat->rn);
-  for (i = 0; i < mat->rn; i++)
-    crank_mat_float_n_set (mat, i, index, col->data[i]);
-}
 
 /**
  * crank_mat_float_n_getp:
@@ -4628,13 +2159,6 @@ crank_mat_float_n_set_col (CrankMatFloatN *mat,
  *
  * Returns: A Pointer to item at given indices.
  */
-gfloat*
-(crank_mat_float_n_getp) (CrankMatFloatN * mat,
-                          const guint i,
-                          const guint j)
-{
-  return CRANK_MAT_GETP (mat, i, j);
-}
 
 /**
  * crank_mat_float_n_get_rowp:
@@ -4645,13 +2169,6 @@ gfloat*
  *
  * Returns: A Pointer to row at given index.
  */
-gfloat*
-(crank_mat_float_n_get_rowp) (CrankMatFloatN * mat,
-                              const guint index)
-{
-  return CRANK_MAT_GET_ROWP (mat, index);
-}
-
 
 /**
  * crank_mat_float_n_slice_row:
@@ -4662,15 +2179,6 @@ gfloat*
  *
  * Slices rows of a matrix.
  */
-void
-crank_mat_float_n_slice_row (CrankMatFloatN *mat,
-                             const guint     start,
-                             const guint     end,
-                             CrankMatFloatN *r)
-{
-  crank_mat_float_n_slice (mat, start, 0, end, mat->cn, r);
-}
-
 
 /**
  * crank_mat_float_n_slice_col:
@@ -4681,15 +2189,6 @@ crank_mat_float_n_slice_row (CrankMatFloatN *mat,
  *
  * Slices columns of a matrix.
  */
-void
-crank_mat_float_n_slice_col (CrankMatFloatN *mat,
-                             const guint     start,
-                             const guint     end,
-                             CrankMatFloatN *r)
-{
-  crank_mat_float_n_slice (mat, 0, start, mat->rn, end, r);
-}
-
 
 /**
  * crank_mat_float_n_slice:
@@ -4702,41 +2201,6 @@ crank_mat_float_n_slice_col (CrankMatFloatN *mat,
  *
  * Slices a matrix.
  */
-void
-crank_mat_float_n_slice (CrankMatFloatN *mat,
-                         const guint     row_start,
-                         const guint     col_start,
-                         const guint     row_end,
-                         const guint     col_end,
-                         CrankMatFloatN *r)
-{
-  guint i;
-  guint j;
-
-  guint rn;
-  guint cn;
-
-  g_return_if_fail (mat != r);
-  g_return_if_fail (row_start <= row_end);
-  g_return_if_fail (col_start <= col_end);
-
-  rn = row_end - row_start;
-  cn = col_end - col_start;
-
-  CRANK_MAT_ALLOC(r, gfloat, rn, cn);
-
-  for (i = 0; i < rn; i++)
-    {
-      gfloat *rrowi = crank_mat_float_n_get_rowp (r, i);
-      gfloat *mrowi =
-        crank_mat_float_n_get_rowp (mat, i + row_start) + col_start;
-
-      memcpy (rrowi, mrowi, cn * sizeof (gfloat));
-    }
-}
-
-
-//////// Classification ////////////////////////////////////////////////////////
 
 /**
  * crank_mat_float_n_is_square:
@@ -4746,11 +2210,6 @@ crank_mat_float_n_slice (CrankMatFloatN *mat,
  *
  * Returns: Whether the matrix is square matrix.
  */
-gboolean
-crank_mat_float_n_is_square (CrankMatFloatN *mat)
-{
-  return (mat->rn == mat->cn);
-}
 
 /**
  * crank_mat_float_n_is_zero:
@@ -4760,21 +2219,6 @@ crank_mat_float_n_is_square (CrankMatFloatN *mat)
  *
  * Returns: Whether the matrix is zero matrix.
  */
-gboolean
-crank_mat_float_n_is_zero (CrankMatFloatN *mat)
-{
-  guint i;
-  guint n;
-
-  n = mat->rn * mat->cn;
-
-  for (i = 0; i < n; i++)
-    {
-      if (mat->data[i] != 0)
-        return FALSE;
-    }
-  return TRUE;
-}
 
 /**
  * crank_mat_float_n_is_identity:
@@ -4787,23 +2231,6 @@ crank_mat_float_n_is_zero (CrankMatFloatN *mat)
  *
  * Returns: Whether the matrix is identity matrix.
  */
-gboolean
-crank_mat_float_n_is_identity (CrankMatFloatN *mat)
-{
-  guint i;
-  guint j;
-
-  if (!crank_mat_float_n_is_square (mat))
-    return FALSE;
-
-  for (i = 0; i < mat->rn; i++)
-    for (j = 0; j < mat->cn; j++)
-      {
-        if (crank_mat_float_n_get (mat, i, j) != (i == j ? 1 : 0))
-          return FALSE;
-      }
-  return TRUE;
-}
 
 /**
  * crank_mat_float_n_is_upper_tri:
@@ -4816,23 +2243,6 @@ crank_mat_float_n_is_identity (CrankMatFloatN *mat)
  *
  * Returns: Whether the matrix is upper triangular matrix.
  */
-gboolean
-crank_mat_float_n_is_upper_tri (CrankMatFloatN *mat)
-{
-  guint i;
-  guint j;
-
-  if (!crank_mat_float_n_is_square (mat))
-    return FALSE;
-
-  for (i = 1; i < mat->rn; i++)
-    for (j = 0; j < i; j++)
-      {
-        if (crank_mat_float_n_get (mat, i, j) != 0)
-          return FALSE;
-      }
-  return TRUE;
-}
 
 /**
  * crank_mat_float_n_is_lower_tri:
@@ -4845,24 +2255,6 @@ crank_mat_float_n_is_upper_tri (CrankMatFloatN *mat)
  *
  * Returns: Whether the matrix is lower triangular matrix.
  */
-gboolean
-crank_mat_float_n_is_lower_tri (CrankMatFloatN *mat)
-{
-  guint i;
-  guint j;
-
-  if (!crank_mat_float_n_is_square (mat))
-    return FALSE;
-
-  guint rne = mat->rn - 1;
-  for (i = 0; i < rne; i++)
-    for (j = i + 1; j < mat->cn; j++)
-      {
-        if (crank_mat_float_n_get (mat, i, j) != 0)
-          return FALSE;
-      }
-  return TRUE;
-}
 
 /**
  * crank_mat_float_n_is_diag:
@@ -4874,29 +2266,6 @@ crank_mat_float_n_is_lower_tri (CrankMatFloatN *mat)
  *
  * Returns: Whether the matrix is diagonal matrix.
  */
-gboolean
-crank_mat_float_n_is_diag (CrankMatFloatN *mat)
-{
-  guint i;
-  guint rn1;
-  guint n;
-
-  if (!crank_mat_float_n_is_square (mat))
-    return FALSE;
-
-  rn1 = mat->rn + 1;
-  n = mat->rn * mat->cn;
-
-  for (i = 0; i < n; i++)
-    {
-      if (i % rn1 == 0)
-        continue;
-
-      if (mat->data[i] != 0)
-        return FALSE;
-    }
-  return TRUE;
-}
 
 /**
  * crank_mat_float_n_is_symmetry:
@@ -4909,24 +2278,6 @@ crank_mat_float_n_is_diag (CrankMatFloatN *mat)
  *
  * Returns: Whether the matrix is symmetry matrix.
  */
-gboolean
-crank_mat_float_n_is_symmetry (CrankMatFloatN *mat)
-{
-  guint i;
-  guint j;
-
-  if (!crank_mat_float_n_is_square (mat))
-    return FALSE;
-
-  for (i = 0; i < mat->rn; i++)
-    for (j = i + 1; j < mat->cn; j++)
-      {
-        if (crank_mat_float_n_get (mat, i, j) !=
-            crank_mat_float_n_get (mat, j, i) )
-          return FALSE;
-      }
-  return TRUE;
-}
 
 /**
  * crank_mat_float_n_has_nan:
@@ -4939,21 +2290,6 @@ crank_mat_float_n_is_symmetry (CrankMatFloatN *mat)
  *
  * Returns: Whether the matrix has NaN value.
  */
-gboolean
-crank_mat_float_n_has_nan (CrankMatFloatN *mat)
-{
-  guint i;
-  guint n;
-
-  n = mat->rn * mat->cn;
-
-  for (i = 0; i < n; i++)
-    {
-      if (isnanf (mat->data[i]))
-        return FALSE;
-    }
-  return FALSE;
-}
 
 /**
  * crank_mat_float_n_has_inf:
@@ -4966,22 +2302,6 @@ crank_mat_float_n_has_nan (CrankMatFloatN *mat)
  *
  * Returns: Whether the matrix has infinity.
  */
-gboolean
-crank_mat_float_n_has_inf (CrankMatFloatN *mat)
-{
-  guint i;
-  guint n;
-
-  n = mat->rn * mat->cn;
-
-  for (i = 0; i < n; i++)
-    {
-      if (isinff (mat->data[i]))
-        return FALSE;
-    }
-  return FALSE;
-}
-
 
 /**
  * crank_mat_float_n_get_tr:
@@ -4993,19 +2313,6 @@ crank_mat_float_n_has_inf (CrankMatFloatN *mat)
  *
  * Returns: A trace of matrix.
  */
-gfloat
-crank_mat_float_n_get_tr (CrankMatFloatN *mat)
-{
-  gfloat tr = 0.0f;
-  guint i;
-
-  CRANK_MAT_WARN_IF_NON_SQUARE_RET("MatFloatN", "tr", mat, 0.0f);
-
-  for (i = 0; i < mat->rn; i++)
-    tr += mat->data [(mat->cn * i) + i];
-
-  return tr;
-}
 
 /**
  * crank_mat_float_n_get_det:
@@ -5013,39 +2320,10 @@ crank_mat_float_n_get_tr (CrankMatFloatN *mat)
  *
  * Gets a determinent of matrix.
  *
+ * This is computed from pivoted LU factorization. See #CrankLUFloatN.
+ *
  * Returns: A determinent of matrix.
  */
-gfloat
-crank_mat_float_n_get_det (CrankMatFloatN *mat)
-{
-  CrankMatFloatN l = {0};
-  CrankMatFloatN u = {0};
-  CrankPermutation p = {0};
-
-  gfloat det;
-
-  CRANK_MAT_WARN_IF_NON_SQUARE_RET ("MatFloatN", "det", mat, 0.0f);
-
-  if (crank_lu_p_mat_float_n (mat, &p, &l, &u))
-    {
-      gint sign = crank_permutation_get_sign (&p);
-      guint i;
-
-      det = sign;
-
-      for (i = 0; i < mat->rn; i++)
-        {
-          det *= crank_mat_float_n_get (&l, i, i);
-          det *= crank_mat_float_n_get (&u, i, i);
-        }
-
-      crank_permutation_fini (&p);
-      crank_mat_float_n_fini (&l);
-      crank_mat_float_n_fini (&u);
-    }
-
-  return det;
-}
 
 /**
  * crank_mat_float_n_get_diag:
@@ -5054,20 +2332,6 @@ crank_mat_float_n_get_det (CrankMatFloatN *mat)
  *
  * Gets diagonal components as vector.
  */
-void
-crank_mat_float_n_get_diag (CrankMatFloatN *mat,
-                            CrankVecFloatN *r)
-{
-  guint i;
-
-  CRANK_MAT_WARN_IF_NON_SQUARE ("MatFloatN", "diag", mat);
-  gfloat *data = g_new (gfloat, mat->rn);
-
-  for (i = 0; i < mat->rn; i++)
-    data[i] = crank_mat_float_n_get (mat, i, i);
-
-  crank_vec_float_n_init_arr_take (r, mat->rn, data);
-}
 
 /**
  * crank_mat_float_n_get_cof:
@@ -5076,13 +2340,6 @@ crank_mat_float_n_get_diag (CrankMatFloatN *mat,
  *
  * Gets a cofactor matrix.
  */
-void
-crank_mat_float_n_get_cof (CrankMatFloatN *mat,
-                           CrankMatFloatN *r)
-{
-  crank_mat_float_n_get_adj (mat, r);
-  crank_mat_float_n_transpose_self (r);
-}
 
 /**
  * crank_mat_float_n_get_adj:
@@ -5091,47 +2348,9 @@ crank_mat_float_n_get_cof (CrankMatFloatN *mat,
  *
  * Gets a adjugate matrix.
  *
- * For variable sized matrix, this is calculated from inverse matrix.
+ * For variable sized matrix, this is calculated from inverse matrix. So if
+ * the matrix is singular, NaN matrix is returned.
  */
-void
-crank_mat_float_n_get_adj (CrankMatFloatN *mat,
-                           CrankMatFloatN *r)
-{
-  CrankMatFloatN l;
-  CrankMatFloatN u;
-
-  CrankMatFloatN linv;
-  CrankMatFloatN uinv;
-
-  guint i;
-  guint n1;
-  gfloat det = 1.0f;
-
-  g_return_if_fail (mat != r);
-  CRANK_MAT_WARN_IF_NON_SQUARE ("MatFloatN", "adj", mat);
-
-  crank_lu_mat_float_n (mat, &l, &u);
-
-  crank_mat_float_n_lower_tri_inverse (&l, &linv);
-  crank_mat_float_n_upper_tri_inverse (&u, &uinv);
-
-  crank_mat_float_n_mul_ul (&uinv, &linv, r);
-
-  n1 = mat->cn + 1;
-  for (i = 0; i < mat->rn; i++)
-    {
-      guint ei = i * n1;
-
-      det *=  l.data[ei] * u.data[ei];
-    }
-
-  crank_mat_float_n_muls_self (r, det);
-
-  crank_mat_float_n_fini (&l);
-  crank_mat_float_n_fini (&u);
-  crank_mat_float_n_fini (&linv);
-  crank_mat_float_n_fini (&uinv);
-}
 
 /**
  * crank_mat_float_n_neg:
@@ -5140,20 +2359,6 @@ crank_mat_float_n_get_adj (CrankMatFloatN *mat,
  *
  * Negates a matrix.
  */
-void
-crank_mat_float_n_neg (CrankMatFloatN *a,
-                       CrankMatFloatN *r)
-{
-  guint i;
-  guint n = a->rn * a->cn;
-
-  g_return_if_fail (a != r);
-
-  CRANK_MAT_ALLOC(r, gfloat, a->rn, a->cn);
-
-  for (i = 0; i < n; i++)
-    r->data[i] = -a->data[i];
-}
 
 /**
  * crank_mat_float_n_neg_self:
@@ -5161,16 +2366,6 @@ crank_mat_float_n_neg (CrankMatFloatN *a,
  *
  * Negates a matrix.
  */
-void
-crank_mat_float_n_neg_self (CrankMatFloatN *a)
-{
-  guint i;
-  guint j;
-  guint n = a->rn * a->cn;
-
-  for (i = 0; i < n; i++)
-    a->data[i] =  -a->data[i];
-}
 
 /**
  * crank_mat_float_n_transpose:
@@ -5178,51 +2373,32 @@ crank_mat_float_n_neg_self (CrankMatFloatN *a)
  * @r: (out): A Matrix to store result.
  *
  * Gets a transpose of matrix.
+ *
+ * This runs on threads by global setting. See crank_parallel_set_n_threads().
  */
-void
-crank_mat_float_n_transpose (CrankMatFloatN *a,
-                             CrankMatFloatN *r)
-{
-  guint i;
-  guint j;
-
-  g_return_if_fail (a != r);
-  CRANK_MAT_ALLOC (r, gfloat, a->cn, a->rn);
-
-  for (i = 0; i < a->rn; i++)
-    {
-      gfloat *arowi = crank_mat_float_n_get_rowp (a, i);
-
-      for (j = 0; j < a->cn; j++)
-        crank_mat_float_n_set (r, j, i, arowi[j]);
-    }
-}
 
 /**
  * crank_mat_float_n_transpose_self:
  * @a: A Matrix.
  *
  * Gets a transpose of matrix.
+ *
+ * This is done in place. Square matrices are transposed by exchanging
+ * elements, and other matrices are transposed by following cycles of
+ * permutation. For this, a bitmap of visited elements is taken from scratch
+ * arena. See crank_mat_float_n_transpose_self_arena().
  */
-void
-crank_mat_float_n_transpose_self (CrankMatFloatN *a)
-{
-  guint i;
-  guint j;
-
-  gfloat *data = g_new (gfloat, a->rn * a->cn);
 
-  for (i = 0; i < a->rn; i++)
-    {
-      gfloat *arowi = crank_mat_float_n_get_rowp (a, i);
-
-      for (j = 0; j < a->cn; j++)
-        data[(j * a->rn) + i] = arowi[j];
-    }
-
-  g_free (a->data);
-  crank_mat_float_n_init_arr_take (a, a->cn, a->rn, data);
-}
+/**
+ * crank_mat_float_n_transpose_self_arena:
+ * @a: A Matrix.
+ * @arena: An arena to take workspace from.
+ *
+ * Gets a transpose of matrix, in place.
+ *
+ * For non-square matrix, bitmap of (@a->rn * @a->cn) bits is taken from
+ * @arena, and returned before this returns.
+ */
 
 /**
  * crank_mat_float_n_inverse:
@@ -5233,34 +2409,9 @@ crank_mat_float_n_transpose_self (CrankMatFloatN *a)
  * If the matrix is singular, then NaN matrix may be returned.
  *
  * Current implementation make uses LU Decomposition.
+ *
+ * This runs on threads by global setting. See crank_parallel_set_n_threads().
  */
-void
-crank_mat_float_n_inverse (CrankMatFloatN *a,
-                           CrankMatFloatN *r)
-{
-  CrankMatFloatN l;
-  CrankMatFloatN u;
-
-  CrankMatFloatN linv;
-  CrankMatFloatN uinv;
-
-  g_return_if_fail (a != r);
-  CRANK_MAT_WARN_IF_NON_SQUARE ("MatFloatN", "inverse", a);
-
-  if (crank_lu_mat_float_n (a, &l, &u))
-    {
-
-      crank_mat_float_n_lower_tri_inverse (&l, &linv);
-      crank_mat_float_n_upper_tri_inverse (&u, &uinv);
-
-      crank_mat_float_n_mul_ul (&uinv, &linv, r);
-
-      crank_mat_float_n_fini (&l);
-      crank_mat_float_n_fini (&u);
-      crank_mat_float_n_fini (&linv);
-      crank_mat_float_n_fini (&uinv);
-    }
-}
 
 /**
  * crank_mat_float_n_inverse_self:
@@ -5268,32 +2419,9 @@ crank_mat_float_n_inverse (CrankMatFloatN *a,
  *
  * Gets an inverse of matrix.
  * If the matrix is singular, then NaN matrix may be returned.
+ *
+ * This is done in place. See crank_mat_float_n_try_inverse_self().
  */
-void
-crank_mat_float_n_inverse_self (CrankMatFloatN *a)
-{
-  CrankMatFloatN l;
-  CrankMatFloatN u;
-
-  CrankMatFloatN linv;
-  CrankMatFloatN uinv;
-
-  CRANK_MAT_WARN_IF_NON_SQUARE ("MatFloatN", "inverse", a);
-
-  if (crank_lu_mat_float_n (a, &l, &u))
-    {
-
-      crank_mat_float_n_lower_tri_inverse (&l, &linv);
-      crank_mat_float_n_upper_tri_inverse (&u, &uinv);
-
-      crank_mat_float_n_mul_ul (&uinv, &linv, a);
-
-      crank_mat_float_n_fini (&l);
-      crank_mat_float_n_fini (&u);
-      crank_mat_float_n_fini (&linv);
-      crank_mat_float_n_fini (&uinv);
-    }
-}
 
 /**
  * crank_mat_float_n_try_inverse:
@@ -5307,36 +2435,6 @@ crank_mat_float_n_inverse_self (CrankMatFloatN *a)
  *
  * Returns: Whether the matrix is non-singular and inverse is done.
  */
-gboolean
-crank_mat_float_n_try_inverse (CrankMatFloatN *a,
-                               CrankMatFloatN *r)
-{
-  CrankMatFloatN l;
-  CrankMatFloatN u;
-
-  CrankMatFloatN linv;
-  CrankMatFloatN uinv;
-
-  g_return_val_if_fail (a != r, FALSE);
-  CRANK_MAT_WARN_IF_NON_SQUARE_RET ("MatFloatN", "try-inverse", a, FALSE);
-
-  if (crank_lu_mat_float_n (a, &l, &u))
-    {
-      crank_mat_float_n_lower_tri_inverse (&l, &linv);
-      crank_mat_float_n_upper_tri_inverse (&u, &uinv);
-
-      crank_mat_float_n_mul_ul (&uinv, &linv, r);
-
-      crank_mat_float_n_fini (&l);
-      crank_mat_float_n_fini (&u);
-      crank_mat_float_n_fini (&linv);
-      crank_mat_float_n_fini (&uinv);
-
-      return TRUE;
-    }
-  else
-    return FALSE;
-}
 
 /**
  * crank_mat_float_n_try_inverse_self:
@@ -5345,35 +2443,59 @@ crank_mat_float_n_try_inverse (CrankMatFloatN *a,
  * Gets an inverse of matrix.
  * If the matrix is singular, then this operation is nop and returns %FALSE.
  *
+ * This is done in place, by LU factorization with partial pivoting. A copy of
+ * @a, pivots and a column of workspace are taken from scratch arena. See
+ * crank_mat_float_n_try_inverse_self_arena().
+ *
  * Returns: Whether the matrix is non-singular and inverse is done.
  */
-gboolean
-crank_mat_float_n_try_inverse_self (CrankMatFloatN *a)
-{
-  CrankMatFloatN l;
-  CrankMatFloatN u;
 
-  CrankMatFloatN linv;
-  CrankMatFloatN uinv;
-
-  CRANK_MAT_WARN_IF_NON_SQUARE_RET ("MatFloatN", "try-inverse-self", a, FALSE);
-
-  if (crank_lu_mat_float_n (a, &l, &u))
-    {
-      crank_mat_float_n_lower_tri_inverse (&l, &linv);
-      crank_mat_float_n_upper_tri_inverse (&u, &uinv);
+/**
+ * crank_mat_float_n_try_inverse_self_arena:
+ * @a: A Matrix.
+ * @arena: An arena to take workspace from.
+ *
+ * Gets an inverse of matrix, in place.
+ * If the matrix is singular, then @a is left untouched and returns %FALSE.
+ *
+ * A copy of @a is factorized in place as P @a = L U, and U is inverted in
+ * place. Then inverse is solved from inverse * L = inverse of U, column by
+ * column from last one. Finally columns are exchanged back by P, and the copy
+ * is written over @a.
+ *
+ * Workspace of the copy, @a->rn pivots and elements is taken from @arena, and
+ * returned before this returns.
+ *
+ * Returns: Whether the matrix is non-singular and inverse is done.
+ */
 
-      crank_mat_float_n_mul_ul (&uinv, &linv, a);
+/**
+ * crank_mat_float_n_solve:
+ * @a: A Square matrix.
+ * @b: A Vector.
+ * @x: (out): A Vector to store solution.
+ *
+ * Solves linear system @a @x = @b, without getting inverse of @a.
+ *
+ * This factorizes @a with #CrankLUFloatN. To solve many systems with same @a,
+ * reuse a factorization with crank_lu_float_n_solve().
+ *
+ * Small matrices are solved by crank_mat_float_fixed_solve(), without
+ * allocating factorization.
+ *
+ * Returns: Whether the matrix is non-singular and @x is solved.
+ */
 
-      crank_mat_float_n_fini (&l);
-      crank_mat_float_n_fini (&u);
-      crank_mat_float_n_fini (&linv);
-      crank_mat_float_n_fini (&uinv);
-      return TRUE;
-    }
-  else
-    return FALSE;
-}
+/**
+ * crank_mat_float_n_solve_multi:
+ * @a: A Square matrix.
+ * @b: A Matrix, whose columns are right hand sides.
+ * @x: (out): A Matrix to store solutions.
+ *
+ * Solves linear system @a @x = @b, for all columns of @b.
+ *
+ * Returns: Whether the matrix is non-singular and @x is solved.
+ */
 
 /**
  * crank_mat_float_n_muls:
@@ -5383,21 +2505,6 @@ crank_mat_float_n_try_inverse_self (CrankMatFloatN *a)
  *
  * Multiplies a matrix by scalar.
  */
-void
-crank_mat_float_n_muls (CrankMatFloatN *a,
-                        const gfloat    b,
-                        CrankMatFloatN *r)
-{
-  guint i;
-  guint n = a->rn * a->cn;
-
-  g_return_if_fail (a != r);
-
-  CRANK_MAT_ALLOC(r, gfloat, a->rn, a->cn);
-
-  for (i = 0; i < n; i++)
-    r->data[i] = a->data[i] * b;
-}
 
 /**
  * crank_mat_float_n_muls_self:
@@ -5406,19 +2513,6 @@ crank_mat_float_n_muls (CrankMatFloatN *a,
  *
  * Multiplies a matrix by scalar.
  */
-void
-crank_mat_float_n_muls_self (CrankMatFloatN *a,
-                             const gfloat    b)
-{
-  guint i;
-  guint j;
-  guint n;
-
-  n = a->rn * a->cn;
-
-  for (i = 0; i < n; i++)
-    a->data[i] *= b;
-}
 
 /**
  * crank_mat_float_n_mulv:
@@ -5427,30 +2521,9 @@ crank_mat_float_n_muls_self (CrankMatFloatN *a,
  * @r: (out): A Matrix to store result.
  *
  * Multiplies a matrix by vector.
+ *
+ * This runs on threads by global setting. See crank_parallel_set_n_threads().
  */
-void
-crank_mat_float_n_mulv (CrankMatFloatN *a,
-                        CrankVecFloatN *b,
-                        CrankVecFloatN *r)
-{
-  guint i;
-  guint j;
-
-  gfloat *data;
-
-  g_return_if_fail (b != r);
-  g_return_if_fail (a->cn == b->n);
-
-  CRANK_VEC_ALLOC0 (r, gfloat, a->rn);
-
-  for (i = 0; i < a->rn; i++)
-    {
-      gfloat *arowi = crank_mat_float_n_get_rowp (a, i);
-
-      for (j = 0; j < a->cn; j++)
-        r->data[i] += arowi[j] * b->data[j];
-    }
-}
 
 /**
  * crank_mat_float_n_mul:
@@ -5459,47 +2532,12 @@ crank_mat_float_n_mulv (CrankMatFloatN *a,
  * @r: (out): A Matrix to store result.
  *
  * Multiplies two matrices.
+ *
+ * For large matrices, this uses cache-blocked kernel, which is vectorized by
+ * CPU features.
+ *
+ * This runs on threads by global setting. See crank_parallel_set_n_threads().
  */
-void
-crank_mat_float_n_mul (CrankMatFloatN *a,
-                       CrankMatFloatN *b,
-                       CrankMatFloatN *r)
-{
-  guint i;
-  guint j;
-  guint k;
-
-  CrankMatFloatN bt;
-
-  g_return_if_fail (a != r);
-  g_return_if_fail (b != r);
-
-  if (G_UNLIKELY(a->cn != b->rn))
-    {
-      g_warning ("MatFloatN: mul-self: Size Mismatch: %ux%u, %ux%u",
-                 a->rn, a->cn,   b->rn, b->cn);
-      return;
-    }
-
-  CRANK_MAT_ALLOC0 (r, gfloat, a->rn, b->cn);
-
-  crank_mat_float_n_transpose (b, &bt);
-  for (i = 0; i < a->rn; i++)
-    {
-      gfloat *arowi = crank_mat_float_n_get_rowp (a, i);
-      gfloat *rrowi = crank_mat_float_n_get_rowp (r, i);
-
-      for (j = 0; j < b->cn; j++)
-        {
-          gfloat *bcolj = crank_mat_float_n_get_rowp (&bt, j);
-
-          for (k = 0; k < a->cn; k++)
-            rrowi[j] += arowi[k] * bcolj[k];
-        }
-    }
-
-  crank_mat_float_n_fini (&bt);
-}
 
 /**
  * crank_mat_float_n_mul_self:
@@ -5507,47 +2545,29 @@ crank_mat_float_n_mul (CrankMatFloatN *a,
  * @b: A Matrix.
  *
  * Multiplies two matrices.
+ *
+ * As each row of result only depends on same row of @a, result is written
+ * over @a, a panel of rows at a time. Only the panel and transpose of @b are
+ * taken from scratch arena. See crank_mat_float_n_mul_self_arena().
  */
-void
-crank_mat_float_n_mul_self (CrankMatFloatN *a,
-                            CrankMatFloatN *b)
-{
-  guint i;
-  guint j;
-  guint k;
-
-  CrankMatFloatN bt;
-  gfloat *data;
-
-  if (G_UNLIKELY(a->cn != b->rn))
-    {
-      g_warning ("MatFloatN: mul-self: Size Mismatch: %ux%u, %ux%u",
-                 a->rn, a->cn,   b->rn, b->cn);
-      return;
-    }
-
-  data = g_new0 (gfloat, a->rn * b->cn);
-  crank_mat_float_n_transpose (b, &bt);
-
-  for (i = 0; i < a->rn; i++)
-    {
-      gfloat *arowi = crank_mat_float_n_get_rowp (a, i);
-      gfloat *drowi = data + (b->cn * i);
 
-      for (j = 0; j < b->cn; j++)
-        {
-          gfloat *bcolj = crank_mat_float_n_get_rowp (&bt, j);
-
-          for (k = 0; k < a->cn; k++)
-            drowi[j] += arowi[k] * bcolj[k];
-        }
-    }
-
-  g_free (a->data);
-  crank_mat_float_n_init_arr_take (a, a->rn, b->cn, data);
-
-  crank_mat_float_n_fini (&bt);
-}
+/**
+ * crank_mat_float_n_mul_self_arena:
+ * @a: A Matrix.
+ * @b: A Matrix.
+ * @arena: An arena to take workspace from.
+ *
+ * Multiplies two matrices, writing result over @a.
+ *
+ * Rows of @a are copied to a panel from @arena and multiplied by @b. If @b has
+ * more columns than rows, storage of @a is grown first and panels are
+ * processed from last one, so that results do not overwrite unprocessed rows.
+ *
+ * Workspace is a panel of 64 rows for large matrices, or a row and transpose
+ * of @b for small matrices.
+ *
+ * @b may be same with @a. Then @b is copied to @arena first.
+ */
 
 /**
  * crank_mat_float_n_divs:
@@ -5557,15 +2577,6 @@ crank_mat_float_n_mul_self (CrankMatFloatN *a,
  *
  * Divides a matrix by scalar.
  */
-void
-crank_mat_float_n_divs (CrankMatFloatN *a,
-                        const gfloat    b,
-                        CrankMatFloatN *r)
-{
-
-  g_return_if_fail (a != r);
-  crank_mat_float_n_muls (a, 1 / b, r);
-}
 
 /**
  * crank_mat_float_n_divs_self:
@@ -5574,14 +2585,6 @@ crank_mat_float_n_divs (CrankMatFloatN *a,
  *
  * Divides a matrix by scalar.
  */
-void
-crank_mat_float_n_divs_self (CrankMatFloatN *a,
-                             const gfloat    b)
-{
-  crank_mat_float_n_muls_self (a, 1 / b);
-}
-
-
 
 /**
  * crank_mat_float_n_add:
@@ -5590,24 +2593,9 @@ crank_mat_float_n_divs_self (CrankMatFloatN *a,
  * @r: (out): A Matrix to store result.
  *
  * Adds a matrix.
+ *
+ * This runs on threads by global setting. See crank_parallel_set_n_threads().
  */
-void
-crank_mat_float_n_add (CrankMatFloatN *a,
-                       CrankMatFloatN *b,
-                       CrankMatFloatN *r)
-{
-  guint i;
-  guint n;
-
-  g_return_if_fail (a != r);
-  g_return_if_fail (b != r);
-  CRANK_MAT_WARN_IF_SIZE_MISMATCH2("MatFloatN", "sub", a, b);
-  CRANK_MAT_ALLOC(r, gfloat, a->rn, a->cn);
-
-  n = a->rn * a->cn;
-  for (i = 0; i < n; i++)
-    r->data[i] = a->data[i] + b->data[i];
-}
 
 /**
  * crank_mat_float_n_add_self:
@@ -5616,19 +2604,6 @@ crank_mat_float_n_add (CrankMatFloatN *a,
  *
  * Adds a matrix.
  */
-void
-crank_mat_float_n_add_self (CrankMatFloatN *a,
-                            CrankMatFloatN *b)
-{
-  guint i;
-  guint n;
-
-  CRANK_MAT_WARN_IF_SIZE_MISMATCH2("MatFloatN", "add-self", a, b);
-
-  n = a->rn * a->cn;
-  for (i = 0; i < n; i++)
-    a->data[i] += b->data[i];
-}
 
 /**
  * crank_mat_float_n_sub:
@@ -5637,25 +2612,9 @@ crank_mat_float_n_add_self (CrankMatFloatN *a,
  * @r: (out): A Matrix to store result.
  *
  * Subtracts a matrix.
+ *
+ * This runs on threads by global setting. See crank_parallel_set_n_threads().
  */
-void
-crank_mat_float_n_sub (CrankMatFloatN *a,
-                       CrankMatFloatN *b,
-                       CrankMatFloatN *r)
-{
-  guint i;
-  guint n;
-
-  g_return_if_fail (a != r);
-  g_return_if_fail (b != r);
-  CRANK_MAT_WARN_IF_SIZE_MISMATCH2("MatFloatN", "sub", a, b);
-  CRANK_MAT_ALLOC(r, gfloat, a->rn, a->cn);
-
-  n = a->rn * a->cn;
-  for (i = 0; i < n; i++)
-    r->data[i] = a->data[i] - b->data[i];
-}
-
 
 /**
  * crank_mat_float_n_sub_self:
@@ -5664,19 +2623,6 @@ crank_mat_float_n_sub (CrankMatFloatN *a,
  *
  * Subtracts a matrix.
  */
-void
-crank_mat_float_n_sub_self (CrankMatFloatN *a,
-                            CrankMatFloatN *b)
-{
-  guint i;
-  guint n;
-
-  CRANK_MAT_WARN_IF_SIZE_MISMATCH2("MatFloatN", "sub-self", a, b);
-
-  n = a->rn * a->cn;
-  for (i = 0; i < n; i++)
-    a->data[i] -= b->data[i];
-}
 
 /**
  * crank_mat_float_n_mixs:
@@ -5690,29 +2636,6 @@ crank_mat_float_n_sub_self (CrankMatFloatN *a,
  * The result is calculated by,
  * * (a * (1 - c)) + (b * c)
  */
-void
-crank_mat_float_n_mixs (CrankMatFloatN *a,
-                        CrankMatFloatN *b,
-                        const gfloat    c,
-                        CrankMatFloatN *r)
-{
-  guint i;
-  guint n;
-
-  g_return_if_fail (a != r);
-  g_return_if_fail (b != r);
-
-  CRANK_MAT_WARN_IF_SIZE_MISMATCH2("MatFloatN", "mix-scalar", a, b);
-
-  gfloat d = 1 - c;
-
-  CRANK_MAT_ALLOC(r, gfloat, a->rn, a->cn);
-
-  n = a->rn * a->cn;
-
-  for (i = 0; i < n; i++)
-    r->data[i] = a->data[i] * d + b->data[i] * c;
-}
 
 /**
  * crank_mat_float_n_mix:
@@ -5726,35 +2649,6 @@ crank_mat_float_n_mixs (CrankMatFloatN *a,
  * The result is calculated by,
  * * r[i, j] = (a[i, j] * (1 - c[i, j]) + (b[i, j] * c[i, j])
  */
-void
-crank_mat_float_n_mix (CrankMatFloatN *a,
-                       CrankMatFloatN *b,
-                       CrankMatFloatN *c,
-                       CrankMatFloatN *r)
-{
-  guint i;
-  guint n;
-
-  g_return_if_fail (a != r);
-  g_return_if_fail (b != r);
-  g_return_if_fail (c != r);
-
-  CRANK_MAT_WARN_IF_SIZE_MISMATCH3("MatFloatN", "mix", a, b, c);
-
-  CRANK_MAT_ALLOC(r, gfloat, a->rn, a->cn);
-
-  n = a->rn * a->cn;
-  for (i = 0; i < n; i++)
-    {
-      gfloat ce = c->data[i];
-      gfloat de = 1 - ce;
-
-      r->data[i] = a->data[i] * de + b->data[i] * ce;
-    }
-}
-
-
-//////// Shuffling /////////////////////////////////////////////////////////////
 
 /**
  * crank_mat_float_n_shuffle_row:
@@ -5764,36 +2658,6 @@ crank_mat_float_n_mix (CrankMatFloatN *a,
  *
  * Shuffles row vectors by given permutation.
  */
-void
-crank_mat_float_n_shuffle_row (CrankMatFloatN   *a,
-                               CrankPermutation *p,
-                               CrankMatFloatN   *r)
-{
-  guint i;
-
-  g_return_if_fail (a != r);
-
-  if (a->rn == p->n)
-    {
-      CRANK_MAT_ALLOC (r, gfloat, a->rn, a->cn);
-
-      for (i = 0; i < a->rn; i++)
-        {
-          guint ni = crank_permutation_get (p, i);
-          gfloat *rrowi   = crank_mat_float_n_get_rowp (r, i);
-          gfloat *arowni  = crank_mat_float_n_get_rowp (a, ni);
-
-          memcpy (rrowi, arowni, sizeof (gfloat) * a->cn);
-        }
-    }
-
-  else
-    {
-      g_warning ("MatFloatN: shuffle row: size mismatch: %ux%u, %u",
-                 a->rn, a->cn, p->n);
-    }
-}
-
 
 /**
  * crank_mat_float_n_shuffle_col:
@@ -5803,41 +2667,6 @@ crank_mat_float_n_shuffle_row (CrankMatFloatN   *a,
  *
  * Shuffles row vectors by given permutation.
  */
-void
-crank_mat_float_n_shuffle_col (CrankMatFloatN   *a,
-                               CrankPermutation *p,
-                               CrankMatFloatN   *r)
-{
-  gfloat *data;
-  guint i;
-  guint j;
-
-  g_return_if_fail (a != r);
-
-  if (a->cn == p->n)
-    {
-      CRANK_MAT_ALLOC (r, gfloat, a->rn, a->cn);
-
-      for (i = 0; i < a->rn; i++)
-        {
-          gfloat *rrowi = crank_mat_float_n_get_rowp (r, i);
-          gfloat *arowi = crank_mat_float_n_get_rowp (a, i);
-          for (j = 0; j < a->cn; j++)
-            {
-              rrowi[j] = arowi[crank_permutation_get (p, j)];
-            }
-        }
-    }
-
-  else
-    {
-      g_warning ("MatFloatN: shuffle row: size mismatch: %ux%u, %u",
-                 a->rn, a->cn, p->n);
-    }
-}
-
-
-//////// Supplement Operations /////////////////////////////////////////////////
 
 /**
  * crank_mat_float_n_upper_tri_inverse:
@@ -5848,49 +2677,6 @@ crank_mat_float_n_shuffle_col (CrankMatFloatN   *a,
  *
  * This is used to calculating inverse with decompositions.
  */
-void
-crank_mat_float_n_upper_tri_inverse (CrankMatFloatN *a,
-                                     CrankMatFloatN *r)
-{
-  guint i;
-  guint j;
-  guint k;
-
-  CRANK_MAT_WARN_IF_NON_SQUARE ("MatFloatN", "upper-triangular-inverse", a);
-
-  CRANK_MAT_ALLOC0 (r, gfloat, a->rn, a->rn);
-
-  // Fisrt calculate transpose of inverse (to get advantage of cache)
-  // And transpose.
-
-  // Initialize diagonal components.
-  for (i = 0; i < a->rn; i++)
-    {
-      crank_mat_float_n_set (r, i, i,
-                             1 / crank_mat_float_n_get (a, i, i));
-    }
-
-  for (i = 0; i < a->rn; i++)
-    {
-      gfloat *rtrowi = crank_mat_float_n_get_rowp (r, i);
-
-      j = i;
-      while (0 < j)
-        {
-          j--;
-          gfloat *arowj = crank_mat_float_n_get_rowp (a, j);
-
-          gfloat sum = 0;
-          for (k = j + 1; k <= i; k++)
-            sum += arowj[k] * rtrowi[k];
-
-          rtrowi[j] = -sum / arowj[j];
-        }
-    }
-
-  crank_mat_float_n_transpose_self (r);
-}
-
 
 /**
  * crank_mat_float_n_lower_tri_inverse:
@@ -5901,50 +2687,6 @@ crank_mat_float_n_upper_tri_inverse (CrankMatFloatN *a,
  *
  * This is used to calculating inverse with decompositions.
  */
-void
-crank_mat_float_n_lower_tri_inverse (CrankMatFloatN *a,
-                                     CrankMatFloatN *r)
-{
-  guint i;
-  guint j;
-  guint k;
-
-  CRANK_MAT_WARN_IF_NON_SQUARE ("MatFloatN", "lower-triangular-inverse", a);
-
-  crank_mat_float_n_init_fill (r, a->rn, a->rn, 0);
-
-  // Fisrt calculate transpose of inverse (to get advantage of cache)
-  // And transpose.
-
-  // Initialize diagonal components.
-  for (i = 0; i < a->rn; i++)
-    {
-      crank_mat_float_n_set (r, i, i,
-                             1 / crank_mat_float_n_get (a, i, i));
-    }
-
-  i = a->rn - 1;
-  while (0 < i)
-    {
-      gfloat *rtrowi;
-
-      i--;
-      rtrowi = crank_mat_float_n_get_rowp (r, i);
-
-      for (j = i + 1; j < a->rn; j++)
-        {
-          gfloat sum = 0;
-          gfloat *arowj = crank_mat_float_n_get_rowp (a, j);
-
-          for (k = i; k < j; k++)
-            sum += rtrowi[k] * arowj[k];
-          rtrowi[j] = -sum / arowj[j];
-        }
-    }
-
-  crank_mat_float_n_transpose_self (r);
-}
-
 
 /**
  * crank_mat_float_n_diag_inverse:
@@ -5955,23 +2697,6 @@ crank_mat_float_n_lower_tri_inverse (CrankMatFloatN *a,
  *
  * This is used to calculating inverse with decompositions.
  */
-void
-crank_mat_float_n_diag_inverse (CrankMatFloatN *a,
-                                CrankMatFloatN *r)
-{
-  guint i;
-
-  CRANK_MAT_WARN_IF_NON_SQUARE ("MatFloatN", "diag-inverse", a);
-
-  crank_mat_float_n_init_fill (r, a->rn, a->rn, 0);
-
-  // Initialize diagonal components.
-  for (i = 0; i < a->rn; i++)
-    {
-      crank_mat_float_n_set (r, i, i,
-                             1 / crank_mat_float_n_get (a, i, i));
-    }
-}
 
 /**
  * crank_mat_float_n_mul_ul:
@@ -5983,92 +2708,65 @@ crank_mat_float_n_diag_inverse (CrankMatFloatN *a,
  *
  * This function is more like internal function, used for calculating inverse.
  */
-void
-crank_mat_float_n_mul_ul (CrankMatFloatN *u,
-                          CrankMatFloatN *l,
-                          CrankMatFloatN *r)
-{
-  guint i;
-  guint j;
-  guint k;
-
-  CrankMatFloatN lt;
-
-  CRANK_MAT_WARN_IF_NON_SQUARE ("MatFloatN", "mul-ul", u);
-  CRANK_MAT_WARN_IF_NON_SQUARE ("MatFloatN", "mul-ul", l);
-  CRANK_MAT_WARN_IF_SIZE_MISMATCH2 ("MatFloatN", "mul-ul", u, l);
-
-  CRANK_MAT_ALLOC0 (r, gfloat, u->rn, l->cn);
-
-  crank_mat_float_n_transpose (l, &lt);
-
-  for (i = 0; i < u->rn; i++)
-    {
-      gfloat *urowi = crank_mat_float_n_get_rowp (u, i);
-      gfloat *rrowi = crank_mat_float_n_get_rowp (r, i);
-
-      for (j = 0; j < i; j++)
-        {
-          gfloat *lcolj = crank_mat_float_n_get_rowp (&lt, j);
-
-          for (k = i; k < u->cn; k++)
-            rrowi[j] += urowi[k] * lcolj[k];
-        }
-
-      for (; j < u->cn; j++)
-        {
-          gfloat *lcolj = crank_mat_float_n_get_rowp (&lt, j);
-
-          for (k = j; k < u->cn; k++)
-            rrowi[j] += urowi[k] * lcolj[k];
-        }
-    }
-
-  crank_mat_float_n_fini (&lt);
-}
 
+/**
+ * crank_mat_float_n_transpose_parallel:
+ * @a: A Matrix.
+ * @r: (out): A Matrix to store result.
+ * @n_threads: Number of threads, or 0 for number of processors.
+ *
+ * Gets a transpose of matrix, with given number of threads.
+ */
 
-//////// GValue Transformation /////////////////////////////////////////////////
-
-static void
-crank_mat_float_n_transform_from_m2 (const GValue *src,
-                                     GValue       *dest)
-{
-  CrankMatFloatN *mf = g_new (CrankMatFloatN, 1);
-  gfloat *array = (gfloat*) g_value_get_boxed (src);
-
-  crank_mat_float_n_init_arr (mf, 2, 2, array);
-  g_value_take_boxed (dest, mf);
-}
-
-static void
-crank_mat_float_n_transform_from_m3 (const GValue *src,
-                                     GValue       *dest)
-{
-  CrankMatFloatN *mf = g_new (CrankMatFloatN, 1);
-  gfloat *array = (gfloat*) g_value_get_boxed (src);
-
-  crank_mat_float_n_init_arr (mf, 3, 3, array);
-  g_value_take_boxed (dest, mf);
-}
+/**
+ * crank_mat_float_n_inverse_parallel:
+ * @a: A Matrix.
+ * @r: (out): A Matrix to store result.
+ * @n_threads: Number of threads, or 0 for number of processors.
+ *
+ * Gets an inverse of matrix, with given number of threads.
+ *
+ * After LU decomposition, each columns of inverse are solved by forward and
+ * backward substitution, which are independent to each other.
+ */
 
-static void
-crank_mat_float_n_transform_from_m4 (const GValue *src,
-                                     GValue       *dest)
-{
-  CrankMatFloatN *mf = g_new (CrankMatFloatN, 1);
-  gfloat *array = (gfloat*) g_value_get_boxed (src);
+/**
+ * crank_mat_float_n_mulv_parallel:
+ * @a: A Matrix.
+ * @b: A Vector.
+ * @r: (out): A Vector to store result.
+ * @n_threads: Number of threads, or 0 for number of processors.
+ *
+ * Multiplies a matrix by vector, with given number of threads.
+ */
 
-  crank_mat_float_n_init_arr (mf, 4, 4, array);
+/**
+ * crank_mat_float_n_mul_parallel:
+ * @a: A Matrix.
+ * @b: A Matrix.
+ * @r: (out): A Matrix to store result.
+ * @n_threads: Number of threads, or 0 for number of processors.
+ *
+ * Multiplies two matrices, with given number of threads. Rows of result are
+ * split across threads.
+ */
 
-  g_value_take_boxed (dest, mf);
-}
-static void
-crank_mat_float_n_transform_to_string (const GValue *src,
-                                       GValue       *dest)
-{
-  CrankMatFloatN *mf = (CrankMatFloatN*) g_value_get_boxed (src);
-  gchar *str = crank_mat_float_n_to_string (mf);
+/**
+ * crank_mat_float_n_add_parallel:
+ * @a: A Matrix
+ * @b: A Matrix
+ * @r: (out): A Matrix to store result.
+ * @n_threads: Number of threads, or 0 for number of processors.
+ *
+ * Adds a matrix, with given number of threads.
+ */
 
-  g_value_take_string (dest, str);
-}
+/**
+ * crank_mat_float_n_sub_parallel:
+ * @a: A Matrix
+ * @b: A Matrix
+ * @r: (out): A Matrix to store result.
+ * @n_threads: Number of threads, or 0 for number of processors.
+ *
+ * Subtracts a matrix, with given number of threads.
+ */
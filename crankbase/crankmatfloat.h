@@ -33,6 +33,7 @@
 #include "crankpermutation.h"
 #include "crankveccommon.h"
 #include "crankmatcommon.h"
+#include "crankmatarena.h"
 
 G_BEGIN_DECLS
 
@@ -739,10 +740,31 @@ void     crank_mat_float4_mix (CrankMatFloat4 *a,
                                CrankMatFloat4 *c,
                                CrankMatFloat4 *r);
 
+//////// Batch operations ////////
 
+void     crank_mat_float4_batch_mulv (const guint           n,
+                                      const CrankMatFloat4 *a,
+                                      const CrankVecFloat4 *b,
+                                      CrankVecFloat4       *r);
 
+void     crank_mat_float4_batch_mul (const guint           n,
+                                     const CrankMatFloat4 *a,
+                                     const CrankMatFloat4 *b,
+                                     CrankMatFloat4       *r);
 
+void     crank_mat_float4_batch_transform (const guint           n,
+                                           const CrankMatFloat4 *a,
+                                           const CrankVecFloat3 *b,
+                                           CrankVecFloat3       *r);
 
+void     crank_mat_float4_soa_transform (const guint           n,
+                                         const CrankMatFloat4 *a,
+                                         const gfloat         *x,
+                                         const gfloat         *y,
+                                         const gfloat         *z,
+                                         gfloat               *rx,
+                                         gfloat               *ry,
+                                         gfloat               *rz);
 
 /**
  * CrankMatFloatN:
@@ -777,6 +799,17 @@ void            crank_mat_float_n_init_arr_take (CrankMatFloatN *mat,
                                                  const guint     cn,
                                                  gfloat         *marr);
 
+void            crank_mat_float_n_init_arena (CrankMatFloatN *mat,
+                                              CrankMatArena  *arena,
+                                              const guint     rn,
+                                              const guint     cn);
+
+void            crank_mat_float_n_init_arr_arena (CrankMatFloatN *mat,
+                                                  CrankMatArena  *arena,
+                                                  const guint     rn,
+                                                  const guint     cn,
+                                                  const gfloat   *marr);
+
 void            crank_mat_float_n_init_row (CrankMatFloatN *mat,
                                             const guint     rn,
                                             ...);
@@ -948,6 +981,9 @@ void     crank_mat_float_n_transpose (CrankMatFloatN *a,
 
 void     crank_mat_float_n_transpose_self (CrankMatFloatN *a);
 
+void     crank_mat_float_n_transpose_self_arena (CrankMatFloatN *a,
+                                                 CrankMatArena  *arena);
+
 void     crank_mat_float_n_inverse (CrankMatFloatN *a,
                                     CrankMatFloatN *r);
 
@@ -958,6 +994,19 @@ gboolean crank_mat_float_n_try_inverse (CrankMatFloatN *a,
 
 gboolean crank_mat_float_n_try_inverse_self (CrankMatFloatN *a);
 
+gboolean crank_mat_float_n_try_inverse_self_arena (CrankMatFloatN *a,
+                                                   CrankMatArena  *arena);
+
+//////// Linear systems ////////
+
+gboolean crank_mat_float_n_solve (CrankMatFloatN *a,
+                                  CrankVecFloatN *b,
+                                  CrankVecFloatN *x);
+
+gboolean crank_mat_float_n_solve_multi (CrankMatFloatN *a,
+                                        CrankMatFloatN *b,
+                                        CrankMatFloatN *x);
+
 //////// Scalar operations ////////
 
 void     crank_mat_float_n_muls (CrankMatFloatN *a,
@@ -978,6 +1027,10 @@ void     crank_mat_float_n_mul (CrankMatFloatN *a,
 void     crank_mat_float_n_mul_self (CrankMatFloatN *a,
                                      CrankMatFloatN *b);
 
+void     crank_mat_float_n_mul_self_arena (CrankMatFloatN *a,
+                                           CrankMatFloatN *b,
+                                           CrankMatArena  *arena);
+
 void     crank_mat_float_n_divs (CrankMatFloatN *a,
                                  const gfloat    b,
                                  CrankMatFloatN *r);
@@ -1037,6 +1090,37 @@ void     crank_mat_float_n_mul_ul (CrankMatFloatN *u,
                                    CrankMatFloatN *l,
                                    CrankMatFloatN *r);
 
+
+//////// Parallel Operations ///////////////////////////////////////////////////
+
+void     crank_mat_float_n_transpose_parallel (CrankMatFloatN *a,
+                                               CrankMatFloatN *r,
+                                               const guint     n_threads);
+
+void     crank_mat_float_n_inverse_parallel (CrankMatFloatN *a,
+                                             CrankMatFloatN *r,
+                                             const guint     n_threads);
+
+void     crank_mat_float_n_mulv_parallel (CrankMatFloatN *a,
+                                          CrankVecFloatN *b,
+                                          CrankVecFloatN *r,
+                                          const guint     n_threads);
+
+void     crank_mat_float_n_mul_parallel (CrankMatFloatN *a,
+                                         CrankMatFloatN *b,
+                                         CrankMatFloatN *r,
+                                         const guint     n_threads);
+
+void     crank_mat_float_n_add_parallel (CrankMatFloatN *a,
+                                         CrankMatFloatN *b,
+                                         CrankMatFloatN *r,
+                                         const guint     n_threads);
+
+void     crank_mat_float_n_sub_parallel (CrankMatFloatN *a,
+                                         CrankMatFloatN *b,
+                                         CrankMatFloatN *r,
+                                         const guint     n_threads);
+
 //////// Macro variants ////////////////////////////////////////////////////////
 
 #define crank_mat_float_n_get(mat,ri,ci)    \
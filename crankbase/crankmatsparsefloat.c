@@ -0,0 +1,1394 @@
+/* Copyright (C) 2015, WSID   */
+
+/* Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#define _CRANKBASE_INSIDE
+
+#include <math.h>
+#include <string.h>
+
+#include <glib.h>
+#include <glib-object.h>
+
+#include "crankveccommon.h"
+#include "crankvecfloat.h"
+#include "crankmatcommon.h"
+#include "crankmatfloat.h"
+#include "crankmatsparsefloat.h"
+
+#include "crankparallel.h"
+#include "crankcpu-private.h"
+
+#ifdef CRANK_CPU_X86
+#include <immintrin.h>
+#endif
+
+/**
+ * SECTION: crankmatsparsefloat
+ * @title: Sparse Float Matrices
+ * @short_description: Sparse matrices and iterative solvers.
+ * @stability: unstable
+ * @include: crankbase.h
+ *
+ * Large linear models, like discretized differential equations or graphs, are
+ * mostly made of zeros. #CrankMatFloatN stores every elements, so it takes
+ * O(n<superscript>2</superscript>) memory, and multiplication takes
+ * O(n<superscript>2</superscript>) times.
+ *
+ * #CrankMatSparseFloat stores only non-zero elements, in compressed sparse row
+ * form. It takes memory and multiplication times proportional to count of
+ * non-zero elements.
+ *
+ * # Building
+ *
+ * Sparse matrices are usually built from list of (row, column, value)
+ * triplets by crank_mat_sparse_float_init_triplets(). Triplets may be given in
+ * any order, and duplicated positions are summed up.
+ *
+ * They can also be made from a dense matrix, or back to dense matrix.
+ *
+ * # Iterative Solvers
+ *
+ * Decompositions in #crankadvmat fill in zeros, so they are not suitable for
+ * large sparse matrices. Instead, iterative solvers are provided.
+ *
+ * <table><title>Iterative Solvers</title>
+ *   <tgroup cols="2" align="left" colsep="1" rowsep="0">
+ *     <thead>
+ *       <row>
+ *         <entry>Function</entry>
+ *         <entry>Requirements</entry>
+ *       </row>
+ *     </thead>
+ *     <tbody>
+ *       <row>
+ *         <entry>crank_mat_sparse_float_solve_cg()</entry>
+ *         <entry>Symmetric positive definite matrix.</entry>
+ *       </row>
+ *       <row>
+ *         <entry>crank_mat_sparse_float_solve_bicgstab()</entry>
+ *         <entry>Square matrix.</entry>
+ *       </row>
+ *     </tbody>
+ *   </tgroup>
+ * </table>
+ *
+ * Solvers converge faster with preconditioner. Jacobi preconditioner is cheap,
+ * and ILU(0) preconditioner costs more for each iteration, but usually
+ * converges in fewer iterations. ILU(0) requires all of diagonal components
+ * are stored.
+ */
+
+//////// Type Definition ///////////////////////////////////////////////////////
+
+G_DEFINE_BOXED_TYPE (CrankMatSparseFloat,
+                     crank_mat_sparse_float,
+                     crank_mat_sparse_float_dup,
+                     crank_mat_sparse_float_free)
+
+//////// Private Macros ////////////////////////////////////////////////////////
+
+// Minimum count of non-zero elements that a thread processes.
+#define CRANK_MAT_SPARSE_PARALLEL_GRAIN 16384
+
+// Marks no position, in ILU(0) factorization.
+#define CRANK_MAT_SPARSE_NONE G_MAXUINT
+
+// Iterations between replacing recurred residual with b - A x in solvers.
+#define CRANK_MAT_SPARSE_RESIDUAL_PERIOD 50
+
+
+//////// Private Types /////////////////////////////////////////////////////////
+
+/*
+ * Arguments for range functions. See crank_parallel_for().
+ */
+typedef struct _CrankMatSparseFloatRangeArgs {
+  CrankMatSparseFloat *a;
+  const gfloat        *b;
+  gfloat              *r;
+} CrankMatSparseFloatRangeArgs;
+
+/*
+ * An entry, used in sorting triplets.
+ */
+typedef struct _CrankMatSparseFloatEntry {
+  guint  col;
+  gfloat value;
+} CrankMatSparseFloatEntry;
+
+/*
+ * Preconditioner, which is applied as z = M^-1 r.
+ */
+typedef struct _CrankMatSparseFloatPrecond {
+  CrankSparsePrecond  type;
+  guint               n;
+  gfloat             *inv_diag;
+  CrankMatSparseFloat lu;
+  guint              *diag_index;
+} CrankMatSparseFloatPrecond;
+
+
+//////// Private Functions /////////////////////////////////////////////////////
+
+static gint crank_mat_sparse_float_entry_cmp (gconstpointer a,
+                                              gconstpointer b,
+                                              gpointer      userdata);
+
+static void crank_mat_sparse_float_mulv_range (const guint start,
+                                               const guint end,
+                                               gpointer    userdata);
+
+#ifdef CRANK_CPU_X86
+static void crank_mat_sparse_float_mulv_range_avx2 (const guint start,
+                                                    const guint end,
+                                                    gpointer    userdata);
+#endif
+
+static CrankParallelRangeFunc crank_mat_sparse_float_get_mulv_range (void);
+
+static void crank_mat_sparse_float_mulv_arr (CrankMatSparseFloat *a,
+                                             const gfloat        *b,
+                                             gfloat              *r,
+                                             const guint          n_threads);
+
+static gdouble crank_mat_sparse_float_dot (const guint   n,
+                                           const gfloat *a,
+                                           const gfloat *b);
+
+static gdouble crank_mat_sparse_float_residual (CrankMatSparseFloat *a,
+                                                const gfloat        *b,
+                                                const gfloat        *x,
+                                                gfloat              *r,
+                                                const guint          n_threads);
+
+static gboolean crank_mat_sparse_float_precond_init (CrankMatSparseFloatPrecond *pc,
+                                                     CrankMatSparseFloat        *a,
+                                                     const CrankSparsePrecond    type);
+
+static void crank_mat_sparse_float_precond_apply (CrankMatSparseFloatPrecond *pc,
+                                                  const gfloat               *r,
+                                                  gfloat                     *z);
+
+static void crank_mat_sparse_float_precond_fini (CrankMatSparseFloatPrecond *pc);
+
+
+//////// Initialization ////////////////////////////////////////////////////////
+
+/**
+ * crank_mat_sparse_float_init_triplets:
+ * @mat: (out): A Matrix to initialize.
+ * @rn: Row count.
+ * @cn: Column count.
+ * @n: Count of triplets.
+ * @rows: (array length=n): Row indices.
+ * @cols: (array length=n): Column indices.
+ * @values: (array length=n): Values.
+ *
+ * Initializes a sparse matrix from (row, column, value) triplets. Triplets
+ * may be given in any order, and values at same position are summed up.
+ */
+void
+crank_mat_sparse_float_init_triplets (CrankMatSparseFloat *mat,
+                                      const guint          rn,
+                                      const guint          cn,
+                                      const guint          n,
+                                      const guint         *rows,
+                                      const guint         *cols,
+                                      const gfloat        *values)
+{
+  CrankMatSparseFloatEntry *entries;
+  guint *fill;
+  guint i;
+  guint k;
+  guint nnz;
+
+  for (k = 0; k < n; k++)
+    {
+      if (G_UNLIKELY ((rn <= rows[k]) || (cn <= cols[k])))
+        {
+          g_warning ("MatSparseFloat: init_triplets: out of range: (%u, %u) in %ux%u",
+                     rows[k], cols[k], rn, cn);
+          rows = NULL;
+          break;
+        }
+    }
+
+  mat->rn = rn;
+  mat->cn = cn;
+  mat->row_ptr = g_new0 (guint, rn + 1);
+
+  if (rows == NULL)
+    {
+      mat->nnz = 0;
+      mat->col_index = NULL;
+      mat->data = NULL;
+      return;
+    }
+
+  // Buckets triplets by rows.
+  for (k = 0; k < n; k++)
+    mat->row_ptr[rows[k] + 1]++;
+
+  for (i = 0; i < rn; i++)
+    mat->row_ptr[i + 1] += mat->row_ptr[i];
+
+  entries = g_new (CrankMatSparseFloatEntry, n);
+  fill = g_memdup (mat->row_ptr, sizeof (guint) * rn);
+
+  for (k = 0; k < n; k++)
+    {
+      guint p = fill[rows[k]]++;
+
+      entries[p].col = cols[k];
+      entries[p].value = values[k];
+    }
+
+  g_free (fill);
+
+  // Sorts each rows and merges duplicated columns.
+  mat->col_index = g_new (guint, n);
+  mat->data = g_new (gfloat, n);
+
+  nnz = 0;
+  for (i = 0; i < rn; i++)
+    {
+      guint start = mat->row_ptr[i];
+      guint end = mat->row_ptr[i + 1];
+
+      g_qsort_with_data (entries + start, end - start,
+                         sizeof (CrankMatSparseFloatEntry),
+                         crank_mat_sparse_float_entry_cmp, NULL);
+
+      mat->row_ptr[i] = nnz;
+
+      for (k = start; k < end; k++)
+        {
+          if ((mat->row_ptr[i] < nnz) &&
+              (mat->col_index[nnz - 1] == entries[k].col))
+            {
+              mat->data[nnz - 1] += entries[k].value;
+            }
+          else
+            {
+              mat->col_index[nnz] = entries[k].col;
+              mat->data[nnz] = entries[k].value;
+              nnz++;
+            }
+        }
+    }
+  mat->row_ptr[rn] = nnz;
+  mat->nnz = nnz;
+
+  g_free (entries);
+
+  if (nnz < n)
+    {
+      mat->col_index = g_renew (guint, mat->col_index, nnz);
+      mat->data = g_renew (gfloat, mat->data, nnz);
+    }
+}
+
+/**
+ * crank_mat_sparse_float_init_dense:
+ * @mat: (out): A Matrix to initialize.
+ * @dense: A Dense matrix.
+ *
+ * Initializes a sparse matrix with non-zero elements of dense matrix.
+ */
+void
+crank_mat_sparse_float_init_dense (CrankMatSparseFloat *mat,
+                                   CrankMatFloatN      *dense)
+{
+  guint i;
+  guint j;
+  guint nnz = 0;
+
+  for (i = 0; i < dense->rn * dense->cn; i++)
+    if (dense->data[i] != 0)
+      nnz++;
+
+  mat->rn = dense->rn;
+  mat->cn = dense->cn;
+  mat->nnz = nnz;
+  mat->row_ptr = g_new (guint, dense->rn + 1);
+  mat->col_index = g_new (guint, nnz);
+  mat->data = g_new (gfloat, nnz);
+
+  nnz = 0;
+  for (i = 0; i < dense->rn; i++)
+    {
+      gfloat *drowi = crank_mat_float_n_get_rowp (dense, i);
+
+      mat->row_ptr[i] = nnz;
+
+      for (j = 0; j < dense->cn; j++)
+        {
+          if (drowi[j] != 0)
+            {
+              mat->col_index[nnz] = j;
+              mat->data[nnz] = drowi[j];
+              nnz++;
+            }
+        }
+    }
+  mat->row_ptr[dense->rn] = nnz;
+}
+
+/**
+ * crank_mat_sparse_float_init_diag:
+ * @mat: (out): A Matrix to initialize.
+ * @diag: Diagonal components.
+ *
+ * Initializes a square diagonal matrix. All of diagonal components are stored,
+ * even if they are zero.
+ */
+void
+crank_mat_sparse_float_init_diag (CrankMatSparseFloat *mat,
+                                  CrankVecFloatN      *diag)
+{
+  guint i;
+
+  mat->rn = diag->n;
+  mat->cn = diag->n;
+  mat->nnz = diag->n;
+  mat->row_ptr = g_new (guint, diag->n + 1);
+  mat->col_index = g_new (guint, diag->n);
+  mat->data = g_memdup (diag->data, sizeof (gfloat) * diag->n);
+
+  for (i = 0; i < diag->n; i++)
+    {
+      mat->row_ptr[i] = i;
+      mat->col_index[i] = i;
+    }
+  mat->row_ptr[diag->n] = diag->n;
+}
+
+/**
+ * crank_mat_sparse_float_init_identity:
+ * @mat: (out): A Matrix to initialize.
+ * @n: Size of matrix.
+ *
+ * Initializes an identity matrix.
+ */
+void
+crank_mat_sparse_float_init_identity (CrankMatSparseFloat *mat,
+                                      const guint          n)
+{
+  guint i;
+
+  mat->rn = n;
+  mat->cn = n;
+  mat->nnz = n;
+  mat->row_ptr = g_new (guint, n + 1);
+  mat->col_index = g_new (guint, n);
+  mat->data = g_new (gfloat, n);
+
+  for (i = 0; i < n; i++)
+    {
+      mat->row_ptr[i] = i;
+      mat->col_index[i] = i;
+      mat->data[i] = 1;
+    }
+  mat->row_ptr[n] = n;
+}
+
+/**
+ * crank_mat_sparse_float_copy:
+ * @mat: A Matrix.
+ * @other: (out): Another matrix.
+ *
+ * Copies a matrix to other matrix.
+ */
+void
+crank_mat_sparse_float_copy (CrankMatSparseFloat *mat,
+                             CrankMatSparseFloat *other)
+{
+  other->rn = mat->rn;
+  other->cn = mat->cn;
+  other->nnz = mat->nnz;
+  other->row_ptr = g_memdup (mat->row_ptr, sizeof (guint) * (mat->rn + 1));
+  other->col_index = g_memdup (mat->col_index, sizeof (guint) * mat->nnz);
+  other->data = g_memdup (mat->data, sizeof (gfloat) * mat->nnz);
+}
+
+/**
+ * crank_mat_sparse_float_dup:
+ * @mat: A Matrix.
+ *
+ * Allocates a matrix and copy on it.
+ *
+ * Returns: an allocated copy. Free it with crank_mat_sparse_float_free()
+ */
+CrankMatSparseFloat*
+crank_mat_sparse_float_dup (CrankMatSparseFloat *mat)
+{
+  CrankMatSparseFloat *result = g_new (CrankMatSparseFloat, 1);
+  crank_mat_sparse_float_copy (mat, result);
+  return result;
+}
+
+/**
+ * crank_mat_sparse_float_fini:
+ * @mat: A Matrix to reset.
+ *
+ * Resets a matrix and frees its associated memory blocks.
+ */
+void
+crank_mat_sparse_float_fini (CrankMatSparseFloat *mat)
+{
+  g_free (mat->row_ptr);
+  g_free (mat->col_index);
+  g_free (mat->data);
+
+  mat->rn = 0;
+  mat->cn = 0;
+  mat->nnz = 0;
+  mat->row_ptr = NULL;
+  mat->col_index = NULL;
+  mat->data = NULL;
+}
+
+/**
+ * crank_mat_sparse_float_free:
+ * @mat: A Matrix to free.
+ *
+ * Frees allocated matrix.
+ */
+void
+crank_mat_sparse_float_free (CrankMatSparseFloat *mat)
+{
+  crank_mat_sparse_float_fini (mat);
+  g_free (mat);
+}
+
+
+//////// Attributes ////////////////////////////////////////////////////////////
+
+/**
+ * crank_mat_sparse_float_get_row_size:
+ * @mat: A Matrix.
+ *
+ * Gets row count of matrix.
+ *
+ * Returns: Row count.
+ */
+guint
+crank_mat_sparse_float_get_row_size (CrankMatSparseFloat *mat)
+{
+  return mat->rn;
+}
+
+/**
+ * crank_mat_sparse_float_get_col_size:
+ * @mat: A Matrix.
+ *
+ * Gets column count of matrix.
+ *
+ * Returns: Column count.
+ */
+guint
+crank_mat_sparse_float_get_col_size (CrankMatSparseFloat *mat)
+{
+  return mat->cn;
+}
+
+/**
+ * crank_mat_sparse_float_get_nnz:
+ * @mat: A Matrix.
+ *
+ * Gets count of stored elements. Stored elements may be zero, if they are
+ * given so explicitly.
+ *
+ * Returns: Count of stored elements.
+ */
+guint
+crank_mat_sparse_float_get_nnz (CrankMatSparseFloat *mat)
+{
+  return mat->nnz;
+}
+
+/**
+ * crank_mat_sparse_float_is_square:
+ * @mat: A Matrix.
+ *
+ * Checks whether the matrix is square.
+ *
+ * Returns: Whether the matrix is square.
+ */
+gboolean
+crank_mat_sparse_float_is_square (CrankMatSparseFloat *mat)
+{
+  return mat->rn == mat->cn;
+}
+
+/**
+ * crank_mat_sparse_float_get:
+ * @mat: A Matrix.
+ * @i: Row index.
+ * @j: Column index.
+ *
+ * Gets an element of matrix. Elements in a row are binary searched.
+ *
+ * Returns: Element at (@i, @j), or 0 if it is not stored.
+ */
+gfloat
+crank_mat_sparse_float_get (CrankMatSparseFloat *mat,
+                            const guint          i,
+                            const guint          j)
+{
+  guint lo;
+  guint hi;
+
+  g_return_val_if_fail (i < mat->rn, 0);
+  g_return_val_if_fail (j < mat->cn, 0);
+
+  lo = mat->row_ptr[i];
+  hi = mat->row_ptr[i + 1];
+
+  while (lo < hi)
+    {
+      guint mid = lo + (hi - lo) / 2;
+
+      if (mat->col_index[mid] < j)
+        lo = mid + 1;
+      else
+        hi = mid;
+    }
+
+  if ((lo < mat->row_ptr[i + 1]) && (mat->col_index[lo] == j))
+    return mat->data[lo];
+
+  return 0;
+}
+
+/**
+ * crank_mat_sparse_float_get_diag:
+ * @mat: A Matrix.
+ * @r: (out): A Vector to store diagonal components.
+ *
+ * Gets diagonal components of matrix.
+ */
+void
+crank_mat_sparse_float_get_diag (CrankMatSparseFloat *mat,
+                                 CrankVecFloatN      *r)
+{
+  guint n = MIN (mat->rn, mat->cn);
+  guint i;
+
+  CRANK_VEC_ALLOC0_ALIGNED (r, gfloat, n);
+
+  for (i = 0; i < n; i++)
+    {
+      guint k;
+
+      for (k = mat->row_ptr[i]; k < mat->row_ptr[i + 1]; k++)
+        {
+          if (mat->col_index[k] >= i)
+            {
+              if (mat->col_index[k] == i)
+                r->data[i] = mat->data[k];
+              break;
+            }
+        }
+    }
+}
+
+/**
+ * crank_mat_sparse_float_to_dense:
+ * @mat: A Matrix.
+ * @r: (out): A Dense matrix.
+ *
+ * Converts a sparse matrix to dense matrix.
+ */
+void
+crank_mat_sparse_float_to_dense (CrankMatSparseFloat *mat,
+                                 CrankMatFloatN      *r)
+{
+  guint i;
+  guint k;
+
+  CRANK_MAT_ALLOC0 (r, gfloat, mat->rn, mat->cn);
+
+  for (i = 0; i < mat->rn; i++)
+    {
+      gfloat *rrowi = crank_mat_float_n_get_rowp (r, i);
+
+      for (k = mat->row_ptr[i]; k < mat->row_ptr[i + 1]; k++)
+        rrowi[mat->col_index[k]] = mat->data[k];
+    }
+}
+
+
+//////// Operations ////////////////////////////////////////////////////////////
+
+/**
+ * crank_mat_sparse_float_transpose:
+ * @a: A Matrix.
+ * @r: (out): A Matrix to store result.
+ *
+ * Gets transpose of matrix. As result is CSR form of transpose, this also
+ * serves as conversion to compressed sparse column form.
+ */
+void
+crank_mat_sparse_float_transpose (CrankMatSparseFloat *a,
+                                  CrankMatSparseFloat *r)
+{
+  guint *fill;
+  guint i;
+  guint k;
+
+  g_return_if_fail (a != r);
+
+  r->rn = a->cn;
+  r->cn = a->rn;
+  r->nnz = a->nnz;
+  r->row_ptr = g_new0 (guint, a->cn + 1);
+  r->col_index = g_new (guint, a->nnz);
+  r->data = g_new (gfloat, a->nnz);
+
+  for (k = 0; k < a->nnz; k++)
+    r->row_ptr[a->col_index[k] + 1]++;
+
+  for (i = 0; i < a->cn; i++)
+    r->row_ptr[i + 1] += r->row_ptr[i];
+
+  fill = g_memdup (r->row_ptr, sizeof (guint) * a->cn);
+
+  // Rows of a are visited in order, so columns of r are kept sorted.
+  for (i = 0; i < a->rn; i++)
+    {
+      for (k = a->row_ptr[i]; k < a->row_ptr[i + 1]; k++)
+        {
+          guint p = fill[a->col_index[k]]++;
+
+          r->col_index[p] = i;
+          r->data[p] = a->data[k];
+        }
+    }
+
+  g_free (fill);
+}
+
+/**
+ * crank_mat_sparse_float_muls_self:
+ * @a: A Matrix.
+ * @b: A Scalar.
+ *
+ * Multiplies all of stored elements by a scalar.
+ */
+void
+crank_mat_sparse_float_muls_self (CrankMatSparseFloat *a,
+                                  const gfloat         b)
+{
+  guint k;
+
+  for (k = 0; k < a->nnz; k++)
+    a->data[k] *= b;
+}
+
+/**
+ * crank_mat_sparse_float_mulv:
+ * @a: A Matrix.
+ * @b: A Vector.
+ * @r: (out): A Vector to store result.
+ *
+ * Multiplies a matrix by vector. This uses number of threads from
+ * crank_parallel_get_n_threads().
+ */
+void
+crank_mat_sparse_float_mulv (CrankMatSparseFloat *a,
+                             CrankVecFloatN      *b,
+                             CrankVecFloatN      *r)
+{
+  crank_mat_sparse_float_mulv_parallel (a, b, r,
+                                        crank_parallel_get_n_threads ());
+}
+
+/**
+ * crank_mat_sparse_float_mulv_parallel:
+ * @a: A Matrix.
+ * @b: A Vector.
+ * @r: (out): A Vector to store result.
+ * @n_threads: Number of threads, or 0 for number of processors.
+ *
+ * Multiplies a matrix by vector, with given number of threads. Rows are split
+ * across threads, by count of stored elements.
+ */
+void
+crank_mat_sparse_float_mulv_parallel (CrankMatSparseFloat *a,
+                                      CrankVecFloatN      *b,
+                                      CrankVecFloatN      *r,
+                                      const guint          n_threads)
+{
+  g_return_if_fail (b != r);
+  g_return_if_fail (a->cn == b->n);
+
+  CRANK_VEC_ALLOC_ALIGNED (r, gfloat, a->rn);
+
+  crank_mat_sparse_float_mulv_arr (a, b->data, r->data, n_threads);
+}
+
+
+//////// Iterative Solvers /////////////////////////////////////////////////////
+
+/**
+ * crank_mat_sparse_float_solve_cg:
+ * @a: A Symmetric positive definite matrix.
+ * @b: Right hand side.
+ * @x: (out): A Vector to store solution.
+ * @precond: Preconditioner.
+ * @tolerance: Relative residual, ||b - A x|| / ||b||, to stop at.
+ * @max_iter: Maximum number of iterations.
+ * @iterations: (out) (optional): Number of iterations done.
+ *
+ * Solves A x = b with preconditioned conjugate gradient method, starting from
+ * x = 0.
+ *
+ * Recurred residual drifts from b - A x in single precision, so it is
+ * replaced with b - A x periodically. Convergence is reported only if
+ * b - A x meets @tolerance. Otherwise, the solver restarts from current @x.
+ *
+ * @x is always initialized, even if the solver does not converge.
+ *
+ * Returns: Whether the solver converged in @max_iter iterations.
+ */
+gboolean
+crank_mat_sparse_float_solve_cg (CrankMatSparseFloat     *a,
+                                 CrankVecFloatN          *b,
+                                 CrankVecFloatN          *x,
+                                 const CrankSparsePrecond precond,
+                                 const gfloat             tolerance,
+                                 const guint              max_iter,
+                                 guint                   *iterations)
+{
+  CrankMatSparseFloatPrecond pc;
+  guint n_threads;
+  guint n;
+  guint i;
+  guint it;
+  gboolean converged = FALSE;
+
+  gfloat *r;
+  gfloat *z;
+  gfloat *p;
+  gfloat *q;
+  gdouble rz;
+  gdouble limit;
+
+  if (iterations != NULL)
+    *iterations = 0;
+
+  CRANK_MAT_WARN_IF_NON_SQUARE_RET ("MatSparseFloat", "solve_cg", a, FALSE);
+  g_return_val_if_fail (a->cn == b->n, FALSE);
+
+  n = a->rn;
+  CRANK_VEC_ALLOC0_ALIGNED (x, gfloat, n);
+
+  limit = tolerance * sqrt (crank_mat_sparse_float_dot (n, b->data, b->data));
+  if (limit == 0)
+    return TRUE;
+
+  if (! crank_mat_sparse_float_precond_init (&pc, a, precond))
+    return FALSE;
+
+  n_threads = crank_parallel_get_n_threads ();
+
+  r = g_memdup (b->data, sizeof (gfloat) * n);
+  z = g_new (gfloat, n);
+  p = g_new (gfloat, n);
+  q = g_new (gfloat, n);
+
+  crank_mat_sparse_float_precond_apply (&pc, r, z);
+  memcpy (p, z, sizeof (gfloat) * n);
+  rz = crank_mat_sparse_float_dot (n, r, z);
+
+  for (it = 0; it < max_iter; it++)
+    {
+      gdouble pq;
+      gdouble rz_next;
+      gfloat alpha;
+      gfloat beta;
+
+      crank_mat_sparse_float_mulv_arr (a, p, q, n_threads);
+
+      pq = crank_mat_sparse_float_dot (n, p, q);
+      if (pq == 0)
+        break;
+
+      alpha = rz / pq;
+      if (! isfinite (alpha))
+        break;
+
+      for (i = 0; i < n; i++)
+        {
+          x->data[i] += alpha * p[i];
+          r[i] -= alpha * q[i];
+        }
+
+      if (sqrt (crank_mat_sparse_float_dot (n, r, r)) <= limit)
+        {
+          if (crank_mat_sparse_float_residual (a, b->data, x->data, r,
+                                               n_threads) <= limit)
+            {
+              it++;
+              converged = TRUE;
+              break;
+            }
+
+          // Recurred residual has drifted. Restarts from current x.
+          crank_mat_sparse_float_precond_apply (&pc, r, z);
+          memcpy (p, z, sizeof (gfloat) * n);
+          rz = crank_mat_sparse_float_dot (n, r, z);
+          continue;
+        }
+
+      if (((it + 1) % CRANK_MAT_SPARSE_RESIDUAL_PERIOD) == 0)
+        crank_mat_sparse_float_residual (a, b->data, x->data, r, n_threads);
+
+      crank_mat_sparse_float_precond_apply (&pc, r, z);
+      rz_next = crank_mat_sparse_float_dot (n, r, z);
+      if (rz == 0)
+        break;
+
+      beta = rz_next / rz;
+      if (! isfinite (beta))
+        break;
+
+      rz = rz_next;
+
+      for (i = 0; i < n; i++)
+        p[i] = z[i] + beta * p[i];
+    }
+
+  if (iterations != NULL)
+    *iterations = it;
+
+  g_free (r);
+  g_free (z);
+  g_free (p);
+  g_free (q);
+  crank_mat_sparse_float_precond_fini (&pc);
+
+  return converged;
+}
+
+/**
+ * crank_mat_sparse_float_solve_bicgstab:
+ * @a: A Square matrix.
+ * @b: Right hand side.
+ * @x: (out): A Vector to store solution.
+ * @precond: Preconditioner.
+ * @tolerance: Relative residual, ||b - A x|| / ||b||, to stop at.
+ * @max_iter: Maximum number of iterations.
+ * @iterations: (out) (optional): Number of iterations done.
+ *
+ * Solves A x = b with right-preconditioned biconjugate gradient stabilized
+ * method, starting from x = 0. Unlike crank_mat_sparse_float_solve_cg(), this
+ * works on non-symmetric matrices.
+ *
+ * As crank_mat_sparse_float_solve_cg() does, convergence is checked with
+ * b - A x. The solver stops without convergence on breakdown.
+ *
+ * @x is always initialized, even if the solver does not converge.
+ *
+ * Returns: Whether the solver converged in @max_iter iterations.
+ */
+gboolean
+crank_mat_sparse_float_solve_bicgstab (CrankMatSparseFloat     *a,
+                                       CrankVecFloatN          *b,
+                                       CrankVecFloatN          *x,
+                                       const CrankSparsePrecond precond,
+                                       const gfloat             tolerance,
+                                       const guint              max_iter,
+                                       guint                   *iterations)
+{
+  CrankMatSparseFloatPrecond pc;
+  guint n_threads;
+  guint n;
+  guint i;
+  guint it;
+  gboolean converged = FALSE;
+
+  gfloat *r;
+  gfloat *r0;
+  gfloat *p;
+  gfloat *v;
+  gfloat *s;
+  gfloat *t;
+  gfloat *ph;
+  gfloat *sh;
+  gdouble rho = 1;
+  gdouble alpha = 1;
+  gdouble omega = 1;
+  gdouble limit;
+
+  if (iterations != NULL)
+    *iterations = 0;
+
+  CRANK_MAT_WARN_IF_NON_SQUARE_RET ("MatSparseFloat", "solve_bicgstab", a, FALSE);
+  g_return_val_if_fail (a->cn == b->n, FALSE);
+
+  n = a->rn;
+  CRANK_VEC_ALLOC0_ALIGNED (x, gfloat, n);
+
+  limit = tolerance * sqrt (crank_mat_sparse_float_dot (n, b->data, b->data));
+  if (limit == 0)
+    return TRUE;
+
+  if (! crank_mat_sparse_float_precond_init (&pc, a, precond))
+    return FALSE;
+
+  n_threads = crank_parallel_get_n_threads ();
+
+  r = g_memdup (b->data, sizeof (gfloat) * n);
+  r0 = g_memdup (b->data, sizeof (gfloat) * n);
+  p = g_new0 (gfloat, n);
+  v = g_new0 (gfloat, n);
+  s = g_new (gfloat, n);
+  t = g_new (gfloat, n);
+  ph = g_new (gfloat, n);
+  sh = g_new (gfloat, n);
+
+  for (it = 0; it < max_iter; it++)
+    {
+      gdouble rho_next;
+      gdouble r0v;
+      gdouble tt;
+      gdouble beta;
+
+      rho_next = crank_mat_sparse_float_dot (n, r0, r);
+      if (rho_next == 0)
+        break;
+
+      beta = (rho_next / rho) * (alpha / omega);
+      if (! isfinite (beta))
+        break;
+
+      rho = rho_next;
+
+      for (i = 0; i < n; i++)
+        p[i] = r[i] + beta * (p[i] - omega * v[i]);
+
+      crank_mat_sparse_float_precond_apply (&pc, p, ph);
+      crank_mat_sparse_float_mulv_arr (a, ph, v, n_threads);
+
+      r0v = crank_mat_sparse_float_dot (n, r0, v);
+      if (r0v == 0)
+        break;
+
+      alpha = rho / r0v;
+      if (! isfinite (alpha))
+        break;
+
+      for (i = 0; i < n; i++)
+        s[i] = r[i] - alpha * v[i];
+
+      if (sqrt (crank_mat_sparse_float_dot (n, s, s)) <= limit)
+        {
+          for (i = 0; i < n; i++)
+            x->data[i] += alpha * ph[i];
+
+          if (crank_mat_sparse_float_residual (a, b->data, x->data, r,
+                                               n_threads) <= limit)
+            {
+              it++;
+              converged = TRUE;
+              break;
+            }
+
+          // Recurred residual has drifted. Restarts from current x.
+          memcpy (r0, r, sizeof (gfloat) * n);
+          memset (p, 0, sizeof (gfloat) * n);
+          memset (v, 0, sizeof (gfloat) * n);
+          rho = alpha = omega = 1;
+          continue;
+        }
+
+      crank_mat_sparse_float_precond_apply (&pc, s, sh);
+      crank_mat_sparse_float_mulv_arr (a, sh, t, n_threads);
+
+      tt = crank_mat_sparse_float_dot (n, t, t);
+      omega = (tt != 0) ? crank_mat_sparse_float_dot (n, t, s) / tt : 0;
+      if (! isfinite (omega))
+        break;
+
+      for (i = 0; i < n; i++)
+        {
+          x->data[i] += alpha * ph[i] + omega * sh[i];
+          r[i] = s[i] - omega * t[i];
+        }
+
+      if (sqrt (crank_mat_sparse_float_dot (n, r, r)) <= limit)
+        {
+          if (crank_mat_sparse_float_residual (a, b->data, x->data, r,
+                                               n_threads) <= limit)
+            {
+              it++;
+              converged = TRUE;
+              break;
+            }
+
+          // Recurred residual has drifted. Restarts from current x.
+          memcpy (r0, r, sizeof (gfloat) * n);
+          memset (p, 0, sizeof (gfloat) * n);
+          memset (v, 0, sizeof (gfloat) * n);
+          rho = alpha = omega = 1;
+          continue;
+        }
+
+      if (omega == 0)
+        break;
+
+      if (((it + 1) % CRANK_MAT_SPARSE_RESIDUAL_PERIOD) == 0)
+        crank_mat_sparse_float_residual (a, b->data, x->data, r, n_threads);
+    }
+
+  if (iterations != NULL)
+    *iterations = it;
+
+  g_free (r);
+  g_free (r0);
+  g_free (p);
+  g_free (v);
+  g_free (s);
+  g_free (t);
+  g_free (ph);
+  g_free (sh);
+  crank_mat_sparse_float_precond_fini (&pc);
+
+  return converged;
+}
+
+
+//////// Private Functions /////////////////////////////////////////////////////
+
+static gint
+crank_mat_sparse_float_entry_cmp (gconstpointer a,
+                                  gconstpointer b,
+                                  gpointer      userdata)
+{
+  guint ca = ((const CrankMatSparseFloatEntry*) a)->col;
+  guint cb = ((const CrankMatSparseFloatEntry*) b)->col;
+
+  return (ca < cb) ? -1 : (ca > cb);
+}
+
+static void
+crank_mat_sparse_float_mulv_range (const guint start,
+                                   const guint end,
+                                   gpointer    userdata)
+{
+  CrankMatSparseFloatRangeArgs *args = (CrankMatSparseFloatRangeArgs*) userdata;
+  CrankMatSparseFloat *a = args->a;
+
+  guint i;
+  guint k;
+
+  for (i = start; i < end; i++)
+    {
+      gfloat sum = 0;
+
+      for (k = a->row_ptr[i]; k < a->row_ptr[i + 1]; k++)
+        sum += a->data[k] * args->b[a->col_index[k]];
+
+      args->r[i] = sum;
+    }
+}
+
+#ifdef CRANK_CPU_X86
+
+// Gathers 8 elements of vector at once.
+__attribute__((target ("avx2,fma")))
+static void
+crank_mat_sparse_float_mulv_range_avx2 (const guint start,
+                                        const guint end,
+                                        gpointer    userdata)
+{
+  CrankMatSparseFloatRangeArgs *args = (CrankMatSparseFloatRangeArgs*) userdata;
+  CrankMatSparseFloat *a = args->a;
+
+  guint i;
+
+  for (i = start; i < end; i++)
+    {
+      guint k = a->row_ptr[i];
+      guint ke = a->row_ptr[i + 1];
+      __m256 acc = _mm256_setzero_ps ();
+      __m128 sum4;
+      gfloat sum;
+
+      for (; k + 8 <= ke; k += 8)
+        {
+          __m256i idx = _mm256_loadu_si256 ((const __m256i*) (a->col_index + k));
+          __m256 bv = _mm256_i32gather_ps (args->b, idx, 4);
+
+          acc = _mm256_fmadd_ps (_mm256_loadu_ps (a->data + k), bv, acc);
+        }
+
+      sum4 = _mm_add_ps (_mm256_castps256_ps128 (acc),
+                         _mm256_extractf128_ps (acc, 1));
+      sum4 = _mm_hadd_ps (sum4, sum4);
+      sum4 = _mm_hadd_ps (sum4, sum4);
+      sum = _mm_cvtss_f32 (sum4);
+
+      for (; k < ke; k++)
+        sum += a->data[k] * args->b[a->col_index[k]];
+
+      args->r[i] = sum;
+    }
+}
+
+#endif
+
+static CrankParallelRangeFunc
+crank_mat_sparse_float_get_mulv_range (void)
+{
+  static gsize func = 0;
+
+  if (g_once_init_enter (&func))
+    {
+      CrankParallelRangeFunc selected = crank_mat_sparse_float_mulv_range;
+
+#ifdef CRANK_CPU_X86
+      if (CRANK_CPU_SIMD_AVX2 <= _crank_cpu_get_simd_level ())
+        selected = crank_mat_sparse_float_mulv_range_avx2;
+#endif
+
+      g_once_init_leave (&func, (gsize) selected);
+    }
+
+  return (CrankParallelRangeFunc) func;
+}
+
+static void
+crank_mat_sparse_float_mulv_arr (CrankMatSparseFloat *a,
+                                 const gfloat        *b,
+                                 gfloat              *r,
+                                 const guint          n_threads)
+{
+  CrankMatSparseFloatRangeArgs args = {a, b, r};
+  guint row_cost = (a->rn != 0) ? (a->nnz / a->rn) : 0;
+
+  crank_parallel_for (n_threads, 0, a->rn,
+                      MAX (1, CRANK_MAT_SPARSE_PARALLEL_GRAIN / MAX (row_cost, 1)),
+                      crank_mat_sparse_float_get_mulv_range (),
+                      &args);
+}
+
+static gdouble
+crank_mat_sparse_float_dot (const guint   n,
+                            const gfloat *a,
+                            const gfloat *b)
+{
+  gdouble sum = 0;
+  guint i;
+
+  for (i = 0; i < n; i++)
+    sum += (gdouble) a[i] * b[i];
+
+  return sum;
+}
+
+/*
+ * Computes r = b - A x, and returns norm of it.
+ */
+static gdouble
+crank_mat_sparse_float_residual (CrankMatSparseFloat *a,
+                                 const gfloat        *b,
+                                 const gfloat        *x,
+                                 gfloat              *r,
+                                 const guint          n_threads)
+{
+  guint i;
+
+  crank_mat_sparse_float_mulv_arr (a, x, r, n_threads);
+
+  for (i = 0; i < a->rn; i++)
+    r[i] = b[i] - r[i];
+
+  return sqrt (crank_mat_sparse_float_dot (a->rn, r, r));
+}
+
+static gboolean
+crank_mat_sparse_float_precond_init (CrankMatSparseFloatPrecond *pc,
+                                     CrankMatSparseFloat        *a,
+                                     const CrankSparsePrecond    type)
+{
+  CrankMatSparseFloat *lu;
+  guint *marker;
+  guint n = a->rn;
+  guint i;
+  guint k;
+
+  memset (pc, 0, sizeof (CrankMatSparseFloatPrecond));
+  pc->type = type;
+  pc->n = n;
+
+  switch (type)
+    {
+    case CRANK_SPARSE_PRECOND_NONE:
+      return TRUE;
+
+    case CRANK_SPARSE_PRECOND_JACOBI:
+      pc->inv_diag = g_new (gfloat, n);
+
+      for (i = 0; i < n; i++)
+        {
+          gfloat d = crank_mat_sparse_float_get (a, i, i);
+          pc->inv_diag[i] = (d != 0) ? (1 / d) : 1;
+        }
+      return TRUE;
+
+    case CRANK_SPARSE_PRECOND_ILU0:
+      break;
+
+    default:
+      g_warning ("MatSparseFloat: Unknown preconditioner: %d", (gint) type);
+      return FALSE;
+    }
+
+  // ILU(0): Keeps pattern of a. L has unit diagonal.
+  lu = &pc->lu;
+  crank_mat_sparse_float_copy (a, lu);
+  pc->diag_index = g_new (guint, n);
+
+  for (i = 0; i < n; i++)
+    {
+      pc->diag_index[i] = CRANK_MAT_SPARSE_NONE;
+
+      for (k = lu->row_ptr[i]; k < lu->row_ptr[i + 1]; k++)
+        {
+          if (lu->col_index[k] == i)
+            {
+              pc->diag_index[i] = k;
+              break;
+            }
+        }
+
+      if (pc->diag_index[i] == CRANK_MAT_SPARSE_NONE)
+        {
+          g_warning ("MatSparseFloat: ILU(0): missing diagonal at %u", i);
+          crank_mat_sparse_float_precond_fini (pc);
+          return FALSE;
+        }
+    }
+
+  marker = g_new (guint, n);
+  for (i = 0; i < n; i++)
+    marker[i] = CRANK_MAT_SPARSE_NONE;
+
+  for (i = 0; i < n; i++)
+    {
+      for (k = lu->row_ptr[i]; k < lu->row_ptr[i + 1]; k++)
+        marker[lu->col_index[k]] = k;
+
+      for (k = lu->row_ptr[i]; k < pc->diag_index[i]; k++)
+        {
+          guint c = lu->col_index[k];
+          guint kk;
+          gfloat m;
+
+          m = (lu->data[k] /= lu->data[pc->diag_index[c]]);
+
+          for (kk = pc->diag_index[c] + 1; kk < lu->row_ptr[c + 1]; kk++)
+            {
+              guint pos = marker[lu->col_index[kk]];
+
+              if (pos != CRANK_MAT_SPARSE_NONE)
+                lu->data[pos] -= m * lu->data[kk];
+            }
+        }
+
+      for (k = lu->row_ptr[i]; k < lu->row_ptr[i + 1]; k++)
+        marker[lu->col_index[k]] = CRANK_MAT_SPARSE_NONE;
+
+      if (lu->data[pc->diag_index[i]] == 0)
+        {
+          g_warning ("MatSparseFloat: ILU(0): zero pivot at %u", i);
+          g_free (marker);
+          crank_mat_sparse_float_precond_fini (pc);
+          return FALSE;
+        }
+    }
+
+  g_free (marker);
+  return TRUE;
+}
+
+static void
+crank_mat_sparse_float_precond_apply (CrankMatSparseFloatPrecond *pc,
+                                      const gfloat               *r,
+                                      gfloat                     *z)
+{
+  CrankMatSparseFloat *lu = &pc->lu;
+  guint n = pc->n;
+  guint i;
+  guint k;
+
+  switch (pc->type)
+    {
+    case CRANK_SPARSE_PRECOND_JACOBI:
+      for (i = 0; i < n; i++)
+        z[i] = pc->inv_diag[i] * r[i];
+      break;
+
+    case CRANK_SPARSE_PRECOND_ILU0:
+      // Forward substitution with unit L.
+      for (i = 0; i < n; i++)
+        {
+          gfloat sum = r[i];
+
+          for (k = lu->row_ptr[i]; k < pc->diag_index[i]; k++)
+            sum -= lu->data[k] * z[lu->col_index[k]];
+
+          z[i] = sum;
+        }
+
+      // Backward substitution with U.
+      for (i = n; 0 < i--;)
+        {
+          gfloat sum = z[i];
+
+          for (k = pc->diag_index[i] + 1; k < lu->row_ptr[i + 1]; k++)
+            sum -= lu->data[k] * z[lu->col_index[k]];
+
+          z[i] = sum / lu->data[pc->diag_index[i]];
+        }
+      break;
+
+    default:
+      memcpy (z, r, sizeof (gfloat) * n);
+      break;
+    }
+}
+
+static void
+crank_mat_sparse_float_precond_fini (CrankMatSparseFloatPrecond *pc)
+{
+  g_free (pc->inv_diag);
+  g_free (pc->diag_index);
+
+  if (pc->type == CRANK_SPARSE_PRECOND_ILU0)
+    crank_mat_sparse_float_fini (&pc->lu);
+
+  pc->inv_diag = NULL;
+  pc->diag_index = NULL;
+}
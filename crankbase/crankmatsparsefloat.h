@@ -0,0 +1,168 @@
+#ifndef CRANKMATSPARSEFLOAT_H
+#define CRANKMATSPARSEFLOAT_H
+
+/* Copyright (C) 2015, WSID   */
+
+/* Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef _CRANKBASE_INSIDE
+#error crankmatsparsefloat.h cannot be included directly.
+#endif
+
+#include <glib.h>
+#include <glib-object.h>
+
+#include "crankveccommon.h"
+#include "crankvecfloat.h"
+#include "crankmatfloat.h"
+
+G_BEGIN_DECLS
+
+//////// Type Definition ///////////////////////////////////////////////////////
+
+#define CRANK_TYPE_MAT_SPARSE_FLOAT (crank_mat_sparse_float_get_type ())
+GType crank_mat_sparse_float_get_type (void);
+
+/**
+ * CrankMatSparseFloat:
+ * @rn: Row count.
+ * @cn: Column count.
+ * @nnz: Count of stored elements.
+ * @row_ptr: (array): Start of each row in @col_index and @data. It has @rn + 1
+ *           items, and the last one is @nnz.
+ * @col_index: (array length=nnz): Column index of each stored elements. They
+ *             are sorted in each row.
+ * @data: (array length=nnz): Stored elements.
+ *
+ * Represents a sparse matrix, in compressed sparse row (CSR) form.
+ */
+typedef struct _CrankMatSparseFloat {
+  guint   rn;
+  guint   cn;
+  guint   nnz;
+  guint  *row_ptr;
+  guint  *col_index;
+  gfloat *data;
+} CrankMatSparseFloat;
+
+/**
+ * CrankSparsePrecond:
+ * @CRANK_SPARSE_PRECOND_NONE: No preconditioner.
+ * @CRANK_SPARSE_PRECOND_JACOBI: Jacobi (diagonal) preconditioner.
+ * @CRANK_SPARSE_PRECOND_ILU0: Incomplete LU factorization, with no fill-in.
+ *
+ * Preconditioners for iterative solvers.
+ */
+typedef enum _CrankSparsePrecond {
+  CRANK_SPARSE_PRECOND_NONE,
+  CRANK_SPARSE_PRECOND_JACOBI,
+  CRANK_SPARSE_PRECOND_ILU0
+} CrankSparsePrecond;
+
+
+//////// Initialization ////////////////////////////////////////////////////////
+
+void      crank_mat_sparse_float_init_triplets (CrankMatSparseFloat *mat,
+                                                const guint          rn,
+                                                const guint          cn,
+                                                const guint          n,
+                                                const guint         *rows,
+                                                const guint         *cols,
+                                                const gfloat        *values);
+
+void      crank_mat_sparse_float_init_dense    (CrankMatSparseFloat *mat,
+                                                CrankMatFloatN      *dense);
+
+void      crank_mat_sparse_float_init_diag     (CrankMatSparseFloat *mat,
+                                                CrankVecFloatN      *diag);
+
+void      crank_mat_sparse_float_init_identity (CrankMatSparseFloat *mat,
+                                                const guint          n);
+
+void      crank_mat_sparse_float_copy          (CrankMatSparseFloat *mat,
+                                                CrankMatSparseFloat *other);
+
+CrankMatSparseFloat *crank_mat_sparse_float_dup (CrankMatSparseFloat *mat);
+
+void      crank_mat_sparse_float_fini          (CrankMatSparseFloat *mat);
+
+void      crank_mat_sparse_float_free          (CrankMatSparseFloat *mat);
+
+
+//////// Attributes ////////////////////////////////////////////////////////////
+
+guint     crank_mat_sparse_float_get_row_size  (CrankMatSparseFloat *mat);
+
+guint     crank_mat_sparse_float_get_col_size  (CrankMatSparseFloat *mat);
+
+guint     crank_mat_sparse_float_get_nnz       (CrankMatSparseFloat *mat);
+
+gboolean  crank_mat_sparse_float_is_square     (CrankMatSparseFloat *mat);
+
+gfloat    crank_mat_sparse_float_get           (CrankMatSparseFloat *mat,
+                                                const guint          i,
+                                                const guint          j);
+
+void      crank_mat_sparse_float_get_diag      (CrankMatSparseFloat *mat,
+                                                CrankVecFloatN      *r);
+
+void      crank_mat_sparse_float_to_dense      (CrankMatSparseFloat *mat,
+                                                CrankMatFloatN      *r);
+
+
+//////// Operations ////////////////////////////////////////////////////////////
+
+void      crank_mat_sparse_float_transpose     (CrankMatSparseFloat *a,
+                                                CrankMatSparseFloat *r);
+
+void      crank_mat_sparse_float_muls_self     (CrankMatSparseFloat *a,
+                                                const gfloat         b);
+
+void      crank_mat_sparse_float_mulv          (CrankMatSparseFloat *a,
+                                                CrankVecFloatN      *b,
+                                                CrankVecFloatN      *r);
+
+void      crank_mat_sparse_float_mulv_parallel (CrankMatSparseFloat *a,
+                                                CrankVecFloatN      *b,
+                                                CrankVecFloatN      *r,
+                                                const guint          n_threads);
+
+
+//////// Iterative Solvers /////////////////////////////////////////////////////
+
+gboolean  crank_mat_sparse_float_solve_cg      (CrankMatSparseFloat *a,
+                                                CrankVecFloatN      *b,
+                                                CrankVecFloatN      *x,
+                                                const CrankSparsePrecond precond,
+                                                const gfloat         tolerance,
+                                                const guint          max_iter,
+                                                guint               *iterations);
+
+gboolean  crank_mat_sparse_float_solve_bicgstab (CrankMatSparseFloat *a,
+                                                 CrankVecFloatN      *b,
+                                                 CrankVecFloatN      *x,
+                                                 const CrankSparsePrecond precond,
+                                                 const gfloat         tolerance,
+                                                 const guint          max_iter,
+                                                 guint               *iterations);
+
+G_END_DECLS
+
+#endif
@@ -0,0 +1,267 @@
+/* Copyright (C) 2015, WSID   */
+
+/* Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+#define _CRANKBASE_INSIDE
+
+#include <glib.h>
+
+#include "crankparallel.h"
+
+/**
+ * SECTION: crankparallel
+ * @title: Parallel Execution
+ * @short_description: Splits works across worker threads.
+ * @stability: unstable
+ * @include: crankbase.h
+ *
+ * Some operations on large data, like multiplication of large matrices, can be
+ * split into independent parts. Crank System runs these parts on shared pool
+ * of worker threads.
+ *
+ * # Thread count
+ *
+ * Number of threads are given by global setting, which is set by
+ * crank_parallel_set_n_threads(). Initially it is 1, which means every
+ * operations run on calling thread, as they did.
+ *
+ * Some operations have variants with <function>_parallel</function> suffix,
+ * which take number of threads per call.
+ *
+ * <table><title>Meaning of thread count</title>
+ *   <tgroup cols="2" align="left" colsep="1" rowsep="0">
+ *     <thead>
+ *       <row>
+ *         <entry>Thread count</entry>
+ *         <entry>Meaning</entry>
+ *       </row>
+ *     </thead>
+ *     <tbody>
+ *       <row>
+ *         <entry>0</entry>
+ *         <entry>Number of processors</entry>
+ *       </row>
+ *       <row>
+ *         <entry>1</entry>
+ *         <entry>Runs on calling thread.</entry>
+ *       </row>
+ *       <row>
+ *         <entry>n</entry>
+ *         <entry>Calling thread and n - 1 worker threads.</entry>
+ *       </row>
+ *     </tbody>
+ *   </tgroup>
+ * </table>
+ *
+ * Worker pool has at most as many threads as processors, so larger thread
+ * count splits works into more parts, without more threads. Parallel
+ * operations called from inside of other parallel operation run on the
+ * calling thread.
+ */
+
+
+//////// Private Type //////////////////////////////////////////////////////////
+
+typedef struct _CrankParallelJob {
+  CrankParallelRangeFunc  func;
+  gpointer                userdata;
+
+  gint                    remaining;
+  GMutex                  mutex;
+  GCond                   cond;
+} CrankParallelJob;
+
+typedef struct _CrankParallelChunk {
+  CrankParallelJob *job;
+  guint             start;
+  guint             end;
+} CrankParallelChunk;
+
+
+//////// Private Variables /////////////////////////////////////////////////////
+
+static gint crank_parallel_n_threads = 1;
+
+// Set on threads while they process a part of crank_parallel_for().
+static GPrivate crank_parallel_inside = G_PRIVATE_INIT (NULL);
+
+
+//////// Private Functions /////////////////////////////////////////////////////
+
+static void
+crank_parallel_worker (gpointer data,
+                       gpointer userdata)
+{
+  CrankParallelChunk *chunk = (CrankParallelChunk*) data;
+  CrankParallelJob *job = chunk->job;
+
+  g_private_set (&crank_parallel_inside, GINT_TO_POINTER (TRUE));
+  job->func (chunk->start, chunk->end, job->userdata);
+
+  g_mutex_lock (&job->mutex);
+  job->remaining--;
+  if (job->remaining == 0)
+    g_cond_signal (&job->cond);
+  g_mutex_unlock (&job->mutex);
+}
+
+static GThreadPool*
+crank_parallel_get_pool (void)
+{
+  static gsize pool = 0;
+
+  if (g_once_init_enter (&pool))
+    {
+      // Shared pool, limited to number of processors. Workers never wait for
+      // other chunks, as nested operations run inline, so callers do not
+      // block each other.
+      GThreadPool *npool = g_thread_pool_new (crank_parallel_worker, NULL,
+                                              MAX (g_get_num_processors (), 1),
+                                              FALSE, NULL);
+
+      g_once_init_leave (&pool, (gsize) npool);
+    }
+
+  return (GThreadPool*) pool;
+}
+
+
+//////// Global setting ////////////////////////////////////////////////////////
+
+/**
+ * crank_parallel_set_n_threads:
+ * @n_threads: Number of threads, or 0 for number of processors.
+ *
+ * Sets number of threads that operations use by default.
+ */
+void
+crank_parallel_set_n_threads (const guint n_threads)
+{
+  g_atomic_int_set (&crank_parallel_n_threads,
+                    (gint) crank_parallel_resolve_n_threads (n_threads));
+}
+
+/**
+ * crank_parallel_get_n_threads:
+ *
+ * Gets number of threads that operations use by default.
+ *
+ * Returns: Number of threads.
+ */
+guint
+crank_parallel_get_n_threads (void)
+{
+  return (guint) g_atomic_int_get (&crank_parallel_n_threads);
+}
+
+/**
+ * crank_parallel_resolve_n_threads:
+ * @n_threads: Number of threads, or 0 for number of processors.
+ *
+ * Resolves thread count given by user, into actual number of threads.
+ *
+ * Returns: Number of threads, which is at least 1.
+ */
+guint
+crank_parallel_resolve_n_threads (const guint n_threads)
+{
+  if (n_threads == 0)
+    return MAX (g_get_num_processors (), 1);
+
+  return n_threads;
+}
+
+
+//////// Execution /////////////////////////////////////////////////////////////
+
+/**
+ * crank_parallel_for:
+ * @n_threads: Number of threads, or 0 for number of processors.
+ * @start: Start of range, inclusive.
+ * @end: End of range, exclusive.
+ * @grain: Minimum size of each part.
+ * @func: (scope call): A Function to process part of range.
+ * @userdata: (closure): A Userdata for @func.
+ *
+ * Splits range [@start, @end) into contiguous parts, and process them on
+ * worker threads. Calling thread processes first part, and waits for others.
+ *
+ * If range is too small to split by @grain, or @n_threads is 1, @func is
+ * called once on calling thread with whole range. This is also the case when
+ * this is called from @func of other crank_parallel_for().
+ */
+void
+crank_parallel_for (const guint            n_threads,
+                    const guint            start,
+                    const guint            end,
+                    const guint            grain,
+                    CrankParallelRangeFunc func,
+                    gpointer               userdata)
+{
+  CrankParallelJob job;
+  CrankParallelChunk *chunks;
+
+  guint len;
+  guint n_chunks;
+  guint i;
+
+  if (end <= start)
+    return;
+
+  len = end - start;
+  n_chunks = crank_parallel_resolve_n_threads (n_threads);
+  n_chunks = MIN (n_chunks, len / MAX (grain, 1));
+
+  if ((n_chunks <= 1) || (g_private_get (&crank_parallel_inside) != NULL))
+    {
+      func (start, end, userdata);
+      return;
+    }
+
+  job.func = func;
+  job.userdata = userdata;
+  job.remaining = n_chunks - 1;
+  g_mutex_init (&job.mutex);
+  g_cond_init (&job.cond);
+
+  chunks = g_new (CrankParallelChunk, n_chunks);
+
+  for (i = 0; i < n_chunks; i++)
+    {
+      chunks[i].job = &job;
+      chunks[i].start = start + (guint)(((guint64) len * i) / n_chunks);
+      chunks[i].end = start + (guint)(((guint64) len * (i + 1)) / n_chunks);
+    }
+
+  for (i = 1; i < n_chunks; i++)
+    g_thread_pool_push (crank_parallel_get_pool (), chunks + i, NULL);
+
+  g_private_set (&crank_parallel_inside, GINT_TO_POINTER (TRUE));
+  func (chunks[0].start, chunks[0].end, userdata);
+  g_private_set (&crank_parallel_inside, NULL);
+
+  g_mutex_lock (&job.mutex);
+  while (job.remaining != 0)
+    g_cond_wait (&job.cond, &job.mutex);
+  g_mutex_unlock (&job.mutex);
+
+  g_mutex_clear (&job.mutex);
+  g_cond_clear (&job.cond);
+  g_free (chunks);
+}
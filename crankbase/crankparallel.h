@@ -0,0 +1,64 @@
+#ifndef CRANKPARALLEL_H
+#define CRANKPARALLEL_H
+
+/* Copyright (C) 2015, WSID   */
+
+/* Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef _CRANKBASE_INSIDE
+#error crankparallel.h cannot be included directly.
+#endif
+
+#include <glib.h>
+
+G_BEGIN_DECLS
+
+/**
+ * CrankParallelRangeFunc:
+ * @start: Start index of range, inclusive.
+ * @end: End index of range, exclusive.
+ * @userdata: (closure): A Userdata.
+ *
+ * Function type to process a part of range.
+ */
+typedef void (*CrankParallelRangeFunc) (const guint start,
+                                        const guint end,
+                                        gpointer    userdata);
+
+//////// Global setting ////////////////////////////////////////////////////////
+
+void    crank_parallel_set_n_threads  (const guint n_threads);
+
+guint   crank_parallel_get_n_threads  (void);
+
+guint   crank_parallel_resolve_n_threads (const guint n_threads);
+
+//////// Execution /////////////////////////////////////////////////////////////
+
+void    crank_parallel_for            (const guint            n_threads,
+                                       const guint            start,
+                                       const guint            end,
+                                       const guint            grain,
+                                       CrankParallelRangeFunc func,
+                                       gpointer               userdata);
+
+G_END_DECLS
+
+#endif
@@ -909,7 +909,7 @@ crank_permutation_get_inversion (CrankPermutation *p)
 
   for (i = 0; i < p->n; i++)
     for (j = i + 1; j < p->n; j++)
-      if (p->data[i] < p->data[j])
+      if (p->data[j] < p->data[i])
         inversion++;
 
   return inversion;
@@ -28,10 +28,18 @@
 #include <glib-object.h>
 
 #include "crankcomplex.h"
+#include "crankfastmath.h"
 #include "crankveccommon.h"
 #include "crankvecfloat.h"
+#include "crankmatfloat.h"
 #include "crankquaternion.h"
 
+#include "crankcpu-private.h"
+
+#ifdef CRANK_CPU_X86
+#include <immintrin.h>
+#endif
+
 /**
  * SECTION: crankquaternion
  * @title: Quaternion value
@@ -147,6 +155,23 @@
  *     </tbody>
  *   </tgroup>
  * </table>
+ *
+ * # Batch Operations.
+ *
+ * Arrays of quaternions are processed at once, by functions with batch. They
+ * take arrays of #CrankQuatFloat, and functions with soa take separated streams
+ * of components. These are vectorized when CPU supports AVX, unless CRANK_SIMD
+ * limits SIMD level below AVX.
+ *
+ * Interpolations take a weight for each pair. crank_quat_float_batch_slerp()
+ * evaluates polynomial approximation, instead of trigonometric functions.
+ *
+ * # Fast approximations.
+ *
+ * crank_quat_float_ln() and crank_quat_float_exp() have variants with
+ * <function>_fast</function> suffix, which use approximations of
+ * #crankfastmath. Functions without suffix use them too, when they are enabled
+ * by crank_fast_math_set_enabled().
  */
 
 //////// GValue Converters /////////////////////////////////////////////////////
@@ -1297,6 +1322,12 @@ crank_quat_float_ln (CrankQuatFloat *a,
   gfloat norm_imag;
   gfloat ac;
 
+  if (crank_fast_math_get_enabled ())
+    {
+      crank_quat_float_ln_fast (a, r);
+      return;
+    }
+
   norm = crank_quat_float_get_norm (a);
   norm_imag = crank_vec_float3_get_magn (imag);
   ac = acosf (a->w / norm);
@@ -1325,6 +1356,12 @@ crank_quat_float_exp (CrankQuatFloat *a,
   gfloat c;
   gfloat s;
 
+  if (crank_fast_math_get_enabled ())
+    {
+      crank_quat_float_exp_fast (a, r);
+      return;
+    }
+
   exp_w = expf (a->w);
   norm_imag = crank_vec_float3_get_magn (imag);
 
@@ -1377,6 +1414,60 @@ crank_quat_float_powr (CrankQuatFloat *a,
 }
 
 
+/**
+ * crank_quat_float_ln_fast:
+ * @a: A Quaternion.
+ * @r: (out): A Quaternion to store result.
+ *
+ * Gets approximated natural log from a quaternion. Unlike
+ * crank_quat_float_ln(), real quaternions have zero imaginary part.
+ *
+ * See #crankfastmath for accuracy.
+ */
+void
+crank_quat_float_ln_fast (CrankQuatFloat *a,
+                          CrankQuatFloat *r)
+{
+  gfloat nisq = a->x * a->x + a->y * a->y + a->z * a->z;
+  gfloat ni = sqrtf (nisq);
+  gfloat l = 0.5f * crank_fast_logf (a->w * a->w + nisq);
+  gfloat k = (ni == 0) ? 0 : crank_fast_atan2f (ni, a->w) / ni;
+
+  r->w = l;
+  r->x = a->x * k;
+  r->y = a->y * k;
+  r->z = a->z * k;
+}
+
+/**
+ * crank_quat_float_exp_fast:
+ * @a: A Quaternion.
+ * @r: (out): A Quaternion to store result.
+ *
+ * Gets approximated e-based exponential of quaternion.
+ *
+ * See #crankfastmath for accuracy.
+ */
+void
+crank_quat_float_exp_fast (CrankQuatFloat *a,
+                           CrankQuatFloat *r)
+{
+  gfloat ni = sqrtf (a->x * a->x + a->y * a->y + a->z * a->z);
+  gfloat e = crank_fast_expf (a->w);
+  gfloat s;
+  gfloat c;
+  gfloat k;
+
+  crank_fast_sincosf (ni, &s, &c);
+  k = (ni == 0) ? e : e * s / ni;
+
+  r->w = e * c;
+  r->x = a->x * k;
+  r->y = a->y * k;
+  r->z = a->z * k;
+}
+
+
 //////// Rotation Operations ///////////////////////////////////////////////////
 
 /**
@@ -1495,6 +1586,1249 @@ crank_quat_float_rotatev (CrankQuatFloat *quat,
     (ww - xx - yy + zz) *   vec->z;
 }
 
+//////// Batch Operations //////////////////////////////////////////////////////
+
+// Count of quaternions, which are converted into streams at once.
+#define CRANK_QUAT_FLOAT_BATCH_CHUNK 64
+
+/*
+ * Coefficients for polynomial form of SLERP.
+ *
+ * sin (t * a) / sin (a) is expanded as polynomial of (cos (a) - 1), and is
+ * evaluated in Horner's form. The last term is adjusted, so that error is
+ * spread over range. (See D. Eberly, A Fast and Accurate Algorithm for
+ * Computing SLERP)
+ */
+#define CRANK_QUAT_FLOAT_SLERP_MU 1.90110745351730037f
+
+static const gfloat crank_quat_float_slerp_u[8] = {
+  1.0f / (1 * 3),   1.0f / (2 * 5),   1.0f / (3 * 7),   1.0f / (4 * 9),
+  1.0f / (5 * 11),  1.0f / (6 * 13),  1.0f / (7 * 15),
+  CRANK_QUAT_FLOAT_SLERP_MU / (8 * 17)
+};
+
+static const gfloat crank_quat_float_slerp_v[8] = {
+  1.0f / 3,         2.0f / 5,         3.0f / 7,         4.0f / 9,
+  5.0f / 11,        6.0f / 13,        7.0f / 15,
+  CRANK_QUAT_FLOAT_SLERP_MU * 8 / 17
+};
+
+static void
+crank_quat_float_soa_mul_generic (const guint   n,
+                                  const gfloat *aw,
+                                  const gfloat *ax,
+                                  const gfloat *ay,
+                                  const gfloat *az,
+                                  const gfloat *bw,
+                                  const gfloat *bx,
+                                  const gfloat *by,
+                                  const gfloat *bz,
+                                  gfloat       *rw,
+                                  gfloat       *rx,
+                                  gfloat       *ry,
+                                  gfloat       *rz)
+{
+  guint i;
+
+  for (i = 0; i < n; i++)
+    {
+      gfloat w = aw[i] * bw[i] - ax[i] * bx[i] - ay[i] * by[i] - az[i] * bz[i];
+      gfloat x = ax[i] * bw[i] + aw[i] * bx[i] - az[i] * by[i] + ay[i] * bz[i];
+      gfloat y = ay[i] * bw[i] + az[i] * bx[i] + aw[i] * by[i] - ax[i] * bz[i];
+      gfloat z = az[i] * bw[i] - ay[i] * bx[i] + ax[i] * by[i] + aw[i] * bz[i];
+
+      rw[i] = w;
+      rx[i] = x;
+      ry[i] = y;
+      rz[i] = z;
+    }
+}
+
+static void
+crank_quat_float_soa_nlerp_generic (const guint   n,
+                                    const gfloat *aw,
+                                    const gfloat *ax,
+                                    const gfloat *ay,
+                                    const gfloat *az,
+                                    const gfloat *bw,
+                                    const gfloat *bx,
+                                    const gfloat *by,
+                                    const gfloat *bz,
+                                    const gfloat *c,
+                                    gfloat       *rw,
+                                    gfloat       *rx,
+                                    gfloat       *ry,
+                                    gfloat       *rz)
+{
+  guint i;
+
+  for (i = 0; i < n; i++)
+    {
+      gfloat dot = aw[i] * bw[i] + ax[i] * bx[i] +
+                   ay[i] * by[i] + az[i] * bz[i];
+      gfloat d = 1 - c[i];
+      gfloat t = (dot < 0) ? -c[i] : c[i];
+      gfloat w = aw[i] * d + bw[i] * t;
+      gfloat x = ax[i] * d + bx[i] * t;
+      gfloat y = ay[i] * d + by[i] * t;
+      gfloat z = az[i] * d + bz[i] * t;
+      gfloat norm = sqrtf (w * w + x * x + y * y + z * z);
+
+      rw[i] = w / norm;
+      rx[i] = x / norm;
+      ry[i] = y / norm;
+      rz[i] = z / norm;
+    }
+}
+
+static void
+crank_quat_float_soa_slerp_generic (const guint   n,
+                                    const gfloat *aw,
+                                    const gfloat *ax,
+                                    const gfloat *ay,
+                                    const gfloat *az,
+                                    const gfloat *bw,
+                                    const gfloat *bx,
+                                    const gfloat *by,
+                                    const gfloat *bz,
+                                    const gfloat *c,
+                                    gfloat       *rw,
+                                    gfloat       *rx,
+                                    gfloat       *ry,
+                                    gfloat       *rz)
+{
+  guint i;
+  guint k;
+
+  for (i = 0; i < n; i++)
+    {
+      gfloat x = aw[i] * bw[i] + ax[i] * bx[i] + ay[i] * by[i] + az[i] * bz[i];
+      gfloat t = c[i];
+      gfloat d = 1 - t;
+      gfloat tt = t * t;
+      gfloat dd = d * d;
+      gfloat sign = 1;
+      gfloat xm1;
+      gfloat ct = 1;
+      gfloat cd = 1;
+
+      if (x < 0)
+        {
+          x = -x;
+          sign = -1;
+        }
+
+      xm1 = x - 1;
+
+      for (k = 8; k-- > 0;)
+        {
+          ct = 1 + (crank_quat_float_slerp_u[k] * tt -
+                    crank_quat_float_slerp_v[k]) * xm1 * ct;
+          cd = 1 + (crank_quat_float_slerp_u[k] * dd -
+                    crank_quat_float_slerp_v[k]) * xm1 * cd;
+        }
+
+      ct *= sign * t;
+      cd *= d;
+
+      x = aw[i] * cd + bw[i] * ct;
+      tt = ax[i] * cd + bx[i] * ct;
+      dd = ay[i] * cd + by[i] * ct;
+      rz[i] = az[i] * cd + bz[i] * ct;
+      rw[i] = x;
+      rx[i] = tt;
+      ry[i] = dd;
+    }
+}
+
+static void
+crank_quat_float_soa_rotatev_generic (const guint   n,
+                                      const gfloat *qw,
+                                      const gfloat *qx,
+                                      const gfloat *qy,
+                                      const gfloat *qz,
+                                      const gfloat *vx,
+                                      const gfloat *vy,
+                                      const gfloat *vz,
+                                      gfloat       *rx,
+                                      gfloat       *ry,
+                                      gfloat       *rz)
+{
+  guint i;
+
+  for (i = 0; i < n; i++)
+    {
+      gfloat ww = qw[i] * qw[i];
+      gfloat xx = qx[i] * qx[i];
+      gfloat yy = qy[i] * qy[i];
+      gfloat zz = qz[i] * qz[i];
+      gfloat wz = qw[i] * qz[i];
+      gfloat xy = qx[i] * qy[i];
+      gfloat wy = qw[i] * qy[i];
+      gfloat xz = qx[i] * qz[i];
+      gfloat wx = qw[i] * qx[i];
+      gfloat yz = qy[i] * qz[i];
+
+      gfloat x = (ww + xx - yy - zz) * vx[i] +
+                 2 * (xy - wz) * vy[i] +
+                 2 * (wy + xz) * vz[i];
+      gfloat y = 2 * (wz + xy) * vx[i] +
+                 (ww - xx + yy - zz) * vy[i] +
+                 2 * (yz - wx) * vz[i];
+      gfloat z = 2 * (xz - wy) * vx[i] +
+                 2 * (wx + yz) * vy[i] +
+                 (ww - xx - yy + zz) * vz[i];
+
+      rx[i] = x;
+      ry[i] = y;
+      rz[i] = z;
+    }
+}
+
+/*
+ * Computes rotation matrices of quaternions, into 9 streams of components in
+ * row-major order.
+ */
+static void
+crank_quat_float_soa_rotm_generic (const guint   n,
+                                   const gfloat *qw,
+                                   const gfloat *qx,
+                                   const gfloat *qy,
+                                   const gfloat *qz,
+                                   gfloat      **m)
+{
+  guint i;
+
+  for (i = 0; i < n; i++)
+    {
+      gfloat ww = qw[i] * qw[i];
+      gfloat xx = qx[i] * qx[i];
+      gfloat yy = qy[i] * qy[i];
+      gfloat zz = qz[i] * qz[i];
+      gfloat wz = qw[i] * qz[i];
+      gfloat xy = qx[i] * qy[i];
+      gfloat wy = qw[i] * qy[i];
+      gfloat xz = qx[i] * qz[i];
+      gfloat wx = qw[i] * qx[i];
+      gfloat yz = qy[i] * qz[i];
+
+      m[0][i] = ww + xx - yy - zz;
+      m[1][i] = 2 * (xy - wz);
+      m[2][i] = 2 * (wy + xz);
+      m[3][i] = 2 * (wz + xy);
+      m[4][i] = ww - xx + yy - zz;
+      m[5][i] = 2 * (yz - wx);
+      m[6][i] = 2 * (xz - wy);
+      m[7][i] = 2 * (wx + yz);
+      m[8][i] = ww - xx - yy + zz;
+    }
+}
+
+#ifdef CRANK_CPU_X86
+
+// Processes 8 quaternions at once, and leaves remainings to generic one.
+__attribute__((target ("avx")))
+static void
+crank_quat_float_soa_mul_avx (const guint   n,
+                              const gfloat *aw,
+                              const gfloat *ax,
+                              const gfloat *ay,
+                              const gfloat *az,
+                              const gfloat *bw,
+                              const gfloat *bx,
+                              const gfloat *by,
+                              const gfloat *bz,
+                              gfloat       *rw,
+                              gfloat       *rx,
+                              gfloat       *ry,
+                              gfloat       *rz)
+{
+  guint i;
+
+  for (i = 0; i + 8 <= n; i += 8)
+    {
+      __m256 vaw = _mm256_loadu_ps (aw + i);
+      __m256 vax = _mm256_loadu_ps (ax + i);
+      __m256 vay = _mm256_loadu_ps (ay + i);
+      __m256 vaz = _mm256_loadu_ps (az + i);
+      __m256 vbw = _mm256_loadu_ps (bw + i);
+      __m256 vbx = _mm256_loadu_ps (bx + i);
+      __m256 vby = _mm256_loadu_ps (by + i);
+      __m256 vbz = _mm256_loadu_ps (bz + i);
+      __m256 w;
+      __m256 x;
+      __m256 y;
+      __m256 z;
+
+      w = _mm256_mul_ps (vaw, vbw);
+      w = _mm256_sub_ps (w, _mm256_mul_ps (vax, vbx));
+      w = _mm256_sub_ps (w, _mm256_mul_ps (vay, vby));
+      w = _mm256_sub_ps (w, _mm256_mul_ps (vaz, vbz));
+
+      x = _mm256_mul_ps (vax, vbw);
+      x = _mm256_add_ps (x, _mm256_mul_ps (vaw, vbx));
+      x = _mm256_sub_ps (x, _mm256_mul_ps (vaz, vby));
+      x = _mm256_add_ps (x, _mm256_mul_ps (vay, vbz));
+
+      y = _mm256_mul_ps (vay, vbw);
+      y = _mm256_add_ps (y, _mm256_mul_ps (vaz, vbx));
+      y = _mm256_add_ps (y, _mm256_mul_ps (vaw, vby));
+      y = _mm256_sub_ps (y, _mm256_mul_ps (vax, vbz));
+
+      z = _mm256_mul_ps (vaz, vbw);
+      z = _mm256_sub_ps (z, _mm256_mul_ps (vay, vbx));
+      z = _mm256_add_ps (z, _mm256_mul_ps (vax, vby));
+      z = _mm256_add_ps (z, _mm256_mul_ps (vaw, vbz));
+
+      _mm256_storeu_ps (rw + i, w);
+      _mm256_storeu_ps (rx + i, x);
+      _mm256_storeu_ps (ry + i, y);
+      _mm256_storeu_ps (rz + i, z);
+    }
+
+  crank_quat_float_soa_mul_generic (n - i,
+                                    aw + i, ax + i, ay + i, az + i,
+                                    bw + i, bx + i, by + i, bz + i,
+                                    rw + i, rx + i, ry + i, rz + i);
+}
+
+// Gets dot products of 8 pairs of quaternions.
+__attribute__((target ("avx")))
+static inline __m256
+crank_quat_float_dot_avx (__m256 aw,
+                          __m256 ax,
+                          __m256 ay,
+                          __m256 az,
+                          __m256 bw,
+                          __m256 bx,
+                          __m256 by,
+                          __m256 bz)
+{
+  __m256 d = _mm256_mul_ps (aw, bw);
+
+  d = _mm256_add_ps (d, _mm256_mul_ps (ax, bx));
+  d = _mm256_add_ps (d, _mm256_mul_ps (ay, by));
+  return _mm256_add_ps (d, _mm256_mul_ps (az, bz));
+}
+
+__attribute__((target ("avx")))
+static void
+crank_quat_float_soa_nlerp_avx (const guint   n,
+                                const gfloat *aw,
+                                const gfloat *ax,
+                                const gfloat *ay,
+                                const gfloat *az,
+                                const gfloat *bw,
+                                const gfloat *bx,
+                                const gfloat *by,
+                                const gfloat *bz,
+                                const gfloat *c,
+                                gfloat       *rw,
+                                gfloat       *rx,
+                                gfloat       *ry,
+                                gfloat       *rz)
+{
+  __m256 one = _mm256_set1_ps (1);
+  __m256 signbit = _mm256_set1_ps (-0.0f);
+  guint i;
+
+  for (i = 0; i + 8 <= n; i += 8)
+    {
+      __m256 vaw = _mm256_loadu_ps (aw + i);
+      __m256 vax = _mm256_loadu_ps (ax + i);
+      __m256 vay = _mm256_loadu_ps (ay + i);
+      __m256 vaz = _mm256_loadu_ps (az + i);
+      __m256 vbw = _mm256_loadu_ps (bw + i);
+      __m256 vbx = _mm256_loadu_ps (bx + i);
+      __m256 vby = _mm256_loadu_ps (by + i);
+      __m256 vbz = _mm256_loadu_ps (bz + i);
+      __m256 vc = _mm256_loadu_ps (c + i);
+      __m256 dot;
+      __m256 d;
+      __m256 t;
+      __m256 w;
+      __m256 x;
+      __m256 y;
+      __m256 z;
+      __m256 norm;
+
+      // Takes shorter arc, by flipping sign of weight of b.
+      dot = crank_quat_float_dot_avx (vaw, vax, vay, vaz, vbw, vbx, vby, vbz);
+      d = _mm256_sub_ps (one, vc);
+      t = _mm256_xor_ps (vc, _mm256_and_ps (dot, signbit));
+
+      w = _mm256_add_ps (_mm256_mul_ps (vaw, d), _mm256_mul_ps (vbw, t));
+      x = _mm256_add_ps (_mm256_mul_ps (vax, d), _mm256_mul_ps (vbx, t));
+      y = _mm256_add_ps (_mm256_mul_ps (vay, d), _mm256_mul_ps (vby, t));
+      z = _mm256_add_ps (_mm256_mul_ps (vaz, d), _mm256_mul_ps (vbz, t));
+
+      norm = _mm256_sqrt_ps (crank_quat_float_dot_avx (w, x, y, z,
+                                                       w, x, y, z));
+
+      _mm256_storeu_ps (rw + i, _mm256_div_ps (w, norm));
+      _mm256_storeu_ps (rx + i, _mm256_div_ps (x, norm));
+      _mm256_storeu_ps (ry + i, _mm256_div_ps (y, norm));
+      _mm256_storeu_ps (rz + i, _mm256_div_ps (z, norm));
+    }
+
+  crank_quat_float_soa_nlerp_generic (n - i,
+                                      aw + i, ax + i, ay + i, az + i,
+                                      bw + i, bx + i, by + i, bz + i,
+                                      c + i,
+                                      rw + i, rx + i, ry + i, rz + i);
+}
+
+__attribute__((target ("avx")))
+static void
+crank_quat_float_soa_slerp_avx (const guint   n,
+                                const gfloat *aw,
+                                const gfloat *ax,
+                                const gfloat *ay,
+                                const gfloat *az,
+                                const gfloat *bw,
+                                const gfloat *bx,
+                                const gfloat *by,
+                                const gfloat *bz,
+                                const gfloat *c,
+                                gfloat       *rw,
+                                gfloat       *rx,
+                                gfloat       *ry,
+                                gfloat       *rz)
+{
+  __m256 one = _mm256_set1_ps (1);
+  __m256 signbit = _mm256_set1_ps (-0.0f);
+  guint i;
+  guint k;
+
+  for (i = 0; i + 8 <= n; i += 8)
+    {
+      __m256 vaw = _mm256_loadu_ps (aw + i);
+      __m256 vax = _mm256_loadu_ps (ax + i);
+      __m256 vay = _mm256_loadu_ps (ay + i);
+      __m256 vaz = _mm256_loadu_ps (az + i);
+      __m256 vbw = _mm256_loadu_ps (bw + i);
+      __m256 vbx = _mm256_loadu_ps (bx + i);
+      __m256 vby = _mm256_loadu_ps (by + i);
+      __m256 vbz = _mm256_loadu_ps (bz + i);
+      __m256 t = _mm256_loadu_ps (c + i);
+      __m256 d = _mm256_sub_ps (one, t);
+      __m256 tt = _mm256_mul_ps (t, t);
+      __m256 dd = _mm256_mul_ps (d, d);
+      __m256 x;
+      __m256 sign;
+      __m256 xm1;
+      __m256 ct = one;
+      __m256 cd = one;
+
+      x = crank_quat_float_dot_avx (vaw, vax, vay, vaz, vbw, vbx, vby, vbz);
+      sign = _mm256_and_ps (x, signbit);
+      x = _mm256_xor_ps (x, sign);
+      xm1 = _mm256_sub_ps (x, one);
+
+      for (k = 8; k-- > 0;)
+        {
+          __m256 u = _mm256_set1_ps (crank_quat_float_slerp_u[k]);
+          __m256 v = _mm256_set1_ps (crank_quat_float_slerp_v[k]);
+          __m256 bt = _mm256_mul_ps (_mm256_sub_ps (_mm256_mul_ps (u, tt), v),
+                                     xm1);
+          __m256 bd = _mm256_mul_ps (_mm256_sub_ps (_mm256_mul_ps (u, dd), v),
+                                     xm1);
+
+          ct = _mm256_add_ps (one, _mm256_mul_ps (bt, ct));
+          cd = _mm256_add_ps (one, _mm256_mul_ps (bd, cd));
+        }
+
+      ct = _mm256_xor_ps (_mm256_mul_ps (ct, t), sign);
+      cd = _mm256_mul_ps (cd, d);
+
+      _mm256_storeu_ps (rw + i, _mm256_add_ps (_mm256_mul_ps (vaw, cd),
+                                               _mm256_mul_ps (vbw, ct)));
+      _mm256_storeu_ps (rx + i, _mm256_add_ps (_mm256_mul_ps (vax, cd),
+                                               _mm256_mul_ps (vbx, ct)));
+      _mm256_storeu_ps (ry + i, _mm256_add_ps (_mm256_mul_ps (vay, cd),
+                                               _mm256_mul_ps (vby, ct)));
+      _mm256_storeu_ps (rz + i, _mm256_add_ps (_mm256_mul_ps (vaz, cd),
+                                               _mm256_mul_ps (vbz, ct)));
+    }
+
+  crank_quat_float_soa_slerp_generic (n - i,
+                                      aw + i, ax + i, ay + i, az + i,
+                                      bw + i, bx + i, by + i, bz + i,
+                                      c + i,
+                                      rw + i, rx + i, ry + i, rz + i);
+}
+
+// Computes 9 components of rotation matrices of 8 quaternions.
+__attribute__((target ("avx")))
+static inline void
+crank_quat_float_rotm_avx (__m256  w,
+                           __m256  x,
+                           __m256  y,
+                           __m256  z,
+                           __m256 *m)
+{
+  __m256 two = _mm256_set1_ps (2);
+  __m256 ww = _mm256_mul_ps (w, w);
+  __m256 xx = _mm256_mul_ps (x, x);
+  __m256 yy = _mm256_mul_ps (y, y);
+  __m256 zz = _mm256_mul_ps (z, z);
+  __m256 wz = _mm256_mul_ps (w, z);
+  __m256 xy = _mm256_mul_ps (x, y);
+  __m256 wy = _mm256_mul_ps (w, y);
+  __m256 xz = _mm256_mul_ps (x, z);
+  __m256 wx = _mm256_mul_ps (w, x);
+  __m256 yz = _mm256_mul_ps (y, z);
+  __m256 wwmzz = _mm256_sub_ps (ww, zz);
+  __m256 xxmyy = _mm256_sub_ps (xx, yy);
+
+  m[0] = _mm256_add_ps (wwmzz, xxmyy);
+  m[1] = _mm256_mul_ps (two, _mm256_sub_ps (xy, wz));
+  m[2] = _mm256_mul_ps (two, _mm256_add_ps (wy, xz));
+  m[3] = _mm256_mul_ps (two, _mm256_add_ps (wz, xy));
+  m[4] = _mm256_sub_ps (wwmzz, xxmyy);
+  m[5] = _mm256_mul_ps (two, _mm256_sub_ps (yz, wx));
+  m[6] = _mm256_mul_ps (two, _mm256_sub_ps (xz, wy));
+  m[7] = _mm256_mul_ps (two, _mm256_add_ps (wx, yz));
+  m[8] = _mm256_sub_ps (_mm256_sub_ps (ww, xx), _mm256_sub_ps (yy, zz));
+}
+
+__attribute__((target ("avx")))
+static void
+crank_quat_float_soa_rotatev_avx (const guint   n,
+                                  const gfloat *qw,
+                                  const gfloat *qx,
+                                  const gfloat *qy,
+                                  const gfloat *qz,
+                                  const gfloat *vx,
+                                  const gfloat *vy,
+                                  const gfloat *vz,
+                                  gfloat       *rx,
+                                  gfloat       *ry,
+                                  gfloat       *rz)
+{
+  gfloat *r[3] = {rx, ry, rz};
+  guint i;
+  guint k;
+
+  for (i = 0; i + 8 <= n; i += 8)
+    {
+      __m256 m[9];
+      __m256 x = _mm256_loadu_ps (vx + i);
+      __m256 y = _mm256_loadu_ps (vy + i);
+      __m256 z = _mm256_loadu_ps (vz + i);
+
+      crank_quat_float_rotm_avx (_mm256_loadu_ps (qw + i),
+                                 _mm256_loadu_ps (qx + i),
+                                 _mm256_loadu_ps (qy + i),
+                                 _mm256_loadu_ps (qz + i),
+                                 m);
+
+      for (k = 0; k < 3; k++)
+        {
+          __m256 e = _mm256_mul_ps (m[3 * k], x);
+
+          e = _mm256_add_ps (e, _mm256_mul_ps (m[3 * k + 1], y));
+          e = _mm256_add_ps (e, _mm256_mul_ps (m[3 * k + 2], z));
+          _mm256_storeu_ps (r[k] + i, e);
+        }
+    }
+
+  crank_quat_float_soa_rotatev_generic (n - i,
+                                        qw + i, qx + i, qy + i, qz + i,
+                                        vx + i, vy + i, vz + i,
+                                        rx + i, ry + i, rz + i);
+}
+
+__attribute__((target ("avx")))
+static void
+crank_quat_float_soa_rotm_avx (const guint   n,
+                               const gfloat *qw,
+                               const gfloat *qx,
+                               const gfloat *qy,
+                               const gfloat *qz,
+                               gfloat      **m)
+{
+  gfloat *mi[9];
+  guint i;
+  guint k;
+
+  for (i = 0; i + 8 <= n; i += 8)
+    {
+      __m256 vm[9];
+
+      crank_quat_float_rotm_avx (_mm256_loadu_ps (qw + i),
+                                 _mm256_loadu_ps (qx + i),
+                                 _mm256_loadu_ps (qy + i),
+                                 _mm256_loadu_ps (qz + i),
+                                 vm);
+
+      for (k = 0; k < 9; k++)
+        _mm256_storeu_ps (m[k] + i, vm[k]);
+    }
+
+  for (k = 0; k < 9; k++)
+    mi[k] = m[k] + i;
+
+  crank_quat_float_soa_rotm_generic (n - i,
+                                     qw + i, qx + i, qy + i, qz + i, mi);
+}
+
+#endif
+
+/*
+ * Splits quaternions into streams of components.
+ */
+static void
+crank_quat_float_batch_split (const guint           n,
+                              const CrankQuatFloat *q,
+                              gfloat               *w,
+                              gfloat               *x,
+                              gfloat               *y,
+                              gfloat               *z)
+{
+  guint i;
+
+  for (i = 0; i < n; i++)
+    {
+      w[i] = q[i].w;
+      x[i] = q[i].x;
+      y[i] = q[i].y;
+      z[i] = q[i].z;
+    }
+}
+
+/*
+ * Merges streams of components into quaternions.
+ */
+static void
+crank_quat_float_batch_merge (const guint     n,
+                              const gfloat   *w,
+                              const gfloat   *x,
+                              const gfloat   *y,
+                              const gfloat   *z,
+                              CrankQuatFloat *q)
+{
+  guint i;
+
+  for (i = 0; i < n; i++)
+    {
+      q[i].w = w[i];
+      q[i].x = x[i];
+      q[i].y = y[i];
+      q[i].z = z[i];
+    }
+}
+
+/**
+ * crank_quat_float_soa_mul:
+ * @n: Count of quaternions.
+ * @aw: (array length=n): Real parts of first quaternions.
+ * @ax: (array length=n): I components of first quaternions.
+ * @ay: (array length=n): J components of first quaternions.
+ * @az: (array length=n): K components of first quaternions.
+ * @bw: (array length=n): Real parts of second quaternions.
+ * @bx: (array length=n): I components of second quaternions.
+ * @by: (array length=n): J components of second quaternions.
+ * @bz: (array length=n): K components of second quaternions.
+ * @rw: (out caller-allocates) (array length=n): Real parts of results.
+ * @rx: (out caller-allocates) (array length=n): I components of results.
+ * @ry: (out caller-allocates) (array length=n): J components of results.
+ * @rz: (out caller-allocates) (array length=n): K components of results.
+ *
+ * Multiplies @n pairs of quaternions, which are stored as separated streams
+ * of components. This composites rotations, as crank_quat_float_mul() does.
+ * Result streams may be same with input streams.
+ */
+void
+crank_quat_float_soa_mul (const guint   n,
+                          const gfloat *aw,
+                          const gfloat *ax,
+                          const gfloat *ay,
+                          const gfloat *az,
+                          const gfloat *bw,
+                          const gfloat *bx,
+                          const gfloat *by,
+                          const gfloat *bz,
+                          gfloat       *rw,
+                          gfloat       *rx,
+                          gfloat       *ry,
+                          gfloat       *rz)
+{
+#ifdef CRANK_CPU_X86
+  if (CRANK_CPU_SIMD_AVX <= _crank_cpu_get_simd_level ())
+    {
+      crank_quat_float_soa_mul_avx (n, aw, ax, ay, az, bw, bx, by, bz,
+                                    rw, rx, ry, rz);
+      return;
+    }
+#endif
+
+  crank_quat_float_soa_mul_generic (n, aw, ax, ay, az, bw, bx, by, bz,
+                                    rw, rx, ry, rz);
+}
+
+/**
+ * crank_quat_float_soa_nlerp:
+ * @n: Count of quaternions.
+ * @aw: (array length=n): Real parts of first quaternions.
+ * @ax: (array length=n): I components of first quaternions.
+ * @ay: (array length=n): J components of first quaternions.
+ * @az: (array length=n): K components of first quaternions.
+ * @bw: (array length=n): Real parts of second quaternions.
+ * @bx: (array length=n): I components of second quaternions.
+ * @by: (array length=n): J components of second quaternions.
+ * @bz: (array length=n): K components of second quaternions.
+ * @c: (array length=n): Weights of second quaternions.
+ * @rw: (out caller-allocates) (array length=n): Real parts of results.
+ * @rx: (out caller-allocates) (array length=n): I components of results.
+ * @ry: (out caller-allocates) (array length=n): J components of results.
+ * @rz: (out caller-allocates) (array length=n): K components of results.
+ *
+ * Interpolates @n pairs of rotations, by normalized linear interpolation.
+ * Each pair has its own weight in @c.
+ *
+ * Second quaternion is negated if two quaternions are on different sides, so
+ * that interpolation takes shorter arc. Result streams may be same with input
+ * streams.
+ */
+void
+crank_quat_float_soa_nlerp (const guint   n,
+                            const gfloat *aw,
+                            const gfloat *ax,
+                            const gfloat *ay,
+                            const gfloat *az,
+                            const gfloat *bw,
+                            const gfloat *bx,
+                            const gfloat *by,
+                            const gfloat *bz,
+                            const gfloat *c,
+                            gfloat       *rw,
+                            gfloat       *rx,
+                            gfloat       *ry,
+                            gfloat       *rz)
+{
+#ifdef CRANK_CPU_X86
+  if (CRANK_CPU_SIMD_AVX <= _crank_cpu_get_simd_level ())
+    {
+      crank_quat_float_soa_nlerp_avx (n, aw, ax, ay, az, bw, bx, by, bz, c,
+                                      rw, rx, ry, rz);
+      return;
+    }
+#endif
+
+  crank_quat_float_soa_nlerp_generic (n, aw, ax, ay, az, bw, bx, by, bz, c,
+                                      rw, rx, ry, rz);
+}
+
+/**
+ * crank_quat_float_soa_slerp:
+ * @n: Count of quaternions.
+ * @aw: (array length=n): Real parts of first quaternions.
+ * @ax: (array length=n): I components of first quaternions.
+ * @ay: (array length=n): J components of first quaternions.
+ * @az: (array length=n): K components of first quaternions.
+ * @bw: (array length=n): Real parts of second quaternions.
+ * @bx: (array length=n): I components of second quaternions.
+ * @by: (array length=n): J components of second quaternions.
+ * @bz: (array length=n): K components of second quaternions.
+ * @c: (array length=n): Weights of second quaternions, in [0, 1].
+ * @rw: (out caller-allocates) (array length=n): Real parts of results.
+ * @rx: (out caller-allocates) (array length=n): I components of results.
+ * @ry: (out caller-allocates) (array length=n): J components of results.
+ * @rz: (out caller-allocates) (array length=n): K components of results.
+ *
+ * Interpolates @n pairs of unit quaternions, by spherical linear
+ * interpolation. Each pair has its own weight in @c.
+ *
+ * Interpolation takes shorter arc. Coefficients are evaluated by polynomial,
+ * instead of trigonometric functions, so several pairs are processed at once.
+ * Error is about 1e-6 in float. Result streams may be same with input streams.
+ */
+void
+crank_quat_float_soa_slerp (const guint   n,
+                            const gfloat *aw,
+                            const gfloat *ax,
+                            const gfloat *ay,
+                            const gfloat *az,
+                            const gfloat *bw,
+                            const gfloat *bx,
+                            const gfloat *by,
+                            const gfloat *bz,
+                            const gfloat *c,
+                            gfloat       *rw,
+                            gfloat       *rx,
+                            gfloat       *ry,
+                            gfloat       *rz)
+{
+#ifdef CRANK_CPU_X86
+  if (CRANK_CPU_SIMD_AVX <= _crank_cpu_get_simd_level ())
+    {
+      crank_quat_float_soa_slerp_avx (n, aw, ax, ay, az, bw, bx, by, bz, c,
+                                      rw, rx, ry, rz);
+      return;
+    }
+#endif
+
+  crank_quat_float_soa_slerp_generic (n, aw, ax, ay, az, bw, bx, by, bz, c,
+                                      rw, rx, ry, rz);
+}
+
+/**
+ * crank_quat_float_soa_rotatev:
+ * @n: Count of quaternions and vectors.
+ * @qw: (array length=n): Real parts of quaternions.
+ * @qx: (array length=n): I components of quaternions.
+ * @qy: (array length=n): J components of quaternions.
+ * @qz: (array length=n): K components of quaternions.
+ * @vx: (array length=n): X components of vectors.
+ * @vy: (array length=n): Y components of vectors.
+ * @vz: (array length=n): Z components of vectors.
+ * @rx: (out caller-allocates) (array length=n): X components of results.
+ * @ry: (out caller-allocates) (array length=n): Y components of results.
+ * @rz: (out caller-allocates) (array length=n): Z components of results.
+ *
+ * Rotates each of @n vectors by its own quaternion, as
+ * crank_quat_float_rotatev() does. Result streams may be same with input
+ * streams.
+ */
+void
+crank_quat_float_soa_rotatev (const guint   n,
+                              const gfloat *qw,
+                              const gfloat *qx,
+                              const gfloat *qy,
+                              const gfloat *qz,
+                              const gfloat *vx,
+                              const gfloat *vy,
+                              const gfloat *vz,
+                              gfloat       *rx,
+                              gfloat       *ry,
+                              gfloat       *rz)
+{
+#ifdef CRANK_CPU_X86
+  if (CRANK_CPU_SIMD_AVX <= _crank_cpu_get_simd_level ())
+    {
+      crank_quat_float_soa_rotatev_avx (n, qw, qx, qy, qz, vx, vy, vz,
+                                        rx, ry, rz);
+      return;
+    }
+#endif
+
+  crank_quat_float_soa_rotatev_generic (n, qw, qx, qy, qz, vx, vy, vz,
+                                        rx, ry, rz);
+}
+
+/**
+ * crank_quat_float_batch_mul:
+ * @n: Count of quaternions.
+ * @a: (array length=n): First quaternions.
+ * @b: (array length=n): Second quaternions.
+ * @r: (out caller-allocates) (array length=n): Array to store products.
+ *
+ * Multiplies @n pairs of quaternions. @r may be same with @a or @b.
+ *
+ * Quaternions are split into streams of components by chunk, and processed by
+ * crank_quat_float_soa_mul().
+ */
+void
+crank_quat_float_batch_mul (const guint           n,
+                            const CrankQuatFloat *a,
+                            const CrankQuatFloat *b,
+                            CrankQuatFloat       *r)
+{
+  gfloat s[8][CRANK_QUAT_FLOAT_BATCH_CHUNK];
+  guint i;
+
+  for (i = 0; i < n; i += CRANK_QUAT_FLOAT_BATCH_CHUNK)
+    {
+      guint cn = MIN (n - i, CRANK_QUAT_FLOAT_BATCH_CHUNK);
+
+      crank_quat_float_batch_split (cn, a + i, s[0], s[1], s[2], s[3]);
+      crank_quat_float_batch_split (cn, b + i, s[4], s[5], s[6], s[7]);
+
+      crank_quat_float_soa_mul (cn, s[0], s[1], s[2], s[3],
+                                s[4], s[5], s[6], s[7],
+                                s[0], s[1], s[2], s[3]);
+
+      crank_quat_float_batch_merge (cn, s[0], s[1], s[2], s[3], r + i);
+    }
+}
+
+/**
+ * crank_quat_float_batch_nlerp:
+ * @n: Count of quaternions.
+ * @a: (array length=n): First quaternions.
+ * @b: (array length=n): Second quaternions.
+ * @c: (array length=n): Weights of second quaternions.
+ * @r: (out caller-allocates) (array length=n): Array to store results.
+ *
+ * Interpolates @n pairs of rotations, by normalized linear interpolation.
+ * @r may be same with @a or @b.
+ *
+ * See crank_quat_float_soa_nlerp().
+ */
+void
+crank_quat_float_batch_nlerp (const guint           n,
+                              const CrankQuatFloat *a,
+                              const CrankQuatFloat *b,
+                              const gfloat         *c,
+                              CrankQuatFloat       *r)
+{
+  gfloat s[8][CRANK_QUAT_FLOAT_BATCH_CHUNK];
+  guint i;
+
+  for (i = 0; i < n; i += CRANK_QUAT_FLOAT_BATCH_CHUNK)
+    {
+      guint cn = MIN (n - i, CRANK_QUAT_FLOAT_BATCH_CHUNK);
+
+      crank_quat_float_batch_split (cn, a + i, s[0], s[1], s[2], s[3]);
+      crank_quat_float_batch_split (cn, b + i, s[4], s[5], s[6], s[7]);
+
+      crank_quat_float_soa_nlerp (cn, s[0], s[1], s[2], s[3],
+                                  s[4], s[5], s[6], s[7], c + i,
+                                  s[0], s[1], s[2], s[3]);
+
+      crank_quat_float_batch_merge (cn, s[0], s[1], s[2], s[3], r + i);
+    }
+}
+
+/**
+ * crank_quat_float_batch_slerp:
+ * @n: Count of quaternions.
+ * @a: (array length=n): First unit quaternions.
+ * @b: (array length=n): Second unit quaternions.
+ * @c: (array length=n): Weights of second quaternions, in [0, 1].
+ * @r: (out caller-allocates) (array length=n): Array to store results.
+ *
+ * Interpolates @n pairs of unit quaternions, by spherical linear
+ * interpolation. @r may be same with @a or @b.
+ *
+ * See crank_quat_float_soa_slerp().
+ */
+void
+crank_quat_float_batch_slerp (const guint           n,
+                              const CrankQuatFloat *a,
+                              const CrankQuatFloat *b,
+                              const gfloat         *c,
+                              CrankQuatFloat       *r)
+{
+  gfloat s[8][CRANK_QUAT_FLOAT_BATCH_CHUNK];
+  guint i;
+
+  for (i = 0; i < n; i += CRANK_QUAT_FLOAT_BATCH_CHUNK)
+    {
+      guint cn = MIN (n - i, CRANK_QUAT_FLOAT_BATCH_CHUNK);
+
+      crank_quat_float_batch_split (cn, a + i, s[0], s[1], s[2], s[3]);
+      crank_quat_float_batch_split (cn, b + i, s[4], s[5], s[6], s[7]);
+
+      crank_quat_float_soa_slerp (cn, s[0], s[1], s[2], s[3],
+                                  s[4], s[5], s[6], s[7], c + i,
+                                  s[0], s[1], s[2], s[3]);
+
+      crank_quat_float_batch_merge (cn, s[0], s[1], s[2], s[3], r + i);
+    }
+}
+
+/**
+ * crank_quat_float_batch_rotatev:
+ * @n: Count of vectors.
+ * @quat: A Quaternion.
+ * @vec: (array length=n): Vectors to rotate.
+ * @r: (out caller-allocates) (array length=n): Array to store results.
+ *
+ * Rotates @n vectors by a quaternion. @r may be same with @vec.
+ *
+ * Rotation is converted to a matrix once, and vectors are transformed by
+ * crank_mat_float4_batch_transform().
+ */
+void
+crank_quat_float_batch_rotatev (const guint           n,
+                                const CrankQuatFloat *quat,
+                                const CrankVecFloat3 *vec,
+                                CrankVecFloat3       *r)
+{
+  CrankMatFloat4 mat;
+
+  crank_quat_float_batch_to_mat_float4 (1, quat, &mat);
+  crank_mat_float4_batch_transform (n, &mat, vec, r);
+}
+
+/**
+ * crank_quat_float_batch_rotatev_each:
+ * @n: Count of quaternions and vectors.
+ * @quat: (array length=n): Quaternions.
+ * @vec: (array length=n): Vectors to rotate.
+ * @r: (out caller-allocates) (array length=n): Array to store results.
+ *
+ * Rotates each of @n vectors by its own quaternion. @r may be same with @vec.
+ *
+ * See crank_quat_float_soa_rotatev().
+ */
+void
+crank_quat_float_batch_rotatev_each (const guint           n,
+                                     const CrankQuatFloat *quat,
+                                     const CrankVecFloat3 *vec,
+                                     CrankVecFloat3       *r)
+{
+  gfloat s[7][CRANK_QUAT_FLOAT_BATCH_CHUNK];
+  guint i;
+  guint j;
+
+  for (i = 0; i < n; i += CRANK_QUAT_FLOAT_BATCH_CHUNK)
+    {
+      guint cn = MIN (n - i, CRANK_QUAT_FLOAT_BATCH_CHUNK);
+
+      crank_quat_float_batch_split (cn, quat + i, s[0], s[1], s[2], s[3]);
+
+      for (j = 0; j < cn; j++)
+        {
+          s[4][j] = vec[i + j].x;
+          s[5][j] = vec[i + j].y;
+          s[6][j] = vec[i + j].z;
+        }
+
+      crank_quat_float_soa_rotatev (cn, s[0], s[1], s[2], s[3],
+                                    s[4], s[5], s[6],
+                                    s[4], s[5], s[6]);
+
+      for (j = 0; j < cn; j++)
+        {
+          r[i + j].x = s[4][j];
+          r[i + j].y = s[5][j];
+          r[i + j].z = s[6][j];
+        }
+    }
+}
+
+/**
+ * crank_quat_float_batch_to_mat_float4:
+ * @n: Count of quaternions.
+ * @quat: (array length=n): Quaternions.
+ * @r: (out caller-allocates) (array length=n): Array to store matrices.
+ *
+ * Converts @n quaternions to rotation matrices, which rotate vectors as
+ * crank_quat_float_rotatev() does.
+ */
+void
+crank_quat_float_batch_to_mat_float4 (const guint           n,
+                                      const CrankQuatFloat *quat,
+                                      CrankMatFloat4       *r)
+{
+  gfloat s[13][CRANK_QUAT_FLOAT_BATCH_CHUNK];
+  gfloat *m[9];
+  guint i;
+  guint j;
+
+  for (j = 0; j < 9; j++)
+    m[j] = s[4 + j];
+
+  for (i = 0; i < n; i += CRANK_QUAT_FLOAT_BATCH_CHUNK)
+    {
+      guint cn = MIN (n - i, CRANK_QUAT_FLOAT_BATCH_CHUNK);
+
+      crank_quat_float_batch_split (cn, quat + i, s[0], s[1], s[2], s[3]);
+
+#ifdef CRANK_CPU_X86
+      if (CRANK_CPU_SIMD_AVX <= _crank_cpu_get_simd_level ())
+        crank_quat_float_soa_rotm_avx (cn, s[0], s[1], s[2], s[3], m);
+      else
+#endif
+        crank_quat_float_soa_rotm_generic (cn, s[0], s[1], s[2], s[3], m);
+
+      for (j = 0; j < cn; j++)
+        {
+          CrankMatFloat4 *mat = r + i + j;
+
+          mat->m00 = m[0][j];
+          mat->m01 = m[1][j];
+          mat->m02 = m[2][j];
+          mat->m03 = 0;
+
+          mat->m10 = m[3][j];
+          mat->m11 = m[4][j];
+          mat->m12 = m[5][j];
+          mat->m13 = 0;
+
+          mat->m20 = m[6][j];
+          mat->m21 = m[7][j];
+          mat->m22 = m[8][j];
+          mat->m23 = 0;
+
+          mat->m30 = 0;
+          mat->m31 = 0;
+          mat->m32 = 0;
+          mat->m33 = 1;
+        }
+    }
+}
+
+
+/*
+ * Runs a function for each quaternions, so that @r may be same with @a.
+ */
+static void
+crank_quat_float_batch_each (const guint           n,
+                             const CrankQuatFloat *a,
+                             CrankQuatFloat       *r,
+                             void                (*func) (CrankQuatFloat *a,
+                                                          CrankQuatFloat *r))
+{
+  guint i;
+
+  for (i = 0; i < n; i++)
+    {
+      CrankQuatFloat e = a[i];
+
+      func (&e, r + i);
+    }
+}
+
+/**
+ * crank_quat_float_batch_ln:
+ * @n: Count of quaternions.
+ * @a: (array length=n): Quaternions.
+ * @r: (out caller-allocates) (array length=n): Array to store results.
+ *
+ * Gets natural logs of quaternions. @r may be same with @a.
+ *
+ * This uses crank_quat_float_batch_ln_fast(), if approximations are enabled
+ * by crank_fast_math_set_enabled().
+ */
+void
+crank_quat_float_batch_ln (const guint           n,
+                           const CrankQuatFloat *a,
+                           CrankQuatFloat       *r)
+{
+  if (crank_fast_math_get_enabled ())
+    crank_quat_float_batch_ln_fast (n, a, r);
+  else
+    crank_quat_float_batch_each (n, a, r, crank_quat_float_ln);
+}
+
+/**
+ * crank_quat_float_batch_exp:
+ * @n: Count of quaternions.
+ * @a: (array length=n): Quaternions.
+ * @r: (out caller-allocates) (array length=n): Array to store results.
+ *
+ * Gets e-based exponentials of quaternions. @r may be same with @a.
+ *
+ * This uses crank_quat_float_batch_exp_fast(), if approximations are enabled
+ * by crank_fast_math_set_enabled().
+ */
+void
+crank_quat_float_batch_exp (const guint           n,
+                            const CrankQuatFloat *a,
+                            CrankQuatFloat       *r)
+{
+  if (crank_fast_math_get_enabled ())
+    crank_quat_float_batch_exp_fast (n, a, r);
+  else
+    crank_quat_float_batch_each (n, a, r, crank_quat_float_exp);
+}
+
+/**
+ * crank_quat_float_batch_ln_fast:
+ * @n: Count of quaternions.
+ * @a: (array length=n): Quaternions.
+ * @r: (out caller-allocates) (array length=n): Array to store results.
+ *
+ * Gets approximated natural logs of quaternions, by vectorized kernels.
+ * @r may be same with @a.
+ *
+ * See crank_quat_float_ln_fast().
+ */
+void
+crank_quat_float_batch_ln_fast (const guint           n,
+                                const CrankQuatFloat *a,
+                                CrankQuatFloat       *r)
+{
+  gfloat s[6][CRANK_QUAT_FLOAT_BATCH_CHUNK];
+  guint i;
+  guint j;
+
+  for (i = 0; i < n; i += CRANK_QUAT_FLOAT_BATCH_CHUNK)
+    {
+      guint cn = MIN (n - i, CRANK_QUAT_FLOAT_BATCH_CHUNK);
+
+      crank_quat_float_batch_split (cn, a + i, s[0], s[1], s[2], s[3]);
+
+      // s[4]: Norm of imaginary part, s[5]: Square of norm.
+      for (j = 0; j < cn; j++)
+        {
+          gfloat nisq = s[1][j] * s[1][j] +
+                        s[2][j] * s[2][j] +
+                        s[3][j] * s[3][j];
+
+          s[4][j] = sqrtf (nisq);
+          s[5][j] = s[0][j] * s[0][j] + nisq;
+        }
+
+      crank_fast_atan2f_array (cn, s[4], s[0], s[0]);
+      crank_fast_logf_array (cn, s[5], s[5]);
+
+      for (j = 0; j < cn; j++)
+        {
+          gfloat k = (s[4][j] == 0) ? 0 : s[0][j] / s[4][j];
+
+          r[i + j].w = 0.5f * s[5][j];
+          r[i + j].x = s[1][j] * k;
+          r[i + j].y = s[2][j] * k;
+          r[i + j].z = s[3][j] * k;
+        }
+    }
+}
+
+/**
+ * crank_quat_float_batch_exp_fast:
+ * @n: Count of quaternions.
+ * @a: (array length=n): Quaternions.
+ * @r: (out caller-allocates) (array length=n): Array to store results.
+ *
+ * Gets approximated e-based exponentials of quaternions, by vectorized
+ * kernels. @r may be same with @a.
+ *
+ * See crank_quat_float_exp_fast().
+ */
+void
+crank_quat_float_batch_exp_fast (const guint           n,
+                                 const CrankQuatFloat *a,
+                                 CrankQuatFloat       *r)
+{
+  gfloat s[7][CRANK_QUAT_FLOAT_BATCH_CHUNK];
+  guint i;
+  guint j;
+
+  for (i = 0; i < n; i += CRANK_QUAT_FLOAT_BATCH_CHUNK)
+    {
+      guint cn = MIN (n - i, CRANK_QUAT_FLOAT_BATCH_CHUNK);
+
+      crank_quat_float_batch_split (cn, a + i, s[0], s[1], s[2], s[3]);
+
+      // s[4]: Norm of imaginary part.
+      for (j = 0; j < cn; j++)
+        s[4][j] = sqrtf (s[1][j] * s[1][j] +
+                         s[2][j] * s[2][j] +
+                         s[3][j] * s[3][j]);
+
+      crank_fast_expf_array (cn, s[0], s[0]);
+      crank_fast_sincosf_array (cn, s[4], s[5], s[6]);
+
+      for (j = 0; j < cn; j++)
+        {
+          gfloat k = (s[4][j] == 0) ?
+                     s[0][j] :
+                     s[0][j] * s[5][j] / s[4][j];
+
+          r[i + j].w = s[0][j] * s[6][j];
+          r[i + j].x = s[1][j] * k;
+          r[i + j].y = s[2][j] * k;
+          r[i + j].z = s[3][j] * k;
+        }
+    }
+}
+
+
 //////// GValue Conversion /////////////////////////////////////////////////////
 
 static void
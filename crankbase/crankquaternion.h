@@ -297,6 +297,12 @@ void            crank_quat_float_powr (CrankQuatFloat *a,
                                        const gfloat    b,
                                        CrankQuatFloat *r);
 
+void            crank_quat_float_ln_fast (CrankQuatFloat *a,
+                                          CrankQuatFloat *r);
+
+void            crank_quat_float_exp_fast (CrankQuatFloat *a,
+                                           CrankQuatFloat *r);
+
 
 //////// Rotation Operations ///////////////////////////////////////////////////
 
@@ -304,6 +310,113 @@ void            crank_quat_float_rotatev (CrankQuatFloat *quat,
                                           CrankVecFloat3 *vec,
                                           CrankVecFloat3 *r);
 
+//////// Batch Operations //////////////////////////////////////////////////////
+
+void            crank_quat_float_batch_mul (const guint           n,
+                                            const CrankQuatFloat *a,
+                                            const CrankQuatFloat *b,
+                                            CrankQuatFloat       *r);
+
+void            crank_quat_float_batch_nlerp (const guint           n,
+                                              const CrankQuatFloat *a,
+                                              const CrankQuatFloat *b,
+                                              const gfloat         *c,
+                                              CrankQuatFloat       *r);
+
+void            crank_quat_float_batch_slerp (const guint           n,
+                                              const CrankQuatFloat *a,
+                                              const CrankQuatFloat *b,
+                                              const gfloat         *c,
+                                              CrankQuatFloat       *r);
+
+void            crank_quat_float_batch_rotatev (const guint           n,
+                                                const CrankQuatFloat *quat,
+                                                const CrankVecFloat3 *vec,
+                                                CrankVecFloat3       *r);
+
+void            crank_quat_float_batch_rotatev_each (
+  const guint           n,
+  const CrankQuatFloat *quat,
+  const CrankVecFloat3 *vec,
+  CrankVecFloat3       *r);
+
+void            crank_quat_float_batch_to_mat_float4 (
+  const guint           n,
+  const CrankQuatFloat *quat,
+  CrankMatFloat4       *r);
+
+void            crank_quat_float_batch_ln (const guint           n,
+                                           const CrankQuatFloat *a,
+                                           CrankQuatFloat       *r);
+
+void            crank_quat_float_batch_exp (const guint           n,
+                                            const CrankQuatFloat *a,
+                                            CrankQuatFloat       *r);
+
+void            crank_quat_float_batch_ln_fast (const guint           n,
+                                                const CrankQuatFloat *a,
+                                                CrankQuatFloat       *r);
+
+void            crank_quat_float_batch_exp_fast (const guint           n,
+                                                 const CrankQuatFloat *a,
+                                                 CrankQuatFloat       *r);
+
+void            crank_quat_float_soa_mul (const guint   n,
+                                          const gfloat *aw,
+                                          const gfloat *ax,
+                                          const gfloat *ay,
+                                          const gfloat *az,
+                                          const gfloat *bw,
+                                          const gfloat *bx,
+                                          const gfloat *by,
+                                          const gfloat *bz,
+                                          gfloat       *rw,
+                                          gfloat       *rx,
+                                          gfloat       *ry,
+                                          gfloat       *rz);
+
+void            crank_quat_float_soa_nlerp (const guint   n,
+                                            const gfloat *aw,
+                                            const gfloat *ax,
+                                            const gfloat *ay,
+                                            const gfloat *az,
+                                            const gfloat *bw,
+                                            const gfloat *bx,
+                                            const gfloat *by,
+                                            const gfloat *bz,
+                                            const gfloat *c,
+                                            gfloat       *rw,
+                                            gfloat       *rx,
+                                            gfloat       *ry,
+                                            gfloat       *rz);
+
+void            crank_quat_float_soa_slerp (const guint   n,
+                                            const gfloat *aw,
+                                            const gfloat *ax,
+                                            const gfloat *ay,
+                                            const gfloat *az,
+                                            const gfloat *bw,
+                                            const gfloat *bx,
+                                            const gfloat *by,
+                                            const gfloat *bz,
+                                            const gfloat *c,
+                                            gfloat       *rw,
+                                            gfloat       *rx,
+                                            gfloat       *ry,
+                                            gfloat       *rz);
+
+void            crank_quat_float_soa_rotatev (const guint   n,
+                                              const gfloat *qw,
+                                              const gfloat *qx,
+                                              const gfloat *qy,
+                                              const gfloat *qz,
+                                              const gfloat *vx,
+                                              const gfloat *vy,
+                                              const gfloat *vz,
+                                              gfloat       *rx,
+                                              gfloat       *ry,
+                                              gfloat       *rz);
+
 //////// Generic Selectors /////////////////////////////////////////////////////
 
 #if !defined (_CRANK_INTERNAL) && (__STDC_VERSION__ >= 201112L)  // On C11, we will have Generic selectors.
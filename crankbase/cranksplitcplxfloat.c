@@ -0,0 +1,1027 @@
+/* Copyright (C) 2015, WSID   */
+
+/* Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#define _CRANKBASE_INSIDE
+
+#include <string.h>
+
+#include <glib.h>
+#include <glib-object.h>
+
+#include "crankcomplex.h"
+#include "crankveccommon.h"
+#include "crankvecfloat.h"
+#include "crankveccplxfloat.h"
+#include "crankmatcommon.h"
+#include "crankmatfloat.h"
+#include "crankmatcplxfloat.h"
+#include "crankmatarena.h"
+#include "cranksplitcplxfloat.h"
+
+#include "crankcpu-private.h"
+#include "crankgemm-private.h"
+#include "crankvecsimd-private.h"
+
+/**
+ * SECTION: cranksplitcplxfloat
+ * @title: Split Complex Float Vectors and Matrices
+ * @short_description: Complex vectors and matrices in split storage.
+ * @stability: unstable
+ * @include: crankbase.h
+ *
+ * #CrankVecCplxFloatN and #CrankMatCplxFloatN store array of #CrankCplxFloat,
+ * so real parts and imaginary parts are interleaved. Complex multiplication on
+ * interleaved storage needs shuffles between real and imaginary lanes, so it
+ * cannot fully use SIMD registers.
+ *
+ * #CrankVecSplitCplxFloat and #CrankMatSplitCplxFloat store real parts and
+ * imaginary parts in separate arrays. Complex operations on them are done by
+ * plain multiply-add on each arrays, without shuffles.
+ *
+ * # Conversion and Views
+ *
+ * Interleaved vectors and matrices can be converted to split ones, and back,
+ * by crank_vec_split_cplx_float_init_cplx() and
+ * crank_vec_split_cplx_float_to_cplx(). Conversion takes linear time, so it is
+ * best to keep data in split form over a pipeline.
+ *
+ * A split vector or matrix can be made on existing arrays without copying, by
+ * crank_vec_split_cplx_float_init_view(). Real parts and imaginary parts can
+ * also be viewed as #CrankVecFloatN or #CrankMatFloatN, so that real
+ * operations can be used on each parts. Views do not own the arrays, so they
+ * should not be finalized.
+ *
+ * # Operations
+ *
+ * Addition, subtraction, component-wise multiplication and dot product use
+ * SIMD kernels, selected by CPU features. Matrix multiplication is done by
+ * four real matrix multiplications, which use blocked kernel on large
+ * matrices.
+ */
+
+//////// Type Definition ///////////////////////////////////////////////////////
+
+G_DEFINE_BOXED_TYPE (CrankVecSplitCplxFloat,
+                     crank_vec_split_cplx_float,
+                     crank_vec_split_cplx_float_dup,
+                     crank_vec_split_cplx_float_free)
+
+G_DEFINE_BOXED_TYPE (CrankMatSplitCplxFloat,
+                     crank_mat_split_cplx_float,
+                     crank_mat_split_cplx_float_dup,
+                     crank_mat_split_cplx_float_free)
+
+
+//////// Private Functions /////////////////////////////////////////////////////
+
+static void crank_split_cplx_float_alloc (const gsize   n,
+                                          gfloat      **real,
+                                          gfloat      **imag);
+
+static void crank_mat_split_cplx_float_mul_small (CrankMatSplitCplxFloat *a,
+                                                  CrankMatSplitCplxFloat *b,
+                                                  CrankMatSplitCplxFloat *r);
+
+static void crank_mat_split_cplx_float_mul_blocked (CrankMatSplitCplxFloat *a,
+                                                    CrankMatSplitCplxFloat *b,
+                                                    CrankMatSplitCplxFloat *r);
+
+
+//////// Vector: Initialization ////////////////////////////////////////////////
+
+/**
+ * crank_vec_split_cplx_float_init_fill:
+ * @vec: (out): A Vector to initialize.
+ * @n: Size of vector.
+ * @fill: A Value to fill.
+ *
+ * Initializes a vector, filled with a value.
+ */
+void
+crank_vec_split_cplx_float_init_fill (CrankVecSplitCplxFloat *vec,
+                                      const guint             n,
+                                      CrankCplxFloat         *fill)
+{
+  guint i;
+
+  crank_split_cplx_float_alloc (n, &vec->real, &vec->imag);
+  vec->n = n;
+
+  for (i = 0; i < n; i++)
+    {
+      vec->real[i] = fill->real;
+      vec->imag[i] = fill->imag;
+    }
+}
+
+/**
+ * crank_vec_split_cplx_float_init_view:
+ * @vec: (out): A Vector to initialize.
+ * @n: Size of vector.
+ * @real: (array length=n): Real parts.
+ * @imag: (array length=n): Imaginary parts.
+ *
+ * Initializes a vector on given arrays, without copying. The vector does not
+ * own the arrays, so it should not be finalized.
+ */
+void
+crank_vec_split_cplx_float_init_view (CrankVecSplitCplxFloat *vec,
+                                      const guint             n,
+                                      gfloat                 *real,
+                                      gfloat                 *imag)
+{
+  vec->real = real;
+  vec->imag = imag;
+  vec->n = n;
+}
+
+/**
+ * crank_vec_split_cplx_float_init_cplx:
+ * @vec: (out): A Vector to initialize.
+ * @cplx: A Complex vector, in interleaved storage.
+ *
+ * Initializes a vector from interleaved complex vector.
+ */
+void
+crank_vec_split_cplx_float_init_cplx (CrankVecSplitCplxFloat *vec,
+                                      CrankVecCplxFloatN     *cplx)
+{
+  guint i;
+
+  crank_split_cplx_float_alloc (cplx->n, &vec->real, &vec->imag);
+  vec->n = cplx->n;
+
+  for (i = 0; i < cplx->n; i++)
+    {
+      vec->real[i] = cplx->data[i].real;
+      vec->imag[i] = cplx->data[i].imag;
+    }
+}
+
+/**
+ * crank_vec_split_cplx_float_copy:
+ * @vec: A Vector.
+ * @other: (out): A Vector to copy on.
+ *
+ * Copies a vector. The copy owns its arrays, even if @vec is a view.
+ */
+void
+crank_vec_split_cplx_float_copy (CrankVecSplitCplxFloat *vec,
+                                 CrankVecSplitCplxFloat *other)
+{
+  crank_split_cplx_float_alloc (vec->n, &other->real, &other->imag);
+  other->n = vec->n;
+
+  memcpy (other->real, vec->real, sizeof (gfloat) * vec->n);
+  memcpy (other->imag, vec->imag, sizeof (gfloat) * vec->n);
+}
+
+/**
+ * crank_vec_split_cplx_float_dup:
+ * @vec: A Vector.
+ *
+ * Allocates a vector and copy on it.
+ *
+ * Returns: an allocated copy. Free it with crank_vec_split_cplx_float_free()
+ */
+CrankVecSplitCplxFloat*
+crank_vec_split_cplx_float_dup (CrankVecSplitCplxFloat *vec)
+{
+  CrankVecSplitCplxFloat *result = g_new (CrankVecSplitCplxFloat, 1);
+  crank_vec_split_cplx_float_copy (vec, result);
+  return result;
+}
+
+/**
+ * crank_vec_split_cplx_float_fini:
+ * @vec: A Vector to reset.
+ *
+ * Resets a vector and frees its associated memory blocks.
+ */
+void
+crank_vec_split_cplx_float_fini (CrankVecSplitCplxFloat *vec)
+{
+  g_free (vec->real);
+  g_free (vec->imag);
+
+  vec->real = NULL;
+  vec->imag = NULL;
+  vec->n = 0;
+}
+
+/**
+ * crank_vec_split_cplx_float_free:
+ * @vec: A Vector to free.
+ *
+ * Frees an allocated vector and its associated memory blocks.
+ */
+void
+crank_vec_split_cplx_float_free (CrankVecSplitCplxFloat *vec)
+{
+  crank_vec_split_cplx_float_fini (vec);
+  g_free (vec);
+}
+
+
+//////// Vector: Attributes ////////////////////////////////////////////////////
+
+/**
+ * crank_vec_split_cplx_float_get_size:
+ * @vec: A Vector.
+ *
+ * Gets size of vector.
+ *
+ * Returns: Size of vector.
+ */
+guint
+crank_vec_split_cplx_float_get_size (CrankVecSplitCplxFloat *vec)
+{
+  return vec->n;
+}
+
+/**
+ * crank_vec_split_cplx_float_get:
+ * @vec: A Vector.
+ * @i: Index.
+ * @r: (out): A Complex to store element.
+ *
+ * Gets an element of vector.
+ */
+void
+crank_vec_split_cplx_float_get (CrankVecSplitCplxFloat *vec,
+                                const guint             i,
+                                CrankCplxFloat         *r)
+{
+  g_return_if_fail (i < vec->n);
+
+  r->real = vec->real[i];
+  r->imag = vec->imag[i];
+}
+
+/**
+ * crank_vec_split_cplx_float_set:
+ * @vec: A Vector.
+ * @i: Index.
+ * @v: A Complex to set.
+ *
+ * Sets an element of vector.
+ */
+void
+crank_vec_split_cplx_float_set (CrankVecSplitCplxFloat *vec,
+                                const guint             i,
+                                CrankCplxFloat         *v)
+{
+  g_return_if_fail (i < vec->n);
+
+  vec->real[i] = v->real;
+  vec->imag[i] = v->imag;
+}
+
+/**
+ * crank_vec_split_cplx_float_get_real_view:
+ * @vec: A Vector.
+ * @r: (out): A Vector to view real parts.
+ *
+ * Gets real parts as a real vector, without copying. @r shares the array with
+ * @vec, so it should not be finalized.
+ */
+void
+crank_vec_split_cplx_float_get_real_view (CrankVecSplitCplxFloat *vec,
+                                          CrankVecFloatN         *r)
+{
+  r->data = vec->real;
+  r->n = vec->n;
+}
+
+/**
+ * crank_vec_split_cplx_float_get_imag_view:
+ * @vec: A Vector.
+ * @r: (out): A Vector to view imaginary parts.
+ *
+ * Gets imaginary parts as a real vector, without copying. @r shares the array
+ * with @vec, so it should not be finalized.
+ */
+void
+crank_vec_split_cplx_float_get_imag_view (CrankVecSplitCplxFloat *vec,
+                                          CrankVecFloatN         *r)
+{
+  r->data = vec->imag;
+  r->n = vec->n;
+}
+
+/**
+ * crank_vec_split_cplx_float_to_cplx:
+ * @vec: A Vector.
+ * @r: (out): A Vector to initialize, in interleaved storage.
+ *
+ * Converts a vector to interleaved complex vector.
+ */
+void
+crank_vec_split_cplx_float_to_cplx (CrankVecSplitCplxFloat *vec,
+                                    CrankVecCplxFloatN     *r)
+{
+  guint i;
+
+  CRANK_VEC_ALLOC (r, CrankCplxFloat, vec->n);
+
+  for (i = 0; i < vec->n; i++)
+    {
+      r->data[i].real = vec->real[i];
+      r->data[i].imag = vec->imag[i];
+    }
+}
+
+
+//////// Vector: Operations ////////////////////////////////////////////////////
+
+/**
+ * crank_vec_split_cplx_float_add:
+ * @a: A Vector.
+ * @b: A Vector.
+ * @r: (out): A Vector to store result.
+ *
+ * Adds two vectors.
+ */
+void
+crank_vec_split_cplx_float_add (CrankVecSplitCplxFloat *a,
+                                CrankVecSplitCplxFloat *b,
+                                CrankVecSplitCplxFloat *r)
+{
+  const CrankVecFloatKernels *kernels = _crank_vec_float_get_kernels ();
+
+  g_return_if_fail (a != r);
+  g_return_if_fail (b != r);
+
+  CRANK_VEC_WARN_IF_SIZE_MISMATCH2 ("VecSplitCplxFloat", "add", a, b);
+
+  crank_split_cplx_float_alloc (a->n, &r->real, &r->imag);
+  r->n = a->n;
+
+  kernels->add (a->n, a->real, b->real, r->real);
+  kernels->add (a->n, a->imag, b->imag, r->imag);
+}
+
+/**
+ * crank_vec_split_cplx_float_sub:
+ * @a: A Vector.
+ * @b: A Vector.
+ * @r: (out): A Vector to store result.
+ *
+ * Subtracts a vector from another.
+ */
+void
+crank_vec_split_cplx_float_sub (CrankVecSplitCplxFloat *a,
+                                CrankVecSplitCplxFloat *b,
+                                CrankVecSplitCplxFloat *r)
+{
+  const CrankVecFloatKernels *kernels = _crank_vec_float_get_kernels ();
+
+  g_return_if_fail (a != r);
+  g_return_if_fail (b != r);
+
+  CRANK_VEC_WARN_IF_SIZE_MISMATCH2 ("VecSplitCplxFloat", "sub", a, b);
+
+  crank_split_cplx_float_alloc (a->n, &r->real, &r->imag);
+  r->n = a->n;
+
+  kernels->sub (a->n, a->real, b->real, r->real);
+  kernels->sub (a->n, a->imag, b->imag, r->imag);
+}
+
+/**
+ * crank_vec_split_cplx_float_muls:
+ * @a: A Vector.
+ * @b: A Complex.
+ * @r: (out): A Vector to store result.
+ *
+ * Multiplies a vector by complex scalar.
+ */
+void
+crank_vec_split_cplx_float_muls (CrankVecSplitCplxFloat *a,
+                                 CrankCplxFloat         *b,
+                                 CrankVecSplitCplxFloat *r)
+{
+  gfloat br = b->real;
+  gfloat bi = b->imag;
+  guint i;
+
+  g_return_if_fail (a != r);
+
+  crank_split_cplx_float_alloc (a->n, &r->real, &r->imag);
+  r->n = a->n;
+
+  for (i = 0; i < a->n; i++)
+    {
+      r->real[i] = a->real[i] * br - a->imag[i] * bi;
+      r->imag[i] = a->real[i] * bi + a->imag[i] * br;
+    }
+}
+
+/**
+ * crank_vec_split_cplx_float_cmpmul:
+ * @a: A Vector.
+ * @b: A Vector.
+ * @r: (out): A Vector to store result.
+ *
+ * Multiplies two vectors, component-wise.
+ */
+void
+crank_vec_split_cplx_float_cmpmul (CrankVecSplitCplxFloat *a,
+                                   CrankVecSplitCplxFloat *b,
+                                   CrankVecSplitCplxFloat *r)
+{
+  g_return_if_fail (a != r);
+  g_return_if_fail (b != r);
+
+  CRANK_VEC_WARN_IF_SIZE_MISMATCH2 ("VecSplitCplxFloat", "cmpmul", a, b);
+
+  crank_split_cplx_float_alloc (a->n, &r->real, &r->imag);
+  r->n = a->n;
+
+  _crank_vec_float_get_kernels ()->cmul (a->n,
+                                         a->real, a->imag,
+                                         b->real, b->imag,
+                                         r->real, r->imag);
+}
+
+/**
+ * crank_vec_split_cplx_float_dot:
+ * @a: A Vector.
+ * @b: A Vector.
+ * @r: (out): A Complex to store result.
+ *
+ * Gets dot product of two vectors. As crank_vec_cplx_float_n_dot(), @b is
+ * conjugated. (sum of a * conj (b))
+ */
+void
+crank_vec_split_cplx_float_dot (CrankVecSplitCplxFloat *a,
+                                CrankVecSplitCplxFloat *b,
+                                CrankCplxFloat         *r)
+{
+  CRANK_VEC_WARN_IF_SIZE_MISMATCH2 ("VecSplitCplxFloat", "dot", a, b);
+
+  _crank_vec_float_get_kernels ()->cdot (a->n,
+                                         a->real, a->imag,
+                                         b->real, b->imag,
+                                         &r->real, &r->imag);
+}
+
+
+//////// Matrix: Initialization ////////////////////////////////////////////////
+
+/**
+ * crank_mat_split_cplx_float_init_fill:
+ * @mat: (out): A Matrix to initialize.
+ * @rn: Row count.
+ * @cn: Column count.
+ * @fill: A Value to fill.
+ *
+ * Initializes a matrix, filled with a value.
+ */
+void
+crank_mat_split_cplx_float_init_fill (CrankMatSplitCplxFloat *mat,
+                                      const guint             rn,
+                                      const guint             cn,
+                                      CrankCplxFloat         *fill)
+{
+  gsize n = (gsize) rn * cn;
+  gsize i;
+
+  crank_split_cplx_float_alloc (n, &mat->real, &mat->imag);
+  mat->rn = rn;
+  mat->cn = cn;
+
+  for (i = 0; i < n; i++)
+    {
+      mat->real[i] = fill->real;
+      mat->imag[i] = fill->imag;
+    }
+}
+
+/**
+ * crank_mat_split_cplx_float_init_view:
+ * @mat: (out): A Matrix to initialize.
+ * @rn: Row count.
+ * @cn: Column count.
+ * @real: (array): Real parts, in row-major order.
+ * @imag: (array): Imaginary parts, in row-major order.
+ *
+ * Initializes a matrix on given arrays, without copying. The matrix does not
+ * own the arrays, so it should not be finalized.
+ */
+void
+crank_mat_split_cplx_float_init_view (CrankMatSplitCplxFloat *mat,
+                                      const guint             rn,
+                                      const guint             cn,
+                                      gfloat                 *real,
+                                      gfloat                 *imag)
+{
+  mat->real = real;
+  mat->imag = imag;
+  mat->rn = rn;
+  mat->cn = cn;
+}
+
+/**
+ * crank_mat_split_cplx_float_init_cplx:
+ * @mat: (out): A Matrix to initialize.
+ * @cplx: A Complex matrix, in interleaved storage.
+ *
+ * Initializes a matrix from interleaved complex matrix.
+ */
+void
+crank_mat_split_cplx_float_init_cplx (CrankMatSplitCplxFloat *mat,
+                                      CrankMatCplxFloatN     *cplx)
+{
+  gsize n = (gsize) cplx->rn * cplx->cn;
+  gsize i;
+
+  crank_split_cplx_float_alloc (n, &mat->real, &mat->imag);
+  mat->rn = cplx->rn;
+  mat->cn = cplx->cn;
+
+  for (i = 0; i < n; i++)
+    {
+      mat->real[i] = cplx->data[i].real;
+      mat->imag[i] = cplx->data[i].imag;
+    }
+}
+
+/**
+ * crank_mat_split_cplx_float_copy:
+ * @mat: A Matrix.
+ * @other: (out): A Matrix to copy on.
+ *
+ * Copies a matrix. The copy owns its arrays, even if @mat is a view.
+ */
+void
+crank_mat_split_cplx_float_copy (CrankMatSplitCplxFloat *mat,
+                                 CrankMatSplitCplxFloat *other)
+{
+  gsize n = (gsize) mat->rn * mat->cn;
+
+  crank_split_cplx_float_alloc (n, &other->real, &other->imag);
+  other->rn = mat->rn;
+  other->cn = mat->cn;
+
+  memcpy (other->real, mat->real, sizeof (gfloat) * n);
+  memcpy (other->imag, mat->imag, sizeof (gfloat) * n);
+}
+
+/**
+ * crank_mat_split_cplx_float_dup:
+ * @mat: A Matrix.
+ *
+ * Allocates a matrix and copy on it.
+ *
+ * Returns: an allocated copy. Free it with crank_mat_split_cplx_float_free()
+ */
+CrankMatSplitCplxFloat*
+crank_mat_split_cplx_float_dup (CrankMatSplitCplxFloat *mat)
+{
+  CrankMatSplitCplxFloat *result = g_new (CrankMatSplitCplxFloat, 1);
+  crank_mat_split_cplx_float_copy (mat, result);
+  return result;
+}
+
+/**
+ * crank_mat_split_cplx_float_fini:
+ * @mat: A Matrix to reset.
+ *
+ * Resets a matrix and frees its associated memory blocks.
+ */
+void
+crank_mat_split_cplx_float_fini (CrankMatSplitCplxFloat *mat)
+{
+  g_free (mat->real);
+  g_free (mat->imag);
+
+  mat->real = NULL;
+  mat->imag = NULL;
+  mat->rn = 0;
+  mat->cn = 0;
+}
+
+/**
+ * crank_mat_split_cplx_float_free:
+ * @mat: A Matrix to free.
+ *
+ * Frees an allocated matrix and its associated memory blocks.
+ */
+void
+crank_mat_split_cplx_float_free (CrankMatSplitCplxFloat *mat)
+{
+  crank_mat_split_cplx_float_fini (mat);
+  g_free (mat);
+}
+
+
+//////// Matrix: Attributes ////////////////////////////////////////////////////
+
+/**
+ * crank_mat_split_cplx_float_get_row_size:
+ * @mat: A Matrix.
+ *
+ * Gets row count of matrix.
+ *
+ * Returns: Row count.
+ */
+guint
+crank_mat_split_cplx_float_get_row_size (CrankMatSplitCplxFloat *mat)
+{
+  return mat->rn;
+}
+
+/**
+ * crank_mat_split_cplx_float_get_col_size:
+ * @mat: A Matrix.
+ *
+ * Gets column count of matrix.
+ *
+ * Returns: Column count.
+ */
+guint
+crank_mat_split_cplx_float_get_col_size (CrankMatSplitCplxFloat *mat)
+{
+  return mat->cn;
+}
+
+/**
+ * crank_mat_split_cplx_float_get:
+ * @mat: A Matrix.
+ * @i: Row index.
+ * @j: Column index.
+ * @r: (out): A Complex to store element.
+ *
+ * Gets an element of matrix.
+ */
+void
+crank_mat_split_cplx_float_get (CrankMatSplitCplxFloat *mat,
+                                const guint             i,
+                                const guint             j,
+                                CrankCplxFloat         *r)
+{
+  gsize index = ((gsize) i * mat->cn) + j;
+
+  g_return_if_fail ((i < mat->rn) && (j < mat->cn));
+
+  r->real = mat->real[index];
+  r->imag = mat->imag[index];
+}
+
+/**
+ * crank_mat_split_cplx_float_set:
+ * @mat: A Matrix.
+ * @i: Row index.
+ * @j: Column index.
+ * @v: A Complex to set.
+ *
+ * Sets an element of matrix.
+ */
+void
+crank_mat_split_cplx_float_set (CrankMatSplitCplxFloat *mat,
+                                const guint             i,
+                                const guint             j,
+                                CrankCplxFloat         *v)
+{
+  gsize index = ((gsize) i * mat->cn) + j;
+
+  g_return_if_fail ((i < mat->rn) && (j < mat->cn));
+
+  mat->real[index] = v->real;
+  mat->imag[index] = v->imag;
+}
+
+/**
+ * crank_mat_split_cplx_float_get_real_view:
+ * @mat: A Matrix.
+ * @r: (out): A Matrix to view real parts.
+ *
+ * Gets real parts as a real matrix, without copying. @r shares the array with
+ * @mat, so it should not be finalized.
+ */
+void
+crank_mat_split_cplx_float_get_real_view (CrankMatSplitCplxFloat *mat,
+                                          CrankMatFloatN         *r)
+{
+  r->data = mat->real;
+  r->rn = mat->rn;
+  r->cn = mat->cn;
+}
+
+/**
+ * crank_mat_split_cplx_float_get_imag_view:
+ * @mat: A Matrix.
+ * @r: (out): A Matrix to view imaginary parts.
+ *
+ * Gets imaginary parts as a real matrix, without copying. @r shares the array
+ * with @mat, so it should not be finalized.
+ */
+void
+crank_mat_split_cplx_float_get_imag_view (CrankMatSplitCplxFloat *mat,
+                                          CrankMatFloatN         *r)
+{
+  r->data = mat->imag;
+  r->rn = mat->rn;
+  r->cn = mat->cn;
+}
+
+/**
+ * crank_mat_split_cplx_float_get_row_view:
+ * @mat: A Matrix.
+ * @i: Row index.
+ * @r: (out): A Vector to view a row.
+ *
+ * Gets a row as a vector, without copying. @r shares the arrays with @mat, so
+ * it should not be finalized.
+ */
+void
+crank_mat_split_cplx_float_get_row_view (CrankMatSplitCplxFloat *mat,
+                                         const guint             i,
+                                         CrankVecSplitCplxFloat *r)
+{
+  gsize index = (gsize) i * mat->cn;
+
+  g_return_if_fail (i < mat->rn);
+
+  crank_vec_split_cplx_float_init_view (r, mat->cn,
+                                        mat->real + index,
+                                        mat->imag + index);
+}
+
+/**
+ * crank_mat_split_cplx_float_to_cplx:
+ * @mat: A Matrix.
+ * @r: (out): A Matrix to initialize, in interleaved storage.
+ *
+ * Converts a matrix to interleaved complex matrix.
+ */
+void
+crank_mat_split_cplx_float_to_cplx (CrankMatSplitCplxFloat *mat,
+                                    CrankMatCplxFloatN     *r)
+{
+  gsize n = (gsize) mat->rn * mat->cn;
+  gsize i;
+
+  CRANK_MAT_ALLOC (r, CrankCplxFloat, mat->rn, mat->cn);
+
+  for (i = 0; i < n; i++)
+    {
+      r->data[i].real = mat->real[i];
+      r->data[i].imag = mat->imag[i];
+    }
+}
+
+
+//////// Matrix: Operations ////////////////////////////////////////////////////
+
+/**
+ * crank_mat_split_cplx_float_add:
+ * @a: A Matrix.
+ * @b: A Matrix.
+ * @r: (out): A Matrix to store result.
+ *
+ * Adds two matrices.
+ */
+void
+crank_mat_split_cplx_float_add (CrankMatSplitCplxFloat *a,
+                                CrankMatSplitCplxFloat *b,
+                                CrankMatSplitCplxFloat *r)
+{
+  const CrankVecFloatKernels *kernels = _crank_vec_float_get_kernels ();
+  gsize n = (gsize) a->rn * a->cn;
+
+  g_return_if_fail (a != r);
+  g_return_if_fail (b != r);
+
+  CRANK_MAT_WARN_IF_SIZE_MISMATCH2 ("MatSplitCplxFloat", "add", a, b);
+
+  crank_split_cplx_float_alloc (n, &r->real, &r->imag);
+  r->rn = a->rn;
+  r->cn = a->cn;
+
+  kernels->add (n, a->real, b->real, r->real);
+  kernels->add (n, a->imag, b->imag, r->imag);
+}
+
+/**
+ * crank_mat_split_cplx_float_sub:
+ * @a: A Matrix.
+ * @b: A Matrix.
+ * @r: (out): A Matrix to store result.
+ *
+ * Subtracts a matrix from another.
+ */
+void
+crank_mat_split_cplx_float_sub (CrankMatSplitCplxFloat *a,
+                                CrankMatSplitCplxFloat *b,
+                                CrankMatSplitCplxFloat *r)
+{
+  const CrankVecFloatKernels *kernels = _crank_vec_float_get_kernels ();
+  gsize n = (gsize) a->rn * a->cn;
+
+  g_return_if_fail (a != r);
+  g_return_if_fail (b != r);
+
+  CRANK_MAT_WARN_IF_SIZE_MISMATCH2 ("MatSplitCplxFloat", "sub", a, b);
+
+  crank_split_cplx_float_alloc (n, &r->real, &r->imag);
+  r->rn = a->rn;
+  r->cn = a->cn;
+
+  kernels->sub (n, a->real, b->real, r->real);
+  kernels->sub (n, a->imag, b->imag, r->imag);
+}
+
+/**
+ * crank_mat_split_cplx_float_mulv:
+ * @a: A Matrix.
+ * @b: A Vector.
+ * @r: (out): A Vector to store result.
+ *
+ * Multiplies a matrix by a vector.
+ */
+void
+crank_mat_split_cplx_float_mulv (CrankMatSplitCplxFloat *a,
+                                 CrankVecSplitCplxFloat *b,
+                                 CrankVecSplitCplxFloat *r)
+{
+  const CrankVecFloatKernels *kernels = _crank_vec_float_get_kernels ();
+  CrankMatArena *arena = crank_mat_arena_get_scratch ();
+  gsize mark;
+  gfloat *bconj;
+  guint i;
+
+  g_return_if_fail (b != r);
+
+  if (G_UNLIKELY (a->cn != b->n))
+    {
+      g_warning ("MatSplitCplxFloat: mulv: size mismatch: %ux%u, %u",
+                 a->rn, a->cn, b->n);
+      return;
+    }
+
+  crank_split_cplx_float_alloc (a->rn, &r->real, &r->imag);
+  r->n = a->rn;
+
+  // Dot kernel conjugates second operand, so it takes conjugate of b.
+  mark = crank_mat_arena_get_mark (arena);
+  bconj = crank_mat_arena_alloc (arena, sizeof (gfloat) * b->n);
+  kernels->muls (b->n, b->imag, -1, bconj);
+
+  for (i = 0; i < a->rn; i++)
+    {
+      gsize index = (gsize) i * a->cn;
+
+      kernels->cdot (a->cn,
+                     a->real + index, a->imag + index,
+                     b->real, bconj,
+                     r->real + i, r->imag + i);
+    }
+
+  crank_mat_arena_rewind (arena, mark);
+}
+
+/**
+ * crank_mat_split_cplx_float_mul:
+ * @a: A Matrix.
+ * @b: A Matrix.
+ * @r: (out): A Matrix to store result.
+ *
+ * Multiplies two matrices.
+ *
+ * Product is computed by four real products of real parts and imaginary parts.
+ * On large matrices, they use blocked kernel of crank_mat_float_n_mul().
+ */
+void
+crank_mat_split_cplx_float_mul (CrankMatSplitCplxFloat *a,
+                                CrankMatSplitCplxFloat *b,
+                                CrankMatSplitCplxFloat *r)
+{
+  gsize n;
+
+  g_return_if_fail (a != r);
+  g_return_if_fail (b != r);
+
+  if (G_UNLIKELY (a->cn != b->rn))
+    {
+      g_warning ("MatSplitCplxFloat: mul: size mismatch: %ux%u, %ux%u",
+                 a->rn, a->cn, b->rn, b->cn);
+      return;
+    }
+
+  n = (gsize) a->rn * b->cn;
+
+  crank_split_cplx_float_alloc (n, &r->real, &r->imag);
+  r->rn = a->rn;
+  r->cn = b->cn;
+
+  memset (r->real, 0, sizeof (gfloat) * n);
+  memset (r->imag, 0, sizeof (gfloat) * n);
+
+  if ((guint64) a->rn * b->cn * a->cn < CRANK_GEMM_FLOAT_THRESHOLD)
+    crank_mat_split_cplx_float_mul_small (a, b, r);
+  else
+    crank_mat_split_cplx_float_mul_blocked (a, b, r);
+}
+
+
+//////// Private Functions /////////////////////////////////////////////////////
+
+/*
+ * Allocates real parts and imaginary parts, in aligned blocks.
+ */
+static void
+crank_split_cplx_float_alloc (const gsize   n,
+                              gfloat      **real,
+                              gfloat      **imag)
+{
+  *real = _crank_cpu_alloc_aligned (sizeof (gfloat) * n);
+  *imag = _crank_cpu_alloc_aligned (sizeof (gfloat) * n);
+}
+
+/*
+ * Accumulates product of small matrices on r. Inner loop runs over a row of b
+ * and r, so compiler can vectorize it.
+ */
+static void
+crank_mat_split_cplx_float_mul_small (CrankMatSplitCplxFloat *a,
+                                      CrankMatSplitCplxFloat *b,
+                                      CrankMatSplitCplxFloat *r)
+{
+  guint i;
+  guint j;
+  guint k;
+
+  for (i = 0; i < a->rn; i++)
+    {
+      gfloat *rr = r->real + ((gsize) i * r->cn);
+      gfloat *ri = r->imag + ((gsize) i * r->cn);
+
+      for (k = 0; k < a->cn; k++)
+        {
+          gsize aindex = ((gsize) i * a->cn) + k;
+          gfloat ar = a->real[aindex];
+          gfloat ai = a->imag[aindex];
+          gfloat *br = b->real + ((gsize) k * b->cn);
+          gfloat *bi = b->imag + ((gsize) k * b->cn);
+
+          for (j = 0; j < b->cn; j++)
+            {
+              rr[j] += ar * br[j] - ai * bi[j];
+              ri[j] += ar * bi[j] + ai * br[j];
+            }
+        }
+    }
+}
+
+/*
+ * Accumulates product of large matrices on r, by four real products.
+ *
+ * real (r) = real (a) real (b) - imag (a) imag (b)
+ * imag (r) = real (a) imag (b) + imag (a) real (b)
+ */
+static void
+crank_mat_split_cplx_float_mul_blocked (CrankMatSplitCplxFloat *a,
+                                        CrankMatSplitCplxFloat *b,
+                                        CrankMatSplitCplxFloat *r)
+{
+  CrankMatArena *arena = crank_mat_arena_get_scratch ();
+  gsize an = (gsize) a->rn * a->cn;
+  gsize mark;
+  gfloat *aineg;
+
+  mark = crank_mat_arena_get_mark (arena);
+  aineg = crank_mat_arena_alloc (arena, sizeof (gfloat) * an);
+  _crank_vec_float_get_kernels ()->muls (an, a->imag, -1, aineg);
+
+  _crank_gemm_float (a->rn, b->cn, a->cn, a->real, a->cn,
+                     b->real, b->cn, r->real, r->cn);
+  _crank_gemm_float (a->rn, b->cn, a->cn, aineg, a->cn,
+                     b->imag, b->cn, r->real, r->cn);
+
+  _crank_gemm_float (a->rn, b->cn, a->cn, a->real, a->cn,
+                     b->imag, b->cn, r->imag, r->cn);
+  _crank_gemm_float (a->rn, b->cn, a->cn, a->imag, a->cn,
+                     b->real, b->cn, r->imag, r->cn);
+
+  crank_mat_arena_rewind (arena, mark);
+}
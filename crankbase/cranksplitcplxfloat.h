@@ -0,0 +1,234 @@
+#ifndef CRANKSPLITCPLXFLOAT_H
+#define CRANKSPLITCPLXFLOAT_H
+
+/* Copyright (C) 2015, WSID   */
+
+/* Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef _CRANKBASE_INSIDE
+#error cranksplitcplxfloat.h cannot be included directly.
+#endif
+
+#include <glib.h>
+#include <glib-object.h>
+
+#include "crankcomplex.h"
+#include "crankveccommon.h"
+#include "crankvecfloat.h"
+#include "crankveccplxfloat.h"
+#include "crankmatfloat.h"
+#include "crankmatcplxfloat.h"
+
+G_BEGIN_DECLS
+
+//////// Type Definition ///////////////////////////////////////////////////////
+
+#define CRANK_TYPE_VEC_SPLIT_CPLX_FLOAT (crank_vec_split_cplx_float_get_type ())
+GType crank_vec_split_cplx_float_get_type (void);
+
+#define CRANK_TYPE_MAT_SPLIT_CPLX_FLOAT (crank_mat_split_cplx_float_get_type ())
+GType crank_mat_split_cplx_float_get_type (void);
+
+/**
+ * CrankVecSplitCplxFloat:
+ * @real: (array length=n): Real parts.
+ * @imag: (array length=n): Imaginary parts.
+ * @n: Size of vector.
+ *
+ * Represents a variable sized complex vector, whose real parts and imaginary
+ * parts are stored in separate arrays.
+ */
+typedef struct _CrankVecSplitCplxFloat {
+  gfloat *real;
+  gfloat *imag;
+  guint   n;
+} CrankVecSplitCplxFloat;
+
+/**
+ * CrankMatSplitCplxFloat:
+ * @real: (array): Real parts, in row-major order.
+ * @imag: (array): Imaginary parts, in row-major order.
+ * @rn: Row count.
+ * @cn: Column count.
+ *
+ * Represents a variable sized complex matrix, whose real parts and imaginary
+ * parts are stored in separate arrays.
+ */
+typedef struct _CrankMatSplitCplxFloat {
+  gfloat *real;
+  gfloat *imag;
+  guint   rn;
+  guint   cn;
+} CrankMatSplitCplxFloat;
+
+
+//////// Vector: Initialization ////////////////////////////////////////////////
+
+void      crank_vec_split_cplx_float_init_fill  (CrankVecSplitCplxFloat *vec,
+                                                 const guint             n,
+                                                 CrankCplxFloat         *fill);
+
+void      crank_vec_split_cplx_float_init_view  (CrankVecSplitCplxFloat *vec,
+                                                 const guint             n,
+                                                 gfloat                 *real,
+                                                 gfloat                 *imag);
+
+void      crank_vec_split_cplx_float_init_cplx  (CrankVecSplitCplxFloat *vec,
+                                                 CrankVecCplxFloatN     *cplx);
+
+void      crank_vec_split_cplx_float_copy       (CrankVecSplitCplxFloat *vec,
+                                                 CrankVecSplitCplxFloat *other);
+
+CrankVecSplitCplxFloat *crank_vec_split_cplx_float_dup (
+  CrankVecSplitCplxFloat *vec);
+
+void      crank_vec_split_cplx_float_fini       (CrankVecSplitCplxFloat *vec);
+
+void      crank_vec_split_cplx_float_free       (CrankVecSplitCplxFloat *vec);
+
+
+//////// Vector: Attributes ////////////////////////////////////////////////////
+
+guint     crank_vec_split_cplx_float_get_size   (CrankVecSplitCplxFloat *vec);
+
+void      crank_vec_split_cplx_float_get        (CrankVecSplitCplxFloat *vec,
+                                                 const guint             i,
+                                                 CrankCplxFloat         *r);
+
+void      crank_vec_split_cplx_float_set        (CrankVecSplitCplxFloat *vec,
+                                                 const guint             i,
+                                                 CrankCplxFloat         *v);
+
+void      crank_vec_split_cplx_float_get_real_view (
+  CrankVecSplitCplxFloat *vec,
+  CrankVecFloatN         *r);
+
+void      crank_vec_split_cplx_float_get_imag_view (
+  CrankVecSplitCplxFloat *vec,
+  CrankVecFloatN         *r);
+
+void      crank_vec_split_cplx_float_to_cplx    (CrankVecSplitCplxFloat *vec,
+                                                 CrankVecCplxFloatN     *r);
+
+
+//////// Vector: Operations ////////////////////////////////////////////////////
+
+void      crank_vec_split_cplx_float_add        (CrankVecSplitCplxFloat *a,
+                                                 CrankVecSplitCplxFloat *b,
+                                                 CrankVecSplitCplxFloat *r);
+
+void      crank_vec_split_cplx_float_sub        (CrankVecSplitCplxFloat *a,
+                                                 CrankVecSplitCplxFloat *b,
+                                                 CrankVecSplitCplxFloat *r);
+
+void      crank_vec_split_cplx_float_muls       (CrankVecSplitCplxFloat *a,
+                                                 CrankCplxFloat         *b,
+                                                 CrankVecSplitCplxFloat *r);
+
+void      crank_vec_split_cplx_float_cmpmul     (CrankVecSplitCplxFloat *a,
+                                                 CrankVecSplitCplxFloat *b,
+                                                 CrankVecSplitCplxFloat *r);
+
+void      crank_vec_split_cplx_float_dot        (CrankVecSplitCplxFloat *a,
+                                                 CrankVecSplitCplxFloat *b,
+                                                 CrankCplxFloat         *r);
+
+
+//////// Matrix: Initialization ////////////////////////////////////////////////
+
+void      crank_mat_split_cplx_float_init_fill  (CrankMatSplitCplxFloat *mat,
+                                                 const guint             rn,
+                                                 const guint             cn,
+                                                 CrankCplxFloat         *fill);
+
+void      crank_mat_split_cplx_float_init_view  (CrankMatSplitCplxFloat *mat,
+                                                 const guint             rn,
+                                                 const guint             cn,
+                                                 gfloat                 *real,
+                                                 gfloat                 *imag);
+
+void      crank_mat_split_cplx_float_init_cplx  (CrankMatSplitCplxFloat *mat,
+                                                 CrankMatCplxFloatN     *cplx);
+
+void      crank_mat_split_cplx_float_copy       (CrankMatSplitCplxFloat *mat,
+                                                 CrankMatSplitCplxFloat *other);
+
+CrankMatSplitCplxFloat *crank_mat_split_cplx_float_dup (
+  CrankMatSplitCplxFloat *mat);
+
+void      crank_mat_split_cplx_float_fini       (CrankMatSplitCplxFloat *mat);
+
+void      crank_mat_split_cplx_float_free       (CrankMatSplitCplxFloat *mat);
+
+
+//////// Matrix: Attributes ////////////////////////////////////////////////////
+
+guint     crank_mat_split_cplx_float_get_row_size (CrankMatSplitCplxFloat *mat);
+
+guint     crank_mat_split_cplx_float_get_col_size (CrankMatSplitCplxFloat *mat);
+
+void      crank_mat_split_cplx_float_get        (CrankMatSplitCplxFloat *mat,
+                                                 const guint             i,
+                                                 const guint             j,
+                                                 CrankCplxFloat         *r);
+
+void      crank_mat_split_cplx_float_set        (CrankMatSplitCplxFloat *mat,
+                                                 const guint             i,
+                                                 const guint             j,
+                                                 CrankCplxFloat         *v);
+
+void      crank_mat_split_cplx_float_get_real_view (
+  CrankMatSplitCplxFloat *mat,
+  CrankMatFloatN         *r);
+
+void      crank_mat_split_cplx_float_get_imag_view (
+  CrankMatSplitCplxFloat *mat,
+  CrankMatFloatN         *r);
+
+void      crank_mat_split_cplx_float_get_row_view (
+  CrankMatSplitCplxFloat *mat,
+  const guint             i,
+  CrankVecSplitCplxFloat *r);
+
+void      crank_mat_split_cplx_float_to_cplx    (CrankMatSplitCplxFloat *mat,
+                                                 CrankMatCplxFloatN     *r);
+
+
+//////// Matrix: Operations ////////////////////////////////////////////////////
+
+void      crank_mat_split_cplx_float_add        (CrankMatSplitCplxFloat *a,
+                                                 CrankMatSplitCplxFloat *b,
+                                                 CrankMatSplitCplxFloat *r);
+
+void      crank_mat_split_cplx_float_sub        (CrankMatSplitCplxFloat *a,
+                                                 CrankMatSplitCplxFloat *b,
+                                                 CrankMatSplitCplxFloat *r);
+
+void      crank_mat_split_cplx_float_mulv       (CrankMatSplitCplxFloat *a,
+                                                 CrankVecSplitCplxFloat *b,
+                                                 CrankVecSplitCplxFloat *r);
+
+void      crank_mat_split_cplx_float_mul        (CrankMatSplitCplxFloat *a,
+                                                 CrankMatSplitCplxFloat *b,
+                                                 CrankMatSplitCplxFloat *r);
+
+G_END_DECLS
+
+#endif
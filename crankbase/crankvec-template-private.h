@@ -0,0 +1,3524 @@
+/* Copyright (C) 2015, WSID   */
+
+/* Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/* This is template for vectors, and is included by crankvecfloat.c and
+ * crankvecdouble.c. */
+
+#ifndef _CRANKBASE_INSIDE
+#error crankvec-template-private.h cannot be included directly.
+#endif
+
+#ifndef CRANK_VEC_T
+#error CRANK_VEC_T should be defined before including template.
+#endif
+
+#ifndef __GTK_DOC_IGNORE__
+
+/*
+ * Parameters of template.
+ *
+ * CRANK_VEC_T: Element type. (gfloat, gdouble)
+ * CRANK_VEC_TYPE(n): Makes vector type name with size. (2, 3, 4, N)
+ * CRANK_VEC_FUNC(n, name): Makes function name with size. (2, 3, 4, _n)
+ * CRANK_VEC_SYM(n): Makes type prefix with size, for type definition.
+ * CRANK_VEC_GTYPE(n): Makes GType macro name with size. (2, 3, 4, _N)
+ * CRANK_VEC_MAT_TYPE(n): Makes matrix type name with size.
+ * CRANK_VEC_NAME: Name of variable sized vector, in warnings.
+ * CRANK_VEC_S0, CRANK_VEC_S1: Arrays of zeros and ones.
+ * CRANK_VEC_HASH: Hash function for an element.
+ * CRANK_VEC_MATH(f): Appends type suffix to math function. (sqrtf, sqrt)
+ * CRANK_VEC_BOOL_FUNC: Predicate type on an element.
+ * CRANK_VEC_ITER, CRANK_VEC_ITER_FUNC(name): Iterator type and its functions.
+ * CRANK_VEC_GET_KERNELS: Function that returns SIMD kernels.
+ * CRANK_VEC_INTRIN(f): Appends type suffix to intrinsic. (_ps, _pd)
+ * CRANK_VEC_M256: Vector type of 256 bits.
+ * CRANK_VEC_W256: Number of elements in 256 bits.
+ *
+ * Optional parameters.
+ *
+ * CRANK_VEC_GET_MASK_KERNELS: Function that returns mask kernels. Masked
+ *     operations are defined only with this.
+ * CRANK_VEC_FROM_TYPE(n), CRANK_VEC_FROM_GTYPE(n): Vector type of lower
+ *     precision and its GType. Conversions from it are defined only with
+ *     these.
+ */
+
+#define T          CRANK_VEC_T
+#define V(n)       CRANK_VEC_TYPE(n)
+#define M(n)       CRANK_VEC_MAT_TYPE(n)
+#define F(n, name) CRANK_VEC_FUNC(n, name)
+#define I(f)       CRANK_VEC_INTRIN(f)
+#define V256       CRANK_VEC_M256
+#define W256       CRANK_VEC_W256
+
+#ifdef CRANK_VEC_FROM_TYPE
+#define VF(n)      CRANK_VEC_FROM_TYPE(n)
+#endif
+
+const T CRANK_VEC_S0[4] = {0, 0, 0, 0};
+const T CRANK_VEC_S1[4] = {1, 1, 1, 1};
+
+const V(2) * const F(2, static_zero) =
+    (const V(2)*) CRANK_VEC_S0;
+const V(3) * const F(3, static_zero) =
+    (const V(3)*) CRANK_VEC_S0;
+const V(4) * const F(4, static_zero) =
+    (const V(4)*) CRANK_VEC_S0;
+
+const V(2) * const F(2, static_one) =
+    (const V(2)*) CRANK_VEC_S1;
+const V(3) * const F(3, static_one) =
+    (const V(3)*) CRANK_VEC_S1;
+const V(4) * const F(4, static_one) =
+    (const V(4)*) CRANK_VEC_S1;
+
+
+#define CMP(a, b) (((a) > (b)) - ((a) < (b)))
+
+/*
+ * CRANK_VEC_N_ALLOC:
+ * @v: A Vector.
+ * @_n: Size of vector.
+ *
+ * Allocates data of @v, aligned for SIMD kernels.
+ */
+#define CRANK_VEC_N_ALLOC(v,_n)                                               \
+  G_STMT_START {                                                              \
+    (v)->data = _crank_cpu_alloc_aligned ((_n) * sizeof (T));                 \
+    (v)->n = _n;                                                              \
+  } G_STMT_END
+
+#ifdef CRANK_VEC_FROM_TYPE
+#define CRANK_VEC_REGISTER_FROM(gtype, func) \
+  g_value_register_transform_func (gtype, g_define_type_id, func)
+#else
+#define CRANK_VEC_REGISTER_FROM(gtype, func)
+#endif
+
+static void F(2, transform_from_vb) (const GValue *src,
+                                     GValue       *dest);
+
+static void F(2, transform_from_vi) (const GValue *src,
+                                     GValue       *dest);
+
+static void F(2, transform_to_string) (const GValue *src,
+                                       GValue       *dest);
+
+#ifdef CRANK_VEC_FROM_TYPE
+void
+F(2, init_from_vf) (V(2)           *vec,
+                    const VF(2) *vf)
+{
+  vec->x = vf->x;
+  vec->y = vf->y;
+}
+
+static void
+F(2, transform_from_vf) (const GValue *src,
+                         GValue       *dest)
+{
+  V(2) *vec = g_new (V(2), 1);
+  VF(2) *vf = (VF(2)*) g_value_get_boxed (src);
+
+  F(2, init_from_vf) (vec, vf);
+  g_value_take_boxed (dest, vec);
+}
+#endif
+
+G_DEFINE_BOXED_TYPE_WITH_CODE (
+  V(2),
+  CRANK_VEC_SYM(2),
+  F(2, dup),
+  g_free,
+  {
+    g_value_register_transform_func (CRANK_TYPE_VEC_BOOL2,
+                                     g_define_type_id,
+                                     F(2, transform_from_vb));
+
+    g_value_register_transform_func (CRANK_TYPE_VEC_INT2,
+                                     g_define_type_id,
+                                     F(2, transform_from_vi));
+
+    CRANK_VEC_REGISTER_FROM (CRANK_VEC_FROM_GTYPE(2),
+                             F(2, transform_from_vf));
+
+    g_value_register_transform_func (g_define_type_id,
+                                     G_TYPE_STRING,
+                                     F(2, transform_to_string));
+  })
+
+void
+F(2, init) (V(2)    *vec,
+            const T  x,
+            const T  y)
+{
+  vec->x = x;
+  vec->y = y;
+}
+
+void
+F(2, init_arr) (V(2)    *vec,
+                const T *arr)
+{
+  vec->x = arr[0];
+  vec->y = arr[1];
+}
+
+void
+F(2, init_valist) (V(2)    *vec,
+                   va_list  varargs)
+{
+  vec->x = va_arg (varargs, gdouble);
+  vec->y = va_arg (varargs, gdouble);
+}
+
+void
+F(2, init_fill) (V(2) *vec,
+                 T     fill)
+{
+  vec->x = fill;
+  vec->y = fill;
+}
+
+void
+F(2, init_from_vb) (V(2)                *vec,
+                    const CrankVecBool2 *vb)
+{
+  vec->x = vb->x ? 1 : 0;
+  vec->y = vb->y ? 1 : 0;
+}
+
+void
+F(2, init_from_vi) (V(2)               *vec,
+                    const CrankVecInt2 *vi)
+{
+  vec->x = vi->x;
+  vec->y = vi->y;
+}
+
+
+void
+F(2, copy) (const V(2) *vec,
+            V(2)       *other)
+{
+  memcpy (other, vec, sizeof(V(2)));
+}
+
+V(2)*
+F(2, dup) (const V(2) *vec)
+{
+  return (V(2)*) g_memdup (vec, sizeof (V(2)));
+}
+
+T
+F(2, get) (const V(2)  *vec,
+           const guint  index)
+{
+  return ((T*)vec)[index];
+}
+
+void
+F(2, set) (V(2)        *vec,
+           const guint  index,
+           const T      value)
+{
+  ((T*)vec)[index] = value;
+}
+
+gboolean
+F(2, foreach) (const V(2)          *vec,
+               CRANK_VEC_BOOL_FUNC  func,
+               gpointer             userdata)
+{
+  if (func (vec->x, userdata) &&
+      func (vec->y, userdata))
+    return TRUE;
+  else
+    return FALSE;
+}
+
+void
+F(2, iterator) (V(2)           *vec,
+                CRANK_VEC_ITER *iter)
+{
+  CRANK_VEC_ITER_FUNC(init_with_count) (iter, (T*)vec, 2);
+}
+
+//////// Basic operation ////////
+
+guint
+F(2, hash) (gconstpointer a)
+{
+  const V(2) *vec = a;
+
+  guint hash;
+  hash = CRANK_VEC_HASH (&(vec->x));
+  hash = CRANK_VEC_HASH (&(vec->y)) + hash * 37;
+  return hash;
+}
+
+gboolean
+F(2, equal) (gconstpointer a,
+             gconstpointer b)
+{
+  V(2) *veca = (V(2)*)a;
+  V(2) *vecb = (V(2)*)b;
+
+  return ((veca->x == vecb->x) &&
+          (veca->y == vecb->y));
+}
+
+gboolean
+F(2, equal_delta) (gconstpointer a,
+                   gconstpointer b,
+                   const T       d)
+{
+  V(2) *veca = (V(2)*)a;
+  V(2) *vecb = (V(2)*)b;
+
+  V(2) vecd;
+  T         dm;
+  T         dd;
+
+  F(2, sub) (vecb, veca, &vecd);
+
+  dm = F(2, get_magn_sq) (&vecd);
+  dd = d * d;
+
+  return (dm < dd);
+}
+
+gchar*
+F(2, to_string) (const V(2) *vec)
+{
+  return F(2, to_string_full) (vec, "(", ", ", ")", "%g");
+}
+
+gchar*
+F(2, to_string_full) (const V(2)  *vec,
+                      const gchar *left,
+                      const gchar *in,
+                      const gchar *right,
+                      const gchar *format)
+{
+  GString *strb = g_string_new (left);
+  gchar *result;
+
+  g_string_append_printf (strb, format, vec->x);
+  g_string_append (strb, in);
+
+  g_string_append_printf (strb, format, vec->y);
+  g_string_append (strb, right);
+
+  result = strb->str;
+
+  g_string_free (strb, FALSE);
+
+  return result;
+}
+
+
+//////// Standard vector property ///////
+
+T
+F(2, get_magn_sq) (const V(2) *vec)
+{
+  return (vec->x * vec->x) +
+         (vec->y * vec->y);
+}
+
+T
+F(2, get_magn) (const V(2) *vec)
+{
+  T sq = F(2, get_magn_sq) (vec);
+  return CRANK_VEC_MATH(sqrt) (sq);
+}
+
+
+//////// Standard unary operations ////////
+
+void
+F(2, neg) (const V(2) *a,
+           V(2)       *r)
+{
+  r->x = -(a->x);
+  r->y = -(a->y);
+}
+
+
+void
+F(2, neg_self) (V(2) *a)
+{
+  a->x = -(a->x);
+  a->y = -(a->y);
+}
+
+
+void
+F(2, unit) (const V(2) *a,
+            V(2)       *r)
+{
+  F(2, divs) (a, F(2, get_magn) (a), r);
+}
+
+
+void
+F(2, unit_self) (V(2) *a)
+{
+  F(2, divs_self) (a, F(2, get_magn) (a));
+}
+
+//////// Scalar operations ////////
+
+void
+F(2, muls) (const V(2) *a,
+            const T     b,
+            V(2)       *r)
+{
+  g_return_if_fail (a != r);
+
+  r->x = a->x * b;
+  r->y = a->y * b;
+}
+
+void
+F(2, muls_self) (V(2)    *a,
+                 const T  b)
+{
+  a->x *= b;
+  a->y *= b;
+}
+
+void
+F(2, divs) (const V(2) *a,
+            const T     b,
+            V(2)       *r)
+{
+  g_return_if_fail (a != r);
+
+  r->x = a->x / b;
+  r->y = a->y / b;
+}
+
+void
+F(2, divs_self) (V(2)    *a,
+                 const T  b)
+{
+  a->x /= b;
+  a->y /= b;
+}
+
+
+//////// Standard vector operations ////////
+
+void
+F(2, add) (const V(2) *a,
+           const V(2) *b,
+           V(2)       *r)
+{
+  g_return_if_fail (a != r);
+  g_return_if_fail (b != r);
+
+  r->x = a->x + b->x;
+  r->y = a->y + b->y;
+}
+
+void
+F(2, add_self) (V(2)       *a,
+                const V(2) *b)
+{
+  a->x += b->x;
+  a->y += b->y;
+}
+
+void
+F(2, sub) (const V(2) *a,
+           const V(2) *b,
+           V(2)       *r)
+{
+  g_return_if_fail (a != r);
+  g_return_if_fail (b != r);
+
+  r->x = a->x - b->x;
+  r->y = a->y - b->y;
+}
+
+void
+F(2, sub_self) (V(2)       *a,
+                const V(2) *b)
+{
+  a->x -= b->x;
+  a->y -= b->y;
+}
+
+T
+F(2, dot) (const V(2) *a,
+           const V(2) *b)
+{
+  return (a->x) * (b->x) + (a->y) * (b->y);
+}
+
+T
+F(2, crs) (const V(2) *a,
+           const V(2) *b)
+{
+  return (a->x) * (b->y) - (a->y) * (b->x);
+}
+
+//////// Component vector operations ////////
+
+void
+F(2, cmpmul) (const V(2) *a,
+              const V(2) *b,
+              V(2)       *r)
+{
+  g_return_if_fail (a != r);
+  g_return_if_fail (b != r);
+
+  r->x = a->x * b->x;
+  r->y = a->y * b->y;
+}
+
+void
+F(2, cmpmul_self) (V(2)       *a,
+                   const V(2) *b)
+{
+  a->x *= b->x;
+  a->y *= b->y;
+}
+
+void
+F(2, cmpdiv) (const V(2) *a,
+              const V(2) *b,
+              V(2)       *r)
+{
+  g_return_if_fail (a != r);
+  g_return_if_fail (b != r);
+
+  r->x = a->x / b->x;
+  r->y = a->y / b->y;
+}
+
+void
+F(2, cmpdiv_self) (V(2)       *a,
+                   const V(2) *b)
+{
+  a->x /= b->x;
+  a->y /= b->y;
+}
+
+void
+F(2, cmpless) (const V(2)    *a,
+               const V(2)    *b,
+               CrankVecBool2 *r)
+{
+  r->x = (a->x) < (b->x);
+  r->y = (a->y) < (b->y);
+}
+
+void
+F(2, cmpeq) (const V(2)    *a,
+             const V(2)    *b,
+             CrankVecBool2 *r)
+{
+  r->x = (a->x) == (b->x);
+  r->y = (a->y) == (b->y);
+}
+
+void
+F(2, cmpgreater) (const V(2)    *a,
+                  const V(2)    *b,
+                  CrankVecBool2 *r)
+{
+  r->x = (a->x) > (b->x);
+  r->y = (a->y) > (b->y);
+}
+
+void
+F(2, cmpcmp) (const V(2)   *a,
+              const V(2)   *b,
+              CrankVecInt2 *r)
+{
+  r->x = CMP(a->x, b->x);
+  r->y = CMP(a->y, b->y);
+}
+
+void
+F(2, min) (const V(2) *a,
+           const V(2) *b,
+           V(2)       *r)
+{
+  g_return_if_fail (a != r);
+  g_return_if_fail (b != r);
+
+  r->x = MIN (a->x, b->x);
+  r->y = MIN (a->y, b->y);
+}
+
+void
+F(2, max) (const V(2) *a,
+           const V(2) *b,
+           V(2)       *r)
+{
+  g_return_if_fail (a != r);
+  g_return_if_fail (b != r);
+
+  r->x = MAX (a->x, b->x);
+  r->y = MAX (a->y, b->y);
+}
+
+void
+F(2, abs) (const V(2) *a,
+           V(2)       *r)
+{
+  g_return_if_fail (a != r);
+
+  r->x = ABS (a->x);
+  r->y = ABS (a->y);
+}
+
+
+void
+F(2, abs_self) (V(2) *a)
+{
+  a->x = ABS (a->x);
+  a->y = ABS (a->y);
+}
+
+void
+F(2, mulm) (const V(2) *a,
+            const M(2) *b,
+            V(2)       *r)
+{
+  T nx, ny;
+
+  g_return_if_fail (a != r);
+
+  nx = (a->x * b->m00) + (a->y * b->m10);
+  ny = (a->x * b->m01) + (a->y * b->m11);
+
+  r->x = nx;
+  r->y = ny;
+}
+
+
+void
+F(2, mulm_self) (V(2)       *a,
+                 const M(2) *b)
+{
+  T nx, ny;
+
+  nx = (a->x * b->m00) + (a->y * b->m10);
+  ny = (a->x * b->m01) + (a->y * b->m11);
+
+  a->x = nx;
+  a->y = ny;
+}
+
+void
+F(2, mixs) (const V(2) *a,
+            const V(2) *b,
+            const T     c,
+            V(2)       *r)
+{
+  T d = 1 - c;
+
+  g_return_if_fail (a != r);
+  g_return_if_fail (b != r);
+
+  r->x = a->x * d + b->x * c;
+  r->y = a->y * d + b->y * c;
+}
+
+
+void
+F(2, mix) (const V(2) *a,
+           const V(2) *b,
+           const V(2) *c,
+           V(2)       *r)
+{
+  V(2) d;
+
+  g_return_if_fail (a != r);
+  g_return_if_fail (b != r);
+  g_return_if_fail (c != r);
+
+  d.x = 1 - c->x;
+  d.y = 1 - c->y;
+
+  r->x = a->x * d.x + b->x * c->x;
+  r->y = a->y * d.y + b->y * c->y;
+}
+
+//////// GValue Transform //////////////////////////////////////////////////////
+
+static void
+F(2, transform_from_vb) (const GValue *src,
+                         GValue       *dest)
+{
+  V(2) *vec = g_new (V(2), 1);
+  CrankVecBool2 *vb = (CrankVecBool2*) g_value_get_boxed (src);
+
+  F(2, init_from_vb) (vec, vb);
+
+  g_value_take_boxed (dest, vec);
+}
+
+static void
+F(2, transform_from_vi) (const GValue *src,
+                         GValue       *dest)
+{
+  V(2) *vec = g_new (V(2), 1);
+  CrankVecInt2 *vi = (CrankVecInt2*) g_value_get_boxed (src);
+
+  F(2, init_from_vi) (vec, vi);
+
+  g_value_take_boxed (dest, vec);
+}
+
+static void
+F(2, transform_to_string) (const GValue *src,
+                           GValue       *dest)
+{
+  V(2) *vec = (V(2)*) g_value_get_boxed (src);
+  gchar *res = F(2, to_string) (vec);
+  g_value_take_string (dest, res);
+}
+
+
+static void F(3, transform_from_vb) (const GValue *src,
+                                     GValue       *dest);
+
+static void F(3, transform_from_vi) (const GValue *src,
+                                     GValue       *dest);
+
+static void F(3, transform_to_string) (const GValue *src,
+                                       GValue       *dest);
+
+#ifdef CRANK_VEC_FROM_TYPE
+void
+F(3, init_from_vf) (V(3)           *vec,
+                    const VF(3) *vf)
+{
+  vec->x = vf->x;
+  vec->y = vf->y;
+  vec->z = vf->z;
+}
+
+static void
+F(3, transform_from_vf) (const GValue *src,
+                         GValue       *dest)
+{
+  V(3) *vec = g_new (V(3), 1);
+  VF(3) *vf = (VF(3)*) g_value_get_boxed (src);
+
+  F(3, init_from_vf) (vec, vf);
+  g_value_take_boxed (dest, vec);
+}
+#endif
+
+G_DEFINE_BOXED_TYPE_WITH_CODE (
+  V(3),
+  CRANK_VEC_SYM(3),
+  F(3, dup),
+  g_free,
+  {
+    g_value_register_transform_func (CRANK_TYPE_VEC_BOOL3,
+                                     g_define_type_id,
+                                     F(3, transform_from_vb));
+
+    g_value_register_transform_func (CRANK_TYPE_VEC_INT3,
+                                     g_define_type_id,
+                                     F(3, transform_from_vi));
+
+    CRANK_VEC_REGISTER_FROM (CRANK_VEC_FROM_GTYPE(3),
+                             F(3, transform_from_vf));
+
+    g_value_register_transform_func (g_define_type_id,
+                                     G_TYPE_STRING,
+                                     F(3, transform_to_string));
+  })
+
+void
+F(3, init) (V(3)    *vec,
+            const T  x,
+            const T  y,
+            const T  z)
+{
+  vec->x = x;
+  vec->y = y;
+  vec->z = z;
+}
+
+void
+F(3, init_arr) (V(3)    *vec,
+                const T *arr)
+{
+  vec->x = arr[0];
+  vec->y = arr[1];
+  vec->z = arr[2];
+}
+
+void
+F(3, init_valist) (V(3)    *vec,
+                   va_list  varargs)
+{
+  vec->x = va_arg (varargs, gdouble);
+  vec->y = va_arg (varargs, gdouble);
+  vec->z = va_arg (varargs, gdouble);
+}
+
+void
+F(3, init_fill) (V(3)    *vec,
+                 const T  fill)
+{
+  vec->x = fill;
+  vec->y = fill;
+  vec->z = fill;
+}
+
+void
+F(3, init_from_vb) (V(3)                *vec,
+                    const CrankVecBool3 *vb)
+{
+  vec->x = vb->x ? 1 : 0;
+  vec->y = vb->y ? 1 : 0;
+  vec->z = vb->z ? 1 : 0;
+}
+
+void
+F(3, init_from_vi) (V(3)               *vec,
+                    const CrankVecInt3 *vi)
+{
+  vec->x = vi->x;
+  vec->y = vi->y;
+  vec->z = vi->z;
+}
+
+
+void
+F(3, copy) (const V(3) *vec,
+            V(3)       *other)
+{
+  memcpy (other, vec, sizeof(V(3)));
+}
+
+V(3)*
+F(3, dup) (const V(3) *vec)
+{
+  return (V(3)*) g_memdup (vec, sizeof (V(3)));
+}
+
+T
+F(3, get) (const V(3)  *vec,
+           const guint  index)
+{
+  return ((T*)vec)[index];
+}
+
+void
+F(3, set) (V(3)        *vec,
+           const guint  index,
+           const T      value)
+{
+  ((T*)vec)[index] = value;
+}
+
+gboolean
+F(3, foreach) (const V(3)          *vec,
+               CRANK_VEC_BOOL_FUNC  func,
+               gpointer             userdata)
+{
+  if (func (vec->x, userdata) &&
+      func (vec->y, userdata) &&
+      func (vec->z, userdata))
+    return TRUE;
+  else
+    return FALSE;
+}
+
+void
+F(3, iterator) (V(3)           *vec,
+                CRANK_VEC_ITER *iter)
+{
+  CRANK_VEC_ITER_FUNC(init_with_count) (iter, (T*)vec, 3);
+}
+
+
+//////// Basic operation ////////
+
+guint
+F(3, hash) (gconstpointer a)
+{
+  const V(3) *vec = a;
+  guint hash;
+  hash = CRANK_VEC_HASH (&(vec->x));
+  hash = CRANK_VEC_HASH (&(vec->y)) + hash * 37;
+  hash = CRANK_VEC_HASH (&(vec->z)) + hash * 37;
+
+  return hash;
+}
+
+gboolean
+F(3, equal) (gconstpointer a,
+             gconstpointer b)
+{
+  V(3) *veca = (V(3)*)a;
+  V(3) *vecb = (V(3)*)b;
+
+  return ((veca->x == vecb->x) &&
+          (veca->y == vecb->y) &&
+          (veca->z == vecb->z));
+}
+
+gboolean
+F(3, equal_delta) (gconstpointer a,
+                   gconstpointer b,
+                   const T       d)
+{
+  V(3) *veca = (V(3)*)a;
+  V(3) *vecb = (V(3)*)b;
+
+  V(3) vecd;
+  T         dm;
+  T         dd;
+
+  F(3, sub) (vecb, veca, &vecd);
+
+  dm = F(3, get_magn_sq) (&vecd);
+  dd = d * d;
+
+  return (dm < dd);
+}
+
+gchar*
+F(3, to_string) (const V(3) *vec)
+{
+  return F(3, to_string_full) (vec, "(", ", ", ")", "%g");
+}
+
+gchar*
+F(3, to_string_full) (const V(3)  *vec,
+                      const gchar *left,
+                      const gchar *in,
+                      const gchar *right,
+                      const gchar *format)
+{
+  GString *strb = g_string_new (left);
+  gchar *result;
+
+  g_string_append_printf (strb, format, vec->x);
+  g_string_append (strb, in);
+
+  g_string_append_printf (strb, format, vec->y);
+  g_string_append (strb, in);
+
+  g_string_append_printf (strb, format, vec->z);
+  g_string_append (strb, right);
+
+  result = strb->str;
+
+  g_string_free (strb, FALSE);
+
+  return result;
+}
+
+
+//////// Standard vector property ///////
+
+T
+F(3, get_magn_sq) (const V(3) *vec)
+{
+  return (vec->x * vec->x) +
+         (vec->y * vec->y) +
+         (vec->z * vec->z);
+}
+
+T
+F(3, get_magn) (const V(3) *vec)
+{
+  T sq = F(3, get_magn_sq) (vec);
+  return CRANK_VEC_MATH(sqrt) (sq);
+}
+
+
+//////// Standard unary operations ////////
+
+void
+F(3, neg) (const V(3) *a,
+           V(3)       *r)
+{
+  r->x = -(a->x);
+  r->y = -(a->y);
+  r->z = -(a->z);
+}
+
+void
+F(3, neg_self) (V(3) *a)
+{
+  a->x = -(a->x);
+  a->y = -(a->y);
+  a->z = -(a->z);
+}
+
+void
+F(3, unit) (const V(3) *a,
+            V(3)       *r)
+{
+  F(3, divs) (a, F(3, get_magn) (a), r);
+}
+
+void
+F(3, unit_self) (V(3) *a)
+{
+  F(3, divs_self) (a, F(3, get_magn) (a));
+}
+
+
+//////// Scalar operations ////////
+
+void
+F(3, muls) (const V(3) *a,
+            const T     b,
+            V(3)       *r)
+{
+  g_return_if_fail (a != r);
+
+  r->x = a->x * b;
+  r->y = a->y * b;
+  r->z = a->z * b;
+}
+
+void
+F(3, muls_self) (V(3)    *a,
+                 const T  b)
+{
+  a->x *= b;
+  a->y *= b;
+  a->z *= b;
+}
+
+void
+F(3, divs) (const V(3) *a,
+            const T     b,
+            V(3)       *r)
+{
+  g_return_if_fail (a != r);
+
+  r->x = a->x / b;
+  r->y = a->y / b;
+  r->z = a->z / b;
+}
+
+void
+F(3, divs_self) (V(3)    *a,
+                 const T  b)
+{
+  a->x /= b;
+  a->y /= b;
+  a->z /= b;
+}
+
+
+//////// Standard vector operations ////////
+
+void
+F(3, add) (const V(3) *a,
+           const V(3) *b,
+           V(3)       *r)
+{
+  g_return_if_fail (a != r);
+  g_return_if_fail (b != r);
+
+  r->x = a->x + b->x;
+  r->y = a->y + b->y;
+  r->z = a->z + b->z;
+}
+
+void
+F(3, add_self) (V(3)       *a,
+                const V(3) *b)
+{
+  a->x += b->x;
+  a->y += b->y;
+  a->z += b->z;
+}
+
+void
+F(3, sub) (const V(3) *a,
+           const V(3) *b,
+           V(3)       *r)
+{
+  g_return_if_fail (a != r);
+  g_return_if_fail (b != r);
+
+  r->x = a->x - b->x;
+  r->y = a->y - b->y;
+  r->z = a->z - b->z;
+}
+
+void
+F(3, sub_self) (V(3)       *a,
+                const V(3) *b)
+{
+  a->x -= b->x;
+  a->y -= b->y;
+  a->z -= b->z;
+}
+
+T
+F(3, dot) (const V(3) *a,
+           const V(3) *b)
+{
+  return (a->x) * (b->x) + (a->y) * (b->y) + (a->z) * (b->z);
+}
+
+void
+F(3, crs) (const V(3) *a,
+           const V(3) *b,
+           V(3)       *r)
+{
+  T nx;
+  T ny;
+  T nz;
+
+  g_return_if_fail (a != r);
+  g_return_if_fail (b != r);
+
+  nx = (a->y * b->z) - (a->z * b->y);
+  ny = (a->z * b->x) - (a->x * b->z);
+  nz = (a->x * b->y) - (a->y * b->x);
+
+  r->x = nx;
+  r->y = ny;
+  r->z = nz;
+}
+
+void
+F(3, crs_self) (V(3)       *a,
+                const V(3) *b)
+{
+  T nx = (a->y * b->z) - (a->z * b->y);
+  T ny = (a->z * b->x) - (a->x * b->z);
+  T nz = (a->x * b->y) - (a->y * b->x);
+
+  a->x = nx;
+  a->y = ny;
+  a->z = nz;
+}
+
+//////// Component vector operations ////////
+
+void
+F(3, cmpmul) (const V(3) *a,
+              const V(3) *b,
+              V(3)       *r)
+{
+  g_return_if_fail (a != r);
+  g_return_if_fail (b != r);
+
+  r->x = a->x * b->x;
+  r->y = a->y * b->y;
+  r->z = a->z * b->z;
+}
+
+void
+F(3, cmpmul_self) (V(3)       *a,
+                   const V(3) *b)
+{
+  a->x *= b->x;
+  a->y *= b->y;
+  a->z *= b->z;
+}
+
+void
+F(3, cmpdiv) (const V(3) *a,
+              const V(3) *b,
+              V(3)       *r)
+{
+  g_return_if_fail (a != r);
+  g_return_if_fail (b != r);
+
+  r->x = a->x / b->x;
+  r->y = a->y / b->y;
+  r->z = a->z / b->z;
+}
+
+void
+F(3, cmpdiv_self) (V(3)       *a,
+                   const V(3) *b)
+{
+  a->x /= b->x;
+  a->y /= b->y;
+  a->z /= b->z;
+}
+
+void
+F(3, cmpless) (const V(3)    *a,
+               const V(3)    *b,
+               CrankVecBool3 *r)
+{
+  r->x = (a->x) < (b->x);
+  r->y = (a->y) < (b->y);
+  r->z = (a->z) < (b->z);
+}
+
+void
+F(3, cmpeq) (const V(3)    *a,
+             const V(3)    *b,
+             CrankVecBool3 *r)
+{
+  r->x = (a->x) == (b->x);
+  r->y = (a->y) == (b->y);
+  r->z = (a->z) == (b->z);
+}
+
+void
+F(3, cmpgreater) (const V(3)    *a,
+                  const V(3)    *b,
+                  CrankVecBool3 *r)
+{
+  r->x = (a->x) > (b->x);
+  r->y = (a->y) > (b->y);
+  r->z = (a->z) > (b->z);
+}
+
+void
+F(3, cmpcmp) (const V(3)   *a,
+              const V(3)   *b,
+              CrankVecInt3 *r)
+{
+  r->x = CMP(a->x, b->x);
+  r->y = CMP(a->y, b->y);
+  r->z = CMP(a->z, b->z);
+}
+
+void
+F(3, min) (const V(3) *a,
+           const V(3) *b,
+           V(3)       *r)
+{
+  g_return_if_fail (a != r);
+  g_return_if_fail (b != r);
+
+  r->x = MIN (a->x, b->x);
+  r->y = MIN (a->y, b->y);
+  r->z = MIN (a->z, b->z);
+}
+
+void
+F(3, max) (const V(3) *a,
+           const V(3) *b,
+           V(3)       *r)
+{
+  g_return_if_fail (a != r);
+  g_return_if_fail (b != r);
+
+  r->x = MAX (a->x, b->x);
+  r->y = MAX (a->y, b->y);
+  r->z = MAX (a->z, b->z);
+}
+
+void
+F(3, abs) (const V(3) *a,
+           V(3)       *r)
+{
+  g_return_if_fail (a != r);
+
+  r->x = ABS (a->x);
+  r->y = ABS (a->y);
+  r->z = ABS (a->z);
+}
+
+
+void
+F(3, abs_self) (V(3) *a)
+{
+  a->x = ABS (a->x);
+  a->y = ABS (a->y);
+  a->z = ABS (a->z);
+}
+
+void
+F(3, mulm) (const V(3) *a,
+            const M(3) *b,
+            V(3)       *r)
+{
+  T nx, ny, nz;
+
+  g_return_if_fail (a != r);
+
+  nx = (a->x * b->m00) + (a->y * b->m10) + (a->z * b->m20);
+  ny = (a->x * b->m01) + (a->y * b->m11) + (a->z * b->m21);
+  nz = (a->x * b->m02) + (a->y * b->m12) + (a->z * b->m22);
+
+  r->x = nx;
+  r->y = ny;
+  r->z = nz;
+}
+
+void
+F(3, mulm_self) (V(3)       *a,
+                 const M(3) *b)
+{
+  T nx, ny, nz;
+
+  nx = (a->x * b->m00) + (a->y * b->m10) + (a->z * b->m20);
+  ny = (a->x * b->m01) + (a->y * b->m11) + (a->z * b->m21);
+  nz = (a->x * b->m02) + (a->y * b->m12) + (a->z * b->m22);
+
+  a->x = nx;
+  a->y = ny;
+  a->z = nz;
+}
+
+
+void
+F(3, mixs) (const V(3) *a,
+            const V(3) *b,
+            const T     c,
+            V(3)       *r)
+{
+  T d;
+
+  g_return_if_fail (a != r);
+  g_return_if_fail (b != r);
+
+  d = 1 - c;
+
+  r->x = a->x * d + b->x * c;
+  r->y = a->y * d + b->y * c;
+  r->z = a->z * d + b->z * c;
+}
+
+
+void
+F(3, mix) (const V(3) *a,
+           const V(3) *b,
+           const V(3) *c,
+           V(3)       *r)
+{
+  V(3) d;
+
+  g_return_if_fail (a != r);
+  g_return_if_fail (b != r);
+  g_return_if_fail (c != r);
+
+  d.x = 1 - c->x;
+  d.y = 1 - c->y;
+  d.z = 1 - c->z;
+
+  r->x = a->x * d.x + b->x * c->x;
+  r->y = a->y * d.y + b->y * c->y;
+  r->z = a->z * d.z + b->z * c->z;
+}
+
+//////// Batch operations ////////
+
+// Count of vectors, which are converted into streams at once.
+#define CRANK_VEC3_BATCH_CHUNK 64
+
+static void
+F(3, soa_dot_generic) (const guint  n,
+                       const T     *ax,
+                       const T     *ay,
+                       const T     *az,
+                       const T     *bx,
+                       const T     *by,
+                       const T     *bz,
+                       T           *r)
+{
+  guint i;
+
+  for (i = 0; i < n; i++)
+    r[i] = ax[i] * bx[i] + ay[i] * by[i] + az[i] * bz[i];
+}
+
+static void
+F(3, soa_crs_generic) (const guint  n,
+                       const T     *ax,
+                       const T     *ay,
+                       const T     *az,
+                       const T     *bx,
+                       const T     *by,
+                       const T     *bz,
+                       T           *rx,
+                       T           *ry,
+                       T           *rz)
+{
+  guint i;
+
+  for (i = 0; i < n; i++)
+    {
+      T x = ay[i] * bz[i] - az[i] * by[i];
+      T y = az[i] * bx[i] - ax[i] * bz[i];
+      T z = ax[i] * by[i] - ay[i] * bx[i];
+
+      rx[i] = x;
+      ry[i] = y;
+      rz[i] = z;
+    }
+}
+
+static void
+F(3, soa_unit_generic) (const guint  n,
+                        const T     *ax,
+                        const T     *ay,
+                        const T     *az,
+                        T           *rx,
+                        T           *ry,
+                        T           *rz)
+{
+  guint i;
+
+  for (i = 0; i < n; i++)
+    {
+      T magn = CRANK_VEC_MATH(sqrt) (ax[i] * ax[i] +
+                                     ay[i] * ay[i] +
+                                     az[i] * az[i]);
+
+      rx[i] = ax[i] / magn;
+      ry[i] = ay[i] / magn;
+      rz[i] = az[i] / magn;
+    }
+}
+
+#ifdef CRANK_CPU_X86
+
+// Processes W256 vectors at once, and leaves remainings to generic one.
+__attribute__((target ("avx")))
+static void
+F(3, soa_dot_avx) (const guint  n,
+                   const T     *ax,
+                   const T     *ay,
+                   const T     *az,
+                   const T     *bx,
+                   const T     *by,
+                   const T     *bz,
+                   T           *r)
+{
+  guint i;
+
+  for (i = 0; i + W256 <= n; i += W256)
+    {
+      V256 d;
+
+      d = I(_mm256_mul) (I(_mm256_loadu) (ax + i), I(_mm256_loadu) (bx + i));
+      d = I(_mm256_add) (d, I(_mm256_mul) (I(_mm256_loadu) (ay + i),
+                                           I(_mm256_loadu) (by + i)));
+      d = I(_mm256_add) (d, I(_mm256_mul) (I(_mm256_loadu) (az + i),
+                                           I(_mm256_loadu) (bz + i)));
+      I(_mm256_storeu) (r + i, d);
+    }
+
+  F(3, soa_dot_generic) (n - i,
+                         ax + i, ay + i, az + i,
+                         bx + i, by + i, bz + i,
+                         r + i);
+}
+
+__attribute__((target ("avx")))
+static void
+F(3, soa_crs_avx) (const guint  n,
+                   const T     *ax,
+                   const T     *ay,
+                   const T     *az,
+                   const T     *bx,
+                   const T     *by,
+                   const T     *bz,
+                   T           *rx,
+                   T           *ry,
+                   T           *rz)
+{
+  guint i;
+
+  for (i = 0; i + W256 <= n; i += W256)
+    {
+      V256 vax = I(_mm256_loadu) (ax + i);
+      V256 vay = I(_mm256_loadu) (ay + i);
+      V256 vaz = I(_mm256_loadu) (az + i);
+      V256 vbx = I(_mm256_loadu) (bx + i);
+      V256 vby = I(_mm256_loadu) (by + i);
+      V256 vbz = I(_mm256_loadu) (bz + i);
+
+      I(_mm256_storeu) (rx + i, I(_mm256_sub) (I(_mm256_mul) (vay, vbz),
+                                               I(_mm256_mul) (vaz, vby)));
+      I(_mm256_storeu) (ry + i, I(_mm256_sub) (I(_mm256_mul) (vaz, vbx),
+                                               I(_mm256_mul) (vax, vbz)));
+      I(_mm256_storeu) (rz + i, I(_mm256_sub) (I(_mm256_mul) (vax, vby),
+                                               I(_mm256_mul) (vay, vbx)));
+    }
+
+  F(3, soa_crs_generic) (n - i,
+                         ax + i, ay + i, az + i,
+                         bx + i, by + i, bz + i,
+                         rx + i, ry + i, rz + i);
+}
+
+__attribute__((target ("avx")))
+static void
+F(3, soa_unit_avx) (const guint  n,
+                    const T     *ax,
+                    const T     *ay,
+                    const T     *az,
+                    T           *rx,
+                    T           *ry,
+                    T           *rz)
+{
+  guint i;
+
+  for (i = 0; i + W256 <= n; i += W256)
+    {
+      V256 vax = I(_mm256_loadu) (ax + i);
+      V256 vay = I(_mm256_loadu) (ay + i);
+      V256 vaz = I(_mm256_loadu) (az + i);
+      V256 magn;
+
+      magn = I(_mm256_mul) (vax, vax);
+      magn = I(_mm256_add) (magn, I(_mm256_mul) (vay, vay));
+      magn = I(_mm256_add) (magn, I(_mm256_mul) (vaz, vaz));
+      magn = I(_mm256_sqrt) (magn);
+
+      I(_mm256_storeu) (rx + i, I(_mm256_div) (vax, magn));
+      I(_mm256_storeu) (ry + i, I(_mm256_div) (vay, magn));
+      I(_mm256_storeu) (rz + i, I(_mm256_div) (vaz, magn));
+    }
+
+  F(3, soa_unit_generic) (n - i,
+                          ax + i, ay + i, az + i,
+                          rx + i, ry + i, rz + i);
+}
+
+#endif
+
+void
+F(3, soa_dot) (const guint  n,
+               const T     *ax,
+               const T     *ay,
+               const T     *az,
+               const T     *bx,
+               const T     *by,
+               const T     *bz,
+               T           *r)
+{
+#ifdef CRANK_CPU_X86
+  if (CRANK_CPU_SIMD_AVX <= _crank_cpu_get_simd_level ())
+    {
+      F(3, soa_dot_avx) (n, ax, ay, az, bx, by, bz, r);
+      return;
+    }
+#endif
+
+  F(3, soa_dot_generic) (n, ax, ay, az, bx, by, bz, r);
+}
+
+void
+F(3, soa_crs) (const guint  n,
+               const T     *ax,
+               const T     *ay,
+               const T     *az,
+               const T     *bx,
+               const T     *by,
+               const T     *bz,
+               T           *rx,
+               T           *ry,
+               T           *rz)
+{
+#ifdef CRANK_CPU_X86
+  if (CRANK_CPU_SIMD_AVX <= _crank_cpu_get_simd_level ())
+    {
+      F(3, soa_crs_avx) (n, ax, ay, az, bx, by, bz, rx, ry, rz);
+      return;
+    }
+#endif
+
+  F(3, soa_crs_generic) (n, ax, ay, az, bx, by, bz, rx, ry, rz);
+}
+
+void
+F(3, soa_unit) (const guint  n,
+                const T     *ax,
+                const T     *ay,
+                const T     *az,
+                T           *rx,
+                T           *ry,
+                T           *rz)
+{
+#ifdef CRANK_CPU_X86
+  if (CRANK_CPU_SIMD_AVX <= _crank_cpu_get_simd_level ())
+    {
+      F(3, soa_unit_avx) (n, ax, ay, az, rx, ry, rz);
+      return;
+    }
+#endif
+
+  F(3, soa_unit_generic) (n, ax, ay, az, rx, ry, rz);
+}
+
+void
+F(3, batch_dot) (const guint  n,
+                 const V(3)  *a,
+                 const V(3)  *b,
+                 T           *r)
+{
+  T s[6][CRANK_VEC3_BATCH_CHUNK];
+  guint i;
+  guint j;
+
+  for (i = 0; i < n; i += CRANK_VEC3_BATCH_CHUNK)
+    {
+      guint cn = MIN (n - i, CRANK_VEC3_BATCH_CHUNK);
+
+      for (j = 0; j < cn; j++)
+        {
+          s[0][j] = a[i + j].x;
+          s[1][j] = a[i + j].y;
+          s[2][j] = a[i + j].z;
+          s[3][j] = b[i + j].x;
+          s[4][j] = b[i + j].y;
+          s[5][j] = b[i + j].z;
+        }
+
+      F(3, soa_dot) (cn, s[0], s[1], s[2], s[3], s[4], s[5], r + i);
+    }
+}
+
+void
+F(3, batch_crs) (const guint  n,
+                 const V(3)  *a,
+                 const V(3)  *b,
+                 V(3)        *r)
+{
+  T s[6][CRANK_VEC3_BATCH_CHUNK];
+  guint i;
+  guint j;
+
+  for (i = 0; i < n; i += CRANK_VEC3_BATCH_CHUNK)
+    {
+      guint cn = MIN (n - i, CRANK_VEC3_BATCH_CHUNK);
+
+      for (j = 0; j < cn; j++)
+        {
+          s[0][j] = a[i + j].x;
+          s[1][j] = a[i + j].y;
+          s[2][j] = a[i + j].z;
+          s[3][j] = b[i + j].x;
+          s[4][j] = b[i + j].y;
+          s[5][j] = b[i + j].z;
+        }
+
+      F(3, soa_crs) (cn, s[0], s[1], s[2], s[3], s[4], s[5],
+                     s[0], s[1], s[2]);
+
+      for (j = 0; j < cn; j++)
+        {
+          r[i + j].x = s[0][j];
+          r[i + j].y = s[1][j];
+          r[i + j].z = s[2][j];
+        }
+    }
+}
+
+void
+F(3, batch_unit) (const guint  n,
+                  const V(3)  *a,
+                  V(3)        *r)
+{
+  T s[3][CRANK_VEC3_BATCH_CHUNK];
+  guint i;
+  guint j;
+
+  for (i = 0; i < n; i += CRANK_VEC3_BATCH_CHUNK)
+    {
+      guint cn = MIN (n - i, CRANK_VEC3_BATCH_CHUNK);
+
+      for (j = 0; j < cn; j++)
+        {
+          s[0][j] = a[i + j].x;
+          s[1][j] = a[i + j].y;
+          s[2][j] = a[i + j].z;
+        }
+
+      F(3, soa_unit) (cn, s[0], s[1], s[2], s[0], s[1], s[2]);
+
+      for (j = 0; j < cn; j++)
+        {
+          r[i + j].x = s[0][j];
+          r[i + j].y = s[1][j];
+          r[i + j].z = s[2][j];
+        }
+    }
+}
+
+//////// GValue Transform //////////////////////////////////////////////////////
+
+static void
+F(3, transform_from_vb) (const GValue *src,
+                         GValue       *dest)
+{
+  V(3) *vec = g_new (V(3), 1);
+  CrankVecBool3 *vb = (CrankVecBool3*) g_value_get_boxed (src);
+
+  F(3, init_from_vb) (vec, vb);
+
+  g_value_take_boxed (dest, vec);
+}
+
+static void
+F(3, transform_from_vi) (const GValue *src,
+                         GValue       *dest)
+{
+  V(3) *vec = g_new (V(3), 1);
+  CrankVecInt3 *vi = (CrankVecInt3*) g_value_get_boxed (src);
+
+  F(3, init_from_vi) (vec, vi);
+
+  g_value_take_boxed (dest, vec);
+}
+
+static void
+F(3, transform_to_string) (const GValue *src,
+                           GValue       *dest)
+{
+  V(3) *vec = (V(3)*) g_value_get_boxed (src);
+  gchar *str = F(3, to_string) (vec);
+
+  g_value_take_string (dest, str);
+}
+
+
+static void F(4, transform_from_vb) (const GValue *src,
+                                     GValue       *dest);
+
+static void F(4, transform_from_vi) (const GValue *src,
+                                     GValue       *dest);
+
+static void F(4, transform_to_string) (const GValue *src,
+                                       GValue       *dest);
+
+#ifdef CRANK_VEC_FROM_TYPE
+void
+F(4, init_from_vf) (V(4)           *vec,
+                    const VF(4) *vf)
+{
+  vec->x = vf->x;
+  vec->y = vf->y;
+  vec->z = vf->z;
+  vec->w = vf->w;
+}
+
+static void
+F(4, transform_from_vf) (const GValue *src,
+                         GValue       *dest)
+{
+  V(4) *vec = g_new (V(4), 1);
+  VF(4) *vf = (VF(4)*) g_value_get_boxed (src);
+
+  F(4, init_from_vf) (vec, vf);
+  g_value_take_boxed (dest, vec);
+}
+#endif
+
+G_DEFINE_BOXED_TYPE_WITH_CODE (
+  V(4),
+  CRANK_VEC_SYM(4),
+  F(4, dup),
+  g_free,
+  {
+    g_value_register_transform_func (CRANK_TYPE_VEC_BOOL4,
+                                     g_define_type_id,
+                                     F(4, transform_from_vb));
+
+    g_value_register_transform_func (CRANK_TYPE_VEC_INT4,
+                                     g_define_type_id,
+                                     F(4, transform_from_vi));
+
+    CRANK_VEC_REGISTER_FROM (CRANK_VEC_FROM_GTYPE(4),
+                             F(4, transform_from_vf));
+
+    g_value_register_transform_func (g_define_type_id,
+                                     G_TYPE_STRING,
+                                     F(4, transform_to_string));
+  })
+
+void
+F(4, init) (V(4)    *vec,
+            const T  x,
+            const T  y,
+            const T  z,
+            const T  w)
+{
+  vec->x = x;
+  vec->y = y;
+  vec->z = z;
+  vec->w = w;
+}
+
+void
+F(4, init_arr) (V(4)    *vec,
+                const T *arr)
+{
+  vec->x = arr[0];
+  vec->y = arr[1];
+  vec->z = arr[2];
+  vec->w = arr[3];
+}
+
+void
+F(4, init_valist) (V(4)    *vec,
+                   va_list  varargs)
+{
+  vec->x = va_arg (varargs, gdouble);
+  vec->y = va_arg (varargs, gdouble);
+  vec->z = va_arg (varargs, gdouble);
+  vec->w = va_arg (varargs, gdouble);
+}
+
+void
+F(4, init_fill) (V(4)    *vec,
+                 const T  fill)
+{
+  vec->x = fill;
+  vec->y = fill;
+  vec->z = fill;
+  vec->w = fill;
+}
+
+void
+F(4, init_from_vb) (V(4)                *vec,
+                    const CrankVecBool4 *vb)
+{
+  vec->x = vb->x ? 1 : 0;
+  vec->y = vb->y ? 1 : 0;
+  vec->z = vb->z ? 1 : 0;
+  vec->w = vb->w ? 1 : 0;
+}
+
+void
+F(4, init_from_vi) (V(4)               *vec,
+                    const CrankVecInt4 *vi)
+{
+  vec->x = vi->x;
+  vec->y = vi->y;
+  vec->z = vi->z;
+  vec->w = vi->w;
+}
+
+
+void
+F(4, copy) (const V(4) *vec,
+            V(4)       *other)
+{
+  memcpy (other, vec, sizeof(V(4)));
+}
+
+V(4)*
+F(4, dup) (const V(4) *vec)
+{
+  return (V(4)*) g_memdup (vec, sizeof (V(4)));
+}
+
+T
+F(4, get) (const V(4)  *vec,
+           const guint  index)
+{
+  return ((T*)vec)[index];
+}
+
+void
+F(4, set) (V(4)        *vec,
+           const guint  index,
+           const T      value)
+{
+  ((T*)vec)[index] = value;
+}
+
+gboolean
+F(4, foreach) (const V(4)          *vec,
+               CRANK_VEC_BOOL_FUNC  func,
+               gpointer             userdata)
+{
+  if (func (vec->x, userdata) &&
+      func (vec->y, userdata) &&
+      func (vec->z, userdata) &&
+      func (vec->w, userdata))
+    return TRUE;
+  else
+    return FALSE;
+}
+
+void
+F(4, iterator) (V(4)           *vec,
+                CRANK_VEC_ITER *iter)
+{
+  CRANK_VEC_ITER_FUNC(init_with_count) (iter, (T*)vec, 4);
+}
+
+
+//////// Basic operation ////////
+
+guint
+F(4, hash) (gconstpointer a)
+{
+  const V(4) *vec = a;
+
+  guint hash;
+  hash = CRANK_VEC_HASH (&(vec->x));
+  hash = CRANK_VEC_HASH (&(vec->y)) + hash * 37;
+  hash = CRANK_VEC_HASH (&(vec->z)) + hash * 37;
+  hash = CRANK_VEC_HASH (&(vec->w)) + hash * 37;
+
+  return hash;
+}
+
+gboolean
+F(4, equal) (gconstpointer a,
+             gconstpointer b)
+{
+  V(4) *veca = (V(4)*)a;
+  V(4) *vecb = (V(4)*)b;
+
+  return ((veca->x == vecb->x) &&
+          (veca->y == vecb->y) &&
+          (veca->z == vecb->z) &&
+          (veca->w == vecb->w));
+}
+
+gboolean
+F(4, equal_delta) (gconstpointer a,
+                   gconstpointer b,
+                   const T       d)
+{
+  V(4) *veca = (V(4)*)a;
+  V(4) *vecb = (V(4)*)b;
+
+  V(4) vecd;
+  T         dm;
+  T         dd;
+
+  F(4, sub) (vecb, veca, &vecd);
+
+  dm = F(4, get_magn_sq) (&vecd);
+  dd = d * d;
+
+  return (dm < dd);
+}
+
+gchar*
+F(4, to_string) (const V(4) *vec)
+{
+  return F(4, to_string_full) (vec, "(", ", ", ")", "%g");
+}
+
+gchar*
+F(4, to_string_full) (const V(4)  *vec,
+                      const gchar *left,
+                      const gchar *in,
+                      const gchar *right,
+                      const gchar *format)
+{
+  GString *strb = g_string_new (left);
+  gchar *result;
+
+  g_string_append_printf (strb, format, vec->x);
+  g_string_append (strb, in);
+
+  g_string_append_printf (strb, format, vec->y);
+  g_string_append (strb, in);
+
+  g_string_append_printf (strb, format, vec->z);
+  g_string_append (strb, in);
+
+  g_string_append_printf (strb, format, vec->w);
+  g_string_append (strb, right);
+
+  result = strb->str;
+
+  g_string_free (strb, FALSE);
+
+  return result;
+}
+
+
+//////// Standard vector property ///////
+
+T
+F(4, get_magn_sq) (const V(4) *vec)
+{
+  return (vec->x * vec->x) +
+         (vec->y * vec->y) +
+         (vec->z * vec->z) +
+         (vec->w * vec->w);
+}
+
+T
+F(4, get_magn) (const V(4) *vec)
+{
+  T sq = F(4, get_magn_sq) (vec);
+  return CRANK_VEC_MATH(sqrt) (sq);
+}
+
+
+//////// Standard unary operations ////////
+
+void
+F(4, neg) (const V(4) *a,
+           V(4)       *r)
+{
+  r->x = -(a->x);
+  r->y = -(a->y);
+  r->z = -(a->z);
+  r->w = -(a->w);
+}
+
+void
+F(4, neg_self) (V(4) *a)
+{
+  a->x = -(a->x);
+  a->y = -(a->y);
+  a->z = -(a->z);
+  a->w = -(a->w);
+}
+
+void
+F(4, unit) (const V(4) *a,
+            V(4)       *r)
+{
+  F(4, divs) (a, F(4, get_magn) (a), r);
+}
+
+void
+F(4, unit_self) (V(4) *a)
+{
+  F(4, divs_self) (a, F(4, get_magn) (a));
+}
+
+
+//////// Scalar operations ////////
+
+void
+F(4, muls) (const V(4) *a,
+            const T     b,
+            V(4)       *r)
+{
+  g_return_if_fail (a != r);
+
+  r->x = a->x * b;
+  r->y = a->y * b;
+  r->z = a->z * b;
+  r->w = a->w * b;
+}
+
+void
+F(4, muls_self) (V(4)    *a,
+                 const T  b)
+{
+  a->x *= b;
+  a->y *= b;
+  a->z *= b;
+  a->w *= b;
+}
+
+void
+F(4, divs) (const V(4) *a,
+            const T     b,
+            V(4)       *r)
+{
+  g_return_if_fail (a != r);
+
+  r->x = a->x / b;
+  r->y = a->y / b;
+  r->z = a->z / b;
+  r->w = a->w / b;
+}
+
+void
+F(4, divs_self) (V(4)    *a,
+                 const T  b)
+{
+  a->x /= b;
+  a->y /= b;
+  a->z /= b;
+  a->w /= b;
+}
+
+
+//////// Standard vector operations ////////
+
+void
+F(4, add) (const V(4) *a,
+           const V(4) *b,
+           V(4)       *r)
+{
+  g_return_if_fail (a != r);
+  g_return_if_fail (b != r);
+
+  r->x = a->x + b->x;
+  r->y = a->y + b->y;
+  r->z = a->z + b->z;
+  r->w = a->w + b->w;
+}
+
+void
+F(4, add_self) (V(4)       *a,
+                const V(4) *b)
+{
+  a->x += b->x;
+  a->y += b->y;
+  a->z += b->z;
+  a->w += b->w;
+}
+
+void
+F(4, sub) (const V(4) *a,
+           const V(4) *b,
+           V(4)       *r)
+{
+  g_return_if_fail (a != r);
+  g_return_if_fail (b != r);
+
+  r->x = a->x - b->x;
+  r->y = a->y - b->y;
+  r->z = a->z - b->z;
+  r->w = a->w - b->w;
+}
+
+void
+F(4, sub_self) (V(4)       *a,
+                const V(4) *b)
+{
+  a->x -= b->x;
+  a->y -= b->y;
+  a->z -= b->z;
+  a->w -= b->w;
+}
+
+T
+F(4, dot) (const V(4) *a,
+           const V(4) *b)
+{
+  return (a->x) * (b->x) +
+         (a->y) * (b->y) +
+         (a->z) * (b->z) +
+         (a->w) * (b->w);
+}
+
+
+//////// Component vector operations ////////
+
+void
+F(4, cmpmul) (const V(4) *a,
+              const V(4) *b,
+              V(4)       *r)
+{
+  g_return_if_fail (a != r);
+  g_return_if_fail (b != r);
+
+  r->x = a->x * b->x;
+  r->y = a->y * b->y;
+  r->z = a->z * b->z;
+  r->w = a->w * b->w;
+}
+
+void
+F(4, cmpmul_self) (V(4)       *a,
+                   const V(4) *b)
+{
+  a->x *= b->x;
+  a->y *= b->y;
+  a->z *= b->z;
+  a->w *= b->w;
+}
+
+void
+F(4, cmpdiv) (const V(4) *a,
+              const V(4) *b,
+              V(4)       *r)
+{
+  g_return_if_fail (a != r);
+  g_return_if_fail (b != r);
+
+  r->x = a->x / b->x;
+  r->y = a->y / b->y;
+  r->z = a->z / b->z;
+  r->w = a->w / b->w;
+}
+
+void
+F(4, cmpdiv_self) (V(4)       *a,
+                   const V(4) *b)
+{
+  a->x /= b->x;
+  a->y /= b->y;
+  a->z /= b->z;
+  a->w /= b->w;
+}
+
+
+void
+F(4, cmpless) (const V(4)    *a,
+               const V(4)    *b,
+               CrankVecBool4 *r)
+{
+  r->x = (a->x) < (b->x);
+  r->y = (a->y) < (b->y);
+  r->z = (a->z) < (b->z);
+  r->w = (a->w) < (b->w);
+}
+
+void
+F(4, cmpeq) (const V(4)    *a,
+             const V(4)    *b,
+             CrankVecBool4 *r)
+{
+  r->x = (a->x) == (b->x);
+  r->y = (a->y) == (b->y);
+  r->z = (a->z) == (b->z);
+  r->w = (a->w) == (b->w);
+}
+
+void
+F(4, cmpgreater) (const V(4)    *a,
+                  const V(4)    *b,
+                  CrankVecBool4 *r)
+{
+  r->x = (a->x) > (b->x);
+  r->y = (a->y) > (b->y);
+  r->z = (a->z) > (b->z);
+  r->w = (a->w) > (b->w);
+}
+
+void
+F(4, cmpcmp) (const V(4)   *a,
+              const V(4)   *b,
+              CrankVecInt4 *r)
+{
+  r->x = CMP(a->x, b->x);
+  r->y = CMP(a->y, b->y);
+  r->z = CMP(a->z, b->z);
+  r->w = CMP(a->w, b->w);
+}
+
+void
+F(4, min) (const V(4) *a,
+           const V(4) *b,
+           V(4)       *r)
+{
+  g_return_if_fail (a != r);
+  g_return_if_fail (b != r);
+
+  r->x = MIN (a->x, b->x);
+  r->y = MIN (a->y, b->y);
+  r->z = MIN (a->z, b->z);
+  r->w = MIN (a->w, b->w);
+}
+
+void
+F(4, max) (const V(4) *a,
+           const V(4) *b,
+           V(4)       *r)
+{
+  g_return_if_fail (a != r);
+  g_return_if_fail (b != r);
+
+  r->x = MAX (a->x, b->x);
+  r->y = MAX (a->y, b->y);
+  r->z = MAX (a->z, b->z);
+  r->w = MAX (a->w, b->w);
+}
+
+void
+F(4, abs) (const V(4) *a,
+           V(4)       *r)
+{
+  g_return_if_fail (a != r);
+
+  r->x = ABS (a->x);
+  r->y = ABS (a->y);
+  r->z = ABS (a->z);
+  r->w = ABS (a->w);
+}
+
+
+void
+F(4, abs_self) (V(4) *a)
+{
+  a->x = ABS (a->x);
+  a->y = ABS (a->y);
+  a->z = ABS (a->z);
+  a->w = ABS (a->w);
+}
+
+
+void
+F(4, mulm) (const V(4) *a,
+            const M(4) *b,
+            V(4)       *r)
+{
+  T nx, ny, nz, nw;
+
+  g_return_if_fail (a != r);
+
+  nx = (a->x * b->m00) + (a->y * b->m10) + (a->z * b->m20) + (a->w * b->m30);
+  ny = (a->x * b->m01) + (a->y * b->m11) + (a->z * b->m21) + (a->w * b->m31);
+  nz = (a->x * b->m02) + (a->y * b->m12) + (a->z * b->m22) + (a->w * b->m32);
+  nw = (a->x * b->m03) + (a->y * b->m13) + (a->z * b->m23) + (a->w * b->m33);
+
+  r->x = nx;
+  r->y = ny;
+  r->z = nz;
+  r->w = nw;
+}
+
+void
+F(4, mulm_self) (V(4)       *a,
+                 const M(4) *b)
+{
+  T nx, ny, nz, nw;
+
+  nx = (a->x * b->m00) + (a->y * b->m10) + (a->z * b->m20) + (a->w * b->m30);
+  ny = (a->x * b->m01) + (a->y * b->m11) + (a->z * b->m21) + (a->w * b->m31);
+  nz = (a->x * b->m02) + (a->y * b->m12) + (a->z * b->m22) + (a->w * b->m32);
+  nw = (a->x * b->m03) + (a->y * b->m13) + (a->z * b->m23) + (a->w * b->m33);
+
+  a->x = nx;
+  a->y = ny;
+  a->z = nz;
+  a->w = nw;
+}
+
+void
+F(4, mixs) (const V(4) *a,
+            const V(4) *b,
+            const T     c,
+            V(4)       *r)
+{
+  T d;
+
+  g_return_if_fail (a != r);
+  g_return_if_fail (b != r);
+
+  d = 1 - c;
+
+  r->x = a->x * d + b->x * c;
+  r->y = a->y * d + b->y * c;
+  r->z = a->z * d + b->z * c;
+  r->w = a->w * d + b->w * c;
+}
+
+
+void
+F(4, mix) (const V(4) *a,
+           const V(4) *b,
+           const V(4) *c,
+           V(4)       *r)
+{
+  V(4) d;
+
+  g_return_if_fail (a != r);
+  g_return_if_fail (b != r);
+  g_return_if_fail (c != r);
+
+  d.x = 1 - c->x;
+  d.y = 1 - c->y;
+  d.z = 1 - c->z;
+  d.w = 1 - c->w;
+
+  r->x = a->x * d.x + b->x * c->x;
+  r->y = a->y * d.y + b->y * c->y;
+  r->z = a->z * d.z + b->z * c->z;
+  r->w = a->w * d.w + b->w * c->w;
+}
+
+//////// GValue Transform //////////////////////////////////////////////////////
+
+static void
+F(4, transform_from_vb) (const GValue *src,
+                         GValue       *dest)
+{
+  V(4) *vec = g_new (V(4), 1);
+  CrankVecBool4 *vb = (CrankVecBool4*) g_value_get_boxed (src);
+
+  F(4, init_from_vb) (vec, vb);
+  g_value_take_boxed (dest, vec);
+}
+
+static void
+F(4, transform_from_vi) (const GValue *src,
+                         GValue       *dest)
+{
+  V(4) *vec = g_new (V(4), 1);
+  CrankVecInt4 *vi = (CrankVecInt4*) g_value_get_boxed (src);
+
+  F(4, init_from_vi) (vec, vi);
+  g_value_take_boxed (dest, vec);
+}
+
+static void
+F(4, transform_to_string) (const GValue *src,
+                           GValue       *dest)
+{
+  V(4) *vec = (V(4)*) g_value_get_boxed (src);
+  gchar *str = F(4, to_string) (vec);
+
+  g_value_take_string (dest, str);
+}
+
+
+static void F(_n, transform_from_vb) (const GValue *src,
+                                      GValue       *dest);
+
+static void F(_n, transform_from_vi) (const GValue *src,
+                                      GValue       *dest);
+
+static void F(_n, transform_from_v2) (const GValue *src,
+                                      GValue       *dest);
+
+static void F(_n, transform_from_v3) (const GValue *src,
+                                      GValue       *dest);
+
+static void F(_n, transform_from_v4) (const GValue *src,
+                                      GValue       *dest);
+
+static void F(_n, transform_to_string) (const GValue *src,
+                                        GValue       *dest);
+
+#ifdef CRANK_VEC_FROM_TYPE
+void
+F(_n, init_from_vf) (V(N)           *vec,
+                     const VF(N) *vf)
+{
+  guint i;
+
+  CRANK_VEC_N_ALLOC (vec, vf->n);
+  for (i = 0; i < vf->n; i++)
+    vec->data[i] = vf->data[i];
+}
+
+static void
+F(_n, transform_from_vf) (const GValue *src,
+                          GValue       *dest)
+{
+  V(N) *vec = g_new (V(N), 1);
+  VF(N) *vf = (VF(N)*) g_value_get_boxed (src);
+
+  F(_n, init_from_vf) (vec, vf);
+  g_value_take_boxed (dest, vec);
+}
+#endif
+
+G_DEFINE_BOXED_TYPE_WITH_CODE (
+  V(N),
+  CRANK_VEC_SYM(_n),
+  F(_n, dup),
+  g_free,
+  {
+    g_value_register_transform_func (CRANK_TYPE_VEC_BOOL_N,
+                                     g_define_type_id,
+                                     F(_n, transform_from_vb));
+
+    g_value_register_transform_func (CRANK_TYPE_VEC_INT_N,
+                                     g_define_type_id,
+                                     F(_n, transform_from_vi));
+
+    CRANK_VEC_REGISTER_FROM (CRANK_VEC_FROM_GTYPE(_N),
+                             F(_n, transform_from_vf));
+
+    g_value_register_transform_func (CRANK_VEC_GTYPE(2),
+                                     g_define_type_id,
+                                     F(_n, transform_from_v2));
+
+    g_value_register_transform_func (CRANK_VEC_GTYPE(3),
+                                     g_define_type_id,
+                                     F(_n, transform_from_v3));
+
+    g_value_register_transform_func (CRANK_VEC_GTYPE(4),
+                                     g_define_type_id,
+                                     F(_n, transform_from_v4));
+
+    g_value_register_transform_func (g_define_type_id,
+                                     G_TYPE_STRING,
+                                     F(_n, transform_to_string));
+  })
+
+
+void
+F(_n, init) (V(N) *vec,
+             const guint     n,
+             ...)
+{
+  va_list varargs;
+
+  va_start (varargs, n);
+
+  F(_n, init_valist) (vec, n, varargs);
+
+  va_end (varargs);
+}
+
+void
+F(_n, init_arr) (V(N)        *vec,
+                 const guint  n,
+                 const T     *arr)
+{
+  guint i;
+
+  CRANK_VEC_N_ALLOC (vec, n);
+  for (i = 0; i < n; i++)
+    vec->data[i] = arr[i];
+}
+
+void
+F(_n, init_arr_take) (V(N)        *vec,
+                      const guint  n,
+                      T           *arr)
+{
+  vec->n = n;
+  vec->data = arr;
+}
+
+void
+F(_n, init_arena) (V(N)          *vec,
+                   CrankMatArena *arena,
+                   const guint    n)
+{
+  vec->n = n;
+  vec->data = crank_mat_arena_alloc0 (arena, n * sizeof (T));
+}
+
+void
+F(_n, init_arr_arena) (V(N)          *vec,
+                       CrankMatArena *arena,
+                       const guint    n,
+                       const T       *arr)
+{
+  vec->n = n;
+  vec->data = crank_mat_arena_alloc (arena, n * sizeof (T));
+  memcpy (vec->data, arr, n * sizeof (T));
+}
+
+void
+F(_n, init_valist) (V(N)        *vec,
+                    const guint  n,
+                    va_list      varargs)
+{
+  guint i;
+
+  CRANK_VEC_N_ALLOC (vec, n);
+  for (i = 0; i < n; i++)
+    vec->data[i] = va_arg (varargs, gdouble);
+}
+
+void
+F(_n, init_fill) (V(N)        *vec,
+                  const guint  n,
+                  const T      fill)
+{
+  guint i;
+
+  CRANK_VEC_N_ALLOC (vec, n);
+  for (i = 0; i < n; i++)
+    vec->data[i] = fill;
+}
+
+void
+F(_n, init_from_vb) (V(N)                *vec,
+                     const CrankVecBoolN *vb)
+{
+  guint i;
+
+  CRANK_VEC_N_ALLOC (vec, vb->n);
+  for (i = 0; i < vb->n; i++)
+    vec->data[i] = vb->data[i] ? 1 : 0;
+}
+
+void
+F(_n, init_from_vi) (V(N)               *vec,
+                     const CrankVecIntN *vi)
+{
+  guint i;
+
+  CRANK_VEC_N_ALLOC (vec, vi->n);
+  for (i = 0; i < vi->n; i++)
+    vec->data[i] = vi->data[i];
+}
+
+
+void
+F(_n, fini) (V(N) *vec)
+{
+  g_free (vec->data);
+  vec->data = NULL;
+  vec->n = 0;
+}
+
+
+void
+F(_n, copy) (const V(N) *vec,
+             V(N)       *other)
+{
+  F(_n, init_arr) (other, vec->n, vec->data);
+}
+
+V(N)*
+F(_n, dup) (const V(N) *vec)
+{
+  V(N) *result = g_new0 (V(N), 1);
+  F(_n, copy) (vec, result);
+  return result;
+}
+
+void
+F(_n, free) (V(N) *vec)
+{
+  F(_n, fini) (vec);
+  g_free (vec);
+}
+
+guint
+F(_n, get_size) (const V(N) *vec)
+{
+  return vec->n;
+}
+
+T
+(F(_n, get)) (const V(N)  *vec,
+              const guint  index)
+{
+  return CRANK_VEC_GET (vec, index);
+}
+
+void
+(F(_n, set)) (V(N)        *vec,
+              const guint  index,
+              const T      value)
+{
+  CRANK_VEC_SET (vec, index, value);
+}
+
+void
+F(_n, prepend) (V(N)    *vec,
+                const T  value)
+{
+  F(_n, insert) (vec, 0, value);
+}
+
+void
+F(_n, append) (V(N)    *vec,
+               const T  value)
+{
+  F(_n, insert) (vec, vec->n, value);
+}
+
+void
+F(_n, insert) (V(N)        *vec,
+               const guint  index,
+               const T      value)
+{
+  T *data;
+  guint i;
+
+  g_return_if_fail (index <= vec->n);
+
+  data = vec->data;
+  CRANK_VEC_N_ALLOC (vec, vec->n + 1);
+
+  for (i = 0; i < index; i++)
+    vec->data[i] = data[i];
+
+  vec->data[index] = value;
+
+  for (i = index + 1; i < vec->n; i++)
+    vec->data[i] = data[i - 1];
+
+  g_free (data);
+}
+
+void
+F(_n, remove) (V(N)        *vec,
+               const guint  index)
+{
+  T *data;
+  guint i;
+
+  g_return_if_fail (index < vec->n);
+
+  data = vec->data;
+  CRANK_VEC_N_ALLOC (vec, vec->n - 1);
+
+  for (i = 0; i < index; i++)
+    vec->data[i] = data[i];
+
+  for (i = index; i < vec->n; i++)
+    vec->data[i] = data[i + 1];
+
+  g_free (data);
+}
+
+gboolean
+F(_n, foreach) (const V(N)          *vec,
+                CRANK_VEC_BOOL_FUNC  func,
+                gpointer             userdata)
+{
+  guint i;
+
+  for (i = 0; i < vec->n; i++)
+    if (!func (vec->data[i], userdata))
+      return FALSE;
+
+  return TRUE;
+}
+
+void
+F(_n, iterator) (V(N)           *vec,
+                 CRANK_VEC_ITER *iter)
+{
+  CRANK_VEC_ITER_FUNC(init_with_count) (iter, vec->data, vec->n);
+}
+
+
+//////// Basic operation ////////
+
+guint
+F(_n, hash) (gconstpointer a)
+{
+  const V(N) *vec = a;
+
+  guint i;
+  guint hash = 0;
+
+  for (i = 0; i < vec->n; i++)
+    hash += CRANK_VEC_HASH (vec->data + i) + hash * 37;
+
+  return hash;
+}
+
+gboolean
+F(_n, equal) (gconstpointer a,
+              gconstpointer b)
+{
+  V(N) *veca = (V(N)*)a;
+  V(N) *vecb = (V(N)*)b;
+
+  guint n;
+  guint i;
+
+  if (veca->n != vecb->n)
+    return FALSE;
+
+  n = veca->n;
+
+  for (i = 0; i < n; i++)
+    {
+      if (veca->data[i] != vecb->data[i])
+        return FALSE;
+    }
+
+  return TRUE;
+}
+
+gboolean
+F(_n, equal_delta) (gconstpointer a,
+                    gconstpointer b,
+                    const T       d)
+{
+  V(N) *veca = (V(N)*)a;
+  V(N) *vecb = (V(N)*)b;
+
+  V(N) vecd;
+  T         dm;
+  T         dd;
+
+  if (veca->n != vecb->n)
+    return FALSE;
+
+  F(_n, sub) (vecb, veca, &vecd);
+
+  dm = F(_n, get_magn_sq) (&vecd);
+  dd = d * d;
+
+  return (dm < dd);
+}
+
+gchar*
+F(_n, to_string) (const V(N) *vec)
+{
+  return F(_n, to_string_full) (vec, "(", ", ", ")", "%g");
+}
+
+gchar*
+F(_n, to_string_full) (const V(N)  *vec,
+                       const gchar *left,
+                       const gchar *in,
+                       const gchar *right,
+                       const gchar *format)
+{
+  GString *strb = g_string_new (left);
+  gchar *result;
+
+  guint i;
+
+  if (vec->n != 0)
+    {
+      g_string_append_printf (strb, format, vec->data[0]);
+
+      for (i = 1; i < vec->n; i++)
+        {
+          g_string_append (strb, in);
+          g_string_append_printf (strb, format, vec->data[i]);
+        }
+    }
+  g_string_append (strb, right);
+
+  result = strb->str;
+
+  g_string_free (strb, FALSE);
+
+  return result;
+}
+
+
+//////// Classification ////////////////////////////////////////////////////////
+
+gboolean
+F(_n, is_zero) (const V(N) *vec)
+{
+  guint i;
+
+  for (i = 0; i < vec->n; i++)
+    {
+      if (vec->data[i] != 0)
+        return FALSE;
+    }
+
+  return TRUE;
+}
+
+gboolean
+F(_n, is_one) (const V(N) *vec)
+{
+  guint i;
+
+  for (i = 0; i < vec->n; i++)
+    {
+      if (vec->data[i] != 1)
+        return FALSE;
+    }
+
+  return TRUE;
+}
+
+gboolean
+F(_n, is_unit) (const V(N) *vec)
+{
+  T magnsq = F(_n, get_magn_sq) (vec);
+
+  return ((T) 0.9999 <= magnsq) && (magnsq <= (T) 1.0001);
+}
+
+gboolean
+F(_n, is_empty) (const V(N) *vec)
+{
+  return vec->n == 0;
+}
+
+gboolean
+F(_n, has_nan) (const V(N) *vec)
+{
+  guint i;
+
+  for (i = 0; i < vec->n; i++)
+    {
+      if (isnanf (vec->data[i]))
+        return TRUE;
+    }
+  return FALSE;
+}
+
+gboolean
+F(_n, has_inf) (const V(N) *vec)
+{
+  guint i;
+
+  for (i = 0; i < vec->n; i++)
+    {
+      if (isinff (vec->data[i]))
+        return TRUE;
+    }
+  return FALSE;
+}
+
+//////// Standard vector property ///////
+
+T
+F(_n, get_magn_sq) (const V(N) *vec)
+{
+  return CRANK_VEC_GET_KERNELS ()->dot (vec->n, vec->data, vec->data);
+}
+
+T
+F(_n, get_magn) (const V(N) *vec)
+{
+  T sq = F(_n, get_magn_sq) (vec);
+  return CRANK_VEC_MATH(sqrt) (sq);
+}
+
+
+//////// Standard unary operations ////////
+
+void
+F(_n, neg) (const V(N) *a,
+            V(N)       *r)
+{
+  F(_n, muls) (a, -1, r);
+}
+
+
+void
+F(_n, neg_self) (V(N) *a)
+{
+  F(_n, muls_self) (a, -1);
+}
+
+
+void
+F(_n, unit) (const V(N) *a,
+             V(N)       *r)
+{
+  F(_n, divs) (a, F(_n, get_magn) (a), r);
+}
+
+
+void
+F(_n, unit_self) (V(N) *a)
+{
+  F(_n, divs_self) (a, F(_n, get_magn) (a));
+}
+
+
+//////// Scalar operations ////////
+
+void
+F(_n, muls) (const V(N) *a,
+             const T     b,
+             V(N)       *r)
+{
+  g_return_if_fail (a != r);
+
+  CRANK_VEC_N_ALLOC (r, a->n);
+  CRANK_VEC_GET_KERNELS ()->muls (a->n, a->data, b, r->data);
+}
+
+void
+F(_n, muls_self) (V(N)    *a,
+                  const T  b)
+{
+  CRANK_VEC_GET_KERNELS ()->muls (a->n, a->data, b, a->data);
+}
+
+void
+F(_n, divs) (const V(N) *a,
+             const T     b,
+             V(N)       *r)
+{
+  g_return_if_fail (a != r);
+
+  CRANK_VEC_N_ALLOC (r, a->n);
+  CRANK_VEC_GET_KERNELS ()->divs (a->n, a->data, b, r->data);
+}
+
+void
+F(_n, divs_self) (V(N)    *a,
+                  const T  b)
+{
+  CRANK_VEC_GET_KERNELS ()->divs (a->n, a->data, b, a->data);
+}
+
+
+//////// Standard vector operations ////////
+
+void
+F(_n, add) (const V(N) *a,
+            const V(N) *b,
+            V(N)       *r)
+{
+  g_return_if_fail (a != r);
+  g_return_if_fail (b != r);
+
+  CRANK_VEC_WARN_IF_SIZE_MISMATCH2 (CRANK_VEC_NAME, "add", a, b);
+  CRANK_VEC_N_ALLOC (r, a->n);
+
+  CRANK_VEC_GET_KERNELS ()->add (a->n, a->data, b->data, r->data);
+}
+
+void
+F(_n, add_self) (V(N)       *a,
+                 const V(N) *b)
+{
+  CRANK_VEC_WARN_IF_SIZE_MISMATCH2 (CRANK_VEC_NAME, "add-self", a, b);
+
+  CRANK_VEC_GET_KERNELS ()->add (a->n, a->data, b->data, a->data);
+}
+
+void
+F(_n, sub) (const V(N) *a,
+            const V(N) *b,
+            V(N)       *r)
+{
+  g_return_if_fail (a != r);
+  g_return_if_fail (b != r);
+
+  CRANK_VEC_WARN_IF_SIZE_MISMATCH2 (CRANK_VEC_NAME, "sub", a, b);
+  CRANK_VEC_N_ALLOC (r, a->n);
+
+  CRANK_VEC_GET_KERNELS ()->sub (a->n, a->data, b->data, r->data);
+}
+
+void
+F(_n, sub_self) (V(N)       *a,
+                 const V(N) *b)
+{
+  CRANK_VEC_WARN_IF_SIZE_MISMATCH2 (CRANK_VEC_NAME, "sub-self", a, b);
+
+  CRANK_VEC_GET_KERNELS ()->sub (a->n, a->data, b->data, a->data);
+}
+
+T
+F(_n, dot) (const V(N) *a,
+            const V(N) *b)
+{
+  CRANK_VEC_WARN_IF_SIZE_MISMATCH2_RET (CRANK_VEC_NAME, "dot", a, b, 0);
+
+  return CRANK_VEC_GET_KERNELS ()->dot (a->n, a->data, b->data);
+}
+
+//////// Component vector operations ////////
+
+void
+F(_n, cmpmul) (const V(N) *a,
+               const V(N) *b,
+               V(N)       *r)
+{
+  g_return_if_fail (a != r);
+  g_return_if_fail (b != r);
+
+  CRANK_VEC_WARN_IF_SIZE_MISMATCH2 (CRANK_VEC_NAME, "cmpmul", a, b);
+  CRANK_VEC_N_ALLOC (r, a->n);
+
+  CRANK_VEC_GET_KERNELS ()->mul (a->n, a->data, b->data, r->data);
+}
+
+void
+F(_n, cmpmul_self) (V(N)       *a,
+                    const V(N) *b)
+{
+  CRANK_VEC_WARN_IF_SIZE_MISMATCH2 (CRANK_VEC_NAME, "cmpmul-self", a, b);
+
+  CRANK_VEC_GET_KERNELS ()->mul (a->n, a->data, b->data, a->data);
+}
+
+void
+F(_n, cmpdiv) (const V(N) *a,
+               const V(N) *b,
+               V(N)       *r)
+{
+  g_return_if_fail (a != r);
+  g_return_if_fail (b != r);
+
+  CRANK_VEC_WARN_IF_SIZE_MISMATCH2 (CRANK_VEC_NAME, "cmpdiv", a, b);
+  CRANK_VEC_N_ALLOC (r, a->n);
+
+  CRANK_VEC_GET_KERNELS ()->div (a->n, a->data, b->data, r->data);
+}
+
+void
+F(_n, cmpdiv_self) (V(N)       *a,
+                    const V(N) *b)
+{
+  CRANK_VEC_WARN_IF_SIZE_MISMATCH2 (CRANK_VEC_NAME, "cmpdiv-self", a, b);
+
+  CRANK_VEC_GET_KERNELS ()->div (a->n, a->data, b->data, a->data);
+}
+
+void
+F(_n, cmpless) (const V(N)    *a,
+                const V(N)    *b,
+                CrankVecBoolN *r)
+{
+  guint i;
+
+  CRANK_VEC_WARN_IF_SIZE_MISMATCH2 (CRANK_VEC_NAME, "cmpless", a, b);
+  CRANK_VEC_ALLOC(r, gboolean, a->n);
+
+  for (i = 0; i < a->n; i++)
+    r->data[i] = a->data[i] < b->data[i];
+}
+
+void
+F(_n, cmpeq) (const V(N)    *a,
+              const V(N)    *b,
+              CrankVecBoolN *r)
+{
+  guint i;
+
+  CRANK_VEC_WARN_IF_SIZE_MISMATCH2 (CRANK_VEC_NAME, "cmpeq", a, b);
+  CRANK_VEC_ALLOC(r, gboolean, a->n);
+
+  for (i = 0; i < a->n; i++)
+    r->data[i] = a->data[i] == b->data[i];
+}
+
+void
+F(_n, cmpgreater) (const V(N)    *a,
+                   const V(N)    *b,
+                   CrankVecBoolN *r)
+{
+  guint i;
+
+  CRANK_VEC_WARN_IF_SIZE_MISMATCH2 (CRANK_VEC_NAME, "cmpgreater", a, b);
+  CRANK_VEC_ALLOC(r, gboolean, a->n);
+
+  for (i = 0; i < a->n; i++)
+    r->data[i] = a->data[i] > b->data[i];
+}
+
+void
+F(_n, cmpcmp) (const V(N)   *a,
+               const V(N)   *b,
+               CrankVecIntN *r)
+{
+  guint i;
+
+  CRANK_VEC_WARN_IF_SIZE_MISMATCH2 (CRANK_VEC_NAME, "cmpcmp", a, b);
+  CRANK_VEC_ALLOC(r, gint, a->n);
+
+  for (i = 0; i < a->n; i++)
+    r->data[i] = CMP (a->data[i], b->data[i]);
+}
+
+void
+F(_n, min) (const V(N) *a,
+            const V(N) *b,
+            V(N)       *r)
+{
+  guint i;
+
+  g_return_if_fail (a != r);
+  g_return_if_fail (b != r);
+
+  CRANK_VEC_WARN_IF_SIZE_MISMATCH2 (CRANK_VEC_NAME, "min", a, b);
+  CRANK_VEC_N_ALLOC (r, a->n);
+
+  for (i = 0; i < a->n; i++)
+    r->data[i] = MIN (a->data[i], b->data[i]);
+}
+
+void
+F(_n, max) (const V(N) *a,
+            const V(N) *b,
+            V(N)       *r)
+{
+  guint i;
+
+  g_return_if_fail (a != r);
+  g_return_if_fail (b != r);
+
+  CRANK_VEC_WARN_IF_SIZE_MISMATCH2 (CRANK_VEC_NAME, "max", a, b);
+  CRANK_VEC_N_ALLOC (r, a->n);
+
+  for (i = 0; i < a->n; i++)
+    r->data[i] = MAX (a->data[i], b->data[i]);
+}
+
+
+void
+F(_n, abs) (const V(N) *a,
+            V(N)       *r)
+{
+  guint i;
+
+  g_return_if_fail (a != r);
+
+  CRANK_VEC_N_ALLOC (r, a->n);
+
+  for (i = 0; i < a->n; i++)
+    r->data[i] = ABS (a->data[i]);
+}
+
+void
+F(_n, abs_self) (V(N) *a)
+{
+  guint i;
+
+  for (i = 0; i < a->n; i++)
+    a->data[i] = ABS (a->data[i]);
+}
+
+
+//////// Masked operations ////////
+
+#ifdef CRANK_VEC_GET_MASK_KERNELS
+
+void
+F(_n, blend) (const V(N)          *a,
+              const V(N)          *b,
+              const CrankVecBoolN *mask,
+              V(N)                *r)
+{
+  g_return_if_fail (a != r);
+  g_return_if_fail (b != r);
+
+  CRANK_VEC_WARN_IF_SIZE_MISMATCH2 (CRANK_VEC_NAME, "blend", a, b);
+  CRANK_VEC_WARN_IF_SIZE_MISMATCH2 (CRANK_VEC_NAME, "blend", a, mask);
+  CRANK_VEC_N_ALLOC (r, a->n);
+
+  CRANK_VEC_GET_MASK_KERNELS ()->blend (a->n, a->data, b->data,
+                                        mask->data, r->data);
+}
+
+void
+F(_n, cmpblend) (const V(N)          *a,
+                 const CrankVecCmpOp  op,
+                 const V(N)          *b,
+                 const V(N)          *x,
+                 const V(N)          *y,
+                 V(N)                *r)
+{
+  g_return_if_fail (a != r);
+  g_return_if_fail (b != r);
+  g_return_if_fail (x != r);
+  g_return_if_fail (y != r);
+
+  CRANK_VEC_WARN_IF_SIZE_MISMATCH2 (CRANK_VEC_NAME, "cmpblend", a, b);
+  CRANK_VEC_WARN_IF_SIZE_MISMATCH2 (CRANK_VEC_NAME, "cmpblend", a, x);
+  CRANK_VEC_WARN_IF_SIZE_MISMATCH2 (CRANK_VEC_NAME, "cmpblend", a, y);
+  CRANK_VEC_N_ALLOC (r, a->n);
+
+  CRANK_VEC_GET_MASK_KERNELS ()->cmpblend (a->n, op, a->data, b->data,
+                                           x->data, y->data, r->data);
+}
+
+guint
+F(_n, cmpcount) (const V(N)          *a,
+                 const CrankVecCmpOp  op,
+                 const V(N)          *b)
+{
+  CRANK_VEC_WARN_IF_SIZE_MISMATCH2_RET (CRANK_VEC_NAME, "cmpcount", a, b, 0);
+
+  return CRANK_VEC_GET_MASK_KERNELS ()->cmpcount (a->n, op, a->data,
+                                                  b->data);
+}
+
+void
+F(_n, masked_add) (const V(N)          *a,
+                   const V(N)          *b,
+                   const CrankVecBoolN *mask,
+                   V(N)                *r)
+{
+  g_return_if_fail (a != r);
+  g_return_if_fail (b != r);
+
+  CRANK_VEC_WARN_IF_SIZE_MISMATCH2 (CRANK_VEC_NAME, "masked-add", a, b);
+  CRANK_VEC_WARN_IF_SIZE_MISMATCH2 (CRANK_VEC_NAME, "masked-add", a, mask);
+  CRANK_VEC_N_ALLOC (r, a->n);
+
+  CRANK_VEC_GET_MASK_KERNELS ()->masked_add (a->n, a->data, b->data,
+                                             mask->data, r->data);
+}
+
+void
+F(_n, masked_add_self) (V(N)                *a,
+                        const V(N)          *b,
+                        const CrankVecBoolN *mask)
+{
+  CRANK_VEC_WARN_IF_SIZE_MISMATCH2 (CRANK_VEC_NAME, "masked-add-self", a, b);
+  CRANK_VEC_WARN_IF_SIZE_MISMATCH2 (CRANK_VEC_NAME, "masked-add-self", a, mask);
+
+  CRANK_VEC_GET_MASK_KERNELS ()->masked_add (a->n, a->data, b->data,
+                                             mask->data, a->data);
+}
+
+void
+F(_n, masked_mul) (const V(N)          *a,
+                   const V(N)          *b,
+                   const CrankVecBoolN *mask,
+                   V(N)                *r)
+{
+  g_return_if_fail (a != r);
+  g_return_if_fail (b != r);
+
+  CRANK_VEC_WARN_IF_SIZE_MISMATCH2 (CRANK_VEC_NAME, "masked-mul", a, b);
+  CRANK_VEC_WARN_IF_SIZE_MISMATCH2 (CRANK_VEC_NAME, "masked-mul", a, mask);
+  CRANK_VEC_N_ALLOC (r, a->n);
+
+  CRANK_VEC_GET_MASK_KERNELS ()->masked_mul (a->n, a->data, b->data,
+                                             mask->data, r->data);
+}
+
+void
+F(_n, masked_mul_self) (V(N)                *a,
+                        const V(N)          *b,
+                        const CrankVecBoolN *mask)
+{
+  CRANK_VEC_WARN_IF_SIZE_MISMATCH2 (CRANK_VEC_NAME, "masked-mul-self", a, b);
+  CRANK_VEC_WARN_IF_SIZE_MISMATCH2 (CRANK_VEC_NAME, "masked-mul-self", a, mask);
+
+  CRANK_VEC_GET_MASK_KERNELS ()->masked_mul (a->n, a->data, b->data,
+                                             mask->data, a->data);
+}
+
+void
+F(_n, compress) (const V(N)          *a,
+                 const CrankVecBoolN *mask,
+                 V(N)                *r)
+{
+  guint count;
+
+  g_return_if_fail (a != r);
+
+  CRANK_VEC_WARN_IF_SIZE_MISMATCH2 (CRANK_VEC_NAME, "compress", a, mask);
+
+  count = crank_vec_bool_n_get_count ((CrankVecBoolN*) mask);
+  CRANK_VEC_N_ALLOC (r, count);
+
+  CRANK_VEC_GET_MASK_KERNELS ()->compress (a->n, a->data, mask->data,
+                                           r->data);
+}
+
+void
+F(_n, cmpcompress) (const V(N)          *a,
+                    const CrankVecCmpOp  op,
+                    const V(N)          *b,
+                    V(N)                *r)
+{
+  guint count;
+
+  g_return_if_fail (a != r);
+  g_return_if_fail (b != r);
+
+  CRANK_VEC_WARN_IF_SIZE_MISMATCH2 (CRANK_VEC_NAME, "cmpcompress", a, b);
+
+  count = CRANK_VEC_GET_MASK_KERNELS ()->cmpcount (a->n, op, a->data,
+                                                   b->data);
+  CRANK_VEC_N_ALLOC (r, count);
+
+  CRANK_VEC_GET_MASK_KERNELS ()->cmpcompress (a->n, op, a->data,
+                                              b->data, r->data);
+}
+
+void
+F(_n, expand) (const V(N)          *a,
+               const CrankVecBoolN *mask,
+               const T              fill,
+               V(N)                *r)
+{
+  guint count;
+
+  g_return_if_fail (a != r);
+
+  count = crank_vec_bool_n_get_count ((CrankVecBoolN*) mask);
+
+  if (G_UNLIKELY (a->n < count))
+    {
+      g_warning (CRANK_VEC_NAME ": expand: size mismatch: %u, %u", a->n, count);
+      return;
+    }
+
+  CRANK_VEC_N_ALLOC (r, mask->n);
+
+  CRANK_VEC_GET_MASK_KERNELS ()->expand (mask->n, a->data, mask->data,
+                                         fill, r->data);
+}
+
+#endif
+
+
+void
+F(_n, mulm) (const V(N) *a,
+             const M(N) *b,
+             V(N)       *r)
+{
+  g_return_if_fail (a != r);
+
+  if (a->n == b->rn)
+    {
+      guint i;
+      guint j;
+      T *data;
+
+      data = _crank_cpu_alloc0_aligned (b->cn * sizeof (T));
+
+      for (i = 0; i < b->cn; i++)
+        for (j = 0; j < a->n; j++)
+          data[i] += a->data[j] * b->data[(b->cn * j) + i];
+
+      F(_n, init_arr_take) (r, b->cn, data);
+    }
+  else
+    g_warning (CRANK_VEC_NAME ": mulm: size mismatch: %u, %ux%u",
+               a->n, b->rn, b->cn);
+
+
+}
+
+
+void
+F(_n, mulm_self) (V(N)       *a,
+                  const M(N) *b)
+{
+  if (a->n == b->rn)
+    {
+      guint i;
+      guint j;
+      T *data;
+
+      data = _crank_cpu_alloc0_aligned (b->cn * sizeof (T));
+
+      for (i = 0; i < b->cn; i++)
+        for (j = 0; j < a->n; j++)
+          data[i] += a->data[j] * b->data[(b->cn * j) + i];
+
+      g_free (a->data);
+      F(_n, init_arr_take) (a, b->cn, data);
+    }
+  else
+    g_warning (CRANK_VEC_NAME ": mulm-self: size mismatch: %u, %ux%u",
+               a->n,
+               b->rn,
+               b->cn);
+}
+
+void
+F(_n, mixs) (const V(N) *a,
+             const V(N) *b,
+             const T     c,
+             V(N)       *r)
+{
+  g_return_if_fail (a != r);
+  g_return_if_fail (b != r);
+
+  CRANK_VEC_WARN_IF_SIZE_MISMATCH2 (CRANK_VEC_NAME, "mixs", a, b);
+  CRANK_VEC_N_ALLOC (r, a->n);
+
+  CRANK_VEC_GET_KERNELS ()->mixs (a->n, a->data, b->data, c, r->data);
+}
+
+
+void
+F(_n, mix) (const V(N) *a,
+            const V(N) *b,
+            const V(N) *c,
+            V(N)       *r)
+{
+  g_return_if_fail (a != r);
+  g_return_if_fail (b != r);
+  g_return_if_fail (c != r);
+
+  CRANK_VEC_WARN_IF_SIZE_MISMATCH3 (CRANK_VEC_NAME, "mix", a, b, c);
+  CRANK_VEC_N_ALLOC (r, a->n);
+
+  CRANK_VEC_GET_KERNELS ()->mix (a->n, a->data, b->data, c->data,
+                                 r->data);
+}
+
+//////// GValue Transform //////////////////////////////////////////////////////
+
+static void
+F(_n, transform_from_vb) (const GValue *src,
+                          GValue       *dest)
+{
+  V(N) *vec = g_new (V(N), 1);
+  CrankVecBoolN *vb = (CrankVecBoolN*) g_value_get_boxed (src);
+
+  F(_n, init_from_vb) (vec, vb);
+  g_value_take_boxed (dest, vec);
+}
+
+static void
+F(_n, transform_from_vi) (const GValue *src,
+                          GValue       *dest)
+{
+  V(N) *vec = g_new (V(N), 1);
+  CrankVecIntN *vi = (CrankVecIntN*) g_value_get_boxed (src);
+
+  F(_n, init_from_vi) (vec, vi);
+  g_value_take_boxed (dest, vec);
+}
+
+static void
+F(_n, transform_from_v2) (const GValue *src,
+                          GValue       *dest)
+{
+  V(N) *vec = g_new (V(N), 1);
+  T *array = (T*) g_value_get_boxed (src);
+
+  F(_n, init_arr) (vec, 2, array);
+  g_value_take_boxed (dest, vec);
+}
+
+static void
+F(_n, transform_from_v3) (const GValue *src,
+                          GValue       *dest)
+{
+  V(N) *vec = g_new (V(N), 1);
+  T *array = (T*) g_value_get_boxed (src);
+
+  F(_n, init_arr) (vec, 3, array);
+
+  g_value_take_boxed (dest, vec);
+}
+
+static void
+F(_n, transform_from_v4) (const GValue *src,
+                          GValue       *dest)
+{
+  V(N) *vec = g_new (V(N), 1);
+  T *array = (T*) g_value_get_boxed (src);
+
+  F(_n, init_arr) (vec, 4, array);
+
+  g_value_take_boxed (dest, vec);
+}
+
+static void
+F(_n, transform_to_string) (const GValue *src,
+                            GValue       *dest)
+{
+  V(N) *vec = (V(N)*) g_value_get_boxed (src);
+  gchar *str = F(_n, to_string) (vec);
+  g_value_take_string (dest, str);
+}
+
+#undef CMP
+#undef CRANK_VEC_N_ALLOC
+#undef CRANK_VEC_REGISTER_FROM
+#undef CRANK_VEC3_BATCH_CHUNK
+
+#undef T
+#undef V
+#undef M
+#undef F
+#undef I
+#undef V256
+#undef W256
+#undef VF
+
+#endif
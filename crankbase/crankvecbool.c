@@ -38,6 +38,18 @@
  *
  * Compared to bvec in GLSL.
  *
+ * # Packed vectors
+ *
+ * #CrankVecBoolN takes a #gboolean for each element, which is 32 times larger
+ * than a bit. For large masks, like visibility of many objects,
+ * #CrankVecBoolPacked packs 64 elements into a word. Logical operations are
+ * done on words, and are vectorized by CPU features. Indices of %TRUE elements
+ * can be found by crank_vec_bool_packed_find_next() or
+ * crank_vec_bool_packed_get_indices(), skipping %FALSE elements by words.
+ *
+ * These can be converted from and to #gboolean arrays, or #CrankVecBoolN by
+ * crank_vec_bool_packed_init_from_vb() and crank_vec_bool_packed_to_vb().
+ *
  * # Type Conversion.
  *
  * Boolean vector types are seldomly used, but for convenience, it can be
@@ -179,6 +191,7 @@
  */
 
 #include <stdarg.h>
+#include <string.h>
 
 #include <glib.h>
 #include <glib-object.h>
@@ -189,6 +202,12 @@
 #include "crankveccommon.h"
 #include "crankvecbool.h"
 
+#include "crankcpu-private.h"
+
+#ifdef CRANK_CPU_X86
+#include <immintrin.h>
+#endif
+
 
 
 //////// GValue converter //////////////////////////////////////////////////////
@@ -2768,3 +2787,951 @@ crank_vec_bool_n_transform_to_string (const GValue *src,
 
   g_value_take_string (dest, str);
 }
+
+
+
+
+//////// CrankVecBoolPacked ////////////////////////////////////////////////////
+
+G_DEFINE_BOXED_TYPE (CrankVecBoolPacked,
+                     crank_vec_bool_packed,
+                     crank_vec_bool_packed_dup,
+                     crank_vec_bool_packed_free)
+
+//////// Private Type ////////
+
+typedef enum _CrankVecBoolPackedOp {
+  CRANK_VEC_BOOL_PACKED_OP_AND,
+  CRANK_VEC_BOOL_PACKED_OP_OR,
+  CRANK_VEC_BOOL_PACKED_OP_XOR,
+  CRANK_VEC_BOOL_PACKED_OP_ANDNOT
+} CrankVecBoolPackedOp;
+
+//////// Private Functions ////////
+
+#ifdef __GNUC__
+#define CRANK_VEC_BOOL_POPCOUNT64(w)  ((guint) __builtin_popcountll (w))
+#define CRANK_VEC_BOOL_CTZ64(w)       ((guint) __builtin_ctzll (w))
+#else
+static inline guint
+crank_vec_bool_popcount64 (guint64 w)
+{
+  w = w - ((w >> 1) & G_GUINT64_CONSTANT (0x5555555555555555));
+  w = (w & G_GUINT64_CONSTANT (0x3333333333333333)) +
+      ((w >> 2) & G_GUINT64_CONSTANT (0x3333333333333333));
+  w = (w + (w >> 4)) & G_GUINT64_CONSTANT (0x0F0F0F0F0F0F0F0F);
+  return (guint)((w * G_GUINT64_CONSTANT (0x0101010101010101)) >> 56);
+}
+#define CRANK_VEC_BOOL_POPCOUNT64(w)  crank_vec_bool_popcount64 (w)
+#define CRANK_VEC_BOOL_CTZ64(w)       crank_vec_bool_popcount64 (~(w) & ((w) - 1))
+#endif
+
+static void     crank_vec_bool_packed_alloc   (CrankVecBoolPacked   *vec,
+                                               const guint           n);
+
+static void     crank_vec_bool_packed_mask_tail (CrankVecBoolPacked *vec);
+
+static void     crank_vec_bool_packed_binop   (CrankVecBoolPackedOp  op,
+                                               CrankVecBoolPacked   *a,
+                                               CrankVecBoolPacked   *b,
+                                               CrankVecBoolPacked   *r);
+
+static void     crank_vec_bool_packed_op_generic (CrankVecBoolPackedOp  op,
+                                                  const guint           nw,
+                                                  const guint64        *a,
+                                                  const guint64        *b,
+                                                  guint64              *r);
+
+static guint    crank_vec_bool_packed_count_generic (const guint     nw,
+                                                     const guint64  *data);
+
+static void     crank_vec_bool_packed_pack_generic (const guint      n,
+                                                    const gboolean  *arr,
+                                                    guint64         *data);
+
+static void     crank_vec_bool_packed_unpack_generic (const guint     n,
+                                                      const guint64  *data,
+                                                      gboolean       *arr);
+
+#ifdef CRANK_CPU_X86
+static void     crank_vec_bool_packed_op_avx2 (CrankVecBoolPackedOp  op,
+                                               const guint           nw,
+                                               const guint64        *a,
+                                               const guint64        *b,
+                                               guint64              *r);
+
+static guint    crank_vec_bool_packed_count_popcnt (const guint     nw,
+                                                    const guint64  *data);
+
+static void     crank_vec_bool_packed_pack_avx2 (const guint      n,
+                                                 const gboolean  *arr,
+                                                 guint64         *data);
+
+static void     crank_vec_bool_packed_unpack_avx2 (const guint     n,
+                                                   const guint64  *data,
+                                                   gboolean       *arr);
+#endif
+
+
+//////// Initialization and finalization ////////
+
+/**
+ * crank_vec_bool_packed_init_fill:
+ * @vec: (out): Vector to initialize.
+ * @n: Size of vector.
+ * @fill: Value to fill.
+ *
+ * Fill elements by @fill value.
+ * Unset with crank_vec_bool_packed_fini() after use.
+ */
+void
+crank_vec_bool_packed_init_fill (CrankVecBoolPacked *vec,
+                                 const guint         n,
+                                 const gboolean      fill)
+{
+  crank_vec_bool_packed_alloc (vec, n);
+  memset (vec->data, fill ? 0xFF : 0,
+          sizeof (guint64) * CRANK_VEC_BOOL_PACKED_WORDS (n));
+
+  crank_vec_bool_packed_mask_tail (vec);
+}
+
+/**
+ * crank_vec_bool_packed_init_arr:
+ * @vec: (out): Vector to initialize.
+ * @n: Size of vector.
+ * @arr: (array length=n): Array of elements.
+ *
+ * Initialize a vector by packing elements of array.
+ * Unset with crank_vec_bool_packed_fini() after use.
+ */
+void
+crank_vec_bool_packed_init_arr (CrankVecBoolPacked *vec,
+                                const guint         n,
+                                const gboolean     *arr)
+{
+  crank_vec_bool_packed_alloc (vec, n);
+
+#ifdef CRANK_CPU_X86
+  if (CRANK_CPU_SIMD_AVX2 <= _crank_cpu_get_simd_level ())
+    {
+      crank_vec_bool_packed_pack_avx2 (n, arr, vec->data);
+      return;
+    }
+#endif
+
+  crank_vec_bool_packed_pack_generic (n, arr, vec->data);
+}
+
+/**
+ * crank_vec_bool_packed_init_from_vb:
+ * @vec: (out): Vector to initialize.
+ * @vb: A Vector.
+ *
+ * Initialize a vector by packing elements of #CrankVecBoolN.
+ * Unset with crank_vec_bool_packed_fini() after use.
+ */
+void
+crank_vec_bool_packed_init_from_vb (CrankVecBoolPacked *vec,
+                                    CrankVecBoolN      *vb)
+{
+  crank_vec_bool_packed_init_arr (vec, vb->n, vb->data);
+}
+
+/**
+ * crank_vec_bool_packed_fini:
+ * @vec: A vector to unset.
+ *
+ * Frees associated resources and unset @vec.
+ */
+void
+crank_vec_bool_packed_fini (CrankVecBoolPacked *vec)
+{
+  g_free (vec->data);
+  vec->data = NULL;
+  vec->n = 0;
+}
+
+/**
+ * crank_vec_bool_packed_copy:
+ * @vec: Vector to copy
+ * @other: (out): Other vector to paste.
+ *
+ * Copies a vector.
+ */
+void
+crank_vec_bool_packed_copy (CrankVecBoolPacked *vec,
+                            CrankVecBoolPacked *other)
+{
+  crank_vec_bool_packed_alloc (other, vec->n);
+  memcpy (other->data, vec->data,
+          sizeof (guint64) * CRANK_VEC_BOOL_PACKED_WORDS (vec->n));
+}
+
+/**
+ * crank_vec_bool_packed_dup:
+ * @vec: Vector to copy
+ *
+ * Copies a vector. Free with crank_vec_bool_packed_free() after use.
+ *
+ * Returns: (transfer full): Copied vector.
+ */
+CrankVecBoolPacked*
+crank_vec_bool_packed_dup (CrankVecBoolPacked *vec)
+{
+  CrankVecBoolPacked *result = g_new0 (CrankVecBoolPacked, 1);
+
+  crank_vec_bool_packed_copy (vec, result);
+  return result;
+}
+
+/**
+ * crank_vec_bool_packed_free:
+ * @vec: A vector to free.
+ *
+ * Frees associated resources and frees @vec.
+ */
+void
+crank_vec_bool_packed_free (CrankVecBoolPacked *vec)
+{
+  crank_vec_bool_packed_fini (vec);
+  g_free (vec);
+}
+
+
+//////// Conversion ////////
+
+/**
+ * crank_vec_bool_packed_to_arr:
+ * @vec: A Vector.
+ * @arr: (out caller-allocates) (array): Array to store elements, which has
+ *     at least @vec->n elements.
+ *
+ * Unpacks elements into an array of #gboolean.
+ */
+void
+crank_vec_bool_packed_to_arr (CrankVecBoolPacked *vec,
+                              gboolean           *arr)
+{
+#ifdef CRANK_CPU_X86
+  if (CRANK_CPU_SIMD_AVX2 <= _crank_cpu_get_simd_level ())
+    {
+      crank_vec_bool_packed_unpack_avx2 (vec->n, vec->data, arr);
+      return;
+    }
+#endif
+
+  crank_vec_bool_packed_unpack_generic (vec->n, vec->data, arr);
+}
+
+/**
+ * crank_vec_bool_packed_to_vb:
+ * @vec: A Vector.
+ * @r: (out): A Vector to store elements.
+ *
+ * Unpacks elements into #CrankVecBoolN.
+ */
+void
+crank_vec_bool_packed_to_vb (CrankVecBoolPacked *vec,
+                             CrankVecBoolN      *r)
+{
+  CRANK_VEC_ALLOC (r, gboolean, vec->n);
+  crank_vec_bool_packed_to_arr (vec, r->data);
+}
+
+
+//////// Basic Operations ////////
+
+/**
+ * crank_vec_bool_packed_equal:
+ * @a: (type CrankVecBoolPacked): A vector.
+ * @b: (type CrankVecBoolPacked): A vector.
+ *
+ * Checks whether two vectors are equal.
+ *
+ * Returns: Whether two vectors are equal.
+ */
+gboolean
+crank_vec_bool_packed_equal (gconstpointer a,
+                             gconstpointer b)
+{
+  const CrankVecBoolPacked *veca = a;
+  const CrankVecBoolPacked *vecb = b;
+
+  if (veca->n != vecb->n)
+    return FALSE;
+
+  return memcmp (veca->data, vecb->data,
+                 sizeof (guint64) * CRANK_VEC_BOOL_PACKED_WORDS (veca->n)) == 0;
+}
+
+
+//////// Basic Properties ////////
+
+/**
+ * crank_vec_bool_packed_get_any:
+ * @vec: A Vector.
+ *
+ * Checks whether any of elements is %TRUE.
+ *
+ * Returns: Whether any of elements is %TRUE.
+ */
+gboolean
+crank_vec_bool_packed_get_any (CrankVecBoolPacked *vec)
+{
+  guint nw = CRANK_VEC_BOOL_PACKED_WORDS (vec->n);
+  guint i;
+
+  for (i = 0; i < nw; i++)
+    if (vec->data[i] != 0)
+      return TRUE;
+
+  return FALSE;
+}
+
+/**
+ * crank_vec_bool_packed_get_all:
+ * @vec: A Vector.
+ *
+ * Checks whether all of elements are %TRUE.
+ *
+ * Returns: Whether all of elements are %TRUE.
+ */
+gboolean
+crank_vec_bool_packed_get_all (CrankVecBoolPacked *vec)
+{
+  guint nw = vec->n / 64;
+  guint rem = vec->n % 64;
+  guint i;
+
+  for (i = 0; i < nw; i++)
+    if (vec->data[i] != G_MAXUINT64)
+      return FALSE;
+
+  if (rem != 0)
+    return vec->data[nw] == ((G_GUINT64_CONSTANT (1) << rem) - 1);
+
+  return TRUE;
+}
+
+/**
+ * crank_vec_bool_packed_get_count:
+ * @vec: A Vector.
+ *
+ * Counts %TRUE elements in this vector, by population count of words.
+ *
+ * Returns: Count of %TRUE.
+ */
+guint
+crank_vec_bool_packed_get_count (CrankVecBoolPacked *vec)
+{
+  guint nw = CRANK_VEC_BOOL_PACKED_WORDS (vec->n);
+
+#ifdef CRANK_CPU_X86
+  if (CRANK_CPU_SIMD_AVX2 <= _crank_cpu_get_simd_level ())
+    return crank_vec_bool_packed_count_popcnt (nw, vec->data);
+#endif
+
+  return crank_vec_bool_packed_count_generic (nw, vec->data);
+}
+
+
+//////// Functions as collection ////////
+
+/**
+ * crank_vec_bool_packed_get_size:
+ * @vec: A Vector.
+ *
+ * Gets size of vector.
+ *
+ * Returns: Size of vector.
+ */
+guint
+crank_vec_bool_packed_get_size (CrankVecBoolPacked *vec)
+{
+  return vec->n;
+}
+
+/**
+ * crank_vec_bool_packed_get:
+ * @vec: A Vector.
+ * @index: An index.
+ *
+ * Gets element of vector.
+ *
+ * Returns: Element at @index.
+ */
+gboolean
+crank_vec_bool_packed_get (CrankVecBoolPacked *vec,
+                           const guint         index)
+{
+  g_return_val_if_fail (index < vec->n, FALSE);
+
+  return (vec->data[index / 64] >> (index % 64)) & 1;
+}
+
+/**
+ * crank_vec_bool_packed_set:
+ * @vec: A Vector.
+ * @index: An index.
+ * @value: A value.
+ *
+ * Sets element of vector.
+ */
+void
+crank_vec_bool_packed_set (CrankVecBoolPacked *vec,
+                           const guint         index,
+                           const gboolean      value)
+{
+  guint64 bit;
+
+  g_return_if_fail (index < vec->n);
+
+  bit = G_GUINT64_CONSTANT (1) << (index % 64);
+
+  if (value)
+    vec->data[index / 64] |= bit;
+  else
+    vec->data[index / 64] &= ~bit;
+}
+
+
+//////// Set bits ////////
+
+/**
+ * crank_vec_bool_packed_find_first:
+ * @vec: A Vector.
+ *
+ * Finds first %TRUE element.
+ *
+ * Returns: Index of first %TRUE element, or -1 if there is none.
+ */
+gint
+crank_vec_bool_packed_find_first (CrankVecBoolPacked *vec)
+{
+  return crank_vec_bool_packed_find_next (vec, 0);
+}
+
+/**
+ * crank_vec_bool_packed_find_next:
+ * @vec: A Vector.
+ * @index: An index to start search.
+ *
+ * Finds first %TRUE element at or after @index. This can be used to iterate
+ * over %TRUE elements, as words of %FALSE are skipped at once.
+ *
+ * |[
+ *   gint i;
+ *
+ *   for (i = crank_vec_bool_packed_find_first (vec);
+ *        0 <= i;
+ *        i = crank_vec_bool_packed_find_next (vec, i + 1))
+ *     process (i);
+ * ]|
+ *
+ * Returns: Index of found element, or -1 if there is none.
+ */
+gint
+crank_vec_bool_packed_find_next (CrankVecBoolPacked *vec,
+                                 const guint         index)
+{
+  guint nw = CRANK_VEC_BOOL_PACKED_WORDS (vec->n);
+  guint i;
+  guint64 word;
+
+  if (vec->n <= index)
+    return -1;
+
+  i = index / 64;
+  word = vec->data[i] & (G_MAXUINT64 << (index % 64));
+
+  while (word == 0)
+    {
+      i++;
+      if (i == nw)
+        return -1;
+
+      word = vec->data[i];
+    }
+
+  return (gint)((i * 64) + CRANK_VEC_BOOL_CTZ64 (word));
+}
+
+/**
+ * crank_vec_bool_packed_get_indices:
+ * @vec: A Vector.
+ * @indices: (out caller-allocates) (array): Array to store indices, which has
+ *     at least crank_vec_bool_packed_get_count() elements.
+ *
+ * Gets indices of all %TRUE elements, in ascending order.
+ *
+ * Returns: Count of %TRUE elements, which is stored in @indices.
+ */
+guint
+crank_vec_bool_packed_get_indices (CrankVecBoolPacked *vec,
+                                   guint              *indices)
+{
+  guint nw = CRANK_VEC_BOOL_PACKED_WORDS (vec->n);
+  guint count = 0;
+  guint i;
+
+  for (i = 0; i < nw; i++)
+    {
+      guint64 word = vec->data[i];
+
+      while (word != 0)
+        {
+          indices[count++] = (i * 64) + CRANK_VEC_BOOL_CTZ64 (word);
+          word &= word - 1;
+        }
+    }
+
+  return count;
+}
+
+
+//////// Vector - Vector Operations ////////
+
+/**
+ * crank_vec_bool_packed_and:
+ * @a: A vector.
+ * @b: A vector.
+ * @r: (out): A vector to store result.
+ *
+ * Gets Component AND of @a and @b.
+ */
+void
+crank_vec_bool_packed_and (CrankVecBoolPacked *a,
+                           CrankVecBoolPacked *b,
+                           CrankVecBoolPacked *r)
+{
+  g_return_if_fail (a != r);
+  g_return_if_fail (b != r);
+
+  crank_vec_bool_packed_alloc (r, a->n);
+  crank_vec_bool_packed_binop (CRANK_VEC_BOOL_PACKED_OP_AND, a, b, r);
+}
+
+/**
+ * crank_vec_bool_packed_and_self:
+ * @a: A vector.
+ * @b: A vector.
+ *
+ * Apply Component AND to @a.
+ */
+void
+crank_vec_bool_packed_and_self (CrankVecBoolPacked *a,
+                                CrankVecBoolPacked *b)
+{
+  crank_vec_bool_packed_binop (CRANK_VEC_BOOL_PACKED_OP_AND, a, b, a);
+}
+
+/**
+ * crank_vec_bool_packed_or:
+ * @a: A vector.
+ * @b: A vector.
+ * @r: (out): A vector to store result.
+ *
+ * Gets Component OR of @a and @b.
+ */
+void
+crank_vec_bool_packed_or (CrankVecBoolPacked *a,
+                          CrankVecBoolPacked *b,
+                          CrankVecBoolPacked *r)
+{
+  g_return_if_fail (a != r);
+  g_return_if_fail (b != r);
+
+  crank_vec_bool_packed_alloc (r, a->n);
+  crank_vec_bool_packed_binop (CRANK_VEC_BOOL_PACKED_OP_OR, a, b, r);
+}
+
+/**
+ * crank_vec_bool_packed_or_self:
+ * @a: A vector.
+ * @b: A vector.
+ *
+ * Apply Component OR to @a.
+ */
+void
+crank_vec_bool_packed_or_self (CrankVecBoolPacked *a,
+                               CrankVecBoolPacked *b)
+{
+  crank_vec_bool_packed_binop (CRANK_VEC_BOOL_PACKED_OP_OR, a, b, a);
+}
+
+/**
+ * crank_vec_bool_packed_xor:
+ * @a: A vector.
+ * @b: A vector.
+ * @r: (out): A vector to store result.
+ *
+ * Gets Component XOR of @a and @b.
+ */
+void
+crank_vec_bool_packed_xor (CrankVecBoolPacked *a,
+                           CrankVecBoolPacked *b,
+                           CrankVecBoolPacked *r)
+{
+  g_return_if_fail (a != r);
+  g_return_if_fail (b != r);
+
+  crank_vec_bool_packed_alloc (r, a->n);
+  crank_vec_bool_packed_binop (CRANK_VEC_BOOL_PACKED_OP_XOR, a, b, r);
+}
+
+/**
+ * crank_vec_bool_packed_xor_self:
+ * @a: A vector.
+ * @b: A vector.
+ *
+ * Apply Component XOR to @a.
+ */
+void
+crank_vec_bool_packed_xor_self (CrankVecBoolPacked *a,
+                                CrankVecBoolPacked *b)
+{
+  crank_vec_bool_packed_binop (CRANK_VEC_BOOL_PACKED_OP_XOR, a, b, a);
+}
+
+/**
+ * crank_vec_bool_packed_andnot:
+ * @a: A vector.
+ * @b: A vector.
+ * @r: (out): A vector to store result.
+ *
+ * Gets Component AND of @a and NOT of @b. This removes elements of @b from
+ * @a, when they are used as masks.
+ */
+void
+crank_vec_bool_packed_andnot (CrankVecBoolPacked *a,
+                              CrankVecBoolPacked *b,
+                              CrankVecBoolPacked *r)
+{
+  g_return_if_fail (a != r);
+  g_return_if_fail (b != r);
+
+  crank_vec_bool_packed_alloc (r, a->n);
+  crank_vec_bool_packed_binop (CRANK_VEC_BOOL_PACKED_OP_ANDNOT, a, b, r);
+}
+
+/**
+ * crank_vec_bool_packed_andnot_self:
+ * @a: A vector.
+ * @b: A vector.
+ *
+ * Apply Component AND with NOT of @b to @a.
+ */
+void
+crank_vec_bool_packed_andnot_self (CrankVecBoolPacked *a,
+                                   CrankVecBoolPacked *b)
+{
+  crank_vec_bool_packed_binop (CRANK_VEC_BOOL_PACKED_OP_ANDNOT, a, b, a);
+}
+
+/**
+ * crank_vec_bool_packed_not:
+ * @a: A vector.
+ * @r: (out): A vector to store result.
+ *
+ * Gets Component NOT of @a.
+ */
+void
+crank_vec_bool_packed_not (CrankVecBoolPacked *a,
+                           CrankVecBoolPacked *r)
+{
+  g_return_if_fail (a != r);
+
+  crank_vec_bool_packed_alloc (r, a->n);
+  crank_vec_bool_packed_op_generic (CRANK_VEC_BOOL_PACKED_OP_ANDNOT,
+                                    CRANK_VEC_BOOL_PACKED_WORDS (a->n),
+                                    NULL, a->data, r->data);
+  crank_vec_bool_packed_mask_tail (r);
+}
+
+/**
+ * crank_vec_bool_packed_not_self:
+ * @a: A vector.
+ *
+ * Apply Component NOT to @a.
+ */
+void
+crank_vec_bool_packed_not_self (CrankVecBoolPacked *a)
+{
+  crank_vec_bool_packed_op_generic (CRANK_VEC_BOOL_PACKED_OP_ANDNOT,
+                                    CRANK_VEC_BOOL_PACKED_WORDS (a->n),
+                                    NULL, a->data, a->data);
+  crank_vec_bool_packed_mask_tail (a);
+}
+
+
+//////// Private Functions ////////
+
+static void
+crank_vec_bool_packed_alloc (CrankVecBoolPacked *vec,
+                             const guint         n)
+{
+  vec->data = g_new (guint64, CRANK_VEC_BOOL_PACKED_WORDS (n));
+  vec->n = n;
+}
+
+// Clears unused bits of last word.
+static void
+crank_vec_bool_packed_mask_tail (CrankVecBoolPacked *vec)
+{
+  guint rem = vec->n % 64;
+
+  if (rem != 0)
+    vec->data[vec->n / 64] &= (G_GUINT64_CONSTANT (1) << rem) - 1;
+}
+
+static void
+crank_vec_bool_packed_binop (CrankVecBoolPackedOp  op,
+                             CrankVecBoolPacked   *a,
+                             CrankVecBoolPacked   *b,
+                             CrankVecBoolPacked   *r)
+{
+  guint nw;
+
+  CRANK_VEC_WARN_IF_SIZE_MISMATCH2 ("VecBoolPacked", "binop", a, b);
+
+  nw = CRANK_VEC_BOOL_PACKED_WORDS (a->n);
+
+#ifdef CRANK_CPU_X86
+  if (CRANK_CPU_SIMD_AVX2 <= _crank_cpu_get_simd_level ())
+    {
+      crank_vec_bool_packed_op_avx2 (op, nw, a->data, b->data, r->data);
+      return;
+    }
+#endif
+
+  crank_vec_bool_packed_op_generic (op, nw, a->data, b->data, r->data);
+}
+
+/*
+ * For ANDNOT, a may be NULL, which is treated as all bits set. So NOT is
+ * performed as ANDNOT on NULL.
+ */
+static void
+crank_vec_bool_packed_op_generic (CrankVecBoolPackedOp  op,
+                                  const guint           nw,
+                                  const guint64        *a,
+                                  const guint64        *b,
+                                  guint64              *r)
+{
+  guint i;
+
+  switch (op)
+    {
+    case CRANK_VEC_BOOL_PACKED_OP_AND:
+      for (i = 0; i < nw; i++)
+        r[i] = a[i] & b[i];
+      break;
+
+    case CRANK_VEC_BOOL_PACKED_OP_OR:
+      for (i = 0; i < nw; i++)
+        r[i] = a[i] | b[i];
+      break;
+
+    case CRANK_VEC_BOOL_PACKED_OP_XOR:
+      for (i = 0; i < nw; i++)
+        r[i] = a[i] ^ b[i];
+      break;
+
+    case CRANK_VEC_BOOL_PACKED_OP_ANDNOT:
+      if (a == NULL)
+        {
+          for (i = 0; i < nw; i++)
+            r[i] = ~b[i];
+        }
+      else
+        {
+          for (i = 0; i < nw; i++)
+            r[i] = a[i] & ~b[i];
+        }
+      break;
+    }
+}
+
+static guint
+crank_vec_bool_packed_count_generic (const guint     nw,
+                                     const guint64  *data)
+{
+  guint count = 0;
+  guint i;
+
+  for (i = 0; i < nw; i++)
+    count += CRANK_VEC_BOOL_POPCOUNT64 (data[i]);
+
+  return count;
+}
+
+static void
+crank_vec_bool_packed_pack_generic (const guint      n,
+                                    const gboolean  *arr,
+                                    guint64         *data)
+{
+  guint nw = CRANK_VEC_BOOL_PACKED_WORDS (n);
+  guint i;
+  guint j;
+
+  for (i = 0; i < nw; i++)
+    {
+      const gboolean *arri = arr + (i * 64);
+      guint e = MIN (64, n - (i * 64));
+      guint64 word = 0;
+
+      for (j = 0; j < e; j++)
+        word |= (guint64)(arri[j] != FALSE) << j;
+
+      data[i] = word;
+    }
+}
+
+static void
+crank_vec_bool_packed_unpack_generic (const guint     n,
+                                      const guint64  *data,
+                                      gboolean       *arr)
+{
+  guint i;
+
+  for (i = 0; i < n; i++)
+    arr[i] = (data[i / 64] >> (i % 64)) & 1;
+}
+
+#ifdef CRANK_CPU_X86
+
+// Processes 4 words at once.
+__attribute__((target ("avx2")))
+static void
+crank_vec_bool_packed_op_avx2 (CrankVecBoolPackedOp  op,
+                               const guint           nw,
+                               const guint64        *a,
+                               const guint64        *b,
+                               guint64              *r)
+{
+  guint i = 0;
+
+#define LOAD(p)     _mm256_loadu_si256 ((const __m256i*)((p) + i))
+#define STORE(p,v)  _mm256_storeu_si256 ((__m256i*)((p) + i), (v))
+
+  switch (op)
+    {
+    case CRANK_VEC_BOOL_PACKED_OP_AND:
+      for (; i + 4 <= nw; i += 4)
+        STORE (r, _mm256_and_si256 (LOAD (a), LOAD (b)));
+      break;
+
+    case CRANK_VEC_BOOL_PACKED_OP_OR:
+      for (; i + 4 <= nw; i += 4)
+        STORE (r, _mm256_or_si256 (LOAD (a), LOAD (b)));
+      break;
+
+    case CRANK_VEC_BOOL_PACKED_OP_XOR:
+      for (; i + 4 <= nw; i += 4)
+        STORE (r, _mm256_xor_si256 (LOAD (a), LOAD (b)));
+      break;
+
+    case CRANK_VEC_BOOL_PACKED_OP_ANDNOT:
+      for (; i + 4 <= nw; i += 4)
+        STORE (r, _mm256_andnot_si256 (LOAD (b), LOAD (a)));
+      break;
+    }
+
+#undef LOAD
+#undef STORE
+
+  _mm256_zeroupper ();
+  crank_vec_bool_packed_op_generic (op, nw - i, a + i, b + i, r + i);
+}
+
+// Every CPUs with AVX2 have POPCNT. Counts are summed in 4 accumulators, so
+// that instructions are not waiting for previous ones.
+__attribute__((target ("popcnt")))
+static guint
+crank_vec_bool_packed_count_popcnt (const guint     nw,
+                                    const guint64  *data)
+{
+  guint64 c0 = 0;
+  guint64 c1 = 0;
+  guint64 c2 = 0;
+  guint64 c3 = 0;
+  guint i;
+
+  for (i = 0; i + 4 <= nw; i += 4)
+    {
+      c0 += __builtin_popcountll (data[i]);
+      c1 += __builtin_popcountll (data[i + 1]);
+      c2 += __builtin_popcountll (data[i + 2]);
+      c3 += __builtin_popcountll (data[i + 3]);
+    }
+
+  for (; i < nw; i++)
+    c0 += __builtin_popcountll (data[i]);
+
+  return (guint)(c0 + c1 + c2 + c3);
+}
+
+// Compares 8 elements to FALSE at once, and gathers results by movemask.
+__attribute__((target ("avx2")))
+static void
+crank_vec_bool_packed_pack_avx2 (const guint      n,
+                                 const gboolean  *arr,
+                                 guint64         *data)
+{
+  __m256i zero = _mm256_setzero_si256 ();
+  guint i;
+  guint j;
+
+  for (i = 0; (i + 1) * 64 <= n; i++)
+    {
+      const gboolean *arri = arr + (i * 64);
+      guint64 word = 0;
+
+      for (j = 0; j < 64; j += 8)
+        {
+          __m256i v = _mm256_loadu_si256 ((const __m256i*)(arri + j));
+          __m256 f = _mm256_castsi256_ps (_mm256_cmpeq_epi32 (v, zero));
+          guint m = (~_mm256_movemask_ps (f)) & 0xFF;
+
+          word |= (guint64) m << j;
+        }
+
+      data[i] = word;
+    }
+
+  _mm256_zeroupper ();
+  crank_vec_bool_packed_pack_generic (n - (i * 64), arr + (i * 64), data + i);
+}
+
+// Broadcasts 8 bits to 8 lanes, and tests a bit in each lane.
+__attribute__((target ("avx2")))
+static void
+crank_vec_bool_packed_unpack_avx2 (const guint     n,
+                                   const guint64  *data,
+                                   gboolean       *arr)
+{
+  __m256i bits = _mm256_setr_epi32 (1, 2, 4, 8, 16, 32, 64, 128);
+  __m256i one = _mm256_set1_epi32 (1);
+  guint i;
+  guint j;
+
+  for (i = 0; (i + 1) * 64 <= n; i++)
+    {
+      gboolean *arri = arr + (i * 64);
+      guint64 word = data[i];
+
+      for (j = 0; j < 64; j += 8)
+        {
+          __m256i v = _mm256_set1_epi32 ((gint)((word >> j) & 0xFF));
+          __m256i m = _mm256_cmpeq_epi32 (_mm256_and_si256 (v, bits), bits);
+
+          _mm256_storeu_si256 ((__m256i*)(arri + j), _mm256_and_si256 (m, one));
+        }
+    }
+
+  _mm256_zeroupper ();
+  crank_vec_bool_packed_unpack_generic (n - (i * 64), data + i, arr + (i * 64));
+}
+
+#endif
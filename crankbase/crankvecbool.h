@@ -568,6 +568,140 @@ void           crank_vec_bool_n_orv        (CrankVecBoolN *a,
 void           crank_vec_bool_n_notv       (CrankVecBoolN *a,
                                             CrankVecBoolN *r);
 
+
+
+
+/**
+ * CrankVecBoolPacked:
+ * @data: (array): Words of packed elements.
+ * @n: Size of vector.
+ *
+ * Arbitarily sized boolean vector, which packs 64 elements into a word.
+ * Element i is bit (i % 64) of word (i / 64). Unused bits of last word are
+ * always 0.
+ */
+struct _CrankVecBoolPacked {
+  guint64 *data;
+  guint n;
+};
+
+/**
+ * CRANK_VEC_BOOL_PACKED_WORDS:
+ * @n: Size of vector.
+ *
+ * Gets number of words to hold @n elements.
+ */
+#define CRANK_VEC_BOOL_PACKED_WORDS(n)  (((n) + 63) / 64)
+
+#define CRANK_TYPE_VEC_BOOL_PACKED   (crank_vec_bool_packed_get_type ())
+GType          crank_vec_bool_packed_get_type  (void);
+
+
+//////// Initialization and finalization ///////////////////////////////////////
+
+void           crank_vec_bool_packed_init_fill (CrankVecBoolPacked *vec,
+                                                const guint         n,
+                                                const gboolean      fill);
+
+void           crank_vec_bool_packed_init_arr  (CrankVecBoolPacked *vec,
+                                                const guint         n,
+                                                const gboolean     *arr);
+
+void           crank_vec_bool_packed_init_from_vb (CrankVecBoolPacked *vec,
+                                                   CrankVecBoolN      *vb);
+
+void           crank_vec_bool_packed_fini      (CrankVecBoolPacked *vec);
+
+void           crank_vec_bool_packed_copy      (CrankVecBoolPacked *vec,
+                                                CrankVecBoolPacked *other);
+
+CrankVecBoolPacked *crank_vec_bool_packed_dup  (CrankVecBoolPacked *vec);
+
+void           crank_vec_bool_packed_free      (CrankVecBoolPacked *vec);
+
+
+//////// Conversion ////////////////////////////////////////////////////////////
+
+void           crank_vec_bool_packed_to_arr    (CrankVecBoolPacked *vec,
+                                                gboolean           *arr);
+
+void           crank_vec_bool_packed_to_vb     (CrankVecBoolPacked *vec,
+                                                CrankVecBoolN      *r);
+
+
+//////// Basic Operations //////////////////////////////////////////////////////
+
+gboolean       crank_vec_bool_packed_equal     (gconstpointer a,
+                                                gconstpointer b);
+
+
+//////// Basic Properties //////////////////////////////////////////////////////
+
+gboolean       crank_vec_bool_packed_get_any   (CrankVecBoolPacked *vec);
+
+gboolean       crank_vec_bool_packed_get_all   (CrankVecBoolPacked *vec);
+
+guint          crank_vec_bool_packed_get_count (CrankVecBoolPacked *vec);
+
+
+//////// Functions as collection ///////////////////////////////////////////////
+
+guint          crank_vec_bool_packed_get_size  (CrankVecBoolPacked *vec);
+
+gboolean       crank_vec_bool_packed_get       (CrankVecBoolPacked *vec,
+                                                const guint         index);
+
+void           crank_vec_bool_packed_set       (CrankVecBoolPacked *vec,
+                                                const guint         index,
+                                                const gboolean      value);
+
+
+//////// Set bits //////////////////////////////////////////////////////////////
+
+gint           crank_vec_bool_packed_find_first (CrankVecBoolPacked *vec);
+
+gint           crank_vec_bool_packed_find_next (CrankVecBoolPacked *vec,
+                                                const guint         index);
+
+guint          crank_vec_bool_packed_get_indices (CrankVecBoolPacked *vec,
+                                                  guint              *indices);
+
+
+//////// Vector - Vector Operations ////////////////////////////////////////////
+
+void           crank_vec_bool_packed_and       (CrankVecBoolPacked *a,
+                                                CrankVecBoolPacked *b,
+                                                CrankVecBoolPacked *r);
+
+void           crank_vec_bool_packed_and_self  (CrankVecBoolPacked *a,
+                                                CrankVecBoolPacked *b);
+
+void           crank_vec_bool_packed_or        (CrankVecBoolPacked *a,
+                                                CrankVecBoolPacked *b,
+                                                CrankVecBoolPacked *r);
+
+void           crank_vec_bool_packed_or_self   (CrankVecBoolPacked *a,
+                                                CrankVecBoolPacked *b);
+
+void           crank_vec_bool_packed_xor       (CrankVecBoolPacked *a,
+                                                CrankVecBoolPacked *b,
+                                                CrankVecBoolPacked *r);
+
+void           crank_vec_bool_packed_xor_self  (CrankVecBoolPacked *a,
+                                                CrankVecBoolPacked *b);
+
+void           crank_vec_bool_packed_andnot    (CrankVecBoolPacked *a,
+                                                CrankVecBoolPacked *b,
+                                                CrankVecBoolPacked *r);
+
+void           crank_vec_bool_packed_andnot_self (CrankVecBoolPacked *a,
+                                                  CrankVecBoolPacked *b);
+
+void           crank_vec_bool_packed_not       (CrankVecBoolPacked *a,
+                                                CrankVecBoolPacked *r);
+
+void           crank_vec_bool_packed_not_self  (CrankVecBoolPacked *a);
+
 G_END_DECLS
 
 #endif //CRANKBOOLVEC_H
\ No newline at end of file
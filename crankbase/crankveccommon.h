@@ -30,6 +30,7 @@ typedef struct _CrankVecBool2 CrankVecBool2;
 typedef struct _CrankVecBool3 CrankVecBool3;
 typedef struct _CrankVecBool4 CrankVecBool4;
 typedef struct _CrankVecBoolN CrankVecBoolN;
+typedef struct _CrankVecBoolPacked CrankVecBoolPacked;
 
 typedef struct _CrankVecUint2 CrankVecUint2;
 typedef struct _CrankVecUint3 CrankVecUint3;
@@ -46,6 +47,11 @@ typedef struct _CrankVecFloat3 CrankVecFloat3;
 typedef struct _CrankVecFloat4 CrankVecFloat4;
 typedef struct _CrankVecFloatN CrankVecFloatN;
 
+typedef struct _CrankVecDouble2 CrankVecDouble2;
+typedef struct _CrankVecDouble3 CrankVecDouble3;
+typedef struct _CrankVecDouble4 CrankVecDouble4;
+typedef struct _CrankVecDoubleN CrankVecDoubleN;
+
 typedef struct _CrankVecCplxFloatN CrankVecCplxFloatN;
 
 typedef struct _CrankMatFloat2 CrankMatFloat2;
@@ -53,6 +59,11 @@ typedef struct _CrankMatFloat3 CrankMatFloat3;
 typedef struct _CrankMatFloat4 CrankMatFloat4;
 typedef struct _CrankMatFloatN CrankMatFloatN;
 
+typedef struct _CrankMatDouble2 CrankMatDouble2;
+typedef struct _CrankMatDouble3 CrankMatDouble3;
+typedef struct _CrankMatDouble4 CrankMatDouble4;
+typedef struct _CrankMatDoubleN CrankMatDoubleN;
+
 typedef struct _CrankMatCplxFloatN CrankMatCplxFloatN;
 
 /**
@@ -215,4 +226,31 @@ typedef struct _CrankMatCplxFloatN CrankMatCplxFloatN;
       }                                                                   \
   } G_STMT_END
 
+
+//////// Comparison ////////////////////////////////////////////////////////////
+
+/**
+ * CrankVecCmpOp:
+ * @CRANK_VEC_CMP_LESS: a < b
+ * @CRANK_VEC_CMP_LESS_EQ: a <= b
+ * @CRANK_VEC_CMP_EQ: a == b
+ * @CRANK_VEC_CMP_NOT_EQ: a != b
+ * @CRANK_VEC_CMP_GREATER_EQ: a >= b
+ * @CRANK_VEC_CMP_GREATER: a > b
+ *
+ * Comparison of each components, for fused compare operations like
+ * crank_vec_float_n_cmpblend() or crank_vec_float_n_cmpcount().
+ *
+ * For floating point, comparisons with NaN is %FALSE except
+ * %CRANK_VEC_CMP_NOT_EQ, as in C.
+ */
+typedef enum _CrankVecCmpOp {
+  CRANK_VEC_CMP_LESS,
+  CRANK_VEC_CMP_LESS_EQ,
+  CRANK_VEC_CMP_EQ,
+  CRANK_VEC_CMP_NOT_EQ,
+  CRANK_VEC_CMP_GREATER_EQ,
+  CRANK_VEC_CMP_GREATER
+} CrankVecCmpOp;
+
 #endif
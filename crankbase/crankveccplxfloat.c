@@ -37,6 +37,8 @@
 #include "crankmatfloat.h"
 #include "crankmatcplxfloat.h"
 
+#include "crankcpu-private.h"
+
 /**
  * SECTION:crankveccplxfloat
  * @title: Complex Float Vectors
@@ -1007,7 +1009,7 @@ crank_vec_cplx_float_n_get_real (CrankVecCplxFloatN *vec,
 {
   guint i;
 
-  CRANK_VEC_ALLOC (real, gfloat, vec->n);
+  CRANK_VEC_ALLOC_ALIGNED (real, gfloat, vec->n);
   for (i = 0; i < vec->n; i++)
     real->data[i] = vec->data[i].real;
 }
@@ -1025,7 +1027,7 @@ crank_vec_cplx_float_n_get_imag (CrankVecCplxFloatN *vec,
 {
   guint i;
 
-  CRANK_VEC_ALLOC (imag, gfloat, vec->n);
+  CRANK_VEC_ALLOC_ALIGNED (imag, gfloat, vec->n);
   for (i = 0; i < vec->n; i++)
     imag->data[i] = vec->data[i].imag;
 }
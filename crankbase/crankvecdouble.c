@@ -0,0 +1,2280 @@
+/* Copyright (C) 2015, WSID   */
+
+/* Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#define _CRANKBASE_INSIDE
+
+#include <math.h>
+#include <stdarg.h>
+#include <string.h>
+
+#include <glib.h>
+#include <glib-object.h>
+
+#include "crankbasemacro.h"
+#include "crankfunction.h"
+#include "crankiter.h"
+#include "crankveccommon.h"
+#include "crankvecbool.h"
+#include "crankvecint.h"
+#include "crankvecfloat.h"
+#include "crankvecdouble.h"
+#include "crankmatdouble.h"
+
+#include "crankcpu-private.h"
+#include "crankvecsimd-private.h"
+
+#ifdef CRANK_CPU_X86
+#include <immintrin.h>
+#endif
+
+/**
+ * SECTION: crankvecdouble
+ * @title: Double Vectors
+ * @short_description: Vectors that have double precision elements.
+ * @stability: Unstable
+ * @include: crankbase.h
+ *
+ * Crank System provides 2, 3, 4, and free sized double vectors, for where
+ * precision of float vectors is not enough.
+ *
+ * Currently following operations are supported.
+ *
+ * It is compared to dvec in GLSL
+ *
+ * # Type Conversion.
+ *
+ * Double vector types can be converted from other types.
+ *
+ * For fixed-sized types, it can be converted to variadic sized vector types.
+ *
+ * <table><title>Type Conversion of #CrankVecDouble2</title>
+ *   <tgroup cols="3" align="left">
+ *     <thead> <row> <entry>Type</entry>
+ *                   <entry>Related Functions</entry>
+ *                   <entry>Remarks</entry> </row> </thead>
+ *     <tbody>
+ *       <row> <entry>From #CrankVecBool2 </entry>
+ *             <entry>crank_vec_double2_init_from_vb() </entry>
+ *             <entry>GValue Transform </entry> </row>
+ *
+ *       <row> <entry>From #CrankVecInt2 </entry>
+ *             <entry>crank_vec_double2_init_from_vi() </entry>
+ *             <entry>GValue Transform </entry> </row>
+ *
+ *       <row> <entry>From #CrankVecFloat2 </entry>
+ *             <entry>crank_vec_double2_init_from_vf() </entry>
+ *             <entry>GValue Transform </entry> </row>
+ *
+ *       <row> <entry morerows="1">To string.</entry>
+ *             <entry>crank_vec_double2_to_string()</entry>
+ *             <entry>GValue Transform</entry></row>
+ *       <row> <entry>crank_vec_double2_to_string_full()</entry> </row>
+ *
+ *       <row> <entry>To #CrankVecDoubleN.</entry>
+ *             <entry>crank_vec_double_n_init_arr()</entry>
+ *             <entry>GValue Transform,
+ *                    cast vector into array,
+ *                    Defined in #CrankVecDoubleN</entry> </row>
+ *     </tbody>
+ *   </tgroup>
+ * </table>
+ *
+ * <table><title>Type Conversion of #CrankVecDouble3</title>
+ *   <tgroup cols="3" align="left">
+ *     <thead> <row> <entry>Type</entry>
+ *                   <entry>Related Functions</entry>
+ *                   <entry>Remarks</entry> </row> </thead>
+ *     <tbody>
+ *       <row> <entry>From #CrankVecBool3 </entry>
+ *             <entry>crank_vec_double3_init_from_vb() </entry>
+ *             <entry>GValue Transform </entry> </row>
+ *
+ *       <row> <entry>From #CrankVecInt3 </entry>
+ *             <entry>crank_vec_double3_init_from_vi() </entry>
+ *             <entry>GValue Transform </entry> </row>
+ *
+ *       <row> <entry>From #CrankVecFloat3 </entry>
+ *             <entry>crank_vec_double3_init_from_vf() </entry>
+ *             <entry>GValue Transform </entry> </row>
+ *
+ *       <row> <entry morerows="1">To string.</entry>
+ *             <entry>crank_vec_double3_to_string()</entry>
+ *             <entry>GValue Transform</entry></row>
+ *       <row> <entry>crank_vec_double3_to_string_full()</entry> </row>
+ *
+ *       <row> <entry>To #CrankVecDoubleN.</entry>
+ *             <entry>crank_vec_double_n_init_arr()</entry>
+ *             <entry>GValue Transform,
+ *                    cast vector into array,
+ *                    Defined in #CrankVecDoubleN</entry> </row>
+ *     </tbody>
+ *   </tgroup>
+ * </table>
+ *
+ * <table><title>Type Conversion of #CrankVecDouble4</title>
+ *   <tgroup cols="3" align="left">
+ *     <thead> <row> <entry>Type</entry>
+ *                   <entry>Related Functions</entry>
+ *                   <entry>Remarks</entry> </row> </thead>
+ *     <tbody>
+ *       <row> <entry>From #CrankVecBool4 </entry>
+ *             <entry>crank_vec_double4_init_from_vb() </entry>
+ *             <entry>GValue Transform </entry> </row>
+ *
+ *       <row> <entry>From #CrankVecInt4 </entry>
+ *             <entry>crank_vec_double4_init_from_vi() </entry>
+ *             <entry>GValue Transform </entry> </row>
+ *
+ *       <row> <entry>From #CrankVecFloat4 </entry>
+ *             <entry>crank_vec_double4_init_from_vf() </entry>
+ *             <entry>GValue Transform </entry> </row>
+ *
+ *       <row> <entry morerows="1">To string.</entry>
+ *             <entry>crank_vec_double4_to_string()</entry>
+ *             <entry>GValue Transform</entry></row>
+ *       <row> <entry>crank_vec_double4_to_string_full()</entry> </row>
+ *
+ *       <row> <entry>To #CrankVecDoubleN.</entry>
+ *             <entry>crank_vec_double_n_init_arr()</entry>
+ *             <entry>GValue Transform,
+ *                    cast vector into array,
+ *                    Defined in #CrankVecDoubleN</entry> </row>
+ *     </tbody>
+ *   </tgroup>
+ * </table>
+ *
+ * <table><title>Type Conversion of #CrankVecDoubleN</title>
+ *   <tgroup cols="3" align="left">
+ *     <thead> <row> <entry>Type</entry>
+ *                   <entry>Related Functions</entry>
+ *                   <entry>Remarks</entry> </row> </thead>
+ *     <tbody>
+ *       <row> <entry>From #CrankVecBoolN </entry>
+ *             <entry>crank_vec_double_n_init_from_vb() </entry>
+ *             <entry>GValue Transform </entry> </row>
+ *
+ *       <row> <entry>From #CrankVecIntN </entry>
+ *             <entry>crank_vec_double_n_init_from_vi() </entry>
+ *             <entry>GValue Transform </entry> </row>
+ *
+ *       <row> <entry>From #CrankVecFloatN </entry>
+ *             <entry>crank_vec_double_n_init_from_vf() </entry>
+ *             <entry>GValue Transform </entry> </row>
+ *
+ *       <row> <entry>From #CrankVecDouble2</entry>
+ *             <entry>crank_vec_double_n_init_arr()</entry>
+ *             <entry>GValue Transform, Cast vector into array</entry> </row>
+ *
+ *       <row> <entry>From #CrankVecDouble3</entry>
+ *             <entry>crank_vec_double_n_init_arr()</entry>
+ *             <entry>GValue Transform, Cast vector into array</entry> </row>
+ *
+ *       <row> <entry>From #CrankVecDouble4</entry>
+ *             <entry>crank_vec_double_n_init_arr()</entry>
+ *             <entry>GValue Transform, Cast vector into array</entry> </row>
+ *
+ *       <row> <entry morerows="1">To string.</entry>
+ *             <entry>crank_vec_double_n_to_string()</entry>
+ *             <entry>GValue Transform</entry> </row>
+ *       <row> <entry>crank_vec_double_n_to_string_full()</entry> </row>
+ *     </tbody>
+ *   </tgroup>
+ * </table>
+ *
+ * # Batch Operations.
+ *
+ * Calling a function for each of thousands vectors takes much of time in
+ * function calls. Batch operations process arrays of #CrankVecDouble3 at once.
+ *
+ * * crank_vec_double3_batch_*() takes arrays of #CrankVecDouble3.
+ * * crank_vec_double3_soa_*() takes separated arrays of x, y, and z
+ *   components. This is faster, as no conversion is needed.
+ *
+ * Both of them process several vectors at once with SIMD instructions, when
+ * CPU supports them.
+ *
+ * # SIMD Operations of #CrankVecDoubleN.
+ *
+ * Element-wise operations of #CrankVecDoubleN, like addition, scalar
+ * multiplication, interpolation and dot product, use SSE2, AVX2 or AVX-512
+ * kernels, which is selected by CPU when they are first used. Selection can be
+ * limited by environment variable CRANK_SIMD, with one of "none", "sse2",
+ * "avx2" and "avx512".
+ *
+ * Data of vectors created by crank_vec_double_n_*() functions, and of vectors
+ * returned by other functions of Crank System, like multiplications or
+ * solvers of matrices, are aligned to 64 bytes. Data given by
+ * crank_vec_double_n_init_arr_take() is not, but kernels still work on it.
+ *
+ * These kernels are shared with #CrankVecFloatN, so a kernel processes half
+ * of elements at once, compared to float vectors.
+ */
+
+//////// Template Instance /////////////////////////////////////////////////////
+
+/* Functions are written once in crankvec-template-private.h, and instantiated
+ * for double here. Documentations of them follow. */
+
+#define CRANK_VEC_T                   gdouble
+#define CRANK_VEC_TYPE(n)             CrankVecDouble##n
+#define CRANK_VEC_FUNC(n, name)       crank_vec_double##n##_##name
+#define CRANK_VEC_SYM(n)              crank_vec_double##n
+#define CRANK_VEC_GTYPE(n)            CRANK_TYPE_VEC_DOUBLE##n
+#define CRANK_VEC_MAT_TYPE(n)         CrankMatDouble##n
+#define CRANK_VEC_NAME                "VecDoubleN"
+#define CRANK_VEC_S0                  CRANK_VEC_DOUBLE_S0
+#define CRANK_VEC_S1                  CRANK_VEC_DOUBLE_S1
+#define CRANK_VEC_HASH                g_double_hash
+#define CRANK_VEC_MATH(func)          func
+#define CRANK_VEC_BOOL_FUNC           CrankBoolDoubleFunc
+#define CRANK_VEC_ITER                CrankIterMemDouble
+#define CRANK_VEC_ITER_FUNC(name)     crank_iter_mem_double_##name
+#define CRANK_VEC_GET_KERNELS         _crank_vec_double_get_kernels
+#define CRANK_VEC_FROM_TYPE(n)        CrankVecFloat##n
+#define CRANK_VEC_FROM_GTYPE(n)       CRANK_TYPE_VEC_FLOAT##n
+#define CRANK_VEC_INTRIN(f)           f##_pd
+#define CRANK_VEC_M256                __m256d
+#define CRANK_VEC_W256                4
+
+#include "crankvec-template-private.h"
+
+
+//////// Documentations ////////////////////////////////////////////////////////
+
+/**
+ * crank_vec_double2_init:
+ * @vec: (out): Vector to initialize.
+ * @x: First vector element.
+ * @y: Second vector element.
+ *
+ * Initializes vector with given components.
+ */
+
+/**
+ * crank_vec_double2_init_arr:
+ * @vec: (out): Vector to initialize.
+ * @arr: (array fixed-size=2): Array that contains elements.
+ *
+ * Initializes vector with given array.
+ */
+
+/**
+ * crank_vec_double2_init_valist:
+ * @vec: (out): Vector to initialize.
+ * @varargs: va_list that contains elements.
+ *
+ * Initializes vector with given array.
+ */
+
+/**
+ * crank_vec_double2_init_fill:
+ * @vec: (out): Vector to initialize.
+ * @fill: element to fill @vec
+ *
+ * Initializes vector by filling single value.
+ */
+
+/**
+ * crank_vec_double2_init_from_vb:
+ * @vec: (out): Vector to initialize.
+ * @vb: Boolean vector.
+ *
+ * Initialize vector from boolean vector.
+ */
+
+/**
+ * crank_vec_double2_init_from_vi:
+ * @vec: (out): Vector to initialize.
+ * @vi: Integer vector.
+ *
+ * Initialize vector from integer vector.
+ */
+
+/**
+ * crank_vec_double2_init_from_vf:
+ * @vec: (out): Vector to initialize.
+ * @vf: Float vector.
+ *
+ * Initialize vector from float vector.
+ */
+
+/**
+ * crank_vec_double2_copy:
+ * @vec: Vector to copy.
+ * @other: (out): Other vector to paste.
+ *
+ * Copies vector.
+ */
+
+/**
+ * crank_vec_double2_dup:
+ * @vec: Vector to copy.
+ *
+ * Copies vector. The returned pointer should be freed by g_free().
+ *
+ * Returns: (transfer full): copied vector
+ */
+
+/**
+ * crank_vec_double2_get:
+ * @vec: Vector to get element.
+ * @index: index to get element at.
+ *
+ * Gets element of vector at @index.
+ *
+ * Returns: element on vector.
+ */
+
+/**
+ * crank_vec_double2_set:
+ * @vec: Vector to set element.
+ * @index: index to set element at.
+ * @value: value of element.
+ *
+ * Sets element of vector at @index, by @value.
+ */
+
+/**
+ * crank_vec_double2_foreach:
+ * @vec: Vector to iterate.
+ * @func: (scope call): Function to iterate over.
+ * @userdata: (closure): Userdata for @func.
+ *
+ * Iterates over a double vector.
+ *
+ * Return #TRUE to continue iteration, #FALSE to stop iteration.
+ *
+ * Returns: Whether iteration was stopped.
+ */
+
+/**
+ * crank_vec_double2_iterator:
+ * @vec: A Vector
+ * @iter: (out): A Iterator.
+ *
+ * Initialize a iterator for a vector.
+ */
+
+/**
+ * crank_vec_double2_hash:
+ * @a: (type CrankVecDouble2): Vector to get hash
+ *
+ * Gets hash value of vector. This can be used when using vectors as key for
+ * hashing structures like #GHashTable.
+ *
+ * Returns: hash value of vector.
+ */
+
+/**
+ * crank_vec_double2_equal:
+ * @a: (type CrankVecDouble2): Vector to compare.
+ * @b: (type CrankVecDouble2): Vector to compare.
+ *
+ * Compares two vector for equality.
+ *
+ * Returns: whether that the two vectors are same.
+ */
+
+/**
+ * crank_vec_double2_equal_delta:
+ * @a: (type CrankVecDouble2): Vector to compare.
+ * @b: (type CrankVecDouble2): Vector to compare.
+ * @d: Allowed difference to be considered equal.
+ *
+ * Compares two vector for equality.
+ *
+ * Returns: whether that the two vectors are same.
+ */
+
+/**
+ * crank_vec_double2_to_string:
+ * @vec: Vector to string.
+ *
+ * Constructs string from vector. The strings are in form of,
+ *
+ *    (3, 4)
+ *
+ * Returns: (transfer full): string representation of value.
+ */
+
+/**
+ * crank_vec_double2_to_string_full:
+ * @vec: Vector to string.
+ * @left: Left string, which indicates that vector's start.
+ * @in: Delimiter, which is inserted between elements.
+ * @right: Right string. which indicates that vector's end.
+ * @format: Format to use with elements.
+ *
+ * Construct string from vector, with given format.
+ *
+ * Returns: (transfer full): stringified items of value.
+ */
+
+/**
+ * crank_vec_double2_get_magn_sq:
+ * @vec: A Vector.
+ *
+ * Gets square of magn/norm of @vec.
+ *
+ * Returns: square of magn/norm of @vec.
+ */
+
+/**
+ * crank_vec_double2_get_magn:
+ * @vec: A Vector.
+ *
+ * Gets magn/norm of @vec.
+ *
+ * Returns: magn/norm of @vec.
+ */
+
+/**
+ * crank_vec_double2_neg:
+ * @a: A vector
+ * @r: (out): A vector to store result.
+ *
+ * Applies negation.
+ */
+
+/**
+ * crank_vec_double2_neg_self:
+ * @a: A vector
+ *
+ * Applies negation.
+ */
+
+/**
+ * crank_vec_double2_unit:
+ * @a: A vector
+ * @r: (out): A vector to store result.
+ *
+ * Gets unit length of vector with same direction of @a
+ */
+
+/**
+ * crank_vec_double2_unit_self:
+ * @a: A vector
+ *
+ * Gets unit length of vector with same direction of @a
+ */
+
+/**
+ * crank_vec_double2_muls:
+ * @a: A vector.
+ * @b: A scalar.
+ * @r: (out): A vector to store result.
+ *
+ * Applies scalar multiplication.
+ */
+
+/**
+ * crank_vec_double2_muls_self:
+ * @a: A vector.
+ * @b: A scalar.
+ *
+ * Applies scalar multiplication.
+ */
+
+/**
+ * crank_vec_double2_divs:
+ * @a: A vector.
+ * @b: A scalar.
+ * @r: (out): A vector to store result.
+ *
+ * Applies scalar division.
+ */
+
+/**
+ * crank_vec_double2_divs_self:
+ * @a: A vector.
+ * @b: A scalar.
+ *
+ * Applies scalar division.
+ */
+
+/**
+ * crank_vec_double2_add:
+ * @a: A vector.
+ * @b: A vector.
+ * @r: (out): A vector to store result.
+ *
+ * Adds two vectors.
+ */
+
+/**
+ * crank_vec_double2_add_self:
+ * @a: A vector.
+ * @b: A vector.
+ *
+ * Adds two vectors.
+ */
+
+/**
+ * crank_vec_double2_sub:
+ * @a: A vector.
+ * @b: A vector.
+ * @r: (out): A vector to store result.
+ *
+ * Subtracts @a by @b.
+ */
+
+/**
+ * crank_vec_double2_sub_self:
+ * @a: A vector.
+ * @b: A vector.
+ *
+ * Subtracts @a by @b.
+ */
+
+/**
+ * crank_vec_double2_dot:
+ * @a: A vector
+ * @b: A vector
+ *
+ * Gets dot product of two vectors.
+ *
+ * Returns: dot product of two vectors.
+ */
+
+/**
+ * crank_vec_double2_crs:
+ * @a: A vector
+ * @b: A vector
+ *
+ * Gets Z component of cross product of two vectors.
+ *
+ * Returns: Cross product of two vectors, as scalar.
+ */
+
+/**
+ * crank_vec_double2_cmpmul:
+ * @a: A vector.
+ * @b: A vector.
+ * @r: (out): A vector to store result.
+ *
+ * Gets component-wise multiplication.
+ */
+
+/**
+ * crank_vec_double2_cmpmul_self:
+ * @a: A vector.
+ * @b: A vector.
+ *
+ * Gets component-wise multiplication.
+ */
+
+/**
+ * crank_vec_double2_cmpdiv:
+ * @a: A vector.
+ * @b: A vector.
+ * @r: (out): A vector to store result.
+ *
+ * Gets component-wise division.
+ */
+
+/**
+ * crank_vec_double2_cmpdiv_self:
+ * @a: A vector.
+ * @b: A vector.
+ *
+ * Gets component-wise division.
+ */
+
+/**
+ * crank_vec_double2_cmpless:
+ * @a: A vector.
+ * @b: A vector.
+ * @r: (out): A vector to store result.
+ *
+ * Gets each component of @a is less than counterpart of @b
+ */
+
+/**
+ * crank_vec_double2_cmpeq:
+ * @a: A vector.
+ * @b: A vector.
+ * @r: (out): A vector to store result.
+ *
+ * Gets each component of @a equals to counterpart of @b
+ */
+
+/**
+ * crank_vec_double2_cmpgreater:
+ * @a: A vector.
+ * @b: A vector.
+ * @r: (out): A vector to store result.
+ *
+ * Gets each component of @a is greater than counterpart of @b
+ */
+
+/**
+ * crank_vec_double2_cmpcmp:
+ * @a: A vector.
+ * @b: A vector.
+ * @r: (out): A vector to store result.
+ *
+ * Gets compare result of each components.
+ */
+
+/**
+ * crank_vec_double2_min:
+ * @a: A vector.
+ * @b: A vector.
+ * @r: (out): A vector to store result.
+ *
+ * Gets smaller value of each components.
+ */
+
+/**
+ * crank_vec_double2_max:
+ * @a: A vector.
+ * @b: A vector.
+ * @r: (out): A vector to store result.
+ *
+ * Gets greater value of each components.
+ */
+
+/**
+ * crank_vec_double2_abs:
+ * @a: A Vector.
+ * @r: (out): A vector to store result.
+ *
+ * Gets absolute value of each components.
+ */
+
+/**
+ * crank_vec_double2_abs_self:
+ * @a: A Vector.
+ *
+ * Applys absolute value of each components.
+ */
+
+/**
+ * crank_vec_double2_mulm:
+ * @a: A Vector
+ * @b: A Matrix
+ * @r: (out): A Vector to store result.
+ *
+ * Multiplies transpose of vector by matrix. (Vector transpose * Matrix)
+ */
+
+/**
+ * crank_vec_double2_mulm_self:
+ * @a: A Vector
+ * @b: A Matrix
+ *
+ * Multiplies transpose of vector by matrix. (Vector transpose * Matrix)
+ */
+
+/**
+ * crank_vec_double2_mixs:
+ * @a: A vector.
+ * @b: A vector.
+ * @c: A scalar factor.
+ * @r: (out): A vector to store result.
+ *
+ * Gets linear interpolation of @a and @b by @c.
+ * So the result will be
+ *
+ *    (a * (1-c)) + (b * c)
+ */
+
+/**
+ * crank_vec_double2_mix:
+ * @a: A vector.
+ * @b: A vector.
+ * @c: A factor.
+ * @r: (out): A vector to store result.
+ *
+ * Gets linear interpolation of @a and @b by @c.
+ * So the result will be
+ *
+ *    (a cmpmul c) + (b cmpmul ({1, 1} - c))
+ */
+
+/**
+ * crank_vec_double3_init:
+ * @vec: (out): Vector to initialize.
+ * @x: First vector element.
+ * @y: Second vector element.
+ * @z: Third vector element.
+ *
+ * Initializes vector with given components.
+ */
+
+/**
+ * crank_vec_double3_init_arr:
+ * @vec: (out): Vector to initialize.
+ * @arr: (array fixed-size=3): Array that contains elements.
+ *
+ * Initializes vector with given array.
+ */
+
+/**
+ * crank_vec_double3_init_valist:
+ * @vec: (out): Vector to initialize.
+ * @varargs: va_list that contains elements.
+ *
+ * Initializes vector with given array.
+ */
+
+/**
+ * crank_vec_double3_init_fill:
+ * @vec: (out): Vector to initialize.
+ * @fill: element to fill @vec
+ *
+ * Initializes vector by filling single value.
+ */
+
+/**
+ * crank_vec_double3_init_from_vb:
+ * @vec: (out): Vector to initialize.
+ * @vb: Boolean vector.
+ *
+ * Initialize vector from boolean vector.
+ */
+
+/**
+ * crank_vec_double3_init_from_vi:
+ * @vec: (out): Vector to initialize.
+ * @vi: Integer vector.
+ *
+ * Initialize vector from integer vector.
+ */
+
+/**
+ * crank_vec_double3_init_from_vf:
+ * @vec: (out): Vector to initialize.
+ * @vf: Float vector.
+ *
+ * Initialize vector from float vector.
+ */
+
+/**
+ * crank_vec_double3_copy:
+ * @vec: Vector to copy.
+ * @other: (out): Other vector to paste.
+ *
+ * Copies vector.
+ */
+
+/**
+ * crank_vec_double3_dup:
+ * @vec: Vector to copy.
+ *
+ * Copies vector. The returned pointer should be freed by g_free().
+ *
+ * Returns: (transfer full): copied vector
+ */
+
+/**
+ * crank_vec_double3_get:
+ * @vec: Vector to get element.
+ * @index: index to get element at.
+ *
+ * Gets element of vector at @index.
+ *
+ * Returns: element on vector.
+ */
+
+/**
+ * crank_vec_double3_set:
+ * @vec: Vector to set element.
+ * @index: index to set element at.
+ * @value: value of element.
+ *
+ * Sets element of vector at @index, by @value.
+ */
+
+/**
+ * crank_vec_double3_foreach:
+ * @vec: Vector to iterate.
+ * @func: (scope call): Function to iterate over.
+ * @userdata: (closure): Userdata for @func.
+ *
+ * Iterates over a double vector.
+ *
+ * Return #TRUE to continue iteration, #FALSE to stop iteration.
+ *
+ * Returns: Whether iteration was stopped.
+ */
+
+/**
+ * crank_vec_double3_iterator:
+ * @vec: A Vector
+ * @iter: (out): A Iterator.
+ *
+ * Initialize a iterator for a vector.
+ */
+
+/**
+ * crank_vec_double3_hash:
+ * @a: (type CrankVecDouble3): Vector to get hash
+ *
+ * Gets hash value of vector. This can be used when using vectors as key for
+ * hashing structures like #GHashTable.
+ *
+ * Returns: hash value of vector.
+ */
+
+/**
+ * crank_vec_double3_equal:
+ * @a: (type CrankVecDouble3): Vector to compare.
+ * @b: (type CrankVecDouble3): Vector to compare.
+ *
+ * Compares two vector for equality.
+ *
+ * Returns: whether that the two vectors are same.
+ */
+
+/**
+ * crank_vec_double3_equal_delta:
+ * @a: (type CrankVecDouble3): Vector to compare.
+ * @b: (type CrankVecDouble3): Vector to compare.
+ * @d: Allowed difference to be considered equal.
+ *
+ * Compares two vector for equality.
+ *
+ * Returns: whether that the two vectors are same.
+ */
+
+/**
+ * crank_vec_double3_to_string:
+ * @vec: Vector to string.
+ *
+ * Constructs string from vector. The strings are in form of,
+ *
+ *    (3, 4)
+ *
+ * Returns: (transfer full): string representation of value.
+ */
+
+/**
+ * crank_vec_double3_to_string_full:
+ * @vec: Vector to string.
+ * @left: Left string, which indicates that vector's start.
+ * @in: Delimiter, which is inserted between elements.
+ * @right: Right string. which indicates that vector's end.
+ * @format: Format to use with elements.
+ *
+ * Construct string from vector, with given format.
+ *
+ * Returns: (transfer full): stringified items of value.
+ */
+
+/**
+ * crank_vec_double3_get_magn_sq:
+ * @vec: A Vector.
+ *
+ * Gets square of magn/norm of @vec.
+ *
+ * Returns: square of magn/norm of @vec.
+ */
+
+/**
+ * crank_vec_double3_get_magn:
+ * @vec: A Vector.
+ *
+ * Gets magn/norm of @vec.
+ *
+ * Returns: magn/norm of @vec.
+ */
+
+/**
+ * crank_vec_double3_neg:
+ * @a: A vector
+ * @r: (out): A vector to store result.
+ *
+ * Applies negation.
+ */
+
+/**
+ * crank_vec_double3_neg_self:
+ * @a: A vector
+ *
+ * Applies negation.
+ */
+
+/**
+ * crank_vec_double3_unit:
+ * @a: A vector
+ * @r: (out): A vector to store result.
+ *
+ * Gets unit length of vector with same direction of @a
+ */
+
+/**
+ * crank_vec_double3_unit_self:
+ * @a: A vector
+ *
+ * Gets unit length of vector with same direction of @a
+ */
+
+/**
+ * crank_vec_double3_muls:
+ * @a: A vector.
+ * @b: A scalar.
+ * @r: (out): A vector to store result.
+ *
+ * Applies scalar multiplication.
+ */
+
+/**
+ * crank_vec_double3_muls_self:
+ * @a: A vector.
+ * @b: A scalar.
+ *
+ * Applies scalar multiplication.
+ */
+
+/**
+ * crank_vec_double3_divs:
+ * @a: A vector.
+ * @b: A scalar.
+ * @r: (out): A vector to store result.
+ *
+ * Applies scalar division.
+ */
+
+/**
+ * crank_vec_double3_divs_self:
+ * @a: A vector.
+ * @b: A scalar.
+ *
+ * Applies scalar division.
+ */
+
+/**
+ * crank_vec_double3_add:
+ * @a: A vector.
+ * @b: A vector.
+ * @r: (out): A vector to store result.
+ *
+ * Adds two vectors.
+ */
+
+/**
+ * crank_vec_double3_add_self:
+ * @a: A vector.
+ * @b: A vector.
+ *
+ * Adds two vectors.
+ */
+
+/**
+ * crank_vec_double3_sub:
+ * @a: A vector.
+ * @b: A vector.
+ * @r: (out): A vector to store result.
+ *
+ * Subtracts @a by @b.
+ */
+
+/**
+ * crank_vec_double3_sub_self:
+ * @a: A vector.
+ * @b: A vector.
+ *
+ * Subtracts @a by @b.
+ */
+
+/**
+ * crank_vec_double3_dot:
+ * @a: A vector
+ * @b: A vector
+ *
+ * Gets dot product of two vectors.
+ *
+ * Returns: dot product of two vectors.
+ */
+
+/**
+ * crank_vec_double3_crs:
+ * @a: A vector.
+ * @b: A vector.
+ * @r: (out): A vector to store result.
+ *
+ * Get cross product of two vectors.
+ */
+
+/**
+ * crank_vec_double3_crs_self:
+ * @a: A vector.
+ * @b: A vector.
+ *
+ * Get cross product of two vectors.
+ */
+
+/**
+ * crank_vec_double3_cmpmul:
+ * @a: A vector.
+ * @b: A vector.
+ * @r: (out): A vector to store result.
+ *
+ * Gets component-wise multiplication.
+ */
+
+/**
+ * crank_vec_double3_cmpmul_self:
+ * @a: A vector.
+ * @b: A vector.
+ *
+ * Gets component-wise multiplication.
+ */
+
+/**
+ * crank_vec_double3_cmpdiv:
+ * @a: A vector.
+ * @b: A vector.
+ * @r: (out): A vector to store result.
+ *
+ * Gets component-wise division.
+ */
+
+/**
+ * crank_vec_double3_cmpdiv_self:
+ * @a: A vector.
+ * @b: A vector.
+ *
+ * Gets component-wise division.
+ */
+
+/**
+ * crank_vec_double3_cmpless:
+ * @a: A vector.
+ * @b: A vector.
+ * @r: (out): A vector to store result.
+ *
+ * Gets each component of @a is less than counterpart of @b
+ */
+
+/**
+ * crank_vec_double3_cmpeq:
+ * @a: A vector.
+ * @b: A vector.
+ * @r: (out): A vector to store result.
+ *
+ * Gets each component of @a equals to counterpart of @b
+ */
+
+/**
+ * crank_vec_double3_cmpgreater:
+ * @a: A vector.
+ * @b: A vector.
+ * @r: (out): A vector to store result.
+ *
+ * Gets each component of @a is greater than counterpart of @b
+ */
+
+/**
+ * crank_vec_double3_cmpcmp:
+ * @a: A vector.
+ * @b: A vector.
+ * @r: (out): A vector to store result.
+ *
+ * Gets compare result of each components.
+ */
+
+/**
+ * crank_vec_double3_min:
+ * @a: A vector.
+ * @b: A vector.
+ * @r: (out): A vector to store result.
+ *
+ * Gets smaller value of each components.
+ */
+
+/**
+ * crank_vec_double3_max:
+ * @a: A vector.
+ * @b: A vector.
+ * @r: (out): A vector to store result.
+ *
+ * Gets greater value of each components.
+ */
+
+/**
+ * crank_vec_double3_abs:
+ * @a: A Vector.
+ * @r: (out): A vector to store result.
+ *
+ * Gets absolute value of each components.
+ */
+
+/**
+ * crank_vec_double3_abs_self:
+ * @a: A Vector.
+ *
+ * Applys absolute value of each components.
+ */
+
+/**
+ * crank_vec_double3_mulm:
+ * @a: A Vector
+ * @b: A Matrix
+ * @r: (out): A Vector to store result.
+ *
+ * Multiplies transpose of vector by matrix. (Vector transpose * Matrix)
+ */
+
+/**
+ * crank_vec_double3_mulm_self:
+ * @a: A Vector
+ * @b: A Matrix
+ *
+ * Multiplies transpose of vector by matrix. (Vector transpose * Matrix)
+ */
+
+/**
+ * crank_vec_double3_mixs:
+ * @a: A vector.
+ * @b: A vector.
+ * @c: A scalar factor.
+ * @r: (out): A vector to store result.
+ *
+ * Gets linear interpolation of @a and @b by @c.
+ * So the result will be
+ *
+ *    (a * (1-c)) + (b * c)
+ */
+
+/**
+ * crank_vec_double3_mix:
+ * @a: A vector.
+ * @b: A vector.
+ * @c: A factor.
+ * @r: (out): A vector to store result.
+ *
+ * Gets linear interpolation of @a and @b by @c.
+ * So the result will be
+ *
+ *    (a cmpmul c) + (b cmpmul ({1, 1, 1} - c))
+ */
+
+/**
+ * crank_vec_double3_soa_dot:
+ * @n: Count of vectors.
+ * @ax: (array length=n): X components of first vectors.
+ * @ay: (array length=n): Y components of first vectors.
+ * @az: (array length=n): Z components of first vectors.
+ * @bx: (array length=n): X components of second vectors.
+ * @by: (array length=n): Y components of second vectors.
+ * @bz: (array length=n): Z components of second vectors.
+ * @r: (out caller-allocates) (array length=n): Array to store dot products.
+ *
+ * Gets dot products of @n pairs of vectors, which are stored as separated
+ * streams of components. Several vectors are processed at once, if CPU
+ * supports.
+ */
+
+/**
+ * crank_vec_double3_soa_crs:
+ * @n: Count of vectors.
+ * @ax: (array length=n): X components of first vectors.
+ * @ay: (array length=n): Y components of first vectors.
+ * @az: (array length=n): Z components of first vectors.
+ * @bx: (array length=n): X components of second vectors.
+ * @by: (array length=n): Y components of second vectors.
+ * @bz: (array length=n): Z components of second vectors.
+ * @rx: (out caller-allocates) (array length=n): X components of results.
+ * @ry: (out caller-allocates) (array length=n): Y components of results.
+ * @rz: (out caller-allocates) (array length=n): Z components of results.
+ *
+ * Gets cross products of @n pairs of vectors, which are stored as separated
+ * streams of components. Result streams may be same with input streams.
+ */
+
+/**
+ * crank_vec_double3_soa_unit:
+ * @n: Count of vectors.
+ * @ax: (array length=n): X components of vectors.
+ * @ay: (array length=n): Y components of vectors.
+ * @az: (array length=n): Z components of vectors.
+ * @rx: (out caller-allocates) (array length=n): X components of results.
+ * @ry: (out caller-allocates) (array length=n): Y components of results.
+ * @rz: (out caller-allocates) (array length=n): Z components of results.
+ *
+ * Normalizes @n vectors, which are stored as separated streams of components.
+ * Result streams may be same with input streams.
+ */
+
+/**
+ * crank_vec_double3_batch_dot:
+ * @n: Count of vectors.
+ * @a: (array length=n): First vectors.
+ * @b: (array length=n): Second vectors.
+ * @r: (out caller-allocates) (array length=n): Array to store dot products.
+ *
+ * Gets dot products of @n pairs of vectors.
+ *
+ * Vectors are split into streams of components by chunk, and processed by
+ * crank_vec_double3_soa_dot().
+ */
+
+/**
+ * crank_vec_double3_batch_crs:
+ * @n: Count of vectors.
+ * @a: (array length=n): First vectors.
+ * @b: (array length=n): Second vectors.
+ * @r: (out caller-allocates) (array length=n): Array to store cross products.
+ *
+ * Gets cross products of @n pairs of vectors. @r may be same with @a or @b.
+ */
+
+/**
+ * crank_vec_double3_batch_unit:
+ * @n: Count of vectors.
+ * @a: (array length=n): Vectors.
+ * @r: (out caller-allocates) (array length=n): Array to store unit vectors.
+ *
+ * Normalizes @n vectors. @r may be same with @a.
+ */
+
+/**
+ * crank_vec_double4_init:
+ * @vec: (out): Vector to initialize.
+ * @x: First vector element.
+ * @y: Second vector element.
+ * @z: Third vector element.
+ * @w: Fourth vector element.
+ *
+ * Initializes vector with given components.
+ */
+
+/**
+ * crank_vec_double4_init_arr:
+ * @vec: (out): Vector to initialize.
+ * @arr: (array fixed-size=3): Array that contains elements.
+ *
+ * Initializes vector with given array.
+ */
+
+/**
+ * crank_vec_double4_init_valist:
+ * @vec: (out): Vector to initialize.
+ * @varargs: va_list that contains elements.
+ *
+ * Initializes vector with given array.
+ */
+
+/**
+ * crank_vec_double4_init_fill:
+ * @vec: (out): Vector to initialize.
+ * @fill: element to fill @vec
+ *
+ * Initializes vector by filling single value.
+ */
+
+/**
+ * crank_vec_double4_init_from_vb:
+ * @vec: (out): Vector to initialize.
+ * @vb: Boolean vector.
+ *
+ * Initialize vector from boolean vector.
+ */
+
+/**
+ * crank_vec_double4_init_from_vi:
+ * @vec: (out): Vector to initialize.
+ * @vi: Integer vector.
+ *
+ * Initialize vector from integer vector.
+ */
+
+/**
+ * crank_vec_double4_init_from_vf:
+ * @vec: (out): Vector to initialize.
+ * @vf: Float vector.
+ *
+ * Initialize vector from float vector.
+ */
+
+/**
+ * crank_vec_double4_copy:
+ * @vec: Vector to copy.
+ * @other: (out): Other vector to paste.
+ *
+ * Copies vector.
+ */
+
+/**
+ * crank_vec_double4_dup:
+ * @vec: Vector to copy.
+ *
+ * Copies vector. The returned pointer should be freed by g_free().
+ *
+ * Returns: (transfer full): copied vector
+ */
+
+/**
+ * crank_vec_double4_get:
+ * @vec: Vector to get element.
+ * @index: index to get element at.
+ *
+ * Gets element of vector at @index.
+ *
+ * Returns: element on vector.
+ */
+
+/**
+ * crank_vec_double4_set:
+ * @vec: Vector to set element.
+ * @index: index to set element at.
+ * @value: value of element.
+ *
+ * Sets element of vector at @index, by @value.
+ */
+
+/**
+ * crank_vec_double4_foreach:
+ * @vec: Vector to iterate.
+ * @func: (scope call): Function to iterate over.
+ * @userdata: (closure): Userdata for @func.
+ *
+ * Iterates over a double vector.
+ *
+ * Return #TRUE to continue iteration, #FALSE to stop iteration.
+ *
+ * Returns: Whether iteration was stopped.
+ */
+
+/**
+ * crank_vec_double4_iterator:
+ * @vec: A Vector
+ * @iter: (out): A Iterator.
+ *
+ * Initialize a iterator for a vector.
+ */
+
+/**
+ * crank_vec_double4_hash:
+ * @a: (type CrankVecDouble4): Vector to get hash
+ *
+ * Gets hash value of vector. This can be used when using vectors as key for
+ * hashing structures like #GHashTable.
+ *
+ * Returns: hash value of vector.
+ */
+
+/**
+ * crank_vec_double4_equal:
+ * @a: (type CrankVecDouble4): Vector to compare.
+ * @b: (type CrankVecDouble4): Vector to compare.
+ *
+ * Compares two vector for equality.
+ *
+ * Returns: whether that the two vectors are same.
+ */
+
+/**
+ * crank_vec_double4_equal_delta:
+ * @a: (type CrankVecDouble4): Vector to compare.
+ * @b: (type CrankVecDouble4): Vector to compare.
+ * @d: Allowed difference to be considered equal.
+ *
+ * Compares two vector for equality.
+ *
+ * Returns: whether that the two vectors are same.
+ */
+
+/**
+ * crank_vec_double4_to_string:
+ * @vec: Vector to string.
+ *
+ * Constructs string from vector. The strings are in form of,
+ *
+ *    (3, 4)
+ *
+ * Returns: (transfer full): string representation of value.
+ */
+
+/**
+ * crank_vec_double4_to_string_full:
+ * @vec: Vector to string.
+ * @left: Left string, which indicates that vector's start.
+ * @in: Delimiter, which is inserted between elements.
+ * @right: Right string. which indicates that vector's end.
+ * @format: Format to use with elements.
+ *
+ * Construct string from vector, with given format.
+ *
+ * Returns: (transfer full): stringified items of value.
+ */
+
+/**
+ * crank_vec_double4_get_magn_sq:
+ * @vec: A Vector.
+ *
+ * Gets square of magn/norm of @vec.
+ *
+ * Returns: square of magn/norm of @vec.
+ */
+
+/**
+ * crank_vec_double4_get_magn:
+ * @vec: A Vector.
+ *
+ * Gets magn/norm of @vec.
+ *
+ * Returns: magn/norm of @vec.
+ */
+
+/**
+ * crank_vec_double4_neg:
+ * @a: A vector
+ * @r: (out): A vector to store result.
+ *
+ * Applies negation.
+ */
+
+/**
+ * crank_vec_double4_neg_self:
+ * @a: A vector
+ *
+ * Applies negation.
+ */
+
+/**
+ * crank_vec_double4_unit:
+ * @a: A vector
+ * @r: (out): A vector to store result.
+ *
+ * Gets unit length of vector with same direction of @a
+ */
+
+/**
+ * crank_vec_double4_unit_self:
+ * @a: A vector
+ *
+ * Gets unit length of vector with same direction of @a
+ */
+
+/**
+ * crank_vec_double4_muls:
+ * @a: A vector.
+ * @b: A scalar.
+ * @r: (out): A vector to store result.
+ *
+ * Applies scalar multiplication.
+ */
+
+/**
+ * crank_vec_double4_muls_self:
+ * @a: A vector.
+ * @b: A scalar.
+ *
+ * Applies scalar multiplication.
+ */
+
+/**
+ * crank_vec_double4_divs:
+ * @a: A vector.
+ * @b: A scalar.
+ * @r: (out): A vector to store result.
+ *
+ * Applies scalar division.
+ */
+
+/**
+ * crank_vec_double4_divs_self:
+ * @a: A vector.
+ * @b: A scalar.
+ *
+ * Applies scalar division.
+ */
+
+/**
+ * crank_vec_double4_add:
+ * @a: A vector.
+ * @b: A vector.
+ * @r: (out): A vector to store result.
+ *
+ * Adds two vectors.
+ */
+
+/**
+ * crank_vec_double4_add_self:
+ * @a: A vector.
+ * @b: A vector.
+ *
+ * Adds two vectors.
+ */
+
+/**
+ * crank_vec_double4_sub:
+ * @a: A vector.
+ * @b: A vector.
+ * @r: (out): A vector to store result.
+ *
+ * Subtracts @a by @b.
+ */
+
+/**
+ * crank_vec_double4_sub_self:
+ * @a: A vector.
+ * @b: A vector.
+ *
+ * Subtracts @a by @b.
+ */
+
+/**
+ * crank_vec_double4_dot:
+ * @a: A vector
+ * @b: A vector
+ *
+ * Gets dot product of two vectors.
+ *
+ * Returns: dot product of two vectors.
+ */
+
+/**
+ * crank_vec_double4_cmpmul:
+ * @a: A vector.
+ * @b: A vector.
+ * @r: (out): A vector to store result.
+ *
+ * Gets component-wise multiplication.
+ */
+
+/**
+ * crank_vec_double4_cmpmul_self:
+ * @a: A vector.
+ * @b: A vector.
+ *
+ * Gets component-wise multiplication.
+ */
+
+/**
+ * crank_vec_double4_cmpdiv:
+ * @a: A vector.
+ * @b: A vector.
+ * @r: (out): A vector to store result.
+ *
+ * Gets component-wise division.
+ */
+
+/**
+ * crank_vec_double4_cmpdiv_self:
+ * @a: A vector.
+ * @b: A vector.
+ *
+ * Gets component-wise division.
+ */
+
+/**
+ * crank_vec_double4_cmpless:
+ * @a: A vector.
+ * @b: A vector.
+ * @r: (out): A vector to store result.
+ *
+ * Gets each component of @a is less than counterpart of @b
+ */
+
+/**
+ * crank_vec_double4_cmpeq:
+ * @a: A vector.
+ * @b: A vector.
+ * @r: (out): A vector to store result.
+ *
+ * Gets each component of @a equals to counterpart of @b
+ */
+
+/**
+ * crank_vec_double4_cmpgreater:
+ * @a: A vector.
+ * @b: A vector.
+ * @r: (out): A vector to store result.
+ *
+ * Gets each component of @a is greater than counterpart of @b
+ */
+
+/**
+ * crank_vec_double4_cmpcmp:
+ * @a: A vector.
+ * @b: A vector.
+ * @r: (out): A vector to store result.
+ *
+ * Gets compare result of each components.
+ */
+
+/**
+ * crank_vec_double4_min:
+ * @a: A vector.
+ * @b: A vector.
+ * @r: (out): A vector to store result.
+ *
+ * Gets smaller value of each components.
+ */
+
+/**
+ * crank_vec_double4_max:
+ * @a: A vector.
+ * @b: A vector.
+ * @r: (out): A vector to store result.
+ *
+ * Gets greater value of each components.
+ */
+
+/**
+ * crank_vec_double4_abs:
+ * @a: A Vector.
+ * @r: (out): A vector to store result.
+ *
+ * Gets absolute value of each components.
+ */
+
+/**
+ * crank_vec_double4_abs_self:
+ * @a: A Vector.
+ *
+ * Applys absolute value of each components.
+ */
+
+/**
+ * crank_vec_double4_mulm:
+ * @a: A Vector
+ * @b: A Matrix
+ * @r: (out): A Vector to store result.
+ *
+ * Multiplies transpose of vector by matrix. (Vector transpose * Matrix)
+ */
+
+/**
+ * crank_vec_double4_mulm_self:
+ * @a: A Vector
+ * @b: A Matrix
+ *
+ * Multiplies transpose of vector by matrix. (Vector transpose * Matrix)
+ */
+
+/**
+ * crank_vec_double4_mixs:
+ * @a: A vector.
+ * @b: A vector.
+ * @c: A scalar factor.
+ * @r: (out): A vector to store result.
+ *
+ * Gets linear interpolation of @a and @b by @c.
+ * So the result will be
+ *
+ *    (a * (1-c)) + (b * c)
+ */
+
+/**
+ * crank_vec_double4_mix:
+ * @a: A vector.
+ * @b: A vector.
+ * @c: A factor.
+ * @r: (out): A vector to store result.
+ *
+ * Gets linear interpolation of @a and @b by @c.
+ * So the result will be
+ *
+ *    (a cmpmul c) + (b cmpmul ({1, 1, 1, 1} - c))
+ */
+
+/**
+ * crank_vec_double_n_init:
+ * @vec: (out): Vector to initialize.
+ * @n: size of vector.
+ * @...: element of vector.
+ *
+ * Initializes vector with given components.
+ */
+
+/**
+ * crank_vec_double_n_init_arr:
+ * @vec: (out): Vector to initialize.
+ * @n: Size of vector.
+ * @arr: (array length=n): Array that contains elements.
+ *
+ * Initializes vector with given array.
+ */
+
+/**
+ * crank_vec_double_n_init_arr_take:
+ * @vec: (out): Vector to initialize.
+ * @n: Size of vector.
+ * @arr: (transfer full): Array that contains elements.
+ *
+ * Initializes vector by taking array as data.
+ */
+
+/**
+ * crank_vec_double_n_init_arena:
+ * @vec: (out): Vector to initialize.
+ * @arena: An arena.
+ * @n: Size of vector.
+ *
+ * Initializes vector filled with 0, with data from @arena.
+ *
+ * Data is owned by @arena, so @vec should not be passed to
+ * crank_vec_double_n_fini(), or to functions that reallocate its data.
+ */
+
+/**
+ * crank_vec_double_n_init_arr_arena:
+ * @vec: (out): Vector to initialize.
+ * @arena: An arena.
+ * @n: Size of vector.
+ * @arr: (array length=n): Array that contains elements.
+ *
+ * Initializes vector with given array, with data from @arena.
+ *
+ * Data is owned by @arena, so @vec should not be passed to
+ * crank_vec_double_n_fini(), or to functions that reallocate its data.
+ */
+
+/**
+ * crank_vec_double_n_init_valist:
+ * @vec: (out): Vector to initialize.
+ * @n: Size of vector.
+ * @varargs: va_list that contains elements.
+ *
+ * Initializes vector with given array.
+ */
+
+/**
+ * crank_vec_double_n_init_fill:
+ * @vec: (out): Vector to initialize.
+ * @n: Size of vector.
+ * @fill: element to fill @vec
+ *
+ * Initializes vector by filling single value.
+ */
+
+/**
+ * crank_vec_double_n_init_from_vb:
+ * @vec: (out): Vector to initialize.
+ * @vb: Boolean vector.
+ *
+ * Initialize vector from boolean vector.
+ */
+
+/**
+ * crank_vec_double_n_init_from_vi:
+ * @vec: (out): Vector to initialize.
+ * @vi: Integer vector.
+ *
+ * Initialize vector from integer vector.
+ */
+
+/**
+ * crank_vec_double_n_init_from_vf:
+ * @vec: (out): Vector to initialize.
+ * @vf: Float vector.
+ *
+ * Initialize vector from float vector.
+ */
+
+/**
+ * crank_vec_double_n_fini:
+ * @vec: Vector to finalize.
+ *
+ * Frees all allocated memory and unsets @vec to point 0-sized vector at %NULL.
+ */
+
+/**
+ * crank_vec_double_n_copy:
+ * @vec: Vector to copy.
+ * @other: (out): Other vector to paste.
+ *
+ * Copies vector.
+ */
+
+/**
+ * crank_vec_double_n_dup:
+ * @vec: Vector to copy.
+ *
+ * Copies vector. The returned pointer should be freed by g_free().
+ *
+ * Returns: (transfer full): copied vector
+ */
+
+/**
+ * crank_vec_double_n_free:
+ * @vec: Vector to free.
+ *
+ * Frees all allocated memory and frees struct too.
+ */
+
+/**
+ * crank_vec_double_n_get_size:
+ * @vec: A Vector.
+ *
+ * Gets size of a vector.
+ *
+ * Returns: Size of vector.
+ */
+
+/**
+ * crank_vec_double_n_get:
+ * @vec: Vector to get element.
+ * @index: index to get element at.
+ *
+ * Gets element of vector at @index.
+ *
+ * Returns: element on vector.
+ */
+
+/**
+ * crank_vec_double_n_set:
+ * @vec: Vector to set element.
+ * @index: index to set element at.
+ * @value: value of element.
+ *
+ * Sets element of vector at @index, by @value.
+ */
+
+/**
+ * crank_vec_double_n_prepend:
+ * @vec: Vector to insert element.
+ * @value: Value of element.
+ *
+ * Prepends an element to vector.
+ */
+
+/**
+ * crank_vec_double_n_append:
+ * @vec: Vector to insert element.
+ * @value: Value of element.
+ *
+ * Appends an element to vector.
+ */
+
+/**
+ * crank_vec_double_n_insert:
+ * @vec: Vector to insert element.
+ * @index: Index to insert element.
+ * @value: Value of element.
+ *
+ * Inserts an element to vector.
+ */
+
+/**
+ * crank_vec_double_n_remove:
+ * @vec: Vector to remove element.
+ * @index: Index to remove element.
+ *
+ * Removes an element from vector.
+ */
+
+/**
+ * crank_vec_double_n_foreach:
+ * @vec: Vector to iterate.
+ * @func: (scope call): Function to iterate over.
+ * @userdata: (closure): Userdata for @func.
+ *
+ * Iterates over a double vector.
+ *
+ * Return #TRUE to continue iteration, #FALSE to stop iteration.
+ *
+ * Returns: Whether iteration was stopped.
+ */
+
+/**
+ * crank_vec_double_n_iterator:
+ * @vec: A Vector
+ * @iter: (out): A Iterator.
+ *
+ * Initialize a iterator for a vector.
+ */
+
+/**
+ * crank_vec_double_n_hash:
+ * @a: (type CrankVecDoubleN): Vector to get hash
+ *
+ * Gets hash value of vector. This can be used when using vectors as key for
+ * hashing structures like #GHashTable.
+ *
+ * Returns: hash value of vector.
+ */
+
+/**
+ * crank_vec_double_n_equal:
+ * @a: (type CrankVecDoubleN): Vector to compare.
+ * @b: (type CrankVecDoubleN): Vector to compare.
+ *
+ * Compares two vector for equality.
+ *
+ * Returns: whether that the two vectors are same.
+ */
+
+/**
+ * crank_vec_double_n_equal_delta:
+ * @a: (type CrankVecDoubleN): Vector to compare.
+ * @b: (type CrankVecDoubleN): Vector to compare.
+ * @d: Allowed difference to be considered equal.
+ *
+ * Compares two vector for equality.
+ *
+ * Returns: whether that the two vectors are same.
+ */
+
+/**
+ * crank_vec_double_n_to_string:
+ * @vec: Vector to string.
+ *
+ * Constructs string from vector. The strings are in form of,
+ *
+ *    (3, 4)
+ *
+ * Returns: (transfer full): string representation of value.
+ */
+
+/**
+ * crank_vec_double_n_to_string_full:
+ * @vec: Vector to string.
+ * @left: Left string, which indicates that vector's start.
+ * @in: Delimiter, which is inserted between elements.
+ * @right: Right string. which indicates that vector's end.
+ * @format: Format to use with elements.
+ *
+ * Construct string from vector, with given format.
+ *
+ * Returns: (transfer full): stringified items of value.
+ */
+
+/**
+ * crank_vec_double_n_is_zero:
+ * @vec: A Vector
+ *
+ * Checks whether the vector is "Zero Vector", whose all components are 0.
+ *
+ * Returns: Whether the vector is "zero vector".
+ */
+
+/**
+ * crank_vec_double_n_is_one:
+ * @vec: A Vector
+ *
+ * Checks whether the vector has all components as 1.
+ *
+ * Returns: Whether the vector has all components as 1.
+ */
+
+/**
+ * crank_vec_double_n_is_unit:
+ * @vec: A Vector
+ *
+ * Checks whether the magnitude of vector is 1.
+ *
+ * Returns: Whether the magnitude of vector is 1.
+ */
+
+/**
+ * crank_vec_double_n_is_empty:
+ * @vec: A Vector
+ *
+ * Checks whether the vector is empty.
+ *
+ * Returns: Whether the vector is empty.
+ */
+
+/**
+ * crank_vec_double_n_has_nan:
+ * @vec: A Vector
+ *
+ * Chechks whether the vector has NaN.
+ *
+ * Returns: Whether the vector has NaN.
+ */
+
+/**
+ * crank_vec_double_n_has_inf:
+ * @vec: A Vector
+ *
+ * Chechks whether the vector has infinity.
+ *
+ * Returns: Whether the vector has (inf).
+ */
+
+/**
+ * crank_vec_double_n_get_magn_sq:
+ * @vec: A Vector.
+ *
+ * Gets square of magn/norm of @vec.
+ *
+ * Returns: square of magn/norm of @vec.
+ */
+
+/**
+ * crank_vec_double_n_get_magn:
+ * @vec: A Vector.
+ *
+ * Gets magn/norm of @vec.
+ *
+ * Returns: magn/norm of @vec.
+ */
+
+/**
+ * crank_vec_double_n_neg:
+ * @a: A vector
+ * @r: (out): A vector to store result.
+ *
+ * Applies negation.
+ */
+
+/**
+ * crank_vec_double_n_neg_self:
+ * @a: A vector
+ *
+ * Applies negation.
+ */
+
+/**
+ * crank_vec_double_n_unit:
+ * @a: A vector
+ * @r: (out): A vector to store result.
+ *
+ * Gets unit length of vector with same direction of @a
+ */
+
+/**
+ * crank_vec_double_n_unit_self:
+ * @a: A vector
+ *
+ * Gets unit length of vector with same direction of @a
+ */
+
+/**
+ * crank_vec_double_n_muls:
+ * @a: A vector.
+ * @b: A scalar.
+ * @r: (out): A vector to store result.
+ *
+ * Applies scalar multiplication.
+ */
+
+/**
+ * crank_vec_double_n_muls_self:
+ * @a: A vector.
+ * @b: A scalar.
+ *
+ * Applies scalar multiplication.
+ */
+
+/**
+ * crank_vec_double_n_divs:
+ * @a: A vector.
+ * @b: A scalar.
+ * @r: (out): A vector to store result.
+ *
+ * Applies scalar division.
+ */
+
+/**
+ * crank_vec_double_n_divs_self:
+ * @a: A vector.
+ * @b: A scalar.
+ *
+ * Applies scalar division.
+ */
+
+/**
+ * crank_vec_double_n_add:
+ * @a: A vector.
+ * @b: A vector.
+ * @r: (out): A vector to store result.
+ *
+ * Adds two vectors.
+ */
+
+/**
+ * crank_vec_double_n_add_self:
+ * @a: A vector.
+ * @b: A vector.
+ *
+ * Adds two vectors.
+ */
+
+/**
+ * crank_vec_double_n_sub:
+ * @a: A vector.
+ * @b: A vector.
+ * @r: (out): A vector to store result.
+ *
+ * Subtracts @a by @b.
+ */
+
+/**
+ * crank_vec_double_n_sub_self:
+ * @a: A vector.
+ * @b: A vector.
+ *
+ * Subtracts @a by @b.
+ */
+
+/**
+ * crank_vec_double_n_dot:
+ * @a: A vector
+ * @b: A vector
+ *
+ * Gets dot product of two vectors.
+ *
+ * Returns: dot product of two vectors.
+ */
+
+/**
+ * crank_vec_double_n_cmpmul:
+ * @a: A vector.
+ * @b: A vector.
+ * @r: (out): A vector to store result.
+ *
+ * Gets component-wise multiplication.
+ */
+
+/**
+ * crank_vec_double_n_cmpmul_self:
+ * @a: A vector.
+ * @b: A vector.
+ *
+ * Gets component-wise multiplication.
+ */
+
+/**
+ * crank_vec_double_n_cmpdiv:
+ * @a: A vector.
+ * @b: A vector.
+ * @r: (out): A vector to store result.
+ *
+ * Gets component-wise division.
+ */
+
+/**
+ * crank_vec_double_n_cmpdiv_self:
+ * @a: A vector.
+ * @b: A vector.
+ *
+ * Gets component-wise division.
+ */
+
+/**
+ * crank_vec_double_n_cmpless:
+ * @a: A vector.
+ * @b: A vector.
+ * @r: (out): A vector to store result.
+ *
+ * Gets each component of @a is less than counterpart of @b
+ */
+
+/**
+ * crank_vec_double_n_cmpeq:
+ * @a: A vector.
+ * @b: A vector.
+ * @r: (out): A vector to store result.
+ *
+ * Gets each component of @a equals to counterpart of @b
+ */
+
+/**
+ * crank_vec_double_n_cmpgreater:
+ * @a: A vector.
+ * @b: A vector.
+ * @r: (out): A vector to store result.
+ *
+ * Gets each component of @a is greater than counterpart of @b
+ */
+
+/**
+ * crank_vec_double_n_cmpcmp:
+ * @a: A vector.
+ * @b: A vector.
+ * @r: (out): A vector to store result.
+ *
+ * Gets compare result of each components.
+ */
+
+/**
+ * crank_vec_double_n_min:
+ * @a: A vector.
+ * @b: A vector.
+ * @r: (out): A vector to store result.
+ *
+ * Gets smaller value of each components.
+ */
+
+/**
+ * crank_vec_double_n_max:
+ * @a: A vector.
+ * @b: A vector.
+ * @r: (out): A vector to store result.
+ *
+ * Gets greater value of each components.
+ */
+
+/**
+ * crank_vec_double_n_abs:
+ * @a: A Vector.
+ * @r: (out): A vector to store result.
+ *
+ * Gets absolute value of each components.
+ */
+
+/**
+ * crank_vec_double_n_abs_self:
+ * @a: A Vector.
+ *
+ * Gets absolute value of each components.
+ */
+
+/**
+ * crank_vec_double_n_mulm:
+ * @a: A vector.
+ * @b: A Matrox.
+ * @r: (out): A vector to store result.
+ *
+ * Multiplies transpose of vector by matrix. (Vector transpose * Matrix)
+ */
+
+/**
+ * crank_vec_double_n_mulm_self:
+ * @a: A vector.
+ * @b: A Matrox.
+ *
+ * Multiplies transpose of vector by matrix. (Vector transpose * Matrix)
+ */
+
+/**
+ * crank_vec_double_n_mixs:
+ * @a: A vector.
+ * @b: A vector.
+ * @c: A scalar factor.
+ * @r: (out): A vector to store result.
+ *
+ * Gets linear interpolation of @a and @b by @c.
+ * So the result will be
+ *
+ *    (a * (1-c)) + (b * c)
+ */
+
+/**
+ * crank_vec_double_n_mix:
+ * @a: A vector.
+ * @b: A vector.
+ * @c: A factor.
+ * @r: (out): A vector to store result.
+ *
+ * Gets linear interpolation of @a and @b by @c.
+ * So the result will be
+ *
+ *    (a cmpmul c) + (b cmpmul ({1, 1, ..., 1} - c))
+ */
@@ -0,0 +1,1022 @@
+#ifndef CRANKVECDOUBLE_H
+#define CRANKVECDOUBLE_H
+
+/* Copyright (C) 2015, WSID   */
+
+/* Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef _CRANKBASE_INSIDE
+#error crankvecdouble.h cannot be included directly.
+#endif
+
+#include <glib.h>
+#include <glib-object.h>
+
+#include "crankfunction.h"
+#include "crankiter.h"
+#include "crankveccommon.h"
+#include "crankmatarena.h"
+
+G_BEGIN_DECLS
+
+/**
+ * CRANK_VEC_DOUBLE_S0: (skip)
+ *
+ * Static vector filled with 0.
+ */
+const gdouble CRANK_VEC_DOUBLE_S0[4];
+
+/**
+ * CRANK_VEC_DOUBLE_S1: (skip)
+ *
+ * Static vector filled with 1.
+ */
+const gdouble CRANK_VEC_DOUBLE_S1[4];
+
+/**
+ * crank_vec_double2_static_zero:
+ *
+ * Static vector filled with 0.
+ */
+const CrankVecDouble2 * const crank_vec_double2_static_zero;
+
+/**
+ * crank_vec_double3_static_zero:
+ *
+ * Static vector filled with 0.
+ */
+const CrankVecDouble3 * const crank_vec_double3_static_zero;
+
+/**
+ * crank_vec_double4_static_zero:
+ *
+ * Static vector filled with 0.
+ */
+const CrankVecDouble4 * const crank_vec_double4_static_zero;
+
+/**
+ * crank_vec_double2_static_one:
+ *
+ * Static vector filled with 0.
+ */
+const CrankVecDouble2 * const crank_vec_double2_static_one;
+
+/**
+ * crank_vec_double3_static_one:
+ *
+ * Static vector filled with 0.
+ */
+const CrankVecDouble3 * const crank_vec_double3_static_one;
+
+/**
+ * crank_vec_double4_static_one:
+ *
+ * Static vector filled with 0.
+ */
+const CrankVecDouble4 * const crank_vec_double4_static_one;
+
+
+/**
+ * CrankVecDouble2:
+ * @x: First element.
+ * @y: Second element.
+ *
+ * Double vector. Compared to dvec2 in GLSL.
+ */
+struct _CrankVecDouble2 {
+  gdouble x;
+  gdouble y;
+};
+
+#define CRANK_TYPE_VEC_DOUBLE2  (crank_vec_double2_get_type ())
+GType           crank_vec_double2_get_type  (void);
+
+
+void            crank_vec_double2_init      (CrankVecDouble2 *vec,
+                                             const gdouble    x,
+                                             const gdouble    y);
+
+void            crank_vec_double2_init_arr  (CrankVecDouble2 *vec,
+                                             const gdouble   *arr);
+
+void            crank_vec_double2_init_valist (CrankVecDouble2 *vec,
+                                               va_list          varargs);
+
+void            crank_vec_double2_init_fill (CrankVecDouble2 *vec,
+                                             const gdouble    fill);
+
+void            crank_vec_double2_init_from_vb (CrankVecDouble2     *vec,
+                                                const CrankVecBool2 *vb);
+
+void            crank_vec_double2_init_from_vi (CrankVecDouble2    *vec,
+                                                const CrankVecInt2 *vi);
+
+void            crank_vec_double2_init_from_vf (CrankVecDouble2      *vec,
+                                                const CrankVecFloat2 *vf);
+
+void            crank_vec_double2_copy      (const CrankVecDouble2 *vec,
+                                             CrankVecDouble2       *other);
+
+CrankVecDouble2 *crank_vec_double2_dup       (const CrankVecDouble2 *vec);
+
+gdouble         crank_vec_double2_get       (const CrankVecDouble2 *vec,
+                                             const guint            index);
+
+void            crank_vec_double2_set       (CrankVecDouble2 *vec,
+                                             const guint      index,
+                                             const gdouble    value);
+
+gboolean        crank_vec_double2_foreach   (const CrankVecDouble2 *vec,
+                                             CrankBoolDoubleFunc    func,
+                                             gpointer               userdata);
+
+void            crank_vec_double2_iterator  (CrankVecDouble2    *vec,
+                                             CrankIterMemDouble *iter);
+
+//////// Basic operation ////////
+
+guint           crank_vec_double2_hash      (gconstpointer a);
+
+gboolean        crank_vec_double2_equal     (gconstpointer a,
+                                             gconstpointer b);
+
+gboolean        crank_vec_double2_equal_delta(gconstpointer a,
+                                              gconstpointer b,
+                                              const gdouble d);
+
+gchar          *crank_vec_double2_to_string (const CrankVecDouble2 *vec);
+
+gchar          *crank_vec_double2_to_string_full (const CrankVecDouble2 *vec,
+                                                  const gchar           *left,
+                                                  const gchar           *in,
+                                                  const gchar           *right,
+                                                  const gchar           *format);
+
+
+//////// Standard vector property ///////
+
+gdouble         crank_vec_double2_get_magn_sq       (const CrankVecDouble2 *vec);
+
+gdouble         crank_vec_double2_get_magn          (const CrankVecDouble2 *vec);
+
+
+//////// Standard unary operations ////////
+
+void            crank_vec_double2_neg           (const CrankVecDouble2 *a,
+                                                 CrankVecDouble2       *r);
+
+void            crank_vec_double2_neg_self      (CrankVecDouble2 *a);
+
+void            crank_vec_double2_unit          (const CrankVecDouble2 *a,
+                                                 CrankVecDouble2       *r);
+
+void            crank_vec_double2_unit_self     (CrankVecDouble2 *a);
+
+
+//////// Scalar operations ////////
+
+void            crank_vec_double2_muls          (const CrankVecDouble2 *a,
+                                                 const gdouble          b,
+                                                 CrankVecDouble2       *r);
+
+void            crank_vec_double2_muls_self     (CrankVecDouble2 *a,
+                                                 const gdouble    b);
+
+void            crank_vec_double2_divs          (const CrankVecDouble2 *a,
+                                                 const gdouble          b,
+                                                 CrankVecDouble2       *r);
+
+void            crank_vec_double2_divs_self     (CrankVecDouble2 *a,
+                                                 const gdouble    b);
+
+//////// Standard vector operations ////////
+
+void            crank_vec_double2_add           (const CrankVecDouble2 *a,
+                                                 const CrankVecDouble2 *b,
+                                                 CrankVecDouble2       *r);
+
+void            crank_vec_double2_add_self      (CrankVecDouble2       *a,
+                                                 const CrankVecDouble2 *b);
+
+void            crank_vec_double2_sub           (const CrankVecDouble2 *a,
+                                                 const CrankVecDouble2 *b,
+                                                 CrankVecDouble2       *r);
+
+void            crank_vec_double2_sub_self      (CrankVecDouble2       *a,
+                                                 const CrankVecDouble2 *b);
+
+gdouble         crank_vec_double2_dot           (const CrankVecDouble2 *a,
+                                                 const CrankVecDouble2 *b);
+
+gdouble         crank_vec_double2_crs           (const CrankVecDouble2 *a,
+                                                 const CrankVecDouble2 *b);
+
+//////// Component vector operations ////////
+
+void            crank_vec_double2_cmpmul    (const CrankVecDouble2 *a,
+                                             const CrankVecDouble2 *b,
+                                             CrankVecDouble2       *r);
+
+void            crank_vec_double2_cmpmul_self(CrankVecDouble2       *a,
+                                              const CrankVecDouble2 *b);
+
+void            crank_vec_double2_cmpdiv    (const CrankVecDouble2 *a,
+                                             const CrankVecDouble2 *b,
+                                             CrankVecDouble2       *r);
+
+void            crank_vec_double2_cmpdiv_self(CrankVecDouble2       *a,
+                                              const CrankVecDouble2 *b);
+
+void            crank_vec_double2_cmpless   (const CrankVecDouble2 *a,
+                                             const CrankVecDouble2 *b,
+                                             CrankVecBool2         *r);
+
+void            crank_vec_double2_cmpeq     (const CrankVecDouble2 *a,
+                                             const CrankVecDouble2 *b,
+                                             CrankVecBool2         *r);
+
+void            crank_vec_double2_cmpgreater (const CrankVecDouble2 *a,
+                                              const CrankVecDouble2 *b,
+                                              CrankVecBool2         *r);
+
+void            crank_vec_double2_cmpcmp (const CrankVecDouble2 *a,
+                                          const CrankVecDouble2 *b,
+                                          CrankVecInt2          *r);
+
+void            crank_vec_double2_min   (const CrankVecDouble2 *a,
+                                         const CrankVecDouble2 *b,
+                                         CrankVecDouble2       *r);
+
+void            crank_vec_double2_max   (const CrankVecDouble2 *a,
+                                         const CrankVecDouble2 *b,
+                                         CrankVecDouble2       *r);
+
+void            crank_vec_double2_abs   (const CrankVecDouble2 *a,
+                                         CrankVecDouble2       *r);
+
+void            crank_vec_double2_abs_self(CrankVecDouble2 *a);
+
+//////// Matrix Operations /////////////////////////////////////////////////////
+
+void            crank_vec_double2_mulm (const CrankVecDouble2 *a,
+                                        const CrankMatDouble2 *b,
+                                        CrankVecDouble2       *r);
+
+void            crank_vec_double2_mulm_self (CrankVecDouble2       *a,
+                                             const CrankMatDouble2 *b);
+
+
+//////// Ternary Operations ////////
+
+void            crank_vec_double2_mixs  (const CrankVecDouble2 *a,
+                                         const CrankVecDouble2 *b,
+                                         const gdouble          c,
+                                         CrankVecDouble2       *r);
+
+void            crank_vec_double2_mix   (const CrankVecDouble2 *a,
+                                         const CrankVecDouble2 *b,
+                                         const CrankVecDouble2 *c,
+                                         CrankVecDouble2       *r);
+
+
+
+
+
+
+/**
+ * CrankVecDouble3:
+ * @x: First element.
+ * @y: Second element.
+ * @z: Third element.
+ *
+ * Double vector. Compared to dvec3 in GLSL.
+ */
+struct _CrankVecDouble3 {
+  gdouble x;
+  gdouble y;
+  gdouble z;
+};
+
+#define CRANK_TYPE_VEC_DOUBLE3  (crank_vec_double3_get_type ())
+GType           crank_vec_double3_get_type  (void);
+
+
+void            crank_vec_double3_init      (CrankVecDouble3 *vec,
+                                             const gdouble    x,
+                                             const gdouble    y,
+                                             const gdouble    z);
+
+void            crank_vec_double3_init_arr  (CrankVecDouble3 *vec,
+                                             const gdouble   *arr);
+
+void            crank_vec_double3_init_valist (CrankVecDouble3 *vec,
+                                               va_list          varargs);
+
+void            crank_vec_double3_init_fill (CrankVecDouble3 *vec,
+                                             const gdouble    fill);
+
+void            crank_vec_double3_init_from_vb (CrankVecDouble3     *vec,
+                                                const CrankVecBool3 *vb);
+
+void            crank_vec_double3_init_from_vi (CrankVecDouble3    *vec,
+                                                const CrankVecInt3 *vi);
+
+void            crank_vec_double3_init_from_vf (CrankVecDouble3      *vec,
+                                                const CrankVecFloat3 *vf);
+
+void            crank_vec_double3_copy      (const CrankVecDouble3 *vec,
+                                             CrankVecDouble3       *other);
+
+CrankVecDouble3 *crank_vec_double3_dup       (const CrankVecDouble3 *vec);
+
+gdouble         crank_vec_double3_get       (const CrankVecDouble3 *vec,
+                                             const guint            index);
+
+void            crank_vec_double3_set       (CrankVecDouble3 *vec,
+                                             const guint      index,
+                                             const gdouble    value);
+
+gboolean        crank_vec_double3_foreach   (const CrankVecDouble3 *vec,
+                                             CrankBoolDoubleFunc    func,
+                                             gpointer               userdata);
+
+void            crank_vec_double3_iterator  (CrankVecDouble3    *vec,
+                                             CrankIterMemDouble *iter);
+
+//////// Basic operation ////////
+
+guint           crank_vec_double3_hash      (gconstpointer a);
+
+gboolean        crank_vec_double3_equal     (gconstpointer a,
+                                             gconstpointer b);
+
+gboolean        crank_vec_double3_equal_delta(gconstpointer a,
+                                              gconstpointer b,
+                                              const gdouble d);
+
+gchar          *crank_vec_double3_to_string (const CrankVecDouble3 *vec);
+
+gchar          *crank_vec_double3_to_string_full (const CrankVecDouble3 *vec,
+                                                  const gchar           *left,
+                                                  const gchar           *in,
+                                                  const gchar           *right,
+                                                  const gchar           *format);
+
+
+//////// Standard vector property ///////
+
+gdouble         crank_vec_double3_get_magn_sq (const CrankVecDouble3 *vec);
+
+gdouble         crank_vec_double3_get_magn    (const CrankVecDouble3 *vec);
+
+
+//////// Standard unary operations ////////
+
+void            crank_vec_double3_neg         (const CrankVecDouble3 *a,
+                                               CrankVecDouble3       *r);
+
+void            crank_vec_double3_neg_self    (CrankVecDouble3      *a);
+
+void            crank_vec_double3_unit        (const CrankVecDouble3 *a,
+                                               CrankVecDouble3       *r);
+
+void            crank_vec_double3_unit_self   (CrankVecDouble3      *a);
+
+
+//////// Scalar operations ////////
+
+void            crank_vec_double3_muls        (const CrankVecDouble3 *a,
+                                               const gdouble          b,
+                                               CrankVecDouble3       *r);
+
+void            crank_vec_double3_muls_self   (CrankVecDouble3 *a,
+                                               const gdouble    b);
+
+void            crank_vec_double3_divs        (const CrankVecDouble3 *a,
+                                               const gdouble          b,
+                                               CrankVecDouble3       *r);
+
+void            crank_vec_double3_divs_self   (CrankVecDouble3 *a,
+                                               const gdouble    b);
+
+//////// Standard vector operations ////////
+
+void            crank_vec_double3_add         (const CrankVecDouble3 *a,
+                                               const CrankVecDouble3 *b,
+                                               CrankVecDouble3       *r);
+
+void            crank_vec_double3_add_self    (CrankVecDouble3       *a,
+                                               const CrankVecDouble3 *b);
+
+void            crank_vec_double3_sub         (const CrankVecDouble3 *a,
+                                               const CrankVecDouble3 *b,
+                                               CrankVecDouble3       *r);
+
+void            crank_vec_double3_sub_self    (CrankVecDouble3       *a,
+                                               const CrankVecDouble3 *b);
+
+gdouble         crank_vec_double3_dot         (const CrankVecDouble3 *a,
+                                               const CrankVecDouble3 *b);
+
+void            crank_vec_double3_crs         (const CrankVecDouble3 *a,
+                                               const CrankVecDouble3 *b,
+                                               CrankVecDouble3       *r);
+
+void            crank_vec_double3_crs_self    (CrankVecDouble3       *a,
+                                               const CrankVecDouble3 *b);
+
+
+//////// Component vector operations ////////
+
+void            crank_vec_double3_cmpmul    (const CrankVecDouble3 *a,
+                                             const CrankVecDouble3 *b,
+                                             CrankVecDouble3       *r);
+
+void            crank_vec_double3_cmpmul_self(CrankVecDouble3       *a,
+                                              const CrankVecDouble3 *b);
+
+void            crank_vec_double3_cmpdiv    (const CrankVecDouble3 *a,
+                                             const CrankVecDouble3 *b,
+                                             CrankVecDouble3       *r);
+
+void            crank_vec_double3_cmpdiv_self(CrankVecDouble3       *a,
+                                              const CrankVecDouble3 *b);
+
+
+void            crank_vec_double3_cmpless   (const CrankVecDouble3 *a,
+                                             const CrankVecDouble3 *b,
+                                             CrankVecBool3         *r);
+
+void            crank_vec_double3_cmpeq     (const CrankVecDouble3 *a,
+                                             const CrankVecDouble3 *b,
+                                             CrankVecBool3         *r);
+
+void            crank_vec_double3_cmpgreater (const CrankVecDouble3 *a,
+                                              const CrankVecDouble3 *b,
+                                              CrankVecBool3         *r);
+
+void            crank_vec_double3_cmpcmp (const CrankVecDouble3 *a,
+                                          const CrankVecDouble3 *b,
+                                          CrankVecInt3          *r);
+
+void            crank_vec_double3_min   (const CrankVecDouble3 *a,
+                                         const CrankVecDouble3 *b,
+                                         CrankVecDouble3       *r);
+
+void            crank_vec_double3_max   (const CrankVecDouble3 *a,
+                                         const CrankVecDouble3 *b,
+                                         CrankVecDouble3       *r);
+
+void            crank_vec_double3_abs   (const CrankVecDouble3 *a,
+                                         CrankVecDouble3       *r);
+
+void            crank_vec_double3_abs_self(CrankVecDouble3 *a);
+
+//////// Matrix operations ////////
+
+void            crank_vec_double3_mulm  (const CrankVecDouble3 *a,
+                                         const CrankMatDouble3 *b,
+                                         CrankVecDouble3       *r);
+
+void            crank_vec_double3_mulm_self(CrankVecDouble3       *a,
+                                            const CrankMatDouble3 *b);
+
+
+//////// Ternary Operations ////////
+
+void            crank_vec_double3_mixs  (const CrankVecDouble3 *a,
+                                         const CrankVecDouble3 *b,
+                                         const gdouble          c,
+                                         CrankVecDouble3       *r);
+
+void            crank_vec_double3_mix   (const CrankVecDouble3 *a,
+                                         const CrankVecDouble3 *b,
+                                         const CrankVecDouble3 *c,
+                                         CrankVecDouble3       *r);
+
+
+//////// Batch operations ////////
+
+void            crank_vec_double3_batch_dot (const guint            n,
+                                             const CrankVecDouble3 *a,
+                                             const CrankVecDouble3 *b,
+                                             gdouble               *r);
+
+void            crank_vec_double3_batch_crs (const guint            n,
+                                             const CrankVecDouble3 *a,
+                                             const CrankVecDouble3 *b,
+                                             CrankVecDouble3       *r);
+
+void            crank_vec_double3_batch_unit (const guint            n,
+                                              const CrankVecDouble3 *a,
+                                              CrankVecDouble3       *r);
+
+void            crank_vec_double3_soa_dot   (const guint    n,
+                                             const gdouble *ax,
+                                             const gdouble *ay,
+                                             const gdouble *az,
+                                             const gdouble *bx,
+                                             const gdouble *by,
+                                             const gdouble *bz,
+                                             gdouble       *r);
+
+void            crank_vec_double3_soa_crs   (const guint    n,
+                                             const gdouble *ax,
+                                             const gdouble *ay,
+                                             const gdouble *az,
+                                             const gdouble *bx,
+                                             const gdouble *by,
+                                             const gdouble *bz,
+                                             gdouble       *rx,
+                                             gdouble       *ry,
+                                             gdouble       *rz);
+
+void            crank_vec_double3_soa_unit  (const guint    n,
+                                             const gdouble *ax,
+                                             const gdouble *ay,
+                                             const gdouble *az,
+                                             gdouble       *rx,
+                                             gdouble       *ry,
+                                             gdouble       *rz);
+
+/**
+ * CrankVecDouble4:
+ * @x: First element.
+ * @y: Second element.
+ * @z: Third element.
+ * @w: Fourth element.
+ *
+ * Double vector. Compared to dvec4 in GLSL.
+ */
+struct _CrankVecDouble4 {
+  gdouble x;
+  gdouble y;
+  gdouble z;
+  gdouble w;
+};
+
+#define CRANK_TYPE_VEC_DOUBLE4  (crank_vec_double4_get_type ())
+GType           crank_vec_double4_get_type  (void);
+
+
+void            crank_vec_double4_init      (CrankVecDouble4 *vec,
+                                             const gdouble    x,
+                                             const gdouble    y,
+                                             const gdouble    z,
+                                             const gdouble    w);
+
+void            crank_vec_double4_init_arr  (CrankVecDouble4 *vec,
+                                             const gdouble   *arr);
+
+void            crank_vec_double4_init_valist (CrankVecDouble4 *vec,
+                                               va_list          varargs);
+
+void            crank_vec_double4_init_fill (CrankVecDouble4 *vec,
+                                             const gdouble    fill);
+
+void            crank_vec_double4_init_from_vb (CrankVecDouble4     *vec,
+                                                const CrankVecBool4 *vb);
+
+void            crank_vec_double4_init_from_vi (CrankVecDouble4    *vec,
+                                                const CrankVecInt4 *vi);
+
+void            crank_vec_double4_init_from_vf (CrankVecDouble4      *vec,
+                                                const CrankVecFloat4 *vf);
+
+void            crank_vec_double4_copy      (const CrankVecDouble4 *vec,
+                                             CrankVecDouble4 *other);
+
+CrankVecDouble4 *crank_vec_double4_dup       (const CrankVecDouble4 *vec);
+
+gdouble         crank_vec_double4_get       (const CrankVecDouble4 *vec,
+                                             const guint     index);
+
+void            crank_vec_double4_set       (CrankVecDouble4 *vec,
+                                             const guint      index,
+                                             const gdouble    value);
+
+gboolean        crank_vec_double4_foreach   (const CrankVecDouble4 *vec,
+                                             CrankBoolDoubleFunc    func,
+                                             gpointer               userdata);
+
+void            crank_vec_double4_iterator  (CrankVecDouble4    *vec,
+                                             CrankIterMemDouble *iter);
+
+//////// Basic operation ////////
+
+guint           crank_vec_double4_hash      (gconstpointer a);
+
+gboolean        crank_vec_double4_equal     (gconstpointer a,
+                                             gconstpointer b);
+
+gboolean        crank_vec_double4_equal_delta(gconstpointer a,
+                                              gconstpointer b,
+                                              const gdouble d);
+
+gchar          *crank_vec_double4_to_string (const CrankVecDouble4 *vec);
+
+gchar          *crank_vec_double4_to_string_full (const CrankVecDouble4 *vec,
+                                                  const gchar           *left,
+                                                  const gchar           *in,
+                                                  const gchar           *right,
+                                                  const gchar           *format);
+
+
+//////// Standard vector property ///////
+
+gdouble         crank_vec_double4_get_magn_sq       (const CrankVecDouble4 *vec);
+
+gdouble         crank_vec_double4_get_magn          (const CrankVecDouble4 *vec);
+
+
+//////// Standard unary operations ////////
+
+void            crank_vec_double4_neg           (const CrankVecDouble4 *a,
+                                                 CrankVecDouble4       *r);
+
+void            crank_vec_double4_neg_self      (CrankVecDouble4 *a);
+
+void            crank_vec_double4_unit          (const CrankVecDouble4 *a,
+                                                 CrankVecDouble4       *r);
+
+void            crank_vec_double4_unit_self     (CrankVecDouble4 *a);
+
+
+//////// Scalar operations ////////
+
+void            crank_vec_double4_muls          (const CrankVecDouble4 *a,
+                                                 const gdouble          b,
+                                                 CrankVecDouble4       *r);
+
+void            crank_vec_double4_muls_self     (CrankVecDouble4 *a,
+                                                 const gdouble    b);
+
+void            crank_vec_double4_divs          (const CrankVecDouble4 *a,
+                                                 const gdouble          b,
+                                                 CrankVecDouble4       *r);
+
+void            crank_vec_double4_divs_self     (CrankVecDouble4 *a,
+                                                 const gdouble    b);
+
+//////// Standard vector operations ////////
+
+void            crank_vec_double4_add           (const CrankVecDouble4 *a,
+                                                 const CrankVecDouble4 *b,
+                                                 CrankVecDouble4       *r);
+
+void            crank_vec_double4_add_self      (CrankVecDouble4       *a,
+                                                 const CrankVecDouble4 *b);
+
+void            crank_vec_double4_sub           (const CrankVecDouble4 *a,
+                                                 const CrankVecDouble4 *b,
+                                                 CrankVecDouble4       *r);
+
+void            crank_vec_double4_sub_self      (CrankVecDouble4       *a,
+                                                 const CrankVecDouble4 *b);
+
+gdouble         crank_vec_double4_dot           (const CrankVecDouble4 *a,
+                                                 const CrankVecDouble4 *b);
+
+//////// Component vector operations ////////
+
+void            crank_vec_double4_cmpmul    (const CrankVecDouble4 *a,
+                                             const CrankVecDouble4 *b,
+                                             CrankVecDouble4       *r);
+
+void            crank_vec_double4_cmpmul_self(CrankVecDouble4       *a,
+                                              const CrankVecDouble4 *b);
+
+void            crank_vec_double4_cmpdiv    (const CrankVecDouble4 *a,
+                                             const CrankVecDouble4 *b,
+                                             CrankVecDouble4       *r);
+
+void            crank_vec_double4_cmpdiv_self(CrankVecDouble4       *a,
+                                              const CrankVecDouble4 *b);
+
+
+void            crank_vec_double4_cmpless   (const CrankVecDouble4 *a,
+                                             const CrankVecDouble4 *b,
+                                             CrankVecBool4         *r);
+
+void            crank_vec_double4_cmpeq     (const CrankVecDouble4 *a,
+                                             const CrankVecDouble4 *b,
+                                             CrankVecBool4         *r);
+
+void            crank_vec_double4_cmpgreater (const CrankVecDouble4 *a,
+                                              const CrankVecDouble4 *b,
+                                              CrankVecBool4         *r);
+
+void            crank_vec_double4_cmpcmp (const CrankVecDouble4 *a,
+                                          const CrankVecDouble4 *b,
+                                          CrankVecInt4          *r);
+
+void            crank_vec_double4_min   (const CrankVecDouble4 *a,
+                                         const CrankVecDouble4 *b,
+                                         CrankVecDouble4       *r);
+
+void            crank_vec_double4_max   (const CrankVecDouble4 *a,
+                                         const CrankVecDouble4 *b,
+                                         CrankVecDouble4       *r);
+
+void            crank_vec_double4_abs   (const CrankVecDouble4 *a,
+                                         CrankVecDouble4       *r);
+
+void            crank_vec_double4_abs_self(CrankVecDouble4 *a);
+
+//////// Matrix operations ////////
+
+void            crank_vec_double4_mulm  (const CrankVecDouble4 *a,
+                                         const CrankMatDouble4 *b,
+                                         CrankVecDouble4       *r);
+
+void            crank_vec_double4_mulm_self(CrankVecDouble4       *a,
+                                            const CrankMatDouble4 *b);
+
+//////// Ternary Operations ////////
+
+void            crank_vec_double4_mixs  (const CrankVecDouble4 *a,
+                                         const CrankVecDouble4 *b,
+                                         const gdouble          c,
+                                         CrankVecDouble4       *r);
+
+void            crank_vec_double4_mix   (const CrankVecDouble4 *a,
+                                         const CrankVecDouble4 *b,
+                                         const CrankVecDouble4 *c,
+                                         CrankVecDouble4       *r);
+
+
+
+
+
+
+/**
+ * CrankVecDoubleN:
+ * @data: (array length=n): Array to store elements.
+ * @n: size of data.
+ *
+ * Struct to point variable size of double vector.
+ */
+struct _CrankVecDoubleN {
+  gdouble *data;
+  guint n;
+};
+
+#define CRANK_TYPE_VEC_DOUBLE_N (crank_vec_double_n_get_type ())
+GType           crank_vec_double_n_get_type (void);
+
+void            crank_vec_double_n_init     (CrankVecDoubleN *vec,
+                                             const guint     n,
+                                             ...);
+
+void            crank_vec_double_n_init_arr (CrankVecDoubleN *vec,
+                                             const guint      n,
+                                             const gdouble   *arr);
+
+void            crank_vec_double_n_init_arr_take (CrankVecDoubleN *vec,
+                                                  const guint      n,
+                                                  gdouble         *arr);
+
+void            crank_vec_double_n_init_arena (CrankVecDoubleN *vec,
+                                               CrankMatArena   *arena,
+                                               const guint      n);
+
+void            crank_vec_double_n_init_arr_arena (CrankVecDoubleN *vec,
+                                                   CrankMatArena   *arena,
+                                                   const guint      n,
+                                                   const gdouble   *arr);
+
+void            crank_vec_double_n_init_valist (CrankVecDoubleN *vec,
+                                                const guint      n,
+                                                va_list          varargs);
+
+void            crank_vec_double_n_init_fill (CrankVecDoubleN *vec,
+                                              const guint      n,
+                                              const gdouble    fill);
+
+void            crank_vec_double_n_init_from_vb (CrankVecDoubleN      *vec,
+                                                 const CrankVecBoolN  *vb);
+
+void            crank_vec_double_n_init_from_vi (CrankVecDoubleN      *vec,
+                                                 const CrankVecIntN   *vi);
+
+void            crank_vec_double_n_init_from_vf (CrankVecDoubleN        *vec,
+                                                 const CrankVecFloatN   *vf);
+
+void            crank_vec_double_n_fini     (CrankVecDoubleN *vec);
+
+void            crank_vec_double_n_copy     (const CrankVecDoubleN *vec,
+                                             CrankVecDoubleN *other);
+
+CrankVecDoubleN *crank_vec_double_n_dup      (const CrankVecDoubleN *vec);
+
+void            crank_vec_double_n_free     (CrankVecDoubleN *vec);
+
+guint           crank_vec_double_n_get_size (const CrankVecDoubleN *vec);
+
+gdouble         crank_vec_double_n_get      (const CrankVecDoubleN *vec,
+                                             const guint            index);
+
+void            crank_vec_double_n_set      (CrankVecDoubleN *vec,
+                                             const guint      index,
+                                             const gdouble    value);
+
+void            crank_vec_double_n_prepend  (CrankVecDoubleN *vec,
+                                             const gdouble    value);
+
+void            crank_vec_double_n_append   (CrankVecDoubleN *vec,
+                                             const gdouble    value);
+
+void            crank_vec_double_n_insert   (CrankVecDoubleN *vec,
+                                             const guint      index,
+                                             const gdouble    value);
+
+void            crank_vec_double_n_remove   (CrankVecDoubleN *vec,
+                                             const guint      index);
+
+gboolean        crank_vec_double_n_foreach  (const CrankVecDoubleN *vec,
+                                             CrankBoolDoubleFunc    func,
+                                             gpointer               userdata);
+
+void            crank_vec_double_n_iterator (CrankVecDoubleN    *vec,
+                                             CrankIterMemDouble *iter);
+
+//////// Basic operation ////////
+
+guint           crank_vec_double_n_hash     (gconstpointer a);
+
+gboolean        crank_vec_double_n_equal    (gconstpointer a,
+                                             gconstpointer b);
+
+gboolean        crank_vec_double_n_equal_delta(gconstpointer a,
+                                               gconstpointer b,
+                                               const gdouble d);
+
+gchar          *crank_vec_double_n_to_string (const CrankVecDoubleN *vec);
+
+gchar          *crank_vec_double_n_to_string_full (const CrankVecDoubleN *vec,
+                                                   const gchar    *left,
+                                                   const gchar    *in,
+                                                   const gchar    *right,
+                                                   const gchar    *format);
+
+//////// Classification ////////////////////////////////////////////////////////
+
+gboolean        crank_vec_double_n_is_zero          (const CrankVecDoubleN *vec);
+
+gboolean        crank_vec_double_n_is_one           (const CrankVecDoubleN *vec);
+
+gboolean        crank_vec_double_n_is_unit          (const CrankVecDoubleN *vec);
+
+gboolean        crank_vec_double_n_is_empty         (const CrankVecDoubleN *vec);
+
+gboolean        crank_vec_double_n_has_nan          (const CrankVecDoubleN *vec);
+
+gboolean        crank_vec_double_n_has_inf          (const CrankVecDoubleN *vec);
+
+//////// Standard vector property ///////
+
+gdouble         crank_vec_double_n_get_magn_sq      (const CrankVecDoubleN *vec);
+
+gdouble         crank_vec_double_n_get_magn         (const CrankVecDoubleN *vec);
+
+
+//////// Standard unary operations ////////
+
+void            crank_vec_double_n_neg          (const CrankVecDoubleN *a,
+                                                 CrankVecDoubleN *r);
+
+void            crank_vec_double_n_neg_self     (CrankVecDoubleN *a);
+
+void            crank_vec_double_n_unit         (const CrankVecDoubleN *a,
+                                                 CrankVecDoubleN *r);
+
+void            crank_vec_double_n_unit_self    (CrankVecDoubleN *a);
+
+
+//////// Scalar operations ////////
+
+void            crank_vec_double_n_muls         (const CrankVecDoubleN *a,
+                                                 const gdouble   b,
+                                                 CrankVecDoubleN *r);
+
+void            crank_vec_double_n_muls_self    (CrankVecDoubleN *a,
+                                                 const gdouble    b);
+
+void            crank_vec_double_n_divs         (const CrankVecDoubleN *a,
+                                                 const gdouble   b,
+                                                 CrankVecDoubleN *r);
+
+void            crank_vec_double_n_divs_self    (CrankVecDoubleN *a,
+                                                 const gdouble    b);
+
+//////// Standard vector operations ////////
+
+void            crank_vec_double_n_add          (const CrankVecDoubleN *a,
+                                                 const CrankVecDoubleN *b,
+                                                 CrankVecDoubleN       *r);
+
+void            crank_vec_double_n_add_self     (CrankVecDoubleN       *a,
+                                                 const CrankVecDoubleN *b);
+
+void            crank_vec_double_n_sub          (const CrankVecDoubleN *a,
+                                                 const CrankVecDoubleN *b,
+                                                 CrankVecDoubleN *r);
+
+void            crank_vec_double_n_sub_self     (CrankVecDoubleN *a,
+                                                 const CrankVecDoubleN *b);
+
+gdouble         crank_vec_double_n_dot          (const CrankVecDoubleN *a,
+                                                 const CrankVecDoubleN *b);
+
+//////// Component vector operations ////////
+
+void            crank_vec_double_n_cmpmul   (const CrankVecDoubleN *a,
+                                             const CrankVecDoubleN *b,
+                                             CrankVecDoubleN       *r);
+
+void            crank_vec_double_n_cmpmul_self(CrankVecDoubleN       *a,
+                                               const CrankVecDoubleN *b);
+
+void            crank_vec_double_n_cmpdiv   (const CrankVecDoubleN *a,
+                                             const CrankVecDoubleN *b,
+                                             CrankVecDoubleN       *r);
+
+void            crank_vec_double_n_cmpdiv_self(CrankVecDoubleN       *a,
+                                               const CrankVecDoubleN *b);
+
+
+void            crank_vec_double_n_cmpless  (const CrankVecDoubleN *a,
+                                             const CrankVecDoubleN *b,
+                                             CrankVecBoolN         *r);
+
+void            crank_vec_double_n_cmpeq    (const CrankVecDoubleN *a,
+                                             const CrankVecDoubleN *b,
+                                             CrankVecBoolN         *r);
+
+void            crank_vec_double_n_cmpgreater   (const CrankVecDoubleN *a,
+                                                 const CrankVecDoubleN *b,
+                                                 CrankVecBoolN         *r);
+
+void            crank_vec_double_n_cmpcmp   (const CrankVecDoubleN *a,
+                                             const CrankVecDoubleN *b,
+                                             CrankVecIntN          *r);
+
+void            crank_vec_double_n_min  (const CrankVecDoubleN *a,
+                                         const CrankVecDoubleN *b,
+                                         CrankVecDoubleN       *r);
+
+void            crank_vec_double_n_max  (const CrankVecDoubleN *a,
+                                         const CrankVecDoubleN *b,
+                                         CrankVecDoubleN       *r);
+
+void            crank_vec_double_n_abs  (const CrankVecDoubleN *a,
+                                         CrankVecDoubleN       *r);
+
+void            crank_vec_double_n_abs_self (CrankVecDoubleN *a);
+
+//////// Matrix operations ////////
+
+void            crank_vec_double_n_mulm (const CrankVecDoubleN *a,
+                                         const CrankMatDoubleN *b,
+                                         CrankVecDoubleN       *r);
+
+void            crank_vec_double_n_mulm_self(CrankVecDoubleN       *a,
+                                             const CrankMatDoubleN *b);
+
+//////// Ternary Operations ////////
+
+void            crank_vec_double_n_mixs (const CrankVecDoubleN *a,
+                                         const CrankVecDoubleN *b,
+                                         const gdouble          c,
+                                         CrankVecDoubleN       *r);
+
+void            crank_vec_double_n_mix  (const CrankVecDoubleN *a,
+                                         const CrankVecDoubleN *b,
+                                         const CrankVecDoubleN *c,
+                                         CrankVecDoubleN       *r);
+
+//////// Macro variant of operations ///////////////////////////////////////////
+
+#define crank_vec_double_n_get(vec,index)        CRANK_VEC_GET(vec,index)
+#define crank_vec_double_n_set(vec,index,value)  CRANK_VEC_SET(vec,index,value)
+
+G_END_DECLS
+
+#endif //CRANKBOOLVEC_H
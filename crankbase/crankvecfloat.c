@@ -23,6 +23,7 @@
 
 #include <math.h>
 #include <stdarg.h>
+#include <string.h>
 
 #include <glib.h>
 #include <glib-object.h>
@@ -36,6 +37,14 @@
 #include "crankvecfloat.h"
 #include "crankmatfloat.h"
 
+#include "crankcpu-private.h"
+#include "crankvecsimd-private.h"
+#include "crankvecmask-private.h"
+
+#ifdef CRANK_CPU_X86
+#include <immintrin.h>
+#endif
+
 /**
  * SECTION: crankvecfloat
  * @title: Float Vectors
@@ -177,57 +186,62 @@
  *     </tbody>
  *   </tgroup>
  * </table>
+ *
+ * # Batch Operations.
+ *
+ * Calling a function for each of thousands vectors takes much of time in
+ * function calls. Batch operations process arrays of #CrankVecFloat3 at once.
+ *
+ * * crank_vec_float3_batch_*() takes arrays of #CrankVecFloat3.
+ * * crank_vec_float3_soa_*() takes separated arrays of x, y, and z
+ *   components. This is faster, as no conversion is needed.
+ *
+ * Both of them process several vectors at once with SIMD instructions, when
+ * CPU supports them.
+ *
+ * # SIMD Operations of #CrankVecFloatN.
+ *
+ * Element-wise operations of #CrankVecFloatN, like addition, scalar
+ * multiplication, interpolation and dot product, use SSE2, AVX2 or AVX-512
+ * kernels, which is selected by CPU when they are first used. Selection can be
+ * limited by environment variable CRANK_SIMD, with one of "none", "sse2",
+ * "avx2" and "avx512".
+ *
+ * Data of vectors created by crank_vec_float_n_*() functions, and of vectors
+ * returned by other functions of Crank System, like multiplications or
+ * solvers of matrices, are aligned to 64 bytes. Data given by
+ * crank_vec_float_n_init_arr_take() is not, but kernels still work on it.
  */
 
+//////// Template Instance /////////////////////////////////////////////////////
 
-const gfloat CRANK_VEC_FLOAT_S0[4] = {0, 0, 0, 0};
-const gfloat CRANK_VEC_FLOAT_S1[4] = {1, 1, 1, 1};
-
-const CrankVecFloat2 * const crank_vec_float2_static_zero =
-    (const CrankVecFloat2*) CRANK_VEC_FLOAT_S0;
-const CrankVecFloat3 * const crank_vec_float3_static_zero =
-    (const CrankVecFloat3*) CRANK_VEC_FLOAT_S0;
-const CrankVecFloat4 * const crank_vec_float4_static_zero =
-    (const CrankVecFloat4*) CRANK_VEC_FLOAT_S0;
-
-const CrankVecFloat2 * const crank_vec_float2_static_one =
-    (const CrankVecFloat2*) CRANK_VEC_FLOAT_S1;
-const CrankVecFloat3 * const crank_vec_float3_static_one =
-    (const CrankVecFloat3*) CRANK_VEC_FLOAT_S1;
-const CrankVecFloat4 * const crank_vec_float4_static_one =
-    (const CrankVecFloat4*) CRANK_VEC_FLOAT_S1;
-
-
-
-#define CMP(a, b) (((a) > (b)) - ((a) < (b)))
+/* Functions are written once in crankvec-template-private.h, and instantiated
+ * for float here. Documentations of them follow. */
 
-static void crank_vec_float2_transform_from_vb (const GValue *src,
-                                                GValue       *dest);
+#define CRANK_VEC_T                   gfloat
+#define CRANK_VEC_TYPE(n)             CrankVecFloat##n
+#define CRANK_VEC_FUNC(n, name)       crank_vec_float##n##_##name
+#define CRANK_VEC_SYM(n)              crank_vec_float##n
+#define CRANK_VEC_GTYPE(n)            CRANK_TYPE_VEC_FLOAT##n
+#define CRANK_VEC_MAT_TYPE(n)         CrankMatFloat##n
+#define CRANK_VEC_NAME                "VecFloatN"
+#define CRANK_VEC_S0                  CRANK_VEC_FLOAT_S0
+#define CRANK_VEC_S1                  CRANK_VEC_FLOAT_S1
+#define CRANK_VEC_HASH                crank_float_hash
+#define CRANK_VEC_MATH(func)          func##f
+#define CRANK_VEC_BOOL_FUNC           CrankBoolFloatFunc
+#define CRANK_VEC_ITER                CrankIterMemFloat
+#define CRANK_VEC_ITER_FUNC(name)     crank_iter_mem_float_##name
+#define CRANK_VEC_GET_KERNELS         _crank_vec_float_get_kernels
+#define CRANK_VEC_GET_MASK_KERNELS    _crank_vec_mask_float_get_kernels
+#define CRANK_VEC_INTRIN(f)           f##_ps
+#define CRANK_VEC_M256                __m256
+#define CRANK_VEC_W256                8
 
-static void crank_vec_float2_transform_from_vi (const GValue *src,
-                                                GValue       *dest);
+#include "crankvec-template-private.h"
 
-static void crank_vec_float2_transform_to_string (const GValue *src,
-                                                  GValue       *dest);
 
-G_DEFINE_BOXED_TYPE_WITH_CODE (
-  CrankVecFloat2,
-  crank_vec_float2,
-  crank_vec_float2_dup,
-  g_free,
-  {
-    g_value_register_transform_func (CRANK_TYPE_VEC_BOOL2,
-                                     g_define_type_id,
-                                     crank_vec_float2_transform_from_vb);
-
-    g_value_register_transform_func (CRANK_TYPE_VEC_INT2,
-                                     g_define_type_id,
-                                     crank_vec_float2_transform_from_vi);
-
-    g_value_register_transform_func (g_define_type_id,
-                                     G_TYPE_STRING,
-                                     crank_vec_float2_transform_to_string);
-  })
+//////// Documentations ////////////////////////////////////////////////////////
 
 /**
  * crank_vec_float2_init:
@@ -237,14 +251,6 @@ G_DEFINE_BOXED_TYPE_WITH_CODE (
  *
  * Initializes vector with given components.
  */
-void
-crank_vec_float2_init (CrankVecFloat2 *vec,
-                       const gfloat    x,
-                       const gfloat    y)
-{
-  vec->x = x;
-  vec->y = y;
-}
 
 /**
  * crank_vec_float2_init_arr:
@@ -253,13 +259,6 @@ crank_vec_float2_init (CrankVecFloat2 *vec,
  *
  * Initializes vector with given array.
  */
-void
-crank_vec_float2_init_arr (CrankVecFloat2 *vec,
-                           const gfloat   *arr)
-{
-  vec->x = arr[0];
-  vec->y = arr[1];
-}
 
 /**
  * crank_vec_float2_init_valist:
@@ -268,13 +267,6 @@ crank_vec_float2_init_arr (CrankVecFloat2 *vec,
  *
  * Initializes vector with given array.
  */
-void
-crank_vec_float2_init_valist (CrankVecFloat2 *vec,
-                              va_list         varargs)
-{
-  vec->x = va_arg (varargs, gdouble);
-  vec->y = va_arg (varargs, gdouble);
-}
 
 /**
  * crank_vec_float2_init_fill:
@@ -283,13 +275,6 @@ crank_vec_float2_init_valist (CrankVecFloat2 *vec,
  *
  * Initializes vector by filling single value.
  */
-void
-crank_vec_float2_init_fill (CrankVecFloat2 *vec,
-                            gfloat          fill)
-{
-  vec->x = fill;
-  vec->y = fill;
-}
 
 /**
  * crank_vec_float2_init_from_vb:
@@ -298,13 +283,6 @@ crank_vec_float2_init_fill (CrankVecFloat2 *vec,
  *
  * Initialize vector from boolean vector.
  */
-void
-crank_vec_float2_init_from_vb (CrankVecFloat2      *vec,
-                               const CrankVecBool2 *vb)
-{
-  vec->x = vb->x ? 1 : 0;
-  vec->y = vb->y ? 1 : 0;
-}
 
 /**
  * crank_vec_float2_init_from_vi:
@@ -313,14 +291,6 @@ crank_vec_float2_init_from_vb (CrankVecFloat2      *vec,
  *
  * Initialize vector from integer vector.
  */
-void
-crank_vec_float2_init_from_vi (CrankVecFloat2     *vec,
-                               const CrankVecInt2 *vi)
-{
-  vec->x = vi->x;
-  vec->y = vi->y;
-}
-
 
 /**
  * crank_vec_float2_copy:
@@ -329,12 +299,6 @@ crank_vec_float2_init_from_vi (CrankVecFloat2     *vec,
  *
  * Copies vector.
  */
-void
-crank_vec_float2_copy (const CrankVecFloat2 *vec,
-                       CrankVecFloat2       *other)
-{
-  memcpy (other, vec, sizeof(CrankVecFloat2));
-}
 
 /**
  * crank_vec_float2_dup:
@@ -344,11 +308,6 @@ crank_vec_float2_copy (const CrankVecFloat2 *vec,
  *
  * Returns: (transfer full): copied vector
  */
-CrankVecFloat2*
-crank_vec_float2_dup (const CrankVecFloat2 *vec)
-{
-  return (CrankVecFloat2*) g_memdup (vec, sizeof (CrankVecFloat2));
-}
 
 /**
  * crank_vec_float2_get:
@@ -359,12 +318,6 @@ crank_vec_float2_dup (const CrankVecFloat2 *vec)
  *
  * Returns: element on vector.
  */
-gfloat
-crank_vec_float2_get (const CrankVecFloat2 *vec,
-                      const guint           index)
-{
-  return ((gfloat*)vec)[index];
-}
 
 /**
  * crank_vec_float2_set:
@@ -374,13 +327,6 @@ crank_vec_float2_get (const CrankVecFloat2 *vec,
  *
  * Sets element of vector at @index, by @value.
  */
-void
-crank_vec_float2_set (CrankVecFloat2 *vec,
-                      const guint     index,
-                      const gfloat    value)
-{
-  ((gfloat*)vec)[index] = value;
-}
 
 /**
  * crank_vec_float2_foreach:
@@ -394,17 +340,6 @@ crank_vec_float2_set (CrankVecFloat2 *vec,
  *
  * Returns: Whether iteration was stopped.
  */
-gboolean
-crank_vec_float2_foreach (const CrankVecFloat2 *vec,
-                          CrankBoolFloatFunc    func,
-                          gpointer              userdata)
-{
-  if (func (vec->x, userdata) &&
-      func (vec->y, userdata))
-    return TRUE;
-  else
-    return FALSE;
-}
 
 /**
  * crank_vec_float2_iterator:
@@ -413,14 +348,6 @@ crank_vec_float2_foreach (const CrankVecFloat2 *vec,
  *
  * Initialize a iterator for a vector.
  */
-void
-crank_vec_float2_iterator (CrankVecFloat2    *vec,
-                           CrankIterMemFloat *iter)
-{
-  crank_iter_mem_float_init_with_count (iter, (gfloat*)vec, 2);
-}
-
-//////// Basic operation ////////
 
 /**
  * crank_vec_float2_hash:
@@ -431,16 +358,6 @@ crank_vec_float2_iterator (CrankVecFloat2    *vec,
  *
  * Returns: hash value of vector.
  */
-guint
-crank_vec_float2_hash (gconstpointer a)
-{
-  const CrankVecFloat2 *vec = a;
-
-  guint hash;
-  hash = crank_float_hash (&(vec->x));
-  hash = crank_float_hash (&(vec->y)) + hash * 37;
-  return hash;
-}
 
 /**
  * crank_vec_float2_equal:
@@ -451,16 +368,6 @@ crank_vec_float2_hash (gconstpointer a)
  *
  * Returns: whether that the two vectors are same.
  */
-gboolean
-crank_vec_float2_equal (gconstpointer a,
-                        gconstpointer b)
-{
-  CrankVecFloat2 *veca = (CrankVecFloat2*)a;
-  CrankVecFloat2 *vecb = (CrankVecFloat2*)b;
-
-  return ((veca->x == vecb->x) &&
-          (veca->y == vecb->y));
-}
 
 /**
  * crank_vec_float2_equal_delta:
@@ -472,25 +379,6 @@ crank_vec_float2_equal (gconstpointer a,
  *
  * Returns: whether that the two vectors are same.
  */
-gboolean
-crank_vec_float2_equal_delta (gconstpointer a,
-                              gconstpointer b,
-                              const gfloat  d)
-{
-  CrankVecFloat2 *veca = (CrankVecFloat2*)a;
-  CrankVecFloat2 *vecb = (CrankVecFloat2*)b;
-
-  CrankVecFloat2 vecd;
-  gfloat         dm;
-  gfloat         dd;
-
-  crank_vec_float2_sub (vecb, veca, &vecd);
-
-  dm = crank_vec_float2_get_magn_sq (&vecd);
-  dd = d * d;
-
-  return (dm < dd);
-}
 
 /**
  * crank_vec_float2_to_string:
@@ -502,11 +390,6 @@ crank_vec_float2_equal_delta (gconstpointer a,
  *
  * Returns: (transfer full): string representation of value.
  */
-gchar*
-crank_vec_float2_to_string (const CrankVecFloat2 *vec)
-{
-  return crank_vec_float2_to_string_full (vec, "(", ", ", ")", "%g");
-}
 
 /**
  * crank_vec_float2_to_string_full:
@@ -520,31 +403,6 @@ crank_vec_float2_to_string (const CrankVecFloat2 *vec)
  *
  * Returns: (transfer full): stringified items of value.
  */
-gchar*
-crank_vec_float2_to_string_full (const CrankVecFloat2 *vec,
-                                 const gchar    *left,
-                                 const gchar    *in,
-                                 const gchar    *right,
-                                 const gchar    *format)
-{
-  GString *strb = g_string_new (left);
-  gchar *result;
-
-  g_string_append_printf (strb, format, vec->x);
-  g_string_append (strb, in);
-
-  g_string_append_printf (strb, format, vec->y);
-  g_string_append (strb, right);
-
-  result = strb->str;
-
-  g_string_free (strb, FALSE);
-
-  return result;
-}
-
-
-//////// Standard vector property ///////
 
 /**
  * crank_vec_float2_get_magn_sq:
@@ -554,12 +412,6 @@ crank_vec_float2_to_string_full (const CrankVecFloat2 *vec,
  *
  * Returns: square of magn/norm of @vec.
  */
-gfloat
-crank_vec_float2_get_magn_sq (const CrankVecFloat2 *vec)
-{
-  return (vec->x * vec->x) +
-         (vec->y * vec->y);
-}
 
 /**
  * crank_vec_float2_get_magn:
@@ -569,17 +421,6 @@ crank_vec_float2_get_magn_sq (const CrankVecFloat2 *vec)
  *
  * Returns: magn/norm of @vec.
  */
-gfloat
-crank_vec_float2_get_magn (const CrankVecFloat2 *vec)
-{
-  gfloat sq = crank_vec_float2_get_magn_sq (vec);
-  return sqrtf (sq);
-}
-
-
-
-
-//////// Standard unary operations ////////
 
 /**
  * crank_vec_float2_neg:
@@ -588,14 +429,6 @@ crank_vec_float2_get_magn (const CrankVecFloat2 *vec)
  *
  * Applies negation.
  */
-void
-crank_vec_float2_neg (const CrankVecFloat2 *a,
-                      CrankVecFloat2       *r)
-{
-  r->x = -(a->x);
-  r->y = -(a->y);
-}
-
 
 /**
  * crank_vec_float2_neg_self:
@@ -603,13 +436,6 @@ crank_vec_float2_neg (const CrankVecFloat2 *a,
  *
  * Applies negation.
  */
-void
-crank_vec_float2_neg_self (CrankVecFloat2 *a)
-{
-  a->x = -(a->x);
-  a->y = -(a->y);
-}
-
 
 /**
  * crank_vec_float2_unit:
@@ -618,13 +444,6 @@ crank_vec_float2_neg_self (CrankVecFloat2 *a)
  *
  * Gets unit length of vector with same direction of @a
  */
-void
-crank_vec_float2_unit (const CrankVecFloat2 *a,
-                       CrankVecFloat2       *r)
-{
-  crank_vec_float2_divs (a, crank_vec_float2_get_magn (a), r);
-}
-
 
 /**
  * crank_vec_float2_unit_self:
@@ -632,13 +451,6 @@ crank_vec_float2_unit (const CrankVecFloat2 *a,
  *
  * Gets unit length of vector with same direction of @a
  */
-void
-crank_vec_float2_unit_self (CrankVecFloat2 *a)
-{
-  crank_vec_float2_divs_self (a, crank_vec_float2_get_magn (a));
-}
-
-//////// Scalar operations ////////
 
 /**
  * crank_vec_float2_muls:
@@ -648,16 +460,6 @@ crank_vec_float2_unit_self (CrankVecFloat2 *a)
  *
  * Applies scalar multiplication.
  */
-void
-crank_vec_float2_muls (const CrankVecFloat2 *a,
-                       const gfloat          b,
-                       CrankVecFloat2       *r)
-{
-  g_return_if_fail (a != r);
-
-  r->x = a->x * b;
-  r->y = a->y * b;
-}
 
 /**
  * crank_vec_float2_muls_self:
@@ -666,13 +468,6 @@ crank_vec_float2_muls (const CrankVecFloat2 *a,
  *
  * Applies scalar multiplication.
  */
-void
-crank_vec_float2_muls_self (CrankVecFloat2 *a,
-                            const gfloat    b)
-{
-  a->x *= b;
-  a->y *= b;
-}
 
 /**
  * crank_vec_float2_divs:
@@ -682,16 +477,6 @@ crank_vec_float2_muls_self (CrankVecFloat2 *a,
  *
  * Applies scalar division.
  */
-void
-crank_vec_float2_divs (const CrankVecFloat2 *a,
-                       const gfloat          b,
-                       CrankVecFloat2       *r)
-{
-  g_return_if_fail (a != r);
-
-  r->x = a->x / b;
-  r->y = a->y / b;
-}
 
 /**
  * crank_vec_float2_divs_self:
@@ -700,16 +485,6 @@ crank_vec_float2_divs (const CrankVecFloat2 *a,
  *
  * Applies scalar division.
  */
-void
-crank_vec_float2_divs_self (CrankVecFloat2 *a,
-                            const gfloat    b)
-{
-  a->x /= b;
-  a->y /= b;
-}
-
-
-//////// Standard vector operations ////////
 
 /**
  * crank_vec_float2_add:
@@ -719,17 +494,6 @@ crank_vec_float2_divs_self (CrankVecFloat2 *a,
  *
  * Adds two vectors.
  */
-void
-crank_vec_float2_add (const CrankVecFloat2 *a,
-                      const CrankVecFloat2 *b,
-                      CrankVecFloat2       *r)
-{
-  g_return_if_fail (a != r);
-  g_return_if_fail (b != r);
-
-  r->x = a->x + b->x;
-  r->y = a->y + b->y;
-}
 
 /**
  * crank_vec_float2_add_self:
@@ -738,13 +502,6 @@ crank_vec_float2_add (const CrankVecFloat2 *a,
  *
  * Adds two vectors.
  */
-void
-crank_vec_float2_add_self (CrankVecFloat2       *a,
-                           const CrankVecFloat2 *b)
-{
-  a->x += b->x;
-  a->y += b->y;
-}
 
 /**
  * crank_vec_float2_sub:
@@ -754,17 +511,6 @@ crank_vec_float2_add_self (CrankVecFloat2       *a,
  *
  * Subtracts @a by @b.
  */
-void
-crank_vec_float2_sub (const CrankVecFloat2 *a,
-                      const CrankVecFloat2 *b,
-                      CrankVecFloat2       *r)
-{
-  g_return_if_fail (a != r);
-  g_return_if_fail (b != r);
-
-  r->x = a->x - b->x;
-  r->y = a->y - b->y;
-}
 
 /**
  * crank_vec_float2_sub_self:
@@ -773,13 +519,6 @@ crank_vec_float2_sub (const CrankVecFloat2 *a,
  *
  * Subtracts @a by @b.
  */
-void
-crank_vec_float2_sub_self (CrankVecFloat2       *a,
-                           const CrankVecFloat2 *b)
-{
-  a->x -= b->x;
-  a->y -= b->y;
-}
 
 /**
  * crank_vec_float2_dot:
@@ -790,12 +529,6 @@ crank_vec_float2_sub_self (CrankVecFloat2       *a,
  *
  * Returns: dot product of two vectors.
  */
-gfloat
-crank_vec_float2_dot (const CrankVecFloat2 *a,
-                      const CrankVecFloat2 *b)
-{
-  return (a->x) * (b->x) + (a->y) * (b->y);
-}
 
 /**
  * crank_vec_float2_crs:
@@ -806,14 +539,6 @@ crank_vec_float2_dot (const CrankVecFloat2 *a,
  *
  * Returns: Cross product of two vectors, as scalar.
  */
-gfloat
-crank_vec_float2_crs (const CrankVecFloat2 *a,
-                      const CrankVecFloat2 *b)
-{
-  return (a->x) * (b->y) - (a->y) * (b->x);
-}
-
-//////// Component vector operations ////////
 
 /**
  * crank_vec_float2_cmpmul:
@@ -823,17 +548,6 @@ crank_vec_float2_crs (const CrankVecFloat2 *a,
  *
  * Gets component-wise multiplication.
  */
-void
-crank_vec_float2_cmpmul (const CrankVecFloat2 *a,
-                         const CrankVecFloat2 *b,
-                         CrankVecFloat2       *r)
-{
-  g_return_if_fail (a != r);
-  g_return_if_fail (b != r);
-
-  r->x = a->x * b->x;
-  r->y = a->y * b->y;
-}
 
 /**
  * crank_vec_float2_cmpmul_self:
@@ -842,13 +556,6 @@ crank_vec_float2_cmpmul (const CrankVecFloat2 *a,
  *
  * Gets component-wise multiplication.
  */
-void
-crank_vec_float2_cmpmul_self (CrankVecFloat2       *a,
-                              const CrankVecFloat2 *b)
-{
-  a->x *= b->x;
-  a->y *= b->y;
-}
 
 /**
  * crank_vec_float2_cmpdiv:
@@ -858,17 +565,6 @@ crank_vec_float2_cmpmul_self (CrankVecFloat2       *a,
  *
  * Gets component-wise division.
  */
-void
-crank_vec_float2_cmpdiv (const CrankVecFloat2 *a,
-                         const CrankVecFloat2 *b,
-                         CrankVecFloat2       *r)
-{
-  g_return_if_fail (a != r);
-  g_return_if_fail (b != r);
-
-  r->x = a->x / b->x;
-  r->y = a->y / b->y;
-}
 
 /**
  * crank_vec_float2_cmpdiv_self:
@@ -877,13 +573,6 @@ crank_vec_float2_cmpdiv (const CrankVecFloat2 *a,
  *
  * Gets component-wise division.
  */
-void
-crank_vec_float2_cmpdiv_self (CrankVecFloat2       *a,
-                              const CrankVecFloat2 *b)
-{
-  a->x /= b->x;
-  a->y /= b->y;
-}
 
 /**
  * crank_vec_float2_cmpless:
@@ -893,14 +582,6 @@ crank_vec_float2_cmpdiv_self (CrankVecFloat2       *a,
  *
  * Gets each component of @a is less than counterpart of @b
  */
-void
-crank_vec_float2_cmpless (const CrankVecFloat2 *a,
-                          const CrankVecFloat2 *b,
-                          CrankVecBool2        *r)
-{
-  r->x = (a->x) < (b->x);
-  r->y = (a->y) < (b->y);
-}
 
 /**
  * crank_vec_float2_cmpeq:
@@ -910,14 +591,6 @@ crank_vec_float2_cmpless (const CrankVecFloat2 *a,
  *
  * Gets each component of @a equals to counterpart of @b
  */
-void
-crank_vec_float2_cmpeq (const CrankVecFloat2 *a,
-                        const CrankVecFloat2 *b,
-                        CrankVecBool2        *r)
-{
-  r->x = (a->x) == (b->x);
-  r->y = (a->y) == (b->y);
-}
 
 /**
  * crank_vec_float2_cmpgreater:
@@ -927,14 +600,6 @@ crank_vec_float2_cmpeq (const CrankVecFloat2 *a,
  *
  * Gets each component of @a is greater than counterpart of @b
  */
-void
-crank_vec_float2_cmpgreater (const CrankVecFloat2 *a,
-                             const CrankVecFloat2 *b,
-                             CrankVecBool2        *r)
-{
-  r->x = (a->x) > (b->x);
-  r->y = (a->y) > (b->y);
-}
 
 /**
  * crank_vec_float2_cmpcmp:
@@ -944,14 +609,6 @@ crank_vec_float2_cmpgreater (const CrankVecFloat2 *a,
  *
  * Gets compare result of each components.
  */
-void
-crank_vec_float2_cmpcmp (const CrankVecFloat2 *a,
-                         const CrankVecFloat2 *b,
-                         CrankVecInt2         *r)
-{
-  r->x = CMP(a->x, b->x);
-  r->y = CMP(a->y, b->y);
-}
 
 /**
  * crank_vec_float2_min:
@@ -961,17 +618,6 @@ crank_vec_float2_cmpcmp (const CrankVecFloat2 *a,
  *
  * Gets smaller value of each components.
  */
-void
-crank_vec_float2_min (const CrankVecFloat2 *a,
-                      const CrankVecFloat2 *b,
-                      CrankVecFloat2       *r)
-{
-  g_return_if_fail (a != r);
-  g_return_if_fail (b != r);
-
-  r->x = MIN (a->x, b->x);
-  r->y = MIN (a->y, b->y);
-}
 
 /**
  * crank_vec_float2_max:
@@ -981,17 +627,6 @@ crank_vec_float2_min (const CrankVecFloat2 *a,
  *
  * Gets greater value of each components.
  */
-void
-crank_vec_float2_max (const CrankVecFloat2 *a,
-                      const CrankVecFloat2 *b,
-                      CrankVecFloat2       *r)
-{
-  g_return_if_fail (a != r);
-  g_return_if_fail (b != r);
-
-  r->x = MAX (a->x, b->x);
-  r->y = MAX (a->y, b->y);
-}
 
 /**
  * crank_vec_float2_abs:
@@ -1000,16 +635,6 @@ crank_vec_float2_max (const CrankVecFloat2 *a,
  *
  * Gets absolute value of each components.
  */
-void
-crank_vec_float2_abs (const CrankVecFloat2 *a,
-                      CrankVecFloat2       *r)
-{
-  g_return_if_fail (a != r);
-
-  r->x = ABS (a->x);
-  r->y = ABS (a->y);
-}
-
 
 /**
  * crank_vec_float2_abs_self:
@@ -1017,12 +642,6 @@ crank_vec_float2_abs (const CrankVecFloat2 *a,
  *
  * Applys absolute value of each components.
  */
-void
-crank_vec_float2_abs_self (CrankVecFloat2 *a)
-{
-  a->x = ABS (a->x);
-  a->y = ABS (a->y);
-}
 
 /**
  * crank_vec_float2_mulm:
@@ -1032,22 +651,6 @@ crank_vec_float2_abs_self (CrankVecFloat2 *a)
  *
  * Multiplies transpose of vector by matrix. (Vector transpose * Matrix)
  */
-void
-crank_vec_float2_mulm (const CrankVecFloat2 *a,
-                       const CrankMatFloat2 *b,
-                       CrankVecFloat2       *r)
-{
-  gfloat nx, ny;
-
-  g_return_if_fail (a != r);
-
-  nx = (a->x * b->m00) + (a->y * b->m10);
-  ny = (a->x * b->m01) + (a->y * b->m11);
-
-  r->x = nx;
-  r->y = ny;
-}
-
 
 /**
  * crank_vec_float2_mulm_self:
@@ -1056,18 +659,6 @@ crank_vec_float2_mulm (const CrankVecFloat2 *a,
  *
  * Multiplies transpose of vector by matrix. (Vector transpose * Matrix)
  */
-void
-crank_vec_float2_mulm_self (CrankVecFloat2       *a,
-                            const CrankMatFloat2 *b)
-{
-  gfloat nx, ny;
-
-  nx = (a->x * b->m00) + (a->y * b->m10);
-  ny = (a->x * b->m01) + (a->y * b->m11);
-
-  a->x = nx;
-  a->y = ny;
-}
 
 /**
  * crank_vec_float2_mixs:
@@ -1081,21 +672,6 @@ crank_vec_float2_mulm_self (CrankVecFloat2       *a,
  *
  *    (a * (1-c)) + (b * c)
  */
-void
-crank_vec_float2_mixs (const CrankVecFloat2 *a,
-                       const CrankVecFloat2 *b,
-                       const gfloat          c,
-                       CrankVecFloat2       *r)
-{
-  gfloat d = 1.0f - c;
-
-  g_return_if_fail (a != r);
-  g_return_if_fail (b != r);
-
-  r->x = a->x * d + b->x * c;
-  r->y = a->y * d + b->y * c;
-}
-
 
 /**
  * crank_vec_float2_mix:
@@ -1109,93 +685,6 @@ crank_vec_float2_mixs (const CrankVecFloat2 *a,
  *
  *    (a cmpmul c) + (b cmpmul ({1, 1} - c))
  */
-void
-crank_vec_float2_mix (const CrankVecFloat2 *a,
-                      const CrankVecFloat2 *b,
-                      const CrankVecFloat2 *c,
-                      CrankVecFloat2       *r)
-{
-  CrankVecFloat2 d;
-
-  g_return_if_fail (a != r);
-  g_return_if_fail (b != r);
-  g_return_if_fail (c != r);
-
-  d.x = 1.0f - c->x;
-  d.y = 1.0f - c->y;
-
-  r->x = a->x * d.x + b->x * c->x;
-  r->y = a->y * d.y + b->y * c->y;
-}
-
-//////// GValue Transform //////////////////////////////////////////////////////
-
-static void
-crank_vec_float2_transform_from_vb (const GValue *src,
-                                    GValue       *dest)
-{
-  CrankVecFloat2 *vf = g_new (CrankVecFloat2, 1);
-  CrankVecBool2 *vb = (CrankVecBool2*) g_value_get_boxed (src);
-
-  crank_vec_float2_init_from_vb (vf, vb);
-
-  g_value_take_boxed (dest, vf);
-}
-
-static void
-crank_vec_float2_transform_from_vi (const GValue *src,
-                                    GValue       *dest)
-{
-  CrankVecFloat2 *vf = g_new (CrankVecFloat2, 1);
-  CrankVecInt2 *vi = (CrankVecInt2*) g_value_get_boxed (src);
-
-  crank_vec_float2_init_from_vi (vf, vi);
-
-  g_value_take_boxed (dest, vf);
-}
-
-static void
-crank_vec_float2_transform_to_string (const GValue *src,
-                                      GValue       *dest)
-{
-  CrankVecFloat2 *vf = (CrankVecFloat2*) g_value_get_boxed (src);
-  gchar *res = crank_vec_float2_to_string (vf);
-  g_value_take_string (dest, res);
-}
-
-
-
-
-
-
-
-static void crank_vec_float3_transform_from_vb (const GValue *src,
-                                                GValue       *dest);
-
-static void crank_vec_float3_transform_from_vi (const GValue *src,
-                                                GValue       *dest);
-
-static void crank_vec_float3_transform_to_string (const GValue *src,
-                                                  GValue       *dest);
-
-G_DEFINE_BOXED_TYPE_WITH_CODE (
-  CrankVecFloat3,
-  crank_vec_float3,
-  crank_vec_float3_dup,
-  g_free,
-  {
-    g_value_register_transform_func (CRANK_TYPE_VEC_BOOL3,
-                                     g_define_type_id,
-                                     crank_vec_float3_transform_from_vb);
-
-    g_value_register_transform_func (CRANK_TYPE_VEC_INT3,
-                                     g_define_type_id,
-                                     crank_vec_float3_transform_from_vi);
-
-    g_value_register_transform_func (g_define_type_id,
-                                     G_TYPE_STRING,
-                                     crank_vec_float3_transform_to_string);
-  })
 
 /**
  * crank_vec_float3_init:
@@ -1206,16 +695,6 @@ G_DEFINE_BOXED_TYPE_WITH_CODE (
  *
  * Initializes vector with given components.
  */
-void
-crank_vec_float3_init (CrankVecFloat3 *vec,
-                       const gfloat    x,
-                       const gfloat    y,
-                       const gfloat    z)
-{
-  vec->x = x;
-  vec->y = y;
-  vec->z = z;
-}
 
 /**
  * crank_vec_float3_init_arr:
@@ -1224,14 +703,6 @@ crank_vec_float3_init (CrankVecFloat3 *vec,
  *
  * Initializes vector with given array.
  */
-void
-crank_vec_float3_init_arr (CrankVecFloat3 *vec,
-                           const gfloat   *arr)
-{
-  vec->x = arr[0];
-  vec->y = arr[1];
-  vec->z = arr[2];
-}
 
 /**
  * crank_vec_float3_init_valist:
@@ -1240,14 +711,6 @@ crank_vec_float3_init_arr (CrankVecFloat3 *vec,
  *
  * Initializes vector with given array.
  */
-void
-crank_vec_float3_init_valist (CrankVecFloat3 *vec,
-                              va_list         varargs)
-{
-  vec->x = va_arg (varargs, gdouble);
-  vec->y = va_arg (varargs, gdouble);
-  vec->z = va_arg (varargs, gdouble);
-}
 
 /**
  * crank_vec_float3_init_fill:
@@ -1256,14 +719,6 @@ crank_vec_float3_init_valist (CrankVecFloat3 *vec,
  *
  * Initializes vector by filling single value.
  */
-void
-crank_vec_float3_init_fill (CrankVecFloat3 *vec,
-                            const gfloat    fill)
-{
-  vec->x = fill;
-  vec->y = fill;
-  vec->z = fill;
-}
 
 /**
  * crank_vec_float3_init_from_vb:
@@ -1272,14 +727,6 @@ crank_vec_float3_init_fill (CrankVecFloat3 *vec,
  *
  * Initialize vector from boolean vector.
  */
-void
-crank_vec_float3_init_from_vb (CrankVecFloat3      *vec,
-                               const CrankVecBool3 *vb)
-{
-  vec->x = vb->x ? 1 : 0;
-  vec->y = vb->y ? 1 : 0;
-  vec->z = vb->z ? 1 : 0;
-}
 
 /**
  * crank_vec_float3_init_from_vi:
@@ -1288,15 +735,6 @@ crank_vec_float3_init_from_vb (CrankVecFloat3      *vec,
  *
  * Initialize vector from integer vector.
  */
-void
-crank_vec_float3_init_from_vi (CrankVecFloat3     *vec,
-                               const CrankVecInt3 *vi)
-{
-  vec->x = vi->x;
-  vec->y = vi->y;
-  vec->z = vi->z;
-}
-
 
 /**
  * crank_vec_float3_copy:
@@ -1305,12 +743,6 @@ crank_vec_float3_init_from_vi (CrankVecFloat3     *vec,
  *
  * Copies vector.
  */
-void
-crank_vec_float3_copy (const CrankVecFloat3 *vec,
-                       CrankVecFloat3       *other)
-{
-  memcpy (other, vec, sizeof(CrankVecFloat3));
-}
 
 /**
  * crank_vec_float3_dup:
@@ -1320,11 +752,6 @@ crank_vec_float3_copy (const CrankVecFloat3 *vec,
  *
  * Returns: (transfer full): copied vector
  */
-CrankVecFloat3*
-crank_vec_float3_dup (const CrankVecFloat3 *vec)
-{
-  return (CrankVecFloat3*) g_memdup (vec, sizeof (CrankVecFloat3));
-}
 
 /**
  * crank_vec_float3_get:
@@ -1335,12 +762,6 @@ crank_vec_float3_dup (const CrankVecFloat3 *vec)
  *
  * Returns: element on vector.
  */
-gfloat
-crank_vec_float3_get (const CrankVecFloat3 *vec,
-                      const guint           index)
-{
-  return ((gfloat*)vec)[index];
-}
 
 /**
  * crank_vec_float3_set:
@@ -1350,13 +771,6 @@ crank_vec_float3_get (const CrankVecFloat3 *vec,
  *
  * Sets element of vector at @index, by @value.
  */
-void
-crank_vec_float3_set (CrankVecFloat3 *vec,
-                      const guint     index,
-                      const gfloat    value)
-{
-  ((gfloat*)vec)[index] = value;
-}
 
 /**
  * crank_vec_float3_foreach:
@@ -1370,18 +784,6 @@ crank_vec_float3_set (CrankVecFloat3 *vec,
  *
  * Returns: Whether iteration was stopped.
  */
-gboolean
-crank_vec_float3_foreach (const CrankVecFloat3 *vec,
-                          CrankBoolFloatFunc    func,
-                          gpointer              userdata)
-{
-  if (func (vec->x, userdata) &&
-      func (vec->y, userdata) &&
-      func (vec->z, userdata))
-    return TRUE;
-  else
-    return FALSE;
-}
 
 /**
  * crank_vec_float3_iterator:
@@ -1390,15 +792,6 @@ crank_vec_float3_foreach (const CrankVecFloat3 *vec,
  *
  * Initialize a iterator for a vector.
  */
-void
-crank_vec_float3_iterator (CrankVecFloat3    *vec,
-                           CrankIterMemFloat *iter)
-{
-  crank_iter_mem_float_init_with_count (iter, (gfloat*)vec, 3);
-}
-
-
-//////// Basic operation ////////
 
 /**
  * crank_vec_float3_hash:
@@ -1409,17 +802,6 @@ crank_vec_float3_iterator (CrankVecFloat3    *vec,
  *
  * Returns: hash value of vector.
  */
-guint
-crank_vec_float3_hash (gconstpointer a)
-{
-  const CrankVecFloat3 *vec = a;
-  guint hash;
-  hash = crank_float_hash (&(vec->x));
-  hash = crank_float_hash (&(vec->y)) + hash * 37;
-  hash = crank_float_hash (&(vec->z)) + hash * 37;
-
-  return hash;
-}
 
 /**
  * crank_vec_float3_equal:
@@ -1430,17 +812,6 @@ crank_vec_float3_hash (gconstpointer a)
  *
  * Returns: whether that the two vectors are same.
  */
-gboolean
-crank_vec_float3_equal (gconstpointer a,
-                        gconstpointer b)
-{
-  CrankVecFloat3 *veca = (CrankVecFloat3*)a;
-  CrankVecFloat3 *vecb = (CrankVecFloat3*)b;
-
-  return ((veca->x == vecb->x) &&
-          (veca->y == vecb->y) &&
-          (veca->z == vecb->z));
-}
 
 /**
  * crank_vec_float3_equal_delta:
@@ -1452,25 +823,6 @@ crank_vec_float3_equal (gconstpointer a,
  *
  * Returns: whether that the two vectors are same.
  */
-gboolean
-crank_vec_float3_equal_delta (gconstpointer a,
-                              gconstpointer b,
-                              const gfloat  d)
-{
-  CrankVecFloat3 *veca = (CrankVecFloat3*)a;
-  CrankVecFloat3 *vecb = (CrankVecFloat3*)b;
-
-  CrankVecFloat3 vecd;
-  gfloat         dm;
-  gfloat         dd;
-
-  crank_vec_float3_sub (vecb, veca, &vecd);
-
-  dm = crank_vec_float3_get_magn_sq (&vecd);
-  dd = d * d;
-
-  return (dm < dd);
-}
 
 /**
  * crank_vec_float3_to_string:
@@ -1482,11 +834,6 @@ crank_vec_float3_equal_delta (gconstpointer a,
  *
  * Returns: (transfer full): string representation of value.
  */
-gchar*
-crank_vec_float3_to_string (const CrankVecFloat3 *vec)
-{
-  return crank_vec_float3_to_string_full (vec, "(", ", ", ")", "%g");
-}
 
 /**
  * crank_vec_float3_to_string_full:
@@ -1500,34 +847,6 @@ crank_vec_float3_to_string (const CrankVecFloat3 *vec)
  *
  * Returns: (transfer full): stringified items of value.
  */
-gchar*
-crank_vec_float3_to_string_full (const CrankVecFloat3 *vec,
-                                 const gchar          *left,
-                                 const gchar          *in,
-                                 const gchar          *right,
-                                 const gchar          *format)
-{
-  GString *strb = g_string_new (left);
-  gchar *result;
-
-  g_string_append_printf (strb, format, vec->x);
-  g_string_append (strb, in);
-
-  g_string_append_printf (strb, format, vec->y);
-  g_string_append (strb, in);
-
-  g_string_append_printf (strb, format, vec->z);
-  g_string_append (strb, right);
-
-  result = strb->str;
-
-  g_string_free (strb, FALSE);
-
-  return result;
-}
-
-
-//////// Standard vector property ///////
 
 /**
  * crank_vec_float3_get_magn_sq:
@@ -1537,13 +856,6 @@ crank_vec_float3_to_string_full (const CrankVecFloat3 *vec,
  *
  * Returns: square of magn/norm of @vec.
  */
-gfloat
-crank_vec_float3_get_magn_sq (const CrankVecFloat3 *vec)
-{
-  return (vec->x * vec->x) +
-         (vec->y * vec->y) +
-         (vec->z * vec->z);
-}
 
 /**
  * crank_vec_float3_get_magn:
@@ -1553,17 +865,6 @@ crank_vec_float3_get_magn_sq (const CrankVecFloat3 *vec)
  *
  * Returns: magn/norm of @vec.
  */
-gfloat
-crank_vec_float3_get_magn (const CrankVecFloat3 *vec)
-{
-  gfloat sq = crank_vec_float3_get_magn_sq (vec);
-  return sqrtf (sq);
-}
-
-
-
-
-//////// Standard unary operations ////////
 
 /**
  * crank_vec_float3_neg:
@@ -1572,14 +873,6 @@ crank_vec_float3_get_magn (const CrankVecFloat3 *vec)
  *
  * Applies negation.
  */
-void
-crank_vec_float3_neg (const CrankVecFloat3 *a,
-                      CrankVecFloat3       *r)
-{
-  r->x = -(a->x);
-  r->y = -(a->y);
-  r->z = -(a->z);
-}
 
 /**
  * crank_vec_float3_neg_self:
@@ -1587,13 +880,6 @@ crank_vec_float3_neg (const CrankVecFloat3 *a,
  *
  * Applies negation.
  */
-void
-crank_vec_float3_neg_self (CrankVecFloat3 *a)
-{
-  a->x = -(a->x);
-  a->y = -(a->y);
-  a->z = -(a->z);
-}
 
 /**
  * crank_vec_float3_unit:
@@ -1602,12 +888,6 @@ crank_vec_float3_neg_self (CrankVecFloat3 *a)
  *
  * Gets unit length of vector with same direction of @a
  */
-void
-crank_vec_float3_unit (const CrankVecFloat3 *a,
-                       CrankVecFloat3       *r)
-{
-  crank_vec_float3_divs (a, crank_vec_float3_get_magn (a), r);
-}
 
 /**
  * crank_vec_float3_unit_self:
@@ -1615,14 +895,6 @@ crank_vec_float3_unit (const CrankVecFloat3 *a,
  *
  * Gets unit length of vector with same direction of @a
  */
-void
-crank_vec_float3_unit_self (CrankVecFloat3 *a)
-{
-  crank_vec_float3_divs_self (a, crank_vec_float3_get_magn (a));
-}
-
-
-//////// Scalar operations ////////
 
 /**
  * crank_vec_float3_muls:
@@ -1632,17 +904,6 @@ crank_vec_float3_unit_self (CrankVecFloat3 *a)
  *
  * Applies scalar multiplication.
  */
-void
-crank_vec_float3_muls (const CrankVecFloat3 *a,
-                       const gfloat          b,
-                       CrankVecFloat3       *r)
-{
-  g_return_if_fail (a != r);
-
-  r->x = a->x * b;
-  r->y = a->y * b;
-  r->z = a->z * b;
-}
 
 /**
  * crank_vec_float3_muls_self:
@@ -1651,14 +912,6 @@ crank_vec_float3_muls (const CrankVecFloat3 *a,
  *
  * Applies scalar multiplication.
  */
-void
-crank_vec_float3_muls_self (CrankVecFloat3 *a,
-                            const gfloat    b)
-{
-  a->x *= b;
-  a->y *= b;
-  a->z *= b;
-}
 
 /**
  * crank_vec_float3_divs:
@@ -1668,17 +921,6 @@ crank_vec_float3_muls_self (CrankVecFloat3 *a,
  *
  * Applies scalar division.
  */
-void
-crank_vec_float3_divs (const CrankVecFloat3 *a,
-                       const gfloat          b,
-                       CrankVecFloat3       *r)
-{
-  g_return_if_fail (a != r);
-
-  r->x = a->x / b;
-  r->y = a->y / b;
-  r->z = a->z / b;
-}
 
 /**
  * crank_vec_float3_divs_self:
@@ -1687,17 +929,6 @@ crank_vec_float3_divs (const CrankVecFloat3 *a,
  *
  * Applies scalar division.
  */
-void
-crank_vec_float3_divs_self (CrankVecFloat3 *a,
-                            const gfloat    b)
-{
-  a->x /= b;
-  a->y /= b;
-  a->z /= b;
-}
-
-
-//////// Standard vector operations ////////
 
 /**
  * crank_vec_float3_add:
@@ -1707,18 +938,6 @@ crank_vec_float3_divs_self (CrankVecFloat3 *a,
  *
  * Adds two vectors.
  */
-void
-crank_vec_float3_add (const CrankVecFloat3 *a,
-                      const CrankVecFloat3 *b,
-                      CrankVecFloat3       *r)
-{
-  g_return_if_fail (a != r);
-  g_return_if_fail (b != r);
-
-  r->x = a->x + b->x;
-  r->y = a->y + b->y;
-  r->z = a->z + b->z;
-}
 
 /**
  * crank_vec_float3_add_self:
@@ -1727,14 +946,6 @@ crank_vec_float3_add (const CrankVecFloat3 *a,
  *
  * Adds two vectors.
  */
-void
-crank_vec_float3_add_self (CrankVecFloat3       *a,
-                           const CrankVecFloat3 *b)
-{
-  a->x += b->x;
-  a->y += b->y;
-  a->z += b->z;
-}
 
 /**
  * crank_vec_float3_sub:
@@ -1744,18 +955,6 @@ crank_vec_float3_add_self (CrankVecFloat3       *a,
  *
  * Subtracts @a by @b.
  */
-void
-crank_vec_float3_sub (const CrankVecFloat3 *a,
-                      const CrankVecFloat3 *b,
-                      CrankVecFloat3       *r)
-{
-  g_return_if_fail (a != r);
-  g_return_if_fail (b != r);
-
-  r->x = a->x - b->x;
-  r->y = a->y - b->y;
-  r->z = a->z - b->z;
-}
 
 /**
  * crank_vec_float3_sub_self:
@@ -1764,14 +963,6 @@ crank_vec_float3_sub (const CrankVecFloat3 *a,
  *
  * Subtracts @a by @b.
  */
-void
-crank_vec_float3_sub_self (CrankVecFloat3       *a,
-                           const CrankVecFloat3 *b)
-{
-  a->x -= b->x;
-  a->y -= b->y;
-  a->z -= b->z;
-}
 
 /**
  * crank_vec_float3_dot:
@@ -1782,12 +973,6 @@ crank_vec_float3_sub_self (CrankVecFloat3       *a,
  *
  * Returns: dot product of two vectors.
  */
-gfloat
-crank_vec_float3_dot (const CrankVecFloat3 *a,
-                      const CrankVecFloat3 *b)
-{
-  return (a->x) * (b->x) + (a->y) * (b->y) + (a->z) * (b->z);
-}
 
 /**
  * crank_vec_float3_crs:
@@ -1797,26 +982,6 @@ crank_vec_float3_dot (const CrankVecFloat3 *a,
  *
  * Get cross product of two vectors.
  */
-void
-crank_vec_float3_crs (const CrankVecFloat3 *a,
-                      const CrankVecFloat3 *b,
-                      CrankVecFloat3       *r)
-{
-  gfloat nx;
-  gfloat ny;
-  gfloat nz;
-
-  g_return_if_fail (a != r);
-  g_return_if_fail (b != r);
-
-  nx = (a->y * b->z) - (a->z * b->y);
-  ny = (a->z * b->x) - (a->x * b->z);
-  nz = (a->x * b->y) - (a->y * b->x);
-
-  r->x = nx;
-  r->y = ny;
-  r->z = nz;
-}
 
 /**
  * crank_vec_float3_crs_self:
@@ -1825,20 +990,6 @@ crank_vec_float3_crs (const CrankVecFloat3 *a,
  *
  * Get cross product of two vectors.
  */
-void
-crank_vec_float3_crs_self (CrankVecFloat3       *a,
-                           const CrankVecFloat3 *b)
-{
-  gfloat nx = (a->y * b->z) - (a->z * b->y);
-  gfloat ny = (a->z * b->x) - (a->x * b->z);
-  gfloat nz = (a->x * b->y) - (a->y * b->x);
-
-  a->x = nx;
-  a->y = ny;
-  a->z = nz;
-}
-
-//////// Component vector operations ////////
 
 /**
  * crank_vec_float3_cmpmul:
@@ -1848,18 +999,6 @@ crank_vec_float3_crs_self (CrankVecFloat3       *a,
  *
  * Gets component-wise multiplication.
  */
-void
-crank_vec_float3_cmpmul (const CrankVecFloat3 *a,
-                         const CrankVecFloat3 *b,
-                         CrankVecFloat3       *r)
-{
-  g_return_if_fail (a != r);
-  g_return_if_fail (b != r);
-
-  r->x = a->x * b->x;
-  r->y = a->y * b->y;
-  r->z = a->z * b->z;
-}
 
 /**
  * crank_vec_float3_cmpmul_self:
@@ -1868,14 +1007,6 @@ crank_vec_float3_cmpmul (const CrankVecFloat3 *a,
  *
  * Gets component-wise multiplication.
  */
-void
-crank_vec_float3_cmpmul_self (CrankVecFloat3       *a,
-                              const CrankVecFloat3 *b)
-{
-  a->x *= b->x;
-  a->y *= b->y;
-  a->z *= b->z;
-}
 
 /**
  * crank_vec_float3_cmpdiv:
@@ -1885,18 +1016,6 @@ crank_vec_float3_cmpmul_self (CrankVecFloat3       *a,
  *
  * Gets component-wise division.
  */
-void
-crank_vec_float3_cmpdiv (const CrankVecFloat3 *a,
-                         const CrankVecFloat3 *b,
-                         CrankVecFloat3       *r)
-{
-  g_return_if_fail (a != r);
-  g_return_if_fail (b != r);
-
-  r->x = a->x / b->x;
-  r->y = a->y / b->y;
-  r->z = a->z / b->z;
-}
 
 /**
  * crank_vec_float3_cmpdiv_self:
@@ -1905,14 +1024,6 @@ crank_vec_float3_cmpdiv (const CrankVecFloat3 *a,
  *
  * Gets component-wise division.
  */
-void
-crank_vec_float3_cmpdiv_self (CrankVecFloat3       *a,
-                              const CrankVecFloat3 *b)
-{
-  a->x /= b->x;
-  a->y /= b->y;
-  a->z /= b->z;
-}
 
 /**
  * crank_vec_float3_cmpless:
@@ -1922,15 +1033,6 @@ crank_vec_float3_cmpdiv_self (CrankVecFloat3       *a,
  *
  * Gets each component of @a is less than counterpart of @b
  */
-void
-crank_vec_float3_cmpless (const CrankVecFloat3 *a,
-                          const CrankVecFloat3 *b,
-                          CrankVecBool3        *r)
-{
-  r->x = (a->x) < (b->x);
-  r->y = (a->y) < (b->y);
-  r->z = (a->z) < (b->z);
-}
 
 /**
  * crank_vec_float3_cmpeq:
@@ -1940,15 +1042,6 @@ crank_vec_float3_cmpless (const CrankVecFloat3 *a,
  *
  * Gets each component of @a equals to counterpart of @b
  */
-void
-crank_vec_float3_cmpeq (const CrankVecFloat3 *a,
-                        const CrankVecFloat3 *b,
-                        CrankVecBool3        *r)
-{
-  r->x = (a->x) == (b->x);
-  r->y = (a->y) == (b->y);
-  r->z = (a->z) == (b->z);
-}
 
 /**
  * crank_vec_float3_cmpgreater:
@@ -1958,15 +1051,6 @@ crank_vec_float3_cmpeq (const CrankVecFloat3 *a,
  *
  * Gets each component of @a is greater than counterpart of @b
  */
-void
-crank_vec_float3_cmpgreater (const CrankVecFloat3 *a,
-                             const CrankVecFloat3 *b,
-                             CrankVecBool3        *r)
-{
-  r->x = (a->x) > (b->x);
-  r->y = (a->y) > (b->y);
-  r->z = (a->z) > (b->z);
-}
 
 /**
  * crank_vec_float3_cmpcmp:
@@ -1976,15 +1060,6 @@ crank_vec_float3_cmpgreater (const CrankVecFloat3 *a,
  *
  * Gets compare result of each components.
  */
-void
-crank_vec_float3_cmpcmp (const CrankVecFloat3 *a,
-                         const CrankVecFloat3 *b,
-                         CrankVecInt3         *r)
-{
-  r->x = CMP(a->x, b->x);
-  r->y = CMP(a->y, b->y);
-  r->z = CMP(a->z, b->z);
-}
 
 /**
  * crank_vec_float3_min:
@@ -1994,18 +1069,6 @@ crank_vec_float3_cmpcmp (const CrankVecFloat3 *a,
  *
  * Gets smaller value of each components.
  */
-void
-crank_vec_float3_min (const CrankVecFloat3 *a,
-                      const CrankVecFloat3 *b,
-                      CrankVecFloat3       *r)
-{
-  g_return_if_fail (a != r);
-  g_return_if_fail (b != r);
-
-  r->x = MIN (a->x, b->x);
-  r->y = MIN (a->y, b->y);
-  r->z = MIN (a->z, b->z);
-}
 
 /**
  * crank_vec_float3_max:
@@ -2015,18 +1078,6 @@ crank_vec_float3_min (const CrankVecFloat3 *a,
  *
  * Gets greater value of each components.
  */
-void
-crank_vec_float3_max (const CrankVecFloat3 *a,
-                      const CrankVecFloat3 *b,
-                      CrankVecFloat3       *r)
-{
-  g_return_if_fail (a != r);
-  g_return_if_fail (b != r);
-
-  r->x = MAX (a->x, b->x);
-  r->y = MAX (a->y, b->y);
-  r->z = MAX (a->z, b->z);
-}
 
 /**
  * crank_vec_float3_abs:
@@ -2035,17 +1086,6 @@ crank_vec_float3_max (const CrankVecFloat3 *a,
  *
  * Gets absolute value of each components.
  */
-void
-crank_vec_float3_abs (const CrankVecFloat3 *a,
-                      CrankVecFloat3       *r)
-{
-  g_return_if_fail (a != r);
-
-  r->x = ABS (a->x);
-  r->y = ABS (a->y);
-  r->z = ABS (a->z);
-}
-
 
 /**
  * crank_vec_float3_abs_self:
@@ -2053,13 +1093,6 @@ crank_vec_float3_abs (const CrankVecFloat3 *a,
  *
  * Applys absolute value of each components.
  */
-void
-crank_vec_float3_abs_self (CrankVecFloat3 *a)
-{
-  a->x = ABS (a->x);
-  a->y = ABS (a->y);
-  a->z = ABS (a->z);
-}
 
 /**
  * crank_vec_float3_mulm:
@@ -2069,23 +1102,6 @@ crank_vec_float3_abs_self (CrankVecFloat3 *a)
  *
  * Multiplies transpose of vector by matrix. (Vector transpose * Matrix)
  */
-void
-crank_vec_float3_mulm (const CrankVecFloat3 *a,
-                       const CrankMatFloat3 *b,
-                       CrankVecFloat3       *r)
-{
-  gfloat nx, ny, nz;
-
-  g_return_if_fail (a != r);
-
-  nx = (a->x * b->m00) + (a->y * b->m10) + (a->z * b->m20);
-  ny = (a->x * b->m01) + (a->y * b->m11) + (a->z * b->m21);
-  nz = (a->x * b->m02) + (a->y * b->m12) + (a->z * b->m22);
-
-  r->x = nx;
-  r->y = ny;
-  r->z = nz;
-}
 
 /**
  * crank_vec_float3_mulm_self:
@@ -2094,21 +1110,6 @@ crank_vec_float3_mulm (const CrankVecFloat3 *a,
  *
  * Multiplies transpose of vector by matrix. (Vector transpose * Matrix)
  */
-void
-crank_vec_float3_mulm_self (CrankVecFloat3       *a,
-                            const CrankMatFloat3 *b)
-{
-  gfloat nx, ny, nz;
-
-  nx = (a->x * b->m00) + (a->y * b->m10) + (a->z * b->m20);
-  ny = (a->x * b->m01) + (a->y * b->m11) + (a->z * b->m21);
-  nz = (a->x * b->m02) + (a->y * b->m12) + (a->z * b->m22);
-
-  a->x = nx;
-  a->y = ny;
-  a->z = nz;
-}
-
 
 /**
  * crank_vec_float3_mixs:
@@ -2122,24 +1123,6 @@ crank_vec_float3_mulm_self (CrankVecFloat3       *a,
  *
  *    (a * (1-c)) + (b * c)
  */
-void
-crank_vec_float3_mixs (const CrankVecFloat3 *a,
-                       const CrankVecFloat3 *b,
-                       const gfloat          c,
-                       CrankVecFloat3       *r)
-{
-  gfloat d;
-
-  g_return_if_fail (a != r);
-  g_return_if_fail (b != r);
-
-  d = 1.0f - c;
-
-  r->x = a->x * d + b->x * c;
-  r->y = a->y * d + b->y * c;
-  r->z = a->z * d + b->z * c;
-}
-
 
 /**
  * crank_vec_float3_mix:
@@ -2153,95 +1136,85 @@ crank_vec_float3_mixs (const CrankVecFloat3 *a,
  *
  *    (a cmpmul c) + (b cmpmul ({1, 1, 1} - c))
  */
-void
-crank_vec_float3_mix (const CrankVecFloat3 *a,
-                      const CrankVecFloat3 *b,
-                      const CrankVecFloat3 *c,
-                      CrankVecFloat3       *r)
-{
-  CrankVecFloat3 d;
-
-  g_return_if_fail (a != r);
-  g_return_if_fail (b != r);
-  g_return_if_fail (c != r);
-
-  d.x = 1.0f - c->x;
-  d.y = 1.0f - c->y;
-  d.z = 1.0f - c->z;
-
-  r->x = a->x * d.x + b->x * c->x;
-  r->y = a->y * d.y + b->y * c->y;
-  r->z = a->z * d.z + b->z * c->z;
-}
-
-//////// GValue Transform //////////////////////////////////////////////////////
-
-static void
-crank_vec_float3_transform_from_vb (const GValue *src,
-                                    GValue       *dest)
-{
-  CrankVecFloat3 *vf = g_new (CrankVecFloat3, 1);
-  CrankVecBool3 *vb = (CrankVecBool3*) g_value_get_boxed (src);
-
-  crank_vec_float3_init_from_vb (vf, vb);
 
-  g_value_take_boxed (dest, vf);
-}
-
-static void
-crank_vec_float3_transform_from_vi (const GValue *src,
-                                    GValue       *dest)
-{
-  CrankVecFloat3 *vf = g_new (CrankVecFloat3, 1);
-  CrankVecInt3 *vi = (CrankVecInt3*) g_value_get_boxed (src);
-
-  crank_vec_float3_init_from_vi (vf, vi);
-
-  g_value_take_boxed (dest, vf);
-}
-
-static void
-crank_vec_float3_transform_to_string (const GValue *src,
-                                      GValue       *dest)
-{
-  CrankVecFloat3 *vf = (CrankVecFloat3*) g_value_get_boxed (src);
-  gchar *str = crank_vec_float3_to_string (vf);
-
-  g_value_take_string (dest, str);
-}
-
-
-
-
-
-
-static void crank_vec_float4_transform_from_vb (const GValue *src,
-                                                GValue       *dest);
+/**
+ * crank_vec_float3_soa_dot:
+ * @n: Count of vectors.
+ * @ax: (array length=n): X components of first vectors.
+ * @ay: (array length=n): Y components of first vectors.
+ * @az: (array length=n): Z components of first vectors.
+ * @bx: (array length=n): X components of second vectors.
+ * @by: (array length=n): Y components of second vectors.
+ * @bz: (array length=n): Z components of second vectors.
+ * @r: (out caller-allocates) (array length=n): Array to store dot products.
+ *
+ * Gets dot products of @n pairs of vectors, which are stored as separated
+ * streams of components. Several vectors are processed at once, if CPU
+ * supports.
+ */
 
-static void crank_vec_float4_transform_from_vi (const GValue *src,
-                                                GValue       *dest);
+/**
+ * crank_vec_float3_soa_crs:
+ * @n: Count of vectors.
+ * @ax: (array length=n): X components of first vectors.
+ * @ay: (array length=n): Y components of first vectors.
+ * @az: (array length=n): Z components of first vectors.
+ * @bx: (array length=n): X components of second vectors.
+ * @by: (array length=n): Y components of second vectors.
+ * @bz: (array length=n): Z components of second vectors.
+ * @rx: (out caller-allocates) (array length=n): X components of results.
+ * @ry: (out caller-allocates) (array length=n): Y components of results.
+ * @rz: (out caller-allocates) (array length=n): Z components of results.
+ *
+ * Gets cross products of @n pairs of vectors, which are stored as separated
+ * streams of components. Result streams may be same with input streams.
+ */
 
-static void crank_vec_float4_transform_to_string (const GValue *src,
-                                                  GValue       *dest);
+/**
+ * crank_vec_float3_soa_unit:
+ * @n: Count of vectors.
+ * @ax: (array length=n): X components of vectors.
+ * @ay: (array length=n): Y components of vectors.
+ * @az: (array length=n): Z components of vectors.
+ * @rx: (out caller-allocates) (array length=n): X components of results.
+ * @ry: (out caller-allocates) (array length=n): Y components of results.
+ * @rz: (out caller-allocates) (array length=n): Z components of results.
+ *
+ * Normalizes @n vectors, which are stored as separated streams of components.
+ * Result streams may be same with input streams.
+ */
 
-G_DEFINE_BOXED_TYPE_WITH_CODE (
-  CrankVecFloat4,
-  crank_vec_float4,
-  crank_vec_float4_dup,
-  g_free,
-  {
-    g_value_register_transform_func (CRANK_TYPE_VEC_BOOL4,
-                                     g_define_type_id,
-                                     crank_vec_float4_transform_from_vb);
+/**
+ * crank_vec_float3_batch_dot:
+ * @n: Count of vectors.
+ * @a: (array length=n): First vectors.
+ * @b: (array length=n): Second vectors.
+ * @r: (out caller-allocates) (array length=n): Array to store dot products.
+ *
+ * Gets dot products of @n pairs of vectors.
+ *
+ * Vectors are split into streams of components by chunk, and processed by
+ * crank_vec_float3_soa_dot().
+ */
 
-    g_value_register_transform_func (CRANK_TYPE_VEC_INT4,
-                                     g_define_type_id,
-                                     crank_vec_float4_transform_from_vi);
+/**
+ * crank_vec_float3_batch_crs:
+ * @n: Count of vectors.
+ * @a: (array length=n): First vectors.
+ * @b: (array length=n): Second vectors.
+ * @r: (out caller-allocates) (array length=n): Array to store cross products.
+ *
+ * Gets cross products of @n pairs of vectors. @r may be same with @a or @b.
+ */
 
-    g_value_register_transform_func (g_define_type_id,
-                                     G_TYPE_STRING,
-                                     crank_vec_float4_transform_to_string);
-  })
+/**
+ * crank_vec_float3_batch_unit:
+ * @n: Count of vectors.
+ * @a: (array length=n): Vectors.
+ * @r: (out caller-allocates) (array length=n): Array to store unit vectors.
+ *
+ * Normalizes @n vectors. @r may be same with @a.
+ */
 
 /**
  * crank_vec_float4_init:
@@ -2253,18 +1226,6 @@ G_DEFINE_BOXED_TYPE_WITH_CODE (
  *
  * Initializes vector with given components.
  */
-void
-crank_vec_float4_init (CrankVecFloat4 *vec,
-                       const gfloat    x,
-                       const gfloat    y,
-                       const gfloat    z,
-                       const gfloat    w)
-{
-  vec->x = x;
-  vec->y = y;
-  vec->z = z;
-  vec->w = w;
-}
 
 /**
  * crank_vec_float4_init_arr:
@@ -2273,15 +1234,6 @@ crank_vec_float4_init (CrankVecFloat4 *vec,
  *
  * Initializes vector with given array.
  */
-void
-crank_vec_float4_init_arr (CrankVecFloat4 *vec,
-                           const gfloat   *arr)
-{
-  vec->x = arr[0];
-  vec->y = arr[1];
-  vec->z = arr[2];
-  vec->w = arr[3];
-}
 
 /**
  * crank_vec_float4_init_valist:
@@ -2290,15 +1242,6 @@ crank_vec_float4_init_arr (CrankVecFloat4 *vec,
  *
  * Initializes vector with given array.
  */
-void
-crank_vec_float4_init_valist (CrankVecFloat4 *vec,
-                              va_list         varargs)
-{
-  vec->x = va_arg (varargs, gdouble);
-  vec->y = va_arg (varargs, gdouble);
-  vec->z = va_arg (varargs, gdouble);
-  vec->w = va_arg (varargs, gdouble);
-}
 
 /**
  * crank_vec_float4_init_fill:
@@ -2307,15 +1250,6 @@ crank_vec_float4_init_valist (CrankVecFloat4 *vec,
  *
  * Initializes vector by filling single value.
  */
-void
-crank_vec_float4_init_fill (CrankVecFloat4 *vec,
-                            const gfloat    fill)
-{
-  vec->x = fill;
-  vec->y = fill;
-  vec->z = fill;
-  vec->w = fill;
-}
 
 /**
  * crank_vec_float4_init_from_vb:
@@ -2324,15 +1258,6 @@ crank_vec_float4_init_fill (CrankVecFloat4 *vec,
  *
  * Initialize vector from boolean vector.
  */
-void
-crank_vec_float4_init_from_vb (CrankVecFloat4      *vec,
-                               const CrankVecBool4 *vb)
-{
-  vec->x = vb->x ? 1 : 0;
-  vec->y = vb->y ? 1 : 0;
-  vec->z = vb->z ? 1 : 0;
-  vec->w = vb->w ? 1 : 0;
-}
 
 /**
  * crank_vec_float4_init_from_vi:
@@ -2341,16 +1266,6 @@ crank_vec_float4_init_from_vb (CrankVecFloat4      *vec,
  *
  * Initialize vector from integer vector.
  */
-void
-crank_vec_float4_init_from_vi (CrankVecFloat4     *vec,
-                               const CrankVecInt4 *vi)
-{
-  vec->x = vi->x;
-  vec->y = vi->y;
-  vec->z = vi->z;
-  vec->w = vi->w;
-}
-
 
 /**
  * crank_vec_float4_copy:
@@ -2359,12 +1274,6 @@ crank_vec_float4_init_from_vi (CrankVecFloat4     *vec,
  *
  * Copies vector.
  */
-void
-crank_vec_float4_copy (const CrankVecFloat4 *vec,
-                       CrankVecFloat4       *other)
-{
-  memcpy (other, vec, sizeof(CrankVecFloat4));
-}
 
 /**
  * crank_vec_float4_dup:
@@ -2374,11 +1283,6 @@ crank_vec_float4_copy (const CrankVecFloat4 *vec,
  *
  * Returns: (transfer full): copied vector
  */
-CrankVecFloat4*
-crank_vec_float4_dup (const CrankVecFloat4 *vec)
-{
-  return (CrankVecFloat4*) g_memdup (vec, sizeof (CrankVecFloat4));
-}
 
 /**
  * crank_vec_float4_get:
@@ -2389,12 +1293,6 @@ crank_vec_float4_dup (const CrankVecFloat4 *vec)
  *
  * Returns: element on vector.
  */
-gfloat
-crank_vec_float4_get (const CrankVecFloat4 *vec,
-                      const guint           index)
-{
-  return ((gfloat*)vec)[index];
-}
 
 /**
  * crank_vec_float4_set:
@@ -2404,13 +1302,6 @@ crank_vec_float4_get (const CrankVecFloat4 *vec,
  *
  * Sets element of vector at @index, by @value.
  */
-void
-crank_vec_float4_set (CrankVecFloat4 *vec,
-                      const guint     index,
-                      const gfloat    value)
-{
-  ((gfloat*)vec)[index] = value;
-}
 
 /**
  * crank_vec_float4_foreach:
@@ -2424,19 +1315,6 @@ crank_vec_float4_set (CrankVecFloat4 *vec,
  *
  * Returns: Whether iteration was stopped.
  */
-gboolean
-crank_vec_float4_foreach (const CrankVecFloat4 *vec,
-                          CrankBoolFloatFunc    func,
-                          gpointer              userdata)
-{
-  if (func (vec->x, userdata) &&
-      func (vec->y, userdata) &&
-      func (vec->z, userdata) &&
-      func (vec->w, userdata))
-    return TRUE;
-  else
-    return FALSE;
-}
 
 /**
  * crank_vec_float4_iterator:
@@ -2445,15 +1323,6 @@ crank_vec_float4_foreach (const CrankVecFloat4 *vec,
  *
  * Initialize a iterator for a vector.
  */
-void
-crank_vec_float4_iterator (CrankVecFloat4    *vec,
-                           CrankIterMemFloat *iter)
-{
-  crank_iter_mem_float_init_with_count (iter, (gfloat*)vec, 4);
-}
-
-
-//////// Basic operation ////////
 
 /**
  * crank_vec_float4_hash:
@@ -2464,19 +1333,6 @@ crank_vec_float4_iterator (CrankVecFloat4    *vec,
  *
  * Returns: hash value of vector.
  */
-guint
-crank_vec_float4_hash (gconstpointer a)
-{
-  const CrankVecFloat4 *vec = a;
-
-  guint hash;
-  hash = crank_float_hash (&(vec->x));
-  hash = crank_float_hash (&(vec->y)) + hash * 37;
-  hash = crank_float_hash (&(vec->z)) + hash * 37;
-  hash = crank_float_hash (&(vec->w)) + hash * 37;
-
-  return hash;
-}
 
 /**
  * crank_vec_float4_equal:
@@ -2487,18 +1343,6 @@ crank_vec_float4_hash (gconstpointer a)
  *
  * Returns: whether that the two vectors are same.
  */
-gboolean
-crank_vec_float4_equal (gconstpointer a,
-                        gconstpointer b)
-{
-  CrankVecFloat4 *veca = (CrankVecFloat4*)a;
-  CrankVecFloat4 *vecb = (CrankVecFloat4*)b;
-
-  return ((veca->x == vecb->x) &&
-          (veca->y == vecb->y) &&
-          (veca->z == vecb->z) &&
-          (veca->w == vecb->w));
-}
 
 /**
  * crank_vec_float4_equal_delta:
@@ -2510,25 +1354,6 @@ crank_vec_float4_equal (gconstpointer a,
  *
  * Returns: whether that the two vectors are same.
  */
-gboolean
-crank_vec_float4_equal_delta (gconstpointer a,
-                              gconstpointer b,
-                              const gfloat  d)
-{
-  CrankVecFloat4 *veca = (CrankVecFloat4*)a;
-  CrankVecFloat4 *vecb = (CrankVecFloat4*)b;
-
-  CrankVecFloat4 vecd;
-  gfloat         dm;
-  gfloat         dd;
-
-  crank_vec_float4_sub (vecb, veca, &vecd);
-
-  dm = crank_vec_float4_get_magn_sq (&vecd);
-  dd = d * d;
-
-  return (dm < dd);
-}
 
 /**
  * crank_vec_float4_to_string:
@@ -2540,11 +1365,6 @@ crank_vec_float4_equal_delta (gconstpointer a,
  *
  * Returns: (transfer full): string representation of value.
  */
-gchar*
-crank_vec_float4_to_string (const CrankVecFloat4 *vec)
-{
-  return crank_vec_float4_to_string_full (vec, "(", ", ", ")", "%g");
-}
 
 /**
  * crank_vec_float4_to_string_full:
@@ -2558,37 +1378,6 @@ crank_vec_float4_to_string (const CrankVecFloat4 *vec)
  *
  * Returns: (transfer full): stringified items of value.
  */
-gchar*
-crank_vec_float4_to_string_full (const CrankVecFloat4 *vec,
-                                 const gchar          *left,
-                                 const gchar          *in,
-                                 const gchar          *right,
-                                 const gchar          *format)
-{
-  GString *strb = g_string_new (left);
-  gchar *result;
-
-  g_string_append_printf (strb, format, vec->x);
-  g_string_append (strb, in);
-
-  g_string_append_printf (strb, format, vec->y);
-  g_string_append (strb, in);
-
-  g_string_append_printf (strb, format, vec->z);
-  g_string_append (strb, in);
-
-  g_string_append_printf (strb, format, vec->w);
-  g_string_append (strb, right);
-
-  result = strb->str;
-
-  g_string_free (strb, FALSE);
-
-  return result;
-}
-
-
-//////// Standard vector property ///////
 
 /**
  * crank_vec_float4_get_magn_sq:
@@ -2598,14 +1387,6 @@ crank_vec_float4_to_string_full (const CrankVecFloat4 *vec,
  *
  * Returns: square of magn/norm of @vec.
  */
-gfloat
-crank_vec_float4_get_magn_sq (const CrankVecFloat4 *vec)
-{
-  return (vec->x * vec->x) +
-         (vec->y * vec->y) +
-         (vec->z * vec->z) +
-         (vec->w * vec->w);
-}
 
 /**
  * crank_vec_float4_get_magn:
@@ -2615,17 +1396,6 @@ crank_vec_float4_get_magn_sq (const CrankVecFloat4 *vec)
  *
  * Returns: magn/norm of @vec.
  */
-gfloat
-crank_vec_float4_get_magn (const CrankVecFloat4 *vec)
-{
-  gfloat sq = crank_vec_float4_get_magn_sq (vec);
-  return sqrtf (sq);
-}
-
-
-
-
-//////// Standard unary operations ////////
 
 /**
  * crank_vec_float4_neg:
@@ -2634,15 +1404,6 @@ crank_vec_float4_get_magn (const CrankVecFloat4 *vec)
  *
  * Applies negation.
  */
-void
-crank_vec_float4_neg (const CrankVecFloat4 *a,
-                      CrankVecFloat4       *r)
-{
-  r->x = -(a->x);
-  r->y = -(a->y);
-  r->z = -(a->z);
-  r->w = -(a->w);
-}
 
 /**
  * crank_vec_float4_neg_self:
@@ -2650,14 +1411,6 @@ crank_vec_float4_neg (const CrankVecFloat4 *a,
  *
  * Applies negation.
  */
-void
-crank_vec_float4_neg_self (CrankVecFloat4 *a)
-{
-  a->x = -(a->x);
-  a->y = -(a->y);
-  a->z = -(a->z);
-  a->w = -(a->w);
-}
 
 /**
  * crank_vec_float4_unit:
@@ -2666,12 +1419,6 @@ crank_vec_float4_neg_self (CrankVecFloat4 *a)
  *
  * Gets unit length of vector with same direction of @a
  */
-void
-crank_vec_float4_unit (const CrankVecFloat4 *a,
-                       CrankVecFloat4       *r)
-{
-  crank_vec_float4_divs (a, crank_vec_float4_get_magn (a), r);
-}
 
 /**
  * crank_vec_float4_unit_self:
@@ -2679,14 +1426,6 @@ crank_vec_float4_unit (const CrankVecFloat4 *a,
  *
  * Gets unit length of vector with same direction of @a
  */
-void
-crank_vec_float4_unit_self (CrankVecFloat4 *a)
-{
-  crank_vec_float4_divs_self (a, crank_vec_float4_get_magn (a));
-}
-
-
-//////// Scalar operations ////////
 
 /**
  * crank_vec_float4_muls:
@@ -2696,18 +1435,6 @@ crank_vec_float4_unit_self (CrankVecFloat4 *a)
  *
  * Applies scalar multiplication.
  */
-void
-crank_vec_float4_muls (const CrankVecFloat4 *a,
-                       const gfloat          b,
-                       CrankVecFloat4       *r)
-{
-  g_return_if_fail (a != r);
-
-  r->x = a->x * b;
-  r->y = a->y * b;
-  r->z = a->z * b;
-  r->w = a->w * b;
-}
 
 /**
  * crank_vec_float4_muls_self:
@@ -2716,15 +1443,6 @@ crank_vec_float4_muls (const CrankVecFloat4 *a,
  *
  * Applies scalar multiplication.
  */
-void
-crank_vec_float4_muls_self (CrankVecFloat4 *a,
-                            const gfloat    b)
-{
-  a->x *= b;
-  a->y *= b;
-  a->z *= b;
-  a->w *= b;
-}
 
 /**
  * crank_vec_float4_divs:
@@ -2734,18 +1452,6 @@ crank_vec_float4_muls_self (CrankVecFloat4 *a,
  *
  * Applies scalar division.
  */
-void
-crank_vec_float4_divs (const CrankVecFloat4 *a,
-                       const gfloat          b,
-                       CrankVecFloat4       *r)
-{
-  g_return_if_fail (a != r);
-
-  r->x = a->x / b;
-  r->y = a->y / b;
-  r->z = a->z / b;
-  r->w = a->w / b;
-}
 
 /**
  * crank_vec_float4_divs_self:
@@ -2754,18 +1460,6 @@ crank_vec_float4_divs (const CrankVecFloat4 *a,
  *
  * Applies scalar division.
  */
-void
-crank_vec_float4_divs_self (CrankVecFloat4 *a,
-                            const gfloat    b)
-{
-  a->x /= b;
-  a->y /= b;
-  a->z /= b;
-  a->w /= b;
-}
-
-
-//////// Standard vector operations ////////
 
 /**
  * crank_vec_float4_add:
@@ -2775,19 +1469,6 @@ crank_vec_float4_divs_self (CrankVecFloat4 *a,
  *
  * Adds two vectors.
  */
-void
-crank_vec_float4_add (const CrankVecFloat4 *a,
-                      const CrankVecFloat4 *b,
-                      CrankVecFloat4       *r)
-{
-  g_return_if_fail (a != r);
-  g_return_if_fail (b != r);
-
-  r->x = a->x + b->x;
-  r->y = a->y + b->y;
-  r->z = a->z + b->z;
-  r->w = a->w + b->w;
-}
 
 /**
  * crank_vec_float4_add_self:
@@ -2796,15 +1477,6 @@ crank_vec_float4_add (const CrankVecFloat4 *a,
  *
  * Adds two vectors.
  */
-void
-crank_vec_float4_add_self (CrankVecFloat4       *a,
-                           const CrankVecFloat4 *b)
-{
-  a->x += b->x;
-  a->y += b->y;
-  a->z += b->z;
-  a->w += b->w;
-}
 
 /**
  * crank_vec_float4_sub:
@@ -2814,19 +1486,6 @@ crank_vec_float4_add_self (CrankVecFloat4       *a,
  *
  * Subtracts @a by @b.
  */
-void
-crank_vec_float4_sub (const CrankVecFloat4 *a,
-                      const CrankVecFloat4 *b,
-                      CrankVecFloat4       *r)
-{
-  g_return_if_fail (a != r);
-  g_return_if_fail (b != r);
-
-  r->x = a->x - b->x;
-  r->y = a->y - b->y;
-  r->z = a->z - b->z;
-  r->w = a->w - b->w;
-}
 
 /**
  * crank_vec_float4_sub_self:
@@ -2835,15 +1494,6 @@ crank_vec_float4_sub (const CrankVecFloat4 *a,
  *
  * Subtracts @a by @b.
  */
-void
-crank_vec_float4_sub_self (CrankVecFloat4       *a,
-                           const CrankVecFloat4 *b)
-{
-  a->x -= b->x;
-  a->y -= b->y;
-  a->z -= b->z;
-  a->w -= b->w;
-}
 
 /**
  * crank_vec_float4_dot:
@@ -2854,18 +1504,6 @@ crank_vec_float4_sub_self (CrankVecFloat4       *a,
  *
  * Returns: dot product of two vectors.
  */
-gfloat
-crank_vec_float4_dot (const CrankVecFloat4 *a,
-                      const CrankVecFloat4 *b)
-{
-  return (a->x) * (b->x) +
-         (a->y) * (b->y) +
-         (a->z) * (b->z) +
-         (a->w) * (b->w);
-}
-
-
-//////// Component vector operations ////////
 
 /**
  * crank_vec_float4_cmpmul:
@@ -2875,19 +1513,6 @@ crank_vec_float4_dot (const CrankVecFloat4 *a,
  *
  * Gets component-wise multiplication.
  */
-void
-crank_vec_float4_cmpmul (const CrankVecFloat4 *a,
-                         const CrankVecFloat4 *b,
-                         CrankVecFloat4       *r)
-{
-  g_return_if_fail (a != r);
-  g_return_if_fail (b != r);
-
-  r->x = a->x * b->x;
-  r->y = a->y * b->y;
-  r->z = a->z * b->z;
-  r->w = a->w * b->w;
-}
 
 /**
  * crank_vec_float4_cmpmul_self:
@@ -2896,15 +1521,6 @@ crank_vec_float4_cmpmul (const CrankVecFloat4 *a,
  *
  * Gets component-wise multiplication.
  */
-void
-crank_vec_float4_cmpmul_self (CrankVecFloat4       *a,
-                              const CrankVecFloat4 *b)
-{
-  a->x *= b->x;
-  a->y *= b->y;
-  a->z *= b->z;
-  a->w *= b->w;
-}
 
 /**
  * crank_vec_float4_cmpdiv:
@@ -2914,19 +1530,6 @@ crank_vec_float4_cmpmul_self (CrankVecFloat4       *a,
  *
  * Gets component-wise division.
  */
-void
-crank_vec_float4_cmpdiv (const CrankVecFloat4 *a,
-                         const CrankVecFloat4 *b,
-                         CrankVecFloat4       *r)
-{
-  g_return_if_fail (a != r);
-  g_return_if_fail (b != r);
-
-  r->x = a->x / b->x;
-  r->y = a->y / b->y;
-  r->z = a->z / b->z;
-  r->w = a->w / b->w;
-}
 
 /**
  * crank_vec_float4_cmpdiv_self:
@@ -2935,16 +1538,6 @@ crank_vec_float4_cmpdiv (const CrankVecFloat4 *a,
  *
  * Gets component-wise division.
  */
-void
-crank_vec_float4_cmpdiv_self (CrankVecFloat4       *a,
-                              const CrankVecFloat4 *b)
-{
-  a->x /= b->x;
-  a->y /= b->y;
-  a->z /= b->z;
-  a->w /= b->w;
-}
-
 
 /**
  * crank_vec_float4_cmpless:
@@ -2954,16 +1547,6 @@ crank_vec_float4_cmpdiv_self (CrankVecFloat4       *a,
  *
  * Gets each component of @a is less than counterpart of @b
  */
-void
-crank_vec_float4_cmpless (const CrankVecFloat4 *a,
-                          const CrankVecFloat4 *b,
-                          CrankVecBool4        *r)
-{
-  r->x = (a->x) < (b->x);
-  r->y = (a->y) < (b->y);
-  r->z = (a->z) < (b->z);
-  r->w = (a->w) < (b->w);
-}
 
 /**
  * crank_vec_float4_cmpeq:
@@ -2973,16 +1556,6 @@ crank_vec_float4_cmpless (const CrankVecFloat4 *a,
  *
  * Gets each component of @a equals to counterpart of @b
  */
-void
-crank_vec_float4_cmpeq (const CrankVecFloat4 *a,
-                        const CrankVecFloat4 *b,
-                        CrankVecBool4        *r)
-{
-  r->x = (a->x) == (b->x);
-  r->y = (a->y) == (b->y);
-  r->z = (a->z) == (b->z);
-  r->w = (a->w) == (b->w);
-}
 
 /**
  * crank_vec_float4_cmpgreater:
@@ -2992,16 +1565,6 @@ crank_vec_float4_cmpeq (const CrankVecFloat4 *a,
  *
  * Gets each component of @a is greater than counterpart of @b
  */
-void
-crank_vec_float4_cmpgreater (const CrankVecFloat4 *a,
-                             const CrankVecFloat4 *b,
-                             CrankVecBool4        *r)
-{
-  r->x = (a->x) > (b->x);
-  r->y = (a->y) > (b->y);
-  r->z = (a->z) > (b->z);
-  r->w = (a->w) > (b->w);
-}
 
 /**
  * crank_vec_float4_cmpcmp:
@@ -3011,16 +1574,6 @@ crank_vec_float4_cmpgreater (const CrankVecFloat4 *a,
  *
  * Gets compare result of each components.
  */
-void
-crank_vec_float4_cmpcmp (const CrankVecFloat4 *a,
-                         const CrankVecFloat4 *b,
-                         CrankVecInt4         *r)
-{
-  r->x = CMP(a->x, b->x);
-  r->y = CMP(a->y, b->y);
-  r->z = CMP(a->z, b->z);
-  r->w = CMP(a->w, b->w);
-}
 
 /**
  * crank_vec_float4_min:
@@ -3030,19 +1583,6 @@ crank_vec_float4_cmpcmp (const CrankVecFloat4 *a,
  *
  * Gets smaller value of each components.
  */
-void
-crank_vec_float4_min (const CrankVecFloat4 *a,
-                      const CrankVecFloat4 *b,
-                      CrankVecFloat4       *r)
-{
-  g_return_if_fail (a != r);
-  g_return_if_fail (b != r);
-
-  r->x = MIN (a->x, b->x);
-  r->y = MIN (a->y, b->y);
-  r->z = MIN (a->z, b->z);
-  r->w = MIN (a->w, b->w);
-}
 
 /**
  * crank_vec_float4_max:
@@ -3052,19 +1592,6 @@ crank_vec_float4_min (const CrankVecFloat4 *a,
  *
  * Gets greater value of each components.
  */
-void
-crank_vec_float4_max (const CrankVecFloat4 *a,
-                      const CrankVecFloat4 *b,
-                      CrankVecFloat4       *r)
-{
-  g_return_if_fail (a != r);
-  g_return_if_fail (b != r);
-
-  r->x = MAX (a->x, b->x);
-  r->y = MAX (a->y, b->y);
-  r->z = MAX (a->z, b->z);
-  r->w = MAX (a->w, b->w);
-}
 
 /**
  * crank_vec_float4_abs:
@@ -3073,18 +1600,6 @@ crank_vec_float4_max (const CrankVecFloat4 *a,
  *
  * Gets absolute value of each components.
  */
-void
-crank_vec_float4_abs (const CrankVecFloat4 *a,
-                      CrankVecFloat4       *r)
-{
-  g_return_if_fail (a != r);
-
-  r->x = ABS (a->x);
-  r->y = ABS (a->y);
-  r->z = ABS (a->z);
-  r->w = ABS (a->w);
-}
-
 
 /**
  * crank_vec_float4_abs_self:
@@ -3092,15 +1607,6 @@ crank_vec_float4_abs (const CrankVecFloat4 *a,
  *
  * Applys absolute value of each components.
  */
-void
-crank_vec_float4_abs_self (CrankVecFloat4 *a)
-{
-  a->x = ABS (a->x);
-  a->y = ABS (a->y);
-  a->z = ABS (a->z);
-  a->w = ABS (a->w);
-}
-
 
 /**
  * crank_vec_float4_mulm:
@@ -3110,25 +1616,6 @@ crank_vec_float4_abs_self (CrankVecFloat4 *a)
  *
  * Multiplies transpose of vector by matrix. (Vector transpose * Matrix)
  */
-void
-crank_vec_float4_mulm (const CrankVecFloat4 *a,
-                       const CrankMatFloat4 *b,
-                       CrankVecFloat4       *r)
-{
-  gfloat nx, ny, nz, nw;
-
-  g_return_if_fail (a != r);
-
-  nx = (a->x * b->m00) + (a->y * b->m10) + (a->z * b->m20) + (a->w * b->m30);
-  ny = (a->x * b->m01) + (a->y * b->m11) + (a->z * b->m21) + (a->w * b->m31);
-  nz = (a->x * b->m02) + (a->y * b->m12) + (a->z * b->m22) + (a->w * b->m32);
-  nw = (a->x * b->m03) + (a->y * b->m13) + (a->z * b->m23) + (a->w * b->m33);
-
-  r->x = nx;
-  r->y = ny;
-  r->z = nz;
-  r->w = nw;
-}
 
 /**
  * crank_vec_float4_mulm_self:
@@ -3137,22 +1624,6 @@ crank_vec_float4_mulm (const CrankVecFloat4 *a,
  *
  * Multiplies transpose of vector by matrix. (Vector transpose * Matrix)
  */
-void
-crank_vec_float4_mulm_self (CrankVecFloat4       *a,
-                            const CrankMatFloat4 *b)
-{
-  gfloat nx, ny, nz, nw;
-
-  nx = (a->x * b->m00) + (a->y * b->m10) + (a->z * b->m20) + (a->w * b->m30);
-  ny = (a->x * b->m01) + (a->y * b->m11) + (a->z * b->m21) + (a->w * b->m31);
-  nz = (a->x * b->m02) + (a->y * b->m12) + (a->z * b->m22) + (a->w * b->m32);
-  nw = (a->x * b->m03) + (a->y * b->m13) + (a->z * b->m23) + (a->w * b->m33);
-
-  a->x = nx;
-  a->y = ny;
-  a->z = nz;
-  a->w = nw;
-}
 
 /**
  * crank_vec_float4_mixs:
@@ -3166,25 +1637,6 @@ crank_vec_float4_mulm_self (CrankVecFloat4       *a,
  *
  *    (a * (1-c)) + (b * c)
  */
-void
-crank_vec_float4_mixs (const CrankVecFloat4 *a,
-                       const CrankVecFloat4 *b,
-                       const gfloat          c,
-                       CrankVecFloat4       *r)
-{
-  gfloat d;
-
-  g_return_if_fail (a != r);
-  g_return_if_fail (b != r);
-
-  d = 1.0f - c;
-
-  r->x = a->x * d + b->x * c;
-  r->y = a->y * d + b->y * c;
-  r->z = a->z * d + b->z * c;
-  r->w = a->w * d + b->w * c;
-}
-
 
 /**
  * crank_vec_float4_mix:
@@ -3198,118 +1650,6 @@ crank_vec_float4_mixs (const CrankVecFloat4 *a,
  *
  *    (a cmpmul c) + (b cmpmul ({1, 1, 1, 1} - c))
  */
-void
-crank_vec_float4_mix (const CrankVecFloat4 *a,
-                      const CrankVecFloat4 *b,
-                      const CrankVecFloat4 *c,
-                      CrankVecFloat4       *r)
-{
-  CrankVecFloat4 d;
-
-  g_return_if_fail (a != r);
-  g_return_if_fail (b != r);
-  g_return_if_fail (c != r);
-
-  d.x = 1.0f - c->x;
-  d.y = 1.0f - c->y;
-  d.z = 1.0f - c->z;
-  d.w = 1.0f - c->w;
-
-  r->x = a->x * d.x + b->x * c->x;
-  r->y = a->y * d.y + b->y * c->y;
-  r->z = a->z * d.z + b->z * c->z;
-  r->w = a->w * d.w + b->w * c->w;
-}
-
-//////// GValue Transform //////////////////////////////////////////////////////
-
-static void
-crank_vec_float4_transform_from_vb (const GValue *src,
-                                    GValue       *dest)
-{
-  CrankVecFloat4 *vf = g_new (CrankVecFloat4, 1);
-  CrankVecBool4 *vb = (CrankVecBool4*) g_value_get_boxed (src);
-
-  crank_vec_float4_init_from_vb (vf, vb);
-  g_value_take_boxed (dest, vf);
-}
-
-static void
-crank_vec_float4_transform_from_vi (const GValue *src,
-                                    GValue       *dest)
-{
-  CrankVecFloat4 *vf = g_new (CrankVecFloat4, 1);
-  CrankVecInt4 *vi = (CrankVecInt4*) g_value_get_boxed (src);
-
-  crank_vec_float4_init_from_vi (vf, vi);
-  g_value_take_boxed (dest, vf);
-}
-
-static void
-crank_vec_float4_transform_to_string (const GValue *src,
-                                      GValue       *dest)
-{
-  CrankVecFloat4 *vf = (CrankVecFloat4*) g_value_get_boxed (src);
-  gchar *str = crank_vec_float4_to_string (vf);
-
-  g_value_take_string (dest, str);
-}
-
-
-
-
-
-
-
-
-static void crank_vec_float_n_transform_from_vb (const GValue *src,
-                                                 GValue       *dest);
-
-static void crank_vec_float_n_transform_from_vi (const GValue *src,
-                                                 GValue       *dest);
-
-static void crank_vec_float_n_transform_from_v2 (const GValue *src,
-                                                 GValue       *dest);
-
-static void crank_vec_float_n_transform_from_v3 (const GValue *src,
-                                                 GValue       *dest);
-
-static void crank_vec_float_n_transform_from_v4 (const GValue *src,
-                                                 GValue       *dest);
-
-static void crank_vec_float_n_transform_to_string (const GValue *src,
-                                                   GValue       *dest);
-
-G_DEFINE_BOXED_TYPE_WITH_CODE (
-  CrankVecFloatN,
-  crank_vec_float_n,
-  crank_vec_float_n_dup,
-  g_free,
-  {
-    g_value_register_transform_func (CRANK_TYPE_VEC_BOOL_N,
-                                     g_define_type_id,
-                                     crank_vec_float_n_transform_from_vb);
-
-    g_value_register_transform_func (CRANK_TYPE_VEC_INT_N,
-                                     g_define_type_id,
-                                     crank_vec_float_n_transform_from_vi);
-
-    g_value_register_transform_func (CRANK_TYPE_VEC_FLOAT2,
-                                     g_define_type_id,
-                                     crank_vec_float_n_transform_from_v2);
-
-    g_value_register_transform_func (CRANK_TYPE_VEC_FLOAT3,
-                                     g_define_type_id,
-                                     crank_vec_float_n_transform_from_v3);
-
-    g_value_register_transform_func (CRANK_TYPE_VEC_FLOAT4,
-                                     g_define_type_id,
-                                     crank_vec_float_n_transform_from_v4);
-
-    g_value_register_transform_func (g_define_type_id,
-                                     G_TYPE_STRING,
-                                     crank_vec_float_n_transform_to_string);
-  })
 
 /**
  * crank_vec_float_n_init:
@@ -3319,19 +1659,6 @@ G_DEFINE_BOXED_TYPE_WITH_CODE (
  *
  * Initializes vector with given components.
  */
-void
-crank_vec_float_n_init (CrankVecFloatN *vec,
-                        const guint     n,
-                        ...)
-{
-  va_list varargs;
-
-  va_start (varargs, n);
-
-  crank_vec_float_n_init_valist (vec, n, varargs);
-
-  va_end (varargs);
-}
 
 /**
  * crank_vec_float_n_init_arr:
@@ -3341,17 +1668,6 @@ crank_vec_float_n_init (CrankVecFloatN *vec,
  *
  * Initializes vector with given array.
  */
-void
-crank_vec_float_n_init_arr (CrankVecFloatN *vec,
-                            const guint     n,
-                            const gfloat   *arr)
-{
-  guint i;
-
-  CRANK_VEC_ALLOC (vec, gfloat, n);
-  for (i = 0; i < n; i++)
-    vec->data[i] = arr[i];
-}
 
 /**
  * crank_vec_float_n_init_arr_take:
@@ -3361,14 +1677,31 @@ crank_vec_float_n_init_arr (CrankVecFloatN *vec,
  *
  * Initializes vector by taking array as data.
  */
-void
-crank_vec_float_n_init_arr_take (CrankVecFloatN *vec,
-                                 const guint     n,
-                                 gfloat         *arr)
-{
-  vec->n = n;
-  vec->data = arr;
-}
+
+/**
+ * crank_vec_float_n_init_arena:
+ * @vec: (out): Vector to initialize.
+ * @arena: An arena.
+ * @n: Size of vector.
+ *
+ * Initializes vector filled with 0, with data from @arena.
+ *
+ * Data is owned by @arena, so @vec should not be passed to
+ * crank_vec_float_n_fini(), or to functions that reallocate its data.
+ */
+
+/**
+ * crank_vec_float_n_init_arr_arena:
+ * @vec: (out): Vector to initialize.
+ * @arena: An arena.
+ * @n: Size of vector.
+ * @arr: (array length=n): Array that contains elements.
+ *
+ * Initializes vector with given array, with data from @arena.
+ *
+ * Data is owned by @arena, so @vec should not be passed to
+ * crank_vec_float_n_fini(), or to functions that reallocate its data.
+ */
 
 /**
  * crank_vec_float_n_init_valist:
@@ -3378,17 +1711,6 @@ crank_vec_float_n_init_arr_take (CrankVecFloatN *vec,
  *
  * Initializes vector with given array.
  */
-void
-crank_vec_float_n_init_valist (CrankVecFloatN *vec,
-                               const guint     n,
-                               va_list         varargs)
-{
-  guint i;
-
-  CRANK_VEC_ALLOC(vec,gfloat,n);
-  for (i = 0; i < n; i++)
-    vec->data[i] = va_arg (varargs, gdouble);
-}
 
 /**
  * crank_vec_float_n_init_fill:
@@ -3398,17 +1720,6 @@ crank_vec_float_n_init_valist (CrankVecFloatN *vec,
  *
  * Initializes vector by filling single value.
  */
-void
-crank_vec_float_n_init_fill (CrankVecFloatN *vec,
-                             const guint     n,
-                             const gfloat    fill)
-{
-  guint i;
-
-  CRANK_VEC_ALLOC(vec,gfloat,n);
-  for (i = 0; i < n; i++)
-    vec->data[i] = fill;
-}
 
 /**
  * crank_vec_float_n_init_from_vb:
@@ -3417,16 +1728,6 @@ crank_vec_float_n_init_fill (CrankVecFloatN *vec,
  *
  * Initialize vector from boolean vector.
  */
-void
-crank_vec_float_n_init_from_vb (CrankVecFloatN       *vec,
-                                const CrankVecBoolN  *vb)
-{
-  guint i;
-
-  CRANK_VEC_ALLOC(vec,gfloat,vb->n);
-  for (i = 0; i < vb->n; i++)
-    vec->data[i] = vb->data[i] ? 1.0f : 0.0f;
-}
 
 /**
  * crank_vec_float_n_init_from_vi:
@@ -3435,17 +1736,6 @@ crank_vec_float_n_init_from_vb (CrankVecFloatN       *vec,
  *
  * Initialize vector from integer vector.
  */
-void
-crank_vec_float_n_init_from_vi (CrankVecFloatN       *vec,
-                                const CrankVecIntN   *vi)
-{
-  guint i;
-
-  CRANK_VEC_ALLOC(vec,gfloat,vi->n);
-  for (i = 0; i < vi->n; i++)
-    vec->data[i] = vi->data[i];
-}
-
 
 /**
  * crank_vec_float_n_fini:
@@ -3453,14 +1743,6 @@ crank_vec_float_n_init_from_vi (CrankVecFloatN       *vec,
  *
  * Frees all allocated memory and unsets @vec to point 0-sized vector at %NULL.
  */
-void
-crank_vec_float_n_fini (CrankVecFloatN *vec)
-{
-  g_free (vec->data);
-  vec->data = NULL;
-  vec->n = 0;
-}
-
 
 /**
  * crank_vec_float_n_copy:
@@ -3469,12 +1751,6 @@ crank_vec_float_n_fini (CrankVecFloatN *vec)
  *
  * Copies vector.
  */
-void
-crank_vec_float_n_copy (const CrankVecFloatN *vec,
-                        CrankVecFloatN       *other)
-{
-  crank_vec_float_n_init_arr (other, vec->n, vec->data);
-}
 
 /**
  * crank_vec_float_n_dup:
@@ -3484,13 +1760,6 @@ crank_vec_float_n_copy (const CrankVecFloatN *vec,
  *
  * Returns: (transfer full): copied vector
  */
-CrankVecFloatN*
-crank_vec_float_n_dup (const CrankVecFloatN *vec)
-{
-  CrankVecFloatN *result = g_new0 (CrankVecFloatN, 1);
-  crank_vec_float_n_copy (vec, result);
-  return result;
-}
 
 /**
  * crank_vec_float_n_free:
@@ -3498,12 +1767,6 @@ crank_vec_float_n_dup (const CrankVecFloatN *vec)
  *
  * Frees all allocated memory and frees struct too.
  */
-void
-crank_vec_float_n_free (CrankVecFloatN *vec)
-{
-  crank_vec_float_n_fini (vec);
-  g_free (vec);
-}
 
 /**
  * crank_vec_float_n_get_size:
@@ -3513,11 +1776,6 @@ crank_vec_float_n_free (CrankVecFloatN *vec)
  *
  * Returns: Size of vector.
  */
-guint
-crank_vec_float_n_get_size (const CrankVecFloatN *vec)
-{
-  return vec->n;
-}
 
 /**
  * crank_vec_float_n_get:
@@ -3528,12 +1786,6 @@ crank_vec_float_n_get_size (const CrankVecFloatN *vec)
  *
  * Returns: element on vector.
  */
-gfloat
-(crank_vec_float_n_get) (const CrankVecFloatN *vec,
-                         const guint     index)
-{
-  return CRANK_VEC_GET (vec, index);
-}
 
 /**
  * crank_vec_float_n_set:
@@ -3543,13 +1795,6 @@ gfloat
  *
  * Sets element of vector at @index, by @value.
  */
-void
-(crank_vec_float_n_set) (CrankVecFloatN *vec,
-                         const guint     index,
-                         const gfloat    value)
-{
-  CRANK_VEC_SET (vec, index, value);
-}
 
 /**
  * crank_vec_float_n_prepend:
@@ -3558,12 +1803,6 @@ void
  *
  * Prepends an element to vector.
  */
-void
-crank_vec_float_n_prepend (CrankVecFloatN *vec,
-                           const gfloat    value)
-{
-  crank_vec_float_n_insert (vec, 0, value);
-}
 
 /**
  * crank_vec_float_n_append:
@@ -3572,12 +1811,6 @@ crank_vec_float_n_prepend (CrankVecFloatN *vec,
  *
  * Appends an element to vector.
  */
-void
-crank_vec_float_n_append (CrankVecFloatN *vec,
-                          const gfloat    value)
-{
-  crank_vec_float_n_insert (vec, vec->n, value);
-}
 
 /**
  * crank_vec_float_n_insert:
@@ -3587,23 +1820,6 @@ crank_vec_float_n_append (CrankVecFloatN *vec,
  *
  * Inserts an element to vector.
  */
-void
-crank_vec_float_n_insert (CrankVecFloatN *vec,
-                          const guint     index,
-                          const gfloat    value)
-{
-  guint i;
-
-  g_return_if_fail (index <= vec->n);
-
-  vec->n++;
-  vec->data = g_renew (gfloat, vec->data, vec->n);
-
-  for (i = vec->n - 1; index < i; i--)
-    vec->data[i] = vec->data[i - 1];
-
-  vec->data[index] = value;
-}
 
 /**
  * crank_vec_float_n_remove:
@@ -3612,21 +1828,6 @@ crank_vec_float_n_insert (CrankVecFloatN *vec,
  *
  * Removes an element from vector.
  */
-void
-crank_vec_float_n_remove (CrankVecFloatN *vec,
-                          const guint     index)
-{
-  guint i;
-
-  g_return_if_fail (index < vec->n);
-
-  vec->n--;
-
-  for (i = index; i < vec->n; i++)
-    vec->data[i] = vec->data[i + 1];
-
-  vec->data = g_renew (gfloat, vec->data, vec->n);
-}
 
 /**
  * crank_vec_float_n_foreach:
@@ -3640,19 +1841,6 @@ crank_vec_float_n_remove (CrankVecFloatN *vec,
  *
  * Returns: Whether iteration was stopped.
  */
-gboolean
-crank_vec_float_n_foreach (const CrankVecFloatN *vec,
-                           CrankBoolFloatFunc    func,
-                           gpointer              userdata)
-{
-  guint i;
-
-  for (i = 0; i < vec->n; i++)
-    if (!func (vec->data[i], userdata))
-      return FALSE;
-
-  return TRUE;
-}
 
 /**
  * crank_vec_float_n_iterator:
@@ -3661,15 +1849,6 @@ crank_vec_float_n_foreach (const CrankVecFloatN *vec,
  *
  * Initialize a iterator for a vector.
  */
-void
-crank_vec_float_n_iterator (CrankVecFloatN    *vec,
-                            CrankIterMemFloat *iter)
-{
-  crank_iter_mem_float_init_with_count (iter, vec->data, vec->n);
-}
-
-
-//////// Basic operation ////////
 
 /**
  * crank_vec_float_n_hash:
@@ -3680,19 +1859,6 @@ crank_vec_float_n_iterator (CrankVecFloatN    *vec,
  *
  * Returns: hash value of vector.
  */
-guint
-crank_vec_float_n_hash (gconstpointer a)
-{
-  const CrankVecFloatN *vec = a;
-
-  guint i;
-  guint hash = 0;
-
-  for (i = 0; i < vec->n; i++)
-    hash += crank_float_hash (vec->data + i) + hash * 37;
-
-  return hash;
-}
 
 /**
  * crank_vec_float_n_equal:
@@ -3703,29 +1869,6 @@ crank_vec_float_n_hash (gconstpointer a)
  *
  * Returns: whether that the two vectors are same.
  */
-gboolean
-crank_vec_float_n_equal (gconstpointer a,
-                         gconstpointer b)
-{
-  CrankVecFloatN *veca = (CrankVecFloatN*)a;
-  CrankVecFloatN *vecb = (CrankVecFloatN*)b;
-
-  guint n;
-  guint i;
-
-  if (veca->n != vecb->n)
-    return FALSE;
-
-  n = veca->n;
-
-  for (i = 0; i < n; i++)
-    {
-      if (veca->data[i] != vecb->data[i])
-        return FALSE;
-    }
-
-  return TRUE;
-}
 
 /**
  * crank_vec_float_n_equal_delta:
@@ -3737,28 +1880,6 @@ crank_vec_float_n_equal (gconstpointer a,
  *
  * Returns: whether that the two vectors are same.
  */
-gboolean
-crank_vec_float_n_equal_delta (gconstpointer a,
-                               gconstpointer b,
-                               const gfloat  d)
-{
-  CrankVecFloatN *veca = (CrankVecFloatN*)a;
-  CrankVecFloatN *vecb = (CrankVecFloatN*)b;
-
-  CrankVecFloatN vecd;
-  gfloat         dm;
-  gfloat         dd;
-
-  if (veca->n != vecb->n)
-    return FALSE;
-
-  crank_vec_float_n_sub (vecb, veca, &vecd);
-
-  dm = crank_vec_float_n_get_magn_sq (&vecd);
-  dd = d * d;
-
-  return (dm < dd);
-}
 
 /**
  * crank_vec_float_n_to_string:
@@ -3770,11 +1891,6 @@ crank_vec_float_n_equal_delta (gconstpointer a,
  *
  * Returns: (transfer full): string representation of value.
  */
-gchar*
-crank_vec_float_n_to_string (const CrankVecFloatN *vec)
-{
-  return crank_vec_float_n_to_string_full (vec, "(", ", ", ")", "%g");
-}
 
 /**
  * crank_vec_float_n_to_string_full:
@@ -3788,39 +1904,6 @@ crank_vec_float_n_to_string (const CrankVecFloatN *vec)
  *
  * Returns: (transfer full): stringified items of value.
  */
-gchar*
-crank_vec_float_n_to_string_full (const CrankVecFloatN *vec,
-                                  const gchar          *left,
-                                  const gchar          *in,
-                                  const gchar          *right,
-                                  const gchar          *format)
-{
-  GString *strb = g_string_new (left);
-  gchar *result;
-
-  guint i;
-
-  if (vec->n != 0)
-    {
-      g_string_append_printf (strb, format, vec->data[0]);
-
-      for (i = 1; i < vec->n; i++)
-        {
-          g_string_append (strb, in);
-          g_string_append_printf (strb, format, vec->data[i]);
-        }
-    }
-  g_string_append (strb, right);
-
-  result = strb->str;
-
-  g_string_free (strb, FALSE);
-
-  return result;
-}
-
-
-//////// Classification ////////////////////////////////////////////////////////
 
 /**
  * crank_vec_float_n_is_zero:
@@ -3830,19 +1913,6 @@ crank_vec_float_n_to_string_full (const CrankVecFloatN *vec,
  *
  * Returns: Whether the vector is "zero vector".
  */
-gboolean
-crank_vec_float_n_is_zero (const CrankVecFloatN *vec)
-{
-  guint i;
-
-  for (i = 0; i < vec->n; i++)
-    {
-      if (vec->data[i] != 0)
-        return FALSE;
-    }
-
-  return TRUE;
-}
 
 /**
  * crank_vec_float_n_is_one:
@@ -3852,19 +1922,6 @@ crank_vec_float_n_is_zero (const CrankVecFloatN *vec)
  *
  * Returns: Whether the vector has all components as 1.
  */
-gboolean
-crank_vec_float_n_is_one (const CrankVecFloatN *vec)
-{
-  guint i;
-
-  for (i = 0; i < vec->n; i++)
-    {
-      if (vec->data[i] != 1)
-        return FALSE;
-    }
-
-  return TRUE;
-}
 
 /**
  * crank_vec_float_n_is_unit:
@@ -3874,13 +1931,6 @@ crank_vec_float_n_is_one (const CrankVecFloatN *vec)
  *
  * Returns: Whether the magnitude of vector is 1.
  */
-gboolean
-crank_vec_float_n_is_unit (const CrankVecFloatN *vec)
-{
-  gfloat magnsq = crank_vec_float_n_get_magn_sq (vec);
-
-  return (0.9999f <= magnsq) && (magnsq <= 1.0001f);
-}
 
 /**
  * crank_vec_float_n_is_empty:
@@ -3890,11 +1940,6 @@ crank_vec_float_n_is_unit (const CrankVecFloatN *vec)
  *
  * Returns: Whether the vector is empty.
  */
-gboolean
-crank_vec_float_n_is_empty (const CrankVecFloatN *vec)
-{
-  return vec->n == 0;
-}
 
 /**
  * crank_vec_float_n_has_nan:
@@ -3904,18 +1949,6 @@ crank_vec_float_n_is_empty (const CrankVecFloatN *vec)
  *
  * Returns: Whether the vector has NaN.
  */
-gboolean
-crank_vec_float_n_has_nan (const CrankVecFloatN *vec)
-{
-  guint i;
-
-  for (i = 0; i < vec->n; i++)
-    {
-      if (isnanf (vec->data[i]))
-        return TRUE;
-    }
-  return FALSE;
-}
 
 /**
  * crank_vec_float_n_has_inf:
@@ -3925,20 +1958,6 @@ crank_vec_float_n_has_nan (const CrankVecFloatN *vec)
  *
  * Returns: Whether the vector has (inf).
  */
-gboolean
-crank_vec_float_n_has_inf (const CrankVecFloatN *vec)
-{
-  guint i;
-
-  for (i = 0; i < vec->n; i++)
-    {
-      if (isinff (vec->data[i]))
-        return TRUE;
-    }
-  return FALSE;
-}
-
-//////// Standard vector property ///////
 
 /**
  * crank_vec_float_n_get_magn_sq:
@@ -3948,17 +1967,6 @@ crank_vec_float_n_has_inf (const CrankVecFloatN *vec)
  *
  * Returns: square of magn/norm of @vec.
  */
-gfloat
-crank_vec_float_n_get_magn_sq (const CrankVecFloatN *vec)
-{
-  gfloat result = 0;
-  guint i;
-
-  for (i = 0; i < vec->n; i++)
-    result += vec->data[i] * vec->data[i];
-
-  return result;
-}
 
 /**
  * crank_vec_float_n_get_magn:
@@ -3968,17 +1976,6 @@ crank_vec_float_n_get_magn_sq (const CrankVecFloatN *vec)
  *
  * Returns: magn/norm of @vec.
  */
-gfloat
-crank_vec_float_n_get_magn (const CrankVecFloatN *vec)
-{
-  gfloat sq = crank_vec_float_n_get_magn_sq (vec);
-  return sqrtf (sq);
-}
-
-
-
-
-//////// Standard unary operations ////////
 
 /**
  * crank_vec_float_n_neg:
@@ -3987,18 +1984,6 @@ crank_vec_float_n_get_magn (const CrankVecFloatN *vec)
  *
  * Applies negation.
  */
-void
-crank_vec_float_n_neg (const CrankVecFloatN *a,
-                       CrankVecFloatN       *r)
-{
-  guint i;
-
-  CRANK_VEC_ALLOC (r, gfloat, a->n);
-
-  for (i = 0; i < a->n; i++)
-    r->data[i] = a->data[i];
-}
-
 
 /**
  * crank_vec_float_n_neg_self:
@@ -4006,15 +1991,6 @@ crank_vec_float_n_neg (const CrankVecFloatN *a,
  *
  * Applies negation.
  */
-void
-crank_vec_float_n_neg_self (CrankVecFloatN *a)
-{
-  guint i;
-
-  for (i = 0; i < a->n; i++)
-    a->data[i] = -a->data[i];
-}
-
 
 /**
  * crank_vec_float_n_unit:
@@ -4023,13 +1999,6 @@ crank_vec_float_n_neg_self (CrankVecFloatN *a)
  *
  * Gets unit length of vector with same direction of @a
  */
-void
-crank_vec_float_n_unit (const CrankVecFloatN *a,
-                        CrankVecFloatN       *r)
-{
-  crank_vec_float_n_divs (a, crank_vec_float_n_get_magn (a), r);
-}
-
 
 /**
  * crank_vec_float_n_unit_self:
@@ -4037,14 +2006,6 @@ crank_vec_float_n_unit (const CrankVecFloatN *a,
  *
  * Gets unit length of vector with same direction of @a
  */
-void
-crank_vec_float_n_unit_self (CrankVecFloatN *a)
-{
-  crank_vec_float_n_divs_self (a, crank_vec_float_n_get_magn (a));
-}
-
-
-//////// Scalar operations ////////
 
 /**
  * crank_vec_float_n_muls:
@@ -4054,19 +2015,6 @@ crank_vec_float_n_unit_self (CrankVecFloatN *a)
  *
  * Applies scalar multiplication.
  */
-void
-crank_vec_float_n_muls (const CrankVecFloatN *a,
-                        const gfloat          b,
-                        CrankVecFloatN       *r)
-{
-  guint i;
-
-  g_return_if_fail (a != r);
-
-  CRANK_VEC_ALLOC(r,gfloat,a->n);
-  for (i = 0; i < a->n; i++)
-    r->data[i] = a->data[i] * b;
-}
 
 /**
  * crank_vec_float_n_muls_self:
@@ -4075,15 +2023,6 @@ crank_vec_float_n_muls (const CrankVecFloatN *a,
  *
  * Applies scalar multiplication.
  */
-void
-crank_vec_float_n_muls_self (CrankVecFloatN *a,
-                             const gfloat    b)
-{
-  guint i;
-
-  for (i = 0; i < a->n; i++)
-    a->data[i] *= b;
-}
 
 /**
  * crank_vec_float_n_divs:
@@ -4093,19 +2032,6 @@ crank_vec_float_n_muls_self (CrankVecFloatN *a,
  *
  * Applies scalar division.
  */
-void
-crank_vec_float_n_divs (const CrankVecFloatN *a,
-                        const gfloat          b,
-                        CrankVecFloatN       *r)
-{
-  guint i;
-
-  g_return_if_fail (a != r);
-
-  CRANK_VEC_ALLOC(r,gfloat,a->n);
-  for (i = 0; i < a->n; i++)
-    r->data[i] = a->data[i] / b;
-}
 
 /**
  * crank_vec_float_n_divs_self:
@@ -4114,18 +2040,6 @@ crank_vec_float_n_divs (const CrankVecFloatN *a,
  *
  * Applies scalar division.
  */
-void
-crank_vec_float_n_divs_self (CrankVecFloatN *a,
-                             const gfloat    b)
-{
-  guint i;
-
-  for (i = 0; i < a->n; i++)
-    a->data[i] /= b;
-}
-
-
-//////// Standard vector operations ////////
 
 /**
  * crank_vec_float_n_add:
@@ -4135,22 +2049,6 @@ crank_vec_float_n_divs_self (CrankVecFloatN *a,
  *
  * Adds two vectors.
  */
-void
-crank_vec_float_n_add (const CrankVecFloatN *a,
-                       const CrankVecFloatN *b,
-                       CrankVecFloatN       *r)
-{
-  guint i;
-
-  g_return_if_fail (a != r);
-  g_return_if_fail (b != r);
-
-  CRANK_VEC_WARN_IF_SIZE_MISMATCH2 ("VecFloatN", "add", a, b);
-  CRANK_VEC_ALLOC(r, gfloat, a->n);
-
-  for (i = 0; i < a->n; i++)
-    r->data[i] = a->data[i] + b->data[i];
-}
 
 /**
  * crank_vec_float_n_add_self:
@@ -4159,17 +2057,6 @@ crank_vec_float_n_add (const CrankVecFloatN *a,
  *
  * Adds two vectors.
  */
-void
-crank_vec_float_n_add_self (CrankVecFloatN       *a,
-                            const CrankVecFloatN *b)
-{
-  guint i;
-
-  CRANK_VEC_WARN_IF_SIZE_MISMATCH2 ("VecFloatN", "add-self", a, b);
-
-  for (i = 0; i < a->n; i++)
-    a->data[i] += b->data[i];
-}
 
 /**
  * crank_vec_float_n_sub:
@@ -4179,22 +2066,6 @@ crank_vec_float_n_add_self (CrankVecFloatN       *a,
  *
  * Subtracts @a by @b.
  */
-void
-crank_vec_float_n_sub (const CrankVecFloatN *a,
-                       const CrankVecFloatN *b,
-                       CrankVecFloatN       *r)
-{
-  guint i;
-
-  g_return_if_fail (a != r);
-  g_return_if_fail (b != r);
-
-  CRANK_VEC_WARN_IF_SIZE_MISMATCH2 ("VecFloatN", "sub", a, b);
-  CRANK_VEC_ALLOC(r, gfloat, a->n);
-
-  for (i = 0; i < a->n; i++)
-    r->data[i] = a->data[i] - b->data[i];
-}
 
 /**
  * crank_vec_float_n_sub_self:
@@ -4203,17 +2074,6 @@ crank_vec_float_n_sub (const CrankVecFloatN *a,
  *
  * Subtracts @a by @b.
  */
-void
-crank_vec_float_n_sub_self (CrankVecFloatN       *a,
-                            const CrankVecFloatN *b)
-{
-  guint i;
-
-  CRANK_VEC_WARN_IF_SIZE_MISMATCH2 ("VecFloatN", "sub-self", a, b);
-
-  for (i = 0; i < a->n; i++)
-    a->data[i] -= b->data[i];
-}
 
 /**
  * crank_vec_float_n_dot:
@@ -4224,21 +2084,6 @@ crank_vec_float_n_sub_self (CrankVecFloatN       *a,
  *
  * Returns: dot product of two vectors.
  */
-gfloat
-crank_vec_float_n_dot (const CrankVecFloatN *a,
-                       const CrankVecFloatN *b)
-{
-  gfloat result = 0;
-  guint i;
-
-  CRANK_VEC_WARN_IF_SIZE_MISMATCH2_RET ("VecFloatN", "dot", a, b, 0.0f);
-
-  for (i = 0; i < a->n; i++)
-    result += a->data[i] * b->data[i];
-  return result;
-}
-
-//////// Component vector operations ////////
 
 /**
  * crank_vec_float_n_cmpmul:
@@ -4248,22 +2093,6 @@ crank_vec_float_n_dot (const CrankVecFloatN *a,
  *
  * Gets component-wise multiplication.
  */
-void
-crank_vec_float_n_cmpmul (const CrankVecFloatN *a,
-                          const CrankVecFloatN *b,
-                          CrankVecFloatN       *r)
-{
-  guint i;
-
-  g_return_if_fail (a != r);
-  g_return_if_fail (b != r);
-
-  CRANK_VEC_WARN_IF_SIZE_MISMATCH2 ("VecFloatN", "cmpmul", a, b);
-  CRANK_VEC_ALLOC(r, gfloat, a->n);
-
-  for (i = 0; i < a->n; i++)
-    r->data[i] = a->data[i] * b->data[i];
-}
 
 /**
  * crank_vec_float_n_cmpmul_self:
@@ -4272,16 +2101,6 @@ crank_vec_float_n_cmpmul (const CrankVecFloatN *a,
  *
  * Gets component-wise multiplication.
  */
-void
-crank_vec_float_n_cmpmul_self (CrankVecFloatN       *a,
-                               const CrankVecFloatN *b)
-{
-  guint i;
-
-  CRANK_VEC_WARN_IF_SIZE_MISMATCH2 ("VecFloatN", "cmpmul-self", a, b);
-  for (i = 0; i < a->n; i++)
-    a->data[i] *= b->data[i];
-}
 
 /**
  * crank_vec_float_n_cmpdiv:
@@ -4291,22 +2110,6 @@ crank_vec_float_n_cmpmul_self (CrankVecFloatN       *a,
  *
  * Gets component-wise division.
  */
-void
-crank_vec_float_n_cmpdiv (const CrankVecFloatN *a,
-                          const CrankVecFloatN *b,
-                          CrankVecFloatN       *r)
-{
-  guint i;
-
-  g_return_if_fail (a != r);
-  g_return_if_fail (b != r);
-
-  CRANK_VEC_WARN_IF_SIZE_MISMATCH2 ("VecFloatN", "cmpdiv", a, b);
-  CRANK_VEC_ALLOC(r, gfloat, a->n);
-
-  for (i = 0; i < a->n; i++)
-    r->data[i] = a->data[i] / b->data[i];
-}
 
 /**
  * crank_vec_float_n_cmpdiv_self:
@@ -4315,16 +2118,6 @@ crank_vec_float_n_cmpdiv (const CrankVecFloatN *a,
  *
  * Gets component-wise division.
  */
-void
-crank_vec_float_n_cmpdiv_self (CrankVecFloatN       *a,
-                               const CrankVecFloatN *b)
-{
-  guint i;
-
-  CRANK_VEC_WARN_IF_SIZE_MISMATCH2 ("VecFloatN", "cmpdiv-self", a, b);
-  for (i = 0; i < a->n; i++)
-    a->data[i] /= b->data[i];
-}
 
 /**
  * crank_vec_float_n_cmpless:
@@ -4334,19 +2127,6 @@ crank_vec_float_n_cmpdiv_self (CrankVecFloatN       *a,
  *
  * Gets each component of @a is less than counterpart of @b
  */
-void
-crank_vec_float_n_cmpless (const CrankVecFloatN *a,
-                           const CrankVecFloatN *b,
-                           CrankVecBoolN        *r)
-{
-  guint i;
-
-  CRANK_VEC_WARN_IF_SIZE_MISMATCH2 ("VecFloatN", "cmpless", a, b);
-  CRANK_VEC_ALLOC(r, gboolean, a->n);
-
-  for (i = 0; i < a->n; i++)
-    r->data[i] = a->data[i] < b->data[i];
-}
 
 /**
  * crank_vec_float_n_cmpeq:
@@ -4356,19 +2136,6 @@ crank_vec_float_n_cmpless (const CrankVecFloatN *a,
  *
  * Gets each component of @a equals to counterpart of @b
  */
-void
-crank_vec_float_n_cmpeq (const CrankVecFloatN *a,
-                         const CrankVecFloatN *b,
-                         CrankVecBoolN        *r)
-{
-  guint i;
-
-  CRANK_VEC_WARN_IF_SIZE_MISMATCH2 ("VecFloatN", "cmpeq", a, b);
-  CRANK_VEC_ALLOC(r, gboolean, a->n);
-
-  for (i = 0; i < a->n; i++)
-    r->data[i] = a->data[i] == b->data[i];
-}
 
 /**
  * crank_vec_float_n_cmpgreater:
@@ -4378,19 +2145,6 @@ crank_vec_float_n_cmpeq (const CrankVecFloatN *a,
  *
  * Gets each component of @a is greater than counterpart of @b
  */
-void
-crank_vec_float_n_cmpgreater (const CrankVecFloatN *a,
-                              const CrankVecFloatN *b,
-                              CrankVecBoolN        *r)
-{
-  guint i;
-
-  CRANK_VEC_WARN_IF_SIZE_MISMATCH2 ("VecFloatN", "cmpgreater", a, b);
-  CRANK_VEC_ALLOC(r, gboolean, a->n);
-
-  for (i = 0; i < a->n; i++)
-    r->data[i] = a->data[i] > b->data[i];
-}
 
 /**
  * crank_vec_float_n_cmpcmp:
@@ -4400,19 +2154,6 @@ crank_vec_float_n_cmpgreater (const CrankVecFloatN *a,
  *
  * Gets compare result of each components.
  */
-void
-crank_vec_float_n_cmpcmp (const CrankVecFloatN *a,
-                          const CrankVecFloatN *b,
-                          CrankVecIntN         *r)
-{
-  guint i;
-
-  CRANK_VEC_WARN_IF_SIZE_MISMATCH2 ("VecFloatN", "cmpcmp", a, b);
-  CRANK_VEC_ALLOC(r, gint, a->n);
-
-  for (i = 0; i < a->n; i++)
-    r->data[i] = CMP (a->data[i], b->data[i]);
-}
 
 /**
  * crank_vec_float_n_min:
@@ -4422,22 +2163,6 @@ crank_vec_float_n_cmpcmp (const CrankVecFloatN *a,
  *
  * Gets smaller value of each components.
  */
-void
-crank_vec_float_n_min (const CrankVecFloatN *a,
-                       const CrankVecFloatN *b,
-                       CrankVecFloatN       *r)
-{
-  guint i;
-
-  g_return_if_fail (a != r);
-  g_return_if_fail (b != r);
-
-  CRANK_VEC_WARN_IF_SIZE_MISMATCH2 ("VecFloatN", "min", a, b);
-  CRANK_VEC_ALLOC(r, gfloat, a->n);
-
-  for (i = 0; i < a->n; i++)
-    r->data[i] = MIN (a->data[i], b->data[i]);
-}
 
 /**
  * crank_vec_float_n_max:
@@ -4447,23 +2172,6 @@ crank_vec_float_n_min (const CrankVecFloatN *a,
  *
  * Gets greater value of each components.
  */
-void
-crank_vec_float_n_max (const CrankVecFloatN *a,
-                       const CrankVecFloatN *b,
-                       CrankVecFloatN       *r)
-{
-  guint i;
-
-  g_return_if_fail (a != r);
-  g_return_if_fail (b != r);
-
-  CRANK_VEC_WARN_IF_SIZE_MISMATCH2 ("VecFloatN", "max", a, b);
-  CRANK_VEC_ALLOC(r, gfloat, a->n);
-
-  for (i = 0; i < a->n; i++)
-    r->data[i] = MAX (a->data[i], b->data[i]);
-}
-
 
 /**
  * crank_vec_float_n_abs:
@@ -4472,19 +2180,6 @@ crank_vec_float_n_max (const CrankVecFloatN *a,
  *
  * Gets absolute value of each components.
  */
-void
-crank_vec_float_n_abs (const CrankVecFloatN *a,
-                       CrankVecFloatN       *r)
-{
-  guint i;
-
-  g_return_if_fail (a != r);
-
-  CRANK_VEC_ALLOC(r, gfloat, a->n);
-
-  for (i = 0; i < a->n; i++)
-    r->data[i] = ABS (a->data[i]);
-}
 
 /**
  * crank_vec_float_n_abs_self:
@@ -4492,51 +2187,130 @@ crank_vec_float_n_abs (const CrankVecFloatN *a,
  *
  * Gets absolute value of each components.
  */
-void
-crank_vec_float_n_abs_self (CrankVecFloatN *a)
-{
-  guint i;
 
-  for (i = 0; i < a->n; i++)
-    a->data[i] = ABS (a->data[i]);
-}
+/**
+ * crank_vec_float_n_blend:
+ * @a: A vector.
+ * @b: A vector.
+ * @mask: A mask.
+ * @r: (out): A vector to store result.
+ *
+ * Selects components of @b where @mask is %TRUE, and components of @a
+ * elsewhere.
+ */
 
+/**
+ * crank_vec_float_n_cmpblend:
+ * @a: A vector.
+ * @op: Comparison.
+ * @b: A vector.
+ * @x: A vector.
+ * @y: A vector.
+ * @r: (out): A vector to store result.
+ *
+ * Compares components of @a and @b by @op, and selects components of @x where
+ * it holds, and components of @y elsewhere.
+ *
+ * This runs as a single pass, without making intermediate #CrankVecBoolN.
+ */
 
 /**
- * crank_vec_float_n_mulm:
+ * crank_vec_float_n_cmpcount:
  * @a: A vector.
- * @b: A Matrox.
+ * @op: Comparison.
+ * @b: A vector.
+ *
+ * Counts components where comparison of @a and @b by @op holds.
+ *
+ * Returns: Count of components.
+ */
+
+/**
+ * crank_vec_float_n_masked_add:
+ * @a: A vector.
+ * @b: A vector.
+ * @mask: A mask.
  * @r: (out): A vector to store result.
  *
- * Multiplies transpose of vector by matrix. (Vector transpose * Matrix)
+ * Adds components of @b to @a, only where @mask is %TRUE. Other
+ * components are same as @a.
  */
-void
-crank_vec_float_n_mulm (const CrankVecFloatN *a,
-                        const CrankMatFloatN *b,
-                        CrankVecFloatN       *r)
-{
-  g_return_if_fail (a != r);
 
-  if (a->n == b->rn)
-    {
-      guint i;
-      guint j;
-      gfloat *data;
+/**
+ * crank_vec_float_n_masked_add_self:
+ * @a: A vector.
+ * @b: A vector.
+ * @mask: A mask.
+ *
+ * Adds components of @b to @a, only where @mask is %TRUE.
+ */
 
-      data = g_new0 (gfloat, b->cn);
+/**
+ * crank_vec_float_n_masked_mul:
+ * @a: A vector.
+ * @b: A vector.
+ * @mask: A mask.
+ * @r: (out): A vector to store result.
+ *
+ * Multiplies components of @a by @b, only where @mask is %TRUE. Other
+ * components are same as @a.
+ */
 
-      for (i = 0; i < b->cn; i++)
-        for (j = 0; j < a->n; j++)
-          data[i] += a->data[j] * b->data[(b->cn * j) + i];
+/**
+ * crank_vec_float_n_masked_mul_self:
+ * @a: A vector.
+ * @b: A vector.
+ * @mask: A mask.
+ *
+ * Multiplies components of @a by @b, only where @mask is %TRUE.
+ */
 
-      crank_vec_float_n_init_arr_take (r, b->cn, data);
-    }
-  else
-    g_warning ("VecFloatN: mulm: size mismatch: %u, %ux%u", a->n, b->rn, b->cn);
+/**
+ * crank_vec_float_n_compress:
+ * @a: A vector.
+ * @mask: A mask.
+ * @r: (out): A vector to store result.
+ *
+ * Gathers components of @a where @mask is %TRUE, keeping order. Size of @r is
+ * count of %TRUE in @mask.
+ */
 
+/**
+ * crank_vec_float_n_cmpcompress:
+ * @a: A vector.
+ * @op: Comparison.
+ * @b: A vector.
+ * @r: (out): A vector to store result.
+ *
+ * Gathers components of @a where comparison of @a and @b by @op holds,
+ * keeping order.
+ *
+ * This is same as crank_vec_float_n_compress() with result of comparison, but
+ * does not make intermediate #CrankVecBoolN.
+ */
 
-}
+/**
+ * crank_vec_float_n_expand:
+ * @a: A vector.
+ * @mask: A mask.
+ * @fill: A value to fill.
+ * @r: (out): A vector to store result.
+ *
+ * Scatters components of @a in order, to positions where @mask is %TRUE.
+ * Other positions are filled with @fill. Size of @r is same as @mask.
+ *
+ * This is inverse of crank_vec_float_n_compress(). @a should have at least as
+ * many components as %TRUE in @mask.
+ */
 
+/**
+ * crank_vec_float_n_mulm:
+ * @a: A vector.
+ * @b: A Matrox.
+ * @r: (out): A vector to store result.
+ *
+ * Multiplies transpose of vector by matrix. (Vector transpose * Matrix)
+ */
 
 /**
  * crank_vec_float_n_mulm_self:
@@ -4545,31 +2319,6 @@ crank_vec_float_n_mulm (const CrankVecFloatN *a,
  *
  * Multiplies transpose of vector by matrix. (Vector transpose * Matrix)
  */
-void
-crank_vec_float_n_mulm_self (CrankVecFloatN       *a,
-                             const CrankMatFloatN *b)
-{
-  if (a->n == b->rn)
-    {
-      guint i;
-      guint j;
-      gfloat *data;
-
-      data = g_new0 (gfloat, b->cn);
-
-      for (i = 0; i < b->cn; i++)
-        for (j = 0; j < a->n; j++)
-          data[i] += a->data[j] * b->data[(b->cn * j) + i];
-
-      g_free (a->data);
-      crank_vec_float_n_init_arr_take (a, b->cn, data);
-    }
-  else
-    g_warning ("VecFloatN: mulm-self: size mismatch: %u, %ux%u",
-               a->n,
-               b->rn,
-               b->cn);
-}
 
 /**
  * crank_vec_float_n_mixs:
@@ -4583,27 +2332,6 @@ crank_vec_float_n_mulm_self (CrankVecFloatN       *a,
  *
  *    (a * (1-c)) + (b * c)
  */
-void
-crank_vec_float_n_mixs (const CrankVecFloatN *a,
-                        const CrankVecFloatN *b,
-                        const gfloat          c,
-                        CrankVecFloatN       *r)
-{
-  guint i;
-  gfloat d;
-
-  g_return_if_fail (a != r);
-  g_return_if_fail (b != r);
-
-  d = 1.0f - c;
-
-  CRANK_VEC_WARN_IF_SIZE_MISMATCH2 ("VecFloatN", "mixs", a, b);
-  CRANK_VEC_ALLOC(r, gfloat, a->n);
-
-  for (i = 0; i < a->n; i++)
-    r->data[i] = a->data[i] * d + b->data[i] * c;
-}
-
 
 /**
  * crank_vec_float_n_mix:
@@ -4617,93 +2345,3 @@ crank_vec_float_n_mixs (const CrankVecFloatN *a,
  *
  *    (a cmpmul c) + (b cmpmul ({1, 1, ..., 1} - c))
  */
-void
-crank_vec_float_n_mix (const CrankVecFloatN *a,
-                       const CrankVecFloatN *b,
-                       const CrankVecFloatN *c,
-                       CrankVecFloatN       *r)
-{
-  gfloat d;
-  guint i;
-
-  g_return_if_fail (a != r);
-  g_return_if_fail (b != r);
-  g_return_if_fail (c != r);
-
-  CRANK_VEC_WARN_IF_SIZE_MISMATCH3 ("VecFloatN", "mix", a, b, c);
-  CRANK_VEC_ALLOC(r, gfloat, a->n);
-
-  for (i = 0; i < a->n; i++)
-    {
-      d = 1.0f - c->data[i];
-      r->data[i] =    a->data[i] * d + b->data[i] * c->data[i];
-    }
-}
-
-//////// GValue Transform //////////////////////////////////////////////////////
-
-static void
-crank_vec_float_n_transform_from_vb (const GValue *src,
-                                     GValue       *dest)
-{
-  CrankVecFloatN *vf = g_new (CrankVecFloatN, 1);
-  CrankVecBoolN *vb = (CrankVecBoolN*) g_value_get_boxed (src);
-
-  crank_vec_float_n_init_from_vb (vf, vb);
-  g_value_take_boxed (dest, vf);
-}
-
-static void
-crank_vec_float_n_transform_from_vi (const GValue *src,
-                                     GValue       *dest)
-{
-  CrankVecFloatN *vf = g_new (CrankVecFloatN, 1);
-  CrankVecIntN *vi = (CrankVecIntN*) g_value_get_boxed (src);
-
-  crank_vec_float_n_init_from_vi (vf, vi);
-  g_value_take_boxed (dest, vf);
-}
-
-static void
-crank_vec_float_n_transform_from_v2 (const GValue *src,
-                                     GValue       *dest)
-{
-  CrankVecFloatN *vf = g_new (CrankVecFloatN, 1);
-  gfloat *array = (gfloat*) g_value_get_boxed (src);
-
-  crank_vec_float_n_init_arr (vf, 2, array);
-  g_value_take_boxed (dest, vf);
-}
-
-static void
-crank_vec_float_n_transform_from_v3 (const GValue *src,
-                                     GValue       *dest)
-{
-  CrankVecFloatN *vf = g_new (CrankVecFloatN, 1);
-  gfloat *array = (gfloat*) g_value_get_boxed (src);
-
-  crank_vec_float_n_init_arr (vf, 3, array);
-
-  g_value_take_boxed (dest, vf);
-}
-
-static void
-crank_vec_float_n_transform_from_v4 (const GValue *src,
-                                     GValue       *dest)
-{
-  CrankVecFloatN *vf = g_new (CrankVecFloatN, 1);
-  gfloat *array = (gfloat*) g_value_get_boxed (src);
-
-  crank_vec_float_n_init_arr (vf, 4, array);
-
-  g_value_take_boxed (dest, vf);
-}
-
-static void
-crank_vec_float_n_transform_to_string (const GValue *src,
-                                       GValue       *dest)
-{
-  CrankVecFloatN *vf = (CrankVecFloatN*) g_value_get_boxed (src);
-  gchar *str = crank_vec_float_n_to_string (vf);
-  g_value_take_string (dest, str);
-}
@@ -32,6 +32,7 @@
 #include "crankfunction.h"
 #include "crankiter.h"
 #include "crankveccommon.h"
+#include "crankmatarena.h"
 
 G_BEGIN_DECLS
 
@@ -505,9 +506,49 @@ void            crank_vec_float3_mix    (const CrankVecFloat3 *a,
                                          CrankVecFloat3       *r);
 
 
+//////// Batch operations ////////
 
+void            crank_vec_float3_batch_dot  (const guint           n,
+                                             const CrankVecFloat3 *a,
+                                             const CrankVecFloat3 *b,
+                                             gfloat               *r);
+
+void            crank_vec_float3_batch_crs  (const guint           n,
+                                             const CrankVecFloat3 *a,
+                                             const CrankVecFloat3 *b,
+                                             CrankVecFloat3       *r);
 
+void            crank_vec_float3_batch_unit (const guint           n,
+                                             const CrankVecFloat3 *a,
+                                             CrankVecFloat3       *r);
 
+void            crank_vec_float3_soa_dot    (const guint   n,
+                                             const gfloat *ax,
+                                             const gfloat *ay,
+                                             const gfloat *az,
+                                             const gfloat *bx,
+                                             const gfloat *by,
+                                             const gfloat *bz,
+                                             gfloat       *r);
+
+void            crank_vec_float3_soa_crs    (const guint   n,
+                                             const gfloat *ax,
+                                             const gfloat *ay,
+                                             const gfloat *az,
+                                             const gfloat *bx,
+                                             const gfloat *by,
+                                             const gfloat *bz,
+                                             gfloat       *rx,
+                                             gfloat       *ry,
+                                             gfloat       *rz);
+
+void            crank_vec_float3_soa_unit   (const guint   n,
+                                             const gfloat *ax,
+                                             const gfloat *ay,
+                                             const gfloat *az,
+                                             gfloat       *rx,
+                                             gfloat       *ry,
+                                             gfloat       *rz);
 
 /**
  * CrankVecFloat4:
@@ -743,6 +784,15 @@ void            crank_vec_float_n_init_arr_take (CrankVecFloatN *vec,
                                                  const guint     n,
                                                  gfloat         *arr);
 
+void            crank_vec_float_n_init_arena (CrankVecFloatN *vec,
+                                              CrankMatArena  *arena,
+                                              const guint     n);
+
+void            crank_vec_float_n_init_arr_arena (CrankVecFloatN *vec,
+                                                  CrankMatArena  *arena,
+                                                  const guint     n,
+                                                  const gfloat   *arr);
+
 void            crank_vec_float_n_init_valist (CrankVecFloatN *vec,
                                                const guint     n,
                                                va_list         varargs);
@@ -929,6 +979,56 @@ void            crank_vec_float_n_abs   (const CrankVecFloatN *a,
 
 void            crank_vec_float_n_abs_self (CrankVecFloatN *a);
 
+//////// Masked operations ////////
+
+void            crank_vec_float_n_blend           (const CrankVecFloatN *a,
+                                                   const CrankVecFloatN *b,
+                                                   const CrankVecBoolN  *mask,
+                                                   CrankVecFloatN       *r);
+
+void            crank_vec_float_n_cmpblend        (const CrankVecFloatN *a,
+                                                   const CrankVecCmpOp   op,
+                                                   const CrankVecFloatN *b,
+                                                   const CrankVecFloatN *x,
+                                                   const CrankVecFloatN *y,
+                                                   CrankVecFloatN       *r);
+
+guint           crank_vec_float_n_cmpcount        (const CrankVecFloatN *a,
+                                                   const CrankVecCmpOp   op,
+                                                   const CrankVecFloatN *b);
+
+void            crank_vec_float_n_masked_add      (const CrankVecFloatN *a,
+                                                   const CrankVecFloatN *b,
+                                                   const CrankVecBoolN  *mask,
+                                                   CrankVecFloatN       *r);
+
+void            crank_vec_float_n_masked_add_self (CrankVecFloatN       *a,
+                                                   const CrankVecFloatN *b,
+                                                   const CrankVecBoolN  *mask);
+
+void            crank_vec_float_n_masked_mul      (const CrankVecFloatN *a,
+                                                   const CrankVecFloatN *b,
+                                                   const CrankVecBoolN  *mask,
+                                                   CrankVecFloatN       *r);
+
+void            crank_vec_float_n_masked_mul_self (CrankVecFloatN       *a,
+                                                   const CrankVecFloatN *b,
+                                                   const CrankVecBoolN  *mask);
+
+void            crank_vec_float_n_compress        (const CrankVecFloatN *a,
+                                                   const CrankVecBoolN  *mask,
+                                                   CrankVecFloatN       *r);
+
+void            crank_vec_float_n_cmpcompress     (const CrankVecFloatN *a,
+                                                   const CrankVecCmpOp   op,
+                                                   const CrankVecFloatN *b,
+                                                   CrankVecFloatN       *r);
+
+void            crank_vec_float_n_expand          (const CrankVecFloatN *a,
+                                                   const CrankVecBoolN  *mask,
+                                                   const gfloat          fill,
+                                                   CrankVecFloatN       *r);
+
 //////// Matrix operations ////////
 
 void            crank_vec_float_n_mulm  (const CrankVecFloatN *a,
@@ -33,6 +33,8 @@
 #include "crankvecbool.h"
 #include "crankvecint.h"
 
+#include "crankvecmask-private.h"
+
 /**
  * SECTION: crankvecint
  * @title: Integer Vectors
@@ -3877,6 +3879,284 @@ crank_vec_int_n_max (CrankVecIntN *a,
     }
 }
 
+//////// Masked operations ////////
+
+/**
+ * crank_vec_int_n_blend:
+ * @a: A vector.
+ * @b: A vector.
+ * @mask: A mask.
+ * @r: (out): A vector to store result.
+ *
+ * Selects components of @b where @mask is %TRUE, and components of @a
+ * elsewhere.
+ */
+void
+crank_vec_int_n_blend (CrankVecIntN  *a,
+                       CrankVecIntN  *b,
+                       CrankVecBoolN *mask,
+                       CrankVecIntN  *r)
+{
+  g_return_if_fail (a != r);
+  g_return_if_fail (b != r);
+
+  CRANK_VEC_WARN_IF_SIZE_MISMATCH2 ("VecIntN", "blend", a, b);
+  CRANK_VEC_WARN_IF_SIZE_MISMATCH2 ("VecIntN", "blend", a, mask);
+  CRANK_VEC_ALLOC (r, gint, a->n);
+
+  _crank_vec_mask_int_get_kernels ()->blend (a->n, a->data, b->data,
+                                             mask->data, r->data);
+}
+
+/**
+ * crank_vec_int_n_cmpblend:
+ * @a: A vector.
+ * @op: Comparison.
+ * @b: A vector.
+ * @x: A vector.
+ * @y: A vector.
+ * @r: (out): A vector to store result.
+ *
+ * Compares components of @a and @b by @op, and selects components of @x where
+ * it holds, and components of @y elsewhere.
+ *
+ * This runs as a single pass, without making intermediate #CrankVecBoolN.
+ */
+void
+crank_vec_int_n_cmpblend (CrankVecIntN        *a,
+                          const CrankVecCmpOp  op,
+                          CrankVecIntN        *b,
+                          CrankVecIntN        *x,
+                          CrankVecIntN        *y,
+                          CrankVecIntN        *r)
+{
+  g_return_if_fail (a != r);
+  g_return_if_fail (b != r);
+  g_return_if_fail (x != r);
+  g_return_if_fail (y != r);
+
+  CRANK_VEC_WARN_IF_SIZE_MISMATCH2 ("VecIntN", "cmpblend", a, b);
+  CRANK_VEC_WARN_IF_SIZE_MISMATCH2 ("VecIntN", "cmpblend", a, x);
+  CRANK_VEC_WARN_IF_SIZE_MISMATCH2 ("VecIntN", "cmpblend", a, y);
+  CRANK_VEC_ALLOC (r, gint, a->n);
+
+  _crank_vec_mask_int_get_kernels ()->cmpblend (a->n, op, a->data, b->data,
+                                                x->data, y->data, r->data);
+}
+
+/**
+ * crank_vec_int_n_cmpcount:
+ * @a: A vector.
+ * @op: Comparison.
+ * @b: A vector.
+ *
+ * Counts components where comparison of @a and @b by @op holds.
+ *
+ * Returns: Count of components.
+ */
+guint
+crank_vec_int_n_cmpcount (CrankVecIntN        *a,
+                          const CrankVecCmpOp  op,
+                          CrankVecIntN        *b)
+{
+  CRANK_VEC_WARN_IF_SIZE_MISMATCH2_RET ("VecIntN", "cmpcount", a, b, 0);
+
+  return _crank_vec_mask_int_get_kernels ()->cmpcount (a->n, op, a->data,
+                                                       b->data);
+}
+
+/**
+ * crank_vec_int_n_masked_add:
+ * @a: A vector.
+ * @b: A vector.
+ * @mask: A mask.
+ * @r: (out): A vector to store result.
+ *
+ * Adds components of @b to @a, only where @mask is %TRUE. Other
+ * components are same as @a.
+ */
+void
+crank_vec_int_n_masked_add (CrankVecIntN  *a,
+                            CrankVecIntN  *b,
+                            CrankVecBoolN *mask,
+                            CrankVecIntN  *r)
+{
+  g_return_if_fail (a != r);
+  g_return_if_fail (b != r);
+
+  CRANK_VEC_WARN_IF_SIZE_MISMATCH2 ("VecIntN", "masked-add", a, b);
+  CRANK_VEC_WARN_IF_SIZE_MISMATCH2 ("VecIntN", "masked-add", a, mask);
+  CRANK_VEC_ALLOC (r, gint, a->n);
+
+  _crank_vec_mask_int_get_kernels ()->masked_add (a->n, a->data, b->data,
+                                                  mask->data, r->data);
+}
+
+/**
+ * crank_vec_int_n_masked_add_self:
+ * @a: A vector.
+ * @b: A vector.
+ * @mask: A mask.
+ *
+ * Adds components of @b to @a, only where @mask is %TRUE.
+ */
+void
+crank_vec_int_n_masked_add_self (CrankVecIntN  *a,
+                                 CrankVecIntN  *b,
+                                 CrankVecBoolN *mask)
+{
+  CRANK_VEC_WARN_IF_SIZE_MISMATCH2 ("VecIntN", "masked-add-self", a, b);
+  CRANK_VEC_WARN_IF_SIZE_MISMATCH2 ("VecIntN", "masked-add-self", a, mask);
+
+  _crank_vec_mask_int_get_kernels ()->masked_add (a->n, a->data, b->data,
+                                                  mask->data, a->data);
+}
+
+/**
+ * crank_vec_int_n_masked_mul:
+ * @a: A vector.
+ * @b: A vector.
+ * @mask: A mask.
+ * @r: (out): A vector to store result.
+ *
+ * Multiplies components of @a by @b, only where @mask is %TRUE. Other
+ * components are same as @a.
+ */
+void
+crank_vec_int_n_masked_mul (CrankVecIntN  *a,
+                            CrankVecIntN  *b,
+                            CrankVecBoolN *mask,
+                            CrankVecIntN  *r)
+{
+  g_return_if_fail (a != r);
+  g_return_if_fail (b != r);
+
+  CRANK_VEC_WARN_IF_SIZE_MISMATCH2 ("VecIntN", "masked-mul", a, b);
+  CRANK_VEC_WARN_IF_SIZE_MISMATCH2 ("VecIntN", "masked-mul", a, mask);
+  CRANK_VEC_ALLOC (r, gint, a->n);
+
+  _crank_vec_mask_int_get_kernels ()->masked_mul (a->n, a->data, b->data,
+                                                  mask->data, r->data);
+}
+
+/**
+ * crank_vec_int_n_masked_mul_self:
+ * @a: A vector.
+ * @b: A vector.
+ * @mask: A mask.
+ *
+ * Multiplies components of @a by @b, only where @mask is %TRUE.
+ */
+void
+crank_vec_int_n_masked_mul_self (CrankVecIntN  *a,
+                                 CrankVecIntN  *b,
+                                 CrankVecBoolN *mask)
+{
+  CRANK_VEC_WARN_IF_SIZE_MISMATCH2 ("VecIntN", "masked-mul-self", a, b);
+  CRANK_VEC_WARN_IF_SIZE_MISMATCH2 ("VecIntN", "masked-mul-self", a, mask);
+
+  _crank_vec_mask_int_get_kernels ()->masked_mul (a->n, a->data, b->data,
+                                                  mask->data, a->data);
+}
+
+/**
+ * crank_vec_int_n_compress:
+ * @a: A vector.
+ * @mask: A mask.
+ * @r: (out): A vector to store result.
+ *
+ * Gathers components of @a where @mask is %TRUE, keeping order. Size of @r is
+ * count of %TRUE in @mask.
+ */
+void
+crank_vec_int_n_compress (CrankVecIntN  *a,
+                          CrankVecBoolN *mask,
+                          CrankVecIntN  *r)
+{
+  guint count;
+
+  g_return_if_fail (a != r);
+
+  CRANK_VEC_WARN_IF_SIZE_MISMATCH2 ("VecIntN", "compress", a, mask);
+
+  count = crank_vec_bool_n_get_count (mask);
+  CRANK_VEC_ALLOC (r, gint, count);
+
+  _crank_vec_mask_int_get_kernels ()->compress (a->n, a->data, mask->data,
+                                                r->data);
+}
+
+/**
+ * crank_vec_int_n_cmpcompress:
+ * @a: A vector.
+ * @op: Comparison.
+ * @b: A vector.
+ * @r: (out): A vector to store result.
+ *
+ * Gathers components of @a where comparison of @a and @b by @op holds,
+ * keeping order.
+ *
+ * This is same as crank_vec_int_n_compress() with result of comparison, but
+ * does not make intermediate #CrankVecBoolN.
+ */
+void
+crank_vec_int_n_cmpcompress (CrankVecIntN        *a,
+                             const CrankVecCmpOp  op,
+                             CrankVecIntN        *b,
+                             CrankVecIntN        *r)
+{
+  guint count;
+
+  g_return_if_fail (a != r);
+  g_return_if_fail (b != r);
+
+  CRANK_VEC_WARN_IF_SIZE_MISMATCH2 ("VecIntN", "cmpcompress", a, b);
+
+  count = _crank_vec_mask_int_get_kernels ()->cmpcount (a->n, op, a->data,
+                                                        b->data);
+  CRANK_VEC_ALLOC (r, gint, count);
+
+  _crank_vec_mask_int_get_kernels ()->cmpcompress (a->n, op, a->data, b->data,
+                                                   r->data);
+}
+
+/**
+ * crank_vec_int_n_expand:
+ * @a: A vector.
+ * @mask: A mask.
+ * @fill: A value to fill.
+ * @r: (out): A vector to store result.
+ *
+ * Scatters components of @a in order, to positions where @mask is %TRUE.
+ * Other positions are filled with @fill. Size of @r is same as @mask.
+ *
+ * This is inverse of crank_vec_int_n_compress(). @a should have at least as
+ * many components as %TRUE in @mask.
+ */
+void
+crank_vec_int_n_expand (CrankVecIntN  *a,
+                        CrankVecBoolN *mask,
+                        const gint     fill,
+                        CrankVecIntN  *r)
+{
+  guint count;
+
+  g_return_if_fail (a != r);
+
+  count = crank_vec_bool_n_get_count (mask);
+
+  if (G_UNLIKELY (a->n < count))
+    {
+      g_warning ("VecIntN: expand: size mismatch: %u, %u", a->n, count);
+      return;
+    }
+
+  CRANK_VEC_ALLOC (r, gint, mask->n);
+
+  _crank_vec_mask_int_get_kernels ()->expand (mask->n, a->data, mask->data,
+                                              fill, r->data);
+}
+
 //////// GValue Transformation /////////////////////////////////////////////////
 
 static void
@@ -781,6 +781,56 @@ void          crank_vec_int_n_max (CrankVecIntN *a,
                                    CrankVecIntN *b,
                                    CrankVecIntN *r);
 
+//////// Masked operations ////////
+
+void          crank_vec_int_n_blend           (CrankVecIntN  *a,
+                                               CrankVecIntN  *b,
+                                               CrankVecBoolN *mask,
+                                               CrankVecIntN  *r);
+
+void          crank_vec_int_n_cmpblend        (CrankVecIntN        *a,
+                                               const CrankVecCmpOp  op,
+                                               CrankVecIntN        *b,
+                                               CrankVecIntN        *x,
+                                               CrankVecIntN        *y,
+                                               CrankVecIntN        *r);
+
+guint         crank_vec_int_n_cmpcount        (CrankVecIntN        *a,
+                                               const CrankVecCmpOp  op,
+                                               CrankVecIntN        *b);
+
+void          crank_vec_int_n_masked_add      (CrankVecIntN  *a,
+                                               CrankVecIntN  *b,
+                                               CrankVecBoolN *mask,
+                                               CrankVecIntN  *r);
+
+void          crank_vec_int_n_masked_add_self (CrankVecIntN  *a,
+                                               CrankVecIntN  *b,
+                                               CrankVecBoolN *mask);
+
+void          crank_vec_int_n_masked_mul      (CrankVecIntN  *a,
+                                               CrankVecIntN  *b,
+                                               CrankVecBoolN *mask,
+                                               CrankVecIntN  *r);
+
+void          crank_vec_int_n_masked_mul_self (CrankVecIntN  *a,
+                                               CrankVecIntN  *b,
+                                               CrankVecBoolN *mask);
+
+void          crank_vec_int_n_compress        (CrankVecIntN  *a,
+                                               CrankVecBoolN *mask,
+                                               CrankVecIntN  *r);
+
+void          crank_vec_int_n_cmpcompress     (CrankVecIntN        *a,
+                                               const CrankVecCmpOp  op,
+                                               CrankVecIntN        *b,
+                                               CrankVecIntN        *r);
+
+void          crank_vec_int_n_expand          (CrankVecIntN  *a,
+                                               CrankVecBoolN *mask,
+                                               const gint     fill,
+                                               CrankVecIntN  *r);
+
 
 
 G_END_DECLS
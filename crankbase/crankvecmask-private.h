@@ -0,0 +1,241 @@
+#ifndef CRANKVECMASK_PRIVATE_H
+#define CRANKVECMASK_PRIVATE_H
+
+/* Copyright (C) 2015, WSID   */
+
+/* Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/* This declares private functions */
+
+#ifndef _CRANKBASE_INSIDE
+#error crankvecmask-private.h cannot be included directly.
+#endif
+
+#include <glib.h>
+
+#include "crankveccommon.h"
+
+#ifndef __GTK_DOC_IGNORE__
+
+G_BEGIN_DECLS
+
+/*
+ * CrankVecMaskFloatKernels:
+ * @name: Name of kernel set, for diagnostics.
+ * @blend: r = mask ? b : a.
+ * @cmpblend: r = (a op b) ? x : y.
+ * @cmpcount: Count of (a op b).
+ * @masked_add: r = mask ? (a + b) : a.
+ * @masked_mul: r = mask ? (a * b) : a.
+ * @compress: Stores a where mask is set, to front of r. Returns count.
+ * @cmpcompress: Stores a where (a op b), to front of r. Returns count.
+ * @expand: r = mask ? (next element of a) : fill. Returns count of consumed
+ *     elements.
+ *
+ * Masked kernels over arrays of @n elements. A mask is an array of #gboolean,
+ * where non-zero is set. Arrays does not need to be aligned. Result may be
+ * same array as an operand, except for @expand.
+ *
+ * r of @compress and @cmpcompress should have room for selected elements, and
+ * a of @expand should have elements as many as set elements of mask.
+ *
+ * Kernels for element types are instantiated from one template,
+ * crankvecmask-template-private.h.
+ */
+typedef struct _CrankVecMaskFloatKernels {
+  const gchar *name;
+
+  void  (*blend)       (const guint     n,
+                        const gfloat   *a,
+                        const gfloat   *b,
+                        const gboolean *mask,
+                        gfloat         *r);
+
+  void  (*cmpblend)    (const guint     n,
+                        CrankVecCmpOp   op,
+                        const gfloat   *a,
+                        const gfloat   *b,
+                        const gfloat   *x,
+                        const gfloat   *y,
+                        gfloat         *r);
+
+  guint (*cmpcount)    (const guint     n,
+                        CrankVecCmpOp   op,
+                        const gfloat   *a,
+                        const gfloat   *b);
+
+  void  (*masked_add)  (const guint     n,
+                        const gfloat   *a,
+                        const gfloat   *b,
+                        const gboolean *mask,
+                        gfloat         *r);
+
+  void  (*masked_mul)  (const guint     n,
+                        const gfloat   *a,
+                        const gfloat   *b,
+                        const gboolean *mask,
+                        gfloat         *r);
+
+  guint (*compress)    (const guint     n,
+                        const gfloat   *a,
+                        const gboolean *mask,
+                        gfloat         *r);
+
+  guint (*cmpcompress) (const guint     n,
+                        CrankVecCmpOp   op,
+                        const gfloat   *a,
+                        const gfloat   *b,
+                        gfloat         *r);
+
+  guint (*expand)      (const guint     n,
+                        const gfloat   *a,
+                        const gboolean *mask,
+                        const gfloat    fill,
+                        gfloat         *r);
+} CrankVecMaskFloatKernels;
+
+/*
+ * CrankVecMaskIntKernels:
+ *
+ * Same as #CrankVecMaskFloatKernels, but over int arrays.
+ */
+typedef struct _CrankVecMaskIntKernels {
+  const gchar *name;
+
+  void  (*blend)       (const guint     n,
+                        const gint     *a,
+                        const gint     *b,
+                        const gboolean *mask,
+                        gint           *r);
+
+  void  (*cmpblend)    (const guint     n,
+                        CrankVecCmpOp   op,
+                        const gint     *a,
+                        const gint     *b,
+                        const gint     *x,
+                        const gint     *y,
+                        gint           *r);
+
+  guint (*cmpcount)    (const guint     n,
+                        CrankVecCmpOp   op,
+                        const gint     *a,
+                        const gint     *b);
+
+  void  (*masked_add)  (const guint     n,
+                        const gint     *a,
+                        const gint     *b,
+                        const gboolean *mask,
+                        gint           *r);
+
+  void  (*masked_mul)  (const guint     n,
+                        const gint     *a,
+                        const gint     *b,
+                        const gboolean *mask,
+                        gint           *r);
+
+  guint (*compress)    (const guint     n,
+                        const gint     *a,
+                        const gboolean *mask,
+                        gint           *r);
+
+  guint (*cmpcompress) (const guint     n,
+                        CrankVecCmpOp   op,
+                        const gint     *a,
+                        const gint     *b,
+                        gint           *r);
+
+  guint (*expand)      (const guint     n,
+                        const gint     *a,
+                        const gboolean *mask,
+                        const gint      fill,
+                        gint           *r);
+} CrankVecMaskIntKernels;
+
+/*
+ * CrankVecMaskUintKernels:
+ *
+ * Same as #CrankVecMaskFloatKernels, but over uint arrays.
+ */
+typedef struct _CrankVecMaskUintKernels {
+  const gchar *name;
+
+  void  (*blend)       (const guint     n,
+                        const guint    *a,
+                        const guint    *b,
+                        const gboolean *mask,
+                        guint          *r);
+
+  void  (*cmpblend)    (const guint     n,
+                        CrankVecCmpOp   op,
+                        const guint    *a,
+                        const guint    *b,
+                        const guint    *x,
+                        const guint    *y,
+                        guint          *r);
+
+  guint (*cmpcount)    (const guint     n,
+                        CrankVecCmpOp   op,
+                        const guint    *a,
+                        const guint    *b);
+
+  void  (*masked_add)  (const guint     n,
+                        const guint    *a,
+                        const guint    *b,
+                        const gboolean *mask,
+                        guint          *r);
+
+  void  (*masked_mul)  (const guint     n,
+                        const guint    *a,
+                        const guint    *b,
+                        const gboolean *mask,
+                        guint          *r);
+
+  guint (*compress)    (const guint     n,
+                        const guint    *a,
+                        const gboolean *mask,
+                        guint          *r);
+
+  guint (*cmpcompress) (const guint     n,
+                        CrankVecCmpOp   op,
+                        const guint    *a,
+                        const guint    *b,
+                        guint          *r);
+
+  guint (*expand)      (const guint     n,
+                        const guint    *a,
+                        const gboolean *mask,
+                        const guint     fill,
+                        guint          *r);
+} CrankVecMaskUintKernels;
+
+G_GNUC_INTERNAL
+const CrankVecMaskFloatKernels *_crank_vec_mask_float_get_kernels (void);
+
+G_GNUC_INTERNAL
+const CrankVecMaskIntKernels   *_crank_vec_mask_int_get_kernels (void);
+
+G_GNUC_INTERNAL
+const CrankVecMaskUintKernels  *_crank_vec_mask_uint_get_kernels (void);
+
+G_END_DECLS
+
+#endif
+
+#endif
@@ -0,0 +1,483 @@
+/* Copyright (C) 2015, WSID   */
+
+/* Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/* This is template for masked kernels, and is included by crankvecmask.c once
+ * for each element type. */
+
+#ifndef _CRANKBASE_INSIDE
+#error crankvecmask-template-private.h cannot be included directly.
+#endif
+
+#ifndef CRANK_VEC_MASK_T
+#error CRANK_VEC_MASK_T should be defined before including template.
+#endif
+
+#ifndef __GTK_DOC_IGNORE__
+
+/*
+ * Parameters of template.
+ *
+ * CRANK_VEC_MASK_T: Element type. (gfloat, gint, guint)
+ * CRANK_VEC_MASK_KERNELS: Kernel set type.
+ * CRANK_VEC_MASK_FUNC(name): Makes function name with type prefix.
+ * CRANK_VEC_MASK_GET_KERNELS: Name of kernel selection function.
+ * CRANK_VEC_MASK_CMP_AVX2(name, a, b): Compares two __m256i, by name of
+ *     CrankVecCmpOp without prefix, like LESS or NOT_EQ.
+ * CRANK_VEC_MASK_ADD_AVX2(a, b), CRANK_VEC_MASK_MUL_AVX2(a, b): Arithmetics
+ *     on two __m256i.
+ * CRANK_VEC_MASK_SET1_AVX2(x): Broadcasts an element to __m256i.
+ *
+ * Elements are 32 bits, so 8 elements are in a __m256i, regardless of type.
+ */
+
+#define T       CRANK_VEC_MASK_T
+#define F(name) CRANK_VEC_MASK_FUNC(name)
+
+/* Expands LOOP(o, name) for op, with C operator o and name of op. So loops
+ * do not branch on op per element. */
+#define CRANK_VEC_MASK_SWITCH(op, LOOP) \
+  switch (op) \
+    { \
+    case CRANK_VEC_CMP_LESS:       LOOP (<,  LESS);       break; \
+    case CRANK_VEC_CMP_LESS_EQ:    LOOP (<=, LESS_EQ);    break; \
+    case CRANK_VEC_CMP_EQ:         LOOP (==, EQ);         break; \
+    case CRANK_VEC_CMP_NOT_EQ:     LOOP (!=, NOT_EQ);     break; \
+    case CRANK_VEC_CMP_GREATER_EQ: LOOP (>=, GREATER_EQ); break; \
+    case CRANK_VEC_CMP_GREATER:    LOOP (>,  GREATER);    break; \
+    }
+
+
+//////// Scalar kernels ////////////////////////////////////////////////////////
+
+static void
+F(blend_scalar) (const guint     n,
+                 const T        *a,
+                 const T        *b,
+                 const gboolean *mask,
+                 T              *r)
+{
+  guint i;
+
+  for (i = 0; i < n; i++)
+    r[i] = mask[i] ? b[i] : a[i];
+}
+
+static void
+F(cmpblend_scalar) (const guint    n,
+                    CrankVecCmpOp  op,
+                    const T       *a,
+                    const T       *b,
+                    const T       *x,
+                    const T       *y,
+                    T             *r)
+{
+  guint i;
+
+#define LOOP(o, name) \
+  for (i = 0; i < n; i++) \
+    r[i] = (a[i] o b[i]) ? x[i] : y[i]
+
+  CRANK_VEC_MASK_SWITCH (op, LOOP)
+
+#undef LOOP
+}
+
+static guint
+F(cmpcount_scalar) (const guint    n,
+                    CrankVecCmpOp  op,
+                    const T       *a,
+                    const T       *b)
+{
+  guint count = 0;
+  guint i;
+
+#define LOOP(o, name) \
+  for (i = 0; i < n; i++) \
+    count += (a[i] o b[i])
+
+  CRANK_VEC_MASK_SWITCH (op, LOOP)
+
+#undef LOOP
+
+  return count;
+}
+
+static void
+F(masked_add_scalar) (const guint     n,
+                      const T        *a,
+                      const T        *b,
+                      const gboolean *mask,
+                      T              *r)
+{
+  guint i;
+
+  for (i = 0; i < n; i++)
+    r[i] = mask[i] ? (a[i] + b[i]) : a[i];
+}
+
+static void
+F(masked_mul_scalar) (const guint     n,
+                      const T        *a,
+                      const T        *b,
+                      const gboolean *mask,
+                      T              *r)
+{
+  guint i;
+
+  for (i = 0; i < n; i++)
+    r[i] = mask[i] ? (a[i] * b[i]) : a[i];
+}
+
+static guint
+F(compress_scalar) (const guint     n,
+                    const T        *a,
+                    const gboolean *mask,
+                    T              *r)
+{
+  guint count = 0;
+  guint i;
+
+  for (i = 0; i < n; i++)
+    if (mask[i])
+      r[count++] = a[i];
+
+  return count;
+}
+
+static guint
+F(cmpcompress_scalar) (const guint    n,
+                       CrankVecCmpOp  op,
+                       const T       *a,
+                       const T       *b,
+                       T             *r)
+{
+  guint count = 0;
+  guint i;
+
+#define LOOP(o, name) \
+  for (i = 0; i < n; i++) \
+    { \
+      T v = a[i]; \
+      if (v o b[i]) \
+        r[count++] = v; \
+    }
+
+  CRANK_VEC_MASK_SWITCH (op, LOOP)
+
+#undef LOOP
+
+  return count;
+}
+
+static guint
+F(expand_scalar) (const guint     n,
+                  const T        *a,
+                  const gboolean *mask,
+                  const T         fill,
+                  T              *r)
+{
+  guint count = 0;
+  guint i;
+
+  for (i = 0; i < n; i++)
+    r[i] = mask[i] ? a[count++] : fill;
+
+  return count;
+}
+
+static const CRANK_VEC_MASK_KERNELS F(kernels_scalar) = {
+  "scalar",
+  F(blend_scalar),
+  F(cmpblend_scalar),
+  F(cmpcount_scalar),
+  F(masked_add_scalar),
+  F(masked_mul_scalar),
+  F(compress_scalar),
+  F(cmpcompress_scalar),
+  F(expand_scalar)
+};
+
+
+#ifdef CRANK_CPU_X86
+
+//////// AVX2 kernels //////////////////////////////////////////////////////////
+
+#define LOAD(p)     _mm256_loadu_si256 ((const __m256i*)(p))
+#define STORE(p, v) _mm256_storeu_si256 ((__m256i*)(p), (v))
+
+__attribute__((target ("avx2")))
+static void
+F(blend_avx2) (const guint     n,
+               const T        *a,
+               const T        *b,
+               const gboolean *mask,
+               T              *r)
+{
+  guint i;
+
+  for (i = 0; i + 8 <= n; i += 8)
+    {
+      __m256i m = crank_vec_mask_load_avx2 (mask + i);
+
+      STORE (r + i, _mm256_blendv_epi8 (LOAD (a + i), LOAD (b + i), m));
+    }
+
+  _mm256_zeroupper ();
+  F(blend_scalar) (n - i, a + i, b + i, mask + i, r + i);
+}
+
+__attribute__((target ("avx2")))
+static void
+F(cmpblend_avx2) (const guint    n,
+                  CrankVecCmpOp  op,
+                  const T       *a,
+                  const T       *b,
+                  const T       *x,
+                  const T       *y,
+                  T             *r)
+{
+  guint i = 0;
+
+#define LOOP(o, name) \
+  for (; i + 8 <= n; i += 8) \
+    { \
+      __m256i m = CRANK_VEC_MASK_CMP_AVX2 (name, LOAD (a + i), LOAD (b + i)); \
+      STORE (r + i, _mm256_blendv_epi8 (LOAD (y + i), LOAD (x + i), m)); \
+    }
+
+  CRANK_VEC_MASK_SWITCH (op, LOOP)
+
+#undef LOOP
+
+  _mm256_zeroupper ();
+  F(cmpblend_scalar) (n - i, op, a + i, b + i, x + i, y + i, r + i);
+}
+
+/* Compare results are -1 for set lanes, so they are subtracted from counts. */
+__attribute__((target ("avx2")))
+static guint
+F(cmpcount_avx2) (const guint    n,
+                  CrankVecCmpOp  op,
+                  const T       *a,
+                  const T       *b)
+{
+  __m256i acc = _mm256_setzero_si256 ();
+  guint count;
+  guint i = 0;
+
+#define LOOP(o, name) \
+  for (; i + 8 <= n; i += 8) \
+    acc = _mm256_sub_epi32 (acc, \
+                            CRANK_VEC_MASK_CMP_AVX2 (name, \
+                                                     LOAD (a + i), \
+                                                     LOAD (b + i)))
+
+  CRANK_VEC_MASK_SWITCH (op, LOOP)
+
+#undef LOOP
+
+  count = crank_vec_mask_hsum_avx2 (acc);
+
+  _mm256_zeroupper ();
+  return count + F(cmpcount_scalar) (n - i, op, a + i, b + i);
+}
+
+/* Results are blended, rather than adding masked operand, so that -0 is kept
+ * on masked out lanes of floating point. */
+__attribute__((target ("avx2")))
+static void
+F(masked_add_avx2) (const guint     n,
+                    const T        *a,
+                    const T        *b,
+                    const gboolean *mask,
+                    T              *r)
+{
+  guint i;
+
+  for (i = 0; i + 8 <= n; i += 8)
+    {
+      __m256i va = LOAD (a + i);
+      __m256i m = crank_vec_mask_load_avx2 (mask + i);
+
+      STORE (r + i,
+             _mm256_blendv_epi8 (va,
+                                 CRANK_VEC_MASK_ADD_AVX2 (va, LOAD (b + i)),
+                                 m));
+    }
+
+  _mm256_zeroupper ();
+  F(masked_add_scalar) (n - i, a + i, b + i, mask + i, r + i);
+}
+
+__attribute__((target ("avx2")))
+static void
+F(masked_mul_avx2) (const guint     n,
+                    const T        *a,
+                    const T        *b,
+                    const gboolean *mask,
+                    T              *r)
+{
+  guint i;
+
+  for (i = 0; i + 8 <= n; i += 8)
+    {
+      __m256i va = LOAD (a + i);
+      __m256i m = crank_vec_mask_load_avx2 (mask + i);
+
+      STORE (r + i,
+             _mm256_blendv_epi8 (va,
+                                 CRANK_VEC_MASK_MUL_AVX2 (va, LOAD (b + i)),
+                                 m));
+    }
+
+  _mm256_zeroupper ();
+  F(masked_mul_scalar) (n - i, a + i, b + i, mask + i, r + i);
+}
+
+__attribute__((target ("avx2,popcnt")))
+static guint
+F(compress_avx2) (const guint     n,
+                  const T        *a,
+                  const gboolean *mask,
+                  T              *r)
+{
+  guint count = 0;
+  guint i;
+
+  for (i = 0; i + 8 <= n; i += 8)
+    {
+      __m256i m = crank_vec_mask_load_avx2 (mask + i);
+
+      count += crank_vec_mask_compress8_avx2 (LOAD (a + i),
+                                              _mm256_movemask_ps (
+                                                  _mm256_castsi256_ps (m)),
+                                              r + count);
+    }
+
+  _mm256_zeroupper ();
+  return count + F(compress_scalar) (n - i, a + i, mask + i, r + count);
+}
+
+__attribute__((target ("avx2,popcnt")))
+static guint
+F(cmpcompress_avx2) (const guint    n,
+                     CrankVecCmpOp  op,
+                     const T       *a,
+                     const T       *b,
+                     T             *r)
+{
+  guint count = 0;
+  guint i = 0;
+
+#define LOOP(o, name) \
+  for (; i + 8 <= n; i += 8) \
+    { \
+      __m256i va = LOAD (a + i); \
+      __m256i m = CRANK_VEC_MASK_CMP_AVX2 (name, va, LOAD (b + i)); \
+      count += crank_vec_mask_compress8_avx2 ( \
+          va, _mm256_movemask_ps (_mm256_castsi256_ps (m)), r + count); \
+    }
+
+  CRANK_VEC_MASK_SWITCH (op, LOOP)
+
+#undef LOOP
+
+  _mm256_zeroupper ();
+  return count + F(cmpcompress_scalar) (n - i, op, a + i, b + i, r + count);
+}
+
+__attribute__((target ("avx2,popcnt")))
+static guint
+F(expand_avx2) (const guint     n,
+                const T        *a,
+                const gboolean *mask,
+                const T         fill,
+                T              *r)
+{
+  __m256i vfill = CRANK_VEC_MASK_SET1_AVX2 (fill);
+  guint count = 0;
+  guint i;
+
+  for (i = 0; i + 8 <= n; i += 8)
+    {
+      __m256i m = crank_vec_mask_load_avx2 (mask + i);
+      __m256i v;
+
+      count += crank_vec_mask_expand8_avx2 (
+          a + count, _mm256_movemask_ps (_mm256_castsi256_ps (m)), &v);
+
+      STORE (r + i, _mm256_blendv_epi8 (vfill, v, m));
+    }
+
+  _mm256_zeroupper ();
+  return count + F(expand_scalar) (n - i, a + count, mask + i, fill, r + i);
+}
+
+#undef LOAD
+#undef STORE
+
+static const CRANK_VEC_MASK_KERNELS F(kernels_avx2) = {
+  "avx2",
+  F(blend_avx2),
+  F(cmpblend_avx2),
+  F(cmpcount_avx2),
+  F(masked_add_avx2),
+  F(masked_mul_avx2),
+  F(compress_avx2),
+  F(cmpcompress_avx2),
+  F(expand_avx2)
+};
+
+#endif
+
+
+//////// Kernel selection //////////////////////////////////////////////////////
+
+/* Gets kernel set for current SIMD level. It is selected when it is first
+ * called. */
+const CRANK_VEC_MASK_KERNELS*
+CRANK_VEC_MASK_GET_KERNELS (void)
+{
+  static gsize kernels = 0;
+
+  if (g_once_init_enter (&kernels))
+    {
+      const CRANK_VEC_MASK_KERNELS *selected = &F(kernels_scalar);
+
+#ifdef CRANK_CPU_X86
+      if (CRANK_CPU_SIMD_AVX2 <= _crank_cpu_get_simd_level ())
+        {
+          crank_vec_mask_init_lut ();
+          selected = &F(kernels_avx2);
+        }
+#endif
+
+      g_once_init_leave (&kernels, (gsize) selected);
+    }
+
+  return (const CRANK_VEC_MASK_KERNELS*) kernels;
+}
+
+#undef CRANK_VEC_MASK_SWITCH
+#undef T
+#undef F
+
+#endif
@@ -0,0 +1,311 @@
+/* Copyright (C) 2015, WSID   */
+
+/* Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+#define _CRANKBASE_INSIDE
+
+#include <glib.h>
+
+#include "crankveccommon.h"
+#include "crankcpu-private.h"
+#include "crankvecmask-private.h"
+
+#ifdef CRANK_CPU_X86
+#include <immintrin.h>
+#endif
+
+/*
+ * Masked kernels for variable sized float, int and uint vectors.
+ *
+ * There are scalar kernels and AVX2 kernels. A set is selected when it is
+ * first requested, by _crank_cpu_get_simd_level(), so it can be limited by
+ * CRANK_SIMD environment variable.
+ *
+ * Masks are arrays of #gboolean, which have same width with elements. So a
+ * mask is loaded as a vector and compared to zero, to be used by blend
+ * instructions.
+ *
+ * AVX2 does not have compress and expand instructions. These are done by
+ * permutation of 8 lanes, with index tables by 8 bits of mask. Partial stores
+ * and loads are done by masked store and load, so they do not touch memory
+ * over selected elements.
+ *
+ * Kernels are written once in crankvecmask-template-private.h, and are
+ * instantiated for each element type here.
+ */
+
+#ifdef CRANK_CPU_X86
+
+//////// Common AVX2 helpers ///////////////////////////////////////////////////
+
+/* Byte indices of lanes, indexed by 8 bits of mask.
+ * compress: i-th byte is lane of i-th set bit.
+ * expand: i-th byte is rank of i-th bit, among set bits. */
+static guint64 crank_vec_mask_compress_lut[256];
+static guint64 crank_vec_mask_expand_lut[256];
+
+static void
+crank_vec_mask_init_lut (void)
+{
+  static gsize lut_ready = 0;
+
+  if (g_once_init_enter (&lut_ready))
+    {
+      guint bits;
+      guint i;
+
+      for (bits = 0; bits < 256; bits++)
+        {
+          guint64 compress = 0;
+          guint64 expand = 0;
+          guint k = 0;
+
+          for (i = 0; i < 8; i++)
+            {
+              if (bits & (1 << i))
+                {
+                  compress |= (guint64) i << (8 * k);
+                  expand |= (guint64) k << (8 * i);
+                  k++;
+                }
+            }
+
+          crank_vec_mask_compress_lut[bits] = compress;
+          crank_vec_mask_expand_lut[bits] = expand;
+        }
+
+      g_once_init_leave (&lut_ready, 1);
+    }
+}
+
+/* Loads 8 gboolean and gets lanes of all 1 bits for non-zero. */
+__attribute__((target ("avx2")))
+static inline __m256i
+crank_vec_mask_load_avx2 (const gboolean *mask)
+{
+  __m256i m = _mm256_loadu_si256 ((const __m256i*) mask);
+  __m256i z = _mm256_cmpeq_epi32 (m, _mm256_setzero_si256 ());
+
+  return _mm256_xor_si256 (z, _mm256_set1_epi32 (-1));
+}
+
+/* Gets lanes of all 1 bits for first k lanes. */
+__attribute__((target ("avx2")))
+static inline __m256i
+crank_vec_mask_prefix_avx2 (const guint k)
+{
+  return _mm256_cmpgt_epi32 (_mm256_set1_epi32 ((gint) k),
+                             _mm256_setr_epi32 (0, 1, 2, 3, 4, 5, 6, 7));
+}
+
+__attribute__((target ("avx2")))
+static inline guint
+crank_vec_mask_hsum_avx2 (__m256i v)
+{
+  __m128i s = _mm_add_epi32 (_mm256_castsi256_si128 (v),
+                             _mm256_extracti128_si256 (v, 1));
+
+  s = _mm_add_epi32 (s, _mm_shuffle_epi32 (s, 0x4E));
+  s = _mm_add_epi32 (s, _mm_shuffle_epi32 (s, 0xB1));
+
+  return (guint) _mm_cvtsi128_si32 (s);
+}
+
+/* Stores lanes of v for set bits, to front of r. Returns count of them. */
+__attribute__((target ("avx2,popcnt")))
+static inline guint
+crank_vec_mask_compress8_avx2 (__m256i      v,
+                               const guint  bits,
+                               gpointer     r)
+{
+  guint k = __builtin_popcount (bits);
+  __m256i perm = _mm256_cvtepu8_epi32 (
+      _mm_loadl_epi64 ((const __m128i*)(crank_vec_mask_compress_lut + bits)));
+
+  _mm256_maskstore_epi32 ((int*) r,
+                          crank_vec_mask_prefix_avx2 (k),
+                          _mm256_permutevar8x32_epi32 (v, perm));
+  return k;
+}
+
+/* Loads elements from front of a, to lanes for set bits. Returns count of
+ * them. */
+__attribute__((target ("avx2,popcnt")))
+static inline guint
+crank_vec_mask_expand8_avx2 (gconstpointer  a,
+                             const guint    bits,
+                             __m256i       *v)
+{
+  guint k = __builtin_popcount (bits);
+  __m256i perm = _mm256_cvtepu8_epi32 (
+      _mm_loadl_epi64 ((const __m128i*)(crank_vec_mask_expand_lut + bits)));
+  __m256i loaded = _mm256_maskload_epi32 ((const int*) a,
+                                          crank_vec_mask_prefix_avx2 (k));
+
+  *v = _mm256_permutevar8x32_epi32 (loaded, perm);
+  return k;
+}
+
+#define CRANK_VEC_MASK_NOT_AVX2(v) \
+  _mm256_xor_si256 ((v), _mm256_set1_epi32 (-1))
+
+#endif
+
+
+//////// Float kernels /////////////////////////////////////////////////////////
+
+#ifdef CRANK_CPU_X86
+
+#define CRANK_VEC_MASK_FLOAT_CMP(pred, a, b) \
+  _mm256_castps_si256 (_mm256_cmp_ps (_mm256_castsi256_ps (a), \
+                                      _mm256_castsi256_ps (b), \
+                                      pred))
+
+#define CRANK_VEC_MASK_FLOAT_CMP_LESS(a, b) \
+  CRANK_VEC_MASK_FLOAT_CMP (_CMP_LT_OQ, a, b)
+#define CRANK_VEC_MASK_FLOAT_CMP_LESS_EQ(a, b) \
+  CRANK_VEC_MASK_FLOAT_CMP (_CMP_LE_OQ, a, b)
+#define CRANK_VEC_MASK_FLOAT_CMP_EQ(a, b) \
+  CRANK_VEC_MASK_FLOAT_CMP (_CMP_EQ_OQ, a, b)
+#define CRANK_VEC_MASK_FLOAT_CMP_NOT_EQ(a, b) \
+  CRANK_VEC_MASK_FLOAT_CMP (_CMP_NEQ_UQ, a, b)
+#define CRANK_VEC_MASK_FLOAT_CMP_GREATER_EQ(a, b) \
+  CRANK_VEC_MASK_FLOAT_CMP (_CMP_GE_OQ, a, b)
+#define CRANK_VEC_MASK_FLOAT_CMP_GREATER(a, b) \
+  CRANK_VEC_MASK_FLOAT_CMP (_CMP_GT_OQ, a, b)
+
+#define CRANK_VEC_MASK_CMP_AVX2(name, a, b) \
+  CRANK_VEC_MASK_FLOAT_CMP_##name (a, b)
+
+#define CRANK_VEC_MASK_ADD_AVX2(a, b) \
+  _mm256_castps_si256 (_mm256_add_ps (_mm256_castsi256_ps (a), \
+                                      _mm256_castsi256_ps (b)))
+
+#define CRANK_VEC_MASK_MUL_AVX2(a, b) \
+  _mm256_castps_si256 (_mm256_mul_ps (_mm256_castsi256_ps (a), \
+                                      _mm256_castsi256_ps (b)))
+
+#define CRANK_VEC_MASK_SET1_AVX2(x) \
+  _mm256_castps_si256 (_mm256_set1_ps (x))
+
+#endif
+
+#define CRANK_VEC_MASK_T              gfloat
+#define CRANK_VEC_MASK_KERNELS        CrankVecMaskFloatKernels
+#define CRANK_VEC_MASK_FUNC(name)     crank_vec_mask_float_##name
+#define CRANK_VEC_MASK_GET_KERNELS    _crank_vec_mask_float_get_kernels
+
+#include "crankvecmask-template-private.h"
+
+#undef CRANK_VEC_MASK_T
+#undef CRANK_VEC_MASK_KERNELS
+#undef CRANK_VEC_MASK_FUNC
+#undef CRANK_VEC_MASK_GET_KERNELS
+#undef CRANK_VEC_MASK_CMP_AVX2
+#undef CRANK_VEC_MASK_ADD_AVX2
+#undef CRANK_VEC_MASK_MUL_AVX2
+#undef CRANK_VEC_MASK_SET1_AVX2
+
+
+//////// Int kernels ///////////////////////////////////////////////////////////
+
+#ifdef CRANK_CPU_X86
+
+#define CRANK_VEC_MASK_INT_CMP_LESS(a, b) \
+  _mm256_cmpgt_epi32 (b, a)
+#define CRANK_VEC_MASK_INT_CMP_LESS_EQ(a, b) \
+  CRANK_VEC_MASK_NOT_AVX2 (_mm256_cmpgt_epi32 (a, b))
+#define CRANK_VEC_MASK_INT_CMP_EQ(a, b) \
+  _mm256_cmpeq_epi32 (a, b)
+#define CRANK_VEC_MASK_INT_CMP_NOT_EQ(a, b) \
+  CRANK_VEC_MASK_NOT_AVX2 (_mm256_cmpeq_epi32 (a, b))
+#define CRANK_VEC_MASK_INT_CMP_GREATER_EQ(a, b) \
+  CRANK_VEC_MASK_NOT_AVX2 (_mm256_cmpgt_epi32 (b, a))
+#define CRANK_VEC_MASK_INT_CMP_GREATER(a, b) \
+  _mm256_cmpgt_epi32 (a, b)
+
+#define CRANK_VEC_MASK_CMP_AVX2(name, a, b) \
+  CRANK_VEC_MASK_INT_CMP_##name (a, b)
+
+#define CRANK_VEC_MASK_ADD_AVX2(a, b)   _mm256_add_epi32 (a, b)
+#define CRANK_VEC_MASK_MUL_AVX2(a, b)   _mm256_mullo_epi32 (a, b)
+#define CRANK_VEC_MASK_SET1_AVX2(x)     _mm256_set1_epi32 ((gint)(x))
+
+#endif
+
+#define CRANK_VEC_MASK_T              gint
+#define CRANK_VEC_MASK_KERNELS        CrankVecMaskIntKernels
+#define CRANK_VEC_MASK_FUNC(name)     crank_vec_mask_int_##name
+#define CRANK_VEC_MASK_GET_KERNELS    _crank_vec_mask_int_get_kernels
+
+#include "crankvecmask-template-private.h"
+
+#undef CRANK_VEC_MASK_T
+#undef CRANK_VEC_MASK_KERNELS
+#undef CRANK_VEC_MASK_FUNC
+#undef CRANK_VEC_MASK_GET_KERNELS
+#undef CRANK_VEC_MASK_CMP_AVX2
+
+
+//////// Uint kernels //////////////////////////////////////////////////////////
+
+#ifdef CRANK_CPU_X86
+
+/* AVX2 only has signed comparison. Flipping sign bit maps unsigned order to
+ * signed order. Equality does not need it. */
+#define CRANK_VEC_MASK_UINT_BIAS(v) \
+  _mm256_xor_si256 ((v), _mm256_set1_epi32 (G_MININT32))
+
+#define CRANK_VEC_MASK_UINT_CMP_LESS(a, b) \
+  CRANK_VEC_MASK_INT_CMP_LESS (CRANK_VEC_MASK_UINT_BIAS (a), \
+                               CRANK_VEC_MASK_UINT_BIAS (b))
+#define CRANK_VEC_MASK_UINT_CMP_LESS_EQ(a, b) \
+  CRANK_VEC_MASK_INT_CMP_LESS_EQ (CRANK_VEC_MASK_UINT_BIAS (a), \
+                                  CRANK_VEC_MASK_UINT_BIAS (b))
+#define CRANK_VEC_MASK_UINT_CMP_EQ(a, b) \
+  CRANK_VEC_MASK_INT_CMP_EQ (a, b)
+#define CRANK_VEC_MASK_UINT_CMP_NOT_EQ(a, b) \
+  CRANK_VEC_MASK_INT_CMP_NOT_EQ (a, b)
+#define CRANK_VEC_MASK_UINT_CMP_GREATER_EQ(a, b) \
+  CRANK_VEC_MASK_INT_CMP_GREATER_EQ (CRANK_VEC_MASK_UINT_BIAS (a), \
+                                     CRANK_VEC_MASK_UINT_BIAS (b))
+#define CRANK_VEC_MASK_UINT_CMP_GREATER(a, b) \
+  CRANK_VEC_MASK_INT_CMP_GREATER (CRANK_VEC_MASK_UINT_BIAS (a), \
+                                  CRANK_VEC_MASK_UINT_BIAS (b))
+
+#define CRANK_VEC_MASK_CMP_AVX2(name, a, b) \
+  CRANK_VEC_MASK_UINT_CMP_##name (a, b)
+
+#endif
+
+#define CRANK_VEC_MASK_T              guint
+#define CRANK_VEC_MASK_KERNELS        CrankVecMaskUintKernels
+#define CRANK_VEC_MASK_FUNC(name)     crank_vec_mask_uint_##name
+#define CRANK_VEC_MASK_GET_KERNELS    _crank_vec_mask_uint_get_kernels
+
+#include "crankvecmask-template-private.h"
+
+#undef CRANK_VEC_MASK_T
+#undef CRANK_VEC_MASK_KERNELS
+#undef CRANK_VEC_MASK_FUNC
+#undef CRANK_VEC_MASK_GET_KERNELS
+#undef CRANK_VEC_MASK_CMP_AVX2
+#undef CRANK_VEC_MASK_ADD_AVX2
+#undef CRANK_VEC_MASK_MUL_AVX2
+#undef CRANK_VEC_MASK_SET1_AVX2
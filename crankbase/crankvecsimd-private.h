@@ -0,0 +1,208 @@
+#ifndef CRANKVECSIMD_PRIVATE_H
+#define CRANKVECSIMD_PRIVATE_H
+
+/* Copyright (C) 2015, WSID   */
+
+/* Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/* This declares private functions */
+
+#ifndef _CRANKBASE_INSIDE
+#error crankvecsimd-private.h cannot be included directly.
+#endif
+
+#include <glib.h>
+
+#ifndef __GTK_DOC_IGNORE__
+
+G_BEGIN_DECLS
+
+/*
+ * CrankVecFloatKernels:
+ * @name: Name of kernel set, for diagnostics.
+ * @add: r = a + b.
+ * @sub: r = a - b.
+ * @mul: r = a * b, component-wise.
+ * @div: r = a / b, component-wise.
+ * @muls: r = a * s.
+ * @divs: r = a / s.
+ * @mixs: r = a * (1 - s) + b * s.
+ * @mix: r = a * (1 - c) + b * c, component-wise.
+ * @dot: Sum of a * b.
+ * @cmul: (rr + ri i) = (ar + ai i) * (br + bi i), component-wise.
+ * @cdot: Sum of (ar + ai i) * conj (br + bi i).
+ *
+ * Element-wise kernels over float arrays of @n elements. Arrays does not need
+ * to be aligned, and result may be same array as an operand.
+ *
+ * @cmul and @cdot works on split complex arrays, which holds real parts and
+ * imaginary parts in separate arrays.
+ *
+ * Kernels for both precisions are instantiated from one template,
+ * crankvecsimd-template-private.h.
+ */
+typedef struct _CrankVecFloatKernels {
+  const gchar *name;
+
+  void    (*add)  (const guint   n,
+                   const gfloat *a,
+                   const gfloat *b,
+                   gfloat       *r);
+
+  void    (*sub)  (const guint   n,
+                   const gfloat *a,
+                   const gfloat *b,
+                   gfloat       *r);
+
+  void    (*mul)  (const guint   n,
+                   const gfloat *a,
+                   const gfloat *b,
+                   gfloat       *r);
+
+  void    (*div)  (const guint   n,
+                   const gfloat *a,
+                   const gfloat *b,
+                   gfloat       *r);
+
+  void    (*muls) (const guint   n,
+                   const gfloat *a,
+                   const gfloat  s,
+                   gfloat       *r);
+
+  void    (*divs) (const guint   n,
+                   const gfloat *a,
+                   const gfloat  s,
+                   gfloat       *r);
+
+  void    (*mixs) (const guint   n,
+                   const gfloat *a,
+                   const gfloat *b,
+                   const gfloat  s,
+                   gfloat       *r);
+
+  void    (*mix)  (const guint   n,
+                   const gfloat *a,
+                   const gfloat *b,
+                   const gfloat *c,
+                   gfloat       *r);
+
+  gfloat  (*dot)  (const guint   n,
+                   const gfloat *a,
+                   const gfloat *b);
+
+  void    (*cmul) (const guint   n,
+                   const gfloat *ar,
+                   const gfloat *ai,
+                   const gfloat *br,
+                   const gfloat *bi,
+                   gfloat       *rr,
+                   gfloat       *ri);
+
+  void    (*cdot) (const guint   n,
+                   const gfloat *ar,
+                   const gfloat *ai,
+                   const gfloat *br,
+                   const gfloat *bi,
+                   gfloat       *rr,
+                   gfloat       *ri);
+} CrankVecFloatKernels;
+
+/*
+ * CrankVecDoubleKernels:
+ *
+ * Same as #CrankVecFloatKernels, but over double arrays.
+ */
+typedef struct _CrankVecDoubleKernels {
+  const gchar *name;
+
+  void    (*add)  (const guint    n,
+                   const gdouble *a,
+                   const gdouble *b,
+                   gdouble       *r);
+
+  void    (*sub)  (const guint    n,
+                   const gdouble *a,
+                   const gdouble *b,
+                   gdouble       *r);
+
+  void    (*mul)  (const guint    n,
+                   const gdouble *a,
+                   const gdouble *b,
+                   gdouble       *r);
+
+  void    (*div)  (const guint    n,
+                   const gdouble *a,
+                   const gdouble *b,
+                   gdouble       *r);
+
+  void    (*muls) (const guint    n,
+                   const gdouble *a,
+                   const gdouble  s,
+                   gdouble       *r);
+
+  void    (*divs) (const guint    n,
+                   const gdouble *a,
+                   const gdouble  s,
+                   gdouble       *r);
+
+  void    (*mixs) (const guint    n,
+                   const gdouble *a,
+                   const gdouble *b,
+                   const gdouble  s,
+                   gdouble       *r);
+
+  void    (*mix)  (const guint    n,
+                   const gdouble *a,
+                   const gdouble *b,
+                   const gdouble *c,
+                   gdouble       *r);
+
+  gdouble (*dot)  (const guint    n,
+                   const gdouble *a,
+                   const gdouble *b);
+
+  void    (*cmul) (const guint    n,
+                   const gdouble *ar,
+                   const gdouble *ai,
+                   const gdouble *br,
+                   const gdouble *bi,
+                   gdouble       *rr,
+                   gdouble       *ri);
+
+  void    (*cdot) (const guint    n,
+                   const gdouble *ar,
+                   const gdouble *ai,
+                   const gdouble *br,
+                   const gdouble *bi,
+                   gdouble       *rr,
+                   gdouble       *ri);
+} CrankVecDoubleKernels;
+
+G_GNUC_INTERNAL
+const CrankVecFloatKernels *_crank_vec_float_get_kernels (void);
+
+G_GNUC_INTERNAL
+const CrankVecDoubleKernels *_crank_vec_double_get_kernels (void);
+
+G_END_DECLS
+
+#endif
+
+#endif
@@ -0,0 +1,1032 @@
+/* Copyright (C) 2015, WSID   */
+
+/* Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/* This is template for SIMD kernels, and is included by crankvecsimd.c once
+ * for each precision. */
+
+#ifndef _CRANKBASE_INSIDE
+#error crankvecsimd-template-private.h cannot be included directly.
+#endif
+
+#ifndef CRANK_VEC_SIMD_T
+#error CRANK_VEC_SIMD_T should be defined before including template.
+#endif
+
+#ifndef __GTK_DOC_IGNORE__
+
+/*
+ * Parameters of template.
+ *
+ * CRANK_VEC_SIMD_T: Element type. (gfloat, gdouble)
+ * CRANK_VEC_SIMD_KERNELS: Kernel set type.
+ * CRANK_VEC_SIMD_FUNC(name): Makes function name with type prefix.
+ * CRANK_VEC_SIMD_GET_KERNELS: Name of kernel selection function.
+ * CRANK_VEC_SIMD_INTRIN(f): Appends type suffix to intrinsic. (_ps, _pd)
+ * CRANK_VEC_SIMD_W: Number of elements in 128 bits.
+ * CRANK_VEC_SIMD_M128, CRANK_VEC_SIMD_M256, CRANK_VEC_SIMD_M512: Vector types.
+ * CRANK_VEC_SIMD_MASK: Mask type for a 512 bits vector.
+ */
+
+#define T       CRANK_VEC_SIMD_T
+#define F(name) CRANK_VEC_SIMD_FUNC(name)
+#define I(f)    CRANK_VEC_SIMD_INTRIN(f)
+
+
+//////// Scalar kernels ////////////////////////////////////////////////////////
+
+#define CRANK_VEC_SIMD_SCALAR_BINARY(name, op) \
+  static void \
+  F(name##_scalar) (const guint  n, \
+                    const T     *a, \
+                    const T     *b, \
+                    T           *r) \
+  { \
+    guint i; \
+    for (i = 0; i < n; i++) \
+      r[i] = a[i] op b[i]; \
+  }
+
+CRANK_VEC_SIMD_SCALAR_BINARY (add, +)
+CRANK_VEC_SIMD_SCALAR_BINARY (sub, -)
+CRANK_VEC_SIMD_SCALAR_BINARY (mul, *)
+CRANK_VEC_SIMD_SCALAR_BINARY (div, /)
+
+static void
+F(muls_scalar) (const guint  n,
+                const T     *a,
+                const T      s,
+                T           *r)
+{
+  guint i;
+
+  for (i = 0; i < n; i++)
+    r[i] = a[i] * s;
+}
+
+static void
+F(divs_scalar) (const guint  n,
+                const T     *a,
+                const T      s,
+                T           *r)
+{
+  guint i;
+
+  for (i = 0; i < n; i++)
+    r[i] = a[i] / s;
+}
+
+static void
+F(mixs_scalar) (const guint  n,
+                const T     *a,
+                const T     *b,
+                const T      s,
+                T           *r)
+{
+  T d = 1 - s;
+  guint i;
+
+  for (i = 0; i < n; i++)
+    r[i] = a[i] * d + b[i] * s;
+}
+
+static void
+F(mix_scalar) (const guint  n,
+               const T     *a,
+               const T     *b,
+               const T     *c,
+               T           *r)
+{
+  guint i;
+
+  for (i = 0; i < n; i++)
+    r[i] = a[i] * (1 - c[i]) + b[i] * c[i];
+}
+
+static T
+F(dot_scalar) (const guint  n,
+               const T     *a,
+               const T     *b)
+{
+  T result = 0;
+  guint i;
+
+  for (i = 0; i < n; i++)
+    result += a[i] * b[i];
+
+  return result;
+}
+
+static void
+F(cmul_scalar) (const guint  n,
+                const T     *ar,
+                const T     *ai,
+                const T     *br,
+                const T     *bi,
+                T           *rr,
+                T           *ri)
+{
+  guint i;
+
+  for (i = 0; i < n; i++)
+    {
+      T re = ar[i] * br[i] - ai[i] * bi[i];
+      T im = ar[i] * bi[i] + ai[i] * br[i];
+
+      rr[i] = re;
+      ri[i] = im;
+    }
+}
+
+static void
+F(cdot_scalar) (const guint  n,
+                const T     *ar,
+                const T     *ai,
+                const T     *br,
+                const T     *bi,
+                T           *rr,
+                T           *ri)
+{
+  T re = 0;
+  T im = 0;
+  guint i;
+
+  for (i = 0; i < n; i++)
+    {
+      re += ar[i] * br[i] + ai[i] * bi[i];
+      im += ai[i] * br[i] - ar[i] * bi[i];
+    }
+
+  *rr = re;
+  *ri = im;
+}
+
+static const CRANK_VEC_SIMD_KERNELS F(kernels_scalar) = {
+  "scalar",
+  F(add_scalar),
+  F(sub_scalar),
+  F(mul_scalar),
+  F(div_scalar),
+  F(muls_scalar),
+  F(divs_scalar),
+  F(mixs_scalar),
+  F(mix_scalar),
+  F(dot_scalar),
+  F(cmul_scalar),
+  F(cdot_scalar)
+};
+
+
+#ifdef CRANK_CPU_X86
+
+//////// SSE2 kernels //////////////////////////////////////////////////////////
+
+#define W128 CRANK_VEC_SIMD_W
+#define V128 CRANK_VEC_SIMD_M128
+
+#define CRANK_VEC_SIMD_SSE2_BINARY(name, vop, op) \
+  __attribute__((target ("sse2"))) \
+  static void \
+  F(name##_sse2) (const guint  n, \
+                  const T     *a, \
+                  const T     *b, \
+                  T           *r) \
+  { \
+    guint i; \
+    for (i = 0; i + W128 <= n; i += W128) \
+      I(_mm_storeu) (r + i, vop (I(_mm_loadu) (a + i), I(_mm_loadu) (b + i))); \
+    for (; i < n; i++) \
+      r[i] = a[i] op b[i]; \
+  }
+
+CRANK_VEC_SIMD_SSE2_BINARY (add, I(_mm_add), +)
+CRANK_VEC_SIMD_SSE2_BINARY (sub, I(_mm_sub), -)
+CRANK_VEC_SIMD_SSE2_BINARY (mul, I(_mm_mul), *)
+CRANK_VEC_SIMD_SSE2_BINARY (div, I(_mm_div), /)
+
+__attribute__((target ("sse2")))
+static void
+F(muls_sse2) (const guint  n,
+              const T     *a,
+              const T      s,
+              T           *r)
+{
+  V128 vs = I(_mm_set1) (s);
+  guint i;
+
+  for (i = 0; i + W128 <= n; i += W128)
+    I(_mm_storeu) (r + i, I(_mm_mul) (I(_mm_loadu) (a + i), vs));
+
+  for (; i < n; i++)
+    r[i] = a[i] * s;
+}
+
+__attribute__((target ("sse2")))
+static void
+F(divs_sse2) (const guint  n,
+              const T     *a,
+              const T      s,
+              T           *r)
+{
+  V128 vs = I(_mm_set1) (s);
+  guint i;
+
+  for (i = 0; i + W128 <= n; i += W128)
+    I(_mm_storeu) (r + i, I(_mm_div) (I(_mm_loadu) (a + i), vs));
+
+  for (; i < n; i++)
+    r[i] = a[i] / s;
+}
+
+__attribute__((target ("sse2")))
+static void
+F(mixs_sse2) (const guint  n,
+              const T     *a,
+              const T     *b,
+              const T      s,
+              T           *r)
+{
+  T d = 1 - s;
+  V128 vs = I(_mm_set1) (s);
+  V128 vd = I(_mm_set1) (d);
+  guint i;
+
+  for (i = 0; i + W128 <= n; i += W128)
+    I(_mm_storeu) (r + i,
+                   I(_mm_add) (I(_mm_mul) (I(_mm_loadu) (a + i), vd),
+                               I(_mm_mul) (I(_mm_loadu) (b + i), vs)));
+
+  for (; i < n; i++)
+    r[i] = a[i] * d + b[i] * s;
+}
+
+__attribute__((target ("sse2")))
+static void
+F(mix_sse2) (const guint  n,
+             const T     *a,
+             const T     *b,
+             const T     *c,
+             T           *r)
+{
+  V128 one = I(_mm_set1) (1);
+  guint i;
+
+  for (i = 0; i + W128 <= n; i += W128)
+    {
+      V128 vc = I(_mm_loadu) (c + i);
+      V128 vd = I(_mm_sub) (one, vc);
+
+      I(_mm_storeu) (r + i,
+                     I(_mm_add) (I(_mm_mul) (I(_mm_loadu) (a + i), vd),
+                                 I(_mm_mul) (I(_mm_loadu) (b + i), vc)));
+    }
+
+  for (; i < n; i++)
+    r[i] = a[i] * (1 - c[i]) + b[i] * c[i];
+}
+
+__attribute__((target ("sse2")))
+static T
+F(dot_sse2) (const guint  n,
+             const T     *a,
+             const T     *b)
+{
+  V128 acc0 = I(_mm_setzero) ();
+  V128 acc1 = I(_mm_setzero) ();
+  T part[W128];
+  T result = 0;
+  guint i;
+  guint j;
+
+  for (i = 0; i + 2 * W128 <= n; i += 2 * W128)
+    {
+      acc0 = I(_mm_add) (acc0, I(_mm_mul) (I(_mm_loadu) (a + i),
+                                           I(_mm_loadu) (b + i)));
+      acc1 = I(_mm_add) (acc1, I(_mm_mul) (I(_mm_loadu) (a + i + W128),
+                                           I(_mm_loadu) (b + i + W128)));
+    }
+
+  I(_mm_storeu) (part, I(_mm_add) (acc0, acc1));
+  for (j = 0; j < W128; j++)
+    result += part[j];
+
+  for (; i < n; i++)
+    result += a[i] * b[i];
+
+  return result;
+}
+
+__attribute__((target ("sse2")))
+static void
+F(cmul_sse2) (const guint  n,
+              const T     *ar,
+              const T     *ai,
+              const T     *br,
+              const T     *bi,
+              T           *rr,
+              T           *ri)
+{
+  guint i;
+
+  for (i = 0; i + W128 <= n; i += W128)
+    {
+      V128 var = I(_mm_loadu) (ar + i);
+      V128 vai = I(_mm_loadu) (ai + i);
+      V128 vbr = I(_mm_loadu) (br + i);
+      V128 vbi = I(_mm_loadu) (bi + i);
+
+      I(_mm_storeu) (rr + i, I(_mm_sub) (I(_mm_mul) (var, vbr),
+                                         I(_mm_mul) (vai, vbi)));
+      I(_mm_storeu) (ri + i, I(_mm_add) (I(_mm_mul) (var, vbi),
+                                         I(_mm_mul) (vai, vbr)));
+    }
+
+  F(cmul_scalar) (n - i, ar + i, ai + i, br + i, bi + i, rr + i, ri + i);
+}
+
+__attribute__((target ("sse2")))
+static void
+F(cdot_sse2) (const guint  n,
+              const T     *ar,
+              const T     *ai,
+              const T     *br,
+              const T     *bi,
+              T           *rr,
+              T           *ri)
+{
+  V128 accr = I(_mm_setzero) ();
+  V128 acci = I(_mm_setzero) ();
+  T partr[W128];
+  T parti[W128];
+  T re;
+  T im;
+  guint i;
+  guint j;
+
+  for (i = 0; i + W128 <= n; i += W128)
+    {
+      V128 var = I(_mm_loadu) (ar + i);
+      V128 vai = I(_mm_loadu) (ai + i);
+      V128 vbr = I(_mm_loadu) (br + i);
+      V128 vbi = I(_mm_loadu) (bi + i);
+
+      accr = I(_mm_add) (accr, I(_mm_add) (I(_mm_mul) (var, vbr),
+                                           I(_mm_mul) (vai, vbi)));
+      acci = I(_mm_add) (acci, I(_mm_sub) (I(_mm_mul) (vai, vbr),
+                                           I(_mm_mul) (var, vbi)));
+    }
+
+  F(cdot_scalar) (n - i, ar + i, ai + i, br + i, bi + i, &re, &im);
+
+  I(_mm_storeu) (partr, accr);
+  I(_mm_storeu) (parti, acci);
+  for (j = 0; j < W128; j++)
+    {
+      re += partr[j];
+      im += parti[j];
+    }
+
+  *rr = re;
+  *ri = im;
+}
+
+static const CRANK_VEC_SIMD_KERNELS F(kernels_sse2) = {
+  "sse2",
+  F(add_sse2),
+  F(sub_sse2),
+  F(mul_sse2),
+  F(div_sse2),
+  F(muls_sse2),
+  F(divs_sse2),
+  F(mixs_sse2),
+  F(mix_sse2),
+  F(dot_sse2),
+  F(cmul_sse2),
+  F(cdot_sse2)
+};
+
+
+//////// AVX2 kernels //////////////////////////////////////////////////////////
+
+#define W256 (2 * CRANK_VEC_SIMD_W)
+#define V256 CRANK_VEC_SIMD_M256
+
+#define CRANK_VEC_SIMD_AVX2_BINARY(name, vop, op) \
+  __attribute__((target ("avx2,fma"))) \
+  static void \
+  F(name##_avx2) (const guint  n, \
+                  const T     *a, \
+                  const T     *b, \
+                  T           *r) \
+  { \
+    guint i; \
+    for (i = 0; i + W256 <= n; i += W256) \
+      I(_mm256_storeu) (r + i, vop (I(_mm256_loadu) (a + i), \
+                                    I(_mm256_loadu) (b + i))); \
+    for (; i < n; i++) \
+      r[i] = a[i] op b[i]; \
+  }
+
+CRANK_VEC_SIMD_AVX2_BINARY (add, I(_mm256_add), +)
+CRANK_VEC_SIMD_AVX2_BINARY (sub, I(_mm256_sub), -)
+CRANK_VEC_SIMD_AVX2_BINARY (mul, I(_mm256_mul), *)
+CRANK_VEC_SIMD_AVX2_BINARY (div, I(_mm256_div), /)
+
+__attribute__((target ("avx2,fma")))
+static void
+F(muls_avx2) (const guint  n,
+              const T     *a,
+              const T      s,
+              T           *r)
+{
+  V256 vs = I(_mm256_set1) (s);
+  guint i;
+
+  for (i = 0; i + W256 <= n; i += W256)
+    I(_mm256_storeu) (r + i, I(_mm256_mul) (I(_mm256_loadu) (a + i), vs));
+
+  for (; i < n; i++)
+    r[i] = a[i] * s;
+}
+
+__attribute__((target ("avx2,fma")))
+static void
+F(divs_avx2) (const guint  n,
+              const T     *a,
+              const T      s,
+              T           *r)
+{
+  V256 vs = I(_mm256_set1) (s);
+  guint i;
+
+  for (i = 0; i + W256 <= n; i += W256)
+    I(_mm256_storeu) (r + i, I(_mm256_div) (I(_mm256_loadu) (a + i), vs));
+
+  for (; i < n; i++)
+    r[i] = a[i] / s;
+}
+
+__attribute__((target ("avx2,fma")))
+static void
+F(mixs_avx2) (const guint  n,
+              const T     *a,
+              const T     *b,
+              const T      s,
+              T           *r)
+{
+  T d = 1 - s;
+  V256 vs = I(_mm256_set1) (s);
+  V256 vd = I(_mm256_set1) (d);
+  guint i;
+
+  for (i = 0; i + W256 <= n; i += W256)
+    I(_mm256_storeu) (r + i,
+                      I(_mm256_fmadd) (I(_mm256_loadu) (a + i), vd,
+                                       I(_mm256_mul) (I(_mm256_loadu) (b + i),
+                                                      vs)));
+
+  for (; i < n; i++)
+    r[i] = a[i] * d + b[i] * s;
+}
+
+__attribute__((target ("avx2,fma")))
+static void
+F(mix_avx2) (const guint  n,
+             const T     *a,
+             const T     *b,
+             const T     *c,
+             T           *r)
+{
+  V256 one = I(_mm256_set1) (1);
+  guint i;
+
+  for (i = 0; i + W256 <= n; i += W256)
+    {
+      V256 vc = I(_mm256_loadu) (c + i);
+      V256 vd = I(_mm256_sub) (one, vc);
+
+      I(_mm256_storeu) (r + i,
+                        I(_mm256_fmadd) (I(_mm256_loadu) (a + i), vd,
+                                         I(_mm256_mul) (I(_mm256_loadu) (b + i),
+                                                        vc)));
+    }
+
+  for (; i < n; i++)
+    r[i] = a[i] * (1 - c[i]) + b[i] * c[i];
+}
+
+__attribute__((target ("avx2,fma")))
+static T
+F(dot_avx2) (const guint  n,
+             const T     *a,
+             const T     *b)
+{
+  V256 acc0 = I(_mm256_setzero) ();
+  V256 acc1 = I(_mm256_setzero) ();
+  V256 acc2 = I(_mm256_setzero) ();
+  V256 acc3 = I(_mm256_setzero) ();
+  T part[W256];
+  T result = 0;
+  guint i;
+  guint j;
+
+  // Four accumulators hides latency of FMA.
+  for (i = 0; i + 4 * W256 <= n; i += 4 * W256)
+    {
+      acc0 = I(_mm256_fmadd) (I(_mm256_loadu) (a + i),
+                              I(_mm256_loadu) (b + i), acc0);
+      acc1 = I(_mm256_fmadd) (I(_mm256_loadu) (a + i + W256),
+                              I(_mm256_loadu) (b + i + W256), acc1);
+      acc2 = I(_mm256_fmadd) (I(_mm256_loadu) (a + i + 2 * W256),
+                              I(_mm256_loadu) (b + i + 2 * W256), acc2);
+      acc3 = I(_mm256_fmadd) (I(_mm256_loadu) (a + i + 3 * W256),
+                              I(_mm256_loadu) (b + i + 3 * W256), acc3);
+    }
+
+  for (; i + W256 <= n; i += W256)
+    acc0 = I(_mm256_fmadd) (I(_mm256_loadu) (a + i),
+                            I(_mm256_loadu) (b + i), acc0);
+
+  acc0 = I(_mm256_add) (I(_mm256_add) (acc0, acc1),
+                        I(_mm256_add) (acc2, acc3));
+
+  I(_mm256_storeu) (part, acc0);
+  for (j = 0; j < W256; j++)
+    result += part[j];
+
+  for (; i < n; i++)
+    result += a[i] * b[i];
+
+  return result;
+}
+
+__attribute__((target ("avx2,fma")))
+static void
+F(cmul_avx2) (const guint  n,
+              const T     *ar,
+              const T     *ai,
+              const T     *br,
+              const T     *bi,
+              T           *rr,
+              T           *ri)
+{
+  guint i;
+
+  for (i = 0; i + W256 <= n; i += W256)
+    {
+      V256 var = I(_mm256_loadu) (ar + i);
+      V256 vai = I(_mm256_loadu) (ai + i);
+      V256 vbr = I(_mm256_loadu) (br + i);
+      V256 vbi = I(_mm256_loadu) (bi + i);
+
+      I(_mm256_storeu) (rr + i, I(_mm256_fmsub) (var, vbr,
+                                                 I(_mm256_mul) (vai, vbi)));
+      I(_mm256_storeu) (ri + i, I(_mm256_fmadd) (var, vbi,
+                                                 I(_mm256_mul) (vai, vbr)));
+    }
+
+  F(cmul_scalar) (n - i, ar + i, ai + i, br + i, bi + i, rr + i, ri + i);
+}
+
+__attribute__((target ("avx2,fma")))
+static void
+F(cdot_avx2) (const guint  n,
+              const T     *ar,
+              const T     *ai,
+              const T     *br,
+              const T     *bi,
+              T           *rr,
+              T           *ri)
+{
+  V256 accr0 = I(_mm256_setzero) ();
+  V256 accr1 = I(_mm256_setzero) ();
+  V256 acci0 = I(_mm256_setzero) ();
+  V256 acci1 = I(_mm256_setzero) ();
+  T partr[W256];
+  T parti[W256];
+  T re;
+  T im;
+  guint i;
+  guint j;
+
+  // Real and imaginary parts have separate accumulators for ar * br and
+  // ai * bi, so that FMA chains are independent.
+  for (i = 0; i + W256 <= n; i += W256)
+    {
+      V256 var = I(_mm256_loadu) (ar + i);
+      V256 vai = I(_mm256_loadu) (ai + i);
+      V256 vbr = I(_mm256_loadu) (br + i);
+      V256 vbi = I(_mm256_loadu) (bi + i);
+
+      accr0 = I(_mm256_fmadd) (var, vbr, accr0);
+      accr1 = I(_mm256_fmadd) (vai, vbi, accr1);
+      acci0 = I(_mm256_fmadd) (vai, vbr, acci0);
+      acci1 = I(_mm256_fmadd) (var, vbi, acci1);
+    }
+
+  F(cdot_scalar) (n - i, ar + i, ai + i, br + i, bi + i, &re, &im);
+
+  I(_mm256_storeu) (partr, I(_mm256_add) (accr0, accr1));
+  I(_mm256_storeu) (parti, I(_mm256_sub) (acci0, acci1));
+  for (j = 0; j < W256; j++)
+    {
+      re += partr[j];
+      im += parti[j];
+    }
+
+  *rr = re;
+  *ri = im;
+}
+
+static const CRANK_VEC_SIMD_KERNELS F(kernels_avx2) = {
+  "avx2",
+  F(add_avx2),
+  F(sub_avx2),
+  F(mul_avx2),
+  F(div_avx2),
+  F(muls_avx2),
+  F(divs_avx2),
+  F(mixs_avx2),
+  F(mix_avx2),
+  F(dot_avx2),
+  F(cmul_avx2),
+  F(cdot_avx2)
+};
+
+
+//////// AVX-512 kernels ///////////////////////////////////////////////////////
+
+#define W512 (4 * CRANK_VEC_SIMD_W)
+#define V512 CRANK_VEC_SIMD_M512
+#define M512 CRANK_VEC_SIMD_MASK
+
+#define CRANK_VEC_SIMD_AVX512_TAIL(n, i) \
+  ((M512) ((1u << ((n) - (i))) - 1))
+
+#define CRANK_VEC_SIMD_AVX512_BINARY(name, vop) \
+  __attribute__((target ("avx512f"))) \
+  static void \
+  F(name##_avx512) (const guint  n, \
+                    const T     *a, \
+                    const T     *b, \
+                    T           *r) \
+  { \
+    M512 m; \
+    guint i; \
+    for (i = 0; i + W512 <= n; i += W512) \
+      I(_mm512_storeu) (r + i, vop (I(_mm512_loadu) (a + i), \
+                                    I(_mm512_loadu) (b + i))); \
+    if (i < n) \
+      { \
+        m = CRANK_VEC_SIMD_AVX512_TAIL (n, i); \
+        I(_mm512_mask_storeu) (r + i, m, \
+                               vop (I(_mm512_maskz_loadu) (m, a + i), \
+                                    I(_mm512_mask_loadu) (I(_mm512_set1) (1), \
+                                                          m, b + i))); \
+      } \
+  }
+
+// Masked out lanes of b are 1, so that division does not raise exception.
+CRANK_VEC_SIMD_AVX512_BINARY (add, I(_mm512_add))
+CRANK_VEC_SIMD_AVX512_BINARY (sub, I(_mm512_sub))
+CRANK_VEC_SIMD_AVX512_BINARY (mul, I(_mm512_mul))
+CRANK_VEC_SIMD_AVX512_BINARY (div, I(_mm512_div))
+
+__attribute__((target ("avx512f")))
+static void
+F(muls_avx512) (const guint  n,
+                const T     *a,
+                const T      s,
+                T           *r)
+{
+  V512 vs = I(_mm512_set1) (s);
+  M512 m;
+  guint i;
+
+  for (i = 0; i + W512 <= n; i += W512)
+    I(_mm512_storeu) (r + i, I(_mm512_mul) (I(_mm512_loadu) (a + i), vs));
+
+  if (i < n)
+    {
+      m = CRANK_VEC_SIMD_AVX512_TAIL (n, i);
+      I(_mm512_mask_storeu) (r + i, m,
+                             I(_mm512_mul) (I(_mm512_maskz_loadu) (m, a + i),
+                                            vs));
+    }
+}
+
+__attribute__((target ("avx512f")))
+static void
+F(divs_avx512) (const guint  n,
+                const T     *a,
+                const T      s,
+                T           *r)
+{
+  V512 vs = I(_mm512_set1) (s);
+  M512 m;
+  guint i;
+
+  for (i = 0; i + W512 <= n; i += W512)
+    I(_mm512_storeu) (r + i, I(_mm512_div) (I(_mm512_loadu) (a + i), vs));
+
+  if (i < n)
+    {
+      m = CRANK_VEC_SIMD_AVX512_TAIL (n, i);
+      I(_mm512_mask_storeu) (r + i, m,
+                             I(_mm512_div) (I(_mm512_maskz_loadu) (m, a + i),
+                                            vs));
+    }
+}
+
+__attribute__((target ("avx512f")))
+static void
+F(mixs_avx512) (const guint  n,
+                const T     *a,
+                const T     *b,
+                const T      s,
+                T           *r)
+{
+  V512 vs = I(_mm512_set1) (s);
+  V512 vd = I(_mm512_set1) (1 - s);
+  M512 m;
+  guint i;
+
+  for (i = 0; i + W512 <= n; i += W512)
+    I(_mm512_storeu) (r + i,
+                      I(_mm512_fmadd) (I(_mm512_loadu) (a + i), vd,
+                                       I(_mm512_mul) (I(_mm512_loadu) (b + i),
+                                                      vs)));
+
+  if (i < n)
+    {
+      m = CRANK_VEC_SIMD_AVX512_TAIL (n, i);
+      I(_mm512_mask_storeu) (r + i, m,
+                             I(_mm512_fmadd) (I(_mm512_maskz_loadu) (m, a + i),
+                                              vd,
+                                              I(_mm512_mul) (
+                                                I(_mm512_maskz_loadu) (m, b + i),
+                                                vs)));
+    }
+}
+
+__attribute__((target ("avx512f")))
+static void
+F(mix_avx512) (const guint  n,
+               const T     *a,
+               const T     *b,
+               const T     *c,
+               T           *r)
+{
+  V512 one = I(_mm512_set1) (1);
+  V512 vc;
+  M512 m;
+  guint i;
+
+  for (i = 0; i + W512 <= n; i += W512)
+    {
+      vc = I(_mm512_loadu) (c + i);
+      I(_mm512_storeu) (r + i,
+                        I(_mm512_fmadd) (I(_mm512_loadu) (a + i),
+                                         I(_mm512_sub) (one, vc),
+                                         I(_mm512_mul) (I(_mm512_loadu) (b + i),
+                                                        vc)));
+    }
+
+  if (i < n)
+    {
+      m = CRANK_VEC_SIMD_AVX512_TAIL (n, i);
+      vc = I(_mm512_maskz_loadu) (m, c + i);
+      I(_mm512_mask_storeu) (r + i, m,
+                             I(_mm512_fmadd) (I(_mm512_maskz_loadu) (m, a + i),
+                                              I(_mm512_sub) (one, vc),
+                                              I(_mm512_mul) (
+                                                I(_mm512_maskz_loadu) (m, b + i),
+                                                vc)));
+    }
+}
+
+__attribute__((target ("avx512f")))
+static T
+F(dot_avx512) (const guint  n,
+               const T     *a,
+               const T     *b)
+{
+  V512 acc0 = I(_mm512_setzero) ();
+  V512 acc1 = I(_mm512_setzero) ();
+  M512 m;
+  guint i;
+
+  for (i = 0; i + 2 * W512 <= n; i += 2 * W512)
+    {
+      acc0 = I(_mm512_fmadd) (I(_mm512_loadu) (a + i),
+                              I(_mm512_loadu) (b + i), acc0);
+      acc1 = I(_mm512_fmadd) (I(_mm512_loadu) (a + i + W512),
+                              I(_mm512_loadu) (b + i + W512), acc1);
+    }
+
+  for (; i + W512 <= n; i += W512)
+    acc0 = I(_mm512_fmadd) (I(_mm512_loadu) (a + i),
+                            I(_mm512_loadu) (b + i), acc0);
+
+  if (i < n)
+    {
+      m = CRANK_VEC_SIMD_AVX512_TAIL (n, i);
+      acc1 = I(_mm512_fmadd) (I(_mm512_maskz_loadu) (m, a + i),
+                              I(_mm512_maskz_loadu) (m, b + i), acc1);
+    }
+
+  return I(_mm512_reduce_add) (I(_mm512_add) (acc0, acc1));
+}
+
+__attribute__((target ("avx512f")))
+static void
+F(cmul_avx512) (const guint  n,
+                const T     *ar,
+                const T     *ai,
+                const T     *br,
+                const T     *bi,
+                T           *rr,
+                T           *ri)
+{
+  V512 var;
+  V512 vai;
+  V512 vbr;
+  V512 vbi;
+  M512 m;
+  guint i;
+
+  for (i = 0; i + W512 <= n; i += W512)
+    {
+      var = I(_mm512_loadu) (ar + i);
+      vai = I(_mm512_loadu) (ai + i);
+      vbr = I(_mm512_loadu) (br + i);
+      vbi = I(_mm512_loadu) (bi + i);
+
+      I(_mm512_storeu) (rr + i, I(_mm512_fmsub) (var, vbr,
+                                                 I(_mm512_mul) (vai, vbi)));
+      I(_mm512_storeu) (ri + i, I(_mm512_fmadd) (var, vbi,
+                                                 I(_mm512_mul) (vai, vbr)));
+    }
+
+  if (i < n)
+    {
+      m = CRANK_VEC_SIMD_AVX512_TAIL (n, i);
+      var = I(_mm512_maskz_loadu) (m, ar + i);
+      vai = I(_mm512_maskz_loadu) (m, ai + i);
+      vbr = I(_mm512_maskz_loadu) (m, br + i);
+      vbi = I(_mm512_maskz_loadu) (m, bi + i);
+
+      I(_mm512_mask_storeu) (rr + i, m,
+                             I(_mm512_fmsub) (var, vbr,
+                                              I(_mm512_mul) (vai, vbi)));
+      I(_mm512_mask_storeu) (ri + i, m,
+                             I(_mm512_fmadd) (var, vbi,
+                                              I(_mm512_mul) (vai, vbr)));
+    }
+}
+
+__attribute__((target ("avx512f")))
+static void
+F(cdot_avx512) (const guint  n,
+                const T     *ar,
+                const T     *ai,
+                const T     *br,
+                const T     *bi,
+                T           *rr,
+                T           *ri)
+{
+  V512 accr0 = I(_mm512_setzero) ();
+  V512 accr1 = I(_mm512_setzero) ();
+  V512 acci0 = I(_mm512_setzero) ();
+  V512 acci1 = I(_mm512_setzero) ();
+  V512 var;
+  V512 vai;
+  V512 vbr;
+  V512 vbi;
+  M512 m;
+  guint i;
+
+  for (i = 0; i + W512 <= n; i += W512)
+    {
+      var = I(_mm512_loadu) (ar + i);
+      vai = I(_mm512_loadu) (ai + i);
+      vbr = I(_mm512_loadu) (br + i);
+      vbi = I(_mm512_loadu) (bi + i);
+
+      accr0 = I(_mm512_fmadd) (var, vbr, accr0);
+      accr1 = I(_mm512_fmadd) (vai, vbi, accr1);
+      acci0 = I(_mm512_fmadd) (vai, vbr, acci0);
+      acci1 = I(_mm512_fmadd) (var, vbi, acci1);
+    }
+
+  if (i < n)
+    {
+      m = CRANK_VEC_SIMD_AVX512_TAIL (n, i);
+      var = I(_mm512_maskz_loadu) (m, ar + i);
+      vai = I(_mm512_maskz_loadu) (m, ai + i);
+      vbr = I(_mm512_maskz_loadu) (m, br + i);
+      vbi = I(_mm512_maskz_loadu) (m, bi + i);
+
+      accr0 = I(_mm512_fmadd) (var, vbr, accr0);
+      accr1 = I(_mm512_fmadd) (vai, vbi, accr1);
+      acci0 = I(_mm512_fmadd) (vai, vbr, acci0);
+      acci1 = I(_mm512_fmadd) (var, vbi, acci1);
+    }
+
+  *rr = I(_mm512_reduce_add) (I(_mm512_add) (accr0, accr1));
+  *ri = I(_mm512_reduce_add) (I(_mm512_sub) (acci0, acci1));
+}
+
+static const CRANK_VEC_SIMD_KERNELS F(kernels_avx512) = {
+  "avx512",
+  F(add_avx512),
+  F(sub_avx512),
+  F(mul_avx512),
+  F(div_avx512),
+  F(muls_avx512),
+  F(divs_avx512),
+  F(mixs_avx512),
+  F(mix_avx512),
+  F(dot_avx512),
+  F(cmul_avx512),
+  F(cdot_avx512)
+};
+
+#undef CRANK_VEC_SIMD_SSE2_BINARY
+#undef CRANK_VEC_SIMD_AVX2_BINARY
+#undef CRANK_VEC_SIMD_AVX512_BINARY
+#undef CRANK_VEC_SIMD_AVX512_TAIL
+#undef W128
+#undef V128
+#undef W256
+#undef V256
+#undef W512
+#undef V512
+#undef M512
+
+#endif
+
+
+//////// Kernel selection //////////////////////////////////////////////////////
+
+/* Gets kernel set for current SIMD level. It is selected when it is first
+ * called. */
+const CRANK_VEC_SIMD_KERNELS*
+CRANK_VEC_SIMD_GET_KERNELS (void)
+{
+  static gsize kernels = 0;
+
+  if (g_once_init_enter (&kernels))
+    {
+      const CRANK_VEC_SIMD_KERNELS *selected = &F(kernels_scalar);
+
+#ifdef CRANK_CPU_X86
+      switch (_crank_cpu_get_simd_level ())
+        {
+        case CRANK_CPU_SIMD_AVX512:
+          selected = &F(kernels_avx512);
+          break;
+
+        case CRANK_CPU_SIMD_AVX2:
+          selected = &F(kernels_avx2);
+          break;
+
+        case CRANK_CPU_SIMD_AVX:
+        case CRANK_CPU_SIMD_SSE2:
+          selected = &F(kernels_sse2);
+          break;
+
+        default:
+          break;
+        }
+#endif
+
+      g_once_init_leave (&kernels, (gsize) selected);
+    }
+
+  return (const CRANK_VEC_SIMD_KERNELS*) kernels;
+}
+
+#undef CRANK_VEC_SIMD_SCALAR_BINARY
+#undef T
+#undef F
+#undef I
+
+#endif
@@ -0,0 +1,90 @@
+/* Copyright (C) 2015, WSID   */
+
+/* Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+#define _CRANKBASE_INSIDE
+
+#include <string.h>
+
+#include <glib.h>
+
+#include "crankcpu-private.h"
+#include "crankvecsimd-private.h"
+
+#ifdef CRANK_CPU_X86
+#include <immintrin.h>
+#endif
+
+/*
+ * Element-wise kernels for variable sized float and double vectors.
+ *
+ * There are kernel sets for each of SIMD level: scalar, SSE2 (128 bits), AVX2
+ * with FMA (256 bits) and AVX-512F (512 bits). A set is selected when it is
+ * first requested, by _crank_cpu_get_simd_level(), so it can be limited by
+ * CRANK_SIMD environment variable.
+ *
+ * Kernels use unaligned load and store, as aligned and unaligned ones have same
+ * speed on aligned address, on recent processors. Remaining elements are
+ * processed by scalar loop, or by masked load and store on AVX-512.
+ *
+ * Kernels are written once in crankvecsimd-template-private.h, and are
+ * instantiated for each precision here.
+ */
+
+//////// Float kernels /////////////////////////////////////////////////////////
+
+#define CRANK_VEC_SIMD_T              gfloat
+#define CRANK_VEC_SIMD_KERNELS        CrankVecFloatKernels
+#define CRANK_VEC_SIMD_FUNC(name)     crank_vec_float_##name
+#define CRANK_VEC_SIMD_GET_KERNELS    _crank_vec_float_get_kernels
+#define CRANK_VEC_SIMD_INTRIN(f)      f##_ps
+#define CRANK_VEC_SIMD_W              4
+#define CRANK_VEC_SIMD_M128           __m128
+#define CRANK_VEC_SIMD_M256           __m256
+#define CRANK_VEC_SIMD_M512           __m512
+#define CRANK_VEC_SIMD_MASK           __mmask16
+
+#include "crankvecsimd-template-private.h"
+
+#undef CRANK_VEC_SIMD_T
+#undef CRANK_VEC_SIMD_KERNELS
+#undef CRANK_VEC_SIMD_FUNC
+#undef CRANK_VEC_SIMD_GET_KERNELS
+#undef CRANK_VEC_SIMD_INTRIN
+#undef CRANK_VEC_SIMD_W
+#undef CRANK_VEC_SIMD_M128
+#undef CRANK_VEC_SIMD_M256
+#undef CRANK_VEC_SIMD_M512
+#undef CRANK_VEC_SIMD_MASK
+
+
+//////// Double kernels ////////////////////////////////////////////////////////
+
+#define CRANK_VEC_SIMD_T              gdouble
+#define CRANK_VEC_SIMD_KERNELS        CrankVecDoubleKernels
+#define CRANK_VEC_SIMD_FUNC(name)     crank_vec_double_##name
+#define CRANK_VEC_SIMD_GET_KERNELS    _crank_vec_double_get_kernels
+#define CRANK_VEC_SIMD_INTRIN(f)      f##_pd
+#define CRANK_VEC_SIMD_W              2
+#define CRANK_VEC_SIMD_M128           __m128d
+#define CRANK_VEC_SIMD_M256           __m256d
+#define CRANK_VEC_SIMD_M512           __m512d
+#define CRANK_VEC_SIMD_MASK           __mmask8
+
+#include "crankvecsimd-template-private.h"
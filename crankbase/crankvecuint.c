@@ -34,6 +34,8 @@
 #include "crankvecuint.h"
 #include "crankvecint.h"
 
+#include "crankvecmask-private.h"
+
 /**
  * SECTION: crankvecuint
  * @title: Unsigned Integer Vectors
@@ -3854,6 +3856,284 @@ crank_vec_uint_n_max (const CrankVecUintN *a,
     }
 }
 
+//////// Masked operations ////////
+
+/**
+ * crank_vec_uint_n_blend:
+ * @a: A vector.
+ * @b: A vector.
+ * @mask: A mask.
+ * @r: (out): A vector to store result.
+ *
+ * Selects components of @b where @mask is %TRUE, and components of @a
+ * elsewhere.
+ */
+void
+crank_vec_uint_n_blend (const CrankVecUintN *a,
+                        const CrankVecUintN *b,
+                        const CrankVecBoolN *mask,
+                        CrankVecUintN       *r)
+{
+  g_return_if_fail (a != r);
+  g_return_if_fail (b != r);
+
+  CRANK_VEC_WARN_IF_SIZE_MISMATCH2 ("VecUintN", "blend", a, b);
+  CRANK_VEC_WARN_IF_SIZE_MISMATCH2 ("VecUintN", "blend", a, mask);
+  CRANK_VEC_ALLOC (r, guint, a->n);
+
+  _crank_vec_mask_uint_get_kernels ()->blend (a->n, a->data, b->data,
+                                              mask->data, r->data);
+}
+
+/**
+ * crank_vec_uint_n_cmpblend:
+ * @a: A vector.
+ * @op: Comparison.
+ * @b: A vector.
+ * @x: A vector.
+ * @y: A vector.
+ * @r: (out): A vector to store result.
+ *
+ * Compares components of @a and @b by @op, and selects components of @x where
+ * it holds, and components of @y elsewhere.
+ *
+ * This runs as a single pass, without making intermediate #CrankVecBoolN.
+ */
+void
+crank_vec_uint_n_cmpblend (const CrankVecUintN *a,
+                           const CrankVecCmpOp  op,
+                           const CrankVecUintN *b,
+                           const CrankVecUintN *x,
+                           const CrankVecUintN *y,
+                           CrankVecUintN       *r)
+{
+  g_return_if_fail (a != r);
+  g_return_if_fail (b != r);
+  g_return_if_fail (x != r);
+  g_return_if_fail (y != r);
+
+  CRANK_VEC_WARN_IF_SIZE_MISMATCH2 ("VecUintN", "cmpblend", a, b);
+  CRANK_VEC_WARN_IF_SIZE_MISMATCH2 ("VecUintN", "cmpblend", a, x);
+  CRANK_VEC_WARN_IF_SIZE_MISMATCH2 ("VecUintN", "cmpblend", a, y);
+  CRANK_VEC_ALLOC (r, guint, a->n);
+
+  _crank_vec_mask_uint_get_kernels ()->cmpblend (a->n, op, a->data, b->data,
+                                                 x->data, y->data, r->data);
+}
+
+/**
+ * crank_vec_uint_n_cmpcount:
+ * @a: A vector.
+ * @op: Comparison.
+ * @b: A vector.
+ *
+ * Counts components where comparison of @a and @b by @op holds.
+ *
+ * Returns: Count of components.
+ */
+guint
+crank_vec_uint_n_cmpcount (const CrankVecUintN *a,
+                           const CrankVecCmpOp  op,
+                           const CrankVecUintN *b)
+{
+  CRANK_VEC_WARN_IF_SIZE_MISMATCH2_RET ("VecUintN", "cmpcount", a, b, 0);
+
+  return _crank_vec_mask_uint_get_kernels ()->cmpcount (a->n, op, a->data,
+                                                        b->data);
+}
+
+/**
+ * crank_vec_uint_n_masked_add:
+ * @a: A vector.
+ * @b: A vector.
+ * @mask: A mask.
+ * @r: (out): A vector to store result.
+ *
+ * Adds components of @b to @a, only where @mask is %TRUE. Other
+ * components are same as @a.
+ */
+void
+crank_vec_uint_n_masked_add (const CrankVecUintN *a,
+                             const CrankVecUintN *b,
+                             const CrankVecBoolN *mask,
+                             CrankVecUintN       *r)
+{
+  g_return_if_fail (a != r);
+  g_return_if_fail (b != r);
+
+  CRANK_VEC_WARN_IF_SIZE_MISMATCH2 ("VecUintN", "masked-add", a, b);
+  CRANK_VEC_WARN_IF_SIZE_MISMATCH2 ("VecUintN", "masked-add", a, mask);
+  CRANK_VEC_ALLOC (r, guint, a->n);
+
+  _crank_vec_mask_uint_get_kernels ()->masked_add (a->n, a->data, b->data,
+                                                   mask->data, r->data);
+}
+
+/**
+ * crank_vec_uint_n_masked_add_self:
+ * @a: A vector.
+ * @b: A vector.
+ * @mask: A mask.
+ *
+ * Adds components of @b to @a, only where @mask is %TRUE.
+ */
+void
+crank_vec_uint_n_masked_add_self (CrankVecUintN       *a,
+                                  const CrankVecUintN *b,
+                                  const CrankVecBoolN *mask)
+{
+  CRANK_VEC_WARN_IF_SIZE_MISMATCH2 ("VecUintN", "masked-add-self", a, b);
+  CRANK_VEC_WARN_IF_SIZE_MISMATCH2 ("VecUintN", "masked-add-self", a, mask);
+
+  _crank_vec_mask_uint_get_kernels ()->masked_add (a->n, a->data, b->data,
+                                                   mask->data, a->data);
+}
+
+/**
+ * crank_vec_uint_n_masked_mul:
+ * @a: A vector.
+ * @b: A vector.
+ * @mask: A mask.
+ * @r: (out): A vector to store result.
+ *
+ * Multiplies components of @a by @b, only where @mask is %TRUE. Other
+ * components are same as @a.
+ */
+void
+crank_vec_uint_n_masked_mul (const CrankVecUintN *a,
+                             const CrankVecUintN *b,
+                             const CrankVecBoolN *mask,
+                             CrankVecUintN       *r)
+{
+  g_return_if_fail (a != r);
+  g_return_if_fail (b != r);
+
+  CRANK_VEC_WARN_IF_SIZE_MISMATCH2 ("VecUintN", "masked-mul", a, b);
+  CRANK_VEC_WARN_IF_SIZE_MISMATCH2 ("VecUintN", "masked-mul", a, mask);
+  CRANK_VEC_ALLOC (r, guint, a->n);
+
+  _crank_vec_mask_uint_get_kernels ()->masked_mul (a->n, a->data, b->data,
+                                                   mask->data, r->data);
+}
+
+/**
+ * crank_vec_uint_n_masked_mul_self:
+ * @a: A vector.
+ * @b: A vector.
+ * @mask: A mask.
+ *
+ * Multiplies components of @a by @b, only where @mask is %TRUE.
+ */
+void
+crank_vec_uint_n_masked_mul_self (CrankVecUintN       *a,
+                                  const CrankVecUintN *b,
+                                  const CrankVecBoolN *mask)
+{
+  CRANK_VEC_WARN_IF_SIZE_MISMATCH2 ("VecUintN", "masked-mul-self", a, b);
+  CRANK_VEC_WARN_IF_SIZE_MISMATCH2 ("VecUintN", "masked-mul-self", a, mask);
+
+  _crank_vec_mask_uint_get_kernels ()->masked_mul (a->n, a->data, b->data,
+                                                   mask->data, a->data);
+}
+
+/**
+ * crank_vec_uint_n_compress:
+ * @a: A vector.
+ * @mask: A mask.
+ * @r: (out): A vector to store result.
+ *
+ * Gathers components of @a where @mask is %TRUE, keeping order. Size of @r is
+ * count of %TRUE in @mask.
+ */
+void
+crank_vec_uint_n_compress (const CrankVecUintN *a,
+                           const CrankVecBoolN *mask,
+                           CrankVecUintN       *r)
+{
+  guint count;
+
+  g_return_if_fail (a != r);
+
+  CRANK_VEC_WARN_IF_SIZE_MISMATCH2 ("VecUintN", "compress", a, mask);
+
+  count = crank_vec_bool_n_get_count ((CrankVecBoolN*) mask);
+  CRANK_VEC_ALLOC (r, guint, count);
+
+  _crank_vec_mask_uint_get_kernels ()->compress (a->n, a->data, mask->data,
+                                                 r->data);
+}
+
+/**
+ * crank_vec_uint_n_cmpcompress:
+ * @a: A vector.
+ * @op: Comparison.
+ * @b: A vector.
+ * @r: (out): A vector to store result.
+ *
+ * Gathers components of @a where comparison of @a and @b by @op holds,
+ * keeping order.
+ *
+ * This is same as crank_vec_uint_n_compress() with result of comparison, but
+ * does not make intermediate #CrankVecBoolN.
+ */
+void
+crank_vec_uint_n_cmpcompress (const CrankVecUintN *a,
+                              const CrankVecCmpOp  op,
+                              const CrankVecUintN *b,
+                              CrankVecUintN       *r)
+{
+  guint count;
+
+  g_return_if_fail (a != r);
+  g_return_if_fail (b != r);
+
+  CRANK_VEC_WARN_IF_SIZE_MISMATCH2 ("VecUintN", "cmpcompress", a, b);
+
+  count = _crank_vec_mask_uint_get_kernels ()->cmpcount (a->n, op, a->data,
+                                                         b->data);
+  CRANK_VEC_ALLOC (r, guint, count);
+
+  _crank_vec_mask_uint_get_kernels ()->cmpcompress (a->n, op, a->data, b->data,
+                                                    r->data);
+}
+
+/**
+ * crank_vec_uint_n_expand:
+ * @a: A vector.
+ * @mask: A mask.
+ * @fill: A value to fill.
+ * @r: (out): A vector to store result.
+ *
+ * Scatters components of @a in order, to positions where @mask is %TRUE.
+ * Other positions are filled with @fill. Size of @r is same as @mask.
+ *
+ * This is inverse of crank_vec_uint_n_compress(). @a should have at least as
+ * many components as %TRUE in @mask.
+ */
+void
+crank_vec_uint_n_expand (const CrankVecUintN *a,
+                         const CrankVecBoolN *mask,
+                         const guint          fill,
+                         CrankVecUintN       *r)
+{
+  guint count;
+
+  g_return_if_fail (a != r);
+
+  count = crank_vec_bool_n_get_count ((CrankVecBoolN*) mask);
+
+  if (G_UNLIKELY (a->n < count))
+    {
+      g_warning ("VecUintN: expand: size mismatch: %u, %u", a->n, count);
+      return;
+    }
+
+  CRANK_VEC_ALLOC (r, guint, mask->n);
+
+  _crank_vec_mask_uint_get_kernels ()->expand (mask->n, a->data, mask->data,
+                                               fill, r->data);
+}
+
 //////// GValue Transformation /////////////////////////////////////////////////
 
 static void
@@ -824,6 +824,56 @@ void          crank_vec_uint_n_max        (const CrankVecUintN *a,
                                            const CrankVecUintN *b,
                                            CrankVecUintN       *r);
 
+//////// Masked operations ////////
+
+void          crank_vec_uint_n_blend           (const CrankVecUintN *a,
+                                                const CrankVecUintN *b,
+                                                const CrankVecBoolN *mask,
+                                                CrankVecUintN       *r);
+
+void          crank_vec_uint_n_cmpblend        (const CrankVecUintN *a,
+                                                const CrankVecCmpOp  op,
+                                                const CrankVecUintN *b,
+                                                const CrankVecUintN *x,
+                                                const CrankVecUintN *y,
+                                                CrankVecUintN       *r);
+
+guint         crank_vec_uint_n_cmpcount        (const CrankVecUintN *a,
+                                                const CrankVecCmpOp  op,
+                                                const CrankVecUintN *b);
+
+void          crank_vec_uint_n_masked_add      (const CrankVecUintN *a,
+                                                const CrankVecUintN *b,
+                                                const CrankVecBoolN *mask,
+                                                CrankVecUintN       *r);
+
+void          crank_vec_uint_n_masked_add_self (CrankVecUintN       *a,
+                                                const CrankVecUintN *b,
+                                                const CrankVecBoolN *mask);
+
+void          crank_vec_uint_n_masked_mul      (const CrankVecUintN *a,
+                                                const CrankVecUintN *b,
+                                                const CrankVecBoolN *mask,
+                                                CrankVecUintN       *r);
+
+void          crank_vec_uint_n_masked_mul_self (CrankVecUintN       *a,
+                                                const CrankVecUintN *b,
+                                                const CrankVecBoolN *mask);
+
+void          crank_vec_uint_n_compress        (const CrankVecUintN *a,
+                                                const CrankVecBoolN *mask,
+                                                CrankVecUintN       *r);
+
+void          crank_vec_uint_n_cmpcompress     (const CrankVecUintN *a,
+                                                const CrankVecCmpOp  op,
+                                                const CrankVecUintN *b,
+                                                CrankVecUintN       *r);
+
+void          crank_vec_uint_n_expand          (const CrankVecUintN *a,
+                                                const CrankVecBoolN *mask,
+                                                const guint          fill,
+                                                CrankVecUintN       *r);
+
 
 
 G_END_DECLS
@@ -39,6 +39,13 @@
  *
  * Currently, different scaling factor by axes is not supported, as it introduces
  * shear in play.
+ *
+ * # Hierarchy
+ *
+ * Scene hierarchies are often stored as arrays of local transformations, with
+ * index of parent for each node. crank_trans3_flatten() computes world
+ * transformations of whole hierarchy at once, when nodes are sorted so that
+ * parents come before their children.
  */
 
 
@@ -48,6 +55,30 @@ G_DEFINE_BOXED_TYPE (CrankTrans2, crank_trans2, crank_trans2_dup, g_free);
 G_DEFINE_BOXED_TYPE (CrankTrans3, crank_trans3, crank_trans3_dup, g_free);
 
 
+//////// Private Type //////////////////////////////////////////////////////////
+
+// Minimum count of nodes, that a thread processes in flattening.
+#define CRANK_TRANS3_FLATTEN_GRAIN 4096
+
+typedef struct _CrankTrans3FlattenArgs {
+  const gint        *parents;
+  const CrankTrans3 *locals;
+  CrankTrans3       *worlds;
+  const guint       *order;
+} CrankTrans3FlattenArgs;
+
+
+//////// Private Functions /////////////////////////////////////////////////////
+
+static inline void  crank_trans3_compose_inline (const CrankTrans3 *a,
+                                                 const CrankTrans3 *b,
+                                                 CrankTrans3       *r);
+
+static void         crank_trans3_flatten_range (const guint start,
+                                                const guint end,
+                                                gpointer    userdata);
+
+
 //////// Initialization functions. /////////////////////////////////////////////
 
 /**
@@ -784,3 +815,288 @@ crank_trans3_trans_plane (CrankTrans3 *a,
   r->dist_origin = crank_vec_float3_dot (& a->mtrans, & r->normal) +
                    a->mscl * p->dist_origin;
 }
+
+
+//////// Batch operations //////////////////////////////////////////////////////
+
+/**
+ * crank_trans3_batch_compose:
+ * @n: Count of transformations.
+ * @a: (array length=n): Transformations.
+ * @b: (array length=n): Other transformations.
+ * @r: (out caller-allocates) (array length=n): Array to store results.
+ *
+ * Applies each of @a to corresponding element of @b, as
+ * crank_trans3_compose() does. @r may be same with @a or @b.
+ */
+void
+crank_trans3_batch_compose (const guint        n,
+                            const CrankTrans3 *a,
+                            const CrankTrans3 *b,
+                            CrankTrans3       *r)
+{
+  guint i;
+
+  for (i = 0; i < n; i++)
+    crank_trans3_compose_inline (a + i, b + i, r + i);
+}
+
+/**
+ * crank_trans3_batch_transv:
+ * @n: Count of vectors.
+ * @a: A transformation.
+ * @b: (array length=n): Vectors.
+ * @r: (out caller-allocates) (array length=n): Array to store results.
+ *
+ * Transforms @n vectors by a transformation. @r may be same with @b.
+ *
+ * The transformation is converted into matrix once, so this is faster than
+ * calling crank_trans3_transv() for each vectors.
+ */
+void
+crank_trans3_batch_transv (const guint           n,
+                           const CrankTrans3    *a,
+                           const CrankVecFloat3 *b,
+                           CrankVecFloat3       *r)
+{
+  CrankMatFloat4 mat;
+
+  crank_trans3_to_matrix ((CrankTrans3 *) a, &mat);
+  crank_mat_float4_batch_transform (n, &mat, b, r);
+}
+
+/**
+ * crank_trans3_soa_transv:
+ * @n: Count of vectors.
+ * @a: A transformation.
+ * @x: (array length=n): X components of vectors.
+ * @y: (array length=n): Y components of vectors.
+ * @z: (array length=n): Z components of vectors.
+ * @rx: (out caller-allocates) (array length=n): X components of results.
+ * @ry: (out caller-allocates) (array length=n): Y components of results.
+ * @rz: (out caller-allocates) (array length=n): Z components of results.
+ *
+ * Transforms @n vectors, which are stored as separated streams of components.
+ * Result streams may be same with input streams.
+ */
+void
+crank_trans3_soa_transv (const guint        n,
+                         const CrankTrans3 *a,
+                         const gfloat      *x,
+                         const gfloat      *y,
+                         const gfloat      *z,
+                         gfloat            *rx,
+                         gfloat            *ry,
+                         gfloat            *rz)
+{
+  CrankMatFloat4 mat;
+
+  crank_trans3_to_matrix ((CrankTrans3 *) a, &mat);
+  crank_mat_float4_soa_transform (n, &mat, x, y, z, rx, ry, rz);
+}
+
+
+//////// Hierarchy /////////////////////////////////////////////////////////////
+
+/**
+ * crank_trans3_flatten:
+ * @n: Count of nodes.
+ * @parents: (array length=n): Index of parent for each node, or negative value
+ *     for root nodes.
+ * @locals: (array length=n): Transformations of nodes, relative to parents.
+ * @worlds: (out caller-allocates) (array length=n): Array to store world
+ *     transformations.
+ *
+ * Computes world transformations of nodes in a hierarchy. Nodes should be in
+ * topological order, that is, parent of node i should be less than i. If any
+ * node breaks the order, nothing is written to @worlds.
+ *
+ * Each world transformation is computed by applying world transformation of
+ * parent to local transformation, in a single pass over arrays. @worlds may be
+ * same with @locals.
+ *
+ * This runs on threads by global setting. See crank_parallel_set_n_threads().
+ */
+void
+crank_trans3_flatten (const guint        n,
+                      const gint        *parents,
+                      const CrankTrans3 *locals,
+                      CrankTrans3       *worlds)
+{
+  crank_trans3_flatten_parallel (n, parents, locals, worlds,
+                                 crank_parallel_get_n_threads ());
+}
+
+/**
+ * crank_trans3_flatten_parallel:
+ * @n: Count of nodes.
+ * @parents: (array length=n): Index of parent for each node, or negative value
+ *     for root nodes.
+ * @locals: (array length=n): Transformations of nodes, relative to parents.
+ * @worlds: (out caller-allocates) (array length=n): Array to store world
+ *     transformations.
+ * @n_threads: Number of threads, or 0 for number of processors.
+ *
+ * Computes world transformations of nodes in a hierarchy, with given number of
+ * threads. See crank_trans3_flatten().
+ *
+ * Nodes are grouped by depth in hierarchy, and nodes in same depth are split
+ * across threads. Depths are processed in order, as a node depends on its
+ * parent. For small or deep and narrow hierarchy, this runs on calling thread.
+ */
+void
+crank_trans3_flatten_parallel (const guint        n,
+                               const gint        *parents,
+                               const CrankTrans3 *locals,
+                               CrankTrans3       *worlds,
+                               const guint        n_threads)
+{
+  CrankTrans3FlattenArgs args = {parents, locals, worlds, NULL};
+
+  guint *depths;
+  guint *offsets;
+  guint *order;
+  guint n_depths;
+  guint i;
+
+  // Checks whole hierarchy before writing anything, so that invalid parents
+  // neither leave @worlds partially written nor read out of arrays.
+  for (i = 0; i < n; i++)
+    g_return_if_fail (parents[i] < (gint) i);
+
+  if ((crank_parallel_resolve_n_threads (n_threads) == 1) ||
+      (n < 2 * CRANK_TRANS3_FLATTEN_GRAIN))
+    {
+      crank_trans3_flatten_range (0, n, &args);
+      return;
+    }
+
+  // Gets depths of nodes, and sorts nodes by depths, by counting. Nodes in
+  // same depth keep their order, so that they are still close in memory.
+  depths = g_new (guint, n);
+  n_depths = 0;
+
+  for (i = 0; i < n; i++)
+    {
+      gint p = parents[i];
+
+      depths[i] = (p < 0) ? 0 : depths[p] + 1;
+      n_depths = MAX (n_depths, depths[i] + 1);
+    }
+
+  // Deep hierarchy would not benefit from threads, and would pay for
+  // synchronization on each depth.
+  if (n < n_depths * CRANK_TRANS3_FLATTEN_GRAIN)
+    {
+      g_free (depths);
+      crank_trans3_flatten_range (0, n, &args);
+      return;
+    }
+
+  offsets = g_new0 (guint, n_depths + 1);
+  order = g_new (guint, n);
+
+  for (i = 0; i < n; i++)
+    offsets[depths[i] + 1]++;
+
+  for (i = 0; i < n_depths; i++)
+    offsets[i + 1] += offsets[i];
+
+  for (i = 0; i < n; i++)
+    order[offsets[depths[i]]++] = i;
+
+  // offsets[d] now points end of depth d.
+  args.order = order;
+
+  for (i = 0; i < n_depths; i++)
+    crank_parallel_for (n_threads,
+                        (i == 0) ? 0 : offsets[i - 1], offsets[i],
+                        CRANK_TRANS3_FLATTEN_GRAIN,
+                        crank_trans3_flatten_range, &args);
+
+  g_free (depths);
+  g_free (offsets);
+  g_free (order);
+}
+
+
+//////// Private Functions /////////////////////////////////////////////////////
+
+/*
+ * Works as crank_trans3_compose(), but reads every fields before writing, so
+ * that @r may be same with @a or @b. Being inlined, this avoids calls in loops.
+ */
+static inline void
+crank_trans3_compose_inline (const CrankTrans3 *a,
+                             const CrankTrans3 *b,
+                             CrankTrans3       *r)
+{
+  gfloat aw = a->mrot.w;
+  gfloat ax = a->mrot.x;
+  gfloat ay = a->mrot.y;
+  gfloat az = a->mrot.z;
+
+  gfloat bw = b->mrot.w;
+  gfloat bx = b->mrot.x;
+  gfloat by = b->mrot.y;
+  gfloat bz = b->mrot.z;
+
+  gfloat vx = b->mtrans.x;
+  gfloat vy = b->mtrans.y;
+  gfloat vz = b->mtrans.z;
+
+  gfloat ww = aw * aw;
+  gfloat xx = ax * ax;
+  gfloat yy = ay * ay;
+  gfloat zz = az * az;
+
+  gfloat wz = aw * az;
+  gfloat xy = ax * ay;
+  gfloat wy = aw * ay;
+  gfloat xz = ax * az;
+  gfloat wx = aw * ax;
+  gfloat yz = ay * az;
+
+  gfloat s = a->mscl;
+
+  r->mtrans.x = a->mtrans.x + s * ((ww + xx - yy - zz) * vx +
+                                   2 * (xy - wz) * vy +
+                                   2 * (wy + xz) * vz);
+
+  r->mtrans.y = a->mtrans.y + s * (2 * (wz + xy) * vx +
+                                   (ww - xx + yy - zz) * vy +
+                                   2 * (yz - wx) * vz);
+
+  r->mtrans.z = a->mtrans.z + s * (2 * (xz - wy) * vx +
+                                   2 * (wx + yz) * vy +
+                                   (ww - xx - yy + zz) * vz);
+
+  r->mrot.w = aw * bw - ax * bx - ay * by - az * bz;
+  r->mrot.x = aw * bx + ax * bw + ay * bz - az * by;
+  r->mrot.y = aw * by - ax * bz + ay * bw + az * bx;
+  r->mrot.z = aw * bz + ax * by - ay * bx + az * bw;
+
+  r->mscl = s * b->mscl;
+}
+
+static void
+crank_trans3_flatten_range (const guint start,
+                            const guint end,
+                            gpointer    userdata)
+{
+  CrankTrans3FlattenArgs *args = (CrankTrans3FlattenArgs*) userdata;
+  guint k;
+
+  for (k = start; k < end; k++)
+    {
+      guint i = (args->order != NULL) ? args->order[k] : k;
+      gint p = args->parents[i];
+
+      if (p < 0)
+        args->worlds[i] = args->locals[i];
+      else
+        crank_trans3_compose_inline (args->worlds + p,
+                                     args->locals + i,
+                                     args->worlds + i);
+    }
+}
@@ -218,6 +218,42 @@ void            crank_trans3_trans_plane       (CrankTrans3 *a,
                                                 CrankPlane3 *b,
                                                 CrankPlane3 *r);
 
+
+//////// Batch operations //////////////////////////////////////////////////////
+
+void            crank_trans3_batch_compose     (const guint        n,
+                                                const CrankTrans3 *a,
+                                                const CrankTrans3 *b,
+                                                CrankTrans3       *r);
+
+void            crank_trans3_batch_transv      (const guint           n,
+                                                const CrankTrans3    *a,
+                                                const CrankVecFloat3 *b,
+                                                CrankVecFloat3       *r);
+
+void            crank_trans3_soa_transv        (const guint        n,
+                                                const CrankTrans3 *a,
+                                                const gfloat      *x,
+                                                const gfloat      *y,
+                                                const gfloat      *z,
+                                                gfloat            *rx,
+                                                gfloat            *ry,
+                                                gfloat            *rz);
+
+
+//////// Hierarchy /////////////////////////////////////////////////////////////
+
+void            crank_trans3_flatten           (const guint        n,
+                                                const gint        *parents,
+                                                const CrankTrans3 *locals,
+                                                CrankTrans3       *worlds);
+
+void            crank_trans3_flatten_parallel  (const guint        n,
+                                                const gint        *parents,
+                                                const CrankTrans3 *locals,
+                                                CrankTrans3       *worlds,
+                                                const guint        n_threads);
+
 G_END_DECLS
 
 #endif
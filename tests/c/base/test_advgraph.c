@@ -50,6 +50,9 @@ void   test_dijkstra (TestFixtureDigraph *ft,
 void   test_astar (TestFixtureDigraph *ft,
                    gconstpointer       userdata);
 
+void   test_dijkstra_full (TestFixtureDigraph *ft,
+                           gconstpointer       userdata);
+
 
 //////// Main //////////////////////////////////////////////////////////////////
 
@@ -73,6 +76,13 @@ main (gint   argc,
               test_astar,
               test_fixture_fini);
 
+  g_test_add ("/crank/base/advgraph/dijkstra/full/digraph",
+              TestFixtureDigraph,
+              NULL,
+              test_fixture_init,
+              test_dijkstra_full,
+              test_fixture_fini);
+
   g_test_run ();
 
   return 0;
@@ -303,4 +313,34 @@ test_astar (TestFixtureDigraph *ft,
                              ft->nodes[7]);
 
   g_list_free (path);
-}
\ No newline at end of file
+}
+
+void
+test_dijkstra_full (TestFixtureDigraph *ft,
+                    gconstpointer       userdata)
+{
+  GNode *tree;
+  guint i;
+
+  // Parent of each node in minimum path tree from node 0.
+  guint parents[8] = {G_MAXUINT, 3, 4, 2, 0, 2, 7, 0};
+
+  tree = crank_dijkstra_full_digraph (ft->nodes[0],
+                                      testutil_edge_distance,
+                                      NULL);
+
+  g_assert (tree->data == ft->nodes[0]);
+  g_assert_cmpuint (g_node_n_nodes (tree, G_TRAVERSE_ALL), ==, 8);
+
+  for (i = 1; i < 8; i++)
+    {
+      GNode *gnode = g_node_find (tree,
+                                  G_IN_ORDER, G_TRAVERSE_ALL,
+                                  ft->nodes[i]);
+
+      g_assert (gnode != NULL);
+      g_assert (gnode->parent->data == ft->nodes[parents[i]]);
+    }
+
+  g_node_destroy (tree);
+}
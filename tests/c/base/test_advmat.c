@@ -34,6 +34,24 @@ static void test_ch (void);
 
 static void test_ldl (void);
 
+static void test_lu_self (void);
+
+static void test_ch_self (void);
+
+static void test_ldl_self (void);
+
+static void test_lu_float_n (void);
+
+static void test_qr_float_n (void);
+
+static void test_lu_double (void);
+
+static void test_ch_double (void);
+
+static void test_lu_double_n (void);
+
+static void test_qr_double_n (void);
+
 static void test_gram_schmidt (void);
 
 static void test_qr_householder (void);
@@ -48,6 +66,16 @@ static void test_eval_qr (void);
 
 static void test_eval_qr_nan (void);
 
+static void test_eval_sym (void);
+
+static void test_eval_sym_jacobi (void);
+
+static void test_svd (void);
+
+static void test_eval_sym_double (void);
+
+static void test_svd_double (void);
+
 static void test_lu_cplx (void);
 
 static void test_gram_schmidt_cplx (void);
@@ -72,6 +100,24 @@ main (gint   argc,
 
   g_test_add_func ("/crank/base/advmat/ldl/mat/float/n", test_ldl);
 
+  g_test_add_func ("/crank/base/advmat/lu/mat/float/n/self", test_lu_self);
+
+  g_test_add_func ("/crank/base/advmat/ch/mat/float/n/self", test_ch_self);
+
+  g_test_add_func ("/crank/base/advmat/ldl/mat/float/n/self", test_ldl_self);
+
+  g_test_add_func ("/crank/base/advmat/lu/float/n", test_lu_float_n);
+
+  g_test_add_func ("/crank/base/advmat/qr/float/n", test_qr_float_n);
+
+  g_test_add_func ("/crank/base/advmat/lu/mat/double/n", test_lu_double);
+
+  g_test_add_func ("/crank/base/advmat/ch/mat/double/n", test_ch_double);
+
+  g_test_add_func ("/crank/base/advmat/lu/double/n", test_lu_double_n);
+
+  g_test_add_func ("/crank/base/advmat/qr/double/n", test_qr_double_n);
+
   g_test_add_func ("/crank/base/advmat/qr/gram_schmidt/mat/float/n",
                    test_gram_schmidt);
 
@@ -96,6 +142,18 @@ main (gint   argc,
     "/crank/base/advmat/eval/qr/mat/float/n/nan",
     test_eval_qr_nan, G_USEC_PER_SEC);
 
+  g_test_add_func ("/crank/base/advmat/eval/sym/mat/float/n", test_eval_sym);
+
+  g_test_add_func ("/crank/base/advmat/eval/sym/jacobi/mat/float/n",
+                   test_eval_sym_jacobi);
+
+  g_test_add_func ("/crank/base/advmat/svd/mat/float/n", test_svd);
+
+  g_test_add_func ("/crank/base/advmat/eval/sym/mat/double/n",
+                   test_eval_sym_double);
+
+  g_test_add_func ("/crank/base/advmat/svd/mat/double/n", test_svd_double);
+
   g_test_add_func ("/crank/base/advmat/lu/mat/cplx/float/n", test_lu_cplx);
 
   g_test_add_func ("/crank/base/advmat/qr/gram_schmidt/mat/cplx/float/n",
@@ -271,6 +329,605 @@ test_ldl (void)
   crank_mat_float_n_fini (&l);
 }
 
+// Generates symmetric positive definite matrix, which is large enough to span
+// several panels of blocked decompositions.
+static void
+test_gen_spd (CrankMatFloatN *a,
+              const guint     n)
+{
+  guint i;
+  guint j;
+  guint k;
+
+  crank_mat_float_n_init_fill (a, n, n, 0.0f);
+
+  for (i = 0; i < n; i++)
+    {
+      for (j = 0; j <= i; j++)
+        {
+          gfloat sum = (i == j) ? 1.0f : 0.0f;
+
+          for (k = 0; k <= j; k++)
+            sum += ((gfloat)((i * 5 + k * 3) % 7) - 3.0f) * 0.1f *
+                   ((gfloat)((j * 5 + k * 3) % 7) - 3.0f) * 0.1f;
+
+          crank_mat_float_n_set (a, i, j, sum);
+          crank_mat_float_n_set (a, j, i, sum);
+        }
+    }
+}
+
+static void
+test_lu_self (void)
+{
+  CrankMatFloatN a = {0};
+  CrankMatFloatN lu = {0};
+
+  guint n = 150;
+  guint i;
+  guint j;
+  guint k;
+
+  crank_mat_float_n_init_fill (&a, n, n, 0.0f);
+
+  for (i = 0; i < n; i++)
+    {
+      for (j = 0; j < n; j++)
+        crank_mat_float_n_set (&a, i, j, (gfloat)((i * 7 + j * 3) % 11) * 0.1f);
+
+      crank_mat_float_n_set (&a, i, i, 10.0f);
+    }
+
+  crank_mat_float_n_copy (&a, &lu);
+  g_assert (crank_lu_mat_float_n_self (&lu));
+
+  // a == L U, where diagonal of U is 1.
+  for (i = 0; i < n; i++)
+    {
+      for (j = 0; j < n; j++)
+        {
+          gfloat sum = 0.0f;
+
+          for (k = 0; k <= MIN (i, j); k++)
+            sum += crank_mat_float_n_get (&lu, i, k) *
+                   ((k == j) ? 1.0f : crank_mat_float_n_get (&lu, k, j));
+
+          crank_assert_eqfloat (sum, crank_mat_float_n_get (&a, i, j), 0.001f);
+        }
+    }
+
+  crank_mat_float_n_fini (&a);
+  crank_mat_float_n_fini (&lu);
+}
+
+static void
+test_ch_self (void)
+{
+  CrankMatFloatN a = {0};
+  CrankMatFloatN l = {0};
+
+  guint n = 150;
+  guint i;
+  guint j;
+  guint k;
+
+  test_gen_spd (&a, n);
+
+  crank_mat_float_n_copy (&a, &l);
+  g_assert (crank_ch_mat_float_n_self (&l));
+
+  for (i = 0; i < n; i++)
+    {
+      for (j = 0; j < n; j++)
+        {
+          gfloat sum = 0.0f;
+
+          if (i < j)
+            crank_assert_cmpfloat (crank_mat_float_n_get (&l, i, j), ==, 0.0f);
+
+          for (k = 0; k <= MIN (i, j); k++)
+            sum += crank_mat_float_n_get (&l, i, k) *
+                   crank_mat_float_n_get (&l, j, k);
+
+          crank_assert_eqfloat (sum, crank_mat_float_n_get (&a, i, j), 0.001f);
+        }
+    }
+
+  crank_mat_float_n_fini (&a);
+  crank_mat_float_n_fini (&l);
+}
+
+static void
+test_ldl_self (void)
+{
+  CrankMatFloatN a = {0};
+  CrankMatFloatN l = {0};
+  CrankVecFloatN d = {0};
+
+  guint n = 150;
+  guint i;
+  guint j;
+  guint k;
+
+  test_gen_spd (&a, n);
+
+  crank_mat_float_n_copy (&a, &l);
+  g_assert (crank_ldl_mat_float_n_self (&l, &d));
+
+  for (i = 0; i < n; i++)
+    {
+      crank_assert_cmpfloat (crank_mat_float_n_get (&l, i, i), ==, 1.0f);
+
+      for (j = 0; j < n; j++)
+        {
+          gfloat sum = 0.0f;
+
+          for (k = 0; k <= MIN (i, j); k++)
+            sum += crank_mat_float_n_get (&l, i, k) *
+                   crank_mat_float_n_get (&l, j, k) *
+                   crank_vec_float_n_get (&d, k);
+
+          crank_assert_eqfloat (sum, crank_mat_float_n_get (&a, i, j), 0.001f);
+        }
+    }
+
+  crank_mat_float_n_fini (&a);
+  crank_mat_float_n_fini (&l);
+  crank_vec_float_n_fini (&d);
+}
+
+static void
+test_lu_float_n (void)
+{
+  CrankMatFloatN a;
+  CrankLUFloatN lu;
+  CrankVecFloatN b;
+  CrankVecFloatN x;
+
+  crank_mat_float_n_init (&a, 3, 3,
+                          0.0f,   4.0f,   3.0f,
+                          3.0f,   6.0f,   6.0f,
+                          2.0f,   20.0f,  8.0f);
+
+  g_assert (crank_lu_float_n_init (&lu, &a));
+
+  g_assert_cmpuint (crank_lu_float_n_get_size (&lu), ==, 3);
+  crank_assert_cmpfloat (crank_lu_float_n_get_det (&lu), ==, 96.0f);
+
+  // Factorization is reused for several right hand sides.
+  crank_vec_float_n_init (&b, 3, 7.0f, 15.0f, 30.0f);
+  crank_lu_float_n_solve (&lu, &b, &x);
+  crank_assert_eq_vecfloat_n_imm (&x, 1.0f, 1.0f, 1.0f);
+  crank_vec_float_n_fini (&b);
+  crank_vec_float_n_fini (&x);
+
+  crank_vec_float_n_init (&b, 3, 4.0f, 9.0f, 22.0f);
+  crank_lu_float_n_solve (&lu, &b, &x);
+  crank_assert_eq_vecfloat_n_imm (&x, 1.0f, 1.0f, 0.0f);
+  crank_vec_float_n_fini (&b);
+  crank_vec_float_n_fini (&x);
+
+  crank_lu_float_n_fini (&lu);
+  crank_mat_float_n_fini (&a);
+}
+
+static void
+test_qr_float_n_gen (CrankMatFloatN *a,
+                     const guint     m,
+                     const guint     n)
+{
+  guint i;
+  guint32 x = 12345;
+
+  crank_mat_float_n_init_fill (a, m, n, 0.0f);
+
+  for (i = 0; i < m * n; i++)
+    {
+      x = x * 1664525u + 1013904223u;
+      a->data[i] = (gfloat)(x >> 8) / 16777216.0f - 0.5f;
+    }
+}
+
+static void
+test_qr_float_n (void)
+{
+  CrankMatFloatN a;
+  CrankQRFloatN qr;
+  CrankMatFloatN q;
+  CrankMatFloatN r;
+  CrankMatFloatN qrm;
+  CrankVecFloatN b;
+  CrankVecFloatN c;
+  CrankVecFloatN x;
+  CrankVecFloatN res;
+
+  guint sizes[][2] = {{50, 4}, {70, 70}};
+  guint t;
+  guint i;
+  guint j;
+  guint k;
+
+  for (t = 0; t < G_N_ELEMENTS (sizes); t++)
+    {
+      guint m = sizes[t][0];
+      guint n = sizes[t][1];
+
+      test_qr_float_n_gen (&a, m, n);
+
+      g_assert (crank_qr_float_n_init (&qr, &a));
+      g_assert_cmpuint (crank_qr_float_n_get_row_size (&qr), ==, m);
+      g_assert_cmpuint (crank_qr_float_n_get_col_size (&qr), ==, n);
+
+      // A = Q R, and Q has orthonormal columns.
+      crank_qr_float_n_get_q (&qr, &q);
+      crank_qr_float_n_get_r (&qr, &r);
+      crank_mat_float_n_mul (&q, &r, &qrm);
+
+      for (i = 0; i < m * n; i++)
+        crank_assert_cmpfloat_d (qrm.data[i], ==, a.data[i], 0.001f);
+
+      for (i = 0; i < n; i++)
+        for (j = 0; j < n; j++)
+          {
+            gfloat sum = 0;
+
+            for (k = 0; k < m; k++)
+              sum += crank_mat_float_n_get (&q, k, i) *
+                     crank_mat_float_n_get (&q, k, j);
+
+            crank_assert_cmpfloat_d (sum, ==, (i == j) ? 1 : 0, 0.001f);
+          }
+
+      // Q Q^T b = b, with full Q.
+      crank_vec_float_n_init_fill (&b, m, 0.0f);
+      for (i = 0; i < m; i++)
+        b.data[i] = (gfloat)(i % 7) - 3.0f;
+
+      crank_qr_float_n_mul_qt (&qr, &b, &c);
+      crank_qr_float_n_mul_q (&qr, &c, &res);
+
+      for (i = 0; i < m; i++)
+        crank_assert_cmpfloat_d (res.data[i], ==, b.data[i], 0.001f);
+
+      crank_vec_float_n_fini (&c);
+      crank_vec_float_n_fini (&res);
+
+      // Residual of least squares is orthogonal to columns of A.
+      crank_qr_float_n_solve (&qr, &b, &x);
+      crank_mat_float_n_mulv (&a, &x, &res);
+      crank_vec_float_n_sub_self (&res, &b);
+
+      for (j = 0; j < n; j++)
+        {
+          gfloat sum = 0;
+
+          for (k = 0; k < m; k++)
+            sum += crank_mat_float_n_get (&a, k, j) * res.data[k];
+
+          crank_assert_cmpfloat_d (sum, ==, 0, 0.001f);
+        }
+
+      crank_vec_float_n_fini (&b);
+      crank_vec_float_n_fini (&x);
+      crank_vec_float_n_fini (&res);
+      crank_mat_float_n_fini (&q);
+      crank_mat_float_n_fini (&r);
+      crank_mat_float_n_fini (&qrm);
+      crank_qr_float_n_fini (&qr);
+      crank_mat_float_n_fini (&a);
+    }
+
+  // Consistent system is solved exactly, for many right hand sides.
+  {
+    CrankMatFloatN x0;
+    CrankMatFloatN bm;
+    CrankMatFloatN xm;
+
+    test_qr_float_n_gen (&a, 40, 3);
+    crank_mat_float_n_init (&x0, 3, 2,
+                            1.0f, -2.0f,
+                            2.0f, 0.5f,
+                            3.0f, 4.0f);
+    crank_mat_float_n_mul (&a, &x0, &bm);
+
+    g_assert (crank_qr_float_n_init (&qr, &a));
+    crank_qr_float_n_solve_multi (&qr, &bm, &xm);
+
+    g_assert_cmpuint (xm.rn, ==, 3);
+    g_assert_cmpuint (xm.cn, ==, 2);
+
+    for (i = 0; i < 6; i++)
+      crank_assert_cmpfloat_d (xm.data[i], ==, x0.data[i], 0.001f);
+
+    crank_mat_float_n_fini (&x0);
+    crank_mat_float_n_fini (&bm);
+    crank_mat_float_n_fini (&xm);
+    crank_qr_float_n_fini (&qr);
+    crank_mat_float_n_fini (&a);
+  }
+
+  // Rank deficient matrix is rejected.
+  crank_mat_float_n_init (&a, 3, 2,
+                          1.0f, 0.0f,
+                          2.0f, 0.0f,
+                          3.0f, 0.0f);
+
+  g_assert (! crank_qr_float_n_init (&qr, &a));
+
+  crank_mat_float_n_fini (&a);
+}
+
+static void
+test_lu_double (void)
+{
+  CrankMatDoubleN a = {0};
+  CrankMatDoubleN l = {0};
+  CrankMatDoubleN u = {0};
+
+  crank_mat_double_n_init (&a, 3, 3,
+                           3.0,   12.0,  21.0,
+                           8.0,   39.0,  84.0,
+                           2.0,   16.0,  49.0);
+
+  g_assert (crank_lu_mat_double_n (&a, &l, &u));
+
+  crank_assert_cmpfloat (crank_mat_double_n_get (&l, 0, 0), ==,  3.0);
+  crank_assert_cmpfloat (crank_mat_double_n_get (&l, 0, 1), ==, 0.0);
+  crank_assert_cmpfloat (crank_mat_double_n_get (&l, 0, 2), ==, 0.0);
+
+  crank_assert_cmpfloat (crank_mat_double_n_get (&l, 1, 0), ==, 8.0);
+  crank_assert_cmpfloat (crank_mat_double_n_get (&l, 1, 1), ==, 7.0);
+  crank_assert_cmpfloat (crank_mat_double_n_get (&l, 1, 2), ==, 0.0);
+
+  crank_assert_cmpfloat (crank_mat_double_n_get (&l, 2, 0), ==, 2.0);
+  crank_assert_cmpfloat (crank_mat_double_n_get (&l, 2, 1), ==, 8.0);
+  crank_assert_cmpfloat (crank_mat_double_n_get (&l, 2, 2), ==, 3.0);
+
+
+  crank_assert_cmpfloat (crank_mat_double_n_get (&u, 0, 0), ==, 1.0);
+  crank_assert_cmpfloat (crank_mat_double_n_get (&u, 0, 1), ==, 4.0);
+  crank_assert_cmpfloat (crank_mat_double_n_get (&u, 0, 2), ==, 7.0);
+
+  crank_assert_cmpfloat (crank_mat_double_n_get (&u, 1, 0), ==, 0.0);
+  crank_assert_cmpfloat (crank_mat_double_n_get (&u, 1, 1), ==, 1.0);
+  crank_assert_cmpfloat (crank_mat_double_n_get (&u, 1, 2), ==, 4.0);
+
+  crank_assert_cmpfloat (crank_mat_double_n_get (&u, 2, 0), ==, 0.0);
+  crank_assert_cmpfloat (crank_mat_double_n_get (&u, 2, 1), ==, 0.0);
+  crank_assert_cmpfloat (crank_mat_double_n_get (&u, 2, 2), ==, 1.0);
+
+  crank_mat_double_n_fini (&a);
+  crank_mat_double_n_fini (&l);
+  crank_mat_double_n_fini (&u);
+}
+
+static void
+test_ch_double (void)
+{
+  CrankMatDoubleN a;
+  CrankMatDoubleN l;
+
+  crank_mat_double_n_init (&a, 3, 3,
+                           4.0,  12.0, -16.0,
+                           12.0,  37.0, -43.0,
+                           -16.0, -43.0,  98.0);
+
+  g_assert (crank_ch_mat_double_n (&a, &l));
+
+  crank_assert_cmpfloat (crank_mat_double_n_get (&l, 0, 0), ==,  2.0);
+  crank_assert_cmpfloat (crank_mat_double_n_get (&l, 0, 1), ==,  0.0);
+  crank_assert_cmpfloat (crank_mat_double_n_get (&l, 0, 2), ==,  0.0);
+  crank_assert_cmpfloat (crank_mat_double_n_get (&l, 1, 0), ==,  6.0);
+  crank_assert_cmpfloat (crank_mat_double_n_get (&l, 1, 1), ==,  1.0);
+  crank_assert_cmpfloat (crank_mat_double_n_get (&l, 1, 2), ==,  0.0);
+  crank_assert_cmpfloat (crank_mat_double_n_get (&l, 2, 0), ==, -8.0);
+  crank_assert_cmpfloat (crank_mat_double_n_get (&l, 2, 1), ==,  5.0);
+  crank_assert_cmpfloat (crank_mat_double_n_get (&l, 2, 2), ==,  3.0);
+
+  crank_mat_double_n_fini (&a);
+  crank_mat_double_n_fini (&l);
+}
+
+static void
+test_lu_double_n (void)
+{
+  CrankMatDoubleN a;
+  CrankLUDoubleN lu;
+  CrankVecDoubleN b;
+  CrankVecDoubleN x;
+
+  crank_mat_double_n_init (&a, 3, 3,
+                           0.0,   4.0,   3.0,
+                           3.0,   6.0,   6.0,
+                           2.0,   20.0,  8.0);
+
+  g_assert (crank_lu_double_n_init (&lu, &a));
+
+  g_assert_cmpuint (crank_lu_double_n_get_size (&lu), ==, 3);
+  crank_assert_cmpfloat (crank_lu_double_n_get_det (&lu), ==, 96.0);
+
+  // Factorization is reused for several right hand sides.
+  crank_vec_double_n_init (&b, 3, 7.0, 15.0, 30.0);
+  crank_lu_double_n_solve (&lu, &b, &x);
+  crank_assert_eq_vecdouble_n_imm (&x, 1.0, 1.0, 1.0);
+  crank_vec_double_n_fini (&b);
+  crank_vec_double_n_fini (&x);
+
+  crank_vec_double_n_init (&b, 3, 4.0, 9.0, 22.0);
+  crank_lu_double_n_solve (&lu, &b, &x);
+  crank_assert_eq_vecdouble_n_imm (&x, 1.0, 1.0, 0.0);
+  crank_vec_double_n_fini (&b);
+  crank_vec_double_n_fini (&x);
+
+  crank_lu_double_n_fini (&lu);
+  crank_mat_double_n_fini (&a);
+
+  // Ill conditioned system, which single precision cannot resolve.
+  crank_mat_double_n_init (&a, 4, 4,
+                           1.0,      1.0 / 2,  1.0 / 3,  1.0 / 4,
+                           1.0 / 2,  1.0 / 3,  1.0 / 4,  1.0 / 5,
+                           1.0 / 3,  1.0 / 4,  1.0 / 5,  1.0 / 6,
+                           1.0 / 4,  1.0 / 5,  1.0 / 6,  1.0 / 7);
+
+  g_assert (crank_lu_double_n_init (&lu, &a));
+
+  crank_vec_double_n_init (&b, 4,
+                           25.0 / 12, 77.0 / 60, 57.0 / 60, 319.0 / 420);
+  crank_lu_double_n_solve (&lu, &b, &x);
+  crank_assert_eqarray_double_d_imm (x.data, x.n, 1e-9f, 1.0, 1.0, 1.0, 1.0);
+  crank_vec_double_n_fini (&b);
+  crank_vec_double_n_fini (&x);
+
+  crank_lu_double_n_fini (&lu);
+  crank_mat_double_n_fini (&a);
+}
+
+static void
+test_qr_double_n_gen (CrankMatDoubleN *a,
+                     const guint      m,
+                     const guint      n)
+{
+  guint i;
+  guint32 x = 12345;
+
+  crank_mat_double_n_init_fill (a, m, n, 0.0);
+
+  for (i = 0; i < m * n; i++)
+    {
+      x = x * 1664525u + 1013904223u;
+      a->data[i] = (gdouble)(x >> 8) / 16777216.0 - 0.5;
+    }
+}
+
+static void
+test_qr_double_n (void)
+{
+  CrankMatDoubleN a;
+  CrankQRDoubleN qr;
+  CrankMatDoubleN q;
+  CrankMatDoubleN r;
+  CrankMatDoubleN qrm;
+  CrankVecDoubleN b;
+  CrankVecDoubleN c;
+  CrankVecDoubleN x;
+  CrankVecDoubleN res;
+
+  guint sizes[][2] = {{50, 4}, {70, 70}};
+  guint t;
+  guint i;
+  guint j;
+  guint k;
+
+  for (t = 0; t < G_N_ELEMENTS (sizes); t++)
+    {
+      guint m = sizes[t][0];
+      guint n = sizes[t][1];
+
+      test_qr_double_n_gen (&a, m, n);
+
+      g_assert (crank_qr_double_n_init (&qr, &a));
+      g_assert_cmpuint (crank_qr_double_n_get_row_size (&qr), ==, m);
+      g_assert_cmpuint (crank_qr_double_n_get_col_size (&qr), ==, n);
+
+      // A = Q R, and Q has orthonormal columns.
+      crank_qr_double_n_get_q (&qr, &q);
+      crank_qr_double_n_get_r (&qr, &r);
+      crank_mat_double_n_mul (&q, &r, &qrm);
+
+      for (i = 0; i < m * n; i++)
+        crank_assert_cmpfloat_d (qrm.data[i], ==, a.data[i], 0.001);
+
+      for (i = 0; i < n; i++)
+        for (j = 0; j < n; j++)
+          {
+            gdouble sum = 0;
+
+            for (k = 0; k < m; k++)
+              sum += crank_mat_double_n_get (&q, k, i) *
+                     crank_mat_double_n_get (&q, k, j);
+
+            crank_assert_cmpfloat_d (sum, ==, (i == j) ? 1 : 0, 0.001);
+          }
+
+      // Q Q^T b = b, with full Q.
+      crank_vec_double_n_init_fill (&b, m, 0.0);
+      for (i = 0; i < m; i++)
+        b.data[i] = (gdouble)(i % 7) - 3.0;
+
+      crank_qr_double_n_mul_qt (&qr, &b, &c);
+      crank_qr_double_n_mul_q (&qr, &c, &res);
+
+      for (i = 0; i < m; i++)
+        crank_assert_cmpfloat_d (res.data[i], ==, b.data[i], 0.001);
+
+      crank_vec_double_n_fini (&c);
+      crank_vec_double_n_fini (&res);
+
+      // Residual of least squares is orthogonal to columns of A.
+      crank_qr_double_n_solve (&qr, &b, &x);
+      crank_mat_double_n_mulv (&a, &x, &res);
+      crank_vec_double_n_sub_self (&res, &b);
+
+      for (j = 0; j < n; j++)
+        {
+          gdouble sum = 0;
+
+          for (k = 0; k < m; k++)
+            sum += crank_mat_double_n_get (&a, k, j) * res.data[k];
+
+          crank_assert_cmpfloat_d (sum, ==, 0, 0.001);
+        }
+
+      crank_vec_double_n_fini (&b);
+      crank_vec_double_n_fini (&x);
+      crank_vec_double_n_fini (&res);
+      crank_mat_double_n_fini (&q);
+      crank_mat_double_n_fini (&r);
+      crank_mat_double_n_fini (&qrm);
+      crank_qr_double_n_fini (&qr);
+      crank_mat_double_n_fini (&a);
+    }
+
+  // Consistent system is solved exactly, for many right hand sides.
+  {
+    CrankMatDoubleN x0;
+    CrankMatDoubleN bm;
+    CrankMatDoubleN xm;
+
+    test_qr_double_n_gen (&a, 40, 3);
+    crank_mat_double_n_init (&x0, 3, 2,
+                             1.0, -2.0,
+                             2.0, 0.5,
+                             3.0, 4.0);
+    crank_mat_double_n_mul (&a, &x0, &bm);
+
+    g_assert (crank_qr_double_n_init (&qr, &a));
+    crank_qr_double_n_solve_multi (&qr, &bm, &xm);
+
+    g_assert_cmpuint (xm.rn, ==, 3);
+    g_assert_cmpuint (xm.cn, ==, 2);
+
+    for (i = 0; i < 6; i++)
+      crank_assert_cmpfloat_d (xm.data[i], ==, x0.data[i], 0.001);
+
+    crank_mat_double_n_fini (&x0);
+    crank_mat_double_n_fini (&bm);
+    crank_mat_double_n_fini (&xm);
+    crank_qr_double_n_fini (&qr);
+    crank_mat_double_n_fini (&a);
+  }
+
+  // Rank deficient matrix is rejected.
+  crank_mat_double_n_init (&a, 3, 2,
+                           1.0, 0.0,
+                           2.0, 0.0,
+                           3.0, 0.0);
+
+  g_assert (! crank_qr_double_n_init (&qr, &a));
+
+  crank_mat_double_n_fini (&a);
+}
+
 static void
 test_gram_schmidt (void)
 {
@@ -454,6 +1111,383 @@ test_eval_qr_nan (void)
   crank_mat_float_n_fini (&a);
 }
 
+static void
+test_eval_sym_check (CrankMatFloatN *a,
+                     CrankVecFloatN *evals,
+                     CrankMatFloatN *evecs)
+{
+  guint n = a->rn;
+  guint i;
+  guint j;
+  guint k;
+
+  for (i = 0; i + 1 < n; i++)
+    g_assert_cmpfloat (evals->data[i], <=, evals->data[i + 1]);
+
+  // A V = V D, and V is orthogonal.
+  for (i = 0; i < n; i++)
+    {
+      for (j = 0; j < n; j++)
+        {
+          gfloat av = 0;
+          gfloat vv = 0;
+
+          for (k = 0; k < n; k++)
+            {
+              av += crank_mat_float_n_get (a, i, k) *
+                    crank_mat_float_n_get (evecs, k, j);
+              vv += crank_mat_float_n_get (evecs, k, i) *
+                    crank_mat_float_n_get (evecs, k, j);
+            }
+
+          crank_assert_cmpfloat_d (av, ==,
+                                   crank_mat_float_n_get (evecs, i, j) *
+                                   evals->data[j], 0.001f);
+          crank_assert_cmpfloat_d (vv, ==, (i == j) ? 1 : 0, 0.001f);
+        }
+    }
+}
+
+static void
+test_eval_sym_gen (CrankMatFloatN *a,
+                   const guint     n)
+{
+  guint i;
+  guint j;
+
+  crank_mat_float_n_init_fill (a, n, n, 0.0f);
+
+  for (i = 0; i < n; i++)
+    for (j = 0; j <= i; j++)
+      {
+        gfloat v = (gfloat)((i * 7 + j * 3) % 11) * 0.25f - 1.0f;
+
+        crank_mat_float_n_set (a, i, j, v);
+        crank_mat_float_n_set (a, j, i, v);
+      }
+}
+
+static void
+test_eval_sym (void)
+{
+  CrankMatFloatN a;
+  CrankVecFloatN evals;
+  CrankMatFloatN evecs;
+
+  crank_mat_float_n_init (&a, 3, 3,
+                          2.0f, 1.0f, 0.0f,
+                          1.0f, 2.0f, 1.0f,
+                          0.0f, 1.0f, 2.0f);
+
+  g_assert (crank_eval_sym_ql_mat_float_n (&a, &evals, &evecs, 0, 0));
+
+  crank_assert_eq_vecfloat_n_imm (&evals, 2.0f - G_SQRT2, 2.0f, 2.0f + G_SQRT2);
+  test_eval_sym_check (&a, &evals, &evecs);
+
+  crank_vec_float_n_fini (&evals);
+  crank_mat_float_n_fini (&evecs);
+  crank_mat_float_n_fini (&a);
+
+  test_eval_sym_gen (&a, 40);
+
+  g_assert (crank_eval_sym_mat_float_n (&a, &evals, &evecs));
+  test_eval_sym_check (&a, &evals, &evecs);
+
+  crank_vec_float_n_fini (&evals);
+  crank_mat_float_n_fini (&evecs);
+  crank_mat_float_n_fini (&a);
+}
+
+static void
+test_eval_sym_jacobi (void)
+{
+  CrankMatFloatN a;
+  CrankVecFloatN evals;
+  CrankMatFloatN evecs;
+
+  crank_mat_float_n_init (&a, 3, 3,
+                          2.0f, 1.0f, 0.0f,
+                          1.0f, 2.0f, 1.0f,
+                          0.0f, 1.0f, 2.0f);
+
+  g_assert (crank_eval_sym_jacobi_mat_float_n (&a, &evals, &evecs, 0, 0));
+
+  crank_assert_eq_vecfloat_n_imm (&evals, 2.0f - G_SQRT2, 2.0f, 2.0f + G_SQRT2);
+  test_eval_sym_check (&a, &evals, &evecs);
+
+  crank_vec_float_n_fini (&evals);
+  crank_mat_float_n_fini (&evecs);
+  crank_mat_float_n_fini (&a);
+
+  test_eval_sym_gen (&a, 8);
+
+  g_assert (crank_eval_sym_jacobi_mat_float_n (&a, &evals, &evecs, 0, 0));
+  test_eval_sym_check (&a, &evals, &evecs);
+
+  crank_vec_float_n_fini (&evals);
+  crank_mat_float_n_fini (&evecs);
+  crank_mat_float_n_fini (&a);
+
+  // Sweep limit is reported.
+  test_eval_sym_gen (&a, 8);
+
+  g_assert (! crank_eval_sym_jacobi_mat_float_n (&a, &evals, NULL, 1, 0));
+
+  crank_vec_float_n_fini (&evals);
+  crank_mat_float_n_fini (&a);
+}
+
+static void
+test_svd (void)
+{
+  CrankMatFloatN a;
+  CrankMatFloatN u;
+  CrankVecFloatN s;
+  CrankMatFloatN v;
+
+  guint sizes[][2] = {{3, 2}, {2, 3}, {30, 7}, {6, 6}};
+  guint t;
+
+  for (t = 0; t < G_N_ELEMENTS (sizes); t++)
+    {
+      guint m = sizes[t][0];
+      guint n = sizes[t][1];
+      guint r = MIN (m, n);
+      guint i;
+      guint j;
+      guint k;
+
+      crank_mat_float_n_init_fill (&a, m, n, 0.0f);
+
+      for (i = 0; i < m * n; i++)
+        a.data[i] = (gfloat)((i * 7) % 13) * 0.25f - 1.5f;
+
+      g_assert (crank_svd_mat_float_n (&a, &u, &s, &v));
+
+      g_assert_cmpuint (u.rn, ==, m);
+      g_assert_cmpuint (u.cn, ==, r);
+      g_assert_cmpuint (s.n, ==, r);
+      g_assert_cmpuint (v.rn, ==, n);
+      g_assert_cmpuint (v.cn, ==, r);
+
+      for (i = 0; i + 1 < r; i++)
+        g_assert_cmpfloat (s.data[i], >=, s.data[i + 1]);
+
+      // A = U S V^T
+      for (i = 0; i < m; i++)
+        for (j = 0; j < n; j++)
+          {
+            gfloat sum = 0;
+
+            for (k = 0; k < r; k++)
+              sum += crank_mat_float_n_get (&u, i, k) * s.data[k] *
+                     crank_mat_float_n_get (&v, j, k);
+
+            crank_assert_cmpfloat_d (sum, ==, crank_mat_float_n_get (&a, i, j),
+                                     0.001f);
+          }
+
+      // V^T V = I
+      for (i = 0; i < r; i++)
+        for (j = 0; j < r; j++)
+          {
+            gfloat sum = 0;
+
+            for (k = 0; k < n; k++)
+              sum += crank_mat_float_n_get (&v, k, i) *
+                     crank_mat_float_n_get (&v, k, j);
+
+            crank_assert_cmpfloat_d (sum, ==, (i == j) ? 1 : 0, 0.001f);
+          }
+
+      crank_mat_float_n_fini (&a);
+      crank_mat_float_n_fini (&u);
+      crank_vec_float_n_fini (&s);
+      crank_mat_float_n_fini (&v);
+    }
+
+  // Singular values of diagonal matrix.
+  crank_mat_float_n_init (&a, 3, 3,
+                          1.0f, 0.0f, 0.0f,
+                          0.0f, -3.0f, 0.0f,
+                          0.0f, 0.0f, 2.0f);
+
+  g_assert (crank_svd_mat_float_n (&a, NULL, &s, NULL));
+  crank_assert_eq_vecfloat_n_imm (&s, 3.0f, 2.0f, 1.0f);
+
+  crank_mat_float_n_fini (&a);
+  crank_vec_float_n_fini (&s);
+}
+
+static void
+test_eval_sym_check_double (CrankMatDoubleN *a,
+                     CrankVecDoubleN *evals,
+                     CrankMatDoubleN *evecs)
+{
+  guint n = a->rn;
+  guint i;
+  guint j;
+  guint k;
+
+  for (i = 0; i + 1 < n; i++)
+    g_assert_cmpfloat (evals->data[i], <=, evals->data[i + 1]);
+
+  // A V = V D, and V is orthogonal.
+  for (i = 0; i < n; i++)
+    {
+      for (j = 0; j < n; j++)
+        {
+          gdouble av = 0;
+          gdouble vv = 0;
+
+          for (k = 0; k < n; k++)
+            {
+              av += crank_mat_double_n_get (a, i, k) *
+                    crank_mat_double_n_get (evecs, k, j);
+              vv += crank_mat_double_n_get (evecs, k, i) *
+                    crank_mat_double_n_get (evecs, k, j);
+            }
+
+          crank_assert_cmpfloat_d (av, ==,
+                                   crank_mat_double_n_get (evecs, i, j) *
+                                   evals->data[j], 0.001);
+          crank_assert_cmpfloat_d (vv, ==, (i == j) ? 1 : 0, 0.001);
+        }
+    }
+}
+
+static void
+test_eval_sym_gen_double (CrankMatDoubleN *a,
+                   const guint      n)
+{
+  guint i;
+  guint j;
+
+  crank_mat_double_n_init_fill (a, n, n, 0.0);
+
+  for (i = 0; i < n; i++)
+    for (j = 0; j <= i; j++)
+      {
+        gdouble v = (gdouble)((i * 7 + j * 3) % 11) * 0.25 - 1.0;
+
+        crank_mat_double_n_set (a, i, j, v);
+        crank_mat_double_n_set (a, j, i, v);
+      }
+}
+
+static void
+test_eval_sym_double (void)
+{
+  CrankMatDoubleN a;
+  CrankVecDoubleN evals;
+  CrankMatDoubleN evecs;
+
+  crank_mat_double_n_init (&a, 3, 3,
+                           2.0, 1.0, 0.0,
+                           1.0, 2.0, 1.0,
+                           0.0, 1.0, 2.0);
+
+  g_assert (crank_eval_sym_ql_mat_double_n (&a, &evals, &evecs, 0, 0));
+
+  crank_assert_eq_vecdouble_n_imm (&evals, 2.0 - G_SQRT2, 2.0, 2.0 + G_SQRT2);
+  test_eval_sym_check_double (&a, &evals, &evecs);
+
+  crank_vec_double_n_fini (&evals);
+  crank_mat_double_n_fini (&evecs);
+  crank_mat_double_n_fini (&a);
+
+  test_eval_sym_gen_double (&a, 40);
+
+  g_assert (crank_eval_sym_mat_double_n (&a, &evals, &evecs));
+  test_eval_sym_check_double (&a, &evals, &evecs);
+
+  crank_vec_double_n_fini (&evals);
+  crank_mat_double_n_fini (&evecs);
+  crank_mat_double_n_fini (&a);
+}
+
+static void
+test_svd_double (void)
+{
+  CrankMatDoubleN a;
+  CrankMatDoubleN u;
+  CrankVecDoubleN s;
+  CrankMatDoubleN v;
+
+  guint sizes[][2] = {{3, 2}, {2, 3}, {30, 7}, {6, 6}};
+  guint t;
+
+  for (t = 0; t < G_N_ELEMENTS (sizes); t++)
+    {
+      guint m = sizes[t][0];
+      guint n = sizes[t][1];
+      guint r = MIN (m, n);
+      guint i;
+      guint j;
+      guint k;
+
+      crank_mat_double_n_init_fill (&a, m, n, 0.0);
+
+      for (i = 0; i < m * n; i++)
+        a.data[i] = (gdouble)((i * 7) % 13) * 0.25 - 1.5;
+
+      g_assert (crank_svd_mat_double_n (&a, &u, &s, &v));
+
+      g_assert_cmpuint (u.rn, ==, m);
+      g_assert_cmpuint (u.cn, ==, r);
+      g_assert_cmpuint (s.n, ==, r);
+      g_assert_cmpuint (v.rn, ==, n);
+      g_assert_cmpuint (v.cn, ==, r);
+
+      for (i = 0; i + 1 < r; i++)
+        g_assert_cmpfloat (s.data[i], >=, s.data[i + 1]);
+
+      // A = U S V^T
+      for (i = 0; i < m; i++)
+        for (j = 0; j < n; j++)
+          {
+            gdouble sum = 0;
+
+            for (k = 0; k < r; k++)
+              sum += crank_mat_double_n_get (&u, i, k) * s.data[k] *
+                     crank_mat_double_n_get (&v, j, k);
+
+            crank_assert_cmpfloat_d (sum, ==, crank_mat_double_n_get (&a, i, j),
+                                     0.001);
+          }
+
+      // V^T V = I
+      for (i = 0; i < r; i++)
+        for (j = 0; j < r; j++)
+          {
+            gdouble sum = 0;
+
+            for (k = 0; k < n; k++)
+              sum += crank_mat_double_n_get (&v, k, i) *
+                     crank_mat_double_n_get (&v, k, j);
+
+            crank_assert_cmpfloat_d (sum, ==, (i == j) ? 1 : 0, 0.001);
+          }
+
+      crank_mat_double_n_fini (&a);
+      crank_mat_double_n_fini (&u);
+      crank_vec_double_n_fini (&s);
+      crank_mat_double_n_fini (&v);
+    }
+
+  // Singular values of diagonal matrix.
+  crank_mat_double_n_init (&a, 3, 3,
+                           1.0, 0.0, 0.0,
+                           0.0, -3.0, 0.0,
+                           0.0, 0.0, 2.0);
+
+  g_assert (crank_svd_mat_double_n (&a, NULL, &s, NULL));
+  crank_assert_eq_vecdouble_n_imm (&s, 3.0, 2.0, 1.0);
+
+  crank_mat_double_n_fini (&a);
+  crank_vec_double_n_fini (&s);
+}
+
 
 
 
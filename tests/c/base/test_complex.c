@@ -83,6 +83,22 @@ static void test_cos (void);
 
 static void test_tan (void);
 
+static void test_ln_fast (void);
+
+static void test_exp_fast (void);
+
+static void test_sinh_fast (void);
+
+static void test_cosh_fast (void);
+
+static void test_sin_fast (void);
+
+static void test_cos_fast (void);
+
+static void test_fast_enabled (void);
+
+static void test_batch_fast (void);
+
 //////// Main //////////////////////////////////////////////////////////////////
 
 gint
@@ -120,6 +136,14 @@ main (gint   argc,
   g_test_add_func ("/crank/base/cplx/float/sin",          test_sin);
   g_test_add_func ("/crank/base/cplx/float/cos",          test_cos);
   g_test_add_func ("/crank/base/cplx/float/tan",          test_tan);
+  g_test_add_func ("/crank/base/cplx/float/ln/fast",      test_ln_fast);
+  g_test_add_func ("/crank/base/cplx/float/exp/fast",     test_exp_fast);
+  g_test_add_func ("/crank/base/cplx/float/sinh/fast",    test_sinh_fast);
+  g_test_add_func ("/crank/base/cplx/float/cosh/fast",    test_cosh_fast);
+  g_test_add_func ("/crank/base/cplx/float/sin/fast",     test_sin_fast);
+  g_test_add_func ("/crank/base/cplx/float/cos/fast",     test_cos_fast);
+  g_test_add_func ("/crank/base/cplx/float/fast/enabled", test_fast_enabled);
+  g_test_add_func ("/crank/base/cplx/float/batch/fast",   test_batch_fast);
 
   g_test_run ();
 
@@ -477,3 +501,137 @@ test_tan (void)
 
   crank_assert_eqcplxfloat_uc (&b, -0.0001f, 0.9994f);
 }
+
+static void
+test_ln_fast (void)
+{
+  CrankCplxFloat a = {3.0f, 4.0f};
+  CrankCplxFloat b;
+
+  crank_cplx_float_ln_fast (&a, &b);
+
+  crank_assert_eqcplxfloat_uc (&b, 1.6094f, 0.9273f);
+}
+
+static void
+test_exp_fast (void)
+{
+  CrankCplxFloat a = {3.0f, 4.0f};
+  CrankCplxFloat b;
+
+  crank_cplx_float_exp_fast (&a, &b);
+
+  crank_assert_eqcplxfloat_uc (&b, -13.1287f, -15.2008f);
+}
+
+static void
+test_sinh_fast (void)
+{
+  CrankCplxFloat a = {3.0f, 4.0f};
+  CrankCplxFloat b;
+
+  crank_cplx_float_sinh_fast (&a, &b);
+
+  crank_assert_eqcplxfloat_uc (&b, -6.5481f, -7.6192f);
+}
+
+static void
+test_cosh_fast (void)
+{
+  CrankCplxFloat a = {3.0f, 4.0f};
+  CrankCplxFloat b;
+
+  crank_cplx_float_cosh_fast (&a, &b);
+
+  crank_assert_eqcplxfloat_uc (&b, -6.5807f, -7.5816f);
+}
+
+static void
+test_sin_fast (void)
+{
+  CrankCplxFloat a = {3.0f, 4.0f};
+  CrankCplxFloat b;
+
+  crank_cplx_float_sin_fast (&a, &b);
+
+  crank_assert_eqcplxfloat_uc (&b, 3.8537f, -27.0168f);
+}
+
+static void
+test_cos_fast (void)
+{
+  CrankCplxFloat a = {3.0f, 4.0f};
+  CrankCplxFloat b;
+
+  crank_cplx_float_cos_fast (&a, &b);
+
+  crank_assert_eqcplxfloat_uc (&b, -27.0349f, -3.8512f);
+}
+
+static void
+test_fast_enabled (void)
+{
+  CrankCplxFloat a = {0.5f, 1.5f};
+  CrankCplxFloat b;
+  CrankCplxFloat e;
+
+  crank_fast_math_set_enabled (TRUE);
+  g_assert (crank_fast_math_get_enabled ());
+
+  crank_cplx_float_exp (&a, &b);
+  crank_cplx_float_exp_fast (&a, &e);
+  g_assert (crank_cplx_float_equal (&b, &e));
+
+  crank_cplx_float_cos (&a, &b);
+  crank_cplx_float_cos_fast (&a, &e);
+  g_assert (crank_cplx_float_equal (&b, &e));
+
+  crank_fast_math_set_enabled (FALSE);
+  g_assert (! crank_fast_math_get_enabled ());
+}
+
+static void
+test_batch_fast (void)
+{
+  CrankCplxFloat a[37];
+  CrankCplxFloat r[37];
+  CrankCplxFloat e;
+  guint i;
+
+  for (i = 0; i < 37; i++)
+    crank_cplx_float_init (a + i, i * 0.125f - 2.0f, 3.0f - i * 0.25f);
+
+  crank_cplx_float_batch_ln_fast (37, a, r);
+  for (i = 0; i < 37; i++)
+    {
+      crank_cplx_float_ln_fast (a + i, &e);
+      crank_assert_eqcplxfloat_d (r + i, &e, 0.0001f);
+    }
+
+  crank_cplx_float_batch_exp_fast (37, a, r);
+  for (i = 0; i < 37; i++)
+    {
+      crank_cplx_float_exp (a + i, &e);
+      crank_assert_eqcplxfloat_d (r + i, &e, 0.0001f);
+    }
+
+  crank_cplx_float_batch_cosh_fast (37, a, r);
+  for (i = 0; i < 37; i++)
+    {
+      crank_cplx_float_cosh (a + i, &e);
+      crank_assert_eqcplxfloat_d (r + i, &e, 0.0001f);
+    }
+
+  crank_cplx_float_batch_cos_fast (37, a, r);
+  for (i = 0; i < 37; i++)
+    {
+      crank_cplx_float_cos (a + i, &e);
+      crank_assert_eqcplxfloat_d (r + i, &e, 0.0001f);
+    }
+
+  // Results may overwrite inputs.
+  crank_cplx_float_batch_exp (37, a, r);
+  crank_cplx_float_batch_exp (37, a, a);
+  for (i = 0; i < 37; i++)
+    g_assert (crank_cplx_float_equal (a + i, r + i));
+}
@@ -53,6 +53,15 @@ static void     test_digraph_disconnect (TestDigraphFixture *fixture,
 static void     test_digraph_disconnect_edge (TestDigraphFixture *fixture,
                                               gconstpointer       userdata);
 
+static void     test_digraph_remove (TestDigraphFixture *fixture,
+                                     gconstpointer       userdata);
+
+static void     test_digraph_index_of (TestDigraphFixture *fixture,
+                                       gconstpointer       userdata);
+
+static void     test_digraph_handle (TestDigraphFixture *fixture,
+                                     gconstpointer       userdata);
+
 static void     test_digraph_node_get_data (TestDigraphFixture *fixture,
                                             gconstpointer       userdata);
 
@@ -136,6 +145,27 @@ main (gint    argc,
               test_digraph_disconnect_edge,
               test_digraph_teardown);
 
+  g_test_add ("/crank/base/digraph/remove",
+              TestDigraphFixture,
+              NULL,
+              test_digraph_setup,
+              test_digraph_remove,
+              test_digraph_teardown);
+
+  g_test_add ("/crank/base/digraph/index_of",
+              TestDigraphFixture,
+              NULL,
+              test_digraph_setup,
+              test_digraph_index_of,
+              test_digraph_teardown);
+
+  g_test_add ("/crank/base/digraph/handle",
+              TestDigraphFixture,
+              NULL,
+              test_digraph_setup,
+              test_digraph_handle,
+              test_digraph_teardown);
+
 
   g_test_add ("/crank/base/digraph/node/data",
               TestDigraphFixture,
@@ -429,6 +459,109 @@ test_digraph_disconnect (TestDigraphFixture *fixture,
     }
 }
 
+static void
+test_digraph_remove (TestDigraphFixture *fixture,
+                     gconstpointer       userdata)
+{
+  // Removes 4, with edges 4->5, 4->6, 4->7
+  crank_digraph_remove (fixture->digraph, fixture->nodes[4]);
+
+  g_assert_cmpuint (crank_digraph_get_nodes (fixture->digraph)->len, ==, 8);
+  g_assert_cmpuint (crank_digraph_get_edges (fixture->digraph)->len, ==, 5);
+
+  g_assert_cmpuint (crank_digraph_node_get_indegree (fixture->nodes[5]), ==, 0);
+  g_assert_cmpuint (crank_digraph_node_get_indegree (fixture->nodes[6]), ==, 1);
+  g_assert_cmpuint (crank_digraph_node_get_indegree (fixture->nodes[7]), ==, 0);
+  g_assert_cmpuint (crank_digraph_node_get_outdegree (fixture->nodes[7]), ==, 1);
+
+  // Removes 3, with edges 1->3, 2->3
+  crank_digraph_remove (fixture->digraph, fixture->nodes[3]);
+
+  g_assert_cmpuint (crank_digraph_get_nodes (fixture->digraph)->len, ==, 7);
+  g_assert_cmpuint (crank_digraph_get_edges (fixture->digraph)->len, ==, 3);
+
+  g_assert_cmpuint (crank_digraph_node_get_outdegree (fixture->nodes[1]), ==, 1);
+  g_assert_cmpuint (crank_digraph_node_get_outdegree (fixture->nodes[2]), ==, 0);
+  g_assert (crank_digraph_node_is_adjacent_to (fixture->nodes[1],
+                                               fixture->nodes[2]));
+}
+
+static void
+test_digraph_index_of (TestDigraphFixture *fixture,
+                       gconstpointer       userdata)
+{
+  guint i;
+
+  for (i = 0; i < 9; i++)
+    g_assert_cmpint (crank_digraph_index_of_node (fixture->digraph,
+                                                  fixture->nodes[i]), ==, i);
+
+  for (i = 0; i < 8; i++)
+    g_assert_cmpint (crank_digraph_index_of_edge (fixture->digraph,
+                                                  fixture->edges[i]), ==, i);
+
+  // Last one is moved into removed place.
+  crank_digraph_disconnect_edge (fixture->digraph, fixture->edges[2]);
+
+  g_assert_cmpint (crank_digraph_index_of_edge (fixture->digraph,
+                                                fixture->edges[7]), ==, 2);
+
+  crank_digraph_remove (fixture->digraph, fixture->nodes[0]);
+
+  g_assert_cmpint (crank_digraph_index_of_node (fixture->digraph,
+                                                fixture->nodes[8]), ==, 0);
+  g_assert (crank_digraph_nth_node (fixture->digraph, 0) == fixture->nodes[8]);
+
+  for (i = 1; i < 8; i++)
+    g_assert_cmpint (crank_digraph_index_of_node (fixture->digraph,
+                                                  fixture->nodes[i]), ==, i);
+}
+
+static void
+test_digraph_handle (TestDigraphFixture *fixture,
+                     gconstpointer       userdata)
+{
+  CrankDigraphHandle node_handle;
+  CrankDigraphHandle edge_handle;
+  CrankDigraphHandle edge_handle_other;
+  CrankDigraphNode *node;
+
+  node_handle = crank_digraph_node_get_handle (fixture->nodes[1]);
+  edge_handle = crank_digraph_edge_get_handle (fixture->edges[0]);
+  edge_handle_other = crank_digraph_edge_get_handle (fixture->edges[7]);
+
+  g_assert (node_handle != CRANK_DIGRAPH_HANDLE_NONE);
+  g_assert (crank_digraph_lookup_node (fixture->digraph,
+                                       node_handle) == fixture->nodes[1]);
+  g_assert (crank_digraph_lookup_edge (fixture->digraph,
+                                       edge_handle) == fixture->edges[0]);
+  g_assert (crank_digraph_lookup_node (fixture->digraph,
+                                       CRANK_DIGRAPH_HANDLE_NONE) == NULL);
+
+  // Removes 1, with edges 1->2, 1->3
+  crank_digraph_remove (fixture->digraph, fixture->nodes[1]);
+
+  g_assert (crank_digraph_lookup_node (fixture->digraph, node_handle) == NULL);
+  g_assert (crank_digraph_lookup_edge (fixture->digraph, edge_handle) == NULL);
+
+  // Handles of other ones are not changed.
+  g_assert (crank_digraph_lookup_edge (fixture->digraph,
+                                       edge_handle_other) == fixture->edges[7]);
+  g_assert (crank_digraph_lookup_node (
+              fixture->digraph,
+              crank_digraph_node_get_handle (fixture->nodes[8])) ==
+            fixture->nodes[8]);
+
+  // Reused slot does not resolve stale handle.
+  node = crank_digraph_add_pointer (fixture->digraph, G_TYPE_POINTER, NULL);
+
+  g_assert (crank_digraph_node_get_handle (node) != node_handle);
+  g_assert (crank_digraph_lookup_node (fixture->digraph, node_handle) == NULL);
+  g_assert (crank_digraph_lookup_node (fixture->digraph,
+                                       crank_digraph_node_get_handle (node)) ==
+            node);
+}
+
 static void
 test_digraph_disconnect_edge (TestDigraphFixture *fixture,
                               gconstpointer       userdata)
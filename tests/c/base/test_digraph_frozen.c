@@ -0,0 +1,612 @@
+/* Copyright (C) 2015, WSID   */
+
+/* Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <glib.h>
+
+#include "crankbase.h"
+
+//////// Declaration ///////////////////////////////////////////////////////////
+
+typedef struct _TestDigraphFrozenFixture {
+  CrankDigraph *digraph;
+  CrankDigraphNode *nodes[16];
+  CrankDigraphEdge *edges[16];
+
+  CrankDigraphFrozen *frozen;
+} TestDigraphFrozenFixture;
+
+static gboolean testutil_accumulator_index (const guint index,
+                                            gpointer    userdata);
+
+static gfloat   testutil_heuristic_zero (const guint from,
+                                         const guint to,
+                                         gpointer    userdata);
+
+static void     test_digraph_frozen_setup (TestDigraphFrozenFixture *fixture,
+                                           gconstpointer             userdata);
+
+static void     test_digraph_frozen_teardown (TestDigraphFrozenFixture *fixture,
+                                              gconstpointer             userdata);
+
+static void     test_digraph_frozen_nodes (TestDigraphFrozenFixture *fixture,
+                                           gconstpointer             userdata);
+
+static void     test_digraph_frozen_out (TestDigraphFrozenFixture *fixture,
+                                         gconstpointer             userdata);
+
+static void     test_digraph_frozen_in (TestDigraphFrozenFixture *fixture,
+                                        gconstpointer             userdata);
+
+static void     test_digraph_frozen_foreach_depth (TestDigraphFrozenFixture *fixture,
+                                                   gconstpointer             userdata);
+
+static void     test_digraph_frozen_foreach_breadth (TestDigraphFrozenFixture *fixture,
+                                                     gconstpointer             userdata);
+
+static void     test_digraph_frozen_dijkstra (TestDigraphFrozenFixture *fixture,
+                                              gconstpointer             userdata);
+
+static void     test_digraph_frozen_astar (TestDigraphFrozenFixture *fixture,
+                                           gconstpointer             userdata);
+
+static void     test_digraph_frozen_dijkstra_nearest (TestDigraphFrozenFixture *fixture,
+                                                      gconstpointer             userdata);
+
+static void     test_digraph_frozen_distances (TestDigraphFrozenFixture *fixture,
+                                               gconstpointer             userdata);
+
+static void     test_digraph_frozen_out_of_range (TestDigraphFrozenFixture *fixture,
+                                                  gconstpointer             userdata);
+
+static void     test_digraph_frozen_distance_table (TestDigraphFrozenFixture *fixture,
+                                                    gconstpointer             userdata);
+
+static void     test_digraph_frozen_distance_table_parallel (TestDigraphFrozenFixture *fixture,
+                                                             gconstpointer             userdata);
+
+//////// Main //////////////////////////////////////////////////////////////////
+
+gint
+main (gint   argc,
+      gchar *argv[])
+{
+  g_test_init (&argc, &argv, NULL);
+
+  g_test_add ("/crank/base/digraph/frozen/nodes",
+              TestDigraphFrozenFixture,
+              NULL,
+              test_digraph_frozen_setup,
+              test_digraph_frozen_nodes,
+              test_digraph_frozen_teardown);
+
+  g_test_add ("/crank/base/digraph/frozen/out",
+              TestDigraphFrozenFixture,
+              NULL,
+              test_digraph_frozen_setup,
+              test_digraph_frozen_out,
+              test_digraph_frozen_teardown);
+
+  g_test_add ("/crank/base/digraph/frozen/in",
+              TestDigraphFrozenFixture,
+              NULL,
+              test_digraph_frozen_setup,
+              test_digraph_frozen_in,
+              test_digraph_frozen_teardown);
+
+  g_test_add ("/crank/base/digraph/frozen/foreach/depth",
+              TestDigraphFrozenFixture,
+              NULL,
+              test_digraph_frozen_setup,
+              test_digraph_frozen_foreach_depth,
+              test_digraph_frozen_teardown);
+
+  g_test_add ("/crank/base/digraph/frozen/foreach/breadth",
+              TestDigraphFrozenFixture,
+              NULL,
+              test_digraph_frozen_setup,
+              test_digraph_frozen_foreach_breadth,
+              test_digraph_frozen_teardown);
+
+  g_test_add ("/crank/base/digraph/frozen/dijkstra",
+              TestDigraphFrozenFixture,
+              NULL,
+              test_digraph_frozen_setup,
+              test_digraph_frozen_dijkstra,
+              test_digraph_frozen_teardown);
+
+  g_test_add ("/crank/base/digraph/frozen/astar",
+              TestDigraphFrozenFixture,
+              NULL,
+              test_digraph_frozen_setup,
+              test_digraph_frozen_astar,
+              test_digraph_frozen_teardown);
+
+  g_test_add ("/crank/base/digraph/frozen/dijkstra/nearest",
+              TestDigraphFrozenFixture,
+              NULL,
+              test_digraph_frozen_setup,
+              test_digraph_frozen_dijkstra_nearest,
+              test_digraph_frozen_teardown);
+
+  g_test_add ("/crank/base/digraph/frozen/out_of_range",
+              TestDigraphFrozenFixture,
+              NULL,
+              test_digraph_frozen_setup,
+              test_digraph_frozen_out_of_range,
+              test_digraph_frozen_teardown);
+
+  g_test_add ("/crank/base/digraph/frozen/distances",
+              TestDigraphFrozenFixture,
+              NULL,
+              test_digraph_frozen_setup,
+              test_digraph_frozen_distances,
+              test_digraph_frozen_teardown);
+
+  g_test_add ("/crank/base/digraph/frozen/distance_table",
+              TestDigraphFrozenFixture,
+              NULL,
+              test_digraph_frozen_setup,
+              test_digraph_frozen_distance_table,
+              test_digraph_frozen_teardown);
+
+  g_test_add ("/crank/base/digraph/frozen/distance_table/parallel",
+              TestDigraphFrozenFixture,
+              NULL,
+              test_digraph_frozen_setup,
+              test_digraph_frozen_distance_table_parallel,
+              test_digraph_frozen_teardown);
+
+  g_test_run ();
+
+  return 0;
+}
+
+
+//////// Definition ////////////////////////////////////////////////////////////
+
+static gboolean
+testutil_accumulator_index (const guint index,
+                            gpointer    userdata)
+{
+  GArray *array = (GArray*) userdata;
+
+  g_array_append_val (array, index);
+
+  return TRUE;
+}
+
+static gfloat
+testutil_heuristic_zero (const guint from,
+                         const guint to,
+                         gpointer    userdata)
+{
+  return 0.0f;
+}
+
+static void
+testutil_assert_distances (const gfloat *dist,
+                           const gfloat *expected,
+                           const guint   n)
+{
+  guint i;
+
+  for (i = 0; i < n; i++)
+    {
+      if (isinf (expected[i]))
+        g_assert (isinf (dist[i]));
+      else
+        crank_assert_eqfloat (dist[i], expected[i], 0.0001f);
+    }
+}
+
+
+static void
+test_digraph_frozen_setup (TestDigraphFrozenFixture *fixture,
+                           gconstpointer             userdata)
+{
+  guint i;
+
+  fixture->digraph = crank_digraph_new ();
+
+  for (i = 0; i < 9; i++)
+    fixture->nodes[i] = crank_digraph_add_pointer (fixture->digraph,
+                                                   G_TYPE_POINTER,
+                                                   GUINT_TO_POINTER (i));
+
+  // 1->2, 1->3, 2->3
+  fixture->edges[0] = crank_digraph_connect_float (fixture->digraph,
+                                                   fixture->nodes[1],
+                                                   fixture->nodes[2],
+                                                   17.3f);
+
+  fixture->edges[1] = crank_digraph_connect_float (fixture->digraph,
+                                                   fixture->nodes[1],
+                                                   fixture->nodes[3],
+                                                   32.1f);
+
+  fixture->edges[2] = crank_digraph_connect_float (fixture->digraph,
+                                                   fixture->nodes[2],
+                                                   fixture->nodes[3],
+                                                   18.3f);
+
+  // 4->5, 4->6, 4->7, 5->8, 7->6
+  fixture->edges[3] = crank_digraph_connect_float (fixture->digraph,
+                                                   fixture->nodes[4],
+                                                   fixture->nodes[5],
+                                                   21.3f);
+
+  fixture->edges[4] = crank_digraph_connect_float (fixture->digraph,
+                                                   fixture->nodes[4],
+                                                   fixture->nodes[6],
+                                                   10.5f);
+
+  fixture->edges[5] = crank_digraph_connect_float (fixture->digraph,
+                                                   fixture->nodes[4],
+                                                   fixture->nodes[7],
+                                                   17.5f);
+
+  fixture->edges[6] = crank_digraph_connect_float (fixture->digraph,
+                                                   fixture->nodes[5],
+                                                   fixture->nodes[8],
+                                                   9.4f);
+
+  fixture->edges[7] = crank_digraph_connect_float (fixture->digraph,
+                                                   fixture->nodes[7],
+                                                   fixture->nodes[6],
+                                                   19.6f);
+
+  fixture->frozen = crank_digraph_freeze (fixture->digraph, NULL, NULL);
+}
+
+static void
+test_digraph_frozen_teardown (TestDigraphFrozenFixture *fixture,
+                              gconstpointer             userdata)
+{
+  crank_digraph_frozen_unref (fixture->frozen);
+  crank_digraph_unref (fixture->digraph);
+}
+
+static void
+test_digraph_frozen_nodes (TestDigraphFrozenFixture *fixture,
+                           gconstpointer             userdata)
+{
+  CrankDigraphFrozen *frozen = fixture->frozen;
+  guint i;
+
+  g_assert_cmpuint (crank_digraph_frozen_get_nnodes (frozen), ==, 9);
+  g_assert_cmpuint (crank_digraph_frozen_get_nedges (frozen), ==, 8);
+
+  for (i = 0; i < 9; i++)
+    {
+      g_assert (crank_digraph_frozen_get_node (frozen, i) == fixture->nodes[i]);
+      g_assert_cmpint (crank_digraph_frozen_index_of_node (frozen,
+                                                           fixture->nodes[i]),
+                       ==, i);
+    }
+
+  g_assert (crank_digraph_frozen_get_node (frozen, 9) == NULL);
+  g_assert_cmpint (crank_digraph_frozen_index_of_node (frozen, NULL), ==, -1);
+}
+
+static void
+test_digraph_frozen_out (TestDigraphFrozenFixture *fixture,
+                         gconstpointer             userdata)
+{
+  CrankDigraphFrozen *frozen = fixture->frozen;
+  guint i;
+
+  crank_assert_eqarray_uint_imm (
+    crank_digraph_frozen_get_out_offsets (frozen), 10,
+    0, 0, 2, 3, 3, 6, 7, 7, 8, 8);
+
+  crank_assert_eqarray_uint_imm (
+    crank_digraph_frozen_get_out_heads (frozen), 8,
+    2, 3, 3, 5, 6, 7, 8, 6);
+
+  crank_assert_eqarray_float_imm (
+    crank_digraph_frozen_get_out_weights (frozen), 8,
+    17.3f, 32.1f, 18.3f, 21.3f, 10.5f, 17.5f, 9.4f, 19.6f);
+
+  for (i = 0; i < 8; i++)
+    g_assert (crank_digraph_frozen_get_edge (frozen, i) == fixture->edges[i]);
+
+  g_assert_cmpuint (crank_digraph_frozen_get_outdegree (frozen, 4), ==, 3);
+  g_assert_cmpuint (crank_digraph_frozen_get_outdegree (frozen, 8), ==, 0);
+}
+
+static void
+test_digraph_frozen_in (TestDigraphFrozenFixture *fixture,
+                        gconstpointer             userdata)
+{
+  CrankDigraphFrozen *frozen = fixture->frozen;
+
+  crank_assert_eqarray_uint_imm (
+    crank_digraph_frozen_get_in_offsets (frozen), 10,
+    0, 0, 0, 1, 3, 3, 4, 6, 7, 8);
+
+  crank_assert_eqarray_uint_imm (
+    crank_digraph_frozen_get_in_tails (frozen), 8,
+    1, 1, 2, 4, 4, 7, 4, 5);
+
+  crank_assert_eqarray_float_imm (
+    crank_digraph_frozen_get_in_weights (frozen), 8,
+    17.3f, 32.1f, 18.3f, 21.3f, 10.5f, 19.6f, 17.5f, 9.4f);
+
+  crank_assert_eqarray_uint_imm (
+    crank_digraph_frozen_get_in_edges (frozen), 8,
+    0, 1, 2, 3, 4, 7, 5, 6);
+
+  g_assert_cmpuint (crank_digraph_frozen_get_indegree (frozen, 6), ==, 2);
+  g_assert_cmpuint (crank_digraph_frozen_get_indegree (frozen, 4), ==, 0);
+}
+
+static void
+test_digraph_frozen_foreach_depth (TestDigraphFrozenFixture *fixture,
+                                   gconstpointer             userdata)
+{
+  GArray *array = g_array_new (FALSE, FALSE, sizeof (guint));
+
+  g_assert (crank_digraph_frozen_foreach_depth (fixture->frozen, 0,
+                                                testutil_accumulator_index,
+                                                array));
+
+  crank_assert_eqarray_uint_imm ((guint*) array->data, array->len, 0);
+
+  g_array_set_size (array, 0);
+  g_assert (crank_digraph_frozen_foreach_depth (fixture->frozen, 1,
+                                                testutil_accumulator_index,
+                                                array));
+
+  crank_assert_eqarray_uint_imm ((guint*) array->data, array->len, 1, 3, 2);
+
+  g_array_set_size (array, 0);
+  g_assert (crank_digraph_frozen_foreach_depth (fixture->frozen, 4,
+                                                testutil_accumulator_index,
+                                                array));
+
+  crank_assert_eqarray_uint_imm ((guint*) array->data, array->len,
+                                 4, 7, 6, 5, 8);
+
+  g_array_unref (array);
+}
+
+static void
+test_digraph_frozen_foreach_breadth (TestDigraphFrozenFixture *fixture,
+                                     gconstpointer             userdata)
+{
+  GArray *array = g_array_new (FALSE, FALSE, sizeof (guint));
+
+  g_assert (crank_digraph_frozen_foreach_breadth (fixture->frozen, 0,
+                                                  testutil_accumulator_index,
+                                                  array));
+
+  crank_assert_eqarray_uint_imm ((guint*) array->data, array->len, 0);
+
+  g_array_set_size (array, 0);
+  g_assert (crank_digraph_frozen_foreach_breadth (fixture->frozen, 1,
+                                                  testutil_accumulator_index,
+                                                  array));
+
+  crank_assert_eqarray_uint_imm ((guint*) array->data, array->len, 1, 2, 3);
+
+  g_array_set_size (array, 0);
+  g_assert (crank_digraph_frozen_foreach_breadth (fixture->frozen, 4,
+                                                  testutil_accumulator_index,
+                                                  array));
+
+  crank_assert_eqarray_uint_imm ((guint*) array->data, array->len,
+                                 4, 5, 6, 7, 8);
+
+  g_array_unref (array);
+}
+
+static void
+test_digraph_frozen_dijkstra (TestDigraphFrozenFixture *fixture,
+                              gconstpointer             userdata)
+{
+  GArray *path = g_array_new (FALSE, FALSE, sizeof (guint));
+  gfloat cost;
+
+  g_assert (crank_digraph_frozen_dijkstra (fixture->frozen, 1, 3, path, &cost));
+  crank_assert_eqarray_uint_imm ((guint*) path->data, path->len, 1, 3);
+  g_assert_cmpfloat (cost, ==, 32.1f);
+
+  g_assert (crank_digraph_frozen_dijkstra (fixture->frozen, 4, 8, path, &cost));
+  crank_assert_eqarray_uint_imm ((guint*) path->data, path->len, 4, 5, 8);
+  crank_assert_eqfloat (cost, 30.7f, 0.0001f);
+
+  g_assert (crank_digraph_frozen_dijkstra (fixture->frozen, 4, 6, path, &cost));
+  crank_assert_eqarray_uint_imm ((guint*) path->data, path->len, 4, 6);
+  g_assert_cmpfloat (cost, ==, 10.5f);
+
+  g_assert (crank_digraph_frozen_dijkstra (fixture->frozen, 2, 2, path, &cost));
+  crank_assert_eqarray_uint_imm ((guint*) path->data, path->len, 2);
+  g_assert_cmpfloat (cost, ==, 0.0f);
+
+  g_assert (! crank_digraph_frozen_dijkstra (fixture->frozen, 0, 1, path, NULL));
+  g_assert (! crank_digraph_frozen_dijkstra (fixture->frozen, 3, 1, path, NULL));
+  g_assert (! crank_digraph_frozen_dijkstra (fixture->frozen, 1, 4, NULL, NULL));
+
+  g_array_unref (path);
+}
+
+static void
+test_digraph_frozen_astar (TestDigraphFrozenFixture *fixture,
+                           gconstpointer             userdata)
+{
+  GArray *path = g_array_new (FALSE, FALSE, sizeof (guint));
+  gfloat cost;
+
+  g_assert (crank_digraph_frozen_astar (fixture->frozen, 4, 8,
+                                        testutil_heuristic_zero, NULL,
+                                        path, &cost));
+  crank_assert_eqarray_uint_imm ((guint*) path->data, path->len, 4, 5, 8);
+  crank_assert_eqfloat (cost, 30.7f, 0.0001f);
+
+  g_assert (! crank_digraph_frozen_astar (fixture->frozen, 8, 4,
+                                          testutil_heuristic_zero, NULL,
+                                          path, NULL));
+
+  g_array_unref (path);
+}
+
+static void
+test_digraph_frozen_dijkstra_nearest (TestDigraphFrozenFixture *fixture,
+                                      gconstpointer             userdata)
+{
+  GArray *path = g_array_new (FALSE, FALSE, sizeof (guint));
+  gfloat cost;
+
+  guint sources[2] = {1, 4};
+  guint goals[3] = {3, 8, 6};
+  guint goals_near[2] = {3, 2};
+
+  g_assert (crank_digraph_frozen_dijkstra_nearest (fixture->frozen,
+                                                   sources, 2, goals, 3,
+                                                   path, &cost));
+  crank_assert_eqarray_uint_imm ((guint*) path->data, path->len, 4, 6);
+  g_assert_cmpfloat (cost, ==, 10.5f);
+
+  g_assert (crank_digraph_frozen_dijkstra_nearest (fixture->frozen,
+                                                   sources, 1, goals_near, 2,
+                                                   path, &cost));
+  crank_assert_eqarray_uint_imm ((guint*) path->data, path->len, 1, 2);
+  g_assert_cmpfloat (cost, ==, 17.3f);
+
+  g_assert (! crank_digraph_frozen_dijkstra_nearest (fixture->frozen,
+                                                     sources + 1, 1, goals, 1,
+                                                     path, NULL));
+
+  g_array_unref (path);
+}
+
+static void
+test_digraph_frozen_distances (TestDigraphFrozenFixture *fixture,
+                               gconstpointer             userdata)
+{
+  gfloat dist[9];
+  guint sources[2] = {4, 1};
+
+  gfloat expected_4[9] = {INFINITY, INFINITY, INFINITY, INFINITY,
+                          0.0f, 21.3f, 10.5f, 17.5f, 30.7f};
+
+  gfloat expected_41[9] = {INFINITY, 0.0f, 17.3f, 32.1f,
+                           0.0f, 21.3f, 10.5f, 17.5f, 30.7f};
+
+  crank_digraph_frozen_distances (fixture->frozen, sources, 1, dist);
+  testutil_assert_distances (dist, expected_4, 9);
+
+  crank_digraph_frozen_distances (fixture->frozen, sources, 2, dist);
+  testutil_assert_distances (dist, expected_41, 9);
+}
+
+static void
+test_digraph_frozen_out_of_range (TestDigraphFrozenFixture *fixture,
+                                  gconstpointer             userdata)
+{
+  GArray *path = g_array_new (FALSE, FALSE, sizeof (guint));
+  gfloat table[2] = {-1.0f, -1.0f};
+
+  guint sources[1] = {1};
+  guint goals[2] = {3, 9};
+
+  g_test_expect_message (G_LOG_DOMAIN, G_LOG_LEVEL_CRITICAL, "*goals*");
+  g_assert (! crank_digraph_frozen_dijkstra_nearest (fixture->frozen,
+                                                     sources, 1, goals, 2,
+                                                     path, NULL));
+  g_test_assert_expected_messages ();
+  g_assert_cmpuint (path->len, ==, 0);
+
+  g_test_expect_message (G_LOG_DOMAIN, G_LOG_LEVEL_CRITICAL, "*targets*");
+  crank_digraph_frozen_distance_table (fixture->frozen,
+                                       sources, 1, goals, 2,
+                                       table);
+  g_test_assert_expected_messages ();
+  g_assert_cmpfloat (table[0], ==, -1.0f);
+
+  // Other searches still work with the snapshot.
+  g_assert (crank_digraph_frozen_dijkstra_nearest (fixture->frozen,
+                                                   sources, 1, goals, 1,
+                                                   path, NULL));
+
+  g_array_unref (path);
+}
+
+static void
+test_digraph_frozen_distance_table (TestDigraphFrozenFixture *fixture,
+                                    gconstpointer             userdata)
+{
+  gfloat table[10];
+
+  guint sources[2] = {1, 4};
+  guint targets[4] = {3, 6, 8, 2};
+
+  guint sources_many[5] = {1, 2, 4, 5, 0};
+  guint targets_few[2] = {3, 8};
+
+  gfloat expected[8] = {32.1f, INFINITY, INFINITY, 17.3f,
+                        INFINITY, 10.5f, 30.7f, INFINITY};
+
+  gfloat expected_many[10] = {32.1f, INFINITY,
+                              18.3f, INFINITY,
+                              INFINITY, 30.7f,
+                              INFINITY, 9.4f,
+                              INFINITY, INFINITY};
+
+  crank_digraph_frozen_distance_table (fixture->frozen,
+                                       sources, 2, targets, 4,
+                                       table);
+  testutil_assert_distances (table, expected, 8);
+
+  // Runs searches from targets, over incoming edges.
+  crank_digraph_frozen_distance_table (fixture->frozen,
+                                       sources_many, 5, targets_few, 2,
+                                       table);
+  testutil_assert_distances (table, expected_many, 10);
+}
+
+static void
+test_digraph_frozen_distance_table_parallel (TestDigraphFrozenFixture *fixture,
+                                             gconstpointer             userdata)
+{
+  gfloat table[81];
+  gfloat expected[81];
+  guint nodes[9];
+  guint i;
+
+  for (i = 0; i < 9; i++)
+    nodes[i] = i;
+
+  for (i = 0; i < 9; i++)
+    crank_digraph_frozen_distances (fixture->frozen, nodes + i, 1,
+                                    expected + (i * 9));
+
+  crank_digraph_frozen_distance_table_parallel (fixture->frozen,
+                                                nodes, 9, nodes, 9,
+                                                table, 4);
+  testutil_assert_distances (table, expected, 81);
+
+  crank_digraph_frozen_distance_table_parallel (fixture->frozen,
+                                                nodes, 9, nodes + 4, 3,
+                                                table, 0);
+  for (i = 0; i < 9; i++)
+    testutil_assert_distances (table + (i * 3), expected + (i * 9) + 4, 3);
+}
@@ -0,0 +1,352 @@
+/* Copyright (C) 2015, WSID   */
+
+/* Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <glib.h>
+#include <glib/gstdio.h>
+
+#include "crankbase.h"
+
+//////// Declaration ///////////////////////////////////////////////////////////
+
+#define GRID_SIZE 6
+#define GRID_NNODES (GRID_SIZE * GRID_SIZE + 1)
+
+typedef struct _TestDigraphLandmarksFixture {
+  CrankDigraph *digraph;
+  CrankDigraphNode *nodes[GRID_NNODES];
+
+  CrankDigraphFrozen *frozen;
+  CrankDigraphLandmarks *landmarks;
+} TestDigraphLandmarksFixture;
+
+static gfloat   testutil_edge_one (CrankDigraphEdge *edge,
+                                   gpointer          userdata);
+
+static void     test_digraph_landmarks_setup (TestDigraphLandmarksFixture *fixture,
+                                              gconstpointer                userdata);
+
+static void     test_digraph_landmarks_teardown (TestDigraphLandmarksFixture *fixture,
+                                                 gconstpointer                userdata);
+
+static void     test_digraph_landmarks_new (TestDigraphLandmarksFixture *fixture,
+                                            gconstpointer                userdata);
+
+static void     test_digraph_landmarks_new_with_nodes (TestDigraphLandmarksFixture *fixture,
+                                                       gconstpointer                userdata);
+
+static void     test_digraph_landmarks_estimate (TestDigraphLandmarksFixture *fixture,
+                                                 gconstpointer                userdata);
+
+static void     test_digraph_landmarks_astar (TestDigraphLandmarksFixture *fixture,
+                                              gconstpointer                userdata);
+
+static void     test_digraph_landmarks_save_load (TestDigraphLandmarksFixture *fixture,
+                                                  gconstpointer                userdata);
+
+//////// Main //////////////////////////////////////////////////////////////////
+
+gint
+main (gint   argc,
+      gchar *argv[])
+{
+  g_test_init (&argc, &argv, NULL);
+
+  g_test_add ("/crank/base/digraph/landmarks/new",
+              TestDigraphLandmarksFixture,
+              NULL,
+              test_digraph_landmarks_setup,
+              test_digraph_landmarks_new,
+              test_digraph_landmarks_teardown);
+
+  g_test_add ("/crank/base/digraph/landmarks/new/with_nodes",
+              TestDigraphLandmarksFixture,
+              NULL,
+              test_digraph_landmarks_setup,
+              test_digraph_landmarks_new_with_nodes,
+              test_digraph_landmarks_teardown);
+
+  g_test_add ("/crank/base/digraph/landmarks/estimate",
+              TestDigraphLandmarksFixture,
+              NULL,
+              test_digraph_landmarks_setup,
+              test_digraph_landmarks_estimate,
+              test_digraph_landmarks_teardown);
+
+  g_test_add ("/crank/base/digraph/landmarks/astar",
+              TestDigraphLandmarksFixture,
+              NULL,
+              test_digraph_landmarks_setup,
+              test_digraph_landmarks_astar,
+              test_digraph_landmarks_teardown);
+
+  g_test_add ("/crank/base/digraph/landmarks/save_load",
+              TestDigraphLandmarksFixture,
+              NULL,
+              test_digraph_landmarks_setup,
+              test_digraph_landmarks_save_load,
+              test_digraph_landmarks_teardown);
+
+  g_test_run ();
+
+  return 0;
+}
+
+
+//////// Definition ////////////////////////////////////////////////////////////
+
+static gfloat
+testutil_edge_one (CrankDigraphEdge *edge,
+                   gpointer          userdata)
+{
+  return 1.0f;
+}
+
+
+static void
+test_digraph_landmarks_setup (TestDigraphLandmarksFixture *fixture,
+                              gconstpointer                userdata)
+{
+  guint i;
+  guint x;
+  guint y;
+
+  fixture->digraph = crank_digraph_new ();
+
+  for (i = 0; i < GRID_NNODES; i++)
+    fixture->nodes[i] = crank_digraph_add_pointer (fixture->digraph,
+                                                   G_TYPE_POINTER,
+                                                   GUINT_TO_POINTER (i));
+
+  // Grid of roads with varying costs. Row 2 is one-way to right.
+  // Last node is not connected.
+  for (y = 0; y < GRID_SIZE; y++)
+    {
+      for (x = 0; x < GRID_SIZE; x++)
+        {
+          CrankDigraphNode *node = fixture->nodes[y * GRID_SIZE + x];
+          gfloat weight = 1.0f + ((x * 7 + y * 3) % 5);
+
+          if (x + 1 < GRID_SIZE)
+            {
+              CrankDigraphNode *right = fixture->nodes[y * GRID_SIZE + x + 1];
+
+              crank_digraph_connect_float (fixture->digraph, node, right, weight);
+              if (y != 2)
+                crank_digraph_connect_float (fixture->digraph, right, node, weight);
+            }
+
+          if (y + 1 < GRID_SIZE)
+            {
+              CrankDigraphNode *down = fixture->nodes[(y + 1) * GRID_SIZE + x];
+
+              crank_digraph_connect_float (fixture->digraph, node, down, weight + 1);
+              crank_digraph_connect_float (fixture->digraph, down, node, weight + 1);
+            }
+        }
+    }
+
+  fixture->frozen = crank_digraph_freeze (fixture->digraph, NULL, NULL);
+  fixture->landmarks = crank_digraph_landmarks_new (fixture->frozen, 4);
+}
+
+static void
+test_digraph_landmarks_teardown (TestDigraphLandmarksFixture *fixture,
+                                 gconstpointer                userdata)
+{
+  crank_digraph_landmarks_unref (fixture->landmarks);
+  crank_digraph_frozen_unref (fixture->frozen);
+  crank_digraph_unref (fixture->digraph);
+}
+
+static void
+test_digraph_landmarks_new (TestDigraphLandmarksFixture *fixture,
+                            gconstpointer                userdata)
+{
+  CrankDigraphLandmarks *all;
+  guint i;
+  guint j;
+
+  g_assert (crank_digraph_landmarks_get_frozen (fixture->landmarks) ==
+            fixture->frozen);
+  g_assert_cmpuint (crank_digraph_landmarks_get_nlandmarks (fixture->landmarks),
+                    ==, 4);
+
+  // Unreachable node is picked first.
+  g_assert_cmpuint (crank_digraph_landmarks_get_landmark (fixture->landmarks, 0),
+                    ==, GRID_NNODES - 1);
+
+  for (i = 0; i < 4; i++)
+    {
+      guint li = crank_digraph_landmarks_get_landmark (fixture->landmarks, i);
+
+      g_assert_cmpuint (li, <, GRID_NNODES);
+
+      for (j = 0; j < i; j++)
+        g_assert_cmpuint (li, !=,
+                          crank_digraph_landmarks_get_landmark (fixture->landmarks, j));
+    }
+
+  all = crank_digraph_landmarks_new (fixture->frozen, 100);
+  g_assert_cmpuint (crank_digraph_landmarks_get_nlandmarks (all), ==, GRID_NNODES);
+  crank_digraph_landmarks_unref (all);
+}
+
+static void
+test_digraph_landmarks_new_with_nodes (TestDigraphLandmarksFixture *fixture,
+                                       gconstpointer                userdata)
+{
+  CrankDigraphLandmarks *landmarks;
+  guint nodes[2] = {0, 35};
+  gfloat cost;
+
+  landmarks = crank_digraph_landmarks_new_with_nodes (fixture->frozen, nodes, 2);
+
+  g_assert_cmpuint (crank_digraph_landmarks_get_nlandmarks (landmarks), ==, 2);
+  g_assert_cmpuint (crank_digraph_landmarks_get_landmark (landmarks, 0), ==, 0);
+  g_assert_cmpuint (crank_digraph_landmarks_get_landmark (landmarks, 1), ==, 35);
+
+  // Estimation to landmark is exact.
+  g_assert (crank_digraph_frozen_dijkstra (fixture->frozen, 0, 35, NULL, &cost));
+  crank_assert_eqfloat (crank_digraph_landmarks_estimate (landmarks, 0, 35),
+                        cost, 0.0001f);
+
+  crank_digraph_landmarks_unref (landmarks);
+}
+
+static void
+test_digraph_landmarks_estimate (TestDigraphLandmarksFixture *fixture,
+                                 gconstpointer                userdata)
+{
+  guint from;
+  guint to;
+
+  for (from = 0; from < GRID_NNODES; from++)
+    {
+      for (to = 0; to < GRID_NNODES; to++)
+        {
+          gfloat estimate;
+          gfloat cost;
+
+          estimate = crank_digraph_landmarks_estimate (fixture->landmarks,
+                                                       from, to);
+
+          if (crank_digraph_frozen_dijkstra (fixture->frozen, from, to,
+                                             NULL, &cost))
+            g_assert_cmpfloat (estimate, <=, cost + 0.0001f);
+          else
+            g_assert (isinf (estimate));
+        }
+    }
+}
+
+static void
+test_digraph_landmarks_astar (TestDigraphLandmarksFixture *fixture,
+                              gconstpointer                userdata)
+{
+  GArray *path = g_array_new (FALSE, FALSE, sizeof (guint));
+  guint from;
+  guint to;
+
+  for (from = 0; from < GRID_NNODES; from++)
+    {
+      for (to = 0; to < GRID_NNODES; to++)
+        {
+          gboolean reachable;
+          gfloat expected;
+          gfloat cost;
+
+          reachable = crank_digraph_frozen_dijkstra (fixture->frozen, from, to,
+                                                     NULL, &expected);
+
+          g_assert (crank_digraph_landmarks_astar (fixture->landmarks, from, to,
+                                                   path, &cost) == reachable);
+
+          if (reachable)
+            {
+              crank_assert_eqfloat (cost, expected, 0.0001f);
+              g_assert_cmpuint (g_array_index (path, guint, 0), ==, from);
+              g_assert_cmpuint (g_array_index (path, guint, path->len - 1), ==, to);
+            }
+        }
+    }
+
+  g_array_unref (path);
+}
+
+static void
+test_digraph_landmarks_save_load (TestDigraphLandmarksFixture *fixture,
+                                  gconstpointer                userdata)
+{
+  CrankDigraphLandmarks *loaded;
+  CrankDigraphFrozen *other;
+  GError *error = NULL;
+  gchar *filename;
+  guint from;
+  guint to;
+  guint i;
+
+  filename = g_build_filename (g_get_tmp_dir (),
+                               "test-digraph-landmarks.bin",
+                               NULL);
+
+  g_assert (crank_digraph_landmarks_save (fixture->landmarks, filename, &error));
+  g_assert_no_error (error);
+
+  loaded = crank_digraph_landmarks_load (fixture->frozen, filename, &error);
+  g_assert_no_error (error);
+  g_assert (loaded != NULL);
+
+  g_assert_cmpuint (crank_digraph_landmarks_get_nlandmarks (loaded), ==, 4);
+  for (i = 0; i < 4; i++)
+    g_assert_cmpuint (crank_digraph_landmarks_get_landmark (loaded, i), ==,
+                      crank_digraph_landmarks_get_landmark (fixture->landmarks, i));
+
+  for (from = 0; from < GRID_NNODES; from++)
+    for (to = 0; to < GRID_NNODES; to++)
+      {
+        gfloat a = crank_digraph_landmarks_estimate (fixture->landmarks, from, to);
+        gfloat b = crank_digraph_landmarks_estimate (loaded, from, to);
+
+        g_assert (isinf (a) ? isinf (b) : (a == b));
+      }
+
+  crank_digraph_landmarks_unref (loaded);
+
+  // Same graph with different weights.
+  other = crank_digraph_freeze (fixture->digraph, testutil_edge_one, NULL);
+  loaded = crank_digraph_landmarks_load (other, filename, &error);
+  g_assert (loaded == NULL);
+  g_assert_error (error, CRANK_DIGRAPH_LANDMARKS_ERROR,
+                  CRANK_DIGRAPH_LANDMARKS_ERROR_MISMATCH);
+  g_clear_error (&error);
+  crank_digraph_frozen_unref (other);
+
+  // Truncated file.
+  g_assert (g_file_set_contents (filename, "CLMK", 4, NULL));
+  loaded = crank_digraph_landmarks_load (fixture->frozen, filename, &error);
+  g_assert (loaded == NULL);
+  g_assert_error (error, CRANK_DIGRAPH_LANDMARKS_ERROR,
+                  CRANK_DIGRAPH_LANDMARKS_ERROR_INVALID);
+  g_clear_error (&error);
+
+  g_unlink (filename);
+  g_free (filename);
+}
@@ -0,0 +1,279 @@
+/* Copyright (C) 2015, WSID   */
+
+/* Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <math.h>
+#include <glib.h>
+
+#include "crankbase.h"
+
+//////// Declaration ///////////////////////////////////////////////////////////
+
+static void test_expf (void);
+
+static void test_expf_special (void);
+
+static void test_logf (void);
+
+static void test_logf_special (void);
+
+static void test_sincosf (void);
+
+static void test_sinhcoshf (void);
+
+static void test_atan2f (void);
+
+static void test_enabled (void);
+
+//////// Test Helpers //////////////////////////////////////////////////////////
+
+static gdouble test_ulp_err (const gfloat  r,
+                             const gdouble e);
+
+//////// Main //////////////////////////////////////////////////////////////////
+
+gint
+main (gint   argc,
+      gchar *argv[])
+{
+  g_test_init (&argc, &argv, NULL);
+
+  g_test_add_func ("/crank/base/fast/expf",           test_expf);
+  g_test_add_func ("/crank/base/fast/expf/special",   test_expf_special);
+  g_test_add_func ("/crank/base/fast/logf",           test_logf);
+  g_test_add_func ("/crank/base/fast/logf/special",   test_logf_special);
+  g_test_add_func ("/crank/base/fast/sincosf",        test_sincosf);
+  g_test_add_func ("/crank/base/fast/sinhcoshf",      test_sinhcoshf);
+  g_test_add_func ("/crank/base/fast/atan2f",         test_atan2f);
+  g_test_add_func ("/crank/base/fast/enabled",        test_enabled);
+
+  g_test_run ();
+
+  return 0;
+}
+
+
+//////// Definition ////////////////////////////////////////////////////////////
+
+#define TEST_N 1001
+
+static void
+test_expf (void)
+{
+  gfloat x[TEST_N];
+  gfloat r[TEST_N];
+  guint i;
+
+  for (i = 0; i < TEST_N; i++)
+    x[i] = -87.3f + 176.0f * i / (TEST_N - 1);
+
+  crank_fast_expf_array (TEST_N, x, r);
+
+  for (i = 0; i < TEST_N; i++)
+    {
+      gdouble e = exp (x[i]);
+
+      g_assert_cmpfloat (test_ulp_err (r[i], e), <=, 1.5);
+      g_assert_cmpfloat (test_ulp_err (crank_fast_expf (x[i]), e), <=, 1.5);
+    }
+}
+
+static void
+test_expf_special (void)
+{
+  gfloat x[8] = {INFINITY, -INFINITY, NAN, 0.0f, 100.0f, -110.0f, 1.0f, -1.0f};
+  gfloat r[8];
+
+  crank_fast_expf_array (8, x, r);
+
+  g_assert_cmpfloat (r[0], ==, INFINITY);
+  g_assert_cmpfloat (r[1], ==, 0.0f);
+  g_assert (isnan (r[2]));
+  g_assert_cmpfloat (r[3], ==, 1.0f);
+  g_assert_cmpfloat (r[4], ==, INFINITY);
+  g_assert_cmpfloat (r[5], ==, 0.0f);
+
+  g_assert_cmpfloat (crank_fast_expf (INFINITY), ==, INFINITY);
+  g_assert_cmpfloat (crank_fast_expf (-INFINITY), ==, 0.0f);
+  g_assert (isnan (crank_fast_expf (NAN)));
+}
+
+static void
+test_logf (void)
+{
+  gfloat x[TEST_N];
+  gfloat r[TEST_N];
+  guint i;
+
+  for (i = 0; i < TEST_N; i++)
+    x[i] = expf (-87.0f + 175.0f * i / (TEST_N - 1));
+
+  crank_fast_logf_array (TEST_N, x, r);
+
+  for (i = 0; i < TEST_N; i++)
+    {
+      gdouble e = log (x[i]);
+
+      g_assert_cmpfloat (test_ulp_err (r[i], e), <=, 1.0);
+      g_assert_cmpfloat (test_ulp_err (crank_fast_logf (x[i]), e), <=, 1.0);
+    }
+}
+
+static void
+test_logf_special (void)
+{
+  gfloat x[8] = {INFINITY, -INFINITY, NAN, 0.0f, -1.0f, 1e-40f, 1.0f, 2.0f};
+  gfloat r[8];
+
+  crank_fast_logf_array (8, x, r);
+
+  g_assert_cmpfloat (r[0], ==, INFINITY);
+  g_assert (isnan (r[1]));
+  g_assert (isnan (r[2]));
+  g_assert_cmpfloat (r[3], ==, -INFINITY);
+  g_assert (isnan (r[4]));
+  g_assert_cmpfloat (test_ulp_err (r[5], log (1e-40f)), <=, 1.0);
+  g_assert_cmpfloat (r[6], ==, 0.0f);
+
+  g_assert_cmpfloat (crank_fast_logf (0.0f), ==, -INFINITY);
+  g_assert (isnan (crank_fast_logf (-1.0f)));
+  g_assert_cmpfloat (test_ulp_err (crank_fast_logf (1e-40f), log (1e-40f)),
+                     <=, 1.0);
+}
+
+static void
+test_sincosf (void)
+{
+  gfloat x[TEST_N];
+  gfloat s[TEST_N];
+  gfloat c[TEST_N];
+  guint i;
+
+  for (i = 0; i < TEST_N; i++)
+    x[i] = (gfloat) (-G_PI + 2 * G_PI * i / (TEST_N - 1));
+
+  crank_fast_sincosf_array (TEST_N, x, s, c);
+
+  for (i = 0; i < TEST_N; i++)
+    {
+      g_assert_cmpfloat (test_ulp_err (s[i], sin (x[i])), <=, 2.0);
+      g_assert_cmpfloat (test_ulp_err (c[i], cos (x[i])), <=, 2.0);
+    }
+
+  // On wide range, absolute errors are checked.
+  for (i = 0; i < TEST_N; i++)
+    x[i] = -8192.0f + 16384.0f * i / (TEST_N - 1);
+
+  crank_fast_sincosf_array (TEST_N, x, s, c);
+
+  for (i = 0; i < TEST_N; i++)
+    {
+      gfloat ss;
+      gfloat cc;
+
+      crank_fast_sincosf (x[i], &ss, &cc);
+
+      g_assert_cmpfloat (ABS (s[i] - sin (x[i])), <=, 1e-7);
+      g_assert_cmpfloat (ABS (c[i] - cos (x[i])), <=, 1e-7);
+      g_assert_cmpfloat (ABS (ss - sin (x[i])), <=, 1e-7);
+      g_assert_cmpfloat (ABS (cc - cos (x[i])), <=, 1e-7);
+    }
+}
+
+static void
+test_sinhcoshf (void)
+{
+  gfloat x[TEST_N];
+  gfloat sh[TEST_N];
+  gfloat ch[TEST_N];
+  guint i;
+
+  for (i = 0; i < TEST_N; i++)
+    x[i] = -88.0f + 176.0f * i / (TEST_N - 1);
+
+  crank_fast_sinhcoshf_array (TEST_N, x, sh, ch);
+
+  for (i = 0; i < TEST_N; i++)
+    {
+      gfloat ssh;
+      gfloat cch;
+
+      crank_fast_sinhcoshf (x[i], &ssh, &cch);
+
+      g_assert_cmpfloat (test_ulp_err (sh[i], sinh (x[i])), <=, 2.0);
+      g_assert_cmpfloat (test_ulp_err (ch[i], cosh (x[i])), <=, 2.0);
+      g_assert_cmpfloat (test_ulp_err (ssh, sinh (x[i])), <=, 2.0);
+      g_assert_cmpfloat (test_ulp_err (cch, cosh (x[i])), <=, 2.0);
+    }
+}
+
+static void
+test_atan2f (void)
+{
+  gfloat x[TEST_N];
+  gfloat y[TEST_N];
+  gfloat r[TEST_N];
+  guint i;
+
+  for (i = 0; i < TEST_N; i++)
+    {
+      gdouble t = 2 * G_PI * i / (TEST_N - 1);
+
+      x[i] = (gfloat) (cos (t) * (1 + i % 5));
+      y[i] = (gfloat) (sin (t) * (1 + i % 7));
+    }
+
+  crank_fast_atan2f_array (TEST_N, y, x, r);
+
+  for (i = 0; i < TEST_N; i++)
+    {
+      gdouble e = atan2 (y[i], x[i]);
+
+      g_assert_cmpfloat (test_ulp_err (r[i], e), <=, 3.5);
+      g_assert_cmpfloat (test_ulp_err (crank_fast_atan2f (y[i], x[i]), e),
+                         <=, 3.5);
+    }
+
+  g_assert_cmpfloat (crank_fast_atan2f (0.0f, 0.0f), ==, 0.0f);
+}
+
+static void
+test_enabled (void)
+{
+  g_assert (! crank_fast_math_get_enabled ());
+
+  crank_fast_math_set_enabled (TRUE);
+  g_assert (crank_fast_math_get_enabled ());
+
+  crank_fast_math_set_enabled (FALSE);
+  g_assert (! crank_fast_math_get_enabled ());
+}
+
+//////// Test Helpers //////////////////////////////////////////////////////////
+
+static gdouble
+test_ulp_err (const gfloat  r,
+              const gdouble e)
+{
+  gfloat ef = fabsf ((gfloat) e);
+  gfloat ulp = nextafterf (ef, INFINITY) - ef;
+
+  return ABS (r - e) / ulp;
+}
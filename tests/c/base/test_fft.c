@@ -0,0 +1,364 @@
+/* Copyright (C) 2015, WSID   */
+
+/* Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+#include <glib.h>
+
+#include <glib.h>
+#include <math.h>
+
+#include "crankbase.h"
+
+//////// Declaration ///////////////////////////////////////////////////////////
+
+static void test_plan_sizes (void);
+
+static void test_plan_cached (void);
+
+static void test_inverse (void);
+
+static void test_real (void);
+
+static void test_empty (void);
+
+static void test_fft2 (void);
+
+static void test_fft2_parallel (void);
+
+//////// Main //////////////////////////////////////////////////////////////////
+
+gint
+main (gint   argc,
+      gchar *argv[])
+{
+  g_test_init (&argc, &argv, NULL);
+
+  g_test_add_func ("/crank/base/fft/plan/sizes", test_plan_sizes);
+
+  g_test_add_func ("/crank/base/fft/plan/cached", test_plan_cached);
+
+  g_test_add_func ("/crank/base/fft/inverse", test_inverse);
+
+  g_test_add_func ("/crank/base/fft/real", test_real);
+
+  g_test_add_func ("/crank/base/fft/empty", test_empty);
+
+  g_test_add_func ("/crank/base/fft/fft2", test_fft2);
+
+  g_test_add_func ("/crank/base/fft/fft2/parallel", test_fft2_parallel);
+
+  g_test_run ();
+
+  return 0;
+}
+
+//////// Definition ////////////////////////////////////////////////////////////
+
+static void
+test_gen (CrankVecCplxFloatN *x,
+          const guint         n)
+{
+  guint i;
+  guint32 s = n * 7 + 1;
+
+  crank_vec_cplx_float_n_init_fill_uc (x, n, 0.0f, 0.0f);
+
+  for (i = 0; i < n; i++)
+    {
+      s = s * 1664525u + 1013904223u;
+      x->data[i].real = (gfloat)(s >> 8) / 16777216.0f - 0.5f;
+      s = s * 1664525u + 1013904223u;
+      x->data[i].imag = (gfloat)(s >> 8) / 16777216.0f - 0.5f;
+    }
+}
+
+// Compares with direct summation of definition, in double precision.
+static void
+test_check_dft (CrankVecCplxFloatN *x,
+                CrankVecCplxFloatN *r)
+{
+  guint n = x->n;
+  guint j;
+  guint k;
+
+  g_assert_cmpuint (r->n, ==, n);
+
+  for (k = 0; k < n; k++)
+    {
+      gdouble sr = 0;
+      gdouble si = 0;
+
+      for (j = 0; j < n; j++)
+        {
+          gdouble theta = -2 * G_PI * (gdouble)(((guint64) j * k) % n) / n;
+
+          sr += x->data[j].real * cos (theta) - x->data[j].imag * sin (theta);
+          si += x->data[j].real * sin (theta) + x->data[j].imag * cos (theta);
+        }
+
+      crank_assert_cmpfloat_d (r->data[k].real, ==, sr, 0.002f * sqrt (n));
+      crank_assert_cmpfloat_d (r->data[k].imag, ==, si, 0.002f * sqrt (n));
+    }
+}
+
+static void
+test_plan_sizes (void)
+{
+  guint sizes[] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 12, 16, 25, 30, 31, 37, 64,
+                   97, 100, 210, 256, 1000};
+  guint i;
+
+  for (i = 0; i < G_N_ELEMENTS (sizes); i++)
+    {
+      CrankFFTPlan *plan = crank_fft_plan_new (sizes[i]);
+      CrankVecCplxFloatN x;
+      CrankVecCplxFloatN r;
+
+      g_assert_cmpuint (crank_fft_plan_get_size (plan), ==, sizes[i]);
+
+      test_gen (&x, sizes[i]);
+      crank_fft_plan_forward (plan, &x, &r);
+      test_check_dft (&x, &r);
+
+      crank_vec_cplx_float_n_fini (&x);
+      crank_vec_cplx_float_n_fini (&r);
+      crank_fft_plan_unref (plan);
+    }
+}
+
+static void
+test_plan_cached (void)
+{
+  CrankFFTPlan *plan;
+  CrankFFTPlan *plan_b;
+  guint i;
+
+  plan = crank_fft_plan_get_cached (1024);
+  plan_b = crank_fft_plan_get_cached (1024);
+  g_assert (plan == plan_b);
+  crank_fft_plan_unref (plan_b);
+
+  // Push 1024 out of cache with other sizes.
+  for (i = 1; i <= 64; i++)
+    crank_fft_plan_unref (crank_fft_plan_get_cached (i));
+
+  plan_b = crank_fft_plan_get_cached (1024);
+  g_assert (plan != plan_b);
+  g_assert_cmpuint (crank_fft_plan_get_size (plan), ==, 1024);
+  crank_fft_plan_unref (plan_b);
+  crank_fft_plan_unref (plan);
+
+  crank_fft_plan_clear_cache ();
+}
+
+static void
+test_inverse (void)
+{
+  guint sizes[] = {1, 8, 15, 97, 1024, 1500};
+  guint i;
+  guint j;
+
+  for (i = 0; i < G_N_ELEMENTS (sizes); i++)
+    {
+      CrankVecCplxFloatN x;
+      CrankVecCplxFloatN f;
+      CrankVecCplxFloatN r;
+
+      test_gen (&x, sizes[i]);
+      crank_fft_vec_cplx_float_n (&x, &f);
+      crank_ifft_vec_cplx_float_n (&f, &r);
+
+      g_assert_cmpuint (r.n, ==, sizes[i]);
+
+      for (j = 0; j < sizes[i]; j++)
+        {
+          crank_assert_cmpfloat_d (r.data[j].real, ==, x.data[j].real, 0.0001f);
+          crank_assert_cmpfloat_d (r.data[j].imag, ==, x.data[j].imag, 0.0001f);
+        }
+
+      crank_vec_cplx_float_n_fini (&x);
+      crank_vec_cplx_float_n_fini (&f);
+      crank_vec_cplx_float_n_fini (&r);
+    }
+}
+
+static void
+test_real (void)
+{
+  guint sizes[] = {1, 2, 7, 16, 30, 97, 194};
+  guint i;
+  guint j;
+
+  for (i = 0; i < G_N_ELEMENTS (sizes); i++)
+    {
+      guint n = sizes[i];
+      CrankVecCplxFloatN x;
+      CrankVecCplxFloatN f;
+      CrankVecFloatN xr;
+      CrankVecCplxFloatN fr;
+      CrankVecFloatN r;
+
+      test_gen (&x, n);
+      crank_vec_float_n_init_fill (&xr, n, 0.0f);
+
+      for (j = 0; j < n; j++)
+        {
+          x.data[j].imag = 0;
+          xr.data[j] = x.data[j].real;
+        }
+
+      crank_fft_vec_cplx_float_n (&x, &f);
+      crank_rfft_vec_float_n (&xr, &fr);
+
+      g_assert_cmpuint (fr.n, ==, n / 2 + 1);
+
+      for (j = 0; j < fr.n; j++)
+        {
+          crank_assert_cmpfloat_d (fr.data[j].real, ==, f.data[j].real, 0.001f);
+          crank_assert_cmpfloat_d (fr.data[j].imag, ==, f.data[j].imag, 0.001f);
+        }
+
+      crank_irfft_vec_cplx_float_n (&fr, n, &r);
+
+      g_assert_cmpuint (r.n, ==, n);
+
+      for (j = 0; j < n; j++)
+        crank_assert_cmpfloat_d (r.data[j], ==, xr.data[j], 0.0001f);
+
+      crank_vec_cplx_float_n_fini (&x);
+      crank_vec_cplx_float_n_fini (&f);
+      crank_vec_float_n_fini (&xr);
+      crank_vec_cplx_float_n_fini (&fr);
+      crank_vec_float_n_fini (&r);
+    }
+}
+
+static void
+test_empty (void)
+{
+  CrankVecCplxFloatN x;
+  CrankVecCplxFloatN f;
+  CrankVecFloatN xr;
+  CrankVecFloatN r;
+
+  crank_vec_cplx_float_n_init_fill_uc (&x, 0, 0.0f, 0.0f);
+  crank_vec_float_n_init_fill (&xr, 0, 0.0f);
+
+  crank_fft_vec_cplx_float_n (&x, &f);
+  g_assert_cmpuint (f.n, ==, 0);
+  crank_vec_cplx_float_n_fini (&f);
+
+  crank_ifft_vec_cplx_float_n (&x, &f);
+  g_assert_cmpuint (f.n, ==, 0);
+  crank_vec_cplx_float_n_fini (&f);
+
+  crank_rfft_vec_float_n (&xr, &f);
+  g_assert_cmpuint (f.n, ==, 0);
+
+  crank_irfft_vec_cplx_float_n (&f, 0, &r);
+  g_assert_cmpuint (r.n, ==, 0);
+
+  crank_vec_cplx_float_n_fini (&x);
+  crank_vec_cplx_float_n_fini (&f);
+  crank_vec_float_n_fini (&xr);
+  crank_vec_float_n_fini (&r);
+}
+
+static void
+test_fft2 (void)
+{
+  CrankVecCplxFloatN x;
+  CrankMatCplxFloatN a;
+  CrankMatCplxFloatN f;
+  CrankMatCplxFloatN r;
+
+  guint rn = 6;
+  guint cn = 8;
+  guint i;
+  guint j;
+  guint k;
+  guint l;
+
+  test_gen (&x, rn * cn);
+  crank_mat_cplx_float_n_init_arr (&a, rn, cn, x.data);
+
+  crank_fft2_mat_cplx_float_n (&a, &f);
+
+  for (k = 0; k < rn; k++)
+    for (l = 0; l < cn; l++)
+      {
+        gdouble sr = 0;
+        gdouble si = 0;
+
+        for (i = 0; i < rn; i++)
+          for (j = 0; j < cn; j++)
+            {
+              gdouble theta = -2 * G_PI * ((gdouble)(i * k) / rn +
+                                           (gdouble)(j * l) / cn);
+              CrankCplxFloat *v = a.data + (i * cn) + j;
+
+              sr += v->real * cos (theta) - v->imag * sin (theta);
+              si += v->real * sin (theta) + v->imag * cos (theta);
+            }
+
+        crank_assert_cmpfloat_d (f.data[k * cn + l].real, ==, sr, 0.001f);
+        crank_assert_cmpfloat_d (f.data[k * cn + l].imag, ==, si, 0.001f);
+      }
+
+  crank_ifft2_mat_cplx_float_n (&f, &r);
+
+  for (i = 0; i < rn * cn; i++)
+    {
+      crank_assert_cmpfloat_d (r.data[i].real, ==, a.data[i].real, 0.0001f);
+      crank_assert_cmpfloat_d (r.data[i].imag, ==, a.data[i].imag, 0.0001f);
+    }
+
+  crank_vec_cplx_float_n_fini (&x);
+  crank_mat_cplx_float_n_fini (&a);
+  crank_mat_cplx_float_n_fini (&f);
+  crank_mat_cplx_float_n_fini (&r);
+}
+
+static void
+test_fft2_parallel (void)
+{
+  CrankVecCplxFloatN x;
+  CrankMatCplxFloatN a;
+  CrankMatCplxFloatN f;
+  CrankMatCplxFloatN fp;
+
+  guint i;
+
+  test_gen (&x, 96 * 200);
+  crank_mat_cplx_float_n_init_arr (&a, 96, 200, x.data);
+
+  crank_fft2_mat_cplx_float_n_parallel (&a, &f, 1);
+  crank_fft2_mat_cplx_float_n_parallel (&a, &fp, 4);
+
+  for (i = 0; i < 96 * 200; i++)
+    {
+      g_assert_cmpfloat (f.data[i].real, ==, fp.data[i].real);
+      g_assert_cmpfloat (f.data[i].imag, ==, fp.data[i].imag);
+    }
+
+  crank_vec_cplx_float_n_fini (&x);
+  crank_mat_cplx_float_n_fini (&a);
+  crank_mat_cplx_float_n_fini (&f);
+  crank_mat_cplx_float_n_fini (&fp);
+}
@@ -0,0 +1,232 @@
+/* Copyright (C) 2015, WSID   */
+
+/* Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <glib.h>
+
+#include "crankbase.h"
+
+//////// Declaration ///////////////////////////////////////////////////////////
+
+static void     test_push_pop (void);
+
+static void     test_update (void);
+
+static void     test_remove (void);
+
+static void     test_reserve (void);
+
+static void     test_random (void);
+
+//////// Main //////////////////////////////////////////////////////////////////
+
+gint
+main (gint    argc,
+      gchar **argv)
+{
+  g_test_init (&argc, &argv, NULL);
+
+  g_test_add_func ("/crank/base/index_heap/push_pop",
+                   test_push_pop);
+
+  g_test_add_func ("/crank/base/index_heap/update",
+                   test_update);
+
+  g_test_add_func ("/crank/base/index_heap/remove",
+                   test_remove);
+
+  g_test_add_func ("/crank/base/index_heap/reserve",
+                   test_reserve);
+
+  g_test_add_func ("/crank/base/index_heap/random",
+                   test_random);
+
+  g_test_run ();
+
+  return 0;
+}
+
+//////// Definition ////////////////////////////////////////////////////////////
+
+static void
+test_push_pop (void)
+{
+  CrankIndexHeap heap;
+  gfloat priority;
+
+  crank_index_heap_init (&heap, 8);
+
+  g_assert_true (crank_index_heap_is_empty (&heap));
+
+  crank_index_heap_push (&heap, 3, 4.0f);
+  crank_index_heap_push (&heap, 1, 2.0f);
+  crank_index_heap_push (&heap, 7, 3.0f);
+  crank_index_heap_push (&heap, 0, 5.0f);
+
+  g_assert_cmpuint (crank_index_heap_get_size (&heap), ==, 4);
+  g_assert_true (crank_index_heap_contains (&heap, 7));
+  g_assert_false (crank_index_heap_contains (&heap, 2));
+  g_assert_cmpfloat (crank_index_heap_get_priority (&heap, 3), ==, 4.0f);
+
+  g_assert_cmpuint (crank_index_heap_peek (&heap, &priority), ==, 1);
+  g_assert_cmpfloat (priority, ==, 2.0f);
+
+  g_assert_cmpuint (crank_index_heap_pop (&heap, &priority), ==, 1);
+  g_assert_cmpfloat (priority, ==, 2.0f);
+  g_assert_cmpuint (crank_index_heap_pop (&heap, &priority), ==, 7);
+  g_assert_cmpfloat (priority, ==, 3.0f);
+  g_assert_cmpuint (crank_index_heap_pop (&heap, &priority), ==, 3);
+  g_assert_cmpfloat (priority, ==, 4.0f);
+  g_assert_cmpuint (crank_index_heap_pop (&heap, &priority), ==, 0);
+  g_assert_cmpfloat (priority, ==, 5.0f);
+
+  g_assert_true (crank_index_heap_is_empty (&heap));
+  g_assert_false (crank_index_heap_contains (&heap, 1));
+  g_assert_cmpuint (crank_index_heap_pop (&heap, NULL), ==, G_MAXUINT);
+
+  crank_index_heap_fini (&heap);
+}
+
+static void
+test_update (void)
+{
+  CrankIndexHeap heap;
+  gfloat priority;
+
+  crank_index_heap_init (&heap, 4);
+
+  g_assert_true (crank_index_heap_update (&heap, 0, 6.0f));
+  g_assert_true (crank_index_heap_update (&heap, 1, 4.0f));
+  g_assert_true (crank_index_heap_update (&heap, 2, 5.0f));
+
+  g_assert_false (crank_index_heap_update (&heap, 1, 8.0f));
+  g_assert_cmpfloat (crank_index_heap_get_priority (&heap, 1), ==, 4.0f);
+
+  g_assert_true (crank_index_heap_update (&heap, 0, 1.0f));
+  crank_index_heap_decrease (&heap, 2, 3.0f);
+
+  g_assert_cmpuint (crank_index_heap_get_size (&heap), ==, 3);
+
+  g_assert_cmpuint (crank_index_heap_pop (&heap, &priority), ==, 0);
+  g_assert_cmpfloat (priority, ==, 1.0f);
+  g_assert_cmpuint (crank_index_heap_pop (&heap, &priority), ==, 2);
+  g_assert_cmpfloat (priority, ==, 3.0f);
+  g_assert_cmpuint (crank_index_heap_pop (&heap, &priority), ==, 1);
+  g_assert_cmpfloat (priority, ==, 4.0f);
+
+  crank_index_heap_fini (&heap);
+}
+
+static void
+test_remove (void)
+{
+  CrankIndexHeap heap;
+  guint i;
+
+  crank_index_heap_init (&heap, 8);
+
+  for (i = 0; i < 8; i++)
+    crank_index_heap_push (&heap, i, (gfloat)((i * 5) % 8));
+
+  crank_index_heap_remove (&heap, 0);
+  crank_index_heap_remove (&heap, 5);
+  crank_index_heap_remove (&heap, 5);
+
+  g_assert_cmpuint (crank_index_heap_get_size (&heap), ==, 6);
+  g_assert_false (crank_index_heap_contains (&heap, 5));
+
+  // Remaining priorities are 2, 3, 4, 5, 6, 7 for 2, 7, 4, 1, 6, 3
+  g_assert_cmpuint (crank_index_heap_pop (&heap, NULL), ==, 2);
+  g_assert_cmpuint (crank_index_heap_pop (&heap, NULL), ==, 7);
+  g_assert_cmpuint (crank_index_heap_pop (&heap, NULL), ==, 4);
+  g_assert_cmpuint (crank_index_heap_pop (&heap, NULL), ==, 1);
+
+  crank_index_heap_clear (&heap);
+
+  g_assert_true (crank_index_heap_is_empty (&heap));
+  g_assert_false (crank_index_heap_contains (&heap, 6));
+
+  crank_index_heap_push (&heap, 6, 0.0f);
+  g_assert_cmpuint (crank_index_heap_pop (&heap, NULL), ==, 6);
+
+  crank_index_heap_fini (&heap);
+}
+
+static void
+test_reserve (void)
+{
+  CrankIndexHeap heap;
+
+  crank_index_heap_init (&heap, 2);
+
+  crank_index_heap_push (&heap, 1, 3.0f);
+  crank_index_heap_reserve (&heap, 100);
+
+  g_assert_cmpuint (heap.capacity, >=, 100);
+  g_assert_true (crank_index_heap_contains (&heap, 1));
+  g_assert_false (crank_index_heap_contains (&heap, 99));
+
+  crank_index_heap_push (&heap, 99, 2.0f);
+
+  g_assert_cmpuint (crank_index_heap_pop (&heap, NULL), ==, 99);
+  g_assert_cmpuint (crank_index_heap_pop (&heap, NULL), ==, 1);
+
+  crank_index_heap_fini (&heap);
+}
+
+static void
+test_random (void)
+{
+  CrankIndexHeap heap;
+  gfloat prio[256];
+  gfloat last;
+  guint i;
+
+  crank_index_heap_init (&heap, 256);
+
+  for (i = 0; i < 256; i++)
+    {
+      prio[i] = g_test_rand_double_range (0, 100);
+      crank_index_heap_push (&heap, i, prio[i]);
+    }
+
+  for (i = 0; i < 512; i++)
+    {
+      guint index = g_test_rand_int_range (0, 256);
+
+      prio[index] -= g_test_rand_double_range (0, 10);
+      crank_index_heap_decrease (&heap, index, prio[index]);
+    }
+
+  last = - INFINITY;
+  for (i = 0; i < 256; i++)
+    {
+      gfloat priority;
+      guint index = crank_index_heap_pop (&heap, &priority);
+
+      g_assert_cmpfloat (last, <=, priority);
+      g_assert_cmpfloat (prio[index], ==, priority);
+      last = priority;
+    }
+
+  g_assert_true (crank_index_heap_is_empty (&heap));
+
+  crank_index_heap_fini (&heap);
+}
@@ -0,0 +1,204 @@
+/* Copyright (C) 2015, WSID   */
+
+/* Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+#include <glib.h>
+
+#include "crankbase.h"
+
+//////// Declaration ///////////////////////////////////////////////////////////
+
+static void test_alloc (void);
+
+static void test_rewind (void);
+
+static void test_grow (void);
+
+static void test_init_vec_mat (void);
+
+static void test_scratch (void);
+
+//////// Main //////////////////////////////////////////////////////////////////
+
+gint
+main (gint   argc,
+      gchar *argv[])
+{
+  g_test_init (&argc, &argv, NULL);
+
+  g_test_add_func ("/crank/base/mat/arena/alloc", test_alloc);
+
+  g_test_add_func ("/crank/base/mat/arena/rewind", test_rewind);
+
+  g_test_add_func ("/crank/base/mat/arena/grow", test_grow);
+
+  g_test_add_func ("/crank/base/mat/arena/init_vec_mat", test_init_vec_mat);
+
+  g_test_add_func ("/crank/base/mat/arena/scratch", test_scratch);
+
+  g_test_run ();
+
+  return 0;
+}
+
+//////// Definition ////////////////////////////////////////////////////////////
+
+static void
+test_alloc (void)
+{
+  CrankMatArena *arena = crank_mat_arena_new (1024);
+  guint8 *a;
+  guint8 *b;
+  guint i;
+
+  a = crank_mat_arena_alloc0 (arena, 10);
+  b = crank_mat_arena_alloc (arena, 100);
+
+  g_assert_cmpuint ((gsize) a % 64, ==, 0);
+  g_assert_cmpuint ((gsize) b % 64, ==, 0);
+  g_assert (a + 10 <= b);
+
+  for (i = 0; i < 10; i++)
+    g_assert_cmpuint (a[i], ==, 0);
+
+  g_assert (crank_mat_arena_alloc (arena, 0) == NULL);
+
+  crank_mat_arena_unref (arena);
+}
+
+static void
+test_rewind (void)
+{
+  CrankMatArena *arena = crank_mat_arena_new (1024);
+  gpointer a;
+  gpointer b;
+  gpointer c;
+  gsize mark;
+
+  a = crank_mat_arena_alloc (arena, 100);
+  mark = crank_mat_arena_get_mark (arena);
+
+  b = crank_mat_arena_alloc (arena, 100);
+  crank_mat_arena_rewind (arena, mark);
+
+  c = crank_mat_arena_alloc (arena, 100);
+
+  g_assert (a != b);
+  g_assert (b == c);
+
+  crank_mat_arena_reset (arena);
+  g_assert (crank_mat_arena_alloc (arena, 100) == a);
+
+  crank_mat_arena_unref (arena);
+}
+
+static void
+test_grow (void)
+{
+  CrankMatArena *arena = crank_mat_arena_new (256);
+  gpointer big;
+  gsize mark;
+  gsize cap;
+  guint i;
+
+  // Fills first block, and takes more blocks.
+  crank_mat_arena_alloc (arena, 200);
+  mark = crank_mat_arena_get_mark (arena);
+
+  big = crank_mat_arena_alloc (arena, 1000);
+  for (i = 0; i < 4; i++)
+    crank_mat_arena_alloc (arena, 200);
+
+  g_assert_cmpuint (crank_mat_arena_get_capacity (arena), >, 1000);
+
+  // Rewinding to mark in first block, gives same memory again.
+  crank_mat_arena_rewind (arena, mark);
+  g_assert (crank_mat_arena_alloc (arena, 1000) == big);
+
+  // Reset merges blocks, so that same usage fits in one block.
+  cap = crank_mat_arena_get_capacity (arena);
+  crank_mat_arena_reset (arena);
+  g_assert_cmpuint (crank_mat_arena_get_capacity (arena), ==, cap);
+
+  crank_mat_arena_alloc (arena, 200);
+  crank_mat_arena_alloc (arena, 1000);
+  for (i = 0; i < 4; i++)
+    crank_mat_arena_alloc (arena, 200);
+
+  g_assert_cmpuint (crank_mat_arena_get_capacity (arena), ==, cap);
+
+  crank_mat_arena_unref (arena);
+}
+
+static void
+test_init_vec_mat (void)
+{
+  CrankMatArena *arena = crank_mat_arena_new (0);
+  gfloat arr[4] = {1.0f, 2.0f, 3.0f, 4.0f};
+  CrankVecFloatN v;
+  CrankVecFloatN w;
+  CrankMatFloatN m;
+  CrankMatFloatN r;
+
+  crank_vec_float_n_init_arena (&v, arena, 3);
+  crank_assert_eq_vecfloat_n_imm (&v, 0.0f, 0.0f, 0.0f);
+
+  crank_vec_float_n_init_arr_arena (&w, arena, 2, arr);
+  crank_assert_eq_vecfloat_n_imm (&w, 1.0f, 2.0f);
+
+  crank_mat_float_n_init_arr_arena (&m, arena, 2, 2, arr);
+  crank_mat_float_n_init_arena (&r, arena, 2, 2);
+
+  g_assert_cmpuint (r.rn, ==, 2);
+  g_assert_cmpuint (r.cn, ==, 2);
+  crank_assert_cmpfloat (r.data[3], ==, 0.0f);
+
+  // Operations that keep size works on them.
+  crank_mat_float_n_muls_self (&m, 2.0f);
+  crank_assert_cmpfloat (m.data[0], ==, 2.0f);
+  crank_assert_cmpfloat (m.data[3], ==, 8.0f);
+
+  crank_mat_arena_unref (arena);
+}
+
+static void
+test_scratch (void)
+{
+  CrankMatArena *scratch = crank_mat_arena_get_scratch ();
+  CrankMatFloatN a;
+  CrankMatFloatN l;
+  CrankMatFloatN u;
+  gsize mark;
+
+  g_assert (scratch == crank_mat_arena_get_scratch ());
+
+  // Functions that use scratch arena, rewinds it after use.
+  mark = crank_mat_arena_get_mark (scratch);
+
+  crank_mat_float_n_init (&a, 2, 2,
+                          4.0f, 3.0f,
+                          6.0f, 3.0f);
+
+  g_assert (crank_lu_mat_float_n (&a, &l, &u));
+  g_assert_cmpuint (crank_mat_arena_get_mark (scratch), ==, mark);
+
+  crank_mat_float_n_fini (&a);
+  crank_mat_float_n_fini (&l);
+  crank_mat_float_n_fini (&u);
+}
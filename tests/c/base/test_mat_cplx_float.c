@@ -71,6 +71,12 @@ static void test_n_init_diag_ucarr (void);
 static void test_n_init_diag_ucv (void);
 static void test_n_init_fill_uc (void);
 
+static void test_split_conv (void);
+static void test_split_view (void);
+static void test_split_add (void);
+static void test_split_mulv (void);
+static void test_split_mul (void);
+
 //////// Main //////////////////////////////////////////////////////////////////
 
 gint
@@ -139,6 +145,12 @@ main (gint    argc,
   g_test_add_func ("/crank/base/mat/cplx/float/n/init/fill_uc",
                    test_n_init_fill_uc);
 
+  g_test_add_func ("/crank/base/mat/cplx/float/split/conv",   test_split_conv);
+  g_test_add_func ("/crank/base/mat/cplx/float/split/view",   test_split_view);
+  g_test_add_func ("/crank/base/mat/cplx/float/split/add",    test_split_add);
+  g_test_add_func ("/crank/base/mat/cplx/float/split/mulv",   test_split_mulv);
+  g_test_add_func ("/crank/base/mat/cplx/float/split/mul",    test_split_mul);
+
   g_test_run ();
   return 0;
 }
@@ -1155,3 +1167,254 @@ test_n_init_fill_uc (void)
 
   crank_mat_cplx_float_n_fini (&a);
 }
+
+
+// Fills a matrix with pseudo-random values in [-0.5, 0.5).
+static void
+test_split_gen (CrankMatCplxFloatN *a,
+                const guint         rn,
+                const guint         cn,
+                const guint32       seed)
+{
+  guint i;
+  guint32 s = seed;
+
+  crank_mat_cplx_float_n_init_fill_uc (a, rn, cn, 0.0f, 0.0f);
+
+  for (i = 0; i < rn * cn; i++)
+    {
+      s = s * 1664525u + 1013904223u;
+      a->data[i].real = (gfloat)(s >> 8) / 16777216.0f - 0.5f;
+      s = s * 1664525u + 1013904223u;
+      a->data[i].imag = (gfloat)(s >> 8) / 16777216.0f - 0.5f;
+    }
+}
+
+// Checks split matrix has same values with interleaved matrix.
+static void
+test_split_check (CrankMatSplitCplxFloat *a,
+                  CrankMatCplxFloatN     *b,
+                  const gfloat            d)
+{
+  guint i;
+  CrankCplxFloat v;
+
+  g_assert_cmpuint (a->rn, ==, b->rn);
+  g_assert_cmpuint (a->cn, ==, b->cn);
+
+  for (i = 0; i < b->rn * b->cn; i++)
+    {
+      crank_cplx_float_init (&v, a->real[i], a->imag[i]);
+      crank_assert_eqcplxfloat_d (&v, b->data + i, d);
+    }
+}
+
+static void
+test_split_conv (void)
+{
+  CrankMatCplxFloatN a;
+  CrankMatCplxFloatN b;
+  CrankMatSplitCplxFloat sa;
+  CrankMatSplitCplxFloat sb;
+  CrankCplxFloat v;
+
+  crank_mat_cplx_float_n_init_uc (&a, 2, 3,
+                                  1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f,
+                                  7.0f, 8.0f, 9.0f, 10.0f, 11.0f, 12.0f);
+
+  crank_mat_split_cplx_float_init_cplx (&sa, &a);
+
+  g_assert_cmpuint (crank_mat_split_cplx_float_get_row_size (&sa), ==, 2);
+  g_assert_cmpuint (crank_mat_split_cplx_float_get_col_size (&sa), ==, 3);
+  g_assert_cmpfloat (sa.real[4], ==, 9.0f);
+  g_assert_cmpfloat (sa.imag[4], ==, 10.0f);
+
+  crank_mat_split_cplx_float_get (&sa, 1, 2, &v);
+  crank_assert_eqcplxfloat_uc (&v, 11.0f, 12.0f);
+
+  crank_cplx_float_init (&v, -1.0f, -2.0f);
+  crank_mat_split_cplx_float_set (&sa, 0, 1, &v);
+
+  crank_mat_split_cplx_float_copy (&sa, &sb);
+  crank_mat_split_cplx_float_to_cplx (&sb, &b);
+
+  crank_assert_eqcplxfloat_uc (b.data + 0, 1.0f, 2.0f);
+  crank_assert_eqcplxfloat_uc (b.data + 1, -1.0f, -2.0f);
+  crank_assert_eqcplxfloat_uc (b.data + 2, 5.0f, 6.0f);
+  crank_assert_eqcplxfloat_uc (b.data + 3, 7.0f, 8.0f);
+  crank_assert_eqcplxfloat_uc (b.data + 4, 9.0f, 10.0f);
+  crank_assert_eqcplxfloat_uc (b.data + 5, 11.0f, 12.0f);
+
+  crank_mat_cplx_float_n_fini (&b);
+  crank_mat_split_cplx_float_fini (&sb);
+  crank_mat_split_cplx_float_fini (&sa);
+  crank_mat_cplx_float_n_fini (&a);
+}
+
+static void
+test_split_view (void)
+{
+  gfloat real[6] = {1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f};
+  gfloat imag[6] = {-1.0f, -2.0f, -3.0f, -4.0f, -5.0f, -6.0f};
+
+  CrankMatSplitCplxFloat a;
+  CrankVecSplitCplxFloat row;
+  CrankMatFloatN re;
+  CrankMatFloatN im;
+  CrankCplxFloat v;
+
+  crank_mat_split_cplx_float_init_view (&a, 2, 3, real, imag);
+
+  crank_mat_split_cplx_float_get_row_view (&a, 1, &row);
+  g_assert_cmpuint (row.n, ==, 3);
+  crank_vec_split_cplx_float_get (&row, 0, &v);
+  crank_assert_eqcplxfloat_uc (&v, 4.0f, -4.0f);
+
+  // Real operations on a view writes through to original arrays.
+  crank_mat_split_cplx_float_get_real_view (&a, &re);
+  crank_mat_split_cplx_float_get_imag_view (&a, &im);
+  crank_mat_float_n_muls_self (&re, 2.0f);
+
+  g_assert (im.data == imag);
+  g_assert_cmpfloat (real[5], ==, 12.0f);
+  g_assert_cmpfloat (row.real[2], ==, 12.0f);
+}
+
+static void
+test_split_add (void)
+{
+  CrankMatCplxFloatN a;
+  CrankMatCplxFloatN b;
+  CrankMatCplxFloatN r;
+  CrankMatSplitCplxFloat sa;
+  CrankMatSplitCplxFloat sb;
+  CrankMatSplitCplxFloat sr;
+
+  test_split_gen (&a, 7, 13, 1);
+  test_split_gen (&b, 7, 13, 2);
+
+  crank_mat_split_cplx_float_init_cplx (&sa, &a);
+  crank_mat_split_cplx_float_init_cplx (&sb, &b);
+
+  crank_mat_cplx_float_n_add (&a, &b, &r);
+  crank_mat_split_cplx_float_add (&sa, &sb, &sr);
+  test_split_check (&sr, &r, 0.0001f);
+  crank_mat_cplx_float_n_fini (&r);
+  crank_mat_split_cplx_float_fini (&sr);
+
+  crank_mat_cplx_float_n_sub (&a, &b, &r);
+  crank_mat_split_cplx_float_sub (&sa, &sb, &sr);
+  test_split_check (&sr, &r, 0.0001f);
+  crank_mat_cplx_float_n_fini (&r);
+  crank_mat_split_cplx_float_fini (&sr);
+
+  crank_mat_split_cplx_float_fini (&sb);
+  crank_mat_split_cplx_float_fini (&sa);
+  crank_mat_cplx_float_n_fini (&b);
+  crank_mat_cplx_float_n_fini (&a);
+}
+
+static void
+test_split_mulv (void)
+{
+  guint sizes[] = {1, 3, 8, 17, 40, 67};
+  guint i;
+
+  for (i = 0; i < G_N_ELEMENTS (sizes); i++)
+    {
+      guint n = sizes[i];
+      CrankMatCplxFloatN a;
+      CrankMatCplxFloatN bm;
+      CrankVecCplxFloatN b;
+      CrankVecCplxFloatN r;
+      CrankMatSplitCplxFloat sa;
+      CrankVecSplitCplxFloat sb;
+      CrankVecSplitCplxFloat sr;
+      CrankVecSplitCplxFloat sr2;
+      guint j;
+
+      test_split_gen (&a, n + 2, n, n);
+      test_split_gen (&bm, 1, n, n + 100);
+      crank_vec_cplx_float_n_init_arr (&b, n, bm.data);
+
+      crank_mat_split_cplx_float_init_cplx (&sa, &a);
+      crank_vec_split_cplx_float_init_cplx (&sb, &b);
+
+      crank_mat_cplx_float_n_mulv (&a, &b, &r);
+      crank_mat_split_cplx_float_mulv (&sa, &sb, &sr);
+
+      g_assert_cmpuint (sr.n, ==, n + 2);
+      for (j = 0; j < n + 2; j++)
+        {
+          CrankCplxFloat v;
+
+          crank_vec_split_cplx_float_get (&sr, j, &v);
+          crank_assert_eqcplxfloat_d (&v, r.data + j, 0.0005f);
+        }
+
+      // Parity with component operations on rows.
+      for (j = 0; j < n + 2; j++)
+        {
+          CrankVecSplitCplxFloat row;
+          CrankCplxFloat v;
+          CrankCplxFloat w;
+
+          crank_mat_split_cplx_float_get_row_view (&sa, j, &row);
+          crank_vec_split_cplx_float_cmpmul (&row, &sb, &sr2);
+          crank_vec_split_cplx_float_get (&sr2, 0, &v);
+          crank_cplx_float_mul (a.data + (j * n), b.data, &w);
+          crank_assert_eqcplxfloat_d (&v, &w, 0.0001f);
+          crank_vec_split_cplx_float_fini (&sr2);
+        }
+
+      crank_vec_split_cplx_float_fini (&sr);
+      crank_vec_split_cplx_float_fini (&sb);
+      crank_mat_split_cplx_float_fini (&sa);
+      crank_vec_cplx_float_n_fini (&r);
+      crank_vec_cplx_float_n_fini (&b);
+      crank_mat_cplx_float_n_fini (&bm);
+      crank_mat_cplx_float_n_fini (&a);
+    }
+}
+
+static void
+test_split_mul (void)
+{
+  // Last ones are large enough to use blocked kernel.
+  guint sizes[][3] = {
+    {2, 2, 2},
+    {3, 5, 4},
+    {9, 1, 17},
+    {40, 50, 45},
+    {67, 33, 70}
+  };
+  guint i;
+
+  for (i = 0; i < G_N_ELEMENTS (sizes); i++)
+    {
+      CrankMatCplxFloatN a;
+      CrankMatCplxFloatN b;
+      CrankMatCplxFloatN r;
+      CrankMatSplitCplxFloat sa;
+      CrankMatSplitCplxFloat sb;
+      CrankMatSplitCplxFloat sr;
+
+      test_split_gen (&a, sizes[i][0], sizes[i][1], 3 * i + 1);
+      test_split_gen (&b, sizes[i][1], sizes[i][2], 3 * i + 2);
+
+      crank_mat_split_cplx_float_init_cplx (&sa, &a);
+      crank_mat_split_cplx_float_init_cplx (&sb, &b);
+
+      crank_mat_cplx_float_n_mul (&a, &b, &r);
+      crank_mat_split_cplx_float_mul (&sa, &sb, &sr);
+
+      test_split_check (&sr, &r, 0.0005f);
+
+      crank_mat_split_cplx_float_fini (&sr);
+      crank_mat_split_cplx_float_fini (&sb);
+      crank_mat_split_cplx_float_fini (&sa);
+      crank_mat_cplx_float_n_fini (&r);
+      crank_mat_cplx_float_n_fini (&b);
+      crank_mat_cplx_float_n_fini (&a);
+    }
+}
@@ -0,0 +1,1904 @@
+/* Copyright (C) 2015, WSID   */
+
+/* Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <glib.h>
+#include "crankbase.h"
+
+//////// Declaration ///////////////////////////////////////////////////////////
+
+static void test_assert_float_real (const gchar *file,
+                                    const guint  line,
+                                    const gchar *func,
+                                    const gchar *a_str,
+                                    const gchar *b_str,
+                                    gdouble      a,
+                                    gdouble      b);
+
+static void test_2_equal (void);
+static void test_2_to_string (void);
+
+static void test_2_get (void);
+static void test_2_get_row (void);
+static void test_2_get_col (void);
+
+static void test_2_tr (void);
+static void test_2_det (void);
+static void test_2_cof (void);
+static void test_2_adj (void);
+
+static void test_2_neg (void);
+static void test_2_transpose (void);
+static void test_2_inverse (void);
+
+static void test_2_muls (void);
+static void test_2_divs (void);
+static void test_2_mulv (void);
+static void test_2_add (void);
+static void test_2_sub (void);
+static void test_2_mul (void);
+static void test_2_mixs (void);
+static void test_2_mix (void);
+
+static void test_3_init_rot (void);
+static void test_3_get_rot (void);
+
+static void test_4_batch_mulv (void);
+static void test_4_batch_mul (void);
+static void test_4_batch_transform (void);
+static void test_4_soa_transform (void);
+
+
+static void test_n_equal (void);
+static void test_n_to_string (void);
+
+static void test_n_get (void);
+static void test_n_get_row (void);
+static void test_n_get_col (void);
+static void test_n_slice (void);
+
+static void test_n_tr (void);
+static void test_n_det (void);
+static void test_n_cof (void);
+static void test_n_adj (void);
+static void test_n_diag (void);
+
+static void test_n_neg (void);
+static void test_n_transpose (void);
+static void test_n_inverse (void);
+static void test_n_solve (void);
+static void test_n_solve_multi (void);
+
+static void test_n_muls (void);
+static void test_n_divs (void);
+static void test_n_mulv (void);
+static void test_n_add (void);
+static void test_n_sub (void);
+static void test_n_mul (void);
+static void test_n_mul_large (void);
+static void test_n_mul_parallel (void);
+static void test_n_inverse_parallel (void);
+static void test_n_transpose_self (void);
+static void test_n_inverse_self (void);
+static void test_n_mul_self (void);
+static void test_n_mixs (void);
+static void test_n_mix (void);
+
+static void test_n_shuffle_row (void);
+static void test_n_shuffle_col (void);
+
+static void test_n_init_row (void);
+static void test_n_init_row_arr (void);
+static void test_n_init_row_parr (void);
+static void test_n_init_col (void);
+static void test_n_init_col_arr (void);
+static void test_n_init_col_parr (void);
+
+static void test_n_upper_tri_inverse (void);
+static void test_n_lower_tri_inverse (void);
+static void test_n_diag_inverse (void);
+
+
+//////// Main //////////////////////////////////////////////////////////////////
+
+gint
+main (gint    argc,
+      gchar **argv)
+{
+  g_test_init (&argc, &argv, NULL);
+
+  g_test_add_func ("/crank/base/mat/double/2/equal",       test_2_equal);
+  g_test_add_func ("/crank/base/mat/double/2/to_string",   test_2_to_string);
+  g_test_add_func ("/crank/base/mat/double/2/get",         test_2_get);
+  g_test_add_func ("/crank/base/mat/double/2/get_row",     test_2_get_row);
+  g_test_add_func ("/crank/base/mat/double/2/get_col",     test_2_get_col);
+  g_test_add_func ("/crank/base/mat/double/2/tr",          test_2_tr);
+  g_test_add_func ("/crank/base/mat/double/2/det",         test_2_det);
+  g_test_add_func ("/crank/base/mat/double/2/cof",         test_2_cof);
+  g_test_add_func ("/crank/base/mat/double/2/adj",         test_2_adj);
+  g_test_add_func ("/crank/base/mat/double/2/neg",         test_2_neg);
+  g_test_add_func ("/crank/base/mat/double/2/transpose",   test_2_transpose);
+  g_test_add_func ("/crank/base/mat/double/2/inverse",     test_2_inverse);
+  g_test_add_func ("/crank/base/mat/double/2/muls",        test_2_muls);
+  g_test_add_func ("/crank/base/mat/double/2/divs",        test_2_divs);
+  g_test_add_func ("/crank/base/mat/double/2/mulv",        test_2_mulv);
+  g_test_add_func ("/crank/base/mat/double/2/add",         test_2_add);
+  g_test_add_func ("/crank/base/mat/double/2/sub",         test_2_sub);
+  g_test_add_func ("/crank/base/mat/double/2/mul",         test_2_mul);
+  g_test_add_func ("/crank/base/mat/double/2/mixs",        test_2_mixs);
+  g_test_add_func ("/crank/base/mat/double/2/mix",         test_2_mix);
+
+  g_test_add_func ("/crank/base/mat/double/3/rot/init",    test_3_init_rot);
+  g_test_add_func ("/crank/base/mat/double/3/rot/get",     test_3_get_rot);
+
+  g_test_add_func ("/crank/base/mat/double/4/batch/mulv",  test_4_batch_mulv);
+  g_test_add_func ("/crank/base/mat/double/4/batch/mul",   test_4_batch_mul);
+  g_test_add_func ("/crank/base/mat/double/4/batch/transform",
+                   test_4_batch_transform);
+  g_test_add_func ("/crank/base/mat/double/4/soa/transform",
+                   test_4_soa_transform);
+
+  g_test_add_func ("/crank/base/mat/double/n/equal",       test_n_equal);
+  g_test_add_func ("/crank/base/mat/double/n/to_string",   test_n_to_string);
+  g_test_add_func ("/crank/base/mat/double/n/get",         test_n_get);
+  g_test_add_func ("/crank/base/mat/double/n/get_row",     test_n_get_row);
+  g_test_add_func ("/crank/base/mat/double/n/get_col",     test_n_get_col);
+  g_test_add_func ("/crank/base/mat/double/n/slice",       test_n_slice);
+  g_test_add_func ("/crank/base/mat/double/n/tr",          test_n_tr);
+  g_test_add_func ("/crank/base/mat/double/n/det",         test_n_det);
+  g_test_add_func ("/crank/base/mat/double/n/cof",         test_n_cof);
+  g_test_add_func ("/crank/base/mat/double/n/adj",         test_n_adj);
+  g_test_add_func ("/crank/base/mat/double/n/neg",         test_n_neg);
+  g_test_add_func ("/crank/base/mat/double/n/diag",        test_n_diag);
+  g_test_add_func ("/crank/base/mat/double/n/transpose",   test_n_transpose);
+  g_test_add_func ("/crank/base/mat/double/n/inverse",     test_n_inverse);
+  g_test_add_func ("/crank/base/mat/double/n/solve",       test_n_solve);
+  g_test_add_func ("/crank/base/mat/double/n/solve/multi", test_n_solve_multi);
+  g_test_add_func ("/crank/base/mat/double/n/muls",        test_n_muls);
+  g_test_add_func ("/crank/base/mat/double/n/divs",        test_n_divs);
+  g_test_add_func ("/crank/base/mat/double/n/mulv",        test_n_mulv);
+  g_test_add_func ("/crank/base/mat/double/n/add",         test_n_add);
+  g_test_add_func ("/crank/base/mat/double/n/sub",         test_n_sub);
+  g_test_add_func ("/crank/base/mat/double/n/mul",         test_n_mul);
+  g_test_add_func ("/crank/base/mat/double/n/mul/large",   test_n_mul_large);
+  g_test_add_func ("/crank/base/mat/double/n/mul/parallel",
+                   test_n_mul_parallel);
+  g_test_add_func ("/crank/base/mat/double/n/inverse/parallel",
+                   test_n_inverse_parallel);
+  g_test_add_func ("/crank/base/mat/double/n/transpose/self",
+                   test_n_transpose_self);
+  g_test_add_func ("/crank/base/mat/double/n/inverse/self",
+                   test_n_inverse_self);
+  g_test_add_func ("/crank/base/mat/double/n/mul/self",    test_n_mul_self);
+  g_test_add_func ("/crank/base/mat/double/n/mixs",        test_n_mixs);
+  g_test_add_func ("/crank/base/mat/double/n/mix",         test_n_mix);
+
+  g_test_add_func ("/crank/base/mat/double/n/shuffle/row", test_n_shuffle_row);
+  g_test_add_func ("/crank/base/mat/double/n/shuffle/col", test_n_shuffle_col);
+
+  g_test_add_func ("/crank/base/mat/double/n/init/row",        test_n_init_row);
+  g_test_add_func ("/crank/base/mat/double/n/init/row/arr",
+                   test_n_init_row_arr);
+  g_test_add_func ("/crank/base/mat/double/n/init/row/parr",
+                   test_n_init_row_parr);
+  g_test_add_func ("/crank/base/mat/double/n/init/col",        test_n_init_col);
+  g_test_add_func ("/crank/base/mat/double/n/init/col/arr",
+                   test_n_init_col_arr);
+  g_test_add_func ("/crank/base/mat/double/n/init/col/parr",
+                   test_n_init_col_parr);
+
+  g_test_add_func ("/crank/base/mat/double/n/supple/inverse/upper",
+                   test_n_upper_tri_inverse);
+  g_test_add_func ("/crank/base/mat/double/n/supple/inverse/lower",
+                   test_n_lower_tri_inverse);
+  g_test_add_func ("/crank/base/mat/double/n/supple/inverse/diag",
+                   test_n_diag_inverse);
+
+  g_test_run ();
+  return 0;
+}
+
+
+//////// Definition ////////////////////////////////////////////////////////////
+
+static void
+test_assert_float_real (const gchar *file,
+                        const guint  line,
+                        const gchar *func,
+                        const gchar *a_str,
+                        const gchar *b_str,
+                        gdouble      a,
+                        gdouble      b)
+{
+  if ((a < b - 0.0001) || (b + 0.0001 < a))
+    {
+      g_error (
+        "%s:%u:%s: assertion failed: (%s == %s): (%g == %g)"
+        " (with diff of %g)",
+        file, line, func,
+        a_str, b_str,
+        a, b, b - a);
+    }
+}
+
+#define test_assert_float(a, b) \
+  test_assert_float_real( \
+    __FILE__, \
+    __LINE__, \
+    G_STRFUNC, \
+    G_STRINGIFY(a), \
+    G_STRINGIFY(b), \
+    a, \
+    b)
+
+
+static void
+test_2_equal (void)
+{
+  CrankMatDouble2 a = {1.0, 2.0,     3.0, 4.0};
+  CrankMatDouble2 b = {1.0, 2.0,     3.0, 4.0};
+  CrankMatDouble2 c = {0.0, 0.0,     0.0, 0.0};
+
+  g_assert (crank_mat_double2_equal (&a, &b));
+  g_assert (!crank_mat_double2_equal (&a, &c));
+}
+
+static void
+test_2_to_string (void)
+{
+  CrankMatDouble2 a = {1.0, 2.0, 3.0, 4.0};
+  gchar *astr = crank_mat_double2_to_string (&a);
+
+  g_assert_cmpstr (astr, ==, "[[1, 2], [3, 4]]");
+
+  g_free (astr);
+}
+
+
+static void
+test_2_get (void)
+{
+  CrankMatDouble2 a = {1.0, 2.0,     3.0, 4.0 };
+
+  test_assert_float (crank_mat_double2_get (&a, 0, 0), 1.0);
+  test_assert_float (crank_mat_double2_get (&a, 0, 1), 2.0);
+  test_assert_float (crank_mat_double2_get (&a, 1, 0), 3.0);
+  test_assert_float (crank_mat_double2_get (&a, 1, 1), 4.0);
+}
+
+static void
+test_2_get_row (void)
+{
+  CrankMatDouble2 a = {1.0, 2.0,     3.0, 4.0};
+  CrankVecDouble2 rv;
+
+  crank_mat_double2_get_row (&a, 0, &rv);
+
+  test_assert_float (rv.x, 1.0);
+  test_assert_float (rv.y, 2.0);
+
+  crank_mat_double2_get_row (&a, 1, &rv);
+
+  test_assert_float (rv.x, 3.0);
+  test_assert_float (rv.y, 4.0);
+}
+
+static void
+test_2_get_col (void)
+{
+  CrankMatDouble2 a = {1.0, 2.0,     3.0, 4.0};
+  CrankVecDouble2 cv;
+
+  crank_mat_double2_get_col (&a, 0, &cv);
+
+  test_assert_float (cv.x, 1.0);
+  test_assert_float (cv.y, 3.0);
+
+  crank_mat_double2_get_col (&a, 1, &cv);
+
+  test_assert_float (cv.x, 2.0);
+  test_assert_float (cv.y, 4.0);
+}
+
+static void
+test_2_tr (void)
+{
+  CrankMatDouble2 a = {1.0, 2.0,     3.0, 4.0};
+
+  test_assert_float (crank_mat_double2_get_tr (&a), 5.0);
+}
+
+static void
+test_2_det (void)
+{
+  CrankMatDouble2 a = {1.0, 2.0,     3.0, 4.0};
+
+  test_assert_float (crank_mat_double2_get_det (&a), -2.0);
+}
+
+static void
+test_2_cof (void)
+{
+  CrankMatDouble2 a = {1.0, 2.0,     3.0, 4.0};
+  CrankMatDouble2 cof;
+
+  crank_mat_double2_get_cof (&a, &cof);
+
+  test_assert_float (cof.m00,  4.0);
+  test_assert_float (cof.m01, -3.0);
+  test_assert_float (cof.m10, -2.0);
+  test_assert_float (cof.m11,  1.0);
+}
+
+static void
+test_2_adj (void)
+{
+  CrankMatDouble2 a = {1.0, 2.0,     3.0, 4.0};
+  CrankMatDouble2 adj;
+
+  crank_mat_double2_get_adj (&a, &adj);
+
+  test_assert_float (adj.m00,  4.0);
+  test_assert_float (adj.m01, -2.0);
+  test_assert_float (adj.m10, -3.0);
+  test_assert_float (adj.m11,  1.0);
+}
+
+static void
+test_2_neg (void)
+{
+  CrankMatDouble2 a = {1.0, 2.0,     3.0, 4.0};
+  CrankMatDouble2 r;
+
+  crank_mat_double2_neg (&a, &r);
+
+  test_assert_float (r.m00, -1.0);
+  test_assert_float (r.m01, -2.0);
+  test_assert_float (r.m10, -3.0);
+  test_assert_float (r.m11, -4.0);
+}
+
+static void
+test_2_transpose (void)
+{
+  CrankMatDouble2 a = {1.0, 2.0,     3.0, 4.0};
+  CrankMatDouble2 r;
+
+  crank_mat_double2_transpose (&a, &r);
+
+  test_assert_float (r.m00, 1.0);
+  test_assert_float (r.m01, 3.0);
+  test_assert_float (r.m10, 2.0);
+  test_assert_float (r.m11, 4.0);
+}
+
+static void
+test_2_inverse (void)
+{
+  CrankMatDouble2 a = {1.0, 2.0,     3.0, 4.0};
+  CrankMatDouble2 r;
+
+  crank_mat_double2_inverse (&a, &r);
+
+  test_assert_float (r.m00, -2.0);
+  test_assert_float (r.m01,  1.0);
+  test_assert_float (r.m10,  1.5);
+  test_assert_float (r.m11, -0.5);
+}
+
+
+static void
+test_2_muls (void)
+{
+  CrankMatDouble2 a = {1.0, 2.0,     3.0, 4.0};
+  CrankMatDouble2 r;
+
+  crank_mat_double2_muls (&a, 2.0, &r);
+
+  test_assert_float (r.m00, 2.0);
+  test_assert_float (r.m01, 4.0);
+  test_assert_float (r.m10, 6.0);
+  test_assert_float (r.m11, 8.0);
+}
+
+static void
+test_2_divs (void)
+{
+  CrankMatDouble2 a = {1.0, 2.0,     3.0, 4.0};
+  CrankMatDouble2 r;
+
+  crank_mat_double2_divs (&a, 2.0, &r);
+
+  test_assert_float (r.m00, 0.5);
+  test_assert_float (r.m01, 1.0);
+  test_assert_float (r.m10, 1.5);
+  test_assert_float (r.m11, 2.0);
+}
+
+static void
+test_2_mulv (void)
+{
+  CrankMatDouble2 a = {1.0, 2.0,     3.0, 4.0};
+  CrankVecDouble2 b = {3.0, 4.0};
+  CrankVecDouble2 r;
+
+  crank_mat_double2_mulv (&a, &b, &r);
+
+  test_assert_float (r.x, 11.0);
+  test_assert_float (r.y, 25.0);
+}
+
+static void
+test_2_add (void)
+{
+  CrankMatDouble2 a = {1.0, 2.0,    3.0, 4.0};
+  CrankMatDouble2 b = {2.0, 3.0,    5.0, 7.0};
+  CrankMatDouble2 r;
+
+  crank_mat_double2_add (&a, &b, &r);
+
+  test_assert_float (r.m00, 3.0);
+  test_assert_float (r.m01, 5.0);
+  test_assert_float (r.m10, 8.0);
+  test_assert_float (r.m11, 11.0);
+}
+
+static void
+test_2_sub (void)
+{
+  CrankMatDouble2 a = {1.0, 2.0,    3.0, 4.0};
+  CrankMatDouble2 b = {2.0, 3.0,    5.0, 7.0};
+  CrankMatDouble2 r;
+
+  crank_mat_double2_sub (&a, &b, &r);
+
+  test_assert_float (r.m00, -1.0);
+  test_assert_float (r.m01, -1.0);
+  test_assert_float (r.m10, -2.0);
+  test_assert_float (r.m11, -3.0);
+}
+
+
+static void
+test_2_mul (void)
+{
+  CrankMatDouble2 a = {1.0, 2.0,     3.0, 4.0};
+  CrankMatDouble2 b = {3.0, 6.0,     9.0, 12.0};
+  CrankMatDouble2 r;
+
+  crank_mat_double2_mul (&a, &b, &r);
+
+  test_assert_float (r.m00, 21.0);
+  test_assert_float (r.m01, 30.0);
+  test_assert_float (r.m10, 45.0);
+  test_assert_float (r.m11, 66.0);
+}
+
+static void
+test_2_mixs (void)
+{
+  CrankMatDouble2 a = {1.0, 2.0,     3.0, 4.0};
+  CrankMatDouble2 b = {3.0, 6.0,     9.0, 12.0};
+  CrankMatDouble2 r;
+
+  crank_mat_double2_mixs (&a, &b, 0.5, &r);
+
+  test_assert_float (r.m00, 2.0);
+  test_assert_float (r.m01, 4.0);
+  test_assert_float (r.m10, 6.0);
+  test_assert_float (r.m11, 8.0);
+}
+
+static void
+test_2_mix (void)
+{
+  CrankMatDouble2 a = {1.0, 2.0,     3.0, 4.0};
+  CrankMatDouble2 b = {3.0, 6.0,     9.0, 12.0};
+  CrankMatDouble2 c = {0.0, 0.25,    0.5, 0.75};
+  CrankMatDouble2 r;
+
+  crank_mat_double2_mix (&a, &b, &c, &r);
+
+  test_assert_float (r.m00, 1.0);
+  test_assert_float (r.m01, 3.0);
+  test_assert_float (r.m10, 6.0);
+  test_assert_float (r.m11, 10.0);
+}
+
+
+static void
+test_3_init_rot (void)
+{
+  CrankMatDouble3 m;
+
+  crank_mat_double3_init_urot (&m, G_PI_4, 0.5774, 0.5774, 0.5774);
+
+  crank_assert_cmpfloat (m.m00, ==,  0.8048);
+  crank_assert_cmpfloat (m.m01, ==, -0.3106);
+  crank_assert_cmpfloat (m.m02, ==,  0.5058);
+
+  crank_assert_cmpfloat (m.m10, ==,  0.5058);
+  crank_assert_cmpfloat (m.m11, ==,  0.8048);
+  crank_assert_cmpfloat (m.m12, ==, -0.3106);
+
+  crank_assert_cmpfloat (m.m20, ==, -0.3106);
+  crank_assert_cmpfloat (m.m21, ==,  0.5058);
+  crank_assert_cmpfloat (m.m22, ==,  0.8048);
+}
+
+static void
+test_3_get_rot (void)
+{
+  CrankMatDouble3 m;
+  CrankVecDouble3 axis;
+
+  crank_mat_double3_init (&m,
+                          0.8048, -0.3106,  0.5058,
+                          0.5058,  0.8048, -0.3106,
+                          -0.3106,  0.5058,  0.8048);
+
+  crank_assert_cmpfloat_d (crank_mat_double3_get_rangle (&m), ==, G_PI_4, 0.0002);
+
+  crank_mat_double3_get_raxis (&m, &axis);
+  crank_assert_cmpfloat (axis.x, ==,  0.5774);
+  crank_assert_cmpfloat (axis.y, ==,  0.5774);
+  crank_assert_cmpfloat (axis.z, ==,  0.5774);
+}
+
+
+static void
+test_4_batch_mulv (void)
+{
+  CrankMatDouble4 a;
+  CrankVecDouble4 b[13];
+  CrankVecDouble4 r[13];
+  guint i;
+
+  crank_mat_double4_init (&a,
+                          1.0,  2.0,  3.0,  4.0,
+                          5.0,  6.0,  7.0,  8.0,
+                          9.0,  10.0, 11.0, 12.0,
+                          13.0, 14.0, 15.0, 16.0);
+
+  for (i = 0; i < 13; i++)
+    crank_vec_double4_init (b + i, i, 1.0 - i, 0.5 * i, 2.0);
+
+  crank_mat_double4_batch_mulv (13, &a, b, r);
+
+  for (i = 0; i < 13; i++)
+    {
+      CrankVecDouble4 e;
+
+      crank_mat_double4_mulv (&a, b + i, &e);
+      crank_assert_eq_vecdouble4_imm (r + i, e.x, e.y, e.z, e.w);
+    }
+
+  // In-place.
+  crank_mat_double4_batch_mulv (13, &a, b, b);
+
+  for (i = 0; i < 13; i++)
+    crank_assert_eq_vecdouble4_imm (b + i, r[i].x, r[i].y, r[i].z, r[i].w);
+}
+
+static void
+test_4_batch_mul (void)
+{
+  CrankMatDouble4 a[5];
+  CrankMatDouble4 b[5];
+  CrankMatDouble4 r[5];
+  guint i;
+
+  for (i = 0; i < 5; i++)
+    {
+      crank_mat_double4_init (a + i,
+                              1.0,  2.0,  3.0,  4.0 * i,
+                              5.0,  6.0 * i,  7.0,  8.0,
+                              9.0,  10.0, 11.0 + i, 12.0,
+                              13.0, 14.0, 15.0, 16.0);
+
+      crank_mat_double4_init (b + i,
+                              2.0,  0.0,  1.0,  0.0,
+                              0.0,  1.0 - i,  0.0,  3.0,
+                              i,  0.0, 1.0, 0.0,
+                              1.0, 0.0, 0.5 * i, 1.0);
+    }
+
+  crank_mat_double4_batch_mul (5, a, b, r);
+
+  for (i = 0; i < 5; i++)
+    {
+      CrankMatDouble4 e;
+
+      crank_mat_double4_mul (a + i, b + i, &e);
+      g_assert (crank_mat_double4_equal (r + i, &e));
+    }
+
+  // In-place.
+  crank_mat_double4_batch_mul (5, a, b, a);
+
+  for (i = 0; i < 5; i++)
+    g_assert (crank_mat_double4_equal (a + i, r + i));
+}
+
+static void
+test_4_batch_transform (void)
+{
+  CrankMatDouble4 a;
+  CrankVecDouble3 b[37];
+  CrankVecDouble3 r[37];
+  guint i;
+
+  crank_mat_double4_init (&a,
+                          0.0, -1.0, 0.0, 3.0,
+                          1.0,  0.0, 0.0, 4.0,
+                          0.0,  0.0, 2.0, 5.0,
+                          0.0,  0.0, 0.0, 1.0);
+
+  for (i = 0; i < 37; i++)
+    crank_vec_double3_init (b + i, i, 1.0 - i, 0.5 * i);
+
+  crank_mat_double4_batch_transform (37, &a, b, r);
+
+  for (i = 0; i < 37; i++)
+    crank_assert_eq_vecdouble3_imm (r + i,
+                                    3.0 - b[i].y,
+                                    4.0 + b[i].x,
+                                    5.0 + 2.0 * b[i].z);
+}
+
+static void
+test_4_soa_transform (void)
+{
+  CrankMatDouble4 a;
+  gdouble x[37];
+  gdouble y[37];
+  gdouble z[37];
+  gdouble rx[37];
+  gdouble ry[37];
+  gdouble rz[37];
+  guint i;
+
+  crank_mat_double4_init (&a,
+                          0.0, -1.0, 0.0, 3.0,
+                          1.0,  0.0, 0.0, 4.0,
+                          0.0,  0.0, 2.0, 5.0,
+                          0.0,  0.0, 0.0, 1.0);
+
+  // Count is not multiple of width of vector, so that remainings are checked.
+  for (i = 0; i < 37; i++)
+    {
+      x[i] = i;
+      y[i] = 1.0 - i;
+      z[i] = 0.5 * i;
+    }
+
+  crank_mat_double4_soa_transform (37, &a, x, y, z, rx, ry, rz);
+
+  for (i = 0; i < 37; i++)
+    {
+      crank_assert_cmpfloat (rx[i], ==, 3.0 - y[i]);
+      crank_assert_cmpfloat (ry[i], ==, 4.0 + x[i]);
+      crank_assert_cmpfloat (rz[i], ==, 5.0 + 2.0 * z[i]);
+    }
+
+  // In-place.
+  crank_mat_double4_soa_transform (37, &a, x, y, z, x, y, z);
+
+  for (i = 0; i < 37; i++)
+    {
+      crank_assert_cmpfloat (x[i], ==, rx[i]);
+      crank_assert_cmpfloat (y[i], ==, ry[i]);
+      crank_assert_cmpfloat (z[i], ==, rz[i]);
+    }
+}
+
+
+
+static void
+test_n_equal (void)
+{
+  CrankMatDoubleN a = {0};
+  CrankMatDoubleN b = {0};
+  CrankMatDoubleN c = {0};
+
+  crank_mat_double_n_init (&a, 2, 3,
+                           1.0, 2.0, 3.0,
+                           4.0, 5.0, 6.0);
+
+  crank_mat_double_n_init (&b, 2, 3,
+                           1.0, 2.0, 3.0,
+                           4.0, 5.0, 6.0);
+
+  crank_mat_double_n_init (&c, 3, 2,
+                           1.0, 2.0,
+                           3.0, 4.0,
+                           5.0, 6.0);
+
+  g_assert (crank_mat_double_n_equal (&a, &b));
+  g_assert (!crank_mat_double_n_equal (&a, &c));
+
+  crank_mat_double_n_fini (&a);
+  crank_mat_double_n_fini (&b);
+  crank_mat_double_n_fini (&c);
+}
+
+static void
+test_n_to_string (void)
+{
+  CrankMatDoubleN a = {0};
+  gchar *astr;
+
+  crank_mat_double_n_init (&a, 2, 3,
+                           1.0, 2.0, 3.0,
+                           4.0, 5.0, 6.0);
+
+  astr = crank_mat_double_n_to_string (&a);
+
+  g_assert_cmpstr (astr, ==, "[[1, 2, 3], [4, 5, 6]]");
+
+  crank_mat_double_n_fini (&a);
+}
+
+static void
+test_n_get (void)
+{
+  CrankMatDoubleN a = {0};
+
+  crank_mat_double_n_init (&a, 2, 3,
+                           1.0, 2.0, 3.0,
+                           4.0, 5.0, 6.0);
+
+  test_assert_float (crank_mat_double_n_get (&a, 0, 0), 1.0);
+  test_assert_float (crank_mat_double_n_get (&a, 0, 1), 2.0);
+  test_assert_float (crank_mat_double_n_get (&a, 0, 2), 3.0);
+  test_assert_float (crank_mat_double_n_get (&a, 1, 0), 4.0);
+  test_assert_float (crank_mat_double_n_get (&a, 1, 1), 5.0);
+  test_assert_float (crank_mat_double_n_get (&a, 1, 2), 6.0);
+
+  crank_mat_double_n_fini (&a);
+}
+
+static void
+test_n_get_row (void)
+{
+  CrankMatDoubleN a = {0};
+  CrankVecDoubleN r = {0};
+
+  crank_mat_double_n_init (&a, 2, 3,
+                           1.0, 2.0, 3.0,
+                           4.0, 5.0, 6.0);
+
+  crank_mat_double_n_get_row (&a, 0, &r);
+
+  g_assert_cmpuint (r.n, ==, 3);
+  test_assert_float (r.data[0], 1.0);
+  test_assert_float (r.data[1], 2.0);
+  test_assert_float (r.data[2], 3.0);
+
+  crank_mat_double_n_get_row (&a, 1, &r);
+
+  g_assert_cmpuint (r.n, ==, 3);
+  test_assert_float (r.data[0], 4.0);
+  test_assert_float (r.data[1], 5.0);
+  test_assert_float (r.data[2], 6.0);
+
+  crank_mat_double_n_fini (&a);
+  crank_vec_double_n_fini (&r);
+}
+
+static void
+test_n_get_col (void)
+{
+  CrankMatDoubleN a = {0};
+  CrankVecDoubleN c = {0};
+
+  crank_mat_double_n_init (&a, 2, 3,
+                           1.0, 2.0, 3.0,
+                           4.0, 5.0, 6.0);
+
+  crank_mat_double_n_get_col (&a, 0, &c);
+
+  g_assert_cmpuint (c.n, ==, 2);
+  test_assert_float (c.data[0], 1.0);
+  test_assert_float (c.data[1], 4.0);
+
+  crank_mat_double_n_get_col (&a, 1, &c);
+
+  g_assert_cmpuint (c.n, ==, 2);
+  test_assert_float (c.data[0], 2.0);
+  test_assert_float (c.data[1], 5.0);
+
+  crank_mat_double_n_get_col (&a, 2, &c);
+
+  g_assert_cmpuint (c.n, ==, 2);
+  test_assert_float (c.data[0], 3.0);
+  test_assert_float (c.data[1], 6.0);
+
+  crank_mat_double_n_fini (&a);
+  crank_vec_double_n_fini (&c);
+}
+
+static void
+test_n_slice (void)
+{
+  CrankMatDoubleN a;
+  CrankMatDoubleN b;
+
+  crank_mat_double_n_init (&a, 3, 3,
+                           1.0,   2.0,   3.0,
+                           4.0,   5.0,   6.0,
+                           7.0,   8.0,   9.0);
+
+  crank_mat_double_n_slice (&a, 1, 1, 3, 2, &b);
+
+  g_assert_cmpuint (b.rn, ==, 2);
+  g_assert_cmpuint (b.cn, ==, 1);
+
+  test_assert_float (b.data[0], 5.0);
+  test_assert_float (b.data[1], 8.0);
+
+  crank_mat_double_n_fini (&a);
+  crank_mat_double_n_fini (&b);
+}
+
+static void
+test_n_tr (void)
+{
+  CrankMatDoubleN a = {0};
+
+  crank_mat_double_n_init (&a, 5, 5,
+                           1.0, 0.0, 0.0, 1.0, 0.0,
+                           0.0, 2.0, 0.0, 3.0, 1.0,
+                           0.0, 0.0, 3.0, 0.0, 0.0,
+                           1.0, 3.0, 0.0, 4.0, 0.0,
+                           0.0, 1.0, 0.0, 0.0, 5.0);
+
+  test_assert_float (crank_mat_double_n_get_tr (&a), 15.0);
+
+  crank_mat_double_n_fini (&a);
+}
+
+static void
+test_n_det (void)
+{
+  CrankMatDoubleN a = {0};
+
+  crank_mat_double_n_init (&a, 5, 5,
+                           1.0, 0.0, 0.0, 1.0, 0.0,
+                           0.0, 2.0, 0.0, 3.0, 1.0,
+                           0.0, 0.0, 3.0, 0.0, 0.0,
+                           1.0, 3.0, 0.0, 4.0, 0.0,
+                           0.0, 1.0, 0.0, 0.0, 5.0);
+
+  test_assert_float (crank_mat_double_n_get_det (&a), -54.0);
+
+  crank_mat_double_n_fini (&a);
+}
+
+static void
+test_n_cof (void)
+{
+  CrankMatDoubleN a;
+  CrankMatDoubleN r;
+
+  CrankVecDoubleN rv;
+
+  crank_mat_double_n_init (&a, 5, 5,
+                           4.0, 3.0, 2.0, 1.0, 4.0,
+                           3.0, 4.0, 3.0, 2.0, 1.0,
+                           2.0, 3.0, 4.0, 3.0, 2.0,
+                           1.0, 2.0, 3.0, 4.0, 3.0,
+                           4.0, 1.0, 2.0, 3.0, 4.0);
+
+  crank_mat_double_n_get_cof (&a, &r);
+
+  crank_mat_double_n_get_row (&r, 3, &rv);
+
+  crank_assert_eq_vecdouble_n_imm (&rv, 40, -48, 64, -48, -24);
+
+  crank_vec_double_n_fini (&rv);
+  crank_mat_double_n_fini (&a);
+  crank_mat_double_n_fini (&r);
+}
+
+static void
+test_n_adj (void)
+{
+  CrankMatDoubleN a;
+  CrankMatDoubleN r;
+
+  CrankVecDoubleN rv;
+
+  crank_mat_double_n_init (&a, 5, 5,
+                           4.0, 3.0, 2.0, 1.0, 4.0,
+                           3.0, 4.0, 3.0, 2.0, 1.0,
+                           2.0, 3.0, 4.0, 3.0, 2.0,
+                           1.0, 2.0, 3.0, 4.0, 3.0,
+                           4.0, 1.0, 2.0, 3.0, 4.0);
+
+  crank_mat_double_n_get_adj (&a, &r);
+
+  crank_mat_double_n_get_row (&r, 3, &rv);
+
+  crank_assert_eq_vecdouble_n_imm (&rv, 40, -48, 64, -48, -24);
+
+  crank_vec_double_n_fini (&rv);
+  crank_mat_double_n_fini (&a);
+  crank_mat_double_n_fini (&r);
+}
+
+static void
+test_n_diag (void)
+{
+  CrankMatDoubleN a = {0};
+  CrankVecDoubleN b = {0};
+
+  crank_mat_double_n_init (&a, 5, 5,
+                           1.0, 0.0, 0.0, 1.0, 0.0,
+                           0.0, 2.0, 0.0, 3.0, 1.0,
+                           0.0, 0.0, 3.0, 0.0, 0.0,
+                           1.0, 3.0, 0.0, 4.0, 0.0,
+                           0.0, 1.0, 0.0, 0.0, 5.0);
+
+  crank_mat_double_n_get_diag (&a, &b);
+
+  crank_assert_eq_vecdouble_n_imm (&b, 1.0, 2.0, 3.0, 4.0, 5.0);
+
+  crank_mat_double_n_fini (&a);
+}
+
+static void
+test_n_neg (void)
+{
+  CrankMatDoubleN a = {0};
+  CrankMatDoubleN r;
+
+  crank_mat_double_n_init (&a, 2, 3,
+                           1.0, 2.0, 3.0,
+                           4.0, 5.0, 6.0);
+
+  crank_mat_double_n_neg (&a, &r);
+
+  test_assert_float (r.data[0], -1.0);
+  test_assert_float (r.data[1], -2.0);
+  test_assert_float (r.data[2], -3.0);
+  test_assert_float (r.data[3], -4.0);
+  test_assert_float (r.data[4], -5.0);
+  test_assert_float (r.data[5], -6.0);
+
+  crank_mat_double_n_fini (&a);
+  crank_mat_double_n_fini (&r);
+}
+
+static void
+test_n_transpose (void)
+{
+
+  CrankMatDoubleN a = {0};
+  CrankMatDoubleN r;
+
+  crank_mat_double_n_init (&a, 2, 3,
+                           1.0, 2.0, 3.0,
+                           4.0, 5.0, 6.0);
+
+  crank_mat_double_n_transpose (&a, &r);
+
+  g_assert_cmpuint (r.rn, ==, 3);
+  g_assert_cmpuint (r.cn, ==, 2);
+
+  test_assert_float (r.data[0], 1.0);
+  test_assert_float (r.data[1], 4.0);
+  test_assert_float (r.data[2], 2.0);
+  test_assert_float (r.data[3], 5.0);
+  test_assert_float (r.data[4], 3.0);
+  test_assert_float (r.data[5], 6.0);
+
+  crank_mat_double_n_fini (&a);
+  crank_mat_double_n_fini (&r);
+}
+
+static void
+test_n_inverse (void)
+{
+  CrankMatDoubleN a;
+  CrankMatDoubleN r;
+
+  CrankVecDoubleN rv;
+
+  crank_mat_double_n_init (&a, 5, 5,
+                           4.0, 3.0, 2.0, 1.0, 4.0,
+                           3.0, 4.0, 3.0, 2.0, 1.0,
+                           2.0, 3.0, 4.0, 3.0, 2.0,
+                           1.0, 2.0, 3.0, 4.0, 3.0,
+                           4.0, 1.0, 2.0, 3.0, 4.0);
+
+  crank_mat_double_n_inverse (&a, &r);
+
+  crank_mat_double_n_get_row (&r, 3, &rv);
+
+  crank_assert_eq_vecdouble_n_imm (&rv, -0.3125, 0.375, -0.5, 0.375,
+                                   0.1875);
+
+  crank_vec_double_n_fini (&rv);
+  crank_mat_double_n_fini (&a);
+  crank_mat_double_n_fini (&r);
+}
+
+static void
+test_n_solve (void)
+{
+  CrankMatDoubleN a;
+  CrankVecDoubleN b;
+  CrankVecDoubleN x;
+
+  // First pivot is 0, so this requires pivoting.
+  crank_mat_double_n_init (&a, 3, 3,
+                           0.0, 2.0, 1.0,
+                           1.0, 1.0, 1.0,
+                           2.0, 1.0, 3.0);
+
+  crank_vec_double_n_init (&b, 3, 7.0, 6.0, 13.0);
+
+  g_assert (crank_mat_double_n_solve (&a, &b, &x));
+
+  crank_assert_eq_vecdouble_n_imm (&x, 1.0, 2.0, 3.0);
+
+  crank_vec_double_n_fini (&x);
+  crank_vec_double_n_fini (&b);
+  crank_mat_double_n_fini (&a);
+
+  // Singular matrix.
+  crank_mat_double_n_init (&a, 2, 2,
+                           1.0, 2.0,
+                           2.0, 4.0);
+
+  crank_vec_double_n_init (&b, 2, 1.0, 2.0);
+
+  g_assert (! crank_mat_double_n_solve (&a, &b, &x));
+
+  crank_vec_double_n_fini (&b);
+  crank_mat_double_n_fini (&a);
+}
+
+static void
+test_n_solve_multi (void)
+{
+  CrankMatDoubleN a;
+  CrankMatDoubleN b;
+  CrankMatDoubleN x;
+
+  crank_mat_double_n_init (&a, 3, 3,
+                           0.0, 2.0, 1.0,
+                           1.0, 1.0, 1.0,
+                           2.0, 1.0, 3.0);
+
+  crank_mat_double_n_init (&b, 3, 2,
+                           7.0,  3.0,
+                           6.0,  3.0,
+                           13.0, 6.0);
+
+  g_assert (crank_mat_double_n_solve_multi (&a, &b, &x));
+
+  g_assert_cmpuint (x.rn, ==, 3);
+  g_assert_cmpuint (x.cn, ==, 2);
+
+  test_assert_float (crank_mat_double_n_get (&x, 0, 0), 1.0);
+  test_assert_float (crank_mat_double_n_get (&x, 1, 0), 2.0);
+  test_assert_float (crank_mat_double_n_get (&x, 2, 0), 3.0);
+  test_assert_float (crank_mat_double_n_get (&x, 0, 1), 1.0);
+  test_assert_float (crank_mat_double_n_get (&x, 1, 1), 1.0);
+  test_assert_float (crank_mat_double_n_get (&x, 2, 1), 1.0);
+
+  crank_mat_double_n_fini (&x);
+  crank_mat_double_n_fini (&b);
+  crank_mat_double_n_fini (&a);
+}
+
+static void
+test_n_muls (void)
+{
+  CrankMatDoubleN a = {0};
+  CrankMatDoubleN r;
+
+  crank_mat_double_n_init (&a, 2, 3,
+                           1.0, 2.0, 3.0,
+                           4.0, 5.0, 6.0);
+
+  crank_mat_double_n_muls (&a, 3, &r);
+
+  test_assert_float (r.data[0], 3.0);
+  test_assert_float (r.data[1], 6.0);
+  test_assert_float (r.data[2], 9.0);
+  test_assert_float (r.data[3], 12.0);
+  test_assert_float (r.data[4], 15.0);
+  test_assert_float (r.data[5], 18.0);
+
+  crank_mat_double_n_fini (&a);
+  crank_mat_double_n_fini (&r);
+}
+
+static void
+test_n_divs (void)
+{
+  CrankMatDoubleN a = {0};
+  CrankMatDoubleN r;
+
+  crank_mat_double_n_init (&a, 2, 3,
+                           1.0, 2.0, 3.0,
+                           4.0, 5.0, 6.0);
+
+  crank_mat_double_n_muls (&a, 0.5, &r);
+
+  test_assert_float (r.data[0], 0.5);
+  test_assert_float (r.data[1], 1.0);
+  test_assert_float (r.data[2], 1.5);
+  test_assert_float (r.data[3], 2.0);
+  test_assert_float (r.data[4], 2.5);
+  test_assert_float (r.data[5], 3.0);
+
+  crank_mat_double_n_fini (&a);
+  crank_mat_double_n_fini (&r);
+}
+
+static void
+test_n_mulv (void)
+{
+  CrankMatDoubleN a = {0};
+  CrankVecDoubleN b = {0};
+  CrankVecDoubleN r;
+
+  crank_mat_double_n_init (&a, 2, 3,
+                           1.0, 2.0, 3.0,
+                           4.0, 5.0, 6.0);
+
+  crank_vec_double_n_init (&b, 3, 2.0, 3.0, 5.0);
+
+  crank_mat_double_n_mulv (&a, &b, &r);
+
+  test_assert_float (r.data[0], 23.0);
+  test_assert_float (r.data[1], 53.0);
+
+  crank_vec_double_n_fini (&b);
+  crank_mat_double_n_fini (&a);
+}
+
+static void
+test_n_add (void)
+{
+  CrankMatDoubleN a = {0};
+  CrankMatDoubleN b = {0};
+  CrankMatDoubleN r;
+
+  crank_mat_double_n_init (&a, 2, 3,
+                           1.0, 2.0, 3.0,
+                           4.0, 5.0, 6.0);
+  crank_mat_double_n_init (&b, 2, 3,
+                           10.0, 8.0, 1.0,
+                           2.0, 5.0, 7.0);
+
+  crank_mat_double_n_add (&a, &b, &r);
+
+  test_assert_float (r.data[0], 11.0);
+  test_assert_float (r.data[1], 10.0);
+  test_assert_float (r.data[2], 4.0);
+  test_assert_float (r.data[3], 6.0);
+  test_assert_float (r.data[4], 10.0);
+  test_assert_float (r.data[5], 13.0);
+
+  crank_mat_double_n_fini (&a);
+  crank_mat_double_n_fini (&b);
+  crank_mat_double_n_fini (&r);
+}
+
+static void
+test_n_sub (void)
+{
+  CrankMatDoubleN a = {0};
+  CrankMatDoubleN b = {0};
+  CrankMatDoubleN r;
+
+  crank_mat_double_n_init (&a, 2, 3,
+                           1.0, 2.0, 3.0,
+                           4.0, 5.0, 6.0);
+  crank_mat_double_n_init (&b, 2, 3,
+                           10.0, 8.0, 1.0,
+                           2.0, 5.0, 7.0);
+
+  crank_mat_double_n_sub (&a, &b, &r);
+
+  test_assert_float (r.data[0], -9.0);
+  test_assert_float (r.data[1], -6.0);
+  test_assert_float (r.data[2], 2.0);
+  test_assert_float (r.data[3], 2.0);
+  test_assert_float (r.data[4], 0.0);
+  test_assert_float (r.data[5], -1.0);
+
+  crank_mat_double_n_fini (&a);
+  crank_mat_double_n_fini (&b);
+  crank_mat_double_n_fini (&r);
+}
+
+static void
+test_n_mul (void)
+{
+  CrankMatDoubleN a = {0};
+  CrankMatDoubleN b = {0};
+  CrankMatDoubleN r;
+
+  crank_mat_double_n_init (&a, 2, 3,
+                           1.0, 2.0, 3.0,
+                           4.0, 5.0, 6.0);
+
+  crank_mat_double_n_init (&b, 3, 3,
+                           3.0, 2.0, 1.0,
+                           2.0, 1.0, 0.0,
+                           1.0, 0.0, -1.0);
+
+  crank_mat_double_n_mul (&a, &b, &r);
+
+  g_assert_cmpuint (r.rn, ==, 2);
+  g_assert_cmpuint (r.cn, ==, 3);
+  test_assert_float (r.data[0], 10.0);
+  test_assert_float (r.data[1], 4.0);
+  test_assert_float (r.data[2], -2.0);
+  test_assert_float (r.data[3], 28.0);
+  test_assert_float (r.data[4], 13.0);
+  test_assert_float (r.data[5], -2.0);
+
+  crank_mat_double_n_fini (&a);
+  crank_mat_double_n_fini (&b);
+  crank_mat_double_n_fini (&r);
+}
+
+static void
+test_n_mul_large (void)
+{
+  CrankMatDoubleN a = {0};
+  CrankMatDoubleN b = {0};
+  CrankMatDoubleN r;
+
+  guint i;
+  guint j;
+  guint k;
+
+  // Odd sizes, so that edge tiles of blocked kernel are checked.
+  crank_mat_double_n_init_fill (&a, 67, 45, 0.0);
+  crank_mat_double_n_init_fill (&b, 45, 71, 0.0);
+
+  for (i = 0; i < a.rn * a.cn; i++)
+    a.data[i] = (gdouble)((i * 7) % 13) * 0.25 - 1.5;
+
+  for (i = 0; i < b.rn * b.cn; i++)
+    b.data[i] = (gdouble)((i * 5) % 11) * 0.25 - 1.25;
+
+  crank_mat_double_n_mul (&a, &b, &r);
+
+  g_assert_cmpuint (r.rn, ==, 67);
+  g_assert_cmpuint (r.cn, ==, 71);
+
+  for (i = 0; i < r.rn; i++)
+    {
+      for (j = 0; j < r.cn; j++)
+        {
+          gdouble sum = 0.0;
+
+          for (k = 0; k < a.cn; k++)
+            sum += crank_mat_double_n_get (&a, i, k) *
+                   crank_mat_double_n_get (&b, k, j);
+
+          test_assert_float (crank_mat_double_n_get (&r, i, j), sum);
+        }
+    }
+
+  crank_mat_double_n_fini (&a);
+  crank_mat_double_n_fini (&b);
+  crank_mat_double_n_fini (&r);
+}
+
+static void
+test_n_mul_parallel (void)
+{
+  CrankMatDoubleN a = {0};
+  CrankMatDoubleN b = {0};
+  CrankMatDoubleN r;
+  CrankMatDoubleN rp;
+
+  guint i;
+
+  crank_mat_double_n_init_fill (&a, 67, 45, 0.0);
+  crank_mat_double_n_init_fill (&b, 45, 71, 0.0);
+
+  for (i = 0; i < a.rn * a.cn; i++)
+    a.data[i] = (gdouble)((i * 7) % 13) * 0.25 - 1.5;
+
+  for (i = 0; i < b.rn * b.cn; i++)
+    b.data[i] = (gdouble)((i * 5) % 11) * 0.25 - 1.25;
+
+  crank_mat_double_n_mul_parallel (&a, &b, &r, 1);
+  crank_mat_double_n_mul_parallel (&a, &b, &rp, 4);
+
+  g_assert_cmpuint (rp.rn, ==, r.rn);
+  g_assert_cmpuint (rp.cn, ==, r.cn);
+
+  for (i = 0; i < r.rn * r.cn; i++)
+    test_assert_float (rp.data[i], r.data[i]);
+
+  crank_mat_double_n_fini (&a);
+  crank_mat_double_n_fini (&b);
+  crank_mat_double_n_fini (&r);
+  crank_mat_double_n_fini (&rp);
+}
+
+static void
+test_n_inverse_parallel (void)
+{
+  CrankMatDoubleN a = {0};
+  CrankMatDoubleN ainv;
+  CrankMatDoubleN r;
+
+  guint i;
+  guint j;
+
+  // Diagonally dominant matrix, which is large enough to be run in parallel.
+  crank_mat_double_n_init_fill (&a, 100, 100, 0.0);
+
+  for (i = 0; i < a.rn; i++)
+    {
+      for (j = 0; j < a.cn; j++)
+        crank_mat_double_n_set (&a, i, j, (gdouble)((i * 3 + j * 7) % 5) * 0.1);
+
+      crank_mat_double_n_set (&a, i, i, 50.0);
+    }
+
+  crank_mat_double_n_inverse_parallel (&a, &ainv, 4);
+  crank_mat_double_n_mul (&a, &ainv, &r);
+
+  for (i = 0; i < r.rn; i++)
+    for (j = 0; j < r.cn; j++)
+      test_assert_float (crank_mat_double_n_get (&r, i, j), (i == j) ? 1 : 0);
+
+  crank_mat_double_n_fini (&a);
+  crank_mat_double_n_fini (&ainv);
+  crank_mat_double_n_fini (&r);
+}
+
+static void
+test_n_transpose_self (void)
+{
+  CrankMatDoubleN a = {0};
+  CrankMatDoubleN r;
+
+  guint i;
+  guint sizes[][2] = {{7, 7}, {5, 9}, {9, 5}, {1, 6}, {13, 64}};
+
+  for (i = 0; i < G_N_ELEMENTS (sizes); i++)
+    {
+      guint j;
+
+      crank_mat_double_n_init_fill (&a, sizes[i][0], sizes[i][1], 0.0);
+
+      for (j = 0; j < a.rn * a.cn; j++)
+        a.data[j] = (gdouble) j;
+
+      crank_mat_double_n_transpose (&a, &r);
+      crank_mat_double_n_transpose_self (&a);
+
+      g_assert (crank_mat_double_n_equal (&a, &r));
+
+      crank_mat_double_n_fini (&a);
+      crank_mat_double_n_fini (&r);
+    }
+}
+
+static void
+test_n_inverse_self (void)
+{
+  CrankMatDoubleN a = {0};
+  CrankMatDoubleN ainv;
+  CrankMatDoubleN r;
+
+  guint i;
+  guint j;
+
+  // Needs pivoting, as first diagonal component is 0.
+  crank_mat_double_n_init (&a, 3, 3,
+                           0.0, 4.0, 3.0,
+                           3.0, 6.0, 6.0,
+                           2.0, 20.0, 8.0);
+
+  crank_mat_double_n_inverse (&a, &r);
+  g_assert (crank_mat_double_n_try_inverse_self (&a));
+
+  for (i = 0; i < 9; i++)
+    test_assert_float (a.data[i], r.data[i]);
+
+  crank_mat_double_n_fini (&a);
+  crank_mat_double_n_fini (&r);
+
+  // Singular matrix should be left unchanged.
+  crank_mat_double_n_init (&a, 3, 3,
+                           1.0, 2.0, 3.0,
+                           2.0, 4.0, 6.0,
+                           1.0, 5.0, 2.0);
+
+  crank_mat_double_n_copy (&a, &r);
+  g_assert (! crank_mat_double_n_try_inverse_self (&a));
+
+  for (i = 0; i < 9; i++)
+    test_assert_float (a.data[i], r.data[i]);
+
+  crank_mat_double_n_fini (&a);
+  crank_mat_double_n_fini (&r);
+
+  crank_mat_double_n_init_fill (&a, 40, 40, 0.0);
+
+  for (i = 0; i < a.rn; i++)
+    {
+      for (j = 0; j < a.cn; j++)
+        crank_mat_double_n_set (&a, i, j, (gdouble)((i * 3 + j * 7) % 5) * 0.1);
+
+      crank_mat_double_n_set (&a, i, (i * 7) % a.rn, 20.0);
+    }
+
+  crank_mat_double_n_copy (&a, &ainv);
+  crank_mat_double_n_inverse_self (&ainv);
+  crank_mat_double_n_mul (&a, &ainv, &r);
+
+  for (i = 0; i < r.rn; i++)
+    for (j = 0; j < r.cn; j++)
+      test_assert_float (crank_mat_double_n_get (&r, i, j), (i == j) ? 1 : 0);
+
+  crank_mat_double_n_fini (&a);
+  crank_mat_double_n_fini (&ainv);
+  crank_mat_double_n_fini (&r);
+}
+
+static void
+test_n_mul_self (void)
+{
+  CrankMatDoubleN a = {0};
+  CrankMatDoubleN b = {0};
+  CrankMatDoubleN r;
+
+  guint i;
+  guint j;
+  guint sizes[][3] = {{2, 3, 4}, {4, 3, 2}, {67, 45, 71}, {150, 71, 45}};
+
+  // Result may be wider or narrower than a, with small and blocked kernel.
+  for (i = 0; i < G_N_ELEMENTS (sizes); i++)
+    {
+      crank_mat_double_n_init_fill (&a, sizes[i][0], sizes[i][1], 0.0);
+      crank_mat_double_n_init_fill (&b, sizes[i][1], sizes[i][2], 0.0);
+
+      for (j = 0; j < a.rn * a.cn; j++)
+        a.data[j] = (gdouble)((j * 7) % 13) * 0.25 - 1.5;
+
+      for (j = 0; j < b.rn * b.cn; j++)
+        b.data[j] = (gdouble)((j * 5) % 11) * 0.25 - 1.25;
+
+      crank_mat_double_n_mul (&a, &b, &r);
+      crank_mat_double_n_mul_self (&a, &b);
+
+      g_assert_cmpuint (a.rn, ==, r.rn);
+      g_assert_cmpuint (a.cn, ==, r.cn);
+
+      for (j = 0; j < r.rn * r.cn; j++)
+        test_assert_float (a.data[j], r.data[j]);
+
+      crank_mat_double_n_fini (&a);
+      crank_mat_double_n_fini (&b);
+      crank_mat_double_n_fini (&r);
+    }
+
+  // Squaring, with small and blocked kernel.
+  for (i = 3; i < 100; i += 64)
+    {
+      crank_mat_double_n_init_fill (&a, i, i, 0.0);
+
+      for (j = 0; j < a.rn * a.cn; j++)
+        a.data[j] = (gdouble)((j * 7) % 13) * 0.25 - 1.5;
+
+      crank_mat_double_n_mul (&a, &a, &r);
+      crank_mat_double_n_mul_self (&a, &a);
+
+      g_assert_cmpuint (a.rn, ==, r.rn);
+      g_assert_cmpuint (a.cn, ==, r.cn);
+
+      for (j = 0; j < r.rn * r.cn; j++)
+        test_assert_float (a.data[j], r.data[j]);
+
+      crank_mat_double_n_fini (&a);
+      crank_mat_double_n_fini (&r);
+    }
+}
+
+static void
+test_n_mixs (void)
+{
+  CrankMatDoubleN a = {0};
+  CrankMatDoubleN b = {0};
+  CrankMatDoubleN r;
+
+  crank_mat_double_n_init (&a, 2, 3,
+                           1.0, 2.0, 3.0,
+                           4.0, 5.0, 6.0);
+
+  crank_mat_double_n_init (&b, 2, 3,
+                           3.0, 6.0, 9.0,
+                           12.0, 15.0, 18.0);
+
+  crank_mat_double_n_mixs (&a, &b, 0.5, &r);
+
+  test_assert_float (r.data[0], 2.0);
+  test_assert_float (r.data[1], 4.0);
+  test_assert_float (r.data[2], 6.0);
+  test_assert_float (r.data[3], 8.0);
+  test_assert_float (r.data[4], 10.0);
+  test_assert_float (r.data[5], 12.0);
+
+  crank_mat_double_n_fini (&a);
+  crank_mat_double_n_fini (&b);
+  crank_mat_double_n_fini (&r);
+}
+
+static void
+test_n_mix (void)
+{
+  CrankMatDoubleN a = {0};
+  CrankMatDoubleN b = {0};
+  CrankMatDoubleN c = {0};
+  CrankMatDoubleN r;
+
+  crank_mat_double_n_init (&a, 2, 3,
+                           1.0, 2.0, 3.0,
+                           4.0, 5.0, 6.0);
+
+  crank_mat_double_n_init (&b, 2, 3,
+                           3.0, 6.0, 9.0,
+                           12.0, 15.0, 18.0);
+
+  crank_mat_double_n_init (&c, 2, 3,
+                           0.0, 0.2, 0.4,
+                           0.6, 0.8, 1.0);
+
+  crank_mat_double_n_mix (&a, &b, &c, &r);
+
+  test_assert_float (r.data[0], 1.0);
+  test_assert_float (r.data[1], 2.8);
+  test_assert_float (r.data[2], 5.4);
+  test_assert_float (r.data[3], 8.8);
+  test_assert_float (r.data[4], 13.0);
+  test_assert_float (r.data[5], 18.0);
+
+  crank_mat_double_n_fini (&a);
+  crank_mat_double_n_fini (&b);
+  crank_mat_double_n_fini (&c);
+  crank_mat_double_n_fini (&r);
+}
+
+static void
+test_n_shuffle_row (void)
+{
+  CrankMatDoubleN a;
+  CrankMatDoubleN b;
+  CrankPermutation p;
+
+  crank_mat_double_n_init (&a, 4, 2,
+                           1.0, 3.0,
+                           7.0, 2.0,
+                           1.0, 4.0,
+                           3.0, 1.0);
+
+  crank_permutation_init (&p, 4,
+                          1, 3, 0, 2);
+
+  crank_mat_double_n_shuffle_row (&a, &p, &b);
+
+  test_assert_float (b.data[0], 7.0);
+  test_assert_float (b.data[1], 2.0);
+  test_assert_float (b.data[2], 3.0);
+  test_assert_float (b.data[3], 1.0);
+  test_assert_float (b.data[4], 1.0);
+  test_assert_float (b.data[5], 3.0);
+  test_assert_float (b.data[6], 1.0);
+  test_assert_float (b.data[7], 4.0);
+
+  crank_mat_double_n_fini (&a);
+  crank_mat_double_n_fini (&b);
+  crank_permutation_fini (&p);
+}
+static void
+test_n_shuffle_col (void)
+{
+  CrankMatDoubleN a;
+  CrankMatDoubleN b;
+  CrankPermutation p;
+
+  crank_mat_double_n_init (&a, 2, 4,
+                           1.0, 7.0, 1.0, 3.0,
+                           3.0, 2.0, 4.0, 1.0);
+
+  crank_permutation_init (&p, 4,
+                          1, 3, 0, 2);
+
+  crank_mat_double_n_shuffle_col (&a, &p, &b);
+
+  test_assert_float (b.data[0], 7.0);
+  test_assert_float (b.data[1], 3.0);
+  test_assert_float (b.data[2], 1.0);
+  test_assert_float (b.data[3], 1.0);
+  test_assert_float (b.data[4], 2.0);
+  test_assert_float (b.data[5], 1.0);
+  test_assert_float (b.data[6], 3.0);
+  test_assert_float (b.data[7], 4.0);
+
+  crank_mat_double_n_fini (&a);
+  crank_mat_double_n_fini (&b);
+  crank_permutation_fini (&p);
+}
+
+static void
+test_n_init_row (void)
+{
+  CrankVecDoubleN rows[3];
+  CrankMatDoubleN a;
+
+  crank_vec_double_n_init (rows + 0, 3, 0.0, 1.0, 2.0);
+  crank_vec_double_n_init (rows + 1, 3, 3.0, 4.0, 5.0);
+  crank_vec_double_n_init (rows + 2, 3, 6.0, 7.0, 8.0);
+
+  crank_mat_double_n_init_row (&a, 3, rows + 0, rows + 1, rows + 2);
+
+  test_assert_float (a.data[0], 0.0);
+  test_assert_float (a.data[1], 1.0);
+  test_assert_float (a.data[2], 2.0);
+  test_assert_float (a.data[3], 3.0);
+  test_assert_float (a.data[4], 4.0);
+  test_assert_float (a.data[5], 5.0);
+  test_assert_float (a.data[6], 6.0);
+  test_assert_float (a.data[7], 7.0);
+  test_assert_float (a.data[8], 8.0);
+
+  crank_vec_double_n_fini (rows + 0);
+  crank_vec_double_n_fini (rows + 1);
+  crank_vec_double_n_fini (rows + 2);
+}
+
+static void
+test_n_init_row_arr (void)
+{
+  CrankVecDoubleN rows[3];
+  CrankMatDoubleN a;
+
+  crank_vec_double_n_init (rows + 0, 3, 0.0, 1.0, 2.0);
+  crank_vec_double_n_init (rows + 1, 3, 3.0, 4.0, 5.0);
+  crank_vec_double_n_init (rows + 2, 3, 6.0, 7.0, 8.0);
+
+  crank_mat_double_n_init_row_arr (&a, 3, rows);
+
+  test_assert_float (a.data[0], 0.0);
+  test_assert_float (a.data[1], 1.0);
+  test_assert_float (a.data[2], 2.0);
+  test_assert_float (a.data[3], 3.0);
+  test_assert_float (a.data[4], 4.0);
+  test_assert_float (a.data[5], 5.0);
+  test_assert_float (a.data[6], 6.0);
+  test_assert_float (a.data[7], 7.0);
+  test_assert_float (a.data[8], 8.0);
+
+  crank_vec_double_n_fini (rows + 0);
+  crank_vec_double_n_fini (rows + 1);
+  crank_vec_double_n_fini (rows + 2);
+}
+
+static void
+test_n_init_row_parr (void)
+{
+  CrankVecDoubleN *rows[3];
+  CrankMatDoubleN a;
+
+  rows[0] = g_new (CrankVecDoubleN, 1);
+  rows[1] = g_new (CrankVecDoubleN, 1);
+  rows[2] = g_new (CrankVecDoubleN, 1);
+
+  crank_vec_double_n_init (rows[0], 3, 0.0, 1.0, 2.0);
+  crank_vec_double_n_init (rows[1], 3, 3.0, 4.0, 5.0);
+  crank_vec_double_n_init (rows[2], 3, 6.0, 7.0, 8.0);
+
+  crank_mat_double_n_init_row_parr (&a, 3, rows);
+
+  test_assert_float (a.data[0], 0.0);
+  test_assert_float (a.data[1], 1.0);
+  test_assert_float (a.data[2], 2.0);
+  test_assert_float (a.data[3], 3.0);
+  test_assert_float (a.data[4], 4.0);
+  test_assert_float (a.data[5], 5.0);
+  test_assert_float (a.data[6], 6.0);
+  test_assert_float (a.data[7], 7.0);
+  test_assert_float (a.data[8], 8.0);
+
+  crank_vec_double_n_fini (rows[0]);
+  crank_vec_double_n_fini (rows[1]);
+  crank_vec_double_n_fini (rows[2]);
+}
+
+
+static void
+test_n_init_col (void)
+{
+  CrankVecDoubleN cols[3];
+  CrankMatDoubleN a;
+
+  crank_vec_double_n_init (cols + 0, 3, 0.0, 1.0, 2.0);
+  crank_vec_double_n_init (cols + 1, 3, 3.0, 4.0, 5.0);
+  crank_vec_double_n_init (cols + 2, 3, 6.0, 7.0, 8.0);
+
+  crank_mat_double_n_init_col (&a, 3, cols + 0, cols + 1, cols + 2);
+
+  test_assert_float (a.data[0], 0.0);
+  test_assert_float (a.data[1], 3.0);
+  test_assert_float (a.data[2], 6.0);
+  test_assert_float (a.data[3], 1.0);
+  test_assert_float (a.data[4], 4.0);
+  test_assert_float (a.data[5], 7.0);
+  test_assert_float (a.data[6], 2.0);
+  test_assert_float (a.data[7], 5.0);
+  test_assert_float (a.data[8], 8.0);
+
+  crank_vec_double_n_fini (cols + 0);
+  crank_vec_double_n_fini (cols + 1);
+  crank_vec_double_n_fini (cols + 2);
+}
+
+static void
+test_n_init_col_arr (void)
+{
+  CrankVecDoubleN cols[3];
+  CrankMatDoubleN a;
+
+  crank_vec_double_n_init (cols + 0, 3, 0.0, 1.0, 2.0);
+  crank_vec_double_n_init (cols + 1, 3, 3.0, 4.0, 5.0);
+  crank_vec_double_n_init (cols + 2, 3, 6.0, 7.0, 8.0);
+
+  crank_mat_double_n_init_col_arr (&a, 3, cols);
+
+  test_assert_float (a.data[0], 0.0);
+  test_assert_float (a.data[1], 3.0);
+  test_assert_float (a.data[2], 6.0);
+  test_assert_float (a.data[3], 1.0);
+  test_assert_float (a.data[4], 4.0);
+  test_assert_float (a.data[5], 7.0);
+  test_assert_float (a.data[6], 2.0);
+  test_assert_float (a.data[7], 5.0);
+  test_assert_float (a.data[8], 8.0);
+
+  crank_vec_double_n_fini (cols + 0);
+  crank_vec_double_n_fini (cols + 1);
+  crank_vec_double_n_fini (cols + 2);
+}
+
+static void
+test_n_init_col_parr (void)
+{
+  CrankVecDoubleN *cols[3];
+  CrankMatDoubleN a;
+
+  cols[0] = g_new (CrankVecDoubleN, 1);
+  cols[1] = g_new (CrankVecDoubleN, 1);
+  cols[2] = g_new (CrankVecDoubleN, 1);
+
+  crank_vec_double_n_init (cols[0], 3, 0.0, 1.0, 2.0);
+  crank_vec_double_n_init (cols[1], 3, 3.0, 4.0, 5.0);
+  crank_vec_double_n_init (cols[2], 3, 6.0, 7.0, 8.0);
+
+  crank_mat_double_n_init_col_parr (&a, 3, cols);
+
+  test_assert_float (a.data[0], 0.0);
+  test_assert_float (a.data[1], 3.0);
+  test_assert_float (a.data[2], 6.0);
+  test_assert_float (a.data[3], 1.0);
+  test_assert_float (a.data[4], 4.0);
+  test_assert_float (a.data[5], 7.0);
+  test_assert_float (a.data[6], 2.0);
+  test_assert_float (a.data[7], 5.0);
+  test_assert_float (a.data[8], 8.0);
+
+  crank_vec_double_n_fini (cols[0]);
+  crank_vec_double_n_fini (cols[1]);
+  crank_vec_double_n_fini (cols[2]);
+}
+
+
+
+
+static void
+test_n_upper_tri_inverse (void)
+{
+  CrankMatDoubleN a;
+  CrankMatDoubleN b;
+  CrankVecDoubleN r;
+
+  crank_mat_double_n_init (&a, 5, 5,
+                           4.0, 4.0, 2.0, 1.0, 1.0,
+                           0.0, 4.0, 4.0, 2.0, 1.0,
+                           0.0, 0.0, 4.0, 4.0, 2.0,
+                           0.0, 0.0, 0.0, 4.0, 4.0,
+                           0.0, 0.0, 0.0, 0.0, 4.0);
+
+  crank_mat_double_n_upper_tri_inverse (&a, &b);
+
+  crank_mat_double_n_get_row (&b, 0, &r);
+
+  crank_assert_eq_vecdouble_n_imm (&r, 0.25, -0.25, 0.125, -0.0625, 0.0);
+
+  crank_vec_double_n_fini (&r);
+  crank_mat_double_n_fini (&b);
+  crank_mat_double_n_fini (&a);
+}
+
+static void
+test_n_lower_tri_inverse (void)
+{
+  CrankMatDoubleN a;
+  CrankMatDoubleN b;
+  CrankVecDoubleN r;
+
+  crank_mat_double_n_init (&a, 5, 5,
+                           4.0, 0.0, 0.0, 0.0, 0.0,
+                           4.0, 4.0, 0.0, 0.0, 0.0,
+                           2.0, 4.0, 4.0, 0.0, 0.0,
+                           1.0, 2.0, 4.0, 4.0, 0.0,
+                           1.0, 1.0, 2.0, 4.0, 4.0);
+
+  crank_mat_double_n_lower_tri_inverse (&a, &b);
+
+  crank_mat_double_n_get_col (&b, 0, &r);
+
+  crank_assert_eq_vecdouble_n_imm (&r, 0.25, -0.25, 0.125, -0.0625, 0.0);
+
+  crank_vec_double_n_fini (&r);
+  crank_mat_double_n_fini (&b);
+  crank_mat_double_n_fini (&a);
+}
+
+static void
+test_n_diag_inverse (void)
+{
+  CrankMatDoubleN a;
+  CrankMatDoubleN b;
+  CrankVecDoubleN r;
+
+  crank_mat_double_n_init (&a, 5, 5,
+                           4.0, 4.0, 2.0, 1.0, 1.0,
+                           0.0, 4.0, 4.0, 2.0, 1.0,
+                           0.0, 0.0, 4.0, 4.0, 2.0,
+                           0.0, 0.0, 0.0, 4.0, 4.0,
+                           0.0, 0.0, 0.0, 0.0, 4.0);
+
+  crank_mat_double_n_diag_inverse (&a, &b);
+
+  crank_mat_double_n_get_diag (&b, &r);
+
+  crank_assert_eq_vecdouble_n_imm (&r, 0.25, 0.25, 0.25, 0.25, 0.25);
+
+  crank_vec_double_n_fini (&r);
+  crank_mat_double_n_fini (&b);
+  crank_mat_double_n_fini (&a);
+}
@@ -0,0 +1,341 @@
+/* Copyright (C) 2015, WSID   */
+
+/* Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+#include <glib.h>
+
+#include "crankbase.h"
+
+//////// Declaration ///////////////////////////////////////////////////////////
+
+static void test_mul (void);
+
+static void test_mulv (void);
+
+static void test_solve (void);
+
+static void test_solve_singular (void);
+
+static void test_ch (void);
+
+static void test_ch_fail (void);
+
+static void test_mat_float_n (void);
+
+//////// Main //////////////////////////////////////////////////////////////////
+
+gint
+main (gint   argc,
+      gchar *argv[])
+{
+  g_test_init (&argc, &argv, NULL);
+
+  g_test_add_func ("/crank/base/mat/fixed/mul", test_mul);
+
+  g_test_add_func ("/crank/base/mat/fixed/mulv", test_mulv);
+
+  g_test_add_func ("/crank/base/mat/fixed/solve", test_solve);
+
+  g_test_add_func ("/crank/base/mat/fixed/solve/singular",
+                   test_solve_singular);
+
+  g_test_add_func ("/crank/base/mat/fixed/ch", test_ch);
+
+  g_test_add_func ("/crank/base/mat/fixed/ch/fail", test_ch_fail);
+
+  g_test_add_func ("/crank/base/mat/fixed/mat_float_n", test_mat_float_n);
+
+  g_test_run ();
+
+  return 0;
+}
+
+//////// Helpers ///////////////////////////////////////////////////////////////
+
+#define MAX_N CRANK_MAT_FLOAT_FIXED_MAX
+
+static void
+fill_rand (const guint  n,
+           gfloat      *a)
+{
+  guint i;
+
+  for (i = 0; i < n; i++)
+    a[i] = g_test_rand_double_range (-1, 1);
+}
+
+static void
+ref_mul (const guint   n,
+         const gfloat *a,
+         const gfloat *b,
+         gfloat       *r)
+{
+  guint i;
+  guint j;
+  guint k;
+
+  for (i = 0; i < n; i++)
+    for (j = 0; j < n; j++)
+      {
+        gfloat sum = 0;
+
+        for (k = 0; k < n; k++)
+          sum += a[(i * n) + k] * b[(k * n) + j];
+
+        r[(i * n) + j] = sum;
+      }
+}
+
+//////// Definition ////////////////////////////////////////////////////////////
+
+static void
+test_mul (void)
+{
+  gfloat a[MAX_N * MAX_N];
+  gfloat b[MAX_N * MAX_N];
+  gfloat r[MAX_N * MAX_N];
+  gfloat e[MAX_N * MAX_N];
+  guint n;
+  guint i;
+
+  for (n = CRANK_MAT_FLOAT_FIXED_MIN; n <= CRANK_MAT_FLOAT_FIXED_MAX; n++)
+    {
+      fill_rand (n * n, a);
+      fill_rand (n * n, b);
+
+      ref_mul (n, a, b, e);
+      crank_mat_float_fixed_mul (n, a, b, r);
+
+      for (i = 0; i < n * n; i++)
+        crank_assert_eqfloat (r[i], e[i], 0.0001f);
+
+      // In place
+      crank_mat_float_fixed_mul (n, a, b, a);
+
+      for (i = 0; i < n * n; i++)
+        crank_assert_eqfloat (a[i], e[i], 0.0001f);
+    }
+}
+
+static void
+test_mulv (void)
+{
+  gfloat a[MAX_N * MAX_N];
+  gfloat b[MAX_N];
+  gfloat r[MAX_N];
+  guint n;
+  guint i;
+  guint k;
+
+  for (n = CRANK_MAT_FLOAT_FIXED_MIN; n <= CRANK_MAT_FLOAT_FIXED_MAX; n++)
+    {
+      fill_rand (n * n, a);
+      fill_rand (n, b);
+
+      crank_mat_float_fixed_mulv (n, a, b, r);
+
+      for (i = 0; i < n; i++)
+        {
+          gfloat sum = 0;
+
+          for (k = 0; k < n; k++)
+            sum += a[(i * n) + k] * b[k];
+
+          crank_assert_eqfloat (r[i], sum, 0.0001f);
+        }
+    }
+}
+
+static void
+test_solve (void)
+{
+  gfloat a[MAX_N * MAX_N];
+  gfloat b[MAX_N];
+  gfloat x[MAX_N];
+  guint n;
+  guint i;
+  guint k;
+
+  for (n = CRANK_MAT_FLOAT_FIXED_MIN; n <= CRANK_MAT_FLOAT_FIXED_MAX; n++)
+    {
+      fill_rand (n * n, a);
+      fill_rand (n, b);
+
+      // Makes it well conditioned, and moves large elements off diagonal, so
+      // that pivoting happens.
+      for (i = 0; i < n; i++)
+        a[(i * n) + ((i + 1) % n)] += n;
+
+      g_assert (crank_mat_float_fixed_solve (n, a, b, x));
+
+      for (i = 0; i < n; i++)
+        {
+          gfloat sum = 0;
+
+          for (k = 0; k < n; k++)
+            sum += a[(i * n) + k] * x[k];
+
+          crank_assert_eqfloat (sum, b[i], 0.0001f);
+        }
+    }
+}
+
+static void
+test_solve_singular (void)
+{
+  gfloat a[36];
+  gfloat b[6] = {1, 2, 3, 4, 5, 6};
+  gfloat x[6] = {7, 7, 7, 7, 7, 7};
+  guint i;
+
+  // Zero column stays zero during elimination, so that it is exactly singular.
+  fill_rand (36, a);
+
+  for (i = 0; i < 6; i++)
+    a[(i * 6) + 3] = 0;
+
+  g_assert_false (crank_mat_float_fixed_solve (6, a, b, x));
+
+  for (i = 0; i < 6; i++)
+    crank_assert_cmpfloat (x[i], ==, 7);
+}
+
+static void
+test_ch (void)
+{
+  gfloat m[MAX_N * MAX_N];
+  gfloat a[MAX_N * MAX_N];
+  gfloat l[MAX_N * MAX_N];
+  guint n;
+  guint i;
+  guint j;
+  guint k;
+
+  for (n = CRANK_MAT_FLOAT_FIXED_MIN; n <= CRANK_MAT_FLOAT_FIXED_MAX; n++)
+    {
+      // a = m m^T + n I
+      fill_rand (n * n, m);
+
+      for (i = 0; i < n; i++)
+        for (j = 0; j < n; j++)
+          {
+            gfloat sum = (i == j) ? n : 0;
+
+            for (k = 0; k < n; k++)
+              sum += m[(i * n) + k] * m[(j * n) + k];
+
+            a[(i * n) + j] = sum;
+          }
+
+      g_assert (crank_mat_float_fixed_ch (n, a, l));
+
+      for (i = 0; i < n; i++)
+        for (j = 0; j < n; j++)
+          {
+            gfloat sum = 0;
+
+            if (i < j)
+              crank_assert_cmpfloat (l[(i * n) + j], ==, 0);
+
+            for (k = 0; k < n; k++)
+              sum += l[(i * n) + k] * l[(j * n) + k];
+
+            crank_assert_eqfloat (sum, a[(i * n) + j], 0.001f);
+          }
+
+      // In place
+      g_assert (crank_mat_float_fixed_ch (n, a, a));
+
+      for (i = 0; i < n * n; i++)
+        crank_assert_cmpfloat (a[i], ==, l[i]);
+    }
+}
+
+static void
+test_ch_fail (void)
+{
+  gfloat a[9] = {1, 2, 3,
+                 2, 1, 4,
+                 3, 4, 1};
+  gfloat l[9] = {0};
+  guint i;
+
+  g_assert_false (crank_mat_float_fixed_ch (3, a, l));
+
+  for (i = 0; i < 9; i++)
+    crank_assert_cmpfloat (l[i], ==, 0);
+}
+
+static void
+test_mat_float_n (void)
+{
+  CrankMatFloatN a;
+  CrankMatFloatN b;
+  CrankMatFloatN r;
+  CrankVecFloatN v;
+  CrankVecFloatN rv;
+
+  gfloat e[36];
+  gfloat ev[6];
+  guint i;
+
+  crank_mat_float_n_init_fill (&a, 6, 6, 0);
+  crank_mat_float_n_init_fill (&b, 6, 6, 0);
+  crank_vec_float_n_init_fill (&v, 6, 0);
+
+  fill_rand (36, a.data);
+  fill_rand (36, b.data);
+  fill_rand (6, v.data);
+
+  for (i = 0; i < 6; i++)
+    a.data[(i * 6) + i] += 6;
+
+  crank_mat_float_n_mul (&a, &b, &r);
+  ref_mul (6, a.data, b.data, e);
+
+  g_assert_cmpuint (r.rn, ==, 6);
+  g_assert_cmpuint (r.cn, ==, 6);
+
+  for (i = 0; i < 36; i++)
+    crank_assert_eqfloat (r.data[i], e[i], 0.0001f);
+
+  crank_mat_float_n_mulv (&a, &v, &rv);
+  crank_mat_float_fixed_mulv (6, a.data, v.data, ev);
+
+  g_assert_cmpuint (rv.n, ==, 6);
+
+  for (i = 0; i < 6; i++)
+    crank_assert_eqfloat (rv.data[i], ev[i], 0.0001f);
+
+  crank_vec_float_n_fini (&rv);
+
+  g_assert (crank_mat_float_n_solve (&a, &v, &rv));
+  g_assert (crank_mat_float_fixed_solve (6, a.data, v.data, ev));
+
+  g_assert_cmpuint (rv.n, ==, 6);
+
+  for (i = 0; i < 6; i++)
+    crank_assert_eqfloat (rv.data[i], ev[i], 0.0001f);
+
+  crank_mat_float_n_fini (&a);
+  crank_mat_float_n_fini (&b);
+  crank_mat_float_n_fini (&r);
+  crank_vec_float_n_fini (&v);
+  crank_vec_float_n_fini (&rv);
+}
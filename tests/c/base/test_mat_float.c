@@ -60,6 +60,11 @@ static void test_2_mix (void);
 static void test_3_init_rot (void);
 static void test_3_get_rot (void);
 
+static void test_4_batch_mulv (void);
+static void test_4_batch_mul (void);
+static void test_4_batch_transform (void);
+static void test_4_soa_transform (void);
+
 
 static void test_n_equal (void);
 static void test_n_to_string (void);
@@ -78,6 +83,8 @@ static void test_n_diag (void);
 static void test_n_neg (void);
 static void test_n_transpose (void);
 static void test_n_inverse (void);
+static void test_n_solve (void);
+static void test_n_solve_multi (void);
 
 static void test_n_muls (void);
 static void test_n_divs (void);
@@ -85,6 +92,13 @@ static void test_n_mulv (void);
 static void test_n_add (void);
 static void test_n_sub (void);
 static void test_n_mul (void);
+static void test_n_mul_large (void);
+static void test_n_mul_blocked (void);
+static void test_n_mul_parallel (void);
+static void test_n_inverse_parallel (void);
+static void test_n_transpose_self (void);
+static void test_n_inverse_self (void);
+static void test_n_mul_self (void);
 static void test_n_mixs (void);
 static void test_n_mix (void);
 
@@ -135,6 +149,13 @@ main (gint    argc,
   g_test_add_func ("/crank/base/mat/float/3/rot/init",    test_3_init_rot);
   g_test_add_func ("/crank/base/mat/float/3/rot/get",     test_3_get_rot);
 
+  g_test_add_func ("/crank/base/mat/float/4/batch/mulv",  test_4_batch_mulv);
+  g_test_add_func ("/crank/base/mat/float/4/batch/mul",   test_4_batch_mul);
+  g_test_add_func ("/crank/base/mat/float/4/batch/transform",
+                   test_4_batch_transform);
+  g_test_add_func ("/crank/base/mat/float/4/soa/transform",
+                   test_4_soa_transform);
+
   g_test_add_func ("/crank/base/mat/float/n/equal",       test_n_equal);
   g_test_add_func ("/crank/base/mat/float/n/to_string",   test_n_to_string);
   g_test_add_func ("/crank/base/mat/float/n/get",         test_n_get);
@@ -149,12 +170,25 @@ main (gint    argc,
   g_test_add_func ("/crank/base/mat/float/n/diag",        test_n_diag);
   g_test_add_func ("/crank/base/mat/float/n/transpose",   test_n_transpose);
   g_test_add_func ("/crank/base/mat/float/n/inverse",     test_n_inverse);
+  g_test_add_func ("/crank/base/mat/float/n/solve",       test_n_solve);
+  g_test_add_func ("/crank/base/mat/float/n/solve/multi", test_n_solve_multi);
   g_test_add_func ("/crank/base/mat/float/n/muls",        test_n_muls);
   g_test_add_func ("/crank/base/mat/float/n/divs",        test_n_divs);
   g_test_add_func ("/crank/base/mat/float/n/mulv",        test_n_mulv);
   g_test_add_func ("/crank/base/mat/float/n/add",         test_n_add);
   g_test_add_func ("/crank/base/mat/float/n/sub",         test_n_sub);
   g_test_add_func ("/crank/base/mat/float/n/mul",         test_n_mul);
+  g_test_add_func ("/crank/base/mat/float/n/mul/large",   test_n_mul_large);
+  g_test_add_func ("/crank/base/mat/float/n/mul/blocked", test_n_mul_blocked);
+  g_test_add_func ("/crank/base/mat/float/n/mul/parallel",
+                   test_n_mul_parallel);
+  g_test_add_func ("/crank/base/mat/float/n/inverse/parallel",
+                   test_n_inverse_parallel);
+  g_test_add_func ("/crank/base/mat/float/n/transpose/self",
+                   test_n_transpose_self);
+  g_test_add_func ("/crank/base/mat/float/n/inverse/self",
+                   test_n_inverse_self);
+  g_test_add_func ("/crank/base/mat/float/n/mul/self",    test_n_mul_self);
   g_test_add_func ("/crank/base/mat/float/n/mixs",        test_n_mixs);
   g_test_add_func ("/crank/base/mat/float/n/mix",         test_n_mix);
 
@@ -531,6 +565,153 @@ test_3_get_rot (void)
 }
 
 
+static void
+test_4_batch_mulv (void)
+{
+  CrankMatFloat4 a;
+  CrankVecFloat4 b[13];
+  CrankVecFloat4 r[13];
+  guint i;
+
+  crank_mat_float4_init (&a,
+                         1.0f,  2.0f,  3.0f,  4.0f,
+                         5.0f,  6.0f,  7.0f,  8.0f,
+                         9.0f,  10.0f, 11.0f, 12.0f,
+                         13.0f, 14.0f, 15.0f, 16.0f);
+
+  for (i = 0; i < 13; i++)
+    crank_vec_float4_init (b + i, i, 1.0f - i, 0.5f * i, 2.0f);
+
+  crank_mat_float4_batch_mulv (13, &a, b, r);
+
+  for (i = 0; i < 13; i++)
+    {
+      CrankVecFloat4 e;
+
+      crank_mat_float4_mulv (&a, b + i, &e);
+      crank_assert_eq_vecfloat4_imm (r + i, e.x, e.y, e.z, e.w);
+    }
+
+  // In-place.
+  crank_mat_float4_batch_mulv (13, &a, b, b);
+
+  for (i = 0; i < 13; i++)
+    crank_assert_eq_vecfloat4_imm (b + i, r[i].x, r[i].y, r[i].z, r[i].w);
+}
+
+static void
+test_4_batch_mul (void)
+{
+  CrankMatFloat4 a[5];
+  CrankMatFloat4 b[5];
+  CrankMatFloat4 r[5];
+  guint i;
+
+  for (i = 0; i < 5; i++)
+    {
+      crank_mat_float4_init (a + i,
+                             1.0f,  2.0f,  3.0f,  4.0f * i,
+                             5.0f,  6.0f * i,  7.0f,  8.0f,
+                             9.0f,  10.0f, 11.0f + i, 12.0f,
+                             13.0f, 14.0f, 15.0f, 16.0f);
+
+      crank_mat_float4_init (b + i,
+                             2.0f,  0.0f,  1.0f,  0.0f,
+                             0.0f,  1.0f - i,  0.0f,  3.0f,
+                             i,  0.0f, 1.0f, 0.0f,
+                             1.0f, 0.0f, 0.5f * i, 1.0f);
+    }
+
+  crank_mat_float4_batch_mul (5, a, b, r);
+
+  for (i = 0; i < 5; i++)
+    {
+      CrankMatFloat4 e;
+
+      crank_mat_float4_mul (a + i, b + i, &e);
+      g_assert (crank_mat_float4_equal (r + i, &e));
+    }
+
+  // In-place.
+  crank_mat_float4_batch_mul (5, a, b, a);
+
+  for (i = 0; i < 5; i++)
+    g_assert (crank_mat_float4_equal (a + i, r + i));
+}
+
+static void
+test_4_batch_transform (void)
+{
+  CrankMatFloat4 a;
+  CrankVecFloat3 b[37];
+  CrankVecFloat3 r[37];
+  guint i;
+
+  crank_mat_float4_init (&a,
+                         0.0f, -1.0f, 0.0f, 3.0f,
+                         1.0f,  0.0f, 0.0f, 4.0f,
+                         0.0f,  0.0f, 2.0f, 5.0f,
+                         0.0f,  0.0f, 0.0f, 1.0f);
+
+  for (i = 0; i < 37; i++)
+    crank_vec_float3_init (b + i, i, 1.0f - i, 0.5f * i);
+
+  crank_mat_float4_batch_transform (37, &a, b, r);
+
+  for (i = 0; i < 37; i++)
+    crank_assert_eq_vecfloat3_imm (r + i,
+                                   3.0f - b[i].y,
+                                   4.0f + b[i].x,
+                                   5.0f + 2.0f * b[i].z);
+}
+
+static void
+test_4_soa_transform (void)
+{
+  CrankMatFloat4 a;
+  gfloat x[37];
+  gfloat y[37];
+  gfloat z[37];
+  gfloat rx[37];
+  gfloat ry[37];
+  gfloat rz[37];
+  guint i;
+
+  crank_mat_float4_init (&a,
+                         0.0f, -1.0f, 0.0f, 3.0f,
+                         1.0f,  0.0f, 0.0f, 4.0f,
+                         0.0f,  0.0f, 2.0f, 5.0f,
+                         0.0f,  0.0f, 0.0f, 1.0f);
+
+  // Count is not multiple of width of vector, so that remainings are checked.
+  for (i = 0; i < 37; i++)
+    {
+      x[i] = i;
+      y[i] = 1.0f - i;
+      z[i] = 0.5f * i;
+    }
+
+  crank_mat_float4_soa_transform (37, &a, x, y, z, rx, ry, rz);
+
+  for (i = 0; i < 37; i++)
+    {
+      crank_assert_cmpfloat (rx[i], ==, 3.0f - y[i]);
+      crank_assert_cmpfloat (ry[i], ==, 4.0f + x[i]);
+      crank_assert_cmpfloat (rz[i], ==, 5.0f + 2.0f * z[i]);
+    }
+
+  // In-place.
+  crank_mat_float4_soa_transform (37, &a, x, y, z, x, y, z);
+
+  for (i = 0; i < 37; i++)
+    {
+      crank_assert_cmpfloat (x[i], ==, rx[i]);
+      crank_assert_cmpfloat (y[i], ==, ry[i]);
+      crank_assert_cmpfloat (z[i], ==, rz[i]);
+    }
+}
+
+
 
 static void
 test_n_equal (void)
@@ -862,6 +1043,76 @@ test_n_inverse (void)
   crank_mat_float_n_fini (&r);
 }
 
+static void
+test_n_solve (void)
+{
+  CrankMatFloatN a;
+  CrankVecFloatN b;
+  CrankVecFloatN x;
+
+  // First pivot is 0, so this requires pivoting.
+  crank_mat_float_n_init (&a, 3, 3,
+                          0.0f, 2.0f, 1.0f,
+                          1.0f, 1.0f, 1.0f,
+                          2.0f, 1.0f, 3.0f);
+
+  crank_vec_float_n_init (&b, 3, 7.0f, 6.0f, 13.0f);
+
+  g_assert (crank_mat_float_n_solve (&a, &b, &x));
+
+  crank_assert_eq_vecfloat_n_imm (&x, 1.0f, 2.0f, 3.0f);
+
+  crank_vec_float_n_fini (&x);
+  crank_vec_float_n_fini (&b);
+  crank_mat_float_n_fini (&a);
+
+  // Singular matrix.
+  crank_mat_float_n_init (&a, 2, 2,
+                          1.0f, 2.0f,
+                          2.0f, 4.0f);
+
+  crank_vec_float_n_init (&b, 2, 1.0f, 2.0f);
+
+  g_assert (! crank_mat_float_n_solve (&a, &b, &x));
+
+  crank_vec_float_n_fini (&b);
+  crank_mat_float_n_fini (&a);
+}
+
+static void
+test_n_solve_multi (void)
+{
+  CrankMatFloatN a;
+  CrankMatFloatN b;
+  CrankMatFloatN x;
+
+  crank_mat_float_n_init (&a, 3, 3,
+                          0.0f, 2.0f, 1.0f,
+                          1.0f, 1.0f, 1.0f,
+                          2.0f, 1.0f, 3.0f);
+
+  crank_mat_float_n_init (&b, 3, 2,
+                          7.0f,  3.0f,
+                          6.0f,  3.0f,
+                          13.0f, 6.0f);
+
+  g_assert (crank_mat_float_n_solve_multi (&a, &b, &x));
+
+  g_assert_cmpuint (x.rn, ==, 3);
+  g_assert_cmpuint (x.cn, ==, 2);
+
+  test_assert_float (crank_mat_float_n_get (&x, 0, 0), 1.0f);
+  test_assert_float (crank_mat_float_n_get (&x, 1, 0), 2.0f);
+  test_assert_float (crank_mat_float_n_get (&x, 2, 0), 3.0f);
+  test_assert_float (crank_mat_float_n_get (&x, 0, 1), 1.0f);
+  test_assert_float (crank_mat_float_n_get (&x, 1, 1), 1.0f);
+  test_assert_float (crank_mat_float_n_get (&x, 2, 1), 1.0f);
+
+  crank_mat_float_n_fini (&x);
+  crank_mat_float_n_fini (&b);
+  crank_mat_float_n_fini (&a);
+}
+
 static void
 test_n_muls (void)
 {
@@ -1018,6 +1269,315 @@ test_n_mul (void)
   crank_mat_float_n_fini (&r);
 }
 
+static void
+test_n_mul_large (void)
+{
+  CrankMatFloatN a = {0};
+  CrankMatFloatN b = {0};
+  CrankMatFloatN r;
+
+  guint i;
+  guint j;
+  guint k;
+
+  // Odd sizes, so that edge tiles of blocked kernel are checked.
+  crank_mat_float_n_init_fill (&a, 67, 45, 0.0f);
+  crank_mat_float_n_init_fill (&b, 45, 71, 0.0f);
+
+  for (i = 0; i < a.rn * a.cn; i++)
+    a.data[i] = (gfloat)((i * 7) % 13) * 0.25f - 1.5f;
+
+  for (i = 0; i < b.rn * b.cn; i++)
+    b.data[i] = (gfloat)((i * 5) % 11) * 0.25f - 1.25f;
+
+  crank_mat_float_n_mul (&a, &b, &r);
+
+  g_assert_cmpuint (r.rn, ==, 67);
+  g_assert_cmpuint (r.cn, ==, 71);
+
+  for (i = 0; i < r.rn; i++)
+    {
+      for (j = 0; j < r.cn; j++)
+        {
+          gfloat sum = 0.0f;
+
+          for (k = 0; k < a.cn; k++)
+            sum += crank_mat_float_n_get (&a, i, k) *
+                   crank_mat_float_n_get (&b, k, j);
+
+          test_assert_float (crank_mat_float_n_get (&r, i, j), sum);
+        }
+    }
+
+  crank_mat_float_n_fini (&a);
+  crank_mat_float_n_fini (&b);
+  crank_mat_float_n_fini (&r);
+}
+
+static void
+test_n_mul_blocked (void)
+{
+  CrankMatFloatN a = {0};
+  CrankMatFloatN b = {0};
+  CrankMatFloatN r;
+
+  guint i;
+  guint j;
+  guint k;
+
+  // Larger than a block of a (128 x 256), and not multiple of it, so that
+  // edge blocks and accumulation over panels are checked. Elements are small
+  // multiples of 0.25, so that sums are exact in any order.
+  crank_mat_float_n_init_fill (&a, 301, 263, 0.0f);
+  crank_mat_float_n_init_fill (&b, 263, 150, 0.0f);
+
+  for (i = 0; i < a.rn * a.cn; i++)
+    a.data[i] = (gfloat)((i * 7) % 13) * 0.25f - 1.5f;
+
+  for (i = 0; i < b.rn * b.cn; i++)
+    b.data[i] = (gfloat)((i * 5) % 11) * 0.25f - 1.25f;
+
+  crank_mat_float_n_mul (&a, &b, &r);
+
+  g_assert_cmpuint (r.rn, ==, 301);
+  g_assert_cmpuint (r.cn, ==, 150);
+
+  for (i = 0; i < r.rn; i++)
+    {
+      for (j = 0; j < r.cn; j++)
+        {
+          gfloat sum = 0.0f;
+
+          for (k = 0; k < a.cn; k++)
+            sum += crank_mat_float_n_get (&a, i, k) *
+                   crank_mat_float_n_get (&b, k, j);
+
+          g_assert_cmpfloat (crank_mat_float_n_get (&r, i, j), ==, sum);
+        }
+    }
+
+  crank_mat_float_n_fini (&a);
+  crank_mat_float_n_fini (&b);
+  crank_mat_float_n_fini (&r);
+}
+
+static void
+test_n_mul_parallel (void)
+{
+  CrankMatFloatN a = {0};
+  CrankMatFloatN b = {0};
+  CrankMatFloatN r;
+  CrankMatFloatN rp;
+
+  guint i;
+
+  crank_mat_float_n_init_fill (&a, 67, 45, 0.0f);
+  crank_mat_float_n_init_fill (&b, 45, 71, 0.0f);
+
+  for (i = 0; i < a.rn * a.cn; i++)
+    a.data[i] = (gfloat)((i * 7) % 13) * 0.25f - 1.5f;
+
+  for (i = 0; i < b.rn * b.cn; i++)
+    b.data[i] = (gfloat)((i * 5) % 11) * 0.25f - 1.25f;
+
+  crank_mat_float_n_mul_parallel (&a, &b, &r, 1);
+  crank_mat_float_n_mul_parallel (&a, &b, &rp, 4);
+
+  g_assert_cmpuint (rp.rn, ==, r.rn);
+  g_assert_cmpuint (rp.cn, ==, r.cn);
+
+  for (i = 0; i < r.rn * r.cn; i++)
+    test_assert_float (rp.data[i], r.data[i]);
+
+  crank_mat_float_n_fini (&a);
+  crank_mat_float_n_fini (&b);
+  crank_mat_float_n_fini (&r);
+  crank_mat_float_n_fini (&rp);
+}
+
+static void
+test_n_inverse_parallel (void)
+{
+  CrankMatFloatN a = {0};
+  CrankMatFloatN ainv;
+  CrankMatFloatN r;
+
+  guint i;
+  guint j;
+
+  // Diagonally dominant matrix, which is large enough to be run in parallel.
+  crank_mat_float_n_init_fill (&a, 100, 100, 0.0f);
+
+  for (i = 0; i < a.rn; i++)
+    {
+      for (j = 0; j < a.cn; j++)
+        crank_mat_float_n_set (&a, i, j, (gfloat)((i * 3 + j * 7) % 5) * 0.1f);
+
+      crank_mat_float_n_set (&a, i, i, 50.0f);
+    }
+
+  crank_mat_float_n_inverse_parallel (&a, &ainv, 4);
+  crank_mat_float_n_mul (&a, &ainv, &r);
+
+  for (i = 0; i < r.rn; i++)
+    for (j = 0; j < r.cn; j++)
+      test_assert_float (crank_mat_float_n_get (&r, i, j), (i == j) ? 1 : 0);
+
+  crank_mat_float_n_fini (&a);
+  crank_mat_float_n_fini (&ainv);
+  crank_mat_float_n_fini (&r);
+}
+
+static void
+test_n_transpose_self (void)
+{
+  CrankMatFloatN a = {0};
+  CrankMatFloatN r;
+
+  guint i;
+  guint sizes[][2] = {{7, 7}, {5, 9}, {9, 5}, {1, 6}, {13, 64}};
+
+  for (i = 0; i < G_N_ELEMENTS (sizes); i++)
+    {
+      guint j;
+
+      crank_mat_float_n_init_fill (&a, sizes[i][0], sizes[i][1], 0.0f);
+
+      for (j = 0; j < a.rn * a.cn; j++)
+        a.data[j] = (gfloat) j;
+
+      crank_mat_float_n_transpose (&a, &r);
+      crank_mat_float_n_transpose_self (&a);
+
+      g_assert (crank_mat_float_n_equal (&a, &r));
+
+      crank_mat_float_n_fini (&a);
+      crank_mat_float_n_fini (&r);
+    }
+}
+
+static void
+test_n_inverse_self (void)
+{
+  CrankMatFloatN a = {0};
+  CrankMatFloatN ainv;
+  CrankMatFloatN r;
+
+  guint i;
+  guint j;
+
+  // Needs pivoting, as first diagonal component is 0.
+  crank_mat_float_n_init (&a, 3, 3,
+                          0.0f, 4.0f, 3.0f,
+                          3.0f, 6.0f, 6.0f,
+                          2.0f, 20.0f, 8.0f);
+
+  crank_mat_float_n_inverse (&a, &r);
+  g_assert (crank_mat_float_n_try_inverse_self (&a));
+
+  for (i = 0; i < 9; i++)
+    test_assert_float (a.data[i], r.data[i]);
+
+  crank_mat_float_n_fini (&a);
+  crank_mat_float_n_fini (&r);
+
+  // Singular matrix should be left unchanged.
+  crank_mat_float_n_init (&a, 3, 3,
+                          1.0f, 2.0f, 3.0f,
+                          2.0f, 4.0f, 6.0f,
+                          1.0f, 5.0f, 2.0f);
+
+  crank_mat_float_n_copy (&a, &r);
+  g_assert (! crank_mat_float_n_try_inverse_self (&a));
+
+  for (i = 0; i < 9; i++)
+    test_assert_float (a.data[i], r.data[i]);
+
+  crank_mat_float_n_fini (&a);
+  crank_mat_float_n_fini (&r);
+
+  crank_mat_float_n_init_fill (&a, 40, 40, 0.0f);
+
+  for (i = 0; i < a.rn; i++)
+    {
+      for (j = 0; j < a.cn; j++)
+        crank_mat_float_n_set (&a, i, j, (gfloat)((i * 3 + j * 7) % 5) * 0.1f);
+
+      crank_mat_float_n_set (&a, i, (i * 7) % a.rn, 20.0f);
+    }
+
+  crank_mat_float_n_copy (&a, &ainv);
+  crank_mat_float_n_inverse_self (&ainv);
+  crank_mat_float_n_mul (&a, &ainv, &r);
+
+  for (i = 0; i < r.rn; i++)
+    for (j = 0; j < r.cn; j++)
+      test_assert_float (crank_mat_float_n_get (&r, i, j), (i == j) ? 1 : 0);
+
+  crank_mat_float_n_fini (&a);
+  crank_mat_float_n_fini (&ainv);
+  crank_mat_float_n_fini (&r);
+}
+
+static void
+test_n_mul_self (void)
+{
+  CrankMatFloatN a = {0};
+  CrankMatFloatN b = {0};
+  CrankMatFloatN r;
+
+  guint i;
+  guint j;
+  guint sizes[][3] = {{2, 3, 4}, {4, 3, 2}, {67, 45, 71}, {150, 71, 45}};
+
+  // Result may be wider or narrower than a, with small and blocked kernel.
+  for (i = 0; i < G_N_ELEMENTS (sizes); i++)
+    {
+      crank_mat_float_n_init_fill (&a, sizes[i][0], sizes[i][1], 0.0f);
+      crank_mat_float_n_init_fill (&b, sizes[i][1], sizes[i][2], 0.0f);
+
+      for (j = 0; j < a.rn * a.cn; j++)
+        a.data[j] = (gfloat)((j * 7) % 13) * 0.25f - 1.5f;
+
+      for (j = 0; j < b.rn * b.cn; j++)
+        b.data[j] = (gfloat)((j * 5) % 11) * 0.25f - 1.25f;
+
+      crank_mat_float_n_mul (&a, &b, &r);
+      crank_mat_float_n_mul_self (&a, &b);
+
+      g_assert_cmpuint (a.rn, ==, r.rn);
+      g_assert_cmpuint (a.cn, ==, r.cn);
+
+      for (j = 0; j < r.rn * r.cn; j++)
+        test_assert_float (a.data[j], r.data[j]);
+
+      crank_mat_float_n_fini (&a);
+      crank_mat_float_n_fini (&b);
+      crank_mat_float_n_fini (&r);
+    }
+
+  // Squaring, with small and blocked kernel.
+  for (i = 3; i < 100; i += 64)
+    {
+      crank_mat_float_n_init_fill (&a, i, i, 0.0f);
+
+      for (j = 0; j < a.rn * a.cn; j++)
+        a.data[j] = (gfloat)((j * 7) % 13) * 0.25f - 1.5f;
+
+      crank_mat_float_n_mul (&a, &a, &r);
+      crank_mat_float_n_mul_self (&a, &a);
+
+      g_assert_cmpuint (a.rn, ==, r.rn);
+      g_assert_cmpuint (a.cn, ==, r.cn);
+
+      for (j = 0; j < r.rn * r.cn; j++)
+        test_assert_float (a.data[j], r.data[j]);
+
+      crank_mat_float_n_fini (&a);
+      crank_mat_float_n_fini (&r);
+    }
+}
+
 static void
 test_n_mixs (void)
 {
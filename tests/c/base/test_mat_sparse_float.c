@@ -0,0 +1,489 @@
+/* Copyright (C) 2015, WSID   */
+
+/* Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+#include <math.h>
+
+#include <glib.h>
+
+#include "crankbase.h"
+
+//////// Declaration ///////////////////////////////////////////////////////////
+
+static void test_init_triplets (void);
+
+static void test_init_dense (void);
+
+static void test_get_diag (void);
+
+static void test_transpose (void);
+
+static void test_mulv (void);
+
+static void test_solve_cg (void);
+
+static void test_solve_cg_jacobi (void);
+
+static void test_solve_cg_ilu0 (void);
+
+static void test_solve_bicgstab (void);
+
+static void test_solve_bicgstab_ilu0 (void);
+
+static void test_solve_true_residual (void);
+
+
+static void test_gen_grid (CrankMatSparseFloat *a,
+                           const guint          g,
+                           const gfloat         skew);
+
+static void test_gen_tridiag (CrankMatSparseFloat *a,
+                              const guint          n,
+                              const gfloat         lower,
+                              const gfloat         diag,
+                              const gfloat         upper);
+
+static void test_check_solution (CrankMatSparseFloat *a,
+                                 CrankVecFloatN      *b,
+                                 CrankVecFloatN      *x,
+                                 const gfloat         tolerance);
+
+static void test_solve (const gboolean           bicgstab,
+                        const CrankSparsePrecond precond,
+                        const gfloat             skew);
+
+//////// Main //////////////////////////////////////////////////////////////////
+
+gint
+main (gint   argc,
+      gchar *argv[])
+{
+  g_test_init (&argc, &argv, NULL);
+
+  g_test_add_func ("/crank/base/mat/sparse/float/init/triplets",
+                   test_init_triplets);
+
+  g_test_add_func ("/crank/base/mat/sparse/float/init/dense", test_init_dense);
+
+  g_test_add_func ("/crank/base/mat/sparse/float/get_diag", test_get_diag);
+
+  g_test_add_func ("/crank/base/mat/sparse/float/transpose", test_transpose);
+
+  g_test_add_func ("/crank/base/mat/sparse/float/mulv", test_mulv);
+
+  g_test_add_func ("/crank/base/mat/sparse/float/solve/cg", test_solve_cg);
+
+  g_test_add_func ("/crank/base/mat/sparse/float/solve/cg/jacobi",
+                   test_solve_cg_jacobi);
+
+  g_test_add_func ("/crank/base/mat/sparse/float/solve/cg/ilu0",
+                   test_solve_cg_ilu0);
+
+  g_test_add_func ("/crank/base/mat/sparse/float/solve/bicgstab",
+                   test_solve_bicgstab);
+
+  g_test_add_func ("/crank/base/mat/sparse/float/solve/bicgstab/ilu0",
+                   test_solve_bicgstab_ilu0);
+
+  g_test_add_func ("/crank/base/mat/sparse/float/solve/true_residual",
+                   test_solve_true_residual);
+
+  g_test_run ();
+  return 0;
+}
+
+//////// Test Functions ////////////////////////////////////////////////////////
+
+static void
+test_init_triplets (void)
+{
+  CrankMatSparseFloat a;
+  guint rows[] = {2, 0, 1, 0, 2, 0};
+  guint cols[] = {1, 2, 1, 0, 1, 2};
+  gfloat values[] = {1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f};
+
+  crank_mat_sparse_float_init_triplets (&a, 3, 4, 6, rows, cols, values);
+
+  g_assert_cmpuint (crank_mat_sparse_float_get_row_size (&a), ==, 3);
+  g_assert_cmpuint (crank_mat_sparse_float_get_col_size (&a), ==, 4);
+
+  // Duplicates (0, 2) and (2, 1) are merged.
+  g_assert_cmpuint (crank_mat_sparse_float_get_nnz (&a), ==, 4);
+
+  g_assert_cmpuint (a.row_ptr[0], ==, 0);
+  g_assert_cmpuint (a.row_ptr[1], ==, 2);
+  g_assert_cmpuint (a.row_ptr[2], ==, 3);
+  g_assert_cmpuint (a.row_ptr[3], ==, 4);
+
+  g_assert_cmpuint (a.col_index[0], ==, 0);
+  g_assert_cmpuint (a.col_index[1], ==, 2);
+
+  crank_assert_cmpfloat (crank_mat_sparse_float_get (&a, 0, 0), ==, 4.0f);
+  crank_assert_cmpfloat (crank_mat_sparse_float_get (&a, 0, 1), ==, 0.0f);
+  crank_assert_cmpfloat (crank_mat_sparse_float_get (&a, 0, 2), ==, 8.0f);
+  crank_assert_cmpfloat (crank_mat_sparse_float_get (&a, 1, 1), ==, 3.0f);
+  crank_assert_cmpfloat (crank_mat_sparse_float_get (&a, 2, 1), ==, 6.0f);
+  crank_assert_cmpfloat (crank_mat_sparse_float_get (&a, 2, 3), ==, 0.0f);
+
+  crank_mat_sparse_float_fini (&a);
+}
+
+static void
+test_init_dense (void)
+{
+  CrankMatFloatN d;
+  CrankMatFloatN r;
+  CrankMatSparseFloat a;
+
+  crank_mat_float_n_init (&d, 3, 3,
+                          1.0f, 0.0f, 2.0f,
+                          0.0f, 0.0f, 0.0f,
+                          0.0f, 3.0f, 4.0f);
+
+  crank_mat_sparse_float_init_dense (&a, &d);
+
+  g_assert_cmpuint (crank_mat_sparse_float_get_nnz (&a), ==, 4);
+  g_assert_cmpuint (a.row_ptr[1], ==, 2);
+  g_assert_cmpuint (a.row_ptr[2], ==, 2);
+
+  crank_mat_sparse_float_to_dense (&a, &r);
+  g_assert (crank_mat_float_n_equal (&d, &r));
+
+  crank_mat_float_n_fini (&d);
+  crank_mat_float_n_fini (&r);
+  crank_mat_sparse_float_fini (&a);
+}
+
+static void
+test_get_diag (void)
+{
+  CrankMatFloatN d;
+  CrankMatSparseFloat a;
+  CrankVecFloatN r;
+
+  crank_mat_float_n_init (&d, 3, 3,
+                          1.0f, 0.0f, 2.0f,
+                          5.0f, 0.0f, 0.0f,
+                          0.0f, 3.0f, 4.0f);
+
+  crank_mat_sparse_float_init_dense (&a, &d);
+  crank_mat_sparse_float_get_diag (&a, &r);
+
+  crank_assert_eq_vecfloat_n_imm (&r, 1.0f, 0.0f, 4.0f);
+
+  crank_vec_float_n_fini (&r);
+  crank_mat_float_n_fini (&d);
+  crank_mat_sparse_float_fini (&a);
+}
+
+static void
+test_transpose (void)
+{
+  CrankMatFloatN d;
+  CrankMatFloatN dt;
+  CrankMatFloatN r;
+  CrankMatSparseFloat a;
+  CrankMatSparseFloat at;
+
+  crank_mat_float_n_init (&d, 2, 3,
+                          1.0f, 0.0f, 2.0f,
+                          0.0f, 3.0f, 4.0f);
+
+  crank_mat_sparse_float_init_dense (&a, &d);
+  crank_mat_sparse_float_transpose (&a, &at);
+
+  g_assert_cmpuint (crank_mat_sparse_float_get_row_size (&at), ==, 3);
+  g_assert_cmpuint (crank_mat_sparse_float_get_col_size (&at), ==, 2);
+
+  crank_mat_sparse_float_to_dense (&at, &r);
+  crank_mat_float_n_transpose (&d, &dt);
+  g_assert (crank_mat_float_n_equal (&dt, &r));
+
+  crank_mat_float_n_fini (&d);
+  crank_mat_float_n_fini (&dt);
+  crank_mat_float_n_fini (&r);
+  crank_mat_sparse_float_fini (&a);
+  crank_mat_sparse_float_fini (&at);
+}
+
+static void
+test_mulv (void)
+{
+  CrankMatSparseFloat a;
+  CrankMatFloatN d;
+  CrankVecFloatN b;
+  CrankVecFloatN r;
+  CrankVecFloatN rd;
+
+  guint n = 300;
+  guint i;
+
+  // Rows has various lengths, to exercise both of vector and remaining parts.
+  test_gen_grid (&a, 17, 0.25f);
+  crank_mat_sparse_float_to_dense (&a, &d);
+
+  crank_vec_float_n_init_fill (&b, a.cn, 0.0f);
+  for (i = 0; i < a.cn; i++)
+    b.data[i] = (gfloat)(i % 13) * 0.5f - 3.0f;
+
+  crank_mat_sparse_float_mulv (&a, &b, &r);
+  crank_mat_float_n_mulv (&d, &b, &rd);
+
+  g_assert_cmpuint (r.n, ==, rd.n);
+  for (i = 0; i < r.n; i++)
+    crank_assert_eqfloat (r.data[i], rd.data[i], 0.0001f);
+
+  crank_vec_float_n_fini (&r);
+  crank_vec_float_n_fini (&rd);
+  crank_vec_float_n_fini (&b);
+  crank_mat_float_n_fini (&d);
+  crank_mat_sparse_float_fini (&a);
+
+  // Long rows.
+  crank_mat_float_n_init_fill (&d, 7, n, 0.0f);
+  for (i = 0; i < 7 * n; i++)
+    if (i % 3 != 0)
+      d.data[i] = (gfloat)(i % 5) - 2.0f;
+
+  crank_mat_sparse_float_init_dense (&a, &d);
+
+  crank_vec_float_n_init_fill (&b, n, 0.0f);
+  for (i = 0; i < n; i++)
+    b.data[i] = (gfloat)(i % 7) * 0.25f;
+
+  crank_mat_sparse_float_mulv_parallel (&a, &b, &r, 2);
+  crank_mat_float_n_mulv (&d, &b, &rd);
+
+  for (i = 0; i < r.n; i++)
+    crank_assert_eqfloat (r.data[i], rd.data[i], 0.001f);
+
+  crank_vec_float_n_fini (&r);
+  crank_vec_float_n_fini (&rd);
+  crank_vec_float_n_fini (&b);
+  crank_mat_float_n_fini (&d);
+  crank_mat_sparse_float_fini (&a);
+}
+
+static void
+test_solve_cg (void)
+{
+  test_solve (FALSE, CRANK_SPARSE_PRECOND_NONE, 0.0f);
+}
+
+static void
+test_solve_cg_jacobi (void)
+{
+  test_solve (FALSE, CRANK_SPARSE_PRECOND_JACOBI, 0.0f);
+}
+
+static void
+test_solve_cg_ilu0 (void)
+{
+  test_solve (FALSE, CRANK_SPARSE_PRECOND_ILU0, 0.0f);
+}
+
+static void
+test_solve_bicgstab (void)
+{
+  test_solve (TRUE, CRANK_SPARSE_PRECOND_NONE, 0.5f);
+}
+
+static void
+test_solve_bicgstab_ilu0 (void)
+{
+  test_solve (TRUE, CRANK_SPARSE_PRECOND_ILU0, 0.5f);
+}
+
+// Recurred residual of these drifts away from b - A x in single precision.
+static void
+test_solve_true_residual (void)
+{
+  CrankMatSparseFloat a;
+  CrankVecFloatN b;
+  CrankVecFloatN x;
+  guint iterations;
+  guint i;
+
+  test_gen_tridiag (&a, 200, -1.3f, 2.01f, -0.7f);
+  crank_vec_float_n_init_fill (&b, a.rn, 1.0f);
+
+  g_assert (crank_mat_sparse_float_solve_bicgstab (&a, &b, &x,
+                                                   CRANK_SPARSE_PRECOND_JACOBI,
+                                                   1e-4f, 1000, &iterations));
+  test_check_solution (&a, &b, &x, 1e-4f);
+
+  crank_vec_float_n_fini (&b);
+  crank_vec_float_n_fini (&x);
+  crank_mat_sparse_float_fini (&a);
+
+  test_gen_tridiag (&a, 400, -1.0f, 2.0f, -1.0f);
+  crank_vec_float_n_init_fill (&b, a.rn, 0.0f);
+  for (i = 0; i < b.n; i++)
+    b.data[i] = (gfloat)(i % 9) - 4.0f;
+
+  g_assert (crank_mat_sparse_float_solve_cg (&a, &b, &x,
+                                             CRANK_SPARSE_PRECOND_NONE,
+                                             1e-4f, 1000, &iterations));
+  test_check_solution (&a, &b, &x, 1e-4f);
+
+  crank_vec_float_n_fini (&b);
+  crank_vec_float_n_fini (&x);
+  crank_mat_sparse_float_fini (&a);
+}
+
+
+//////// Helper Functions //////////////////////////////////////////////////////
+
+/*
+ * Generates 5-point laplacian on g x g grid. Skew makes it non-symmetric, by
+ * adding convection term.
+ */
+static void
+test_gen_grid (CrankMatSparseFloat *a,
+               const guint          g,
+               const gfloat         skew)
+{
+  guint n = g * g;
+  guint *rows = g_new (guint, 5 * n);
+  guint *cols = g_new (guint, 5 * n);
+  gfloat *values = g_new (gfloat, 5 * n);
+  guint c = 0;
+  guint x;
+  guint y;
+
+  for (y = 0; y < g; y++)
+    {
+      for (x = 0; x < g; x++)
+        {
+          guint i = y * g + x;
+
+          rows[c] = i; cols[c] = i; values[c] = 4.0f; c++;
+
+          if (0 < x)
+            { rows[c] = i; cols[c] = i - 1; values[c] = -1.0f - skew; c++; }
+
+          if (x + 1 < g)
+            { rows[c] = i; cols[c] = i + 1; values[c] = -1.0f + skew; c++; }
+
+          if (0 < y)
+            { rows[c] = i; cols[c] = i - g; values[c] = -1.0f; c++; }
+
+          if (y + 1 < g)
+            { rows[c] = i; cols[c] = i + g; values[c] = -1.0f; c++; }
+        }
+    }
+
+  crank_mat_sparse_float_init_triplets (a, n, n, c, rows, cols, values);
+
+  g_free (rows);
+  g_free (cols);
+  g_free (values);
+}
+
+/*
+ * Generates n x n tridiagonal matrix, with lower, diagonal and upper values.
+ */
+static void
+test_gen_tridiag (CrankMatSparseFloat *a,
+                  const guint          n,
+                  const gfloat         lower,
+                  const gfloat         diag,
+                  const gfloat         upper)
+{
+  guint *rows = g_new (guint, 3 * n);
+  guint *cols = g_new (guint, 3 * n);
+  gfloat *values = g_new (gfloat, 3 * n);
+  guint c = 0;
+  guint i;
+
+  for (i = 0; i < n; i++)
+    {
+      rows[c] = i; cols[c] = i; values[c] = diag; c++;
+
+      if (0 < i)
+        { rows[c] = i; cols[c] = i - 1; values[c] = lower; c++; }
+
+      if (i + 1 < n)
+        { rows[c] = i; cols[c] = i + 1; values[c] = upper; c++; }
+    }
+
+  crank_mat_sparse_float_init_triplets (a, n, n, c, rows, cols, values);
+
+  g_free (rows);
+  g_free (cols);
+  g_free (values);
+}
+
+static void
+test_check_solution (CrankMatSparseFloat *a,
+                     CrankVecFloatN      *b,
+                     CrankVecFloatN      *x,
+                     const gfloat         tolerance)
+{
+  CrankVecFloatN ax;
+  gfloat rr = 0.0f;
+  gfloat bb = 0.0f;
+  guint i;
+
+  crank_mat_sparse_float_mulv (a, x, &ax);
+
+  for (i = 0; i < b->n; i++)
+    {
+      gfloat d = ax.data[i] - b->data[i];
+      rr += d * d;
+      bb += b->data[i] * b->data[i];
+    }
+
+  g_assert_cmpfloat (sqrtf (rr), <=, tolerance * sqrtf (bb));
+
+  crank_vec_float_n_fini (&ax);
+}
+
+static void
+test_solve (const gboolean           bicgstab,
+            const CrankSparsePrecond precond,
+            const gfloat             skew)
+{
+  CrankMatSparseFloat a;
+  CrankVecFloatN b;
+  CrankVecFloatN x;
+  guint iterations;
+  guint i;
+
+  test_gen_grid (&a, 20, skew);
+
+  crank_vec_float_n_init_fill (&b, a.rn, 0.0f);
+  for (i = 0; i < b.n; i++)
+    b.data[i] = (gfloat)(i % 9) - 4.0f;
+
+  if (bicgstab)
+    g_assert (crank_mat_sparse_float_solve_bicgstab (&a, &b, &x, precond,
+                                                     1e-4f, 1000,
+                                                     &iterations));
+  else
+    g_assert (crank_mat_sparse_float_solve_cg (&a, &b, &x, precond,
+                                               1e-4f, 1000, &iterations));
+
+  g_assert_cmpuint (iterations, <=, 1000);
+  test_check_solution (&a, &b, &x, 2e-4f);
+
+  crank_vec_float_n_fini (&b);
+  crank_vec_float_n_fini (&x);
+  crank_mat_sparse_float_fini (&a);
+}
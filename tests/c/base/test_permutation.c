@@ -368,6 +368,14 @@ test_inversion (void)
   g_assert_cmpuint (crank_permutation_get_inversion (&p), ==, 5);
 
   crank_permutation_fini (&p);
+
+  // Count of ascending pairs differs from count of inversions.
+  crank_permutation_init (&p, 4, 1, 0, 2, 3);
+
+  g_assert_cmpuint (crank_permutation_get_inversion (&p), ==, 1);
+  g_assert_cmpint (crank_permutation_get_sign (&p), ==, -1);
+
+  crank_permutation_fini (&p);
 }
 
 
@@ -77,8 +77,35 @@ static void test_exp (void);
 
 static void test_powr (void);
 
+static void test_ln_fast (void);
+
+static void test_exp_fast (void);
+
 static void test_rotatev (void);
 
+static void test_batch_mul (void);
+
+static void test_batch_nlerp (void);
+
+static void test_batch_slerp (void);
+
+static void test_batch_rotatev (void);
+
+static void test_batch_rotatev_each (void);
+
+static void test_batch_to_mat (void);
+
+static void test_batch_exp_ln (void);
+
+//////// Test Helpers //////////////////////////////////////////////////////////
+
+static void test_batch_init (CrankQuatFloat *a,
+                             CrankQuatFloat *b,
+                             CrankVecFloat3 *v);
+
+static gfloat test_batch_dot (CrankQuatFloat *a,
+                              CrankQuatFloat *b);
+
 //////// Main //////////////////////////////////////////////////////////////////
 
 gint
@@ -113,7 +140,20 @@ main (gint   argc,
   g_test_add_func ("/crank/base/quat/float/ln",           test_ln);
   g_test_add_func ("/crank/base/quat/float/exp",          test_exp);
   g_test_add_func ("/crank/base/quat/float/powr",         test_powr);
+  g_test_add_func ("/crank/base/quat/float/ln/fast",      test_ln_fast);
+  g_test_add_func ("/crank/base/quat/float/exp/fast",     test_exp_fast);
   g_test_add_func ("/crank/base/quat/float/rotatev",      test_rotatev);
+  g_test_add_func ("/crank/base/quat/float/batch/mul",    test_batch_mul);
+  g_test_add_func ("/crank/base/quat/float/batch/nlerp",  test_batch_nlerp);
+  g_test_add_func ("/crank/base/quat/float/batch/slerp",  test_batch_slerp);
+  g_test_add_func ("/crank/base/quat/float/batch/rotatev",
+                   test_batch_rotatev);
+  g_test_add_func ("/crank/base/quat/float/batch/rotatev_each",
+                   test_batch_rotatev_each);
+  g_test_add_func ("/crank/base/quat/float/batch/to_mat",
+                   test_batch_to_mat);
+  g_test_add_func ("/crank/base/quat/float/batch/exp_ln",
+                   test_batch_exp_ln);
 
   g_test_run ();
 
@@ -479,6 +519,34 @@ test_powr (void)
   crank_assert_cmpfloat_d (b.z, ==, -153.4986f, 0.0005f);
 }
 
+static void
+test_ln_fast (void)
+{
+  CrankQuatFloat a = {3.0f, 4.0f, 5.0f, 12.0f};
+  CrankQuatFloat b;
+
+  crank_quat_float_ln_fast (&a, &b);
+
+  crank_assert_cmpfloat (b.w, ==, 2.6339f);
+  crank_assert_cmpfloat (b.x, ==, 0.3981f);
+  crank_assert_cmpfloat (b.y, ==, 0.4976f);
+  crank_assert_cmpfloat (b.z, ==, 1.1943f);
+}
+
+static void
+test_exp_fast (void)
+{
+  CrankQuatFloat a = {3.0f, 4.0f, 5.0f, 12.0f};
+  CrankQuatFloat b;
+
+  crank_quat_float_exp_fast (&a, &b);
+
+  crank_assert_cmpfloat (b.w, ==, 10.2525f);
+  crank_assert_cmpfloat (b.x, ==, 5.0794f);
+  crank_assert_cmpfloat (b.y, ==, 6.3492f);
+  crank_assert_cmpfloat_d (b.z, ==, 15.2382f, 0.0002f);
+}
+
 static void
 test_rotatev (void)
 {
@@ -488,4 +556,232 @@ test_rotatev (void)
 
   crank_quat_float_rotatev (&quat, &vec, &rvec);
   crank_assert_eq_vecfloat3_imm (&rvec, 3.0264f, 1.0285f, 1.9455f);
-}
\ No newline at end of file
+}
+
+static void
+test_batch_mul (void)
+{
+  CrankQuatFloat a[37];
+  CrankQuatFloat b[37];
+  CrankQuatFloat r[37];
+  CrankQuatFloat e;
+  guint i;
+
+  test_batch_init (a, b, NULL);
+
+  crank_quat_float_batch_mul (37, a, b, r);
+
+  for (i = 0; i < 37; i++)
+    {
+      crank_quat_float_mul (a + i, b + i, &e);
+      g_assert (crank_quat_float_equal_delta (r + i, &e, 0.0001f));
+    }
+}
+
+static void
+test_batch_nlerp (void)
+{
+  CrankQuatFloat a[37];
+  CrankQuatFloat b[37];
+  CrankQuatFloat r[37];
+  CrankQuatFloat e;
+  gfloat c[37];
+  guint i;
+
+  test_batch_init (a, b, NULL);
+
+  for (i = 0; i < 37; i++)
+    c[i] = i / 36.0f;
+
+  crank_quat_float_batch_nlerp (37, a, b, c, r);
+
+  for (i = 0; i < 37; i++)
+    {
+      CrankQuatFloat nb = b[i];
+
+      if (test_batch_dot (a + i, b + i) < 0)
+        crank_quat_float_neg_self (&nb);
+
+      crank_quat_float_mix (a + i, &nb, c[i], &e);
+      crank_quat_float_unit_self (&e);
+      g_assert (crank_quat_float_equal_delta (r + i, &e, 0.0001f));
+    }
+}
+
+static void
+test_batch_slerp (void)
+{
+  CrankQuatFloat a[37];
+  CrankQuatFloat b[37];
+  CrankQuatFloat r[37];
+  CrankQuatFloat e;
+  gfloat c[37];
+  guint i;
+
+  test_batch_init (a, b, NULL);
+
+  for (i = 0; i < 37; i++)
+    c[i] = i / 36.0f;
+
+  crank_quat_float_batch_slerp (37, a, b, c, r);
+
+  for (i = 0; i < 37; i++)
+    {
+      gfloat dot = test_batch_dot (a + i, b + i);
+      gfloat sign = (dot < 0) ? -1.0f : 1.0f;
+      gfloat angle = acosf (MIN (ABS (dot), 1.0f));
+      gfloat ca;
+      gfloat cb;
+
+      // Exact spherical interpolation, by trigonometric functions.
+      if (angle < 0.0001f)
+        {
+          ca = 1 - c[i];
+          cb = c[i];
+        }
+      else
+        {
+          ca = sinf ((1 - c[i]) * angle) / sinf (angle);
+          cb = sinf (c[i] * angle) / sinf (angle);
+        }
+
+      e.w = a[i].w * ca + b[i].w * cb * sign;
+      e.x = a[i].x * ca + b[i].x * cb * sign;
+      e.y = a[i].y * ca + b[i].y * cb * sign;
+      e.z = a[i].z * ca + b[i].z * cb * sign;
+
+      g_assert (crank_quat_float_equal_delta (r + i, &e, 0.0001f));
+    }
+}
+
+static void
+test_batch_rotatev (void)
+{
+  CrankQuatFloat a[37];
+  CrankVecFloat3 v[37];
+  CrankVecFloat3 r[37];
+  CrankVecFloat3 e;
+  guint i;
+
+  test_batch_init (a, NULL, v);
+
+  crank_quat_float_batch_rotatev (37, a + 5, v, r);
+
+  for (i = 0; i < 37; i++)
+    {
+      crank_quat_float_rotatev (a + 5, v + i, &e);
+      crank_assert_eq_vecfloat3_imm (r + i, e.x, e.y, e.z);
+    }
+}
+
+static void
+test_batch_rotatev_each (void)
+{
+  CrankQuatFloat a[37];
+  CrankVecFloat3 v[37];
+  CrankVecFloat3 r[37];
+  CrankVecFloat3 e;
+  guint i;
+
+  test_batch_init (a, NULL, v);
+
+  crank_quat_float_batch_rotatev_each (37, a, v, r);
+
+  for (i = 0; i < 37; i++)
+    {
+      crank_quat_float_rotatev (a + i, v + i, &e);
+      crank_assert_eq_vecfloat3_imm (r + i, e.x, e.y, e.z);
+    }
+}
+
+static void
+test_batch_to_mat (void)
+{
+  CrankQuatFloat a[37];
+  CrankVecFloat3 v[37];
+  CrankMatFloat4 m[37];
+  CrankVecFloat4 v4;
+  CrankVecFloat4 r;
+  CrankVecFloat3 e;
+  guint i;
+
+  test_batch_init (a, NULL, v);
+
+  crank_quat_float_batch_to_mat_float4 (37, a, m);
+
+  for (i = 0; i < 37; i++)
+    {
+      crank_vec_float4_init (&v4, v[i].x, v[i].y, v[i].z, 1.0f);
+      crank_mat_float4_mulv (m + i, &v4, &r);
+      crank_quat_float_rotatev (a + i, v + i, &e);
+
+      crank_assert_eq_vecfloat3_imm ((CrankVecFloat3*) &r, e.x, e.y, e.z);
+      crank_assert_cmpfloat (r.w, ==, 1.0f);
+    }
+}
+
+static void
+test_batch_exp_ln (void)
+{
+  CrankQuatFloat a[37];
+  CrankQuatFloat r[37];
+  CrankQuatFloat e;
+  guint i;
+
+  test_batch_init (a, NULL, NULL);
+
+  for (i = 0; i < 37; i++)
+    crank_quat_float_mulr_self (a + i, 0.5f + i * 0.125f);
+
+  crank_quat_float_batch_exp_fast (37, a, r);
+  for (i = 0; i < 37; i++)
+    {
+      crank_quat_float_exp (a + i, &e);
+      g_assert (crank_quat_float_equal_delta (r + i, &e, 0.0001f));
+    }
+
+  crank_quat_float_batch_ln_fast (37, a, r);
+  for (i = 0; i < 37; i++)
+    {
+      crank_quat_float_ln (a + i, &e);
+      g_assert (crank_quat_float_equal_delta (r + i, &e, 0.0001f));
+    }
+
+  // Results may overwrite inputs.
+  crank_quat_float_batch_ln (37, a, r);
+  crank_quat_float_batch_ln (37, a, a);
+  for (i = 0; i < 37; i++)
+    g_assert (crank_quat_float_equal (a + i, r + i));
+}
+
+//////// Test Helpers //////////////////////////////////////////////////////////
+
+static void
+test_batch_init (CrankQuatFloat *a,
+                 CrankQuatFloat *b,
+                 CrankVecFloat3 *v)
+{
+  guint i;
+
+  for (i = 0; i < 37; i++)
+    {
+      crank_quat_float_init (a + i, 1.0f, i * 0.25f, 3.0f - i * 0.5f, 0.5f);
+      crank_quat_float_unit_self (a + i);
+
+      if (b != NULL)
+        {
+          crank_quat_float_init (b + i, i * 0.125f - 2.0f, 0.5f, 1.0f, -1.5f);
+          crank_quat_float_unit_self (b + i);
+        }
+
+      if (v != NULL)
+        crank_vec_float3_init (v + i, i * 0.5f, 3.0f - i, 1.0f);
+    }
+}
+
+static gfloat
+test_batch_dot (CrankQuatFloat *a,
+                CrankQuatFloat *b)
+{
+  return a->w * b->w + a->x * b->x + a->y * b->y + a->z * b->z;
+}
@@ -55,6 +55,11 @@ static void     test_n_any (void);
 static void     test_n_all (void);
 static void     test_n_count (void);
 
+static void     test_packed_convert (void);
+static void     test_packed_logic (void);
+static void     test_packed_count (void);
+static void     test_packed_find (void);
+
 
 //////// Main //////////////////////////////////////////////////////////////////
 
@@ -92,6 +97,11 @@ main (gint    argc,
   g_test_add_func ("/crank/base/vec/bool/n/all", test_n_all);
   g_test_add_func ("/crank/base/vec/bool/n/count", test_n_count);
 
+  g_test_add_func ("/crank/base/vec/bool/packed/convert", test_packed_convert);
+  g_test_add_func ("/crank/base/vec/bool/packed/logic", test_packed_logic);
+  g_test_add_func ("/crank/base/vec/bool/packed/count", test_packed_count);
+  g_test_add_func ("/crank/base/vec/bool/packed/find", test_packed_find);
+
   g_test_run ();
   return 0;
 }
@@ -479,4 +489,213 @@ test_n_to_string (void)
   g_assert_cmpstr (astr, ==, "(false, false, false, true)");
 
   g_free (astr);
-}
\ No newline at end of file
+}
+
+static void
+test_packed_rand_vb (CrankVecBoolN *vb,
+                     const guint    n)
+{
+  guint i;
+
+  crank_vec_bool_n_init_fill (vb, n, FALSE);
+  for (i = 0; i < n; i++)
+    vb->data[i] = (g_test_rand_int () % 3) == 0;
+}
+
+static void
+test_packed_convert (void)
+{
+  guint sizes[] = {1, 63, 64, 65, 130, 1000003};
+  guint s;
+
+  for (s = 0; s < G_N_ELEMENTS (sizes); s++)
+    {
+      CrankVecBoolN a;
+      CrankVecBoolN b;
+      CrankVecBoolPacked p;
+      guint i;
+
+      test_packed_rand_vb (&a, sizes[s]);
+
+      crank_vec_bool_packed_init_from_vb (&p, &a);
+      g_assert_cmpuint (crank_vec_bool_packed_get_size (&p), ==, sizes[s]);
+
+      for (i = 0; i < sizes[s]; i++)
+        g_assert (crank_vec_bool_packed_get (&p, i) == a.data[i]);
+
+      crank_vec_bool_packed_to_vb (&p, &b);
+      g_assert (crank_vec_bool_n_equal (&a, &b));
+
+      crank_vec_bool_packed_set (&p, sizes[s] - 1, TRUE);
+      g_assert (crank_vec_bool_packed_get (&p, sizes[s] - 1));
+      crank_vec_bool_packed_set (&p, sizes[s] - 1, FALSE);
+      g_assert (! crank_vec_bool_packed_get (&p, sizes[s] - 1));
+
+      crank_vec_bool_n_fini (&a);
+      crank_vec_bool_n_fini (&b);
+      crank_vec_bool_packed_fini (&p);
+    }
+}
+
+static void
+test_packed_logic (void)
+{
+  guint sizes[] = {5, 130, 1000003};
+  guint s;
+
+  for (s = 0; s < G_N_ELEMENTS (sizes); s++)
+    {
+      CrankVecBoolN a;
+      CrankVecBoolN b;
+      CrankVecBoolN r;
+      CrankVecBoolN rp;
+      CrankVecBoolPacked pa;
+      CrankVecBoolPacked pb;
+      CrankVecBoolPacked pr;
+      guint i;
+
+      test_packed_rand_vb (&a, sizes[s]);
+      test_packed_rand_vb (&b, sizes[s]);
+      crank_vec_bool_packed_init_from_vb (&pa, &a);
+      crank_vec_bool_packed_init_from_vb (&pb, &b);
+
+      crank_vec_bool_n_and (&a, &b, &r);
+      crank_vec_bool_packed_and (&pa, &pb, &pr);
+      crank_vec_bool_packed_to_vb (&pr, &rp);
+      g_assert (crank_vec_bool_n_equal (&r, &rp));
+      crank_vec_bool_n_fini (&r);
+      crank_vec_bool_n_fini (&rp);
+      crank_vec_bool_packed_fini (&pr);
+
+      crank_vec_bool_n_or (&a, &b, &r);
+      crank_vec_bool_packed_or (&pa, &pb, &pr);
+      crank_vec_bool_packed_to_vb (&pr, &rp);
+      g_assert (crank_vec_bool_n_equal (&r, &rp));
+      crank_vec_bool_n_fini (&r);
+      crank_vec_bool_n_fini (&rp);
+      crank_vec_bool_packed_fini (&pr);
+
+      crank_vec_bool_n_xor (&a, &b, &r);
+      crank_vec_bool_packed_xor (&pa, &pb, &pr);
+      crank_vec_bool_packed_to_vb (&pr, &rp);
+      g_assert (crank_vec_bool_n_equal (&r, &rp));
+      crank_vec_bool_n_fini (&r);
+      crank_vec_bool_n_fini (&rp);
+      crank_vec_bool_packed_fini (&pr);
+
+      crank_vec_bool_packed_andnot (&pa, &pb, &pr);
+      crank_vec_bool_packed_to_vb (&pr, &rp);
+      for (i = 0; i < sizes[s]; i++)
+        g_assert (rp.data[i] == (a.data[i] && ! b.data[i]));
+      crank_vec_bool_n_fini (&rp);
+      crank_vec_bool_packed_fini (&pr);
+
+      // NOT should keep unused bits of last word cleared.
+      crank_vec_bool_n_not (&a, &r);
+      crank_vec_bool_packed_not (&pa, &pr);
+      crank_vec_bool_packed_to_vb (&pr, &rp);
+      g_assert (crank_vec_bool_n_equal (&r, &rp));
+      g_assert_cmpuint (crank_vec_bool_packed_get_count (&pr), ==,
+                        crank_vec_bool_n_get_count (&r));
+      crank_vec_bool_n_fini (&r);
+      crank_vec_bool_n_fini (&rp);
+      crank_vec_bool_packed_fini (&pr);
+
+      crank_vec_bool_packed_or_self (&pa, &pb);
+      crank_vec_bool_packed_not_self (&pb);
+      crank_vec_bool_packed_or_self (&pb, &pa);
+      g_assert (crank_vec_bool_packed_get_all (&pb));
+
+      crank_vec_bool_n_fini (&a);
+      crank_vec_bool_n_fini (&b);
+      crank_vec_bool_packed_fini (&pa);
+      crank_vec_bool_packed_fini (&pb);
+    }
+}
+
+static void
+test_packed_count (void)
+{
+  CrankVecBoolN a;
+  CrankVecBoolPacked p;
+
+  crank_vec_bool_packed_init_fill (&p, 130, TRUE);
+  g_assert (crank_vec_bool_packed_get_all (&p));
+  g_assert (crank_vec_bool_packed_get_any (&p));
+  g_assert_cmpuint (crank_vec_bool_packed_get_count (&p), ==, 130);
+
+  crank_vec_bool_packed_set (&p, 129, FALSE);
+  g_assert (! crank_vec_bool_packed_get_all (&p));
+  g_assert_cmpuint (crank_vec_bool_packed_get_count (&p), ==, 129);
+  crank_vec_bool_packed_fini (&p);
+
+  crank_vec_bool_packed_init_fill (&p, 130, FALSE);
+  g_assert (! crank_vec_bool_packed_get_any (&p));
+  g_assert_cmpuint (crank_vec_bool_packed_get_count (&p), ==, 0);
+  crank_vec_bool_packed_fini (&p);
+
+  test_packed_rand_vb (&a, 1000003);
+  crank_vec_bool_packed_init_from_vb (&p, &a);
+  g_assert_cmpuint (crank_vec_bool_packed_get_count (&p), ==,
+                    crank_vec_bool_n_get_count (&a));
+
+  crank_vec_bool_n_fini (&a);
+  crank_vec_bool_packed_fini (&p);
+}
+
+static void
+test_packed_find (void)
+{
+  CrankVecBoolN a;
+  CrankVecBoolPacked p;
+  guint *indices;
+  guint count;
+  guint i;
+  guint j;
+  gint index;
+
+  crank_vec_bool_packed_init_fill (&p, 200, FALSE);
+  g_assert_cmpint (crank_vec_bool_packed_find_first (&p), ==, -1);
+
+  crank_vec_bool_packed_set (&p, 3, TRUE);
+  crank_vec_bool_packed_set (&p, 64, TRUE);
+  crank_vec_bool_packed_set (&p, 199, TRUE);
+
+  g_assert_cmpint (crank_vec_bool_packed_find_first (&p), ==, 3);
+  g_assert_cmpint (crank_vec_bool_packed_find_next (&p, 3), ==, 3);
+  g_assert_cmpint (crank_vec_bool_packed_find_next (&p, 4), ==, 64);
+  g_assert_cmpint (crank_vec_bool_packed_find_next (&p, 65), ==, 199);
+  g_assert_cmpint (crank_vec_bool_packed_find_next (&p, 200), ==, -1);
+  crank_vec_bool_packed_fini (&p);
+
+  test_packed_rand_vb (&a, 1000003);
+  crank_vec_bool_packed_init_from_vb (&p, &a);
+
+  indices = g_new (guint, crank_vec_bool_packed_get_count (&p));
+  count = crank_vec_bool_packed_get_indices (&p, indices);
+  g_assert_cmpuint (count, ==, crank_vec_bool_n_get_count (&a));
+
+  j = 0;
+  for (i = 0; i < a.n; i++)
+    {
+      if (a.data[i])
+        {
+          g_assert_cmpuint (indices[j], ==, i);
+          j++;
+        }
+    }
+
+  j = 0;
+  for (index = crank_vec_bool_packed_find_first (&p);
+       0 <= index;
+       index = crank_vec_bool_packed_find_next (&p, index + 1))
+    {
+      g_assert_cmpuint (index, ==, indices[j]);
+      j++;
+    }
+  g_assert_cmpuint (j, ==, count);
+
+  g_free (indices);
+  crank_vec_bool_n_fini (&a);
+  crank_vec_bool_packed_fini (&p);
+}
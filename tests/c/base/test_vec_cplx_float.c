@@ -54,6 +54,8 @@ static void     test_n_init_ucarr (void);
 static void     test_n_init_ucv (void);
 static void     test_n_init_fill_uc (void);
 
+static void     test_split_ops (void);
+
 
 //////// Main //////////////////////////////////////////////////////////////////
 
@@ -90,6 +92,8 @@ main (gint    argc,
   g_test_add_func ("/crank/base/vec/cplx/float/n/init/fill_uc",
                    test_n_init_fill_uc);
 
+  g_test_add_func ("/crank/base/vec/cplx/float/split/ops", test_split_ops);
+
   g_test_run ();
   return 0;
 }
@@ -550,3 +554,103 @@ test_n_init_fill_uc (void)
 
   crank_vec_cplx_float_n_fini (&a);
 }
+
+static void
+test_split_ops (void)
+{
+  // Sizes cover remaining elements of each SIMD width.
+  guint sizes[] = {0, 1, 5, 8, 15, 16, 33, 100};
+  guint i;
+  guint j;
+
+  for (i = 0; i < G_N_ELEMENTS (sizes); i++)
+    {
+      guint n = sizes[i];
+      guint32 s = n + 1;
+      CrankCplxFloat scalar = {0.5f, -1.5f};
+      CrankCplxFloat dot;
+      CrankCplxFloat v;
+
+      CrankVecCplxFloatN a;
+      CrankVecCplxFloatN b;
+      CrankVecCplxFloatN r;
+      CrankVecSplitCplxFloat sa;
+      CrankVecSplitCplxFloat sb;
+      CrankVecSplitCplxFloat sr;
+
+      crank_vec_cplx_float_n_init_fill_uc (&a, n, 0.0f, 0.0f);
+      crank_vec_cplx_float_n_init_fill_uc (&b, n, 0.0f, 0.0f);
+
+      for (j = 0; j < n; j++)
+        {
+          s = s * 1664525u + 1013904223u;
+          a.data[j].real = (gfloat)(s >> 8) / 16777216.0f - 0.5f;
+          s = s * 1664525u + 1013904223u;
+          a.data[j].imag = (gfloat)(s >> 8) / 16777216.0f - 0.5f;
+          s = s * 1664525u + 1013904223u;
+          b.data[j].real = (gfloat)(s >> 8) / 16777216.0f - 0.5f;
+          s = s * 1664525u + 1013904223u;
+          b.data[j].imag = (gfloat)(s >> 8) / 16777216.0f - 0.5f;
+        }
+
+      crank_vec_split_cplx_float_init_cplx (&sa, &a);
+      crank_vec_split_cplx_float_init_cplx (&sb, &b);
+      g_assert_cmpuint (crank_vec_split_cplx_float_get_size (&sa), ==, n);
+
+      // Component multiplication.
+      crank_vec_cplx_float_n_cmpmul (&a, &b, &r);
+      crank_vec_split_cplx_float_cmpmul (&sa, &sb, &sr);
+      for (j = 0; j < n; j++)
+        {
+          crank_vec_split_cplx_float_get (&sr, j, &v);
+          crank_assert_eqcplxfloat (&v, r.data + j);
+        }
+      crank_vec_cplx_float_n_fini (&r);
+      crank_vec_split_cplx_float_fini (&sr);
+
+      // Scalar multiplication.
+      crank_vec_cplx_float_n_muls (&a, &scalar, &r);
+      crank_vec_split_cplx_float_muls (&sa, &scalar, &sr);
+      for (j = 0; j < n; j++)
+        {
+          crank_vec_split_cplx_float_get (&sr, j, &v);
+          crank_assert_eqcplxfloat (&v, r.data + j);
+        }
+      crank_vec_cplx_float_n_fini (&r);
+      crank_vec_split_cplx_float_fini (&sr);
+
+      // Addition, and conversion back.
+      crank_vec_cplx_float_n_add (&a, &b, &r);
+      crank_vec_split_cplx_float_add (&sa, &sb, &sr);
+      crank_vec_cplx_float_n_fini (&a);
+      crank_vec_split_cplx_float_to_cplx (&sr, &a);
+      g_assert_cmpuint (a.n, ==, n);
+      for (j = 0; j < n; j++)
+        crank_assert_eqcplxfloat (a.data + j, r.data + j);
+      crank_vec_cplx_float_n_fini (&r);
+      crank_vec_split_cplx_float_fini (&sr);
+
+      crank_vec_cplx_float_n_fini (&a);
+      crank_vec_split_cplx_float_to_cplx (&sa, &a);
+      crank_vec_cplx_float_n_sub (&a, &b, &r);
+
+      // Dot product conjugates second operand.
+      crank_vec_cplx_float_n_dot (&a, &b, &dot);
+      crank_vec_split_cplx_float_dot (&sa, &sb, &v);
+      crank_assert_eqcplxfloat_d (&v, &dot, 0.0005f);
+
+      crank_vec_split_cplx_float_sub (&sa, &sb, &sr);
+      for (j = 0; j < n; j++)
+        {
+          crank_vec_split_cplx_float_get (&sr, j, &v);
+          crank_assert_eqcplxfloat (&v, r.data + j);
+        }
+
+      crank_vec_split_cplx_float_fini (&sr);
+      crank_vec_split_cplx_float_fini (&sb);
+      crank_vec_split_cplx_float_fini (&sa);
+      crank_vec_cplx_float_n_fini (&r);
+      crank_vec_cplx_float_n_fini (&b);
+      crank_vec_cplx_float_n_fini (&a);
+    }
+}
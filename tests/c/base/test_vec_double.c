@@ -0,0 +1,1041 @@
+/* Copyright (C) 2015, WSID   */
+
+/* Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <glib.h>
+#include "crankbase.h"
+
+//////// Declaration ///////////////////////////////////////////////////////////
+
+static gboolean test_accumulation (const gdouble value,
+                                   gpointer      userdata);
+
+static void     test_2_get (void);
+static void     test_2_foreach (void);
+static void     test_2_equal (void);
+static void     test_2_to_string (void);
+static void     test_2_magn (void);
+static void     test_2_muls (void);
+static void     test_2_divs (void);
+static void     test_2_add (void);
+static void     test_2_sub (void);
+static void     test_2_dot (void);
+static void     test_2_cmpmul (void);
+static void     test_2_cmpdiv (void);
+static void     test_2_cmpmod (void);
+static void     test_2_cmpless (void);
+static void     test_2_cmpeq (void);
+static void     test_2_cmpgreater (void);
+static void     test_2_cmpcmp (void);
+static void     test_2_min (void);
+static void     test_2_max (void);
+static void     test_2_mulm (void);
+static void     test_2_mixs (void);
+static void     test_2_mix (void);
+
+static void     test_3_batch_dot (void);
+static void     test_3_batch_crs (void);
+static void     test_3_batch_unit (void);
+
+static void     test_n_get (void);
+static void     test_n_insert (void);
+static void     test_n_remove (void);
+static void     test_n_foreach (void);
+static void     test_n_equal (void);
+static void     test_n_to_string (void);
+static void     test_n_magn (void);
+static void     test_n_muls (void);
+static void     test_n_divs (void);
+static void     test_n_add (void);
+static void     test_n_sub (void);
+static void     test_n_dot (void);
+static void     test_n_cmpmul (void);
+static void     test_n_cmpdiv (void);
+static void     test_n_cmpmod (void);
+static void     test_n_cmpless (void);
+static void     test_n_cmpeq (void);
+static void     test_n_cmpgreater (void);
+static void     test_n_cmpcmp (void);
+static void     test_n_min (void);
+static void     test_n_max (void);
+static void     test_n_mulm (void);
+static void     test_n_mixs (void);
+static void     test_n_mix (void);
+static void     test_n_neg (void);
+static void     test_n_large (void);
+
+
+//////// Main //////////////////////////////////////////////////////////////////
+
+gint
+main (gint    argc,
+      gchar **argv)
+{
+  g_test_init (&argc, &argv, NULL);
+
+  g_test_add_func ("/crank/base/vec/double/2/get", test_2_get);
+  g_test_add_func ("/crank/base/vec/double/2/foreach", test_2_foreach);
+  g_test_add_func ("/crank/base/vec/double/2/equal", test_2_equal);
+  g_test_add_func ("/crank/base/vec/double/2/to_string", test_2_to_string);
+  g_test_add_func ("/crank/base/vec/double/2/magn", test_2_magn);
+  g_test_add_func ("/crank/base/vec/double/2/muls", test_2_muls);
+  g_test_add_func ("/crank/base/vec/double/2/divs", test_2_divs);
+  g_test_add_func ("/crank/base/vec/double/2/add", test_2_add);
+  g_test_add_func ("/crank/base/vec/double/2/sub", test_2_sub);
+  g_test_add_func ("/crank/base/vec/double/2/dot", test_2_dot);
+  g_test_add_func ("/crank/base/vec/double/2/cmpmul", test_2_cmpmul);
+  g_test_add_func ("/crank/base/vec/double/2/cmpdiv", test_2_cmpdiv);
+  g_test_add_func ("/crank/base/vec/double/2/cmpless", test_2_cmpless);
+  g_test_add_func ("/crank/base/vec/double/2/cmpeq", test_2_cmpeq);
+  g_test_add_func ("/crank/base/vec/double/2/cmpgreater", test_2_cmpgreater);
+  g_test_add_func ("/crank/base/vec/double/2/cmpcmp", test_2_cmpcmp);
+  g_test_add_func ("/crank/base/vec/double/2/min", test_2_min);
+  g_test_add_func ("/crank/base/vec/double/2/max", test_2_max);
+  g_test_add_func ("/crank/base/vec/double/2/mulm", test_2_mulm);
+  g_test_add_func ("/crank/base/vec/double/2/mixs", test_2_mixs);
+  g_test_add_func ("/crank/base/vec/double/2/mix", test_2_mix);
+
+  g_test_add_func ("/crank/base/vec/double/3/batch/dot", test_3_batch_dot);
+  g_test_add_func ("/crank/base/vec/double/3/batch/crs", test_3_batch_crs);
+  g_test_add_func ("/crank/base/vec/double/3/batch/unit", test_3_batch_unit);
+
+  g_test_add_func ("/crank/base/vec/double/n/get", test_n_get);
+  g_test_add_func ("/crank/base/vec/double/n/insert", test_n_insert);
+  g_test_add_func ("/crank/base/vec/double/n/foreach", test_n_foreach);
+  g_test_add_func ("/crank/base/vec/double/n/equal", test_n_equal);
+  g_test_add_func ("/crank/base/vec/double/n/to_string", test_n_to_string);
+  g_test_add_func ("/crank/base/vec/double/n/magn", test_n_magn);
+  g_test_add_func ("/crank/base/vec/double/n/muls", test_n_muls);
+  g_test_add_func ("/crank/base/vec/double/n/divs", test_n_divs);
+  g_test_add_func ("/crank/base/vec/double/n/add", test_n_add);
+  g_test_add_func ("/crank/base/vec/double/n/sub", test_n_sub);
+  g_test_add_func ("/crank/base/vec/double/n/dot", test_n_dot);
+  g_test_add_func ("/crank/base/vec/double/n/cmpmul", test_n_cmpmul);
+  g_test_add_func ("/crank/base/vec/double/n/cmpdiv", test_n_cmpdiv);
+  g_test_add_func ("/crank/base/vec/double/n/cmpless", test_n_cmpless);
+  g_test_add_func ("/crank/base/vec/double/n/cmpeq", test_n_cmpeq);
+  g_test_add_func ("/crank/base/vec/double/n/cmpgreater", test_n_cmpgreater);
+  g_test_add_func ("/crank/base/vec/double/n/cmpcmp", test_n_cmpcmp);
+  g_test_add_func ("/crank/base/vec/double/n/min", test_n_min);
+  g_test_add_func ("/crank/base/vec/double/n/max", test_n_max);
+  g_test_add_func ("/crank/base/vec/double/n/mulm", test_n_mulm);
+  g_test_add_func ("/crank/base/vec/double/n/mixs", test_n_mixs);
+  g_test_add_func ("/crank/base/vec/double/n/mix", test_n_mix);
+  g_test_add_func ("/crank/base/vec/double/n/neg", test_n_neg);
+  g_test_add_func ("/crank/base/vec/double/n/large", test_n_large);
+
+  g_test_run ();
+  return 0;
+}
+
+
+//////// Definition ////////////////////////////////////////////////////////////
+
+
+
+
+static gboolean
+test_accumulation (const gdouble value,
+                   gpointer      userdata)
+{
+  gdouble *sum =   (gdouble*)userdata;
+
+  (*sum) += value;
+  return TRUE;
+}
+
+
+
+
+
+static void
+test_2_get (void)
+{
+  CrankVecDouble2 a = {3.0, 4.0};
+
+  crank_assert_cmpfloat (crank_vec_double2_get (&a, 0), ==, 3.0);
+  crank_assert_cmpfloat (crank_vec_double2_get (&a, 1), ==, 4.0);
+}
+
+static void
+test_2_foreach (void)
+{
+  CrankVecDouble2 a = {3.0, 4.0};
+  gdouble sum = 0.0;
+
+  g_assert (crank_vec_double2_foreach (&a, test_accumulation, &sum));
+
+  crank_assert_cmpfloat (sum, ==, 7.0);
+}
+
+
+static void
+test_2_equal (void)
+{
+  CrankVecDouble2 a =
+  {(gdouble) g_test_rand_double (), (gdouble) g_test_rand_double ()};
+  CrankVecDouble2 b =
+  {(gdouble) g_test_rand_double (), (gdouble) g_test_rand_double ()};
+  CrankVecDouble2 c = {a.x, a.y};
+
+  g_assert (!crank_vec_double2_equal (&a, &b));
+  g_assert (crank_vec_double2_equal (&a, &c));
+}
+
+
+static void
+test_2_to_string (void)
+{
+  CrankVecDouble2 a = {3.0, 4.0};
+  gchar *astr = crank_vec_double2_to_string (&a);
+
+  g_assert_cmpstr (astr, ==, "(3, 4)");
+}
+
+
+static void
+test_2_magn (void)
+{
+  CrankVecDouble2 a = {3.0, 4.0};
+
+  crank_assert_cmpfloat (crank_vec_double2_get_magn_sq (&a), ==, 25.0);
+  crank_assert_cmpfloat (crank_vec_double2_get_magn (&a), ==, 5.0);
+}
+
+
+static void
+test_2_unit (void)
+{
+  CrankVecDouble2 a = {3.0, 4.0};
+  CrankVecDouble2 r;
+
+  crank_vec_double2_unit (&a, &r);
+
+  crank_assert_eq_vecdouble2_imm (&r, 0.6, 0.8);
+}
+
+
+static void
+test_2_muls (void)
+{
+  CrankVecDouble2 a = {3.0, 4.0};
+  CrankVecDouble2 r;
+
+  crank_vec_double2_muls (&a, 2.0, &r);
+
+  crank_assert_eq_vecdouble2_imm (&r, 6.0, 8.0);
+}
+
+
+static void
+test_2_divs (void)
+{
+  CrankVecDouble2 a = {3.0, 4.0};
+  CrankVecDouble2 r;
+
+  crank_vec_double2_divs (&a, 2.0, &r);
+
+  crank_assert_eq_vecdouble2_imm (&r, 1.5, 2.0);
+}
+
+
+static void
+test_2_add (void)
+{
+  CrankVecDouble2 a = {3.0, 4.0};
+  CrankVecDouble2 b = {5.0, 12.0};
+  CrankVecDouble2 r;
+
+  crank_vec_double2_add (&a, &b, &r);
+
+  crank_assert_eq_vecdouble2_imm (&r, 8.0, 16.0);
+}
+
+
+static void
+test_2_sub (void)
+{
+  CrankVecDouble2 a = {3.0, 4.0};
+  CrankVecDouble2 b = {5.0, 12.0};
+  CrankVecDouble2 r;
+
+  crank_vec_double2_sub (&a, &b, &r);
+
+  crank_assert_eq_vecdouble2_imm (&r, -2.0, -8.0);
+}
+
+
+static void
+test_2_dot (void)
+{
+  CrankVecDouble2 a = {3.0, 4.0};
+  CrankVecDouble2 b = {5.0, 12.0};
+
+  crank_assert_cmpfloat (crank_vec_double2_dot (&a, &b), ==, 63.0);
+}
+
+
+static void
+test_2_cmpmul (void)
+{
+  CrankVecDouble2 a = {3.0, 4.0};
+  CrankVecDouble2 b = {5.0, 12.0};
+  CrankVecDouble2 r;
+
+  crank_vec_double2_cmpmul (&a, &b, &r);
+
+  crank_assert_eq_vecdouble2_imm (&r, 15.0, 48.0);
+}
+
+
+static void
+test_2_cmpdiv (void)
+{
+  CrankVecDouble2 a = {3.0, 4.0};
+  CrankVecDouble2 b = {5.0, 12.0};
+  CrankVecDouble2 r;
+
+  crank_vec_double2_cmpdiv (&b, &a, &r);
+
+  crank_assert_eq_vecdouble2_imm (&r, (5.0 / 3.0), 3.0);
+}
+
+
+static void
+test_2_cmpless (void)
+{
+  CrankVecDouble2 a = {17.0, 21.0};
+  CrankVecDouble2 b = {53.0, 20.0};
+  CrankVecBool2 r;
+
+  crank_vec_double2_cmpless (&a, &b, &r);
+
+  g_assert_true  (r.x);
+  g_assert_false (r.y);
+}
+
+
+static void
+test_2_cmpeq (void)
+{
+  CrankVecDouble2 a = {17.0, 20.0};
+  CrankVecDouble2 b = {53.0, 20.0};
+  CrankVecBool2 r;
+
+  crank_vec_double2_cmpeq (&a, &b, &r);
+
+  g_assert_false (r.x);
+  g_assert_true  (r.y);
+}
+
+
+static void
+test_2_cmpgreater (void)
+{
+  CrankVecDouble2 a = {17.0, 21.0};
+  CrankVecDouble2 b = {53.0, 20.0};
+  CrankVecBool2 r;
+
+  crank_vec_double2_cmpgreater (&a, &b, &r);
+
+  g_assert_false (r.x);
+  g_assert_true  (r.y);
+}
+
+
+static void
+test_2_cmpcmp (void)
+{
+  CrankVecDouble2 a = {17.0, 21.0};
+  CrankVecDouble2 b = {53.0, 20.0};
+  CrankVecInt2 r;
+
+  crank_vec_double2_cmpcmp (&a, &b, &r);
+
+  g_assert_cmpint (r.x, <, 0);
+  g_assert_cmpint (r.y, >, 0);
+}
+
+
+static void
+test_2_min (void)
+{
+  CrankVecDouble2 a = {17.0, 21.0};
+  CrankVecDouble2 b = {53.0, 20.0};
+  CrankVecDouble2 r;
+
+  crank_vec_double2_min (&a, &b, &r);
+
+  crank_assert_eq_vecdouble2_imm (&r, 17.0, 20.0);
+}
+
+
+static void
+test_2_max (void)
+{
+  CrankVecDouble2 a = {17.0, 21.0};
+  CrankVecDouble2 b = {53.0, 20.0};
+  CrankVecDouble2 r;
+
+  crank_vec_double2_max (&a, &b, &r);
+
+  crank_assert_eq_vecdouble2_imm (&r, 53.0, 21.0);
+}
+
+
+static void
+test_2_mulm (void)
+{
+  CrankVecDouble2 a = {3.0, 4.0};
+  CrankMatDouble2 b = {1.0, 2.0,    3.0, 4.0};
+  CrankVecDouble2 r;
+
+  crank_vec_double2_mulm (&a, &b, &r);
+
+  crank_assert_eq_vecdouble2_imm (&r, 15.0, 22.0);
+}
+
+
+static void
+test_2_mixs (void)
+{
+  CrankVecDouble2 a = {17.0, 21.0};
+  CrankVecDouble2 b = {32.0, 11.0};
+  CrankVecDouble2 r;
+
+  crank_vec_double2_mixs (&a, &b, 0.2, &r);
+
+  crank_assert_eq_vecdouble2_imm (&r, 20.0, 19.0);
+}
+
+
+static void
+test_2_mix (void)
+{
+  CrankVecDouble2 a = {17.0, 21.0};
+  CrankVecDouble2 b = {32.0, 11.0};
+  CrankVecDouble2 c = {0.6, 0.5};
+  CrankVecDouble2 r;
+
+  crank_vec_double2_mix (&a, &b, &c, &r);
+
+  crank_assert_eq_vecdouble2_imm (&r, 26.0, 16.0);
+}
+
+
+static void
+test_3_batch_dot (void)
+{
+  CrankVecDouble3 a[37];
+  CrankVecDouble3 b[37];
+  gdouble r[37];
+  guint i;
+
+  for (i = 0; i < 37; i++)
+    {
+      crank_vec_double3_init (a + i, i * 0.5, 3.0 - i, 1.0);
+      crank_vec_double3_init (b + i, 2.0, i * 0.25, i - 7.0);
+    }
+
+  crank_vec_double3_batch_dot (37, a, b, r);
+
+  for (i = 0; i < 37; i++)
+    crank_assert_cmpfloat (r[i], ==, crank_vec_double3_dot (a + i, b + i));
+}
+
+static void
+test_3_batch_crs (void)
+{
+  CrankVecDouble3 a[37];
+  CrankVecDouble3 b[37];
+  CrankVecDouble3 r[37];
+  guint i;
+
+  for (i = 0; i < 37; i++)
+    {
+      crank_vec_double3_init (a + i, i * 0.5, 3.0 - i, 1.0);
+      crank_vec_double3_init (b + i, 2.0, i * 0.25, i - 7.0);
+    }
+
+  crank_vec_double3_batch_crs (37, a, b, r);
+
+  for (i = 0; i < 37; i++)
+    {
+      CrankVecDouble3 e;
+
+      crank_vec_double3_crs (a + i, b + i, &e);
+      crank_assert_eq_vecdouble3_imm (r + i, e.x, e.y, e.z);
+    }
+
+  // In-place.
+  crank_vec_double3_batch_crs (37, a, b, a);
+
+  for (i = 0; i < 37; i++)
+    crank_assert_eq_vecdouble3_imm (a + i, r[i].x, r[i].y, r[i].z);
+}
+
+static void
+test_3_batch_unit (void)
+{
+  CrankVecDouble3 a[37];
+  CrankVecDouble3 r[37];
+  guint i;
+
+  for (i = 0; i < 37; i++)
+    crank_vec_double3_init (a + i, i * 0.5, 3.0 - i, 1.0);
+
+  crank_vec_double3_batch_unit (37, a, r);
+
+  for (i = 0; i < 37; i++)
+    {
+      CrankVecDouble3 e;
+
+      crank_vec_double3_unit (a + i, &e);
+      crank_assert_eq_vecdouble3_imm (r + i, e.x, e.y, e.z);
+    }
+}
+
+
+
+
+
+static void
+test_n_get (void)
+{
+  CrankVecDoubleN a;
+  crank_vec_double_n_init (&a, 2, 3.0, 4.0);
+
+  crank_assert_cmpfloat (crank_vec_double_n_get (&a, 0), ==, 3.0);
+  crank_assert_cmpfloat (crank_vec_double_n_get (&a, 1), ==, 4.0);
+
+  crank_vec_double_n_fini (&a);
+}
+
+
+static void
+test_n_insert (void)
+{
+  CrankVecDoubleN a;
+
+  crank_vec_double_n_init (&a, 2, 3.0, 4.0);
+  crank_vec_double_n_insert (&a, 1, 12.0);
+
+  crank_assert_eq_vecdouble_n_imm (&a, 3.0, 12.0, 4.0);
+
+  crank_vec_double_n_fini (&a);
+}
+
+
+static void
+test_n_remove (void)
+{
+  CrankVecDoubleN a;
+
+  crank_vec_double_n_init (&a, 2, 3.0, 4.0);
+  crank_vec_double_n_remove (&a, 1);
+
+  crank_assert_eq_vecdouble_n_imm (&a, 3.0);
+
+  crank_vec_double_n_fini (&a);
+}
+
+
+static void
+test_n_foreach (void)
+{
+  CrankVecDoubleN a;
+  gdouble sum = 0.0;
+
+  crank_vec_double_n_init (&a, 2, 3.0, 4.0);
+
+  g_assert (crank_vec_double_n_foreach (&a, test_accumulation, &sum));
+
+  crank_assert_cmpfloat (sum, ==, 7.0);
+
+  crank_vec_double_n_fini (&a);
+}
+
+
+static void
+test_n_equal (void)
+{
+  CrankVecDoubleN a;
+  CrankVecDoubleN b;
+  CrankVecDoubleN c;
+
+  crank_vec_double_n_init (&a, 2,
+                           g_test_rand_double (),
+                           g_test_rand_double ()   );
+  crank_vec_double_n_init (&b, 2,
+                           g_test_rand_double (),
+                           g_test_rand_double ()   );
+  crank_vec_double_n_init_arr (&c, a.n, a.data);
+
+  g_assert (!crank_vec_double_n_equal (&a, &b));
+  g_assert (crank_vec_double_n_equal (&a, &c));
+
+  crank_vec_double_n_fini (&a);
+  crank_vec_double_n_fini (&b);
+  crank_vec_double_n_fini (&c);
+}
+
+
+static void
+test_n_to_string (void)
+{
+  CrankVecDoubleN a;
+  crank_vec_double_n_init (&a, 2, 3.0, 4.0);
+
+  gchar *astr = crank_vec_double_n_to_string (&a);
+
+  g_assert_cmpstr (astr, ==, "(3, 4)");
+
+  crank_vec_double_n_fini (&a);
+}
+
+
+static void
+test_n_magn (void)
+{
+  CrankVecDoubleN a;
+  crank_vec_double_n_init (&a, 2, 3.0, 4.0);
+
+  crank_assert_cmpfloat (crank_vec_double_n_get_magn_sq (&a), ==, 25.0);
+  crank_assert_cmpfloat (crank_vec_double_n_get_magn (&a), ==, 5.0);
+
+  crank_vec_double_n_fini (&a);
+}
+
+
+static void
+test_n_unit (void)
+{
+  CrankVecDoubleN a;
+  CrankVecDoubleN r;
+  crank_vec_double_n_init (&a, 2, 3.0, 4.0);
+
+  crank_vec_double_n_unit (&a, &r);
+
+  crank_assert_eq_vecdouble_n_imm(&r, 0.6, 0.8);
+
+  crank_vec_double_n_fini (&a);
+  crank_vec_double_n_fini (&r);
+}
+
+
+static void
+test_n_muls (void)
+{
+  CrankVecDoubleN a;
+  CrankVecDoubleN r;
+  crank_vec_double_n_init (&a, 2, 3.0, 4.0);
+
+  crank_vec_double_n_muls (&a, 2.0, &r);
+
+  crank_assert_eq_vecdouble_n_imm(&r, 6.0, 8.0);
+
+  crank_vec_double_n_fini (&a);
+  crank_vec_double_n_fini (&r);
+}
+
+
+static void
+test_n_divs (void)
+{
+  CrankVecDoubleN a;
+  CrankVecDoubleN r;
+  crank_vec_double_n_init (&a, 2, 3.0, 4.0);
+
+  crank_vec_double_n_divs (&a, 2.0, &r);
+
+  crank_assert_eq_vecdouble_n_imm(&r, 1.5, 2.0);
+
+  crank_vec_double_n_fini (&a);
+  crank_vec_double_n_fini (&r);
+}
+
+
+static void
+test_n_add (void)
+{
+  CrankVecDoubleN a;
+  CrankVecDoubleN b;
+  CrankVecDoubleN r;
+  crank_vec_double_n_init (&a, 2, 3.0, 4.0);
+  crank_vec_double_n_init (&b, 2, 5.0, 12.0);
+
+  crank_vec_double_n_add (&a, &b, &r);
+
+  crank_assert_eq_vecdouble_n_imm(&r, 8.0, 16.0);
+
+  crank_vec_double_n_fini (&a);
+  crank_vec_double_n_fini (&b);
+  crank_vec_double_n_fini (&r);
+}
+
+
+static void
+test_n_sub (void)
+{
+  CrankVecDoubleN a;
+  CrankVecDoubleN b;
+  CrankVecDoubleN r;
+  crank_vec_double_n_init (&a, 2, 3.0, 4.0);
+  crank_vec_double_n_init (&b, 2, 5.0, 12.0);
+
+  crank_vec_double_n_sub (&a, &b, &r);
+
+  crank_assert_eq_vecdouble_n_imm(&r, -2.0, -8.0);
+
+  crank_vec_double_n_fini (&a);
+  crank_vec_double_n_fini (&b);
+  crank_vec_double_n_fini (&r);
+}
+
+
+static void
+test_n_dot (void)
+{
+  CrankVecDoubleN a;
+  CrankVecDoubleN b;
+  crank_vec_double_n_init (&a, 2, 3.0, 4.0);
+  crank_vec_double_n_init (&b, 2, 5.0, 12.0);
+
+  crank_assert_cmpfloat (crank_vec_double_n_dot (&a, &b), ==, 63.0);
+
+  crank_vec_double_n_fini (&a);
+  crank_vec_double_n_fini (&b);
+}
+
+
+static void
+test_n_cmpmul (void)
+{
+  CrankVecDoubleN a;
+  CrankVecDoubleN b;
+  CrankVecDoubleN r;
+  crank_vec_double_n_init (&a, 2, 3.0, 4.0);
+  crank_vec_double_n_init (&b, 2, 5.0, 12.0);
+
+  crank_vec_double_n_cmpmul (&a, &b, &r);
+
+  crank_assert_eq_vecdouble_n_imm (&r, 15.0, 48.0);
+
+  crank_vec_double_n_fini (&a);
+  crank_vec_double_n_fini (&b);
+  crank_vec_double_n_fini (&r);
+}
+
+
+static void
+test_n_cmpdiv (void)
+{
+  CrankVecDoubleN a;
+  CrankVecDoubleN b;
+  CrankVecDoubleN r;
+  crank_vec_double_n_init (&a, 2, 3.0, 4.0);
+  crank_vec_double_n_init (&b, 2, 5.0, 12.0);
+
+  crank_vec_double_n_cmpdiv (&b, &a, &r);
+
+  crank_assert_eq_vecdouble_n_imm(&r, (5.0 / 3.0), 3.0);
+
+  crank_vec_double_n_fini (&a);
+  crank_vec_double_n_fini (&b);
+  crank_vec_double_n_fini (&r);
+}
+
+
+static void
+test_n_cmpless (void)
+{
+  CrankVecDoubleN a;
+  CrankVecDoubleN b;
+  crank_vec_double_n_init (&a, 2, 17.0, 21.0);
+  crank_vec_double_n_init (&b, 2, 53.0, 20.0);
+  CrankVecBoolN r;
+
+  crank_vec_double_n_cmpless (&a, &b, &r);
+
+  g_assert_true  (r.data[0]);
+  g_assert_false (r.data[1]);
+
+  crank_vec_double_n_fini (&a);
+  crank_vec_double_n_fini (&b);
+  crank_vec_bool_n_fini (&r);
+}
+
+
+static void
+test_n_cmpeq (void)
+{
+  CrankVecDoubleN a;
+  CrankVecDoubleN b;
+  crank_vec_double_n_init (&a, 2, 17.0, 20.0);
+  crank_vec_double_n_init (&b, 2, 53.0, 20.0);
+  CrankVecBoolN r;
+
+  crank_vec_double_n_cmpeq (&a, &b, &r);
+
+  g_assert_false (r.data[0]);
+  g_assert_true  (r.data[1]);
+
+  crank_vec_double_n_fini (&a);
+  crank_vec_double_n_fini (&b);
+  crank_vec_bool_n_fini (&r);
+}
+
+
+static void
+test_n_cmpgreater (void)
+{
+  CrankVecDoubleN a;
+  CrankVecDoubleN b;
+  crank_vec_double_n_init (&a, 2, 17.0, 21.0);
+  crank_vec_double_n_init (&b, 2, 53.0, 20.0);
+  CrankVecBoolN r;
+
+  crank_vec_double_n_cmpgreater (&a, &b, &r);
+
+  g_assert_false (r.data[0]);
+  g_assert_true  (r.data[1]);
+
+  crank_vec_double_n_fini (&a);
+  crank_vec_double_n_fini (&b);
+  crank_vec_bool_n_fini (&r);
+}
+
+
+static void
+test_n_cmpcmp (void)
+{
+  CrankVecDoubleN a;
+  CrankVecDoubleN b;
+  crank_vec_double_n_init (&a, 2, 17.0, 21.0);
+  crank_vec_double_n_init (&b, 2, 53.0, 20.0);
+  CrankVecIntN r;
+
+  crank_vec_double_n_cmpcmp (&a, &b, &r);
+
+  g_assert_cmpint (r.data[0], <, 0);
+  g_assert_cmpint (r.data[1], >, 0);
+
+  crank_vec_double_n_fini (&a);
+  crank_vec_double_n_fini (&b);
+  crank_vec_int_n_fini (&r);
+}
+
+
+static void
+test_n_min (void)
+{
+  CrankVecDoubleN a;
+  CrankVecDoubleN b;
+  crank_vec_double_n_init (&a, 2, 17.0, 21.0);
+  crank_vec_double_n_init (&b, 2, 53.0, 20.0);
+  CrankVecDoubleN r;
+
+  crank_vec_double_n_min (&a, &b, &r);
+
+  crank_assert_eq_vecdouble_n_imm(&r, 17.0, 20.0);
+
+  crank_vec_double_n_fini (&a);
+  crank_vec_double_n_fini (&b);
+  crank_vec_double_n_fini (&r);
+}
+
+
+static void
+test_n_max (void)
+{
+  CrankVecDoubleN a;
+  CrankVecDoubleN b;
+  crank_vec_double_n_init (&a, 2, 17.0, 21.0);
+  crank_vec_double_n_init (&b, 2, 53.0, 20.0);
+  CrankVecDoubleN r;
+
+  crank_vec_double_n_max (&a, &b, &r);
+
+  crank_assert_eq_vecdouble_n_imm(&r, 53.0, 21.0);
+
+  crank_vec_double_n_fini (&a);
+  crank_vec_double_n_fini (&b);
+  crank_vec_double_n_fini (&r);
+}
+
+
+static void
+test_n_mixs (void)
+{
+  CrankVecDoubleN a;
+  CrankVecDoubleN b;
+  crank_vec_double_n_init (&a, 2, 17.0, 21.0);
+  crank_vec_double_n_init (&b, 2, 32.0, 11.0);
+  CrankVecDoubleN r;
+
+  crank_vec_double_n_mixs (&a, &b, 0.2, &r);
+
+  crank_assert_eq_vecdouble_n_imm(&r, 20.0, 19.0);
+
+  crank_vec_double_n_fini (&a);
+  crank_vec_double_n_fini (&b);
+  crank_vec_double_n_fini (&r);
+}
+
+
+static void
+test_n_mulm (void)
+{
+  CrankVecDoubleN a;
+  CrankMatDoubleN b = {0};
+  CrankVecDoubleN r;
+  crank_vec_double_n_init (&a, 3, 2.0, 5.0, 7.0);
+  crank_mat_double_n_init (&b, 3, 2,
+                           1.0, 2.0,
+                           3.0, 4.0,
+                           5.0, 6.0);
+
+  crank_vec_double_n_mulm (&a, &b, &r);
+
+  crank_assert_eq_vecdouble_n_imm(&r, 52.0, 66.0);
+
+  crank_vec_double_n_fini (&a);
+  crank_mat_double_n_fini (&b);
+  crank_vec_double_n_fini (&r);
+}
+
+
+static void
+test_n_mix (void)
+{
+  CrankVecDoubleN a;
+  CrankVecDoubleN b;
+  CrankVecDoubleN c;
+  crank_vec_double_n_init (&a, 2, 17.0, 21.0);
+  crank_vec_double_n_init (&b, 2, 32.0, 11.0);
+  crank_vec_double_n_init (&c, 2, 0.6, 0.5);
+  CrankVecDoubleN r;
+
+  crank_vec_double_n_mix (&a, &b, &c, &r);
+
+  crank_assert_eq_vecdouble_n_imm(&r, 26.0, 16.0);
+
+  crank_vec_double_n_fini (&a);
+  crank_vec_double_n_fini (&b);
+  crank_vec_double_n_fini (&c);
+  crank_vec_double_n_fini (&r);
+}
+
+static void
+test_n_neg (void)
+{
+  CrankVecDoubleN a;
+  CrankVecDoubleN r;
+
+  crank_vec_double_n_init (&a, 3, 3.0, -4.0, 0.5);
+
+  crank_vec_double_n_neg (&a, &r);
+  crank_assert_eq_vecdouble_n_imm (&r, -3.0, 4.0, -0.5);
+
+  crank_vec_double_n_neg_self (&a);
+  crank_assert_eq_vecdouble_n_imm (&a, -3.0, 4.0, -0.5);
+
+  crank_vec_double_n_fini (&a);
+  crank_vec_double_n_fini (&r);
+}
+
+static void
+test_n_large (void)
+{
+  // Size is not multiple of any SIMD width, to check remainders.
+  const guint n = 1037;
+
+  CrankVecDoubleN a;
+  CrankVecDoubleN b;
+  CrankVecDoubleN c;
+  CrankVecDoubleN r;
+  gdouble dot = 0;
+  guint i;
+
+  crank_vec_double_n_init_fill (&a, n, 0.0);
+  crank_vec_double_n_init_fill (&b, n, 0.0);
+  crank_vec_double_n_init_fill (&c, n, 0.0);
+
+  g_assert_cmpuint ((gsize) a.data % 64, ==, 0);
+
+  for (i = 0; i < n; i++)
+    {
+      a.data[i] = (i % 17) * 0.25 - 2.0;
+      b.data[i] = (i % 13) * 0.5 + 1.0;
+      c.data[i] = (i % 5) * 0.25;
+      dot += (gdouble) a.data[i] * b.data[i];
+    }
+
+  crank_vec_double_n_add (&a, &b, &r);
+  for (i = 0; i < n; i++)
+    crank_assert_cmpfloat (r.data[i], ==, a.data[i] + b.data[i]);
+  crank_vec_double_n_fini (&r);
+
+  crank_vec_double_n_sub (&a, &b, &r);
+  for (i = 0; i < n; i++)
+    crank_assert_cmpfloat (r.data[i], ==, a.data[i] - b.data[i]);
+  crank_vec_double_n_fini (&r);
+
+  crank_vec_double_n_cmpmul (&a, &b, &r);
+  for (i = 0; i < n; i++)
+    crank_assert_cmpfloat (r.data[i], ==, a.data[i] * b.data[i]);
+  crank_vec_double_n_fini (&r);
+
+  crank_vec_double_n_cmpdiv (&a, &b, &r);
+  for (i = 0; i < n; i++)
+    crank_assert_cmpfloat (r.data[i], ==, a.data[i] / b.data[i]);
+  crank_vec_double_n_fini (&r);
+
+  crank_vec_double_n_muls (&a, 3.0, &r);
+  for (i = 0; i < n; i++)
+    crank_assert_cmpfloat (r.data[i], ==, a.data[i] * 3.0);
+  crank_vec_double_n_fini (&r);
+
+  crank_vec_double_n_mixs (&a, &b, 0.25, &r);
+  for (i = 0; i < n; i++)
+    crank_assert_cmpfloat (r.data[i], ==,
+                           a.data[i] * 0.75 + b.data[i] * 0.25);
+  crank_vec_double_n_fini (&r);
+
+  crank_vec_double_n_mix (&a, &b, &c, &r);
+  for (i = 0; i < n; i++)
+    crank_assert_cmpfloat (r.data[i], ==,
+                           a.data[i] * (1.0 - c.data[i]) +
+                           b.data[i] * c.data[i]);
+  crank_vec_double_n_fini (&r);
+
+  crank_assert_eqfloat (crank_vec_double_n_dot (&a, &b), (gdouble) dot, 0.01);
+
+  crank_vec_double_n_copy (&a, &r);
+  crank_vec_double_n_add_self (&r, &b);
+  crank_vec_double_n_sub_self (&r, &b);
+  for (i = 0; i < n; i++)
+    crank_assert_cmpfloat (r.data[i], ==, a.data[i]);
+  crank_vec_double_n_fini (&r);
+
+  crank_vec_double_n_fini (&a);
+  crank_vec_double_n_fini (&b);
+  crank_vec_double_n_fini (&c);
+}
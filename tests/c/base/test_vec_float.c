@@ -50,6 +50,10 @@ static void     test_2_mulm (void);
 static void     test_2_mixs (void);
 static void     test_2_mix (void);
 
+static void     test_3_batch_dot (void);
+static void     test_3_batch_crs (void);
+static void     test_3_batch_unit (void);
+
 static void     test_n_get (void);
 static void     test_n_insert (void);
 static void     test_n_remove (void);
@@ -74,6 +78,10 @@ static void     test_n_max (void);
 static void     test_n_mulm (void);
 static void     test_n_mixs (void);
 static void     test_n_mix (void);
+static void     test_n_neg (void);
+static void     test_n_large (void);
+static void     test_n_masked (void);
+static void     test_n_cmpmask (void);
 
 
 //////// Main //////////////////////////////////////////////////////////////////
@@ -106,6 +114,10 @@ main (gint    argc,
   g_test_add_func ("/crank/base/vec/float/2/mixs", test_2_mixs);
   g_test_add_func ("/crank/base/vec/float/2/mix", test_2_mix);
 
+  g_test_add_func ("/crank/base/vec/float/3/batch/dot", test_3_batch_dot);
+  g_test_add_func ("/crank/base/vec/float/3/batch/crs", test_3_batch_crs);
+  g_test_add_func ("/crank/base/vec/float/3/batch/unit", test_3_batch_unit);
+
   g_test_add_func ("/crank/base/vec/float/n/get", test_n_get);
   g_test_add_func ("/crank/base/vec/float/n/insert", test_n_insert);
   g_test_add_func ("/crank/base/vec/float/n/foreach", test_n_foreach);
@@ -128,6 +140,10 @@ main (gint    argc,
   g_test_add_func ("/crank/base/vec/float/n/mulm", test_n_mulm);
   g_test_add_func ("/crank/base/vec/float/n/mixs", test_n_mixs);
   g_test_add_func ("/crank/base/vec/float/n/mix", test_n_mix);
+  g_test_add_func ("/crank/base/vec/float/n/neg", test_n_neg);
+  g_test_add_func ("/crank/base/vec/float/n/large", test_n_large);
+  g_test_add_func ("/crank/base/vec/float/n/masked", test_n_masked);
+  g_test_add_func ("/crank/base/vec/float/n/cmpmask", test_n_cmpmask);
 
   g_test_run ();
   return 0;
@@ -428,6 +444,79 @@ test_2_mix (void)
 }
 
 
+static void
+test_3_batch_dot (void)
+{
+  CrankVecFloat3 a[37];
+  CrankVecFloat3 b[37];
+  gfloat r[37];
+  guint i;
+
+  for (i = 0; i < 37; i++)
+    {
+      crank_vec_float3_init (a + i, i * 0.5f, 3.0f - i, 1.0f);
+      crank_vec_float3_init (b + i, 2.0f, i * 0.25f, i - 7.0f);
+    }
+
+  crank_vec_float3_batch_dot (37, a, b, r);
+
+  for (i = 0; i < 37; i++)
+    crank_assert_cmpfloat (r[i], ==, crank_vec_float3_dot (a + i, b + i));
+}
+
+static void
+test_3_batch_crs (void)
+{
+  CrankVecFloat3 a[37];
+  CrankVecFloat3 b[37];
+  CrankVecFloat3 r[37];
+  guint i;
+
+  for (i = 0; i < 37; i++)
+    {
+      crank_vec_float3_init (a + i, i * 0.5f, 3.0f - i, 1.0f);
+      crank_vec_float3_init (b + i, 2.0f, i * 0.25f, i - 7.0f);
+    }
+
+  crank_vec_float3_batch_crs (37, a, b, r);
+
+  for (i = 0; i < 37; i++)
+    {
+      CrankVecFloat3 e;
+
+      crank_vec_float3_crs (a + i, b + i, &e);
+      crank_assert_eq_vecfloat3_imm (r + i, e.x, e.y, e.z);
+    }
+
+  // In-place.
+  crank_vec_float3_batch_crs (37, a, b, a);
+
+  for (i = 0; i < 37; i++)
+    crank_assert_eq_vecfloat3_imm (a + i, r[i].x, r[i].y, r[i].z);
+}
+
+static void
+test_3_batch_unit (void)
+{
+  CrankVecFloat3 a[37];
+  CrankVecFloat3 r[37];
+  guint i;
+
+  for (i = 0; i < 37; i++)
+    crank_vec_float3_init (a + i, i * 0.5f, 3.0f - i, 1.0f);
+
+  crank_vec_float3_batch_unit (37, a, r);
+
+  for (i = 0; i < 37; i++)
+    {
+      CrankVecFloat3 e;
+
+      crank_vec_float3_unit (a + i, &e);
+      crank_assert_eq_vecfloat3_imm (r + i, e.x, e.y, e.z);
+    }
+}
+
+
 
 
 
@@ -856,4 +945,237 @@ test_n_mix (void)
   crank_vec_float_n_fini (&b);
   crank_vec_float_n_fini (&c);
   crank_vec_float_n_fini (&r);
-}
\ No newline at end of file
+}
+
+static void
+test_n_neg (void)
+{
+  CrankVecFloatN a;
+  CrankVecFloatN r;
+
+  crank_vec_float_n_init (&a, 3, 3.0f, -4.0f, 0.5f);
+
+  crank_vec_float_n_neg (&a, &r);
+  crank_assert_eq_vecfloat_n_imm (&r, -3.0f, 4.0f, -0.5f);
+
+  crank_vec_float_n_neg_self (&a);
+  crank_assert_eq_vecfloat_n_imm (&a, -3.0f, 4.0f, -0.5f);
+
+  crank_vec_float_n_fini (&a);
+  crank_vec_float_n_fini (&r);
+}
+
+static void
+test_n_large (void)
+{
+  // Size is not multiple of any SIMD width, to check remainders.
+  const guint n = 1037;
+
+  CrankVecFloatN a;
+  CrankVecFloatN b;
+  CrankVecFloatN c;
+  CrankVecFloatN r;
+  gdouble dot = 0;
+  guint i;
+
+  crank_vec_float_n_init_fill (&a, n, 0.0f);
+  crank_vec_float_n_init_fill (&b, n, 0.0f);
+  crank_vec_float_n_init_fill (&c, n, 0.0f);
+
+  g_assert_cmpuint ((gsize) a.data % 64, ==, 0);
+
+  for (i = 0; i < n; i++)
+    {
+      a.data[i] = (i % 17) * 0.25f - 2.0f;
+      b.data[i] = (i % 13) * 0.5f + 1.0f;
+      c.data[i] = (i % 5) * 0.25f;
+      dot += (gdouble) a.data[i] * b.data[i];
+    }
+
+  crank_vec_float_n_add (&a, &b, &r);
+  for (i = 0; i < n; i++)
+    crank_assert_cmpfloat (r.data[i], ==, a.data[i] + b.data[i]);
+  crank_vec_float_n_fini (&r);
+
+  crank_vec_float_n_sub (&a, &b, &r);
+  for (i = 0; i < n; i++)
+    crank_assert_cmpfloat (r.data[i], ==, a.data[i] - b.data[i]);
+  crank_vec_float_n_fini (&r);
+
+  crank_vec_float_n_cmpmul (&a, &b, &r);
+  for (i = 0; i < n; i++)
+    crank_assert_cmpfloat (r.data[i], ==, a.data[i] * b.data[i]);
+  crank_vec_float_n_fini (&r);
+
+  crank_vec_float_n_cmpdiv (&a, &b, &r);
+  for (i = 0; i < n; i++)
+    crank_assert_cmpfloat (r.data[i], ==, a.data[i] / b.data[i]);
+  crank_vec_float_n_fini (&r);
+
+  crank_vec_float_n_muls (&a, 3.0f, &r);
+  for (i = 0; i < n; i++)
+    crank_assert_cmpfloat (r.data[i], ==, a.data[i] * 3.0f);
+  crank_vec_float_n_fini (&r);
+
+  crank_vec_float_n_mixs (&a, &b, 0.25f, &r);
+  for (i = 0; i < n; i++)
+    crank_assert_cmpfloat (r.data[i], ==,
+                           a.data[i] * 0.75f + b.data[i] * 0.25f);
+  crank_vec_float_n_fini (&r);
+
+  crank_vec_float_n_mix (&a, &b, &c, &r);
+  for (i = 0; i < n; i++)
+    crank_assert_cmpfloat (r.data[i], ==,
+                           a.data[i] * (1.0f - c.data[i]) +
+                           b.data[i] * c.data[i]);
+  crank_vec_float_n_fini (&r);
+
+  crank_assert_eqfloat (crank_vec_float_n_dot (&a, &b), (gfloat) dot, 0.01f);
+
+  crank_vec_float_n_copy (&a, &r);
+  crank_vec_float_n_add_self (&r, &b);
+  crank_vec_float_n_sub_self (&r, &b);
+  for (i = 0; i < n; i++)
+    crank_assert_cmpfloat (r.data[i], ==, a.data[i]);
+  crank_vec_float_n_fini (&r);
+
+  crank_vec_float_n_fini (&a);
+  crank_vec_float_n_fini (&b);
+  crank_vec_float_n_fini (&c);
+}
+
+
+static gboolean
+test_cmp_op (const CrankVecCmpOp op,
+             const gfloat          a,
+             const gfloat          b)
+{
+  switch (op)
+    {
+    case CRANK_VEC_CMP_LESS:        return a < b;
+    case CRANK_VEC_CMP_LESS_EQ:     return a <= b;
+    case CRANK_VEC_CMP_EQ:          return a == b;
+    case CRANK_VEC_CMP_NOT_EQ:      return a != b;
+    case CRANK_VEC_CMP_GREATER_EQ:  return a >= b;
+    case CRANK_VEC_CMP_GREATER:     return a > b;
+    }
+  return FALSE;
+}
+
+static void
+test_n_masked (void)
+{
+  // Size is not multiple of any SIMD width, to check remainders.
+  const guint n = 1037;
+
+  CrankVecFloatN a;
+  CrankVecFloatN b;
+  CrankVecFloatN r;
+  CrankVecFloatN e;
+  CrankVecBoolN mask;
+  guint count = 0;
+  guint i;
+  guint j;
+
+  crank_vec_float_n_init_fill (&a, n, 0);
+  crank_vec_float_n_init_fill (&b, n, 0);
+  crank_vec_bool_n_init_fill (&mask, n, FALSE);
+
+  for (i = 0; i < n; i++)
+    {
+      a.data[i] = (i % 17) * 0.25f - 2.0f;
+      b.data[i] = (i % 13) * 0.5f - 3.0f;
+      mask.data[i] = (i % 3 == 0) || (i % 7 == 1);
+      count += mask.data[i];
+    }
+
+  crank_vec_float_n_blend (&a, &b, &mask, &r);
+  for (i = 0; i < n; i++)
+    crank_assert_cmpfloat (r.data[i], ==, mask.data[i] ? b.data[i] : a.data[i]);
+  crank_vec_float_n_fini (&r);
+
+  crank_vec_float_n_masked_add (&a, &b, &mask, &r);
+  for (i = 0; i < n; i++)
+    crank_assert_cmpfloat (r.data[i], ==, mask.data[i] ? a.data[i] + b.data[i] : a.data[i]);
+  crank_vec_float_n_fini (&r);
+
+  crank_vec_float_n_masked_mul (&a, &b, &mask, &r);
+  for (i = 0; i < n; i++)
+    crank_assert_cmpfloat (r.data[i], ==, mask.data[i] ? a.data[i] * b.data[i] : a.data[i]);
+
+  crank_vec_float_n_masked_mul_self (&a, &b, &mask);
+  for (i = 0; i < n; i++)
+    crank_assert_cmpfloat (a.data[i], ==, r.data[i]);
+  crank_vec_float_n_fini (&r);
+
+  crank_vec_float_n_compress (&a, &mask, &r);
+  g_assert_cmpuint (r.n, ==, count);
+  for (i = 0, j = 0; i < n; i++)
+    if (mask.data[i])
+      {
+        crank_assert_cmpfloat (r.data[j], ==, a.data[i]);
+        j++;
+      }
+
+  crank_vec_float_n_expand (&r, &mask, 3, &e);
+  g_assert_cmpuint (e.n, ==, n);
+  for (i = 0; i < n; i++)
+    crank_assert_cmpfloat (e.data[i], ==, mask.data[i] ? a.data[i] : 3);
+
+  crank_vec_float_n_fini (&a);
+  crank_vec_float_n_fini (&b);
+  crank_vec_float_n_fini (&r);
+  crank_vec_float_n_fini (&e);
+  crank_vec_bool_n_fini (&mask);
+}
+
+static void
+test_n_cmpmask (void)
+{
+  const guint n = 1037;
+
+  CrankVecFloatN a;
+  CrankVecFloatN b;
+  CrankVecFloatN r;
+  CrankVecCmpOp op;
+  guint i;
+  guint j;
+
+  crank_vec_float_n_init_fill (&a, n, 0);
+  crank_vec_float_n_init_fill (&b, n, 0);
+
+  for (i = 0; i < n; i++)
+    {
+      a.data[i] = (i % 17) * 0.25f - 2.0f;
+      b.data[i] = (i % 13) * 0.5f - 3.0f;
+    }
+
+  for (op = CRANK_VEC_CMP_LESS; op <= CRANK_VEC_CMP_GREATER; op++)
+    {
+      guint count = 0;
+
+      for (i = 0; i < n; i++)
+        count += test_cmp_op (op, a.data[i], b.data[i]);
+
+      g_assert_cmpuint (crank_vec_float_n_cmpcount (&a, op, &b), ==, count);
+
+      crank_vec_float_n_cmpblend (&a, op, &b, &b, &a, &r);
+      for (i = 0; i < n; i++)
+        crank_assert_cmpfloat (r.data[i], ==, test_cmp_op (op, a.data[i], b.data[i]) ?
+                                 b.data[i] : a.data[i]);
+      crank_vec_float_n_fini (&r);
+
+      crank_vec_float_n_cmpcompress (&a, op, &b, &r);
+      g_assert_cmpuint (r.n, ==, count);
+      for (i = 0, j = 0; i < n; i++)
+        if (test_cmp_op (op, a.data[i], b.data[i]))
+          {
+            crank_assert_cmpfloat (r.data[j], ==, a.data[i]);
+            j++;
+          }
+      crank_vec_float_n_fini (&r);
+    }
+
+  crank_vec_float_n_fini (&a);
+  crank_vec_float_n_fini (&b);
+}
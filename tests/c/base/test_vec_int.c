@@ -74,6 +74,8 @@ static void     test_n_cmpgreater (void);
 static void     test_n_cmpcmp (void);
 static void     test_n_min (void);
 static void     test_n_max (void);
+static void     test_n_masked (void);
+static void     test_n_cmpmask (void);
 
 
 //////// Main //////////////////////////////////////////////////////////////////
@@ -129,6 +131,8 @@ main (gint    argc,
   g_test_add_func ("/crank/base/vec/int/n/cmpcmp", test_n_cmpcmp);
   g_test_add_func ("/crank/base/vec/int/n/min", test_n_min);
   g_test_add_func ("/crank/base/vec/int/n/max", test_n_max);
+  g_test_add_func ("/crank/base/vec/int/n/masked", test_n_masked);
+  g_test_add_func ("/crank/base/vec/int/n/cmpmask", test_n_cmpmask);
 
   g_test_run ();
   return 0;
@@ -838,4 +842,140 @@ test_n_max (void)
   crank_vec_int_n_fini (&a);
   crank_vec_int_n_fini (&b);
   crank_vec_int_n_fini (&r);
-}
\ No newline at end of file
+}
+
+
+static gboolean
+test_cmp_op (const CrankVecCmpOp op,
+             const gint          a,
+             const gint          b)
+{
+  switch (op)
+    {
+    case CRANK_VEC_CMP_LESS:        return a < b;
+    case CRANK_VEC_CMP_LESS_EQ:     return a <= b;
+    case CRANK_VEC_CMP_EQ:          return a == b;
+    case CRANK_VEC_CMP_NOT_EQ:      return a != b;
+    case CRANK_VEC_CMP_GREATER_EQ:  return a >= b;
+    case CRANK_VEC_CMP_GREATER:     return a > b;
+    }
+  return FALSE;
+}
+
+static void
+test_n_masked (void)
+{
+  // Size is not multiple of any SIMD width, to check remainders.
+  const guint n = 1037;
+
+  CrankVecIntN a;
+  CrankVecIntN b;
+  CrankVecIntN r;
+  CrankVecIntN e;
+  CrankVecBoolN mask;
+  guint count = 0;
+  guint i;
+  guint j;
+
+  crank_vec_int_n_init_fill (&a, n, 0);
+  crank_vec_int_n_init_fill (&b, n, 0);
+  crank_vec_bool_n_init_fill (&mask, n, FALSE);
+
+  for (i = 0; i < n; i++)
+    {
+      a.data[i] = (gint)(i % 17) - 8;
+      b.data[i] = (gint)(i % 13) - 6;
+      mask.data[i] = (i % 3 == 0) || (i % 7 == 1);
+      count += mask.data[i];
+    }
+
+  crank_vec_int_n_blend (&a, &b, &mask, &r);
+  for (i = 0; i < n; i++)
+    g_assert_cmpint (r.data[i], ==, mask.data[i] ? b.data[i] : a.data[i]);
+  crank_vec_int_n_fini (&r);
+
+  crank_vec_int_n_masked_add (&a, &b, &mask, &r);
+  for (i = 0; i < n; i++)
+    g_assert_cmpint (r.data[i], ==, mask.data[i] ? a.data[i] + b.data[i] : a.data[i]);
+  crank_vec_int_n_fini (&r);
+
+  crank_vec_int_n_masked_mul (&a, &b, &mask, &r);
+  for (i = 0; i < n; i++)
+    g_assert_cmpint (r.data[i], ==, mask.data[i] ? a.data[i] * b.data[i] : a.data[i]);
+
+  crank_vec_int_n_masked_mul_self (&a, &b, &mask);
+  for (i = 0; i < n; i++)
+    g_assert_cmpint (a.data[i], ==, r.data[i]);
+  crank_vec_int_n_fini (&r);
+
+  crank_vec_int_n_compress (&a, &mask, &r);
+  g_assert_cmpuint (r.n, ==, count);
+  for (i = 0, j = 0; i < n; i++)
+    if (mask.data[i])
+      {
+        g_assert_cmpint (r.data[j], ==, a.data[i]);
+        j++;
+      }
+
+  crank_vec_int_n_expand (&r, &mask, 3, &e);
+  g_assert_cmpuint (e.n, ==, n);
+  for (i = 0; i < n; i++)
+    g_assert_cmpint (e.data[i], ==, mask.data[i] ? a.data[i] : 3);
+
+  crank_vec_int_n_fini (&a);
+  crank_vec_int_n_fini (&b);
+  crank_vec_int_n_fini (&r);
+  crank_vec_int_n_fini (&e);
+  crank_vec_bool_n_fini (&mask);
+}
+
+static void
+test_n_cmpmask (void)
+{
+  const guint n = 1037;
+
+  CrankVecIntN a;
+  CrankVecIntN b;
+  CrankVecIntN r;
+  CrankVecCmpOp op;
+  guint i;
+  guint j;
+
+  crank_vec_int_n_init_fill (&a, n, 0);
+  crank_vec_int_n_init_fill (&b, n, 0);
+
+  for (i = 0; i < n; i++)
+    {
+      a.data[i] = (gint)(i % 17) - 8;
+      b.data[i] = (gint)(i % 13) - 6;
+    }
+
+  for (op = CRANK_VEC_CMP_LESS; op <= CRANK_VEC_CMP_GREATER; op++)
+    {
+      guint count = 0;
+
+      for (i = 0; i < n; i++)
+        count += test_cmp_op (op, a.data[i], b.data[i]);
+
+      g_assert_cmpuint (crank_vec_int_n_cmpcount (&a, op, &b), ==, count);
+
+      crank_vec_int_n_cmpblend (&a, op, &b, &b, &a, &r);
+      for (i = 0; i < n; i++)
+        g_assert_cmpint (r.data[i], ==, test_cmp_op (op, a.data[i], b.data[i]) ?
+                                 b.data[i] : a.data[i]);
+      crank_vec_int_n_fini (&r);
+
+      crank_vec_int_n_cmpcompress (&a, op, &b, &r);
+      g_assert_cmpuint (r.n, ==, count);
+      for (i = 0, j = 0; i < n; i++)
+        if (test_cmp_op (op, a.data[i], b.data[i]))
+          {
+            g_assert_cmpint (r.data[j], ==, a.data[i]);
+            j++;
+          }
+      crank_vec_int_n_fini (&r);
+    }
+
+  crank_vec_int_n_fini (&a);
+  crank_vec_int_n_fini (&b);
+}
@@ -36,6 +36,15 @@ void    test_2_compose (void);
 void    test_2_transv (void);
 
 
+void    test_3_batch_compose (void);
+
+void    test_3_batch_transv (void);
+
+void    test_3_flatten (void);
+
+void    test_3_flatten_parallel (void);
+
+
 int main (int    argc,
           char **argv)
 {
@@ -59,10 +68,82 @@ int main (int    argc,
   g_test_add_func ("/crank/shape/trans/2/transv",
                    test_2_transv);
 
+
+  g_test_add_func ("/crank/shape/trans/3/batch/compose",
+                   test_3_batch_compose);
+
+  g_test_add_func ("/crank/shape/trans/3/batch/transv",
+                   test_3_batch_transv);
+
+  g_test_add_func ("/crank/shape/trans/3/flatten",
+                   test_3_flatten);
+
+  g_test_add_func ("/crank/shape/trans/3/flatten/parallel",
+                   test_3_flatten_parallel);
+
   return g_test_run ();
 }
 
 
+static void
+test_3_init_sample (CrankTrans3 *t,
+                    const guint  i)
+{
+  crank_vec_float3_init (& t->mtrans,
+                         (gfloat)(i % 7) - 3,
+                         (gfloat)(i % 5) * 0.5f,
+                         (gfloat)(i % 3) - 1);
+
+  crank_quat_float_init_urot (& t->mrot,
+                              0.1f * (i % 31),
+                              (i % 3 == 0) ? 1 : 0,
+                              (i % 3 == 1) ? 1 : 0,
+                              (i % 3 == 2) ? 1 : 0);
+
+  t->mscl = 1.0f + 0.01f * (i % 5);
+}
+
+static void
+test_3_assert_eq (CrankTrans3 *a,
+                  CrankTrans3 *b)
+{
+  crank_assert_eqfloat (a->mtrans.x, b->mtrans.x, 0.001f);
+  crank_assert_eqfloat (a->mtrans.y, b->mtrans.y, 0.001f);
+  crank_assert_eqfloat (a->mtrans.z, b->mtrans.z, 0.001f);
+
+  crank_assert_eqfloat (a->mrot.w, b->mrot.w, 0.0001f);
+  crank_assert_eqfloat (a->mrot.x, b->mrot.x, 0.0001f);
+  crank_assert_eqfloat (a->mrot.y, b->mrot.y, 0.0001f);
+  crank_assert_eqfloat (a->mrot.z, b->mrot.z, 0.0001f);
+
+  crank_assert_eqfloat (a->mscl, b->mscl, 0.0001f);
+}
+
+/*
+ * Builds hierarchy of n nodes, where each node has 3 children, and every
+ * 1000th node starts a new tree.
+ */
+static void
+test_3_init_hierarchy (const guint  n,
+                       gint        *parents,
+                       CrankTrans3 *locals,
+                       CrankTrans3 *expected)
+{
+  guint i;
+
+  for (i = 0; i < n; i++)
+    {
+      parents[i] = (i % 1000 == 0) ? -1 : (gint)((i - 1) / 3);
+      test_3_init_sample (locals + i, i);
+
+      if (parents[i] < 0)
+        expected[i] = locals[i];
+      else
+        crank_trans3_compose (expected + parents[i], locals + i, expected + i);
+    }
+}
+
+
 void
 test_2_translate (void)
 {
@@ -184,3 +265,132 @@ test_2_transv (void)
   crank_assert_cmpfloat (c.x, ==, -6.8995f);
   crank_assert_cmpfloat (c.y, ==, 28.0416f);
 }
+
+
+void
+test_3_batch_compose (void)
+{
+  CrankTrans3 a[37];
+  CrankTrans3 b[37];
+  CrankTrans3 r[37];
+  CrankTrans3 e;
+  guint i;
+
+  for (i = 0; i < 37; i++)
+    {
+      test_3_init_sample (a + i, i);
+      test_3_init_sample (b + i, i * 7 + 3);
+    }
+
+  crank_trans3_batch_compose (37, a, b, r);
+
+  for (i = 0; i < 37; i++)
+    {
+      crank_trans3_compose (a + i, b + i, &e);
+      test_3_assert_eq (r + i, &e);
+    }
+
+  // In place
+  crank_trans3_batch_compose (37, a, b, b);
+
+  for (i = 0; i < 37; i++)
+    test_3_assert_eq (b + i, r + i);
+}
+
+void
+test_3_batch_transv (void)
+{
+  CrankTrans3 a;
+  CrankVecFloat3 b[37];
+  CrankVecFloat3 r[37];
+  CrankVecFloat3 e;
+
+  gfloat x[37];
+  gfloat y[37];
+  gfloat z[37];
+  guint i;
+
+  test_3_init_sample (&a, 11);
+
+  for (i = 0; i < 37; i++)
+    {
+      crank_vec_float3_init (b + i, i * 0.5f, 3.0f - i, (i % 4) * 2.0f);
+      x[i] = b[i].x;
+      y[i] = b[i].y;
+      z[i] = b[i].z;
+    }
+
+  crank_trans3_batch_transv (37, &a, b, r);
+  crank_trans3_soa_transv (37, &a, x, y, z, x, y, z);
+
+  for (i = 0; i < 37; i++)
+    {
+      crank_trans3_transv (&a, b + i, &e);
+
+      crank_assert_eqfloat (r[i].x, e.x, 0.001f);
+      crank_assert_eqfloat (r[i].y, e.y, 0.001f);
+      crank_assert_eqfloat (r[i].z, e.z, 0.001f);
+
+      crank_assert_eqfloat (x[i], e.x, 0.001f);
+      crank_assert_eqfloat (y[i], e.y, 0.001f);
+      crank_assert_eqfloat (z[i], e.z, 0.001f);
+    }
+}
+
+void
+test_3_flatten (void)
+{
+  guint n = 3000;
+  gint *parents = g_new (gint, n);
+  CrankTrans3 *locals = g_new (CrankTrans3, n);
+  CrankTrans3 *worlds = g_new (CrankTrans3, n);
+  CrankTrans3 *expected = g_new (CrankTrans3, n);
+  guint i;
+
+  test_3_init_hierarchy (n, parents, locals, expected);
+
+  crank_trans3_flatten (n, parents, locals, worlds);
+
+  for (i = 0; i < n; i++)
+    test_3_assert_eq (worlds + i, expected + i);
+
+  // In place
+  crank_trans3_flatten (n, parents, locals, locals);
+
+  for (i = 0; i < n; i++)
+    test_3_assert_eq (locals + i, expected + i);
+
+  g_free (parents);
+  g_free (locals);
+  g_free (worlds);
+  g_free (expected);
+}
+
+void
+test_3_flatten_parallel (void)
+{
+  guint n = 40000;
+  gint *parents = g_new (gint, n);
+  CrankTrans3 *locals = g_new (CrankTrans3, n);
+  CrankTrans3 *worlds = g_new (CrankTrans3, n);
+  CrankTrans3 *expected = g_new (CrankTrans3, n);
+  guint i;
+
+  test_3_init_hierarchy (n, parents, locals, expected);
+
+  crank_trans3_flatten_parallel (n, parents, locals, worlds, 4);
+
+  for (i = 0; i < n; i++)
+    test_3_assert_eq (worlds + i, expected + i);
+
+  // In place
+  crank_trans3_flatten_parallel (n, parents, locals, locals, 4);
+
+  for (i = 0; i < n; i++)
+    test_3_assert_eq (locals + i, expected + i);
+
+  g_free (parents);
+  g_free (locals);
+  g_free (worlds);
+  g_free (expected);
+}